@@ -0,0 +1,298 @@
+// alloc_creation.m.cpp                                               -*-C++-*-
+
+//@PURPOSE: Benchmark the creation and destruction of containers by allocator.
+//
+//@SEE_ALSO: alloc_locality.m.cpp, allocationstrategy
+//
+//@DESCRIPTION: This program implements the first benchmark of N4468 and P0089
+// ("Creation and Destruction"): each call of the run function creates a
+// container using an allocator of one of the strategies of
+// 'benchmarks::AllocationStrategy', inserts a number of elements into it, and
+// destroys it.  The containers are 'bsl::vector<int>', 'bsl::list<int>',
+// 'bsl::unordered_set<int>', and 'bsl::vector<bsl::string>' (having strings
+// too long for the short-string buffer, so that every element allocates),
+// having 64 and 4096 elements.  Each benchmark is labelled
+// "Create/<container>/<strategy>/T<threads>/N<elements>", for example
+// "Create/ListInt/multipool/T1/N4096".
+//
+// Each thread uses its own allocator, except for the thread-safe strategies,
+// whose single allocator is shared by all the threads.  As in N4468, an
+// allocator that is not shared, and can release all its memory at once, is
+// released after each container is destroyed (as if each container had its
+// own allocator), and the benchmark is also run with the container "winked
+// out" (labelled "<strategy>+winkout"): the container is not destroyed, and
+// its memory is reclaimed only by releasing the allocator.  Run with
+// '--threads 1,4' (for example) to measure the effect of concurrency; only the
+// first count of each '--threads' entry is used.
+
+#include <allocationstrategy.h>
+#include <benchmarkutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_cyclecounter.h>
+#include <bsls_objectbuffer.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef benchmarks::AllocationStrategy AllocationStrategy;
+typedef benchmarks::StrategyAllocator  StrategyAllocator;
+
+const char k_TEXT[] = "a string too long for the short-string buffer";
+
+// ============================================================================
+//                              CONTAINER FILLERS
+// ----------------------------------------------------------------------------
+
+void fill(bsl::vector<int> *container, int numElements)
+    // Append the specified 'numElements' elements to the specified
+    // 'container'.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->push_back(i);
+    }
+}
+
+void fill(bsl::list<int> *container, int numElements)
+    // Append the specified 'numElements' elements to the specified
+    // 'container'.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->push_back(i);
+    }
+}
+
+void fill(bsl::unordered_set<int> *container, int numElements)
+    // Insert the specified 'numElements' elements into the specified
+    // 'container'.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->insert(i);
+    }
+}
+
+void fill(bsl::vector<bsl::string> *container, int numElements)
+    // Append the specified 'numElements' elements to the specified
+    // 'container'.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->emplace_back(k_TEXT);
+    }
+}
+
+                          // =======================
+                          // class CreationBenchmark
+                          // =======================
+
+template <class CONTAINER>
+class CreationBenchmark {
+    // This class provides the run function of one creation benchmark, and
+    // owns the allocators it uses.
+
+    // DATA
+    bsl::vector<StrategyAllocator *> d_allocators;   // one per thread, or
+                                                     // one shared
+    bool                             d_winkOut;      // do not destroy
+    bool                             d_release;      // release after each
+                                                     // container
+    int                              d_numElements;  // elements per container
+
+    // NOT IMPLEMENTED
+    CreationBenchmark(const CreationBenchmark&);
+    CreationBenchmark& operator=(const CreationBenchmark&);
+
+  public:
+    // CREATORS
+    CreationBenchmark(AllocationStrategy::Enum strategy,
+                      bool                     winkOut,
+                      int                      numElements,
+                      int                      numThreads)
+    : d_allocators()
+    , d_winkOut(winkOut)
+    , d_release(AllocationStrategy::canRelease(strategy)
+             && !AllocationStrategy::isThreadSafe(strategy))
+    , d_numElements(numElements)
+    {
+        const int numAllocators = AllocationStrategy::isThreadSafe(strategy)
+                                  ? 1
+                                  : numThreads;
+        for (int i = 0; i < numAllocators; ++i) {
+            d_allocators.push_back(new StrategyAllocator(strategy));
+        }
+    }
+
+    ~CreationBenchmark()
+    {
+        for (bsl::size_t i = 0; i < d_allocators.size(); ++i) {
+            delete d_allocators[i];
+        }
+    }
+
+    // MANIPULATORS
+    void run(int threadIndex)
+        // Create, fill, and destroy (or wink out) one container.
+    {
+        const int          index     = 1 == d_allocators.size()
+                                       ? 0
+                                       : threadIndex;
+        StrategyAllocator *allocator = d_allocators[index];
+
+        if (d_winkOut) {
+            bsls::ObjectBuffer<CONTAINER> buffer;
+            new (buffer.buffer()) CONTAINER(allocator->allocator());
+            fill(&buffer.object(), d_numElements);
+        }
+        else {
+            CONTAINER container(allocator->allocator());
+            fill(&container, d_numElements);
+        }
+
+        if (d_release) {
+            allocator->release();
+        }
+    }
+};
+
+// ============================================================================
+//                              BENCHMARK DRIVER
+// ----------------------------------------------------------------------------
+
+template <class CONTAINER>
+void runCreation(benchmarks::Reporter       *reporter,
+                 const bsl::string&          label,
+                 AllocationStrategy::Enum    strategy,
+                 bool                        winkOut,
+                 int                         numElements,
+                 int                         numThreads,
+                 const benchmarks::Options&  options)
+    // Run, with the specified 'options', and report to the specified
+    // 'reporter' the creation benchmark of 'CONTAINER' having the specified
+    // 'label', 'strategy', 'winkOut' flag, 'numElements', and 'numThreads'.
+{
+    typedef CreationBenchmark<CONTAINER> Benchmark;
+
+    Benchmark                  creation(strategy,
+                                        winkOut,
+                                        numElements,
+                                        numThreads);
+    bslmt::ThroughputBenchmark benchmark;
+
+    benchmark.addThreadGroup(bdlf::BindUtil::bind(&Benchmark::run,
+                                                  &creation,
+                                                  bdlf::PlaceHolders::_1),
+                             numThreads,
+                             options.d_busyWorkAmount);
+
+    bslmt::ThroughputBenchmarkResult result;
+    benchmarks::BenchmarkUtil::execute(&result, &benchmark, options);
+
+    const char *groups[] = { "threads" };
+    reporter->report(label, result, groups);
+}
+
+template <class CONTAINER>
+void runContainer(benchmarks::Reporter       *reporter,
+                  const char                 *containerName,
+                  const benchmarks::Options&  options)
+    // Run, with the specified 'options', and report to the specified
+    // 'reporter' the creation benchmarks of 'CONTAINER', having the specified
+    // 'containerName', for every strategy, size, and thread count.
+{
+    static const int k_SIZES[]   = { 64, 4096 };
+    const int        k_NUM_SIZES = sizeof k_SIZES / sizeof *k_SIZES;
+
+    for (int s = 0; s < AllocationStrategy::k_NUM_STRATEGIES; ++s) {
+        const AllocationStrategy::Enum strategy =
+                                   static_cast<AllocationStrategy::Enum>(s);
+
+        const bool canWinkOut = AllocationStrategy::canRelease(strategy)
+                            && !AllocationStrategy::isThreadSafe(strategy);
+
+        for (int winkOut = 0; winkOut <= canWinkOut; ++winkOut) {
+            for (bsl::size_t t = 0; t < options.d_threads.size(); ++t) {
+                for (int n = 0; n < k_NUM_SIZES; ++n) {
+                    const int numThreads = options.d_threads[t].first;
+
+                    bsl::ostringstream label;
+                    label << "Create/" << containerName << '/'
+                          << AllocationStrategy::toAscii(strategy)
+                          << (winkOut ? "+winkout" : "")
+                          << "/T" << numThreads << "/N" << k_SIZES[n];
+
+                    if (options.isSelected(label.str())) {
+                        runCreation<CONTAINER>(reporter,
+                                               label.str(),
+                                               strategy,
+                                               winkOut,
+                                               k_SIZES[n],
+                                               numThreads,
+                                               options);
+                    }
+                }
+            }
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    benchmarks::Options options;
+    options.d_threads.clear();
+    options.d_threads.push_back(benchmarks::Options::ThreadCounts(1, 1));
+
+    int rc = options.parse(argc, argv, bsl::cerr);
+    if (rc) {
+        return 0 < rc ? 0 : 1;                                        // RETURN
+    }
+
+    bsls::CycleCounter::calibrate();
+
+    benchmarks::Reporter reporter(bsl::cout, options.d_format);
+
+    runContainer<bsl::vector<int> >(&reporter, "VectorInt", options);
+    runContainer<bsl::list<int> >(&reporter, "ListInt", options);
+    runContainer<bsl::unordered_set<int> >(&reporter,
+                                           "UnorderedSetInt",
+                                           options);
+    runContainer<bsl::vector<bsl::string> >(&reporter,
+                                            "VectorString",
+                                            options);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
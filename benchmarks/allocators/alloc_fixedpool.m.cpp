@@ -0,0 +1,285 @@
+// alloc_fixedpool.m.cpp                                              -*-C++-*-
+
+//@PURPOSE: Benchmark 'bdlma::ConcurrentFixedPool' with and without caching.
+//
+//@SEE_ALSO: alloc_creation.m.cpp, bdlma_concurrentfixedpoolcache
+//
+//@DESCRIPTION: This program measures the throughput of a
+// 'bdlma::ConcurrentFixedPool' shared by several threads, each call of the run
+// function allocating a burst of blocks, writing to them, and deallocating
+// them.  The blocks are allocated and deallocated in one of these modes:
+//
+//: 'pool':
+//:   one at a time, with 'allocate' and 'deallocate' on the pool
+//:
+//: 'batch':
+//:   all at once, with 'allocateBatch' and 'deallocateBatch' on the pool
+//:
+//: 'cache<N>':
+//:   one at a time, through a 'bdlma::ConcurrentFixedPoolCache' of batch size
+//:   'N' owned by each thread
+//
+// Each benchmark is labelled "FixedPool/<mode>/T<threads>/B<burst>", for
+// example "FixedPool/cache32/T4/B1".  The bursts are of 1 and 16 blocks of 64
+// bytes.  The capacity of the pool is the '--capacity' option, raised if
+// needed so that the pool cannot be exhausted.  Run with '--threads 1,2,4,8'
+// (for example) to measure the effect of contention on the free list of the
+// pool; only the first count of each '--threads' entry is used.
+
+#include <benchmarkutil.h>
+
+#include <bdlma_concurrentfixedpool.h>
+#include <bdlma_concurrentfixedpoolcache.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_assert.h>
+#include <bsls_cyclecounter.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+enum {
+    k_BLOCK_SIZE    = 64,  // size of the blocks of the pool
+    k_MAX_BURST     = 16   // largest number of blocks held by a thread
+};
+
+                               // ==========
+                               // struct Mode
+                               // ==========
+
+struct Mode {
+    // This 'struct' provides a namespace enumerating the ways in which the
+    // blocks are allocated from the pool.
+
+    // TYPES
+    enum Enum {
+        e_POOL,     // 'allocate' and 'deallocate' on the pool
+        e_BATCH,    // 'allocateBatch' and 'deallocateBatch' on the pool
+        e_CACHE8,   // per-thread cache of batch size 8
+        e_CACHE32   // per-thread cache of batch size 32
+    };
+
+    enum { k_NUM_MODES = e_CACHE32 + 1 };
+
+    // CLASS METHODS
+    static int batchSize(Enum mode)
+        // Return the batch size of the caches used in the specified 'mode',
+        // or 0 if 'mode' does not use caches.
+    {
+        return e_CACHE8  == mode ? 8
+             : e_CACHE32 == mode ? 32
+             :                     0;
+    }
+
+    static const char *toAscii(Enum mode)
+        // Return the name of the specified 'mode'.
+    {
+        switch (mode) {
+          case e_POOL:    return "pool";
+          case e_BATCH:   return "batch";
+          case e_CACHE8:  return "cache8";
+          case e_CACHE32: return "cache32";
+        }
+        return "(* UNKNOWN *)";
+    }
+};
+
+                          // ========================
+                          // class FixedPoolBenchmark
+                          // ========================
+
+class FixedPoolBenchmark {
+    // This class provides the run function of one benchmark, and owns the
+    // pool and the caches it uses.
+
+    // DATA
+    bdlma::ConcurrentFixedPool                     d_pool;    // shared pool
+    bsl::vector<bdlma::ConcurrentFixedPoolCache *> d_caches;  // one per
+                                                              // thread, if
+                                                              // caching
+    Mode::Enum                                     d_mode;
+    int                                            d_burst;   // blocks per
+                                                              // run
+
+    // NOT IMPLEMENTED
+    FixedPoolBenchmark(const FixedPoolBenchmark&);
+    FixedPoolBenchmark& operator=(const FixedPoolBenchmark&);
+
+  public:
+    // CREATORS
+    FixedPoolBenchmark(Mode::Enum mode,
+                       int        burst,
+                       int        numThreads,
+                       int        capacity)
+    : d_pool(k_BLOCK_SIZE,
+             bsl::max(capacity,
+                      numThreads * (burst + 2 * Mode::batchSize(mode))))
+    , d_caches()
+    , d_mode(mode)
+    , d_burst(burst)
+    {
+        const int batchSize = Mode::batchSize(mode);
+        if (batchSize) {
+            for (int i = 0; i < numThreads; ++i) {
+                d_caches.push_back(
+                     new bdlma::ConcurrentFixedPoolCache(&d_pool, batchSize));
+            }
+        }
+    }
+
+    ~FixedPoolBenchmark()
+    {
+        for (bsl::size_t i = 0; i < d_caches.size(); ++i) {
+            delete d_caches[i];
+        }
+    }
+
+    // MANIPULATORS
+    void run(int threadIndex)
+        // Allocate a burst of blocks, write to them, and deallocate them.
+    {
+        void *blocks[k_MAX_BURST];
+
+        switch (d_mode) {
+          case Mode::e_POOL: {
+            for (int i = 0; i < d_burst; ++i) {
+                blocks[i] = d_pool.allocate();
+                *static_cast<int *>(blocks[i]) = threadIndex;
+            }
+            for (int i = 0; i < d_burst; ++i) {
+                d_pool.deallocate(blocks[i]);
+            }
+          } break;
+          case Mode::e_BATCH: {
+            const int numBlocks = d_pool.allocateBatch(blocks, d_burst);
+            BSLS_ASSERT(d_burst == numBlocks);
+            for (int i = 0; i < numBlocks; ++i) {
+                *static_cast<int *>(blocks[i]) = threadIndex;
+            }
+            d_pool.deallocateBatch(blocks, numBlocks);
+          } break;
+          default: {
+            bdlma::ConcurrentFixedPoolCache *cache = d_caches[threadIndex];
+            for (int i = 0; i < d_burst; ++i) {
+                blocks[i] = cache->allocate();
+                *static_cast<int *>(blocks[i]) = threadIndex;
+            }
+            for (int i = 0; i < d_burst; ++i) {
+                cache->deallocate(blocks[i]);
+            }
+          } break;
+        }
+    }
+};
+
+// ============================================================================
+//                              BENCHMARK DRIVER
+// ----------------------------------------------------------------------------
+
+void runFixedPool(benchmarks::Reporter       *reporter,
+                  const bsl::string&          label,
+                  Mode::Enum                  mode,
+                  int                         burst,
+                  int                         numThreads,
+                  const benchmarks::Options&  options)
+    // Run, with the specified 'options', and report to the specified
+    // 'reporter' the benchmark having the specified 'label', 'mode', 'burst',
+    // and 'numThreads'.
+{
+    FixedPoolBenchmark         fixedPool(mode,
+                                         burst,
+                                         numThreads,
+                                         options.d_capacity);
+    bslmt::ThroughputBenchmark benchmark;
+
+    benchmark.addThreadGroup(bdlf::BindUtil::bind(&FixedPoolBenchmark::run,
+                                                  &fixedPool,
+                                                  bdlf::PlaceHolders::_1),
+                             numThreads,
+                             options.d_busyWorkAmount);
+
+    bslmt::ThroughputBenchmarkResult result;
+    benchmarks::BenchmarkUtil::execute(&result, &benchmark, options);
+
+    const char *groups[] = { "threads" };
+    reporter->report(label, result, groups);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    benchmarks::Options options;
+    options.d_threads.clear();
+    options.d_threads.push_back(benchmarks::Options::ThreadCounts(1, 1));
+
+    int rc = options.parse(argc, argv, bsl::cerr);
+    if (rc) {
+        return 0 < rc ? 0 : 1;                                        // RETURN
+    }
+
+    bsls::CycleCounter::calibrate();
+
+    benchmarks::Reporter reporter(bsl::cout, options.d_format);
+
+    static const int k_BURSTS[]   = { 1, k_MAX_BURST };
+    const int        k_NUM_BURSTS = sizeof k_BURSTS / sizeof *k_BURSTS;
+
+    for (int m = 0; m < Mode::k_NUM_MODES; ++m) {
+        const Mode::Enum mode = static_cast<Mode::Enum>(m);
+
+        for (bsl::size_t t = 0; t < options.d_threads.size(); ++t) {
+            for (int b = 0; b < k_NUM_BURSTS; ++b) {
+                const int numThreads = options.d_threads[t].first;
+
+                bsl::ostringstream label;
+                label << "FixedPool/" << Mode::toAscii(mode)
+                      << "/T" << numThreads << "/B" << k_BURSTS[b];
+
+                if (options.isSelected(label.str())) {
+                    runFixedPool(&reporter,
+                                 label.str(),
+                                 mode,
+                                 k_BURSTS[b],
+                                 numThreads,
+                                 options);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,283 @@
+// alloc_locality.m.cpp                                               -*-C++-*-
+
+//@PURPOSE: Benchmark the effect of allocators on locality of reference.
+//
+//@SEE_ALSO: alloc_creation.m.cpp, allocationstrategy
+//
+//@DESCRIPTION: This program implements the locality and diffusion benchmarks
+// of N4468 and P0089 ("Variation in Locality" and "Variation in Diffusion").
+// Each thread owns a *system* of 64 *subsystems*, each a 'bsl::list<int>'
+// having 4096 elements and its own allocator of one of the strategies of
+// 'benchmarks::AllocationStrategy' (for 'newdelete', every subsystem uses the
+// global heap).  Each call of the run function traverses one subsystem (the
+// subsystems are visited in turn), so the throughput measures how well the
+// nodes of a subsystem are placed in memory, rather than the cost of
+// allocation.
+//
+// Before the benchmark is executed, the systems are built by inserting
+// elements into the subsystems in turn, in chunks of D elements, and then
+// *churned* by repeatedly removing the first element of a randomly chosen
+// subsystem and appending a new one.  With a shared allocator, a small D (and
+// the churn) diffuses the nodes of each subsystem through the memory of the
+// whole system; with an allocator per subsystem, the nodes of each subsystem
+// stay together.  Each benchmark is labelled
+// "Locality/<strategy>/T<threads>/D<chunk>", for D of 1 (maximal diffusion),
+// 64, and 4096 (no interleaving).  Only the first count of each '--threads'
+// entry is used.
+
+#include <allocationstrategy.h>
+#include <benchmarkutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_cyclecounter.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef benchmarks::AllocationStrategy AllocationStrategy;
+typedef benchmarks::StrategyAllocator  StrategyAllocator;
+
+enum {
+    k_NUM_SUBSYSTEMS        = 64,    // subsystems per system
+    k_SUBSYSTEM_SIZE        = 4096,  // elements per subsystem
+    k_NUM_CHURN_PER_ELEMENT = 1      // churn operations per element
+};
+
+                               // ============
+                               // class System
+                               // ============
+
+class System {
+    // This class holds the subsystems, and their allocators, traversed by one
+    // thread.
+
+    // DATA
+    bsl::vector<StrategyAllocator *> d_allocators;  // one per subsystem
+    bsl::vector<bsl::list<int> *>    d_subsystems;
+    int                              d_next;        // next to traverse
+
+    // NOT IMPLEMENTED
+    System(const System&);
+    System& operator=(const System&);
+
+  public:
+    // CREATORS
+    System(AllocationStrategy::Enum strategy, int chunkSize)
+        // Create a system of subsystems using allocators of the specified
+        // 'strategy', filled in chunks of the specified 'chunkSize' elements,
+        // and churned.
+    : d_allocators()
+    , d_subsystems()
+    , d_next(0)
+    {
+        for (int i = 0; i < k_NUM_SUBSYSTEMS; ++i) {
+            d_allocators.push_back(new StrategyAllocator(strategy));
+            d_subsystems.push_back(
+                         new bsl::list<int>(d_allocators.back()->allocator()));
+        }
+
+        for (int done = 0; done < k_SUBSYSTEM_SIZE; done += chunkSize) {
+            for (int i = 0; i < k_NUM_SUBSYSTEMS; ++i) {
+                for (int j = 0; j < chunkSize; ++j) {
+                    d_subsystems[i]->push_back(done + j);
+                }
+            }
+        }
+
+        bsls::Types::Uint64 random = 0x9E3779B97F4A7C15ULL;
+        for (int n = 0;
+             n < k_NUM_SUBSYSTEMS * k_SUBSYSTEM_SIZE * k_NUM_CHURN_PER_ELEMENT;
+             ++n) {
+            random ^= random << 13;
+            random ^= random >> 7;
+            random ^= random << 17;
+
+            bsl::list<int> *subsystem =
+                                       d_subsystems[random % k_NUM_SUBSYSTEMS];
+            subsystem->push_back(subsystem->front());
+            subsystem->pop_front();
+        }
+    }
+
+    ~System()
+    {
+        for (bsl::size_t i = 0; i < d_subsystems.size(); ++i) {
+            delete d_subsystems[i];
+            delete d_allocators[i];
+        }
+    }
+
+    // MANIPULATORS
+    int traverse()
+        // Return the sum of the elements of the next subsystem.
+    {
+        const bsl::list<int>& subsystem = *d_subsystems[d_next];
+        d_next = (d_next + 1) % k_NUM_SUBSYSTEMS;
+
+        int sum = 0;
+        for (bsl::list<int>::const_iterator it = subsystem.begin();
+             it != subsystem.end();
+             ++it) {
+            sum += *it;
+        }
+        return sum;
+    }
+};
+
+                          // =======================
+                          // class LocalityBenchmark
+                          // =======================
+
+class LocalityBenchmark {
+    // This class provides the run function of one locality benchmark, and
+    // owns the systems it traverses.
+
+    // DATA
+    bsl::vector<System *> d_systems;  // one per thread
+    bsls::AtomicInt       d_sink;     // defeats optimization of traversals
+
+    // NOT IMPLEMENTED
+    LocalityBenchmark(const LocalityBenchmark&);
+    LocalityBenchmark& operator=(const LocalityBenchmark&);
+
+  public:
+    // CREATORS
+    LocalityBenchmark(AllocationStrategy::Enum strategy,
+                      int                      chunkSize,
+                      int                      numThreads)
+    : d_systems()
+    , d_sink(0)
+    {
+        for (int i = 0; i < numThreads; ++i) {
+            d_systems.push_back(new System(strategy, chunkSize));
+        }
+    }
+
+    ~LocalityBenchmark()
+    {
+        for (bsl::size_t i = 0; i < d_systems.size(); ++i) {
+            delete d_systems[i];
+        }
+    }
+
+    // MANIPULATORS
+    void run(int threadIndex)
+        // Traverse the next subsystem of the system of the specified
+        // 'threadIndex'.
+    {
+        d_sink.addRelaxed(d_systems[threadIndex]->traverse());
+    }
+};
+
+// ============================================================================
+//                              BENCHMARK DRIVER
+// ----------------------------------------------------------------------------
+
+void runLocality(benchmarks::Reporter       *reporter,
+                 const bsl::string&          label,
+                 AllocationStrategy::Enum    strategy,
+                 int                         chunkSize,
+                 int                         numThreads,
+                 const benchmarks::Options&  options)
+    // Run, with the specified 'options', and report to the specified
+    // 'reporter' the locality benchmark having the specified 'label',
+    // 'strategy', 'chunkSize', and 'numThreads'.
+{
+    LocalityBenchmark          locality(strategy, chunkSize, numThreads);
+    bslmt::ThroughputBenchmark benchmark;
+
+    benchmark.addThreadGroup(bdlf::BindUtil::bind(&LocalityBenchmark::run,
+                                                  &locality,
+                                                  bdlf::PlaceHolders::_1),
+                             numThreads,
+                             options.d_busyWorkAmount);
+
+    bslmt::ThroughputBenchmarkResult result;
+    benchmarks::BenchmarkUtil::execute(&result, &benchmark, options);
+
+    const char *groups[] = { "threads" };
+    reporter->report(label, result, groups);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    benchmarks::Options options;
+    options.d_threads.clear();
+    options.d_threads.push_back(benchmarks::Options::ThreadCounts(1, 1));
+
+    int rc = options.parse(argc, argv, bsl::cerr);
+    if (rc) {
+        return 0 < rc ? 0 : 1;                                        // RETURN
+    }
+
+    bsls::CycleCounter::calibrate();
+
+    benchmarks::Reporter reporter(bsl::cout, options.d_format);
+
+    static const int k_CHUNK_SIZES[]   = { 1, 64, k_SUBSYSTEM_SIZE };
+    const int        k_NUM_CHUNK_SIZES = sizeof k_CHUNK_SIZES
+                                       / sizeof *k_CHUNK_SIZES;
+
+    for (int s = 0; s < AllocationStrategy::k_NUM_STRATEGIES; ++s) {
+        const AllocationStrategy::Enum strategy =
+                                   static_cast<AllocationStrategy::Enum>(s);
+
+        for (bsl::size_t t = 0; t < options.d_threads.size(); ++t) {
+            for (int c = 0; c < k_NUM_CHUNK_SIZES; ++c) {
+                const int numThreads = options.d_threads[t].first;
+
+                bsl::ostringstream label;
+                label << "Locality/" << AllocationStrategy::toAscii(strategy)
+                      << "/T" << numThreads << "/D" << k_CHUNK_SIZES[c];
+
+                if (options.isSelected(label.str())) {
+                    runLocality(&reporter,
+                                label.str(),
+                                strategy,
+                                k_CHUNK_SIZES[c],
+                                numThreads,
+                                options);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
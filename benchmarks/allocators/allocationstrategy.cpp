@@ -0,0 +1,172 @@
+// allocationstrategy.cpp                                             -*-C++-*-
+#include <allocationstrategy.h>
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_concurrentpoolallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslma_newdeleteallocator.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace benchmarks {
+
+                         // -------------------------
+                         // struct AllocationStrategy
+                         // -------------------------
+
+// CLASS METHODS
+bool AllocationStrategy::canRelease(Enum value)
+{
+    return e_NEW_DELETE != value;
+}
+
+bool AllocationStrategy::isThreadSafe(Enum value)
+{
+    return e_NEW_DELETE           == value
+        || e_CONCURRENT_POOL      == value
+        || e_CONCURRENT_MULTIPOOL == value;
+}
+
+const char *AllocationStrategy::toAscii(Enum value)
+{
+    switch (value) {
+      case e_NEW_DELETE:            return "newdelete";               // RETURN
+      case e_MULTIPOOL:             return "multipool";               // RETURN
+      case e_SEQUENTIAL:            return "sequential";              // RETURN
+      case e_BUFFERED_SEQUENTIAL:   return "bufferedseq";             // RETURN
+      case e_LOCAL_SEQUENTIAL:      return "localseq";                // RETURN
+      case e_MULTIPOOL_SEQUENTIAL:  return "multipoolseq";            // RETURN
+      case e_CONCURRENT_POOL:       return "concurrentpool";          // RETURN
+      case e_CONCURRENT_MULTIPOOL:  return "concurrentmultipool";     // RETURN
+    }
+    return "(* UNKNOWN *)";
+}
+
+                          // -----------------------
+                          // class StrategyAllocator
+                          // -----------------------
+
+// CREATORS
+StrategyAllocator::StrategyAllocator(AllocationStrategy::Enum strategy)
+: d_strategy(strategy)
+, d_allocator_p(0)
+, d_backing_p(0)
+, d_buffer_p(0)
+{
+    bslma::Allocator *heap = &bslma::NewDeleteAllocator::singleton();
+
+    switch (strategy) {
+      case AllocationStrategy::e_NEW_DELETE: {
+        d_allocator_p = heap;
+      } break;
+      case AllocationStrategy::e_MULTIPOOL: {
+        d_allocator_p = new (*heap) bdlma::MultipoolAllocator(heap);
+      } break;
+      case AllocationStrategy::e_SEQUENTIAL: {
+        d_allocator_p = new (*heap) bdlma::SequentialAllocator(heap);
+      } break;
+      case AllocationStrategy::e_BUFFERED_SEQUENTIAL: {
+        d_buffer_p    = static_cast<char *>(heap->allocate(k_BUFFER_SIZE));
+        d_allocator_p = new (*heap) bdlma::BufferedSequentialAllocator(
+                                                                 d_buffer_p,
+                                                                 k_BUFFER_SIZE,
+                                                                 heap);
+      } break;
+      case AllocationStrategy::e_LOCAL_SEQUENTIAL: {
+        typedef bdlma::LocalSequentialAllocator<k_BUFFER_SIZE> Allocator;
+        d_allocator_p = new (*heap) Allocator(heap);
+      } break;
+      case AllocationStrategy::e_MULTIPOOL_SEQUENTIAL: {
+        d_backing_p   = new (*heap) bdlma::SequentialAllocator(heap);
+        d_allocator_p = new (*heap) bdlma::MultipoolAllocator(d_backing_p);
+      } break;
+      case AllocationStrategy::e_CONCURRENT_POOL: {
+        d_allocator_p = new (*heap) bdlma::ConcurrentPoolAllocator(heap);
+      } break;
+      case AllocationStrategy::e_CONCURRENT_MULTIPOOL: {
+        d_allocator_p = new (*heap) bdlma::ConcurrentMultipoolAllocator(heap);
+      } break;
+    }
+
+    BSLS_ASSERT(d_allocator_p);
+}
+
+StrategyAllocator::~StrategyAllocator()
+{
+    bslma::Allocator *heap = &bslma::NewDeleteAllocator::singleton();
+
+    if (heap != d_allocator_p) {
+        heap->deleteObject(d_allocator_p);
+    }
+    if (d_backing_p) {
+        heap->deleteObject(d_backing_p);
+    }
+    heap->deallocate(d_buffer_p);
+}
+
+// MANIPULATORS
+void StrategyAllocator::release()
+{
+    BSLS_ASSERT(AllocationStrategy::canRelease(d_strategy));
+
+    switch (d_strategy) {
+      case AllocationStrategy::e_MULTIPOOL: {
+        static_cast<bdlma::MultipoolAllocator *>(d_allocator_p)->release();
+      } break;
+      case AllocationStrategy::e_SEQUENTIAL: {
+        static_cast<bdlma::SequentialAllocator *>(d_allocator_p)->release();
+      } break;
+      case AllocationStrategy::e_BUFFERED_SEQUENTIAL:
+      case AllocationStrategy::e_LOCAL_SEQUENTIAL: {
+        static_cast<bdlma::BufferedSequentialAllocator *>(d_allocator_p)->
+                                                                     release();
+      } break;
+      case AllocationStrategy::e_MULTIPOOL_SEQUENTIAL: {
+        // The multipool allocates its pools from the sequential allocator, so
+        // it is recreated once the sequential allocator is released.
+
+        bdlma::MultipoolAllocator *multipool =
+                       static_cast<bdlma::MultipoolAllocator *>(d_allocator_p);
+        multipool->~MultipoolAllocator();
+        static_cast<bdlma::SequentialAllocator *>(d_backing_p)->release();
+        new (static_cast<void *>(multipool)) bdlma::MultipoolAllocator(
+                                                                  d_backing_p);
+      } break;
+      case AllocationStrategy::e_CONCURRENT_POOL: {
+        static_cast<bdlma::ConcurrentPoolAllocator *>(d_allocator_p)->
+                                                                     release();
+      } break;
+      case AllocationStrategy::e_CONCURRENT_MULTIPOOL: {
+        static_cast<bdlma::ConcurrentMultipoolAllocator *>(d_allocator_p)->
+                                                                     release();
+      } break;
+      default: {
+      } break;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
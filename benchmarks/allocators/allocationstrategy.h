@@ -0,0 +1,174 @@
+// allocationstrategy.h                                               -*-C++-*-
+#ifndef INCLUDED_ALLOCATIONSTRATEGY
+#define INCLUDED_ALLOCATIONSTRATEGY
+
+//@PURPOSE: Provide the allocation strategies compared by the benchmarks.
+//
+//@CLASSES:
+//  benchmarks::AllocationStrategy: enumeration of the allocation strategies
+//  benchmarks::StrategyAllocator: allocator implementing one strategy
+//
+//@SEE_ALSO: bslma_newdeleteallocator, bdlma_multipoolallocator,
+//           bdlma_sequentialallocator, bdlma_bufferedsequentialallocator,
+//           bdlma_localsequentialallocator, bdlma_concurrentpoolallocator,
+//           bdlma_concurrentmultipoolallocator
+//
+//@DESCRIPTION: This component provides an enumeration,
+// 'benchmarks::AllocationStrategy', of the allocation strategies compared by
+// the allocator benchmarks (after the strategies of N4468 and P0089), and a
+// mechanism, 'benchmarks::StrategyAllocator', owning the allocator (and any
+// allocator or buffer backing it) that implements a strategy:
+//..
+//  Name               Strategy
+//  ------------------ -------------------------------------------------------
+//  newdelete          'bslma::NewDeleteAllocator' (the global heap)
+//  multipool          'bdlma::MultipoolAllocator'
+//  sequential         'bdlma::SequentialAllocator' (monotonic)
+//  bufferedseq        'bdlma::BufferedSequentialAllocator' having a 64 KiB
+//                     heap buffer
+//  localseq           'bdlma::LocalSequentialAllocator<65536>'
+//  multipoolseq       'bdlma::MultipoolAllocator' backed by a
+//                     'bdlma::SequentialAllocator'
+//  concurrentpool     'bdlma::ConcurrentPoolAllocator'
+//  concurrentmultipool
+//                     'bdlma::ConcurrentMultipoolAllocator'
+//..
+// The allocators of the strategies for which 'isThreadSafe' returns 'true'
+// may be shared by several threads; the others must be used by one thread at
+// a time.  The allocators of the strategies for which 'canRelease' returns
+// 'true' can release all their memory at once, so that objects allocated from
+// them need not be destroyed individually (N4468 calls this "winking out").
+
+#include <bslma_allocator.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace benchmarks {
+
+                         // =========================
+                         // struct AllocationStrategy
+                         // =========================
+
+struct AllocationStrategy {
+    // This 'struct' provides a namespace for enumerating the allocation
+    // strategies compared by the benchmarks.
+
+  public:
+    // TYPES
+    enum Enum {
+        e_NEW_DELETE,
+        e_MULTIPOOL,
+        e_SEQUENTIAL,
+        e_BUFFERED_SEQUENTIAL,
+        e_LOCAL_SEQUENTIAL,
+        e_MULTIPOOL_SEQUENTIAL,
+        e_CONCURRENT_POOL,
+        e_CONCURRENT_MULTIPOOL
+    };
+
+    enum {
+        k_NUM_STRATEGIES = e_CONCURRENT_MULTIPOOL + 1
+    };
+
+    // CLASS METHODS
+    static bool canRelease(Enum value);
+        // Return 'true' if the allocator of the specified 'value' strategy can
+        // release all of its memory at once, and 'false' otherwise.
+
+    static bool isThreadSafe(Enum value);
+        // Return 'true' if the allocator of the specified 'value' strategy may
+        // be used by several threads concurrently, and 'false' otherwise.
+
+    static const char *toAscii(Enum value);
+        // Return the name of the specified 'value' strategy.
+};
+
+                          // =======================
+                          // class StrategyAllocator
+                          // =======================
+
+class StrategyAllocator {
+    // This mechanism owns an allocator implementing one allocation strategy,
+    // together with any allocator or buffer backing it.  All memory is
+    // supplied by 'bslma::NewDeleteAllocator'.
+
+    // DATA
+    AllocationStrategy::Enum  d_strategy;     // strategy implemented
+    bslma::Allocator         *d_allocator_p;  // allocator of the strategy
+    bslma::Allocator         *d_backing_p;    // backing allocator, if any
+    char                     *d_buffer_p;     // buffer, if any
+
+    // NOT IMPLEMENTED
+    StrategyAllocator(const StrategyAllocator&);
+    StrategyAllocator& operator=(const StrategyAllocator&);
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_BUFFER_SIZE = 64 * 1024  // bytes of buffer of the buffered and
+                                   // local strategies
+    };
+
+    // CREATORS
+    explicit StrategyAllocator(AllocationStrategy::Enum strategy);
+        // Create an allocator implementing the specified 'strategy'.
+
+    ~StrategyAllocator();
+        // Destroy this object, and the allocator it owns.
+
+    // MANIPULATORS
+    bslma::Allocator *allocator();
+        // Return the allocator implementing the strategy of this object.
+
+    void release();
+        // Release all the memory allocated from 'allocator()'.  The behavior
+        // is undefined unless 'AllocationStrategy::canRelease(strategy())'.
+
+    // ACCESSORS
+    AllocationStrategy::Enum strategy() const;
+        // Return the strategy implemented by this object.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class StrategyAllocator
+                          // -----------------------
+
+// MANIPULATORS
+inline
+bslma::Allocator *StrategyAllocator::allocator()
+{
+    return d_allocator_p;
+}
+
+// ACCESSORS
+inline
+AllocationStrategy::Enum StrategyAllocator::strategy() const
+{
+    return d_strategy;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,273 @@
+// fmt_fromchars.m.cpp                                                -*-C++-*-
+
+//@PURPOSE: Benchmark the parsing of 'double' values from text.
+//
+//@SEE_ALSO: bslalg_numericparserutil, bslstl_charconv
+//
+//@DESCRIPTION: This program measures the throughput of parsing 'double'
+// values from text, each call of the run function parsing a batch of 64
+// values, that are not null-terminated, in one of these modes:
+//
+//: 'strtod':
+//:   'strtod' on a null-terminated copy of the text, as the codecs and
+//:   'bdlb::NumericParseUtil' parsed 'double' values
+//:
+//: 'fromchars':
+//:   'bslalg::NumericParserUtil::fromChars' on the text in place (as
+//:   'bsl::from_chars'), as the codecs now parse 'double' values
+//
+// The values are either "short" (prices, having at most 6 significant
+// digits), or "random" (having random bit patterns, and written with 17
+// significant digits).  Each benchmark is labelled
+// "Parse/<mode>/<values>/T<threads>", for example "Parse/fromchars/short/T1".
+// Only the first count of each '--threads' entry is used.
+
+#include <benchmarkutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslalg_numericparserutil.h>
+
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_cyclecounter.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef bslalg::NumericParserUtil Util;
+
+enum {
+    k_BATCH_SIZE  = 64,  // values parsed per call of the run function
+    k_BUFFER_SIZE = 32   // enough for any 'double' written with "%.17g"
+};
+
+                               // ===========
+                               // struct Mode
+                               // ===========
+
+struct Mode {
+    // This 'struct' provides a namespace enumerating the ways in which the
+    // values are parsed.
+
+    // TYPES
+    enum Enum {
+        e_STRTOD,     // 'strtod' on a null-terminated copy
+        e_FROMCHARS   // 'fromChars' in place
+    };
+
+    enum { k_NUM_MODES = e_FROMCHARS + 1 };
+
+    // CLASS METHODS
+    static const char *toAscii(Enum mode)
+        // Return the name of the specified 'mode'.
+    {
+        switch (mode) {
+          case e_STRTOD:    return "strtod";
+          case e_FROMCHARS: return "fromchars";
+        }
+        return "(* UNKNOWN *)";
+    }
+};
+
+bsls::Types::Uint64 nextRandom(bsls::Types::Uint64 *state)
+    // Return the next pseudo-random value of the sequence having the
+    // specified 'state', and update 'state'.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state;
+}
+
+void generateValues(bsl::vector<bsl::string> *result, bool isShort)
+    // Load into the specified 'result' the text of 'k_BATCH_SIZE'
+    // pseudo-random values, having at most 6 significant digits if the
+    // specified 'isShort' is 'true', and random finite bit patterns written
+    // with 17 significant digits otherwise.
+{
+    bsls::Types::Uint64 state = 12345;
+
+    result->clear();
+    while (result->size() < k_BATCH_SIZE) {
+        const bsls::Types::Uint64 bits = nextRandom(&state);
+        double                    value;
+
+        if (isShort) {
+            value = static_cast<double>((bits >> 40) % 1000000) / 100;
+        }
+        else {
+            bsl::memcpy(&value, &bits, sizeof value);
+            if (value != value || value - value != 0) {
+                continue;  // skip infinities and NaNs
+            }
+        }
+
+        char buffer[k_BUFFER_SIZE];
+        bsl::sprintf(buffer, isShort ? "%.6g" : "%.17g", value);
+        result->push_back(buffer);
+    }
+}
+
+                          // ====================
+                          // class ParseBenchmark
+                          // ====================
+
+class ParseBenchmark {
+    // This class provides the run function of one benchmark, and owns the
+    // text it parses.
+
+    // DATA
+    bsl::vector<bsl::string>  d_texts;     // text parsed by each call
+    Mode::Enum                d_mode;
+    bsls::AtomicInt           d_checksum;  // keeps the output observable
+
+    // NOT IMPLEMENTED
+    ParseBenchmark(const ParseBenchmark&);
+    ParseBenchmark& operator=(const ParseBenchmark&);
+
+  public:
+    // CREATORS
+    ParseBenchmark(Mode::Enum mode, bool isShort)
+    : d_texts()
+    , d_mode(mode)
+    , d_checksum(0)
+    {
+        generateValues(&d_texts, isShort);
+    }
+
+    // MANIPULATORS
+    void run(int)
+        // Parse every value.
+    {
+        char   buffer[k_BUFFER_SIZE];
+        double sum = 0;
+
+        for (int i = 0; i < k_BATCH_SIZE; ++i) {
+            const char *first = d_texts[i].data();
+            const char *last  = first + d_texts[i].length();
+            double      value = 0;
+
+            switch (d_mode) {
+              case Mode::e_STRTOD: {
+                bsl::memcpy(buffer, first, last - first);
+                buffer[last - first] = 0;
+                value = bsl::strtod(buffer, 0);
+              } break;
+              case Mode::e_FROMCHARS: {
+                const char *end;
+                Util::fromChars(&value, &end, first, last);
+              } break;
+            }
+            sum += value;
+        }
+        d_checksum.addRelaxed(sum != 0);
+    }
+};
+
+// ============================================================================
+//                              BENCHMARK DRIVER
+// ----------------------------------------------------------------------------
+
+void runParse(benchmarks::Reporter       *reporter,
+              const bsl::string&          label,
+              Mode::Enum                  mode,
+              bool                        isShort,
+              int                         numThreads,
+              const benchmarks::Options&  options)
+    // Run, with the specified 'options', and report to the specified
+    // 'reporter' the benchmark having the specified 'label', 'mode',
+    // 'isShort', and 'numThreads'.
+{
+    ParseBenchmark             parse(mode, isShort);
+    bslmt::ThroughputBenchmark benchmark;
+
+    benchmark.addThreadGroup(bdlf::BindUtil::bind(&ParseBenchmark::run,
+                                                  &parse,
+                                                  bdlf::PlaceHolders::_1),
+                             numThreads,
+                             options.d_busyWorkAmount);
+
+    bslmt::ThroughputBenchmarkResult result;
+    benchmarks::BenchmarkUtil::execute(&result, &benchmark, options);
+
+    const char *groups[] = { "threads" };
+    reporter->report(label, result, groups);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    benchmarks::Options options;
+    options.d_threads.clear();
+    options.d_threads.push_back(benchmarks::Options::ThreadCounts(1, 1));
+
+    int rc = options.parse(argc, argv, bsl::cerr);
+    if (rc) {
+        return 0 < rc ? 0 : 1;                                        // RETURN
+    }
+
+    bsls::CycleCounter::calibrate();
+
+    benchmarks::Reporter reporter(bsl::cout, options.d_format);
+
+    for (int v = 0; v < 2; ++v) {
+        const bool isShort = 0 == v;
+
+        for (int m = 0; m < Mode::k_NUM_MODES; ++m) {
+            const Mode::Enum mode = static_cast<Mode::Enum>(m);
+
+            for (bsl::size_t t = 0; t < options.d_threads.size(); ++t) {
+                const int numThreads = options.d_threads[t].first;
+
+                bsl::ostringstream label;
+                label << "Parse/" << Mode::toAscii(mode)
+                      << (isShort ? "/short" : "/random")
+                      << "/T" << numThreads;
+
+                if (options.isSelected(label.str())) {
+                    runParse(&reporter,
+                             label.str(),
+                             mode,
+                             isShort,
+                             numThreads,
+                             options);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,305 @@
+// fmt_tochars.m.cpp                                                  -*-C++-*-
+
+//@PURPOSE: Benchmark the formatting of 'double' values to text.
+//
+//@SEE_ALSO: bslalg_numericformatterutil, bslstl_charconv
+//
+//@DESCRIPTION: This program measures the throughput of writing 'double'
+// values as text, each call of the run function writing a batch of 64 values
+// to a buffer in one of these modes:
+//
+//: 'sprintf17':
+//:   'sprintf' with "%.17g", the shortest 'printf' conversion that always
+//:   reads back as the same value
+//:
+//: 'sprintf15':
+//:   'sprintf' with "%.15g", as the codecs wrote 'double' values by default
+//:
+//: 'ostream':
+//:   'bsl::ostream::operator<<' to an output string stream having a precision
+//:   of 17
+//:
+//: 'tochars':
+//:   'bslalg::NumericFormatterUtil::toChars', in the shortest representation
+//:   that reads back as the same value (as 'bsl::to_chars')
+//:
+//: 'tochars15':
+//:   'bslalg::NumericFormatterUtil::toChars' in the general format with a
+//:   precision of 15, as the codecs now write 'double' values by default
+//
+// The values are either "short" (prices, having at most 6 significant
+// digits), or "random" (having random bit patterns, and therefore needing
+// about 17 significant digits).  Each benchmark is labelled
+// "Format/<mode>/<values>/T<threads>", for example "Format/tochars/short/T1".
+// Only the first count of each '--threads' entry is used.
+
+#include <benchmarkutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_cyclecounter.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef bslalg::NumericFormatterUtil Util;
+
+enum {
+    k_BATCH_SIZE  = 64,  // values written per call of the run function
+    k_BUFFER_SIZE = 32   // enough for any 'double' written by any mode
+};
+
+                               // ===========
+                               // struct Mode
+                               // ===========
+
+struct Mode {
+    // This 'struct' provides a namespace enumerating the ways in which the
+    // values are written.
+
+    // TYPES
+    enum Enum {
+        e_SPRINTF17,  // 'sprintf' with "%.17g"
+        e_SPRINTF15,  // 'sprintf' with "%.15g"
+        e_OSTREAM,    // 'operator<<' with a precision of 17
+        e_TOCHARS,    // 'toChars', shortest
+        e_TOCHARS15   // 'toChars', general with a precision of 15
+    };
+
+    enum { k_NUM_MODES = e_TOCHARS15 + 1 };
+
+    // CLASS METHODS
+    static const char *toAscii(Enum mode)
+        // Return the name of the specified 'mode'.
+    {
+        switch (mode) {
+          case e_SPRINTF17: return "sprintf17";
+          case e_SPRINTF15: return "sprintf15";
+          case e_OSTREAM:   return "ostream";
+          case e_TOCHARS:   return "tochars";
+          case e_TOCHARS15: return "tochars15";
+        }
+        return "(* UNKNOWN *)";
+    }
+};
+
+bsls::Types::Uint64 nextRandom(bsls::Types::Uint64 *state)
+    // Return the next pseudo-random value of the sequence having the
+    // specified 'state', and update 'state'.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state;
+}
+
+void generateValues(bsl::vector<double> *result, bool isShort)
+    // Load into the specified 'result' 'k_BATCH_SIZE' pseudo-random values,
+    // having at most 6 significant digits if the specified 'isShort' is
+    // 'true', and random finite bit patterns otherwise.
+{
+    bsls::Types::Uint64 state = 12345;
+
+    result->clear();
+    while (result->size() < k_BATCH_SIZE) {
+        const bsls::Types::Uint64 bits = nextRandom(&state);
+        double                    value;
+
+        if (isShort) {
+            value = static_cast<double>((bits >> 40) % 1000000) / 100;
+        }
+        else {
+            bsl::memcpy(&value, &bits, sizeof value);
+            if (value != value || value - value != 0) {
+                continue;  // skip infinities and NaNs
+            }
+        }
+        result->push_back(value);
+    }
+}
+
+                          // =====================
+                          // class FormatBenchmark
+                          // =====================
+
+class FormatBenchmark {
+    // This class provides the run function of one benchmark, and owns the
+    // values it writes.
+
+    // DATA
+    bsl::vector<double>  d_values;    // values written by each call
+    Mode::Enum           d_mode;
+    bsls::AtomicInt      d_checksum;  // keeps the output observable
+
+    // NOT IMPLEMENTED
+    FormatBenchmark(const FormatBenchmark&);
+    FormatBenchmark& operator=(const FormatBenchmark&);
+
+  public:
+    // CREATORS
+    FormatBenchmark(Mode::Enum mode, bool isShort)
+    : d_values()
+    , d_mode(mode)
+    , d_checksum(0)
+    {
+        generateValues(&d_values, isShort);
+    }
+
+    // MANIPULATORS
+    void run(int)
+        // Write every value to a buffer.
+    {
+        char               buffer[k_BUFFER_SIZE];
+        int                checksum = 0;
+        bsl::ostringstream stream;
+
+        if (Mode::e_OSTREAM == d_mode) {
+            stream.precision(17);
+        }
+
+        for (int i = 0; i < k_BATCH_SIZE; ++i) {
+            const double value = d_values[i];
+            int          length = 0;
+
+            switch (d_mode) {
+              case Mode::e_SPRINTF17: {
+                length = bsl::sprintf(buffer, "%.17g", value);
+              } break;
+              case Mode::e_SPRINTF15: {
+                length = bsl::sprintf(buffer, "%.15g", value);
+              } break;
+              case Mode::e_OSTREAM: {
+                stream.str(bsl::string());
+                stream << value;
+                length = static_cast<int>(stream.str().length());
+              } break;
+              case Mode::e_TOCHARS: {
+                length = static_cast<int>(
+                     Util::toChars(buffer, buffer + k_BUFFER_SIZE, value)
+                   - buffer);
+              } break;
+              case Mode::e_TOCHARS15: {
+                length = static_cast<int>(
+                                      Util::toChars(buffer,
+                                                    buffer + k_BUFFER_SIZE,
+                                                    value,
+                                                    Util::e_GENERAL,
+                                                    15)
+                                    - buffer);
+              } break;
+            }
+            checksum += length + buffer[0];
+        }
+        d_checksum.addRelaxed(checksum);
+    }
+};
+
+// ============================================================================
+//                              BENCHMARK DRIVER
+// ----------------------------------------------------------------------------
+
+void runFormat(benchmarks::Reporter       *reporter,
+               const bsl::string&          label,
+               Mode::Enum                  mode,
+               bool                        isShort,
+               int                         numThreads,
+               const benchmarks::Options&  options)
+    // Run, with the specified 'options', and report to the specified
+    // 'reporter' the benchmark having the specified 'label', 'mode',
+    // 'isShort', and 'numThreads'.
+{
+    FormatBenchmark            format(mode, isShort);
+    bslmt::ThroughputBenchmark benchmark;
+
+    benchmark.addThreadGroup(bdlf::BindUtil::bind(&FormatBenchmark::run,
+                                                  &format,
+                                                  bdlf::PlaceHolders::_1),
+                             numThreads,
+                             options.d_busyWorkAmount);
+
+    bslmt::ThroughputBenchmarkResult result;
+    benchmarks::BenchmarkUtil::execute(&result, &benchmark, options);
+
+    const char *groups[] = { "threads" };
+    reporter->report(label, result, groups);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    benchmarks::Options options;
+    options.d_threads.clear();
+    options.d_threads.push_back(benchmarks::Options::ThreadCounts(1, 1));
+
+    int rc = options.parse(argc, argv, bsl::cerr);
+    if (rc) {
+        return 0 < rc ? 0 : 1;                                        // RETURN
+    }
+
+    bsls::CycleCounter::calibrate();
+
+    benchmarks::Reporter reporter(bsl::cout, options.d_format);
+
+    for (int v = 0; v < 2; ++v) {
+        const bool isShort = 0 == v;
+
+        for (int m = 0; m < Mode::k_NUM_MODES; ++m) {
+            const Mode::Enum mode = static_cast<Mode::Enum>(m);
+
+            for (bsl::size_t t = 0; t < options.d_threads.size(); ++t) {
+                const int numThreads = options.d_threads[t].first;
+
+                bsl::ostringstream label;
+                label << "Format/" << Mode::toAscii(mode)
+                      << (isShort ? "/short" : "/random")
+                      << "/T" << numThreads;
+
+                if (options.isSelected(label.str())) {
+                    runFormat(&reporter,
+                              label.str(),
+                              mode,
+                              isShort,
+                              numThreads,
+                              options);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
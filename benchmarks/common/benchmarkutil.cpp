@@ -0,0 +1,420 @@
+// benchmarkutil.cpp                                                  -*-C++-*-
+#include <benchmarkutil.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace {
+
+bool parseInt(int *result, const char *text, int minValue)
+    // Load into the specified 'result' the decimal integer in the specified
+    // 'text'.  Return 'true' if 'text' is a decimal integer not less than the
+    // specified 'minValue', and 'false' (with no effect on 'result')
+    // otherwise.
+{
+    char *end   = 0;
+    long  value = bsl::strtol(text, &end, 10);
+    if (end == text || *end || value < minValue || value > 0x7FFFFFFF) {
+        return false;                                                 // RETURN
+    }
+    *result = static_cast<int>(value);
+    return true;
+}
+
+bool parseThreads(bsl::vector<benchmarks::Options::ThreadCounts> *result,
+                  const char                                     *text)
+    // Load into the specified 'result' the comma-separated list of thread
+    // counts, each of the form "<M>x<N>" or "<M>" (meaning "<M>x1"), in the
+    // specified 'text'.  Return 'true' on success, and 'false' (with no
+    // effect on 'result') otherwise.
+{
+    bsl::vector<benchmarks::Options::ThreadCounts> counts;
+
+    const char *p = text;
+    while (*p) {
+        char *end   = 0;
+        long  first = bsl::strtol(p, &end, 10);
+        if (end == p || first < 1 || first > 1024) {
+            return false;                                             // RETURN
+        }
+        p = end;
+
+        long second = 1;
+        if ('x' == *p) {
+            ++p;
+            second = bsl::strtol(p, &end, 10);
+            if (end == p || second < 1 || second > 1024) {
+                return false;                                         // RETURN
+            }
+            p = end;
+        }
+
+        if (',' == *p) {
+            ++p;
+        }
+        else if (*p) {
+            return false;                                             // RETURN
+        }
+
+        counts.push_back(benchmarks::Options::ThreadCounts(
+                                                  static_cast<int>(first),
+                                                  static_cast<int>(second)));
+    }
+    if (counts.empty()) {
+        return false;                                                 // RETURN
+    }
+    result->swap(counts);
+    return true;
+}
+
+void writeRow(bsl::ostream& stream,
+              const char   *label,
+              const char   *threadGroupName,
+              const char   *throughput,
+              const char   *interval,
+              const char   *p50,
+              const char   *p99)
+    // Write to the specified 'stream' one row of the text table having the
+    // specified 'label', 'threadGroupName', 'throughput', 'interval', 'p50',
+    // and 'p99' columns.  A label too long for its column is written on a
+    // line of its own.
+{
+    enum { k_LABEL_WIDTH = 38 };
+
+    if (bsl::strlen(label) > k_LABEL_WIDTH) {
+        stream << label << '\n';
+        label = "";
+    }
+
+    char buffer[256];
+    bsl::snprintf(buffer,
+                  sizeof buffer,
+                  "%-*s %-10s %14s %8s %10s %10s\n",
+                  static_cast<int>(k_LABEL_WIDTH),
+                  label,
+                  threadGroupName,
+                  throughput,
+                  interval,
+                  p50,
+                  p99);
+    stream << buffer;
+}
+
+}  // close unnamed namespace
+
+namespace benchmarks {
+
+                               // -------------
+                               // class Options
+                               // -------------
+
+// CLASS METHODS
+void Options::printUsage(bsl::ostream& stream, const char *programName)
+{
+    stream << "usage: " << programName << " [options]\n"
+       "  --samples N          number of samples per benchmark (10)\n"
+       "  --millis N           duration of each sample in milliseconds (100)\n"
+       "  --warmup N           number of discarded warm-up samples (2)\n"
+       "  --latency N          time every Nth call, or 0 for none (64)\n"
+       "  --latency-samples N  maximum timed calls per thread per sample"
+                                                                   " (4096)\n"
+       "  --work N             busy work between calls (0)\n"
+       "  --capacity N         capacity of queues and pools (1024)\n"
+       "  --threads MxN,...    thread counts of the (one or two) thread\n"
+       "                       groups; 'M' means 'Mx1' (1x1,2x2,4x1,4x4)\n"
+       "  --pin                pin the threads to consecutive processors\n"
+       "  --keep-outliers      do not remove outlying samples\n"
+       "  --format F           'text', 'csv', or 'json' (text)\n"
+       "  --filter S           run only benchmarks whose label contains S\n"
+       "  --quick              2 samples of 10 milliseconds, no warm-up\n"
+       "  --help               print this message\n";
+}
+
+// CREATORS
+Options::Options()
+: d_millisecondsPerSample(100)
+, d_numSamples(10)
+, d_numWarmUpSamples(2)
+, d_latencySamplingInterval(64)
+, d_maxLatencySamplesPerThread(4096)
+, d_busyWorkAmount(0)
+, d_capacity(1024)
+, d_threads()
+, d_pinThreads(false)
+, d_removeOutliers(true)
+, d_format(e_TEXT)
+, d_filter()
+{
+    d_threads.push_back(ThreadCounts(1, 1));
+    d_threads.push_back(ThreadCounts(2, 2));
+    d_threads.push_back(ThreadCounts(4, 1));
+    d_threads.push_back(ThreadCounts(4, 4));
+}
+
+// MANIPULATORS
+int Options::parse(int argc, char *argv[], bsl::ostream& errorStream)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char *arg   = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : 0;
+        bool        valid = true;
+        bool        taken = true;  // 'value' was consumed
+
+        if (0 == bsl::strcmp(arg, "--help")) {
+            printUsage(errorStream, argv[0]);
+            return 1;                                                 // RETURN
+        }
+        else if (0 == bsl::strcmp(arg, "--pin")) {
+            d_pinThreads = true;
+            taken        = false;
+        }
+        else if (0 == bsl::strcmp(arg, "--keep-outliers")) {
+            d_removeOutliers = false;
+            taken            = false;
+        }
+        else if (0 == bsl::strcmp(arg, "--quick")) {
+            d_numSamples            = 2;
+            d_millisecondsPerSample = 10;
+            d_numWarmUpSamples      = 0;
+            taken                   = false;
+        }
+        else if (!value) {
+            valid = false;
+        }
+        else if (0 == bsl::strcmp(arg, "--samples")) {
+            valid = parseInt(&d_numSamples, value, 1);
+        }
+        else if (0 == bsl::strcmp(arg, "--millis")) {
+            valid = parseInt(&d_millisecondsPerSample, value, 1);
+        }
+        else if (0 == bsl::strcmp(arg, "--warmup")) {
+            valid = parseInt(&d_numWarmUpSamples, value, 0);
+        }
+        else if (0 == bsl::strcmp(arg, "--latency")) {
+            valid = parseInt(&d_latencySamplingInterval, value, 0);
+        }
+        else if (0 == bsl::strcmp(arg, "--latency-samples")) {
+            valid = parseInt(&d_maxLatencySamplesPerThread, value, 1);
+        }
+        else if (0 == bsl::strcmp(arg, "--work")) {
+            int amount = 0;
+            valid = parseInt(&amount, value, 0);
+            d_busyWorkAmount = amount;
+        }
+        else if (0 == bsl::strcmp(arg, "--capacity")) {
+            valid = parseInt(&d_capacity, value, 1);
+        }
+        else if (0 == bsl::strcmp(arg, "--threads")) {
+            valid = parseThreads(&d_threads, value);
+        }
+        else if (0 == bsl::strcmp(arg, "--format")) {
+            if (0 == bsl::strcmp(value, "text")) {
+                d_format = e_TEXT;
+            }
+            else if (0 == bsl::strcmp(value, "csv")) {
+                d_format = e_CSV;
+            }
+            else if (0 == bsl::strcmp(value, "json")) {
+                d_format = e_JSON;
+            }
+            else {
+                valid = false;
+            }
+        }
+        else if (0 == bsl::strcmp(arg, "--filter")) {
+            d_filter = value;
+        }
+        else {
+            errorStream << argv[0] << ": unknown option '" << arg << "'\n";
+            printUsage(errorStream, argv[0]);
+            return -1;                                                // RETURN
+        }
+
+        if (!valid) {
+            errorStream << argv[0] << ": invalid or missing value for '"
+                        << arg << "'\n";
+            return -1;                                                // RETURN
+        }
+        if (taken) {
+            ++i;
+        }
+    }
+    return 0;
+}
+
+// ACCESSORS
+bool Options::isSelected(const bsl::string& label) const
+{
+    return d_filter.empty() || bsl::string::npos != label.find(d_filter);
+}
+
+                               // --------------
+                               // class Reporter
+                               // --------------
+
+// CREATORS
+Reporter::Reporter(bsl::ostream& stream, Options::Format format)
+: d_stream(stream)
+, d_format(format)
+, d_numReported(0)
+{
+}
+
+Reporter::~Reporter()
+{
+    if (Options::e_JSON == d_format) {
+        d_stream << (d_numReported ? "\n]\n" : "[]\n");
+    }
+    d_stream.flush();
+}
+
+// MANIPULATORS
+void Reporter::report(const bsl::string&                      label,
+                      const bslmt::ThroughputBenchmarkResult& result,
+                      const char *const                      *threadGroupNames)
+{
+    BSLS_ASSERT(threadGroupNames);
+    BSLS_ASSERT(0 < result.numSamples());
+
+    switch (d_format) {
+      case Options::e_CSV: {
+        if (0 == d_numReported) {
+            bslmt::ThroughputBenchmarkResult::printCsvHeader(d_stream);
+        }
+        result.printCsv(d_stream, label.c_str());
+      } break;
+      case Options::e_JSON: {
+        d_stream << (d_numReported ? ",\n" : "[\n");
+        result.printJson(d_stream, label.c_str());
+      } break;
+      default: {
+        if (0 == d_numReported) {
+            writeRow(d_stream,
+                     "benchmark",
+                     "group",
+                     "median ops/s",
+                     "ci95 +-",
+                     "p50 ns",
+                     "p99 ns");
+        }
+        for (int i = 0; i < result.numThreadGroups(); ++i) {
+            double median, mean, lower, upper;
+            result.getMedian(&median, i);
+            result.getMean(&mean, i);
+            result.getConfidenceInterval(&lower, &upper, i);
+
+            char throughput[32];
+            char interval[32];
+            char p50[32]  = "-";
+            char p99[32]  = "-";
+            bsl::snprintf(throughput, sizeof throughput, "%.0f", median);
+            bsl::snprintf(interval,
+                          sizeof interval,
+                          "%.1f%%",
+                          0 < mean ? 50.0 * (upper - lower) / mean : 0.0);
+
+            if (0 < result.numLatencies(i)) {
+                double latency;
+                result.getLatencyPercentile(&latency, 0.5, i);
+                bsl::snprintf(p50, sizeof p50, "%.0f", latency);
+                result.getLatencyPercentile(&latency, 0.99, i);
+                bsl::snprintf(p99, sizeof p99, "%.0f", latency);
+            }
+
+            writeRow(d_stream,
+                     0 == i ? label.c_str() : "",
+                     threadGroupNames[i],
+                     throughput,
+                     interval,
+                     p50,
+                     p99);
+        }
+      }
+    }
+    d_stream.flush();
+    ++d_numReported;
+}
+
+                           // --------------------
+                           // struct BenchmarkUtil
+                           // --------------------
+
+// CLASS METHODS
+void BenchmarkUtil::execute(bslmt::ThroughputBenchmarkResult *result,
+                            bslmt::ThroughputBenchmark       *benchmark,
+                            const Options&                    options)
+{
+    execute(result,
+            benchmark,
+            options,
+            InitializeFunction(),
+            ShutdownFunction(),
+            CleanupFunction());
+}
+
+void BenchmarkUtil::execute(bslmt::ThroughputBenchmarkResult *result,
+                            bslmt::ThroughputBenchmark       *benchmark,
+                            const Options&                    options,
+                            const InitializeFunction&         initialize,
+                            const ShutdownFunction&           shutdown,
+                            const CleanupFunction&            cleanup)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(benchmark);
+
+    benchmark->setNumWarmUpSamples(options.d_numWarmUpSamples);
+    if (0 < options.d_latencySamplingInterval) {
+        benchmark->setLatencySampling(options.d_latencySamplingInterval,
+                                      options.d_maxLatencySamplesPerThread);
+    }
+
+    if (options.d_pinThreads) {
+        const int numCpus =
+               static_cast<int>(bslmt::ThreadUtil::hardwareConcurrency());
+        int nextCpu = 0;
+        for (int i = 0; i < benchmark->numThreadGroups(); ++i) {
+            bsl::vector<int> cpus;
+            for (int j = 0; j < benchmark->numThreadsInGroup(i); ++j) {
+                cpus.push_back(nextCpu++ % (0 < numCpus ? numCpus : 1));
+            }
+            benchmark->setThreadGroupAffinity(i, cpus);
+        }
+    }
+
+    benchmark->execute(result,
+                       options.d_millisecondsPerSample,
+                       options.d_numSamples,
+                       initialize,
+                       shutdown,
+                       cleanup);
+
+    if (options.d_removeOutliers) {
+        result->removeOutliers();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,231 @@
+// benchmarkutil.h                                                    -*-C++-*-
+#ifndef INCLUDED_BENCHMARKUTIL
+#define INCLUDED_BENCHMARKUTIL
+
+//@PURPOSE: Provide command-line options and reporting shared by benchmarks.
+//
+//@CLASSES:
+//  benchmarks::Options: configuration of a benchmark program
+//  benchmarks::Reporter: writer of results as text, CSV, or JSON
+//  benchmarks::BenchmarkUtil: namespace for running a configured benchmark
+//
+//@SEE_ALSO: bslmt_throughputbenchmark, bslmt_throughputbenchmarkresult
+//
+//@DESCRIPTION: This component provides the pieces common to the benchmark
+// programs under 'benchmarks': an attribute class, 'benchmarks::Options',
+// holding the configuration parsed from the command line (sample duration and
+// count, warm-up, latency sampling, thread counts, output format, and a filter
+// selecting benchmarks by label); a mechanism, 'benchmarks::Reporter', writing
+// each 'bslmt::ThroughputBenchmarkResult' in the selected format; and a
+// utility, 'benchmarks::BenchmarkUtil', applying the options to a
+// 'bslmt::ThroughputBenchmark' and executing it.
+//
+// Each benchmark is identified by a label of slash-separated parts, for
+// example "BoundedQueue/P2xC2/64B", so that '--filter' can select all the
+// benchmarks of one component, thread configuration, or payload size.  The
+// options accepted by every benchmark program are described by 'printUsage'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Benchmark Program
+/// - - - - - - - - - - - - - - -
+// A benchmark program parses its options, then runs and reports each selected
+// benchmark:
+//..
+//  int main(int argc, char *argv[])
+//  {
+//      benchmarks::Options options;
+//      int rc = options.parse(argc, argv, bsl::cerr);
+//      if (rc) {
+//          return 0 < rc ? 0 : 1;
+//      }
+//
+//      benchmarks::Reporter reporter(bsl::cout, options.d_format);
+//
+//      if (options.isSelected("Increment")) {
+//          bsls::AtomicInt            counter;
+//          bslmt::ThroughputBenchmark benchmark;
+//          benchmark.addThreadGroup(
+//                      bdlf::BindUtil::bind(&increment, &counter,
+//                                           bdlf::PlaceHolders::_1),
+//                      options.d_threads[0].first,
+//                      options.d_busyWorkAmount);
+//
+//          bslmt::ThroughputBenchmarkResult result;
+//          benchmarks::BenchmarkUtil::execute(&result, &benchmark, options);
+//
+//          const char *groups[] = { "incrementers" };
+//          reporter.report("Increment", result, groups);
+//      }
+//      return 0;
+//  }
+//..
+
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace benchmarks {
+
+                               // =============
+                               // class Options
+                               // =============
+
+class Options {
+    // This attribute class holds the configuration of a benchmark program, as
+    // parsed from its command line.  The data members are public, so that
+    // programs can adjust the defaults before calling 'parse'.
+
+  public:
+    // PUBLIC TYPES
+    enum Format {
+        e_TEXT,  // human-readable table
+        e_CSV,   // one record per thread group
+        e_JSON   // array of one object per benchmark
+    };
+
+    typedef bsl::pair<int, int> ThreadCounts;
+        // numbers of threads in the first and second thread groups
+
+    // PUBLIC DATA
+    int                       d_millisecondsPerSample;
+    int                       d_numSamples;
+    int                       d_numWarmUpSamples;
+    int                       d_latencySamplingInterval;  // 0 disables
+    int                       d_maxLatencySamplesPerThread;
+    bsls::Types::Int64        d_busyWorkAmount;
+    int                       d_capacity;        // queue or pool capacity
+    bsl::vector<ThreadCounts> d_threads;
+    bool                      d_pinThreads;
+    bool                      d_removeOutliers;
+    Format                    d_format;
+    bsl::string               d_filter;
+
+    // CLASS METHODS
+    static void printUsage(bsl::ostream& stream, const char *programName);
+        // Write to the specified 'stream' a description of the options
+        // accepted by 'parse' for the program having the specified
+        // 'programName'.
+
+    // CREATORS
+    Options();
+        // Create an 'Options' object having the default configuration.
+
+    // MANIPULATORS
+    int parse(int argc, char *argv[], bsl::ostream& errorStream);
+        // Load into this object the options in the specified 'argv' array of
+        // the specified 'argc' command-line arguments.  Return 0 on success,
+        // a positive value (having written the usage to 'errorStream') if
+        // '--help' was specified, and a negative value (having written a
+        // diagnostic to the specified 'errorStream') if an argument is
+        // invalid.
+
+    // ACCESSORS
+    bool isSelected(const bsl::string& label) const;
+        // Return 'true' if the benchmark having the specified 'label' was
+        // selected by '--filter', and 'false' otherwise.
+};
+
+                               // ==============
+                               // class Reporter
+                               // ==============
+
+class Reporter {
+    // This mechanism writes the results of a sequence of benchmarks to a
+    // stream in one of the formats of 'Options::Format'.  JSON output is a
+    // single array, which is closed when the reporter is destroyed.
+
+    // DATA
+    bsl::ostream&   d_stream;       // destination of the results
+    Options::Format d_format;       // format of the results
+    int             d_numReported;  // number of benchmarks reported
+
+    // NOT IMPLEMENTED
+    Reporter(const Reporter&);
+    Reporter& operator=(const Reporter&);
+
+  public:
+    // CREATORS
+    Reporter(bsl::ostream& stream, Options::Format format);
+        // Create a reporter writing to the specified 'stream' in the specified
+        // 'format'.
+
+    ~Reporter();
+        // Complete the output written by this reporter, and destroy it.
+
+    // MANIPULATORS
+    void report(const bsl::string&                      label,
+                const bslmt::ThroughputBenchmarkResult& result,
+                const char *const                      *threadGroupNames);
+        // Write the specified 'result' of the benchmark having the specified
+        // 'label', naming thread group 'i' by the specified
+        // 'threadGroupNames[i]' in text output.  The behavior is undefined
+        // unless 'threadGroupNames' has 'result.numThreadGroups()' elements
+        // and '0 < result.numSamples()'.
+};
+
+                           // ====================
+                           // struct BenchmarkUtil
+                           // ====================
+
+struct BenchmarkUtil {
+    // This 'struct' provides a namespace for functions running a benchmark
+    // configured by an 'Options' object.
+
+    // PUBLIC TYPES
+    typedef bslmt::ThroughputBenchmark::InitializeSampleFunction
+                                                            InitializeFunction;
+    typedef bslmt::ThroughputBenchmark::ShutdownSampleFunction
+                                                              ShutdownFunction;
+    typedef bslmt::ThroughputBenchmark::CleanupSampleFunction
+                                                               CleanupFunction;
+
+    // CLASS METHODS
+    static void execute(bslmt::ThroughputBenchmarkResult *result,
+                        bslmt::ThroughputBenchmark       *benchmark,
+                        const Options&                    options);
+    static void execute(bslmt::ThroughputBenchmarkResult *result,
+                        bslmt::ThroughputBenchmark       *benchmark,
+                        const Options&                    options,
+                        const InitializeFunction&         initialize,
+                        const ShutdownFunction&           shutdown,
+                        const CleanupFunction&            cleanup);
+        // Apply the warm-up, latency sampling, and thread affinity of the
+        // specified 'options' to the specified 'benchmark', execute it with
+        // the sample duration and count of 'options', and load the results
+        // into the specified 'result', removing outlying samples if
+        // 'options.d_removeOutliers' is 'true'.  Optionally specify
+        // 'initialize', 'shutdown', and 'cleanup' functors, which are passed
+        // to 'benchmark.execute'.  If 'options.d_pinThreads' is 'true', the
+        // threads of all thread groups are pinned to consecutive processors.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,318 @@
+// bdlcc_queues.m.cpp                                                 -*-C++-*-
+
+//@PURPOSE: Benchmark the throughput and latency of the 'bdlcc' queues.
+//
+//@SEE_ALSO: bdlmt_pools.m.cpp, bslmt_throughputbenchmark
+//
+//@DESCRIPTION: This program measures, using 'bslmt::ThroughputBenchmark', the
+// rate at which a group of producer threads can push elements to a queue while
+// a group of consumer threads pops them, for each of:
+//
+//: o 'bdlcc::BoundedQueue'
+//: o 'bdlcc::FixedQueue'
+//: o 'bdlcc::SingleConsumerQueue' (one consumer only)
+//: o 'bdlcc::SingleProducerSingleConsumerBoundedQueue' (one of each only,
+//:   labelled "SPSCBoundedQueue")
+//: o 'bdlcc::Deque' (bounded by its high-water mark)
+//
+// with each of the thread counts given by '--threads' (producers x consumers)
+// and with elements of 8, 64, and 512 bytes.  Each benchmark is labelled
+// "<queue>/P<producers>xC<consumers>/<size>B"; for example, '--filter
+// FixedQueue/P4' runs the 'bdlcc::FixedQueue' benchmarks having 4 producers.
+//
+// Producers and consumers use the non-blocking 'tryPushBack' and
+// 'tryPopFront', yielding the processor and retrying when the queue is full or
+// empty, so that every thread can notice the end of a sample promptly whatever
+// the state of the queue.  The throughput reported for a thread group counts
+// completed operations per second, and, unless latency sampling is disabled
+// with '--latency 0', the latencies include the time spent retrying.
+// 'bdlcc::SingleConsumerQueue' is unbounded, so its producers also retry while
+// it holds '--capacity' elements, to keep its memory use comparable with the
+// bounded queues.  The queue is drained after each sample.
+
+#include <benchmarkutil.h>
+
+#include <bdlcc_boundedqueue.h>
+#include <bdlcc_deque.h>
+#include <bdlcc_fixedqueue.h>
+#include <bdlcc_singleconsumerqueue.h>
+#include <bdlcc_singleproducersingleconsumerboundedqueue.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_cyclecounter.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+// ============================================================================
+//                              PAYLOAD TYPES
+// ----------------------------------------------------------------------------
+
+template <int SIZE>
+struct Payload {
+    // This 'struct' is a bitwise-copyable element of 'SIZE' bytes.
+
+    // DATA
+    char d_data[SIZE];
+
+    // CREATORS
+    Payload()
+    {
+        bsl::memset(d_data, 0, SIZE);
+    }
+};
+
+// ============================================================================
+//                              QUEUE ADAPTERS
+// ----------------------------------------------------------------------------
+
+template <class QUEUE, class VALUE>
+int tryPush(QUEUE *queue, const VALUE& value, bsl::size_t)
+    // Attempt to push the specified 'value' to the specified 'queue' without
+    // blocking.  Return 0 on success, and a non-zero value otherwise.
+{
+    return queue->tryPushBack(value);
+}
+
+template <class VALUE>
+int tryPush(bdlcc::SingleConsumerQueue<VALUE> *queue,
+            const VALUE&                       value,
+            bsl::size_t                        capacity)
+    // Attempt to push the specified 'value' to the specified 'queue' without
+    // blocking, failing if 'queue' has at least the specified 'capacity'
+    // elements.  Return 0 on success, and a non-zero value otherwise.
+{
+    if (queue->numElements() >= capacity) {
+        return -1;                                                    // RETURN
+    }
+    return queue->tryPushBack(value);
+}
+
+                            // ====================
+                            // class QueueBenchmark
+                            // ====================
+
+template <class QUEUE, class VALUE>
+class QueueBenchmark {
+    // This class holds the queue exercised by one benchmark, and provides the
+    // run and sample functions passed to 'bslmt::ThroughputBenchmark'.
+
+    // DATA
+    QUEUE            d_queue;       // queue under test
+    bsl::size_t      d_capacity;    // maximum number of elements
+    bsls::AtomicBool d_isStopping;  // 'true' once the sample has ended
+
+  public:
+    // CREATORS
+    explicit QueueBenchmark(bsl::size_t capacity)
+    : d_queue(capacity)
+    , d_capacity(capacity)
+    , d_isStopping(false)
+    {
+    }
+
+    // MANIPULATORS
+    void produce(int threadIndex)
+        // Push one element to the queue, retrying until success or the end of
+        // the sample.
+    {
+        VALUE value;
+        value.d_data[0] = static_cast<char>(threadIndex);
+
+        while (0 != tryPush(&d_queue, value, d_capacity)) {
+            if (d_isStopping.loadRelaxed()) {
+                return;                                               // RETURN
+            }
+            bslmt::ThreadUtil::yield();
+        }
+    }
+
+    void consume(int)
+        // Pop one element from the queue, retrying until success or the end
+        // of the sample.
+    {
+        VALUE value;
+        while (0 != d_queue.tryPopFront(&value)) {
+            if (d_isStopping.loadRelaxed()) {
+                return;                                               // RETURN
+            }
+            bslmt::ThreadUtil::yield();
+        }
+    }
+
+    void initializeSample(bool)
+        // Prepare for a sample.
+    {
+        d_isStopping.storeRelaxed(false);
+    }
+
+    void shutdownSample(bool)
+        // Release the threads waiting for the queue at the end of a sample.
+    {
+        d_isStopping.storeRelaxed(true);
+    }
+
+    void cleanupSample(bool)
+        // Remove the elements remaining in the queue after a sample.
+    {
+        VALUE value;
+        while (0 == d_queue.tryPopFront(&value)) {
+        }
+    }
+};
+
+// ============================================================================
+//                              BENCHMARK DRIVER
+// ----------------------------------------------------------------------------
+
+template <template <class> class QUEUE, int SIZE>
+void runQueue(benchmarks::Reporter       *reporter,
+              const char                 *queueName,
+              int                         maxProducers,
+              int                         maxConsumers,
+              const benchmarks::Options&  options)
+    // Run, with the specified 'options', and report to the specified
+    // 'reporter' the benchmarks of the 'QUEUE' template having the specified
+    // 'queueName' and elements of 'SIZE' bytes, for each thread configuration
+    // having at most the specified 'maxProducers' producers and
+    // 'maxConsumers' consumers (or any number, for a value of 0).
+{
+    typedef Payload<SIZE>                       Value;
+    typedef QueueBenchmark<QUEUE<Value>, Value> Benchmark;
+
+    for (bsl::size_t i = 0; i < options.d_threads.size(); ++i) {
+        const int numProducers = options.d_threads[i].first;
+        const int numConsumers = options.d_threads[i].second;
+
+        if ((maxProducers && numProducers > maxProducers)
+         || (maxConsumers && numConsumers > maxConsumers)) {
+            continue;                                               // CONTINUE
+        }
+
+        bsl::ostringstream label;
+        label << queueName << "/P" << numProducers << "xC" << numConsumers
+              << '/' << SIZE << 'B';
+        if (!options.isSelected(label.str())) {
+            continue;                                               // CONTINUE
+        }
+
+        Benchmark                  queue(options.d_capacity);
+        bslmt::ThroughputBenchmark benchmark;
+
+        benchmark.addThreadGroup(bdlf::BindUtil::bind(&Benchmark::produce,
+                                                      &queue,
+                                                      bdlf::PlaceHolders::_1),
+                                 numProducers,
+                                 options.d_busyWorkAmount);
+        benchmark.addThreadGroup(bdlf::BindUtil::bind(&Benchmark::consume,
+                                                      &queue,
+                                                      bdlf::PlaceHolders::_1),
+                                 numConsumers,
+                                 options.d_busyWorkAmount);
+
+        bslmt::ThroughputBenchmarkResult result;
+        benchmarks::BenchmarkUtil::execute(
+                  &result,
+                  &benchmark,
+                  options,
+                  bdlf::BindUtil::bind(&Benchmark::initializeSample,
+                                       &queue,
+                                       bdlf::PlaceHolders::_1),
+                  bdlf::BindUtil::bind(&Benchmark::shutdownSample,
+                                       &queue,
+                                       bdlf::PlaceHolders::_1),
+                  bdlf::BindUtil::bind(&Benchmark::cleanupSample,
+                                       &queue,
+                                       bdlf::PlaceHolders::_1));
+
+        const char *groups[] = { "producers", "consumers" };
+        reporter->report(label.str(), result, groups);
+    }
+}
+
+template <int SIZE>
+void runAllQueues(benchmarks::Reporter       *reporter,
+                  const benchmarks::Options&  options)
+    // Run, with the specified 'options', and report to the specified
+    // 'reporter' the benchmarks of every queue having elements of 'SIZE'
+    // bytes.
+{
+    runQueue<bdlcc::BoundedQueue, SIZE>(reporter,
+                                        "BoundedQueue",
+                                        0,
+                                        0,
+                                        options);
+    runQueue<bdlcc::FixedQueue, SIZE>(reporter,
+                                      "FixedQueue",
+                                      0,
+                                      0,
+                                      options);
+    runQueue<bdlcc::SingleConsumerQueue, SIZE>(reporter,
+                                               "SingleConsumerQueue",
+                                               0,
+                                               1,
+                                               options);
+    runQueue<bdlcc::SingleProducerSingleConsumerBoundedQueue, SIZE>(
+                                                            reporter,
+                                                            "SPSCBoundedQueue",
+                                                            1,
+                                                            1,
+                                                            options);
+    runQueue<bdlcc::Deque, SIZE>(reporter, "Deque", 0, 0, options);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    benchmarks::Options options;
+
+    int rc = options.parse(argc, argv, bsl::cerr);
+    if (rc) {
+        return 0 < rc ? 0 : 1;                                        // RETURN
+    }
+
+    bsls::CycleCounter::calibrate();
+
+    benchmarks::Reporter reporter(bsl::cout, options.d_format);
+
+    runAllQueues<8>(&reporter, options);
+    runAllQueues<64>(&reporter, options);
+    runAllQueues<512>(&reporter, options);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
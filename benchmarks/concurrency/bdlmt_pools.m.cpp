@@ -0,0 +1,390 @@
+// bdlmt_pools.m.cpp                                                  -*-C++-*-
+
+//@PURPOSE: Benchmark the job submission throughput of the 'bdlmt' pools.
+//
+//@SEE_ALSO: bdlcc_queues.m.cpp, bslmt_throughputbenchmark
+//
+//@DESCRIPTION: This program measures, using 'bslmt::ThroughputBenchmark', the
+// rate at which a group of producer threads can submit jobs to a thread pool
+// whose worker threads execute them, for each of:
+//
+//: o 'bdlmt::FixedThreadPool'
+//: o 'bdlmt::ThreadPool'
+//: o 'bdlmt::MultiQueueThreadPool' (one queue per producer)
+//
+// with each of the thread counts given by '--threads' (producers x workers),
+// and with jobs carrying payloads of 8, 64, and 512 bytes, so that larger jobs
+// do not fit in the small-object buffer of 'bsl::function'.  Each benchmark is
+// labelled "<pool>/P<producers>xW<workers>/<size>B".
+//
+// Producers submit jobs without blocking, yielding the processor and retrying
+// while the pool has '--capacity' pending jobs (the queue capacity of
+// 'bdlmt::FixedThreadPool', and a limit checked before each submission for the
+// other pools, which are unbounded), so that the submission rate is bounded by
+// the rate at which the workers execute jobs.  The pool is drained after each
+// sample.  The jobs do no work beyond reading their payload.
+
+#include <benchmarkutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_multiqueuethreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_cyclecounter.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef bsl::function<void()> Job;
+
+enum { k_MAX_IDLE_TIME = 1000 };  // milliseconds before idle workers exit
+
+// ============================================================================
+//                                JOB TYPES
+// ----------------------------------------------------------------------------
+
+template <int SIZE>
+struct PayloadJob {
+    // This 'struct' is a job functor carrying a payload of 'SIZE' bytes.
+
+    // DATA
+    char d_data[SIZE];
+
+    // CREATORS
+    explicit PayloadJob(int threadIndex)
+    {
+        bsl::memset(d_data, 0, SIZE);
+        d_data[0] = static_cast<char>(threadIndex);
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Read the payload of this job.
+    {
+        volatile char sink = d_data[SIZE - 1];
+        (void)sink;
+    }
+};
+
+// ============================================================================
+//                               POOL ADAPTERS
+// ----------------------------------------------------------------------------
+
+                        // ============================
+                        // class FixedThreadPoolAdapter
+                        // ============================
+
+class FixedThreadPoolAdapter {
+    // This class adapts 'bdlmt::FixedThreadPool' to the interface used by
+    // 'PoolBenchmark'.
+
+    // DATA
+    bdlmt::FixedThreadPool d_pool;
+
+  public:
+    // CREATORS
+    FixedThreadPoolAdapter(int, int numWorkers, int capacity)
+    : d_pool(numWorkers, capacity)
+    {
+        d_pool.start();
+    }
+
+    ~FixedThreadPoolAdapter()
+    {
+        d_pool.stop();
+    }
+
+    // MANIPULATORS
+    void drain()
+    {
+        d_pool.drain();
+    }
+
+    int tryEnqueue(int, const Job& job)
+    {
+        return d_pool.tryEnqueueJob(job);
+    }
+};
+
+                          // =======================
+                          // class ThreadPoolAdapter
+                          // =======================
+
+class ThreadPoolAdapter {
+    // This class adapts 'bdlmt::ThreadPool' to the interface used by
+    // 'PoolBenchmark'.
+
+    // DATA
+    bdlmt::ThreadPool d_pool;
+    int               d_capacity;
+
+  public:
+    // CREATORS
+    ThreadPoolAdapter(int, int numWorkers, int capacity)
+    : d_pool(bslmt::ThreadAttributes(),
+             numWorkers,
+             numWorkers,
+             k_MAX_IDLE_TIME)
+    , d_capacity(capacity)
+    {
+        d_pool.start();
+    }
+
+    ~ThreadPoolAdapter()
+    {
+        d_pool.stop();
+    }
+
+    // MANIPULATORS
+    void drain()
+    {
+        d_pool.drain();
+        d_pool.start();  // 'drain' disables enqueuing.
+    }
+
+    int tryEnqueue(int, const Job& job)
+    {
+        if (d_pool.numPendingJobs() >= d_capacity) {
+            return -1;                                                // RETURN
+        }
+        return d_pool.enqueueJob(job);
+    }
+};
+
+                     // =================================
+                     // class MultiQueueThreadPoolAdapter
+                     // =================================
+
+class MultiQueueThreadPoolAdapter {
+    // This class adapts 'bdlmt::MultiQueueThreadPool', having one queue for
+    // each producer, to the interface used by 'PoolBenchmark'.
+
+    // DATA
+    bdlmt::MultiQueueThreadPool d_pool;
+    bsl::vector<int>            d_queueIds;  // queue of each producer
+    int                         d_capacity;
+
+  public:
+    // CREATORS
+    MultiQueueThreadPoolAdapter(int numProducers, int numWorkers, int capacity)
+    : d_pool(bslmt::ThreadAttributes(),
+             numWorkers,
+             numWorkers,
+             k_MAX_IDLE_TIME)
+    , d_queueIds()
+    , d_capacity(capacity)
+    {
+        d_pool.start();
+        for (int i = 0; i < numProducers; ++i) {
+            d_queueIds.push_back(d_pool.createQueue());
+        }
+    }
+
+    ~MultiQueueThreadPoolAdapter()
+    {
+        d_pool.stop();
+    }
+
+    // MANIPULATORS
+    void drain()
+    {
+        d_pool.drain();
+    }
+
+    int tryEnqueue(int threadIndex, const Job& job)
+    {
+        const int id = d_queueIds[threadIndex];
+        if (d_pool.numElements(id) >= d_capacity) {
+            return -1;                                                // RETURN
+        }
+        return d_pool.enqueueJob(id, job);
+    }
+};
+
+                            // ===================
+                            // class PoolBenchmark
+                            // ===================
+
+template <class ADAPTER, int SIZE>
+class PoolBenchmark {
+    // This class holds the pool exercised by one benchmark, and provides the
+    // run and sample functions passed to 'bslmt::ThroughputBenchmark'.
+
+    // DATA
+    ADAPTER          d_pool;        // pool under test
+    bsls::AtomicBool d_isStopping;  // 'true' once the sample has ended
+
+  public:
+    // CREATORS
+    PoolBenchmark(int numProducers, int numWorkers, int capacity)
+    : d_pool(numProducers, numWorkers, capacity)
+    , d_isStopping(false)
+    {
+    }
+
+    // MANIPULATORS
+    void produce(int threadIndex)
+        // Submit one job to the pool, retrying until success or the end of
+        // the sample.
+    {
+        const Job job = PayloadJob<SIZE>(threadIndex);
+
+        while (0 != d_pool.tryEnqueue(threadIndex, job)) {
+            if (d_isStopping.loadRelaxed()) {
+                return;                                               // RETURN
+            }
+            bslmt::ThreadUtil::yield();
+        }
+    }
+
+    void initializeSample(bool)
+        // Prepare for a sample.
+    {
+        d_isStopping.storeRelaxed(false);
+    }
+
+    void shutdownSample(bool)
+        // Release the threads waiting for the pool at the end of a sample.
+    {
+        d_isStopping.storeRelaxed(true);
+    }
+
+    void cleanupSample(bool)
+        // Wait for the jobs remaining in the pool after a sample.
+    {
+        d_pool.drain();
+    }
+};
+
+// ============================================================================
+//                              BENCHMARK DRIVER
+// ----------------------------------------------------------------------------
+
+template <class ADAPTER, int SIZE>
+void runPool(benchmarks::Reporter       *reporter,
+             const char                 *poolName,
+             const benchmarks::Options&  options)
+    // Run, with the specified 'options', and report to the specified
+    // 'reporter' the benchmarks of the pool adapted by 'ADAPTER' having the
+    // specified 'poolName' and jobs carrying 'SIZE' bytes, for each thread
+    // configuration.
+{
+    typedef PoolBenchmark<ADAPTER, SIZE> Benchmark;
+
+    for (bsl::size_t i = 0; i < options.d_threads.size(); ++i) {
+        const int numProducers = options.d_threads[i].first;
+        const int numWorkers   = options.d_threads[i].second;
+
+        bsl::ostringstream label;
+        label << poolName << "/P" << numProducers << "xW" << numWorkers
+              << '/' << SIZE << 'B';
+        if (!options.isSelected(label.str())) {
+            continue;                                               // CONTINUE
+        }
+
+        Benchmark                  pool(numProducers,
+                                        numWorkers,
+                                        options.d_capacity);
+        bslmt::ThroughputBenchmark benchmark;
+
+        benchmark.addThreadGroup(bdlf::BindUtil::bind(&Benchmark::produce,
+                                                      &pool,
+                                                      bdlf::PlaceHolders::_1),
+                                 numProducers,
+                                 options.d_busyWorkAmount);
+
+        bslmt::ThroughputBenchmarkResult result;
+        benchmarks::BenchmarkUtil::execute(
+                  &result,
+                  &benchmark,
+                  options,
+                  bdlf::BindUtil::bind(&Benchmark::initializeSample,
+                                       &pool,
+                                       bdlf::PlaceHolders::_1),
+                  bdlf::BindUtil::bind(&Benchmark::shutdownSample,
+                                       &pool,
+                                       bdlf::PlaceHolders::_1),
+                  bdlf::BindUtil::bind(&Benchmark::cleanupSample,
+                                       &pool,
+                                       bdlf::PlaceHolders::_1));
+
+        const char *groups[] = { "producers" };
+        reporter->report(label.str(), result, groups);
+    }
+}
+
+template <int SIZE>
+void runAllPools(benchmarks::Reporter       *reporter,
+                 const benchmarks::Options&  options)
+    // Run, with the specified 'options', and report to the specified
+    // 'reporter' the benchmarks of every pool having jobs carrying 'SIZE'
+    // bytes.
+{
+    runPool<FixedThreadPoolAdapter, SIZE>(reporter,
+                                          "FixedThreadPool",
+                                          options);
+    runPool<ThreadPoolAdapter, SIZE>(reporter, "ThreadPool", options);
+    runPool<MultiQueueThreadPoolAdapter, SIZE>(reporter,
+                                               "MultiQueueThreadPool",
+                                               options);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    benchmarks::Options options;
+
+    int rc = options.parse(argc, argv, bsl::cerr);
+    if (rc) {
+        return 0 < rc ? 0 : 1;                                        // RETURN
+    }
+
+    bsls::CycleCounter::calibrate();
+
+    benchmarks::Reporter reporter(bsl::cout, options.d_format);
+
+    runAllPools<8>(&reporter, options);
+    runAllPools<64>(&reporter, options);
+    runAllPools<512>(&reporter, options);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
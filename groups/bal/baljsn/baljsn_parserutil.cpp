@@ -15,6 +15,8 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 
 #include <bdldfp_decimalutil.h>
 
+#include <bslalg_numericparserutil.h>
+
 #include <bsls_alignedbuffer.h>
 #include <bsls_annotation.h>
 #include <bsls_assert.h>
@@ -22,8 +24,6 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bsl_algorithm.h>
 #include <bsl_cmath.h>
 #include <bsl_cctype.h>
-#include <bsl_cerrno.h>
-#include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iosfwd.h>
 #include <bsl_limits.h>
@@ -363,24 +363,24 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
         return loadInfOrNan(value, data);                             // RETURN
     }
 
-    const int k_MAX_STRING_LENGTH = 63;
-    char      buffer[k_MAX_STRING_LENGTH + 1];
+    // Parse the number in place.  Note that numbers that overflow to an
+    // infinity or underflow to zero are rejected, and that the last character
+    // must be a digit, which rejects unquoted infinities and NaNs, and numbers
+    // ending with '.'.
 
-    bdlma::BufferedSequentialAllocator allocator(buffer,
-                                                 k_MAX_STRING_LENGTH + 1);
-    bsl::string                        dataString(data.data(),
-                                                  data.length(),
-                                                  &allocator);
-
-    char   *endPtr = 0;
-    errno          = 0;
-    double  tmp    = bsl::strtod(dataString.c_str(), &endPtr);
-
-    if (endPtr    != dataString.end()
-     || (0        == tmp && 0 != errno)
-     ||  HUGE_VAL == tmp
-     || -HUGE_VAL == tmp
-     || !bdlb::CharType::isDigit(*(dataString.end() - 1))) {
+    typedef bslalg::NumericParserUtil NumericParserUtil;
+
+    double                          tmp;
+    const char                     *end;
+    const NumericParserUtil::Status status = NumericParserUtil::fromChars(
+                                                                 &tmp,
+                                                                 &end,
+                                                                 data.begin(),
+                                                                 data.end());
+
+    if (NumericParserUtil::e_SUCCESS != status
+     || end != data.end()
+     || !bdlb::CharType::isDigit(*(data.end() - 1))) {
         return -1;                                                    // RETURN
     }
 
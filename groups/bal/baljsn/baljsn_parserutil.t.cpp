@@ -2623,6 +2623,14 @@ int main(int argc, char *argv[])
                 {  L_,    "1e-1",                    0.1,       true    },
                 {  L_,    "1E-1",                    0.1,       true    },
 
+                {  L_,    "4.9406564584124654e-324",
+                                         4.9406564584124654e-324,  true    },
+                {  L_,    "1.7976931348623157e308",
+                                          1.7976931348623157e308,  true    },
+                {  L_,    "0.1000000000000000000000000000000000000000000"
+                          "000000000000000000000000000000000000000001",
+                                                             0.1,  true    },
+
                 {  L_,    "\"NaN\"", bsl::numeric_limits<Type>::quiet_NaN(),
                                                                 true    },
 
@@ -2704,9 +2712,15 @@ int main(int argc, char *argv[])
                 {  L_,  "34.56Z1",    ERROR_VALUE,   false   },
                 {  L_,  "34.56eZ",    ERROR_VALUE,   false   },
 
-// TBD:
-//                 {  L_,    "0x12",     ERROR_VALUE,   false   },
-//                 {  L_,    "0x256",    ERROR_VALUE,   false   },
+                {  L_,    "0x12",     ERROR_VALUE,   false   },
+                {  L_,    "0x256",    ERROR_VALUE,   false   },
+                {  L_,    "0x1p3",    ERROR_VALUE,   false   },
+                {  L_,    "1e999",    ERROR_VALUE,   false   },
+                {  L_,    "-1e-999",  ERROR_VALUE,   false   },
+                {  L_,    "inf",      ERROR_VALUE,   false   },
+                {  L_,    "nan",      ERROR_VALUE,   false   },
+                {  L_,    "nan(1)",   ERROR_VALUE,   false   },
+                {  L_,    "1.",       ERROR_VALUE,   false   },
                 {  L_,    "1.1}",     ERROR_VALUE,   false   },
                 {  L_,    "1.1,",     ERROR_VALUE,   false   },
                 {  L_,    "1.1]",     ERROR_VALUE,   false   },
@@ -90,6 +90,9 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_iso8601util.h>
 #include <bdlt_datetimeinterval.h>
 
+#include <bslalg_numericformatterutil.h>
+
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -299,23 +302,21 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         }
       } break;
       default: {
+        // Write as 'snprintf' with "%.*g" would, without depending on the
+        // locale.  Note that the precision is at most 17.
+
         const int k_SIZE = 32;
         char      buffer[k_SIZE];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+        const char *end = bslalg::NumericFormatterUtil::toChars(
+                                      buffer,
+                                      buffer + k_SIZE,
+                                      value,
+                                      bslalg::NumericFormatterUtil::e_GENERAL,
+                                      maxStreamPrecision<TYPE>(options));
+        BSLS_ASSERT(end);
 
-        const int len = snprintf(buffer,
-                                 k_SIZE,
-                                 "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
-                                 value);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       }
     }
     return 0;
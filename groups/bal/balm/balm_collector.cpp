@@ -12,12 +12,134 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_collector_cpp,"$Id$ $CSID$")
 
+#include <bslma_default.h>
+
+#include <bsls_types.h>
+
+#include <bsl_new.h>
+
 namespace BloombergLP {
+namespace balm {
 
                               // ---------------
                               // class Collector
                               // ---------------
 
+// PRIVATE ACCESSORS
+void Collector::lockAllShards() const
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].d_lock.lockWithBackoff();
+    }
+}
+
+void Collector::unlockAllShards() const
+{
+    for (int i = d_numShards - 1; 0 <= i; --i) {
+        d_shards_p[i].d_lock.unlock();
+    }
+}
+
+void Collector::loadRaw(MetricRecord *record) const
+{
+    record->metricId() = d_metricId;
+    record->count()    = 0;
+    record->total()    = 0.0;
+    record->min()      = MetricRecord::k_DEFAULT_MIN;
+    record->max()      = MetricRecord::k_DEFAULT_MAX;
+
+    for (int i = 0; i < d_numShards; ++i) {
+        const Shard& shard = d_shards_p[i];
+
+        record->count() += shard.d_count;
+        record->total() += shard.d_total;
+        record->min()   =  bsl::min(record->min(), shard.d_min);
+        record->max()   =  bsl::max(record->max(), shard.d_max);
+    }
+}
+
+// CREATORS
+Collector::Collector(const MetricId&   metricId,
+                     bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_shards_p(0)
+, d_numShards(CollectorShardUtil::numShards())
+, d_storage_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // Allocate one shard more than needed, so that the shards can be aligned
+    // on a cache-line boundary within the allocated storage.
+
+    d_storage_p = d_allocator_p->allocate((d_numShards + 1) * k_SHARD_SIZE);
+
+    char                       *buffer  = static_cast<char *>(d_storage_p);
+    const bsls::Types::UintPtr  address =
+                               reinterpret_cast<bsls::Types::UintPtr>(buffer);
+    const bsls::Types::UintPtr  offset  =
+        (k_SHARD_SIZE - address % k_SHARD_SIZE) % k_SHARD_SIZE;
+
+    d_shards_p = reinterpret_cast<Shard *>(buffer + offset);
+
+    // Value-initializing a shard zero-initializes its spin lock, which is
+    // equivalent to 'bsls::SpinLock::s_unlocked'.
+
+    for (int i = 0; i < d_numShards; ++i) {
+        resetShard(new (d_shards_p + i) Shard());
+    }
+}
+
+Collector::~Collector()
+{
+    // 'Shard' is trivially destructible.
+
+    d_allocator_p->deallocate(d_storage_p);
+}
+
+// MANIPULATORS
+void Collector::reset()
+{
+    lockAllShards();
+    for (int i = 0; i < d_numShards; ++i) {
+        resetShard(d_shards_p + i);
+    }
+    unlockAllShards();
+}
+
+void Collector::loadAndReset(MetricRecord *record)
+{
+    lockAllShards();
+    loadRaw(record);
+    for (int i = 0; i < d_numShards; ++i) {
+        resetShard(d_shards_p + i);
+    }
+    unlockAllShards();
+}
+
+void Collector::setCountTotalMinMax(int    count,
+                                    double total,
+                                    double min,
+                                    double max)
+{
+    lockAllShards();
+    for (int i = 1; i < d_numShards; ++i) {
+        resetShard(d_shards_p + i);
+    }
+    d_shards_p[0].d_count = count;
+    d_shards_p[0].d_total = total;
+    d_shards_p[0].d_min   = min;
+    d_shards_p[0].d_max   = max;
+    unlockAllShards();
+}
+
+// ACCESSORS
+void Collector::load(MetricRecord *record) const
+{
+    lockAllShards();
+    loadRaw(record);
+    unlockAllShards();
+}
+
+}  // close package namespace
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
@@ -18,7 +18,7 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 //@CLASSES:
 //   balm::Collector: a container for collecting and aggregating metric values
 //
-//@SEE_ALSO: balm_collectorrepository, balm_metric
+//@SEE_ALSO: balm_collectorrepository, balm_metric, balm_collectorshardutil
 //
 //@DESCRIPTION: This component provides a class for collecting and aggregating
 // the values of a metric.  The collector records the number of times an event
@@ -45,6 +45,21 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 // operations on a given instance can be safely invoked simultaneously from
 // multiple threads.
 //
+///Performance
+///-----------
+// A 'balm::Collector' is frequently updated concurrently by many threads, so
+// its state is divided into 'balm::CollectorShardUtil::numShards()'
+// cache-line-sized *shards* (twice as many as there are hardware threads, up
+// to a limit), each guarded by its own spin lock.  The 'update' and
+// 'accumulateCountTotalMinMax' operations lock only the shard assigned to the
+// calling thread (see 'balm_collectorshardutil'), so that concurrent updates
+// from different threads rarely contend for the same lock or cache line; a
+// thread finding its shard locked backs off, yielding the processor, rather
+// than spinning until the holder runs again.  The 'load', 'loadAndReset',
+// 'reset', and 'setCountTotalMinMax' operations, which are typically invoked
+// once per publication interval, lock every shard and therefore continue to
+// operate on a consistent snapshot of the collector's state.
+//
 ///Usage
 ///-----
 // The following example creates a 'balm::Collector', modifies its values, then
@@ -82,11 +97,17 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 
 #include <balscm_version.h>
 
+#include <balm_collectorshardutil.h>
 #include <balm_metricrecord.h>
 #include <balm_metricid.h>
 
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_spinlock.h>
 
 #include <bsl_algorithm.h>
 
@@ -95,35 +116,104 @@ namespace BloombergLP {
 
 namespace balm {
 
+                           // =====================
+                           // struct Collector_Shard
+                           // =====================
+
+struct Collector_Shard {
+    // This component-private 'struct' provides the aggregated values of one
+    // shard of a 'Collector', padded to occupy exactly one cache line.
+
+    // DATA
+    bsls::SpinLock d_lock;   // synchronizes access to this shard
+    int            d_count;  // aggregated count of events
+    double         d_total;  // total of values across events
+    double         d_min;    // minimum value across events
+    double         d_max;    // maximum value across events
+    char           d_pad[CollectorShardUtil::k_SHARD_SIZE
+                         - sizeof(bsls::SpinLock)
+                         - sizeof(int)
+                         - 3 * sizeof(double)];
+                             // padding to the size of a cache line
+};
+
+BSLMF_ASSERT(sizeof(Collector_Shard) == CollectorShardUtil::k_SHARD_SIZE);
+
                               // ===============
                               // class Collector
                               // ===============
 
 class Collector {
     // This class provides a mechanism for collecting and aggregating the
-    // value of a metric over a period of time.  The collector contains a
-    // 'MetricRecord' object that holds the identity of the metric being
-    // collected, the number of times an event occurred, and the total,
-    // minimum, and maximum aggregates of the associated measurement value.
+    // value of a metric over a period of time.  The collector holds the
+    // identity of the metric being collected and, divided among a set of
+    // striped shards, the number of times an event occurred, and the
+    // total, minimum, and maximum aggregates of the associated measurement
+    // value.
     // The default value for the count is 0, the default value for the total
     // is 0.0, the default minimum value is 'MetricRecord::k_DEFAULT_MIN', and
     // the default maximum value is 'MetricRecord::k_DEFAULT_MAX'.
 
+    // PRIVATE TYPES
+    typedef Collector_Shard Shard;
+
+    enum { k_SHARD_SIZE = CollectorShardUtil::k_SHARD_SIZE };
+
     // DATA
-    MetricRecord         d_record;  // the recorded metric information
-    mutable bslmt::Mutex d_lock;    // record synchronization mechanism
+    MetricId          d_metricId;     // identifies the metric being collected
+
+    Shard            *d_shards_p;     // cache-line aligned array of
+                                      // 'd_numShards' shards within
+                                      // 'd_storage_p'
+
+    int               d_numShards;    // number of shards
+
+    void             *d_storage_p;    // storage for the shards, over-sized
+                                      // so that they can be aligned on a
+                                      // cache-line boundary (owned)
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
 
     // NOT IMPLEMENTED
     Collector(const Collector&);
     Collector& operator=(const Collector&);
 
+    // PRIVATE CLASS METHODS
+    static void resetShard(Shard *shard);
+        // Set the count and total of the specified 'shard' to 0, its minimum
+        // to 'MetricRecord::k_DEFAULT_MIN', and its maximum to
+        // 'MetricRecord::k_DEFAULT_MAX'.  The behavior is undefined unless
+        // the calling thread holds the lock of 'shard'.
+
+    // PRIVATE ACCESSORS
+    void lockAllShards() const;
+        // Acquire the lock of every shard of this collector, in increasing
+        // order of shard index, backing off while a lock is held by another
+        // thread.
+
+    void unlockAllShards() const;
+        // Release the lock of every shard of this collector.  The behavior is
+        // undefined unless the calling thread holds the lock of every shard.
+
+    void loadRaw(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the count, total, minimum, and maximum values
+        // aggregated over all shards.  The behavior is undefined unless the
+        // calling thread holds the lock of every shard.
+
   public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Collector, bslma::UsesBslmaAllocator);
+
      // CREATORS
-    Collector(const MetricId& metricId);
+    explicit Collector(const MetricId&   metricId,
+                       bslma::Allocator *basicAllocator = 0);
         // Create a collector for a metric having the specified 'metricId',
         // and having an initial count of 0, total of 0.0, min of
         // 'MetricRecord::k_DEFAULT_MIN', and max of
-        // 'MetricRecord::k_DEFAULT_MAX'.
+        // 'MetricRecord::k_DEFAULT_MAX'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
 
     ~Collector();
         // Destroy this object.
@@ -187,49 +277,28 @@ class Collector {
                               // class Collector
                               // ---------------
 
-// CREATORS
+// PRIVATE CLASS METHODS
 inline
-Collector::Collector(const MetricId& metricId)
-: d_record(metricId)
-, d_lock()
-{
-}
-
-inline
-Collector::~Collector()
+void Collector::resetShard(Shard *shard)
 {
+    shard->d_count = 0;
+    shard->d_total = 0.0;
+    shard->d_min   = MetricRecord::k_DEFAULT_MIN;
+    shard->d_max   = MetricRecord::k_DEFAULT_MAX;
 }
 
 // MANIPULATORS
-inline
-void Collector::reset()
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
-}
-
-inline
-void Collector::loadAndReset(MetricRecord *record)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record          = d_record;
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
-}
-
 inline
 void Collector::update(double value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    ++d_record.count();
-    d_record.total() += value;
-    d_record.min()   =  bsl::min(d_record.min(), value);
-    d_record.max()   =  bsl::max(d_record.max(), value);
+    Shard *shard = d_shards_p + CollectorShardUtil::shardIndex();
+
+    shard->d_lock.lockWithBackoff();
+    ++shard->d_count;
+    shard->d_total += value;
+    shard->d_min   =  bsl::min(shard->d_min, value);
+    shard->d_max   =  bsl::max(shard->d_max, value);
+    shard->d_lock.unlock();
 }
 
 inline
@@ -238,39 +307,23 @@ void Collector::accumulateCountTotalMinMax(int    count,
                                            double min,
                                            double max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() += count;
-    d_record.total() += total;
-    d_record.min()   =  bsl::min(d_record.min(), min);
-    d_record.max()   =  bsl::max(d_record.max(), max);
-}
-
-inline
-void Collector::setCountTotalMinMax(int    count,
-                                    double total,
-                                    double min,
-                                    double max)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = count;
-    d_record.total() = total;
-    d_record.min()   = min;
-    d_record.max()   = max;
+    Shard *shard = d_shards_p + CollectorShardUtil::shardIndex();
+
+    shard->d_lock.lockWithBackoff();
+    shard->d_count += count;
+    shard->d_total += total;
+    shard->d_min   =  bsl::min(shard->d_min, min);
+    shard->d_max   =  bsl::max(shard->d_max, max);
+    shard->d_lock.unlock();
 }
 
 // ACCESSORS
 inline
 const MetricId& Collector::metricId() const
 {
-    return d_record.metricId();
+    return d_metricId;
 }
 
-inline
-void Collector::load(MetricRecord *record) const
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record = d_record;
-}
 }  // close package namespace
 
 }  // close enterprise namespace
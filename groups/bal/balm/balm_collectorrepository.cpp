@@ -13,6 +13,7 @@
 BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 
 #include <balm_metricid.h>
+#include <balm_publicationtype.h>
 
 #include <bslmt_readlockguard.h>
 #include <bslmt_writelockguard.h>
@@ -27,6 +28,7 @@ BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 #include <bsl_string.h>
 #include <bsl_utility.h>
 
+#include <bsl_climits.h>
 #include <bsl_cstddef.h>           // for 'bsl::size_t'
 
 namespace BloombergLP {
@@ -43,6 +45,24 @@ void combine(balm::MetricRecord *record, const balm::MetricRecord& value)
     record->max()      = bsl::max(record->max(), value.max());
 }
 
+struct QuantileMetric {
+    // This 'struct' describes a quantile metric published for each histogram
+    // collector.
+
+    double      d_percentile;  // percentile of the quantile
+    const char *d_suffix;      // suffix appended to the metric name
+};
+
+const QuantileMetric k_QUANTILE_METRICS[] = {
+    { 50.0, ".p50"  },
+    { 90.0, ".p90"  },
+    { 99.0, ".p99"  },
+    { 99.9, ".p999" }
+};
+
+const int k_NUM_QUANTILE_METRICS = static_cast<int>(
+                   sizeof k_QUANTILE_METRICS / sizeof *k_QUANTILE_METRICS);
+
 }  // close unnamed namespace
 
 namespace balm {
@@ -159,7 +179,7 @@ template <class COLLECTOR>
 CollectorRepository_Collectors<COLLECTOR>::
       CollectorRepository_Collectors(const MetricId&   metricId,
                                      bslma::Allocator *basicAllocator)
-: d_defaultCollector(metricId)
+: d_defaultCollector(metricId, basicAllocator)
 , d_addedCollectors(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -186,8 +206,10 @@ bsl::shared_ptr<COLLECTOR>
 CollectorRepository_Collectors<COLLECTOR>::addCollector()
 {
     Collector collectorPtr(
-                new (*d_allocator_p) COLLECTOR(d_defaultCollector.metricId()),
-                d_allocator_p);
+                            new (*d_allocator_p) COLLECTOR(
+                                               d_defaultCollector.metricId(),
+                                               d_allocator_p),
+                            d_allocator_p);
     d_addedCollectors.insert(collectorPtr);
     return collectorPtr;
 }
@@ -412,6 +434,131 @@ CollectorRepository_MetricCollectors::metricId() const
     return d_collectors.metricId();
 }
 
+                    // ===================================
+                    // class CollectorRepository_Histogram
+                    // ===================================
+
+class CollectorRepository_Histogram {
+    // This implementation class holds the histogram collector for a single
+    // metric, together with the ids of the quantile metrics published for
+    // it.
+
+    // DATA
+    HistogramCollector d_collector;  // histogram collector
+
+    MetricId           d_quantileIds[k_NUM_QUANTILE_METRICS];
+                                     // ids of the quantile metrics,
+                                     // corresponding to 'k_QUANTILE_METRICS'
+
+    // NOT IMPLEMENTED
+    CollectorRepository_Histogram(const CollectorRepository_Histogram&);
+    CollectorRepository_Histogram& operator=(
+                                        const CollectorRepository_Histogram&);
+
+  public:
+    // PUBLIC TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CollectorRepository_Histogram,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    CollectorRepository_Histogram(
+                               const MetricId&     metricId,
+                               int                 precision,
+                               bsls::Types::Int64  highestTrackableValue,
+                               const MetricId     *quantileIds,
+                               bslma::Allocator   *basicAllocator = 0);
+        // Create a 'CollectorRepository_Histogram' object holding a histogram
+        // collector for the specified 'metricId' having the specified
+        // 'precision' and 'highestTrackableValue', and the specified
+        // 'quantileIds', an array of 'k_NUM_QUANTILE_METRICS' ids.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    // MANIPULATORS
+    HistogramCollector *collector();
+        // Return the address of the modifiable histogram collector.
+
+    void collect(bsl::vector<MetricRecord> *records,
+                 bool                       resetFlag,
+                 bslma::Allocator          *allocator);
+        // Append to the specified 'records' a record describing the count,
+        // total, minimum, and maximum of the values collected by the
+        // histogram collector, followed by a record for each quantile metric,
+        // and, if the specified 'resetFlag' is 'true', reset the collector.
+        // Use the specified 'allocator' to supply temporary memory.
+};
+
+                    // -----------------------------------
+                    // class CollectorRepository_Histogram
+                    // -----------------------------------
+
+// CREATORS
+CollectorRepository_Histogram::CollectorRepository_Histogram(
+                                   const MetricId&     metricId,
+                                   int                 precision,
+                                   bsls::Types::Int64  highestTrackableValue,
+                                   const MetricId     *quantileIds,
+                                   bslma::Allocator   *basicAllocator)
+: d_collector(metricId, precision, highestTrackableValue, basicAllocator)
+{
+    for (int i = 0; i < k_NUM_QUANTILE_METRICS; ++i) {
+        d_quantileIds[i] = quantileIds[i];
+    }
+}
+
+// MANIPULATORS
+inline
+HistogramCollector *CollectorRepository_Histogram::collector()
+{
+    return &d_collector;
+}
+
+void CollectorRepository_Histogram::collect(
+                                   bsl::vector<MetricRecord> *records,
+                                   bool                       resetFlag,
+                                   bslma::Allocator          *allocator)
+{
+    Histogram histogram(d_collector.precision(),
+                        d_collector.highestTrackableValue(),
+                        allocator);
+    if (resetFlag) {
+        d_collector.loadAndReset(&histogram);
+    }
+    else {
+        d_collector.load(&histogram);
+    }
+
+    if (0 == histogram.count()) {
+        records->push_back(MetricRecord(d_collector.metricId()));
+        for (int i = 0; i < k_NUM_QUANTILE_METRICS; ++i) {
+            records->push_back(MetricRecord(d_quantileIds[i]));
+        }
+        return;                                                       // RETURN
+    }
+
+    const int count = static_cast<int>(
+                   bsl::min(histogram.count(),
+                            static_cast<bsls::Types::Int64>(INT_MAX)));
+
+    records->push_back(MetricRecord(d_collector.metricId(),
+                                    count,
+                                    histogram.total(),
+                                    static_cast<double>(histogram.min()),
+                                    static_cast<double>(histogram.max())));
+
+    for (int i = 0; i < k_NUM_QUANTILE_METRICS; ++i) {
+        const double value = static_cast<double>(
+             histogram.valueAtPercentile(k_QUANTILE_METRICS[i].d_percentile));
+
+        records->push_back(MetricRecord(d_quantileIds[i],
+                                        count,
+                                        value * count,
+                                        value,
+                                        value));
+    }
+}
+
                          // -------------------------
                          // class CollectorRepository
                          // -------------------------
@@ -446,6 +593,27 @@ CollectorRepository::getMetricCollectors(const MetricId& metricId)
     return *cIt->second.get();
 }
 
+void CollectorRepository::collectHistograms(
+                                    bsl::vector<MetricRecord> *records,
+                                    const Category            *category,
+                                    bool                       resetFlag)
+{
+    CategorizedHistograms::iterator catIt =
+                                         d_histogramCategories.find(category);
+    if (catIt != d_histogramCategories.end()) {
+        bsl::vector<CollectorRepository_Histogram *>& histograms =
+                                                                 catIt->second;
+        records->reserve(records->size() +
+                         histograms.size() * (k_NUM_QUANTILE_METRICS + 1));
+
+        bsl::vector<CollectorRepository_Histogram *>::iterator it =
+                                                           histograms.begin();
+        for (; it != histograms.end(); ++it) {
+            (*it)->collect(records, resetFlag, d_allocator_p);
+        }
+    }
+}
+
 // MANIPULATORS
 void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
                                           const Category            *category)
@@ -468,6 +636,8 @@ void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
             records->push_back(record);
         }
     }
+
+    collectHistograms(records, category, true);
 }
 
 void CollectorRepository::collect(bsl::vector<MetricRecord> *records,
@@ -492,6 +662,8 @@ void CollectorRepository::collect(bsl::vector<MetricRecord> *records,
             records->push_back(record);
         }
     }
+
+    collectHistograms(records, category, false);
 }
 
 Collector *CollectorRepository::getDefaultCollector(const MetricId& metricId)
@@ -545,6 +717,60 @@ CollectorRepository::addIntegerCollector(const MetricId& metricId)
     return getMetricCollectors(metricId).intCollectors().addCollector();
 }
 
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                   const MetricId&     metricId,
+                                   int                 precision,
+                                   bsls::Types::Int64  highestTrackableValue)
+{
+    BSLS_ASSERT(metricId.isValid());
+
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Histograms::iterator it = d_histograms.find(metricId);
+        if (it != d_histograms.end()) {
+            return it->second->collector();                           // RETURN
+        }
+    }
+
+    // Register the quantile metrics before acquiring the write lock, as the
+    // registry is independently synchronized.
+
+    const Category *category = metricId.category();
+    MetricId        quantileIds[k_NUM_QUANTILE_METRICS];
+    for (int i = 0; i < k_NUM_QUANTILE_METRICS; ++i) {
+        bsl::string name(metricId.metricName(), d_allocator_p);
+        name += k_QUANTILE_METRICS[i].d_suffix;
+
+        quantileIds[i] = d_registry_p->getId(category->name(), name.c_str());
+        d_registry_p->setPreferredPublicationType(quantileIds[i],
+                                                  PublicationType::e_MAX);
+    }
+
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    Histograms::iterator it = d_histograms.find(metricId);
+    if (it == d_histograms.end()) {
+        bsl::shared_ptr<CollectorRepository_Histogram> histogramPtr(
+                 new (*d_allocator_p) CollectorRepository_Histogram(
+                                                       metricId,
+                                                       precision,
+                                                       highestTrackableValue,
+                                                       quantileIds,
+                                                       d_allocator_p),
+                 d_allocator_p);
+
+        // Reserve memory in 'd_histogramCategories' before inserting into
+        // 'd_histograms' (see 'getMetricCollectors').
+
+        bsl::vector<CollectorRepository_Histogram *>& histograms =
+                                               d_histogramCategories[category];
+        histograms.reserve(histograms.size() + 1);
+
+        it = d_histograms.insert(bsl::make_pair(metricId, histogramPtr)).first;
+        histograms.push_back(histogramPtr.get());
+    }
+    return it->second->collector();
+}
+
 int CollectorRepository::getAddedCollectors(
                bsl::vector<bsl::shared_ptr<Collector> >         *collectors,
                bsl::vector<bsl::shared_ptr<IntegerCollector> >  *intCollectors,
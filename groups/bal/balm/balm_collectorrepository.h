@@ -18,7 +18,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balm::CollectorRepository: a repository for collectors
 //
-//@SEE_ALSO: balm_collector, balm_integercollector, balm_metricsmanager
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_histogramcollector,
+//            balm_metricsmanager
 //
 //@DESCRIPTION: This component defines a class, 'balm::CollectorRepository',
 // that serves as a repository for 'balm::Collector' and
@@ -38,6 +39,26 @@ BSLS_IDENT("$Id: $")
 // collects and returns metric records from each of the collectors in the
 // repository.
 //
+///Histogram Collectors
+///--------------------
+// The repository also manages 'balm::HistogramCollector' objects, obtained
+// using 'getDefaultHistogramCollector', that collect the distribution of a
+// metric's values so that tail quantiles can be reported.  When creating the
+// histogram collector for a metric 'M' in category 'C', the repository also
+// registers the metrics 'M.p50', 'M.p90', 'M.p99', and 'M.p999' in category
+// 'C' (having a preferred publication type of 'balm::PublicationType::e_MAX').
+// For each histogram collector in a category, 'collect' and 'collectAndReset'
+// append a record for 'M' holding the count, total, minimum, and maximum of
+// the collected values, followed by a record for each quantile metric whose
+// minimum, maximum, and average ('total / count') are the value of that
+// quantile, and whose count is the number of values collected.  Since
+// 'balm::MetricsManager' collects its records from its repository, histogram
+// collectors obtained from 'balm::MetricsManager::collectorRepository' are
+// published to every publisher, such as 'balm::StreamPublisher', registered
+// with the metrics manager.  Note that a metric having a histogram collector
+// should not also be collected by a 'balm::Collector' or
+// 'balm::IntegerCollector', as two records would then be published for it.
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -109,6 +130,8 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <balm_collector.h>
+#include <balm_histogram.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
@@ -121,6 +144,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_types.h>
+
 #include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_vector.h>
@@ -130,6 +155,7 @@ namespace balm {
 
 class Category;
 class CollectorRepository_MetricCollectors;  // defined in implementation
+class CollectorRepository_Histogram;         // defined in implementation
 
                          // =========================
                          // class CollectorRepository
@@ -164,10 +190,26 @@ class CollectorRepository {
         // that each 'MetricCollectors' instance contains all the collectors
         // for a single metric.
 
+    typedef bsl::map<MetricId, bsl::shared_ptr<CollectorRepository_Histogram> >
+                                                         Histograms;
+        // 'Histograms' is an alias for a map from a 'MetricId' object to the
+        // histogram collector (and associated quantile metric ids) for that
+        // metric.
+
+    typedef bsl::map<const Category *,
+                     bsl::vector<CollectorRepository_Histogram *> >
+                                                         CategorizedHistograms;
+        // 'CategorizedHistograms' is an alias for a map from a category to
+        // the list of histogram collectors belonging to that category.
+
     // DATA
     MetricRegistry         *d_registry_p;  // registry of ids (held, not owned)
     Collectors              d_collectors;  // collectors (owned)
     CategorizedCollectors   d_categories;  // map of category => collectors
+    Histograms              d_histograms;  // histogram collectors (owned)
+    CategorizedHistograms   d_histogramCategories;
+                                           // map of category => histogram
+                                           // collectors
     mutable bslmt::RWMutex  d_rwMutex;     // data lock
     bslma::Allocator       *d_allocator_p; // allocator (held, not owned)
 
@@ -186,6 +228,16 @@ class CollectorRepository {
         // unless the calling thread has a *write* *lock* to 'd_rwMutex' and
         // 'metricId' is valid.
 
+    void collectHistograms(bsl::vector<MetricRecord> *records,
+                           const Category            *category,
+                           bool                       resetFlag);
+        // Append to the specified 'records' the metric records (see
+        // {Histogram Collectors}) for the histogram collectors in this
+        // repository belonging to the specified 'category', and if the
+        // specified 'resetFlag' is 'true', reset those collectors.  The
+        // behavior is undefined unless the calling thread has a *read*
+        // *lock* to 'd_rwMutex'.
+
   public:
     // PUBLIC TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(CollectorRepository,
@@ -300,6 +352,43 @@ class CollectorRepository {
         // repository.  The behavior is undefined unless 'metricId' is a valid
         // id returned by the 'MetricRepository' supplied at construction.
 
+    HistogramCollector *getDefaultHistogramCollector(const char *category,
+                                                     const char *metricName);
+        // Return the address of the modifiable histogram collector identified
+        // by the specified null-terminated strings 'category' and
+        // 'metricName'.  If a histogram collector for the identified metric
+        // does not already exist in the repository, create one having
+        // 'Histogram::k_DEFAULT_PRECISION' and
+        // 'Histogram::k_DEFAULT_HIGHEST_TRACKABLE_VALUE', add it to the
+        // repository, register its quantile metrics (see {Histogram
+        // Collectors}), and return its address.  In addition, if the
+        // identified metric has not already been registered, add the
+        // identified metric to the 'metricRegistry' supplied at construction.
+        // Note that this operation is logically equivalent to:
+        //..
+        //  getDefaultHistogramCollector(registry().getId(category,
+        //                                                metricName))
+        //..
+
+    HistogramCollector *getDefaultHistogramCollector(
+                             const MetricId&    metricId,
+                             int                precision =
+                                              Histogram::k_DEFAULT_PRECISION,
+                             bsls::Types::Int64 highestTrackableValue =
+                                 Histogram::k_DEFAULT_HIGHEST_TRACKABLE_VALUE);
+        // Return the address of the modifiable histogram collector identified
+        // by the specified 'metricId'.  If a histogram collector for the
+        // identified metric does not already exist in the repository, create
+        // one having the optionally specified 'precision' and
+        // 'highestTrackableValue' (see {'balm_histogram'|Bucket Layout}), add
+        // it to the repository, register its quantile metrics (see
+        // {Histogram Collectors}), and return its address; otherwise
+        // 'precision' and 'highestTrackableValue' are ignored.  The behavior
+        // is undefined unless 'metricId' is a valid id returned by the
+        // 'MetricRepository' supplied at construction,
+        // 'Histogram::k_MIN_PRECISION <= precision', 'precision <=
+        // Histogram::k_MAX_PRECISION', and '0 < highestTrackableValue'.
+
     int getAddedCollectors(
                bsl::vector<bsl::shared_ptr<Collector> >         *collectors,
                bsl::vector<bsl::shared_ptr<IntegerCollector> >  *intCollectors,
@@ -339,6 +428,8 @@ CollectorRepository::CollectorRepository(MetricRegistry   *registry,
 : d_registry_p(registry)
 , d_collectors(basicAllocator)
 , d_categories(basicAllocator)
+, d_histograms(basicAllocator)
+, d_histogramCategories(basicAllocator)
 , d_rwMutex()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -366,6 +457,15 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
                                                           metricName));
 }
 
+inline
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultHistogramCollector(d_registry_p->getId(category,
+                                                            metricName));
+}
+
 inline
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                         const char *category,
@@ -67,6 +67,8 @@ using bsl::flush;
 // [ 2] addIntegerCollector(const MetricId&);
 // [ 2] int getAddedCollectors(v<C *> *, v<IC *> *, const MetricId&);
 // [ 2] MetricRegistry &registry();
+// [ 9] getDefaultHistogramCollector(const char *, const char *);
+// [ 9] getDefaultHistogramCollector(const MetricId&, int, Int64);
 // [ 4] void collectAndReset(v<MetricRecord> *, const Category *);
 // ACCESSORS
 // [ 2] int getAddedCollectors(v<C*> *, v<IC*> *, MetricId& ) const;
@@ -74,7 +76,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -399,7 +401,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -476,6 +478,125 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // HISTOGRAM COLLECTORS
+        //
+        // Concerns:
+        //: 1 'getDefaultHistogramCollector' returns the same collector for
+        //:   the same metric, and a distinct collector for distinct metrics.
+        //:
+        //: 2 The quantile metrics of a histogram collector are registered in
+        //:   the metric's category, with a preferred publication type of
+        //:   'e_MAX'.
+        //:
+        //: 3 'collect' and 'collectAndReset' append a record for the metric
+        //:   followed by a record for each quantile, for only the histogram
+        //:   collectors in the specified category.
+        //:
+        //: 4 'collectAndReset' resets the histogram collectors, and an empty
+        //:   histogram collector yields default records.
+        //:
+        //: 5 The configuration of the histogram collector is that supplied on
+        //:   its creation.
+        //
+        // Plan:
+        //: 1 Obtain histogram collectors in two categories, update them, and
+        //:   verify the records appended by 'collect' and 'collectAndReset'.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   getDefaultHistogramCollector(const char *, const char *);
+        //   getDefaultHistogramCollector(const MetricId&, int, Int64);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "HISTOGRAM COLLECTORS" << endl
+                                  << "====================" << endl;
+
+        typedef balm::PublicationType Type;
+
+        balm::MetricRegistry      registry(Z);
+        balm::CollectorRepository mX(&registry, Z);
+
+        balm::HistogramCollector *hA = mX.getDefaultHistogramCollector("A",
+                                                                       "L");
+        balm::HistogramCollector *hB = mX.getDefaultHistogramCollector(
+                                                  registry.getId("B", "L"),
+                                                  4,
+                                                  1000);
+        ASSERT(0  != hA);
+        ASSERT(0  != hB);
+        ASSERT(hA != hB);
+        ASSERT(hA == mX.getDefaultHistogramCollector("A", "L"));
+        ASSERT(hB == mX.getDefaultHistogramCollector(registry.getId("B",
+                                                                    "L")));
+
+        ASSERT(balm::Histogram::k_DEFAULT_PRECISION == hA->precision());
+        ASSERT(4                                    == hB->precision());
+        ASSERT(1000             == hB->highestTrackableValue());
+
+        const char *SUFFIXES[] = { "L.p50", "L.p90", "L.p99", "L.p999" };
+        const int   NUM_SUFFIXES = 4;
+
+        balm::MetricId ids[NUM_SUFFIXES];
+        for (int i = 0; i < NUM_SUFFIXES; ++i) {
+            ids[i] = registry.findId("A", SUFFIXES[i]);
+            ASSERTV(i, ids[i].isValid());
+            ASSERTV(i, Type::e_MAX ==
+                             ids[i].description()->preferredPublicationType());
+            ASSERTV(i, registry.findId("B", SUFFIXES[i]).isValid());
+        }
+
+        for (int i = 1; i <= 100; ++i) {
+            hA->update(i);
+            hB->update(2 * i);
+        }
+
+        const balm::Category *CAT_A = registry.getCategory("A");
+
+        bsl::vector<balm::MetricRecord> records(Z);
+        mX.collect(&records, CAT_A);
+        ASSERTV(records.size(), 1 + NUM_SUFFIXES == records.size());
+
+        mX.collectAndReset(&records, CAT_A);
+        ASSERTV(records.size(), 2 * (1 + NUM_SUFFIXES) == records.size());
+        ASSERT(bsl::equal(records.begin(),
+                          records.begin() + 1 + NUM_SUFFIXES,
+                          records.begin() + 1 + NUM_SUFFIXES));
+
+        const balm::MetricRecord& BASE = records[0];
+        ASSERT(registry.findId("A", "L") == BASE.metricId());
+        ASSERT(100                       == BASE.count());
+        ASSERT(5050                      == BASE.total());
+        ASSERT(1                         == BASE.min());
+        ASSERT(100                       == BASE.max());
+
+        const double QUANTILES[] = { 50, 90, 99, 100 };
+        for (int i = 0; i < NUM_SUFFIXES; ++i) {
+            const balm::MetricRecord& R = records[1 + i];
+            if (veryVerbose) { P(R) }
+
+            ASSERTV(i, ids[i]            == R.metricId());
+            ASSERTV(i, 100               == R.count());
+            ASSERTV(i, QUANTILES[i]      == R.min());
+            ASSERTV(i, QUANTILES[i]      == R.max());
+            ASSERTV(i, QUANTILES[i] * 100 == R.total());
+        }
+
+        records.clear();
+        mX.collectAndReset(&records, CAT_A);
+        ASSERTV(records.size(), 1 + NUM_SUFFIXES == records.size());
+        ASSERT(balm::MetricRecord(registry.findId("A", "L")) == records[0]);
+        for (int i = 0; i < NUM_SUFFIXES; ++i) {
+            ASSERTV(i, balm::MetricRecord(ids[i]) == records[1 + i]);
+        }
+
+        records.clear();
+        mX.collectAndReset(&records, registry.getCategory("B"));
+        ASSERTV(records.size(), 1 + NUM_SUFFIXES == records.size());
+        ASSERT(100 == records[0].count());
+        ASSERT(200 == records[0].max());
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -0,0 +1,106 @@
+// balm_collectorshardutil.cpp                                        -*-C++-*-
+#include <balm_collectorshardutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_collectorshardutil_cpp,"$Id$ $CSID$")
+
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Having twice as many shards as hardware threads keeps the threads that run
+// at any one time mostly on distinct shards even when more threads than
+// hardware threads update a collector over its lifetime.  Round-robin
+// assignment through a thread-local variable gives perfectly spread shards for
+// up to 'numShards()' threads at the cost of a single thread-local load per
+// call.  Where thread-local storage is unavailable, a
+// multiplicative hash of the thread id is used instead; the raw id cannot be
+// used directly since on many platforms it is an aligned address whose low
+// bits are all zero.
+
+namespace BloombergLP {
+namespace {
+
+bsls::AtomicOperations::AtomicTypes::Int g_nextShardIndex = { 0 };
+    // index to be assigned to the next thread calling 'shardIndex'
+
+bsls::AtomicOperations::AtomicTypes::Int g_numShards = { 0 };
+    // number of shards per collector, or 0 if not yet computed
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(int, g_threadShardIndex, -1);
+    // shard index of the current thread, or -1 if not yet assigned
+#endif
+
+}  // close unnamed namespace
+
+namespace balm {
+
+                          // -------------------------
+                          // struct CollectorShardUtil
+                          // -------------------------
+
+// CLASS METHODS
+int CollectorShardUtil::numShards()
+{
+    int result = bsls::AtomicOperations::getIntRelaxed(&g_numShards);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == result)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Concurrent first calls compute, and store, the same value.
+
+        const unsigned int numThreads =
+                                     bslmt::ThreadUtil::hardwareConcurrency();
+
+        result = 1;
+        while (result < k_MAX_NUM_SHARDS
+            && static_cast<unsigned int>(result) < 2 * numThreads) {
+            result *= 2;
+        }
+        bsls::AtomicOperations::setIntRelaxed(&g_numShards, result);
+    }
+    return result;
+}
+
+int CollectorShardUtil::shardIndex()
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    int index = g_threadShardIndex;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 > index)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        index = bsls::AtomicOperations::addIntNvRelaxed(&g_nextShardIndex, 1)
+              & (numShards() - 1);
+        g_threadShardIndex = index;
+    }
+    return index;
+#else
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                   * 0x9E3779B97F4A7C15ULL;
+    return static_cast<int>(hash >> 32) & (numShards() - 1);
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
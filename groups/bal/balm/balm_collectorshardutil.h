@@ -0,0 +1,113 @@
+// balm_collectorshardutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_COLLECTORSHARDUTIL
+#define INCLUDED_BALM_COLLECTORSHARDUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a utility assigning threads to collector shards.
+//
+//@CLASSES:
+//   balm::CollectorShardUtil: namespace for collector sharding utilities
+//
+//@SEE_ALSO: balm_collector, balm_integercollector
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'balm::CollectorShardUtil', used by 'balm::Collector' and
+// 'balm::IntegerCollector' to spread the state of a collector over several
+// cache-line-sized *shards*, so that threads updating the same collector
+// concurrently do not contend for a single lock or cache line.  The number of
+// shards, returned by 'numShards', follows the number of hardware threads: it
+// is the smallest power of 2 that is at least twice that number, but no more
+// than 'k_MAX_NUM_SHARDS'.  The 'shardIndex' function returns the shard to be
+// used by the calling thread.  On platforms supporting thread-local storage,
+// threads are assigned shards in round-robin order on their first call, so
+// that up to 'numShards()' threads use distinct shards; otherwise, the shard
+// is derived from a hash of the thread id.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharding a Counter
+///- - - - - - - - - - - - - - -
+// Suppose we want a counter that many threads can increment with little
+// contention.  First, we define a type holding one shard of the counter,
+// padded to 'k_SHARD_SIZE' bytes:
+//..
+//  struct CounterShard {
+//      bsls::AtomicInt64 d_count;
+//      char              d_pad[balm::CollectorShardUtil::k_SHARD_SIZE -
+//                                                sizeof(bsls::AtomicInt64)];
+//  };
+//
+//  CounterShard shards[balm::CollectorShardUtil::k_MAX_NUM_SHARDS];
+//..
+// Then, each thread increments the shard selected by 'shardIndex':
+//..
+//  shards[balm::CollectorShardUtil::shardIndex()].d_count.addRelaxed(1);
+//..
+// Finally, the value of the counter is the sum over all shards in use:
+//..
+//  bsls::Types::Int64 total = 0;
+//  for (int i = 0; i < balm::CollectorShardUtil::numShards(); ++i) {
+//      total += shards[i].d_count.loadRelaxed();
+//  }
+//  assert(1 == total);
+//..
+
+#include <balscm_version.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                          // =========================
+                          // struct CollectorShardUtil
+                          // =========================
+
+struct CollectorShardUtil {
+    // This 'struct' provides a namespace for utilities used to shard the
+    // state of a collector across threads.
+
+    // CONSTANTS
+    enum {
+        k_MAX_NUM_SHARDS = 64,  // maximum number of shards per collector (a
+                                // power of 2)
+
+        k_SHARD_SIZE     = 64   // size, in bytes, to which each shard is
+                                // padded and aligned (the cache-line size)
+    };
+
+    // CLASS METHODS
+    static int numShards();
+        // Return the number of shards per collector: the smallest power of 2
+        // that is at least twice the number of hardware threads, but no more
+        // than 'k_MAX_NUM_SHARDS'.  Note that the returned value is the same
+        // for all calls made in a process.
+
+    static int shardIndex();
+        // Return the index, in the range '[0 .. numShards())', of the shard
+        // to be used by the calling thread.  Note that the returned value is
+        // the same for all calls made by a given thread.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
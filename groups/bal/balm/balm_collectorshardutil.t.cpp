@@ -0,0 +1,312 @@
+// balm_collectorshardutil.t.cpp                                      -*-C++-*-
+#include <balm_collectorshardutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility returning the collector shard to be
+// used by the calling thread.  We verify that the returned index is in range,
+// is stable for a given thread, and, where thread-local storage is available,
+// that up to 'numShards()' threads are assigned distinct shards.  We also
+// verify that the number of shards follows the number of hardware threads.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] int numShards();
+// [ 1] int shardIndex();
+// ----------------------------------------------------------------------------
+// [ 2] MULTI-THREADED SHARD ASSIGNMENT
+// [ 3] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::CollectorShardUtil Util;
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+void recordShardIndex(int *result, bslmt::Barrier *barrier)
+    // Wait on the specified 'barrier', load into the specified 'result' the
+    // shard index of the calling thread, and wait on 'barrier' again so that
+    // all threads exist simultaneously.
+{
+    barrier->wait();
+    *result = Util::shardIndex();
+    ASSERT(*result == Util::shardIndex());
+    barrier->wait();
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharding a Counter
+///- - - - - - - - - - - - - - -
+// Suppose we want a counter that many threads can increment with little
+// contention.  First, we define a type holding one shard of the counter,
+// padded to 'k_SHARD_SIZE' bytes:
+//..
+    struct CounterShard {
+        bsls::AtomicInt64 d_count;
+        char              d_pad[balm::CollectorShardUtil::k_SHARD_SIZE -
+                                                  sizeof(bsls::AtomicInt64)];
+    };
+
+    CounterShard shards[balm::CollectorShardUtil::k_MAX_NUM_SHARDS];
+//..
+// Then, each thread increments the shard selected by 'shardIndex':
+//..
+    shards[balm::CollectorShardUtil::shardIndex()].d_count.addRelaxed(1);
+//..
+// Finally, the value of the counter is the sum over all shards in use:
+//..
+    bsls::Types::Int64 total = 0;
+    for (int i = 0; i < balm::CollectorShardUtil::numShards(); ++i) {
+        total += shards[i].d_count.loadRelaxed();
+    }
+    ASSERT(1 == total);
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MULTI-THREADED SHARD ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 Each thread obtains a shard index in range that does not change
+        //:   over the lifetime of the thread.
+        //:
+        //: 2 When thread-local storage is available, 'numShards()'
+        //:   simultaneously running threads that call 'shardIndex' for the
+        //:   first time are assigned distinct shards.
+        //
+        // Plan:
+        //: 1 Create 'numShards()' threads that each record their shard index
+        //:   twice.  Verify the recorded indices are in range, and, when
+        //:   'BSLMT_THREAD_LOCAL_VARIABLE' is defined, that every shard is
+        //:   used exactly once.  (C-1..2)
+        //
+        // Testing:
+        //   MULTI-THREADED SHARD ASSIGNMENT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MULTI-THREADED SHARD ASSIGNMENT" << endl
+                          << "===============================" << endl;
+
+        const int NUM_SHARDS  = Util::numShards();
+        const int NUM_THREADS = NUM_SHARDS;
+
+        bsl::vector<int>   results(NUM_THREADS, -1);
+        bslmt::Barrier     barrier(NUM_THREADS);
+        bslmt::ThreadGroup threadGroup;
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            bsl::function<void()> job = bdlf::BindUtil::bind(
+                                                             &recordShardIndex,
+                                                             &results[i],
+                                                             &barrier);
+            ASSERT(0 == threadGroup.addThread(job));
+        }
+        threadGroup.joinAll();
+
+        bsl::vector<int> counts(NUM_SHARDS, 0);
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            if (veryVerbose) { P_(i) P(results[i]) }
+
+            ASSERTV(i, results[i], 0 <= results[i]);
+            ASSERTV(i, results[i], NUM_SHARDS > results[i]);
+
+            if (0 <= results[i] && NUM_SHARDS > results[i]) {
+                ++counts[results[i]];
+            }
+        }
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+        for (int i = 0; i < NUM_SHARDS; ++i) {
+            ASSERTV(i, counts[i], 1 == counts[i]);
+        }
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 'numShards' returns a power of 2 that is no more than
+        //:   'k_MAX_NUM_SHARDS', and that is at least twice the number of
+        //:   hardware threads unless it is 'k_MAX_NUM_SHARDS'.
+        //:
+        //: 2 'numShards' returns the same value on every call.
+        //:
+        //: 3 'shardIndex' returns a value in '[0 .. numShards())'.
+        //:
+        //: 4 'shardIndex' returns the same value on every call made by a
+        //:   given thread.
+        //
+        // Plan:
+        //: 1 Verify the constants and the result of 'numShards' against
+        //:   'bslmt::ThreadUtil::hardwareConcurrency', then call 'numShards'
+        //:   and 'shardIndex' repeatedly and verify the results.  (C-1..4)
+        //
+        // Testing:
+        //   int numShards();
+        //   int shardIndex();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ASSERT(0 <  Util::k_MAX_NUM_SHARDS);
+        ASSERT(0 == (Util::k_MAX_NUM_SHARDS & (Util::k_MAX_NUM_SHARDS - 1)));
+        ASSERT(0 <  Util::k_SHARD_SIZE);
+
+        const int NUM_SHARDS  = Util::numShards();
+        const int NUM_THREADS = static_cast<int>(
+                                     bslmt::ThreadUtil::hardwareConcurrency());
+        if (veryVerbose) { P_(NUM_THREADS) P(NUM_SHARDS) }
+
+        ASSERTV(NUM_SHARDS, 0 <  NUM_SHARDS);
+        ASSERTV(NUM_SHARDS, 0 == (NUM_SHARDS & (NUM_SHARDS - 1)));
+        ASSERTV(NUM_SHARDS, Util::k_MAX_NUM_SHARDS >= NUM_SHARDS);
+        ASSERTV(NUM_THREADS, NUM_SHARDS, Util::k_MAX_NUM_SHARDS == NUM_SHARDS
+                                       || 2 * NUM_THREADS <= NUM_SHARDS);
+        ASSERTV(NUM_THREADS, NUM_SHARDS, 1 == NUM_SHARDS
+                                       || 2 * NUM_THREADS > NUM_SHARDS / 2);
+
+        const int INDEX = Util::shardIndex();
+        if (veryVerbose) { P(INDEX) }
+
+        ASSERTV(INDEX, 0 <= INDEX);
+        ASSERTV(INDEX, NUM_SHARDS > INDEX);
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, NUM_SHARDS == Util::numShards());
+            ASSERTV(i, INDEX      == Util::shardIndex());
+        }
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
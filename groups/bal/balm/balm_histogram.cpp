@@ -0,0 +1,324 @@
+// balm_histogram.cpp                                                 -*-C++-*-
+#include <balm_histogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogram_cpp,"$Id$ $CSID$")
+
+#include <bslim_printer.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_ostream.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// With a precision 'p', let 'S = 2^p' and 'H = S / 2'.  Buckets
+// '[0 .. S)' hold the values '[0 .. S)' exactly.  A value 'v >= S' whose most
+// significant set bit is at position 'm' is recorded by keeping its 'p' most
+// significant bits, 'sub = v >> (m - p + 1)', which lies in '[H .. S)'; each
+// value of 'shift = m - p + 1' ('1, 2, ...') therefore contributes 'H'
+// buckets, and the bucket index is 'S + (shift - 1) * H + (sub - H)'.  Both
+// 'bucketIndex' and its inverses are branch-light and constant-time.
+
+namespace BloombergLP {
+namespace balm {
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// PUBLIC CONSTANTS
+const bsls::Types::Int64 Histogram::k_DEFAULT_HIGHEST_TRACKABLE_VALUE =
+                                            3600LL * 1000LL * 1000LL * 1000LL;
+
+// CLASS METHODS
+bsls::Types::Int64 Histogram::bucketHighestValue(int index, int precision)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(k_MIN_PRECISION <= precision);
+    BSLS_ASSERT(precision       <= k_MAX_PRECISION);
+
+    const int size = 1 << precision;
+    if (index < size) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift = (index - size) / (size >> 1) + 1;
+    return bucketLowestValue(index, precision) + (1LL << shift) - 1;
+}
+
+bsls::Types::Int64 Histogram::bucketLowestValue(int index, int precision)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(k_MIN_PRECISION <= precision);
+    BSLS_ASSERT(precision       <= k_MAX_PRECISION);
+
+    const int size = 1 << precision;
+    if (index < size) {
+        return index;                                                 // RETURN
+    }
+
+    const int half  = size >> 1;
+    const int shift = (index - size) / half + 1;
+    const int sub   = (index - size) % half + half;
+
+    return static_cast<bsls::Types::Int64>(sub) << shift;
+}
+
+int Histogram::numBuckets(int                precision,
+                          bsls::Types::Int64 highestTrackableValue)
+{
+    BSLS_ASSERT(0 < highestTrackableValue);
+
+    return bucketIndex(highestTrackableValue, precision) + 1;
+}
+
+// CREATORS
+Histogram::Histogram(bslma::Allocator *basicAllocator)
+: d_precision(k_DEFAULT_PRECISION)
+, d_highestTrackableValue(k_DEFAULT_HIGHEST_TRACKABLE_VALUE)
+, d_counts(numBuckets(k_DEFAULT_PRECISION, k_DEFAULT_HIGHEST_TRACKABLE_VALUE),
+           0,
+           basicAllocator)
+, d_count(0)
+, d_total(0.0)
+, d_min(0)
+, d_max(0)
+{
+}
+
+Histogram::Histogram(int                 precision,
+                     bsls::Types::Int64  highestTrackableValue,
+                     bslma::Allocator   *basicAllocator)
+: d_precision(precision)
+, d_highestTrackableValue(highestTrackableValue)
+, d_counts(numBuckets(precision, highestTrackableValue), 0, basicAllocator)
+, d_count(0)
+, d_total(0.0)
+, d_min(0)
+, d_max(0)
+{
+    BSLS_ASSERT(k_MIN_PRECISION <= precision);
+    BSLS_ASSERT(precision       <= k_MAX_PRECISION);
+    BSLS_ASSERT(0 < highestTrackableValue);
+}
+
+Histogram::Histogram(const Histogram&  original,
+                     bslma::Allocator *basicAllocator)
+: d_precision(original.d_precision)
+, d_highestTrackableValue(original.d_highestTrackableValue)
+, d_counts(original.d_counts, basicAllocator)
+, d_count(original.d_count)
+, d_total(original.d_total)
+, d_min(original.d_min)
+, d_max(original.d_max)
+{
+}
+
+// MANIPULATORS
+Histogram& Histogram::operator=(const Histogram& rhs)
+{
+    d_precision             = rhs.d_precision;
+    d_highestTrackableValue = rhs.d_highestTrackableValue;
+    d_counts                = rhs.d_counts;
+    d_count                 = rhs.d_count;
+    d_total                 = rhs.d_total;
+    d_min                   = rhs.d_min;
+    d_max                   = rhs.d_max;
+    return *this;
+}
+
+void Histogram::addBucketCount(int index, bsls::Types::Int64 count)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBuckets());
+    BSLS_ASSERT(0 <= count);
+
+    if (0 == count) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Int64 lowest  = bucketLowestValue(index, d_precision);
+    const bsls::Types::Int64 highest = bucketHighestValue(index, d_precision);
+
+    d_counts[index] += count;
+    if (0 == d_count) {
+        d_min = lowest;
+        d_max = highest;
+    }
+    else {
+        d_min = bsl::min(d_min, lowest);
+        d_max = bsl::max(d_max, highest);
+    }
+    d_count += count;
+}
+
+void Histogram::merge(const Histogram& other)
+{
+    if (0 == other.d_count) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Int64 count = d_count;
+    const double             total = d_total;
+    const bsls::Types::Int64 min   = d_min;
+    const bsls::Types::Int64 max   = d_max;
+
+    const int last   = numBuckets() - 1;
+    const int others = other.numBuckets();
+
+    if (d_precision == other.d_precision) {
+        for (int i = 0; i < others; ++i) {
+            d_counts[bsl::min(i, last)] += other.d_counts[i];
+        }
+    }
+    else {
+        for (int i = 0; i < others; ++i) {
+            if (0 != other.d_counts[i]) {
+                const int index = bucketIndex(
+                                    bucketHighestValue(i, other.d_precision),
+                                    d_precision);
+                d_counts[bsl::min(index, last)] += other.d_counts[i];
+            }
+        }
+    }
+
+    d_count = count + other.d_count;
+    d_total = total + other.d_total;
+    d_min   = 0 < count ? bsl::min(min, other.d_min) : other.d_min;
+    d_max   = 0 < count ? bsl::max(max, other.d_max) : other.d_max;
+}
+
+void Histogram::record(bsls::Types::Int64 value, bsls::Types::Int64 count)
+{
+    BSLS_ASSERT(0 <= count);
+
+    if (0 == count) {
+        return;                                                       // RETURN
+    }
+
+    if (value < 0) {
+        value = 0;
+    }
+
+    const int index = bsl::min(bucketIndex(value, d_precision),
+                               numBuckets() - 1);
+
+    d_counts[index] += count;
+    d_total         += static_cast<double>(value) *
+                                                   static_cast<double>(count);
+    if (0 == d_count) {
+        d_min = value;
+        d_max = value;
+    }
+    else {
+        d_min = bsl::min(d_min, value);
+        d_max = bsl::max(d_max, value);
+    }
+    d_count += count;
+}
+
+void Histogram::reset()
+{
+    bsl::fill(d_counts.begin(), d_counts.end(), 0);
+    d_count = 0;
+    d_total = 0.0;
+    d_min   = 0;
+    d_max   = 0;
+}
+
+void Histogram::setTotalMinMax(double             total,
+                               bsls::Types::Int64 min,
+                               bsls::Types::Int64 max)
+{
+    BSLS_ASSERT(0 < d_count);
+    BSLS_ASSERT(min <= max);
+
+    d_total = total;
+    d_min   = min;
+    d_max   = max;
+}
+
+// ACCESSORS
+bsls::Types::Int64 Histogram::valueAtPercentile(double percentile) const
+{
+    BSLS_ASSERT(0.0 <= percentile);
+    BSLS_ASSERT(percentile <= 100.0);
+
+    if (0 == d_count) {
+        return 0;                                                     // RETURN
+    }
+
+    bsls::Types::Int64 rank = static_cast<bsls::Types::Int64>(
+              bsl::ceil(percentile * static_cast<double>(d_count) / 100.0));
+    rank = bsl::max(rank, 1LL);
+    rank = bsl::min(rank, d_count);
+
+    bsls::Types::Int64 cumulative = 0;
+    const int          num        = numBuckets();
+    for (int i = 0; i < num; ++i) {
+        cumulative += d_counts[i];
+        if (rank <= cumulative) {
+            const bsls::Types::Int64 value = bucketHighestValue(i,
+                                                                d_precision);
+            return bsl::max(d_min, bsl::min(value, d_max));           // RETURN
+        }
+    }
+    return d_max;
+}
+
+bsl::ostream& Histogram::print(bsl::ostream& stream,
+                               int           level,
+                               int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("count", d_count);
+    printer.printAttribute("min",   min());
+    printer.printAttribute("mean",  mean());
+    printer.printAttribute("max",   max());
+    printer.printAttribute("p50",   valueAtPercentile(50.0));
+    printer.printAttribute("p90",   valueAtPercentile(90.0));
+    printer.printAttribute("p99",   valueAtPercentile(99.0));
+    printer.printAttribute("p999",  valueAtPercentile(99.9));
+    printer.end();
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool balm::operator==(const Histogram& lhs, const Histogram& rhs)
+{
+    return lhs.d_precision             == rhs.d_precision
+        && lhs.d_highestTrackableValue == rhs.d_highestTrackableValue
+        && lhs.d_count                 == rhs.d_count
+        && lhs.d_total                 == rhs.d_total
+        && lhs.min()                   == rhs.min()
+        && lhs.max()                   == rhs.max()
+        && lhs.d_counts                == rhs.d_counts;
+}
+
+bsl::ostream& balm::operator<<(bsl::ostream&    stream,
+                              const Histogram& histogram)
+{
+    return histogram.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,478 @@
+// balm_histogram.h                                                   -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAM
+#define INCLUDED_BALM_HISTOGRAM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mergeable log-linear histogram of integral values.
+//
+//@CLASSES:
+//   balm::Histogram: value-semantic log-linear (HDR-style) histogram
+//
+//@SEE_ALSO: balm_histogramcollector, balm_collectorrepository
+//
+//@DESCRIPTION: This component provides a value-semantic class,
+// 'balm::Histogram', that records the distribution of a set of non-negative
+// integral values (typically latencies, in some unit such as nanoseconds) in
+// a fixed set of *log-linear* buckets, in the manner of an HDR histogram.  In
+// addition to the bucket counts, a histogram maintains the exact count,
+// total, minimum, and maximum of the recorded values.  Histograms having the
+// same configuration can be combined cheaply using 'merge', making them
+// suitable for aggregating snapshots collected over different periods or
+// from different sources, and approximate quantiles (e.g., the 99th or 99.9th
+// percentile) can be computed using 'valueAtPercentile'.
+//
+///Bucket Layout
+///-------------
+// A histogram is configured with a 'precision', 'p', and a
+// 'highestTrackableValue'.  Values less than '2^p' are recorded exactly, each
+// in its own bucket.  Larger values are recorded in buckets whose width
+// doubles with each power of two, such that every bucket of values in
+// '[2^k .. 2^(k+1))' (for 'k >= p') has width '2^(k - p + 1)'.  Therefore,
+// the value reported for any recorded value 'v' (the highest value in the
+// bucket holding 'v') differs from 'v' by at most 'v / 2^(p - 1)'; for the
+// default precision of 7, the relative error is less than 1.6%.
+//
+// The number of buckets is determined by the configuration, and is
+// independent of the number of values recorded: it is one more than the index
+// of the bucket holding 'highestTrackableValue', and is bounded by:
+//..
+//  2^p + (floor(log2(highestTrackableValue)) - p + 1) * 2^(p-1)
+//..
+// which, for the default configuration (a 'highestTrackableValue' of one hour
+// in nanoseconds), is 2345 buckets.  Values greater than the
+// 'highestTrackableValue' are recorded in the last bucket (although they are
+// still reflected exactly in the maximum and total), and negative values are
+// recorded as 0.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Computing Tail Latency
+///- - - - - - - - - - - - - - - - -
+// Suppose we have measured the latency, in microseconds, of a number of
+// requests, and we want to know the median and 99th-percentile latency.
+// First, we create a histogram with the default configuration:
+//..
+//  balm::Histogram histogram;
+//..
+// Then, we record the latency of 1000 requests: 990 requests taking between
+// 100us and 199us, and 10 requests taking 5000us:
+//..
+//  for (int i = 0; i < 990; ++i) {
+//      histogram.record(100 + i % 100);
+//  }
+//  histogram.record(5000, 10);
+//
+//  assert(1000 == histogram.count());
+//  assert(100  == histogram.min());
+//  assert(5000 == histogram.max());
+//..
+// Now, we obtain the median and 99th percentile.  Note that the values
+// returned are accurate to within the precision of the histogram:
+//..
+//  const bsls::Types::Int64 p50 = histogram.valueAtPercentile(50.0);
+//  const bsls::Types::Int64 p99 = histogram.valueAtPercentile(99.0);
+//
+//  assert(149 <= p50 && p50 <= 151);
+//  assert(198 <= p99 && p99 <= 199);
+//..
+// Finally, we merge a second histogram, recorded over a later period, into
+// the first, and observe that the 99.9th percentile reflects the slow
+// requests:
+//..
+//  balm::Histogram later;
+//  later.record(150, 1000);
+//
+//  histogram.merge(later);
+//
+//  assert(2000 == histogram.count());
+//  assert(5000 == histogram.valueAtPercentile(99.9));
+//..
+
+#include <balscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                              // ===============
+                              // class Histogram
+                              // ===============
+
+class Histogram {
+    // This value-semantic class records the distribution of a set of
+    // non-negative integral values in log-linear buckets (see {Bucket
+    // Layout}), as well as the exact count, total, minimum, and maximum of
+    // those values.  Two histograms have the same value if they have the same
+    // configuration, the same bucket counts, and the same count, total,
+    // minimum, and maximum.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MIN_PRECISION     = 2,   // minimum supported precision
+
+        k_MAX_PRECISION     = 16,  // maximum supported precision
+
+        k_DEFAULT_PRECISION = 7    // default precision (relative error less
+                                   // than 1.6%)
+    };
+
+    static const bsls::Types::Int64 k_DEFAULT_HIGHEST_TRACKABLE_VALUE;
+        // default highest trackable value (one hour, in nanoseconds)
+
+  private:
+    // DATA
+    int                             d_precision;  // number of significant
+                                                  // bits per bucket
+
+    bsls::Types::Int64              d_highestTrackableValue;
+                                                  // highest value recorded
+                                                  // in its own bucket
+
+    bsl::vector<bsls::Types::Int64> d_counts;     // count per bucket
+
+    bsls::Types::Int64              d_count;      // total count of values
+
+    double                          d_total;      // sum of values
+
+    bsls::Types::Int64              d_min;        // minimum value (valid
+                                                  // only if '0 < d_count')
+
+    bsls::Types::Int64              d_max;        // maximum value (valid
+                                                  // only if '0 < d_count')
+
+    // FRIENDS
+    friend bool operator==(const Histogram&, const Histogram&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Histogram, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int bucketIndex(bsls::Types::Int64 value, int precision);
+        // Return the index of the bucket holding the specified 'value' in a
+        // histogram having the specified 'precision', ignoring any highest
+        // trackable value.  A negative 'value' is treated as 0.  The behavior
+        // is undefined unless
+        // 'k_MIN_PRECISION <= precision <= k_MAX_PRECISION'.
+
+    static bsls::Types::Int64 bucketHighestValue(int index, int precision);
+        // Return the highest value held by the bucket at the specified
+        // 'index' in a histogram having the specified 'precision'.  The
+        // behavior is undefined unless '0 <= index', and
+        // 'k_MIN_PRECISION <= precision <= k_MAX_PRECISION'.
+
+    static bsls::Types::Int64 bucketLowestValue(int index, int precision);
+        // Return the lowest value held by the bucket at the specified 'index'
+        // in a histogram having the specified 'precision'.  The behavior is
+        // undefined unless '0 <= index', and
+        // 'k_MIN_PRECISION <= precision <= k_MAX_PRECISION'.
+
+    static int numBuckets(int                precision,
+                          bsls::Types::Int64 highestTrackableValue);
+        // Return the number of buckets in a histogram having the specified
+        // 'precision' and 'highestTrackableValue'.  The behavior is undefined
+        // unless 'k_MIN_PRECISION <= precision <= k_MAX_PRECISION' and
+        // '0 < highestTrackableValue'.
+
+    // CREATORS
+    explicit Histogram(bslma::Allocator *basicAllocator = 0);
+        // Create an empty histogram having 'k_DEFAULT_PRECISION' and
+        // 'k_DEFAULT_HIGHEST_TRACKABLE_VALUE'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    Histogram(int                 precision,
+              bsls::Types::Int64  highestTrackableValue,
+              bslma::Allocator   *basicAllocator = 0);
+        // Create an empty histogram having the specified 'precision' and
+        // 'highestTrackableValue'.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'k_MIN_PRECISION <= precision <= k_MAX_PRECISION' and
+        // '0 < highestTrackableValue'.
+
+    Histogram(const Histogram&  original,
+              bslma::Allocator *basicAllocator = 0);
+        // Create a histogram having the same value as the specified
+        // 'original' histogram.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~Histogram() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    Histogram& operator=(const Histogram& rhs);
+        // Assign to this histogram the value of the specified 'rhs' histogram,
+        // and return a reference providing modifiable access to this object.
+
+    void addBucketCount(int index, bsls::Types::Int64 count);
+        // Add the specified 'count' to the bucket at the specified 'index' and
+        // to the count of this histogram, and widen the minimum and maximum
+        // of this histogram to include the bucket.  The total of this
+        // histogram is not modified.  The behavior is undefined unless
+        // '0 <= index < numBuckets()' and '0 <= count'.  Note that this
+        // operation is intended for use by collectors that maintain their own
+        // bucket counts, and that will subsequently call 'setTotalMinMax' to
+        // supply the exact statistics.
+
+    void merge(const Histogram& other);
+        // Add the values recorded by the specified 'other' histogram to this
+        // histogram.  If 'other' has the same precision as this histogram,
+        // the bucket counts are combined exactly; otherwise each bucket of
+        // 'other' is recorded as the highest value of that bucket.  In either
+        // case, the count, total, minimum, and maximum of this histogram
+        // reflect the exact values of 'other'.
+
+    void record(bsls::Types::Int64 value);
+        // Record the specified 'value' in this histogram.  A negative 'value'
+        // is recorded as 0, and a 'value' greater than
+        // 'highestTrackableValue()' is recorded in the last bucket.
+
+    void record(bsls::Types::Int64 value, bsls::Types::Int64 count);
+        // Record the specified 'value' the specified 'count' number of times
+        // in this histogram.  The behavior is undefined unless '0 <= count'.
+
+    void reset();
+        // Reset this histogram to the empty state, retaining its
+        // configuration.
+
+    void setTotalMinMax(double             total,
+                        bsls::Types::Int64 min,
+                        bsls::Types::Int64 max);
+        // Set the total, minimum, and maximum of the values recorded by this
+        // histogram to the specified 'total', 'min', and 'max', respectively.
+        // The behavior is undefined unless '0 < count()' and 'min <= max'.
+        // Note that this operation is intended to complement
+        // 'addBucketCount'.
+
+    // ACCESSORS
+    bsls::Types::Int64 bucketCount(int index) const;
+        // Return the number of values recorded in the bucket at the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < numBuckets()'.
+
+    bsls::Types::Int64 count() const;
+        // Return the number of values recorded by this histogram.
+
+    bsls::Types::Int64 highestTrackableValue() const;
+        // Return the highest value that this histogram records in its own
+        // bucket.
+
+    bsls::Types::Int64 max() const;
+        // Return the maximum value recorded by this histogram, or 0 if
+        // '0 == count()'.
+
+    double mean() const;
+        // Return the mean of the values recorded by this histogram, or 0.0 if
+        // '0 == count()'.
+
+    bsls::Types::Int64 min() const;
+        // Return the minimum value recorded by this histogram, or 0 if
+        // '0 == count()'.
+
+    int numBuckets() const;
+        // Return the number of buckets in this histogram.
+
+    int precision() const;
+        // Return the number of significant bits of the values recorded by
+        // this histogram.
+
+    double total() const;
+        // Return the sum of the values recorded by this histogram.
+
+    bsls::Types::Int64 valueAtPercentile(double percentile) const;
+        // Return the highest value of the bucket holding the value having the
+        // specified 'percentile' rank among the values recorded by this
+        // histogram, clamped to '[min() .. max()]', or 0 if '0 == count()'.
+        // The behavior is undefined unless '0.0 <= percentile <= 100.0'.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the count, minimum, mean, maximum, and a selection of
+        // percentiles of this histogram to the specified output 'stream' in a
+        // human-readable format, and return a reference to 'stream'.
+        // Optionally specify an initial indentation 'level', whose absolute
+        // value is incremented recursively for nested objects.  If 'level' is
+        // specified, optionally specify 'spacesPerLevel', whose absolute value
+        // indicates the number of spaces per indentation level for this and
+        // all of its nested objects.  If 'level' is negative, suppress
+        // indentation of the first line.  If 'spacesPerLevel' is negative,
+        // format the entire output on one line, suppressing all but the
+        // initial indentation (as governed by 'level').
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// FREE OPERATORS
+bool operator==(const Histogram& lhs, const Histogram& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms have the same
+    // value, and 'false' otherwise.  Two histograms have the same value if
+    // they have the same precision, highest trackable value, bucket counts,
+    // count, total, minimum, and maximum.
+
+bool operator!=(const Histogram& lhs, const Histogram& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms do not have
+    // the same value, and 'false' otherwise.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const Histogram& histogram);
+    // Write the value of the specified 'histogram' to the specified output
+    // 'stream' in a single-line format, and return a reference to 'stream'.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// CLASS METHODS
+inline
+int Histogram::bucketIndex(bsls::Types::Int64 value, int precision)
+{
+    BSLS_ASSERT(k_MIN_PRECISION <= precision);
+    BSLS_ASSERT(precision       <= k_MAX_PRECISION);
+
+    const bsls::Types::Uint64 v    = 0 < value
+                                   ? static_cast<bsls::Types::Uint64>(value)
+                                   : 0;
+    const bsls::Types::Uint64 size = 1ULL << precision;
+
+    if (v < size) {
+        return static_cast<int>(v);                                   // RETURN
+    }
+
+    const int msb   = 63 - bdlb::BitUtil::numLeadingUnsetBits(
+                                                static_cast<bsl::uint64_t>(v));
+    const int shift = msb - precision + 1;
+    const int half  = static_cast<int>(size >> 1);
+    const int sub   = static_cast<int>(v >> shift);
+
+    return static_cast<int>(size) + (shift - 1) * half + (sub - half);
+}
+
+// MANIPULATORS
+inline
+void Histogram::record(bsls::Types::Int64 value)
+{
+    record(value, 1);
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 Histogram::bucketCount(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBuckets());
+
+    return d_counts[index];
+}
+
+inline
+bsls::Types::Int64 Histogram::count() const
+{
+    return d_count;
+}
+
+inline
+bsls::Types::Int64 Histogram::highestTrackableValue() const
+{
+    return d_highestTrackableValue;
+}
+
+inline
+bsls::Types::Int64 Histogram::max() const
+{
+    return 0 < d_count ? d_max : 0;
+}
+
+inline
+double Histogram::mean() const
+{
+    return 0 < d_count ? d_total / static_cast<double>(d_count) : 0.0;
+}
+
+inline
+bsls::Types::Int64 Histogram::min() const
+{
+    return 0 < d_count ? d_min : 0;
+}
+
+inline
+int Histogram::numBuckets() const
+{
+    return static_cast<int>(d_counts.size());
+}
+
+inline
+int Histogram::precision() const
+{
+    return d_precision;
+}
+
+inline
+double Histogram::total() const
+{
+    return d_total;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *Histogram::allocator() const
+{
+    return d_counts.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool balm::operator!=(const Histogram& lhs, const Histogram& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,884 @@
+// balm_histogram.t.cpp                                               -*-C++-*-
+#include <balm_histogram.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic histogram.  We first verify
+// the class methods describing the bucket layout, then the basic
+// constructors, manipulators, and accessors, and finally the derived
+// operations 'valueAtPercentile', 'merge', and 'print'.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int bucketIndex(Int64 value, int precision);
+// [ 2] Int64 bucketHighestValue(int index, int precision);
+// [ 2] Int64 bucketLowestValue(int index, int precision);
+// [ 2] int numBuckets(int precision, Int64 highestTrackableValue);
+//
+// CREATORS
+// [ 3] explicit Histogram(bslma::Allocator *basicAllocator = 0);
+// [ 3] Histogram(int, Int64, bslma::Allocator *basicAllocator = 0);
+// [ 3] Histogram(const Histogram&, bslma::Allocator *basicAllocator = 0);
+//
+// MANIPULATORS
+// [ 3] Histogram& operator=(const Histogram& rhs);
+// [ 6] void addBucketCount(int index, Int64 count);
+// [ 7] void merge(const Histogram& other);
+// [ 4] void record(Int64 value);
+// [ 4] void record(Int64 value, Int64 count);
+// [ 4] void reset();
+// [ 6] void setTotalMinMax(double total, Int64 min, Int64 max);
+//
+// ACCESSORS
+// [ 4] Int64 bucketCount(int index) const;
+// [ 4] Int64 count() const;
+// [ 3] Int64 highestTrackableValue() const;
+// [ 4] Int64 max() const;
+// [ 4] double mean() const;
+// [ 4] Int64 min() const;
+// [ 3] int numBuckets() const;
+// [ 3] int precision() const;
+// [ 4] double total() const;
+// [ 5] Int64 valueAtPercentile(double percentile) const;
+// [ 8] bsl::ostream& print(bsl::ostream&, int, int) const;
+// [ 3] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const Histogram& lhs, const Histogram& rhs);
+// [ 3] bool operator!=(const Histogram& lhs, const Histogram& rhs);
+// [ 8] bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 9] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::Histogram  Obj;
+typedef bsls::Types::Int64 Int64;
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Computing Tail Latency
+///- - - - - - - - - - - - - - - - -
+// Suppose we have measured the latency, in microseconds, of a number of
+// requests, and we want to know the median and 99th-percentile latency.
+// First, we create a histogram with the default configuration:
+//..
+    balm::Histogram histogram;
+//..
+// Then, we record the latency of 1000 requests: 990 requests taking between
+// 100us and 199us, and 10 requests taking 5000us:
+//..
+    for (int i = 0; i < 990; ++i) {
+        histogram.record(100 + i % 100);
+    }
+    histogram.record(5000, 10);
+
+    ASSERT(1000 == histogram.count());
+    ASSERT(100  == histogram.min());
+    ASSERT(5000 == histogram.max());
+//..
+// Now, we obtain the median and 99th percentile.  Note that the values
+// returned are accurate to within the precision of the histogram:
+//..
+    const bsls::Types::Int64 p50 = histogram.valueAtPercentile(50.0);
+    const bsls::Types::Int64 p99 = histogram.valueAtPercentile(99.0);
+
+    ASSERT(149 <= p50 && p50 <= 151);
+    ASSERT(198 <= p99 && p99 <= 199);
+//..
+// Finally, we merge a second histogram, recorded over a later period, into
+// the first, and observe that the 99.9th percentile reflects the slow
+// requests:
+//..
+    balm::Histogram later;
+    later.record(150, 1000);
+
+    histogram.merge(later);
+
+    ASSERT(2000 == histogram.count());
+    ASSERT(5000 == histogram.valueAtPercentile(99.9));
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // PRINT AND OUTPUT OPERATOR
+        //
+        // Concerns:
+        //: 1 'print' and 'operator<<' write the count, extrema, mean, and
+        //:   percentiles of the histogram.
+        //:
+        //: 2 'operator<<' writes a single line.
+        //
+        // Plan:
+        //: 1 Print an empty and a non-empty histogram and verify the output.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream&, int, int) const;
+        //   bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINT AND OUTPUT OPERATOR" << endl
+                          << "=========================" << endl;
+
+        Obj mX; const Obj& X = mX;
+        {
+            bsl::ostringstream oss;
+            oss << X;
+            if (veryVerbose) { P(oss.str()) }
+            ASSERTV(oss.str(),
+                    "[ count = 0 min = 0 mean = 0 max = 0 p50 = 0 p90 = 0 "
+                    "p99 = 0 p999 = 0 ]" == oss.str());
+        }
+
+        for (int i = 1; i <= 100; ++i) {
+            mX.record(i);
+        }
+        {
+            bsl::ostringstream oss;
+            oss << X;
+            if (veryVerbose) { P(oss.str()) }
+            ASSERTV(oss.str(),
+                    "[ count = 100 min = 1 mean = 50.5 max = 100 p50 = 50 "
+                    "p90 = 90 p99 = 99 p999 = 100 ]" == oss.str());
+        }
+        {
+            bsl::ostringstream oss;
+            X.print(oss, 1, 2);
+            if (veryVerbose) { P(oss.str()) }
+            ASSERTV(oss.str(), bsl::string::npos != oss.str().find("\n"));
+            ASSERTV(oss.str(),
+                    bsl::string::npos != oss.str().find("p99 = 99"));
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // MERGE
+        //
+        // Concerns:
+        //: 1 Merging histograms of the same precision combines bucket counts
+        //:   exactly, and the count, total, minimum, and maximum exactly.
+        //:
+        //: 2 Merging into an empty histogram yields the merged histogram
+        //:   (given the same configuration).
+        //:
+        //: 3 Merging an empty histogram has no effect.
+        //:
+        //: 4 Merging a histogram of a different precision or highest
+        //:   trackable value records each bucket in the corresponding bucket
+        //:   of the target.
+        //:
+        //: 5 A histogram can be merged with itself.
+        //
+        // Plan:
+        //: 1 Merge histograms of various configurations and verify the
+        //:   result against a histogram recording the union of the values.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   void merge(const Histogram& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MERGE" << endl
+                          << "=====" << endl;
+
+        Obj mA; const Obj& A = mA;
+        Obj mB; const Obj& B = mB;
+        Obj mU; const Obj& U = mU;
+
+        for (Int64 v = 0; v < 100000; v += 7) {
+            mA.record(v);
+            mU.record(v);
+        }
+        for (Int64 v = 50; v < 1000000; v += 1013) {
+            mB.record(v, 2);
+            mU.record(v, 2);
+        }
+
+        {
+            Obj mX(A); const Obj& X = mX;
+            mX.merge(B);
+            ASSERT(U == X);
+        }
+        {
+            Obj mX; const Obj& X = mX;
+            mX.merge(A);
+            ASSERT(A == X);
+
+            mX.merge(Obj());
+            ASSERT(A == X);
+        }
+        {
+            Obj mX(A); const Obj& X = mX;
+            mX.merge(X);
+            ASSERT(2 * A.count() == X.count());
+            ASSERT(2 * A.total() == X.total());
+            ASSERT(A.min()       == X.min());
+            ASSERT(A.max()       == X.max());
+            for (int i = 0; i < A.numBuckets(); ++i) {
+                ASSERTV(i, 2 * A.bucketCount(i) == X.bucketCount(i));
+            }
+        }
+        {
+            // Different precision: values '< 2^4' are exact in both.
+
+            Obj mX(4, 1000); const Obj& X = mX;
+            Obj mY(8, 1000); const Obj& Y = mY;
+
+            for (int v = 0; v < 16; ++v) {
+                mY.record(v, v);
+            }
+            mY.record(500);
+
+            mX.merge(Y);
+            ASSERT(Y.count() == X.count());
+            ASSERT(Y.total() == X.total());
+            ASSERT(1         == X.min());
+            ASSERT(500       == X.max());
+            for (int v = 0; v < 16; ++v) {
+                ASSERTV(v, v == X.bucketCount(v));
+            }
+            ASSERT(1 == X.bucketCount(Obj::bucketIndex(500, 4)));
+        }
+        {
+            // Same precision, smaller highest trackable value: excess
+            // buckets are folded into the last bucket.
+
+            Obj mX(7, 1000); const Obj& X = mX;
+            mX.merge(A);
+            ASSERT(A.count() == X.count());
+            ASSERT(A.max()   == X.max());
+
+            Int64 inRange = 0;
+            for (int i = 0; i < X.numBuckets() - 1; ++i) {
+                ASSERTV(i, A.bucketCount(i) == X.bucketCount(i));
+                inRange += X.bucketCount(i);
+            }
+            ASSERT(A.count() - inRange == X.bucketCount(X.numBuckets() - 1));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'addBucketCount' AND 'setTotalMinMax'
+        //
+        // Concerns:
+        //: 1 'addBucketCount' increments the bucket and the count, and widens
+        //:   the minimum and maximum to the bucket bounds, without changing
+        //:   the total.
+        //:
+        //: 2 'setTotalMinMax' sets the total, minimum, and maximum.
+        //:
+        //: 3 Adding a zero count has no effect.
+        //:
+        //: 4 QoI: asserted precondition violations are detected.
+        //
+        // Plan:
+        //: 1 Add counts to buckets and verify the resulting state.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void addBucketCount(int index, Int64 count);
+        //   void setTotalMinMax(double total, Int64 min, Int64 max);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'addBucketCount' AND 'setTotalMinMax'" << endl
+                          << "=====================================" << endl;
+
+        Obj mX; const Obj& X = mX;
+
+        mX.addBucketCount(3, 0);
+        ASSERT(Obj() == X);
+
+        const int IDX = Obj::bucketIndex(1000, X.precision());
+        mX.addBucketCount(IDX, 5);
+        ASSERT(5 == X.count());
+        ASSERT(5 == X.bucketCount(IDX));
+        ASSERT(0 == X.total());
+        ASSERT(Obj::bucketLowestValue(IDX, X.precision())  == X.min());
+        ASSERT(Obj::bucketHighestValue(IDX, X.precision()) == X.max());
+
+        mX.addBucketCount(10, 1);
+        ASSERT(6  == X.count());
+        ASSERT(10 == X.min());
+        ASSERT(Obj::bucketHighestValue(IDX, X.precision()) == X.max());
+
+        mX.setTotalMinMax(5010.0, 10, 1000);
+        ASSERT(6      == X.count());
+        ASSERT(5010.0 == X.total());
+        ASSERT(10     == X.min());
+        ASSERT(1000   == X.max());
+        ASSERT(1000   == X.valueAtPercentile(100.0));
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mY;
+
+            ASSERT_FAIL(mY.setTotalMinMax(0.0, 0, 0));
+            ASSERT_FAIL(mY.addBucketCount(-1, 1));
+            ASSERT_FAIL(mY.addBucketCount(mY.numBuckets(), 1));
+            ASSERT_PASS(mY.addBucketCount(mY.numBuckets() - 1, 1));
+            ASSERT_FAIL(mY.addBucketCount(0, -1));
+            ASSERT_FAIL(mY.setTotalMinMax(0.0, 2, 1));
+            ASSERT_PASS(mY.setTotalMinMax(0.0, 1, 1));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'valueAtPercentile'
+        //
+        // Concerns:
+        //: 1 An empty histogram reports 0.
+        //:
+        //: 2 The reported value is the highest value of the bucket holding
+        //:   the value of the requested rank, clamped to '[min .. max]'.
+        //:
+        //: 3 Percentiles 0 and 100 report the minimum and maximum.
+        //:
+        //: 4 The relative error is bounded by the precision.
+        //:
+        //: 5 QoI: asserted precondition violations are detected.
+        //
+        // Plan:
+        //: 1 Record known distributions and verify reported percentiles.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   Int64 valueAtPercentile(double percentile) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'valueAtPercentile'" << endl
+                          << "===================" << endl;
+
+        {
+            Obj mX; const Obj& X = mX;
+            ASSERT(0 == X.valueAtPercentile(50.0));
+
+            for (int i = 1; i <= 100; ++i) {
+                mX.record(i);
+            }
+            for (int p = 1; p <= 100; ++p) {
+                ASSERTV(p, p == X.valueAtPercentile(p));
+            }
+            ASSERT(1   == X.valueAtPercentile(0.0));
+            ASSERT(100 == X.valueAtPercentile(100.0));
+        }
+        {
+            // Relative error for large values.
+
+            Obj mX; const Obj& X = mX;
+            for (Int64 v = 1000; v <= 1000000; v += 1000) {
+                mX.record(v);
+            }
+            ASSERT(1000 == X.count());
+
+            for (int p = 1; p <= 100; ++p) {
+                const Int64  EXP = p * 10000;
+                const Int64  ACT = X.valueAtPercentile(p);
+                const double ERR = static_cast<double>(ACT - EXP) /
+                                                     static_cast<double>(EXP);
+                if (veryVerbose) { P_(p) P_(EXP) P(ACT) }
+
+                ASSERTV(p, EXP, ACT, EXP <= ACT);
+                ASSERTV(p, EXP, ACT, ERR <= 1.0 / 64);
+            }
+        }
+        {
+            // Clamping to '[min .. max]'.
+
+            Obj mX; const Obj& X = mX;
+            mX.record(1000001);
+            ASSERT(1000001 == X.valueAtPercentile(50.0));
+            mX.record(1000000);
+            ASSERT(1000000 <= X.valueAtPercentile(50.0));
+            ASSERT(1000001 >= X.valueAtPercentile(50.0));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX; const Obj& X = mX;
+            ASSERT_FAIL(X.valueAtPercentile(-0.1));
+            ASSERT_PASS(X.valueAtPercentile(0.0));
+            ASSERT_PASS(X.valueAtPercentile(100.0));
+            ASSERT_FAIL(X.valueAtPercentile(100.1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'record' AND 'reset'
+        //
+        // Concerns:
+        //: 1 'record' increments the bucket holding the value, and updates
+        //:   the count, total, minimum, and maximum exactly.
+        //:
+        //: 2 Negative values are recorded as 0.
+        //:
+        //: 3 Values above the highest trackable value are recorded in the
+        //:   last bucket, but reflected exactly in the maximum and total.
+        //:
+        //: 4 Recording with a zero count has no effect.
+        //:
+        //: 5 'reset' restores the empty state but retains the configuration.
+        //:
+        //: 6 QoI: asserted precondition violations are detected.
+        //
+        // Plan:
+        //: 1 Record values and verify the accessors.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void record(Int64 value);
+        //   void record(Int64 value, Int64 count);
+        //   void reset();
+        //   Int64 bucketCount(int index) const;
+        //   Int64 count() const;
+        //   Int64 max() const;
+        //   double mean() const;
+        //   Int64 min() const;
+        //   double total() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'record' AND 'reset'" << endl
+                          << "====================" << endl;
+
+        Obj mX(7, 100000); const Obj& X = mX;
+
+        ASSERT(0   == X.count());
+        ASSERT(0.0 == X.total());
+        ASSERT(0   == X.min());
+        ASSERT(0   == X.max());
+        ASSERT(0.0 == X.mean());
+
+        mX.record(42);
+        ASSERT(1    == X.count());
+        ASSERT(42.0 == X.total());
+        ASSERT(42   == X.min());
+        ASSERT(42   == X.max());
+        ASSERT(42.0 == X.mean());
+        ASSERT(1    == X.bucketCount(42));
+
+        mX.record(1000, 3);
+        ASSERT(4      == X.count());
+        ASSERT(3042.0 == X.total());
+        ASSERT(42     == X.min());
+        ASSERT(1000   == X.max());
+        ASSERT(3      == X.bucketCount(Obj::bucketIndex(1000, 7)));
+
+        mX.record(-5);
+        ASSERT(5 == X.count());
+        ASSERT(0 == X.min());
+        ASSERT(1 == X.bucketCount(0));
+
+        mX.record(1000000000);
+        ASSERT(6          == X.count());
+        ASSERT(1000000000 == X.max());
+        ASSERT(1          == X.bucketCount(X.numBuckets() - 1));
+
+        mX.record(7, 0);
+        ASSERT(6 == X.count());
+        ASSERT(0 == X.bucketCount(7));
+
+        Int64 sum = 0;
+        for (int i = 0; i < X.numBuckets(); ++i) {
+            sum += X.bucketCount(i);
+        }
+        ASSERT(X.count() == sum);
+
+        mX.reset();
+        ASSERT(Obj(7, 100000) == X);
+        ASSERT(7              == X.precision());
+        ASSERT(100000         == X.highestTrackableValue());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(mX.record(1, -1));
+            ASSERT_PASS(mX.record(1,  0));
+            ASSERT_FAIL(X.bucketCount(-1));
+            ASSERT_FAIL(X.bucketCount(X.numBuckets()));
+            ASSERT_PASS(X.bucketCount(X.numBuckets() - 1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 The default constructor creates an empty histogram having the
+        //:   default configuration.
+        //:
+        //: 2 The value constructor creates an empty histogram having the
+        //:   specified configuration.
+        //:
+        //: 3 Memory is obtained from the supplied allocator, or the default
+        //:   allocator if none is supplied.
+        //:
+        //: 4 The copy constructor and assignment operator produce an object
+        //:   having the same value, using the appropriate allocator.
+        //:
+        //: 5 Equality considers the configuration and all recorded values.
+        //:
+        //: 6 QoI: asserted precondition violations are detected.
+        //
+        // Plan:
+        //: 1 Create, copy, and assign objects using test allocators and
+        //:   verify their value and memory use.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   explicit Histogram(bslma::Allocator *basicAllocator = 0);
+        //   Histogram(int, Int64, bslma::Allocator *basicAllocator = 0);
+        //   Histogram(const Histogram&, bslma::Allocator *basicAllocator = 0);
+        //   Histogram& operator=(const Histogram& rhs);
+        //   Int64 highestTrackableValue() const;
+        //   int numBuckets() const;
+        //   int precision() const;
+        //   bslma::Allocator *allocator() const;
+        //   bool operator==(const Histogram& lhs, const Histogram& rhs);
+        //   bool operator!=(const Histogram& lhs, const Histogram& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, ASSIGNMENT, AND EQUALITY" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        {
+            Obj mX; const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(0   <  da.numBytesInUse());
+            ASSERT(Obj::k_DEFAULT_PRECISION == X.precision());
+            ASSERT(Obj::k_DEFAULT_HIGHEST_TRACKABLE_VALUE ==
+                                                   X.highestTrackableValue());
+            ASSERT(2345 == X.numBuckets());
+            ASSERT(0    == X.count());
+        }
+        ASSERT(0 == da.numBytesInUse());
+
+        {
+            Obj mX(4, 1000, &oa); const Obj& X = mX;
+            ASSERT(&oa  == X.allocator());
+            ASSERT(0    <  oa.numBytesInUse());
+            ASSERT(0    == da.numBytesInUse());
+            ASSERT(4    == X.precision());
+            ASSERT(1000 == X.highestTrackableValue());
+            ASSERT(Obj::numBuckets(4, 1000) == X.numBuckets());
+
+            mX.record(17);
+            mX.record(500, 2);
+
+            Obj mY(X); const Obj& Y = mY;
+            ASSERT(&da == Y.allocator());
+            ASSERT(X   == Y);
+            ASSERT(!(X != Y));
+
+            Obj mZ(X, &oa); const Obj& Z = mZ;
+            ASSERT(&oa == Z.allocator());
+            ASSERT(X   == Z);
+
+            Obj mW(&oa); const Obj& W = mW;
+            ASSERT(X   != W);
+            mW = X;
+            ASSERT(X   == W);
+            ASSERT(&oa == W.allocator());
+
+            mZ.record(17);
+            ASSERT(X != Z);
+
+            Obj mV(5, 1000, &oa); const Obj& V = mV;
+            ASSERT(Obj(4, 1000) != V);
+            ASSERT(Obj(4, 2000) != Obj(4, 1000));
+            ASSERT(Obj(4, 1000) == Obj(4, 1000));
+        }
+        ASSERT(0 == oa.numBytesInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(Obj::k_MIN_PRECISION - 1, 1000));
+            ASSERT_PASS(Obj(Obj::k_MIN_PRECISION,     1000));
+            ASSERT_PASS(Obj(Obj::k_MAX_PRECISION,     1000));
+            ASSERT_FAIL(Obj(Obj::k_MAX_PRECISION + 1, 1000));
+            ASSERT_FAIL(Obj(7, 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BUCKET LAYOUT
+        //
+        // Concerns:
+        //: 1 Values less than '2^precision' each have their own bucket.
+        //:
+        //: 2 Every value lies within the bounds of its bucket, and the bucket
+        //:   bounds map back to the same bucket.
+        //:
+        //: 3 Buckets are contiguous: the lowest value of each bucket is one
+        //:   more than the highest value of the previous bucket.
+        //:
+        //: 4 The width of a bucket never exceeds its lowest value divided by
+        //:   '2^(precision - 1)'.
+        //:
+        //: 5 'numBuckets' matches the formula documented in the header.
+        //:
+        //: 6 Negative values map to bucket 0.
+        //
+        // Plan:
+        //: 1 For every supported precision, iterate over a range of buckets
+        //:   and verify the bounds.  (C-1..4)
+        //:
+        //: 2 Verify 'numBuckets' and 'bucketIndex' for specific values.
+        //:   (C-5..6)
+        //
+        // Testing:
+        //   int bucketIndex(Int64 value, int precision);
+        //   Int64 bucketHighestValue(int index, int precision);
+        //   Int64 bucketLowestValue(int index, int precision);
+        //   int numBuckets(int precision, Int64 highestTrackableValue);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BUCKET LAYOUT" << endl
+                          << "=============" << endl;
+
+        for (int p = Obj::k_MIN_PRECISION; p <= Obj::k_MAX_PRECISION; ++p) {
+            const int SIZE = 1 << p;
+
+            for (int v = 0; v < SIZE; ++v) {
+                ASSERTV(p, v, v == Obj::bucketIndex(v, p));
+                ASSERTV(p, v, v == Obj::bucketLowestValue(v, p));
+                ASSERTV(p, v, v == Obj::bucketHighestValue(v, p));
+            }
+
+            const int NUM = Obj::numBuckets(p, (1LL << 40) - 1);
+            for (int i = 1; i < NUM; ++i) {
+                const Int64 LO = Obj::bucketLowestValue(i, p);
+                const Int64 HI = Obj::bucketHighestValue(i, p);
+
+                ASSERTV(p, i, LO <= HI);
+                ASSERTV(p, i, Obj::bucketHighestValue(i - 1, p) + 1 == LO);
+                ASSERTV(p, i, i == Obj::bucketIndex(LO, p));
+                ASSERTV(p, i, i == Obj::bucketIndex(HI, p));
+                ASSERTV(p, i, i == Obj::bucketIndex((LO + HI) / 2, p));
+                ASSERTV(p, i, (HI - LO + 1) * (SIZE >> 1) <= LO ||
+                                                                 HI == LO);
+            }
+
+            const Int64 TOP = Obj::bucketHighestValue(NUM - 1, p);
+            ASSERTV(p, TOP, (1LL << 40) - 1 == TOP);
+        }
+
+        ASSERT(2345          == Obj::numBuckets(
+                                   7, Obj::k_DEFAULT_HIGHEST_TRACKABLE_VALUE));
+        ASSERT(128 + 35 * 64 == Obj::numBuckets(7, (1LL << 42) - 1));
+        ASSERT(16            == Obj::numBuckets(4, 15));
+        ASSERT(17            == Obj::numBuckets(4, 16));
+        ASSERT(24            == Obj::numBuckets(4, 31));
+        ASSERT(25            == Obj::numBuckets(4, 32));
+
+        ASSERT(0 == Obj::bucketIndex(-1,                        7));
+        ASSERT(0 == Obj::bucketIndex(-9223372036854775807LL - 1, 7));
+        ASSERT(0 <  Obj::bucketIndex( 9223372036854775807LL,     7));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Record values into two histograms, merge them, and query them.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX; const Obj& X = mX;
+        Obj mY; const Obj& Y = mY;
+
+        ASSERT(X == Y);
+
+        mX.record(10);
+        mX.record(20);
+        ASSERT(X != Y);
+        ASSERT(2  == X.count());
+        ASSERT(30 == X.total());
+        ASSERT(10 == X.min());
+        ASSERT(20 == X.max());
+
+        mY.record(30);
+        mX.merge(Y);
+        ASSERT(3  == X.count());
+        ASSERT(60 == X.total());
+        ASSERT(20 == X.valueAtPercentile(50.0));
+        ASSERT(30 == X.valueAtPercentile(100.0));
+
+        if (veryVerbose) { P(X) }
+
+        mX.reset();
+        ASSERT(Obj() == X);
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
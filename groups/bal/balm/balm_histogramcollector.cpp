@@ -0,0 +1,178 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_limits.h>
+#include <bsl_new.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The bucket counts are an array of 'bsls::AtomicInt64' objects allocated at
+// construction.  'update' uses relaxed increments of the bucket count and
+// total, and compare-and-swap loops (entered only when the value is a new
+// extreme) for the minimum and maximum.  'loadAndReset' atomically swaps each
+// non-zero counter with 0, so every recorded value is observed by exactly one
+// snapshot, although a snapshot taken concurrently with 'update' need not be
+// internally consistent.  Since the minimum and maximum are updated after the
+// bucket count, a snapshot may observe a count for which the corresponding
+// extreme has not yet been published; in that case the bounds implied by the
+// occupied buckets (computed by 'Histogram::addBucketCount') are retained.
+
+namespace BloombergLP {
+namespace balm {
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// PRIVATE CLASS DATA
+const bsls::Types::Int64 HistogramCollector::k_EMPTY_MIN =
+                                bsl::numeric_limits<bsls::Types::Int64>::max();
+const bsls::Types::Int64 HistogramCollector::k_EMPTY_MAX = -1;
+
+// PRIVATE ACCESSORS
+void HistogramCollector::prepare(Histogram *result) const
+{
+    if (result->precision()             != d_precision
+     || result->highestTrackableValue() != d_highestTrackableValue) {
+        *result = Histogram(d_precision,
+                            d_highestTrackableValue,
+                            result->allocator());
+    }
+    else {
+        result->reset();
+    }
+}
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId&   metricId,
+                                       bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_precision(Histogram::k_DEFAULT_PRECISION)
+, d_highestTrackableValue(Histogram::k_DEFAULT_HIGHEST_TRACKABLE_VALUE)
+, d_numBuckets(Histogram::numBuckets(d_precision, d_highestTrackableValue))
+, d_counts_p(0)
+, d_total(0)
+, d_min(k_EMPTY_MIN)
+, d_max(k_EMPTY_MAX)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_counts_p = static_cast<bsls::AtomicInt64 *>(
+           d_allocator_p->allocate(d_numBuckets * sizeof(bsls::AtomicInt64)));
+    for (int i = 0; i < d_numBuckets; ++i) {
+        new (d_counts_p + i) bsls::AtomicInt64(0);
+    }
+}
+
+HistogramCollector::HistogramCollector(
+                                   const MetricId&     metricId,
+                                   int                 precision,
+                                   bsls::Types::Int64  highestTrackableValue,
+                                   bslma::Allocator   *basicAllocator)
+: d_metricId(metricId)
+, d_precision(precision)
+, d_highestTrackableValue(highestTrackableValue)
+, d_numBuckets(Histogram::numBuckets(precision, highestTrackableValue))
+, d_counts_p(0)
+, d_total(0)
+, d_min(k_EMPTY_MIN)
+, d_max(k_EMPTY_MAX)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(Histogram::k_MIN_PRECISION <= precision);
+    BSLS_ASSERT(precision <= Histogram::k_MAX_PRECISION);
+    BSLS_ASSERT(0 < highestTrackableValue);
+
+    d_counts_p = static_cast<bsls::AtomicInt64 *>(
+           d_allocator_p->allocate(d_numBuckets * sizeof(bsls::AtomicInt64)));
+    for (int i = 0; i < d_numBuckets; ++i) {
+        new (d_counts_p + i) bsls::AtomicInt64(0);
+    }
+}
+
+HistogramCollector::~HistogramCollector()
+{
+    // 'bsls::AtomicInt64' is trivially destructible.
+
+    d_allocator_p->deallocate(d_counts_p);
+}
+
+// MANIPULATORS
+void HistogramCollector::loadAndReset(Histogram *result)
+{
+    BSLS_ASSERT(result);
+
+    prepare(result);
+
+    for (int i = 0; i < d_numBuckets; ++i) {
+        if (0 != d_counts_p[i].loadRelaxed()) {
+            result->addBucketCount(i, d_counts_p[i].swapAcqRel(0));
+        }
+    }
+
+    const bsls::Types::Int64 total = d_total.swapAcqRel(0);
+    const bsls::Types::Int64 min   = d_min.swapAcqRel(k_EMPTY_MIN);
+    const bsls::Types::Int64 max   = d_max.swapAcqRel(k_EMPTY_MAX);
+
+    if (0 < result->count() && min <= max) {
+        result->setTotalMinMax(static_cast<double>(total), min, max);
+    }
+}
+
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < d_numBuckets; ++i) {
+        d_counts_p[i].storeRelaxed(0);
+    }
+    d_total.storeRelaxed(0);
+    d_min.storeRelaxed(k_EMPTY_MIN);
+    d_max.storeRelaxed(k_EMPTY_MAX);
+}
+
+// ACCESSORS
+void HistogramCollector::load(Histogram *result) const
+{
+    BSLS_ASSERT(result);
+
+    prepare(result);
+
+    for (int i = 0; i < d_numBuckets; ++i) {
+        const bsls::Types::Int64 count = d_counts_p[i].loadAcquire();
+        if (0 != count) {
+            result->addBucketCount(i, count);
+        }
+    }
+
+    const bsls::Types::Int64 total = d_total.loadAcquire();
+    const bsls::Types::Int64 min   = d_min.loadAcquire();
+    const bsls::Types::Int64 max   = d_max.loadAcquire();
+
+    if (0 < result->count() && min <= max) {
+        result->setTotalMinMax(static_cast<double>(total), min, max);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,295 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free collector of a metric's value distribution.
+//
+//@CLASSES:
+//   balm::HistogramCollector: lock-free collector of a histogram of values
+//
+//@SEE_ALSO: balm_histogram, balm_collector, balm_collectorrepository
+//
+//@DESCRIPTION: This component provides a class, 'balm::HistogramCollector',
+// that collects the distribution of the values of a metric (typically a
+// latency) in the log-linear buckets described by 'balm_histogram'.  Unlike
+// 'balm::Collector', which aggregates only the count, total, minimum, and
+// maximum of a metric, a histogram collector retains enough information to
+// compute approximate quantiles (e.g., the 99th or 99.9th percentile) of the
+// values collected during each publication interval.
+//
+// Values are recorded using 'update', which is lock-free and takes constant
+// time: it increments one atomic bucket counter, adds to an atomic total, and
+// (only when the value is a new extreme) updates the atomic minimum or
+// maximum.  The 'load' and 'loadAndReset' methods populate a
+// 'balm::Histogram' snapshot, which can then be queried, printed, or merged
+// with other snapshots.
+//
+// The memory used by a histogram collector is determined by the 'precision'
+// and 'highestTrackableValue' supplied at construction (see {'balm_histogram'
+// |Bucket Layout}), and does not grow with the number of values recorded.
+//
+///Alternative Systems for Telemetry
+///---------------------------------
+// Bloomberg software may alternatively use the GUTS telemetry API, which is
+// integrated into Bloomberg infrastructure.
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  Note, however, that because
+// recording is lock-free, a snapshot loaded concurrently with calls to
+// 'update' may reflect some of the effects of an in-progress 'update' but not
+// others (e.g., a bucket count but not the corresponding total).  Each value
+// passed to 'update' is reflected in the snapshot loaded by exactly one call
+// to 'loadAndReset'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting Request Latencies
+///- - - - - - - - - - - - - - - - - - - -
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "RequestLatency");
+//  balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::HistogramCollector' object for 'myMetric', and use
+// the 'update' method to record the latencies (in microseconds) of a number
+// of requests:
+//..
+//  balm::HistogramCollector collector(myMetric);
+//
+//  for (int i = 1; i <= 100; ++i) {
+//      collector.update(i);
+//  }
+//..
+// Finally, we load the histogram of the collected values, resetting the
+// collector, and obtain the median and 99th-percentile latencies:
+//..
+//  balm::Histogram histogram;
+//  collector.loadAndReset(&histogram);
+//
+//  assert(100  == histogram.count());
+//  assert(5050 == histogram.total());
+//  assert(50   == histogram.valueAtPercentile(50.0));
+//  assert(99   == histogram.valueAtPercentile(99.0));
+//
+//  collector.load(&histogram);
+//  assert(0    == histogram.count());
+//..
+
+#include <balscm_version.h>
+
+#include <balm_histogram.h>
+#include <balm_metricid.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                          // ========================
+                          // class HistogramCollector
+                          // ========================
+
+class HistogramCollector {
+    // This class provides a lock-free mechanism for collecting the
+    // distribution of the values of a metric over a period of time.  The
+    // collector holds the identity of the metric, an atomic count for each
+    // bucket of the histogram layout determined at construction, and the
+    // total, minimum, and maximum of the collected values.
+
+    // DATA
+    MetricId            d_metricId;   // metric identifier
+
+    int                 d_precision;  // histogram precision
+
+    bsls::Types::Int64  d_highestTrackableValue;
+                                      // highest value recorded in its own
+                                      // bucket
+
+    int                 d_numBuckets; // number of buckets in 'd_counts_p'
+
+    bsls::AtomicInt64  *d_counts_p;   // array of bucket counts (owned)
+
+    bsls::AtomicInt64   d_total;      // total of values
+
+    bsls::AtomicInt64   d_min;        // minimum value, or 'k_EMPTY_MIN'
+
+    bsls::AtomicInt64   d_max;        // maximum value, or 'k_EMPTY_MAX'
+
+    bslma::Allocator   *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE CLASS DATA
+    static const bsls::Types::Int64 k_EMPTY_MIN;  // minimum if no values
+    static const bsls::Types::Int64 k_EMPTY_MAX;  // maximum if no values
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+    // PRIVATE ACCESSORS
+    void prepare(Histogram *result) const;
+        // Reset the specified 'result' histogram to the empty state, and
+        // reconfigure it (if necessary) to have the precision and highest
+        // trackable value of this collector.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(HistogramCollector,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit HistogramCollector(const MetricId&   metricId,
+                                bslma::Allocator *basicAllocator = 0);
+        // Create a histogram collector for a metric having the specified
+        // 'metricId', and having 'Histogram::k_DEFAULT_PRECISION' and
+        // 'Histogram::k_DEFAULT_HIGHEST_TRACKABLE_VALUE'.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    HistogramCollector(const MetricId&     metricId,
+                       int                 precision,
+                       bsls::Types::Int64  highestTrackableValue,
+                       bslma::Allocator   *basicAllocator = 0);
+        // Create a histogram collector for a metric having the specified
+        // 'metricId', 'precision', and 'highestTrackableValue' (see
+        // {'balm_histogram'|Bucket Layout}).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless
+        // 'Histogram::k_MIN_PRECISION <= precision <= k_MAX_PRECISION' and
+        // '0 < highestTrackableValue'.
+
+    ~HistogramCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void loadAndReset(Histogram *result);
+        // Load into the specified 'result' the histogram of the values
+        // collected since this collector was created or last reset, and reset
+        // this collector to the empty state.  'result' is reconfigured, if
+        // necessary, to have the precision and highest trackable value of
+        // this collector.
+
+    void reset();
+        // Reset this collector to the empty state.
+
+    void update(bsls::Types::Int64 value);
+        // Record the specified 'value'.  A negative 'value' is recorded as 0,
+        // and a 'value' greater than 'highestTrackableValue()' is recorded in
+        // the last bucket.
+
+    // ACCESSORS
+    bsls::Types::Int64 highestTrackableValue() const;
+        // Return the highest value that this collector records in its own
+        // bucket.
+
+    void load(Histogram *result) const;
+        // Load into the specified 'result' the histogram of the values
+        // collected since this collector was created or last reset.  'result'
+        // is reconfigured, if necessary, to have the precision and highest
+        // trackable value of this collector.
+
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    int precision() const;
+        // Return the precision of the histogram collected by this object.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// MANIPULATORS
+inline
+void HistogramCollector::update(bsls::Types::Int64 value)
+{
+    value = bsl::max(value, static_cast<bsls::Types::Int64>(0));
+
+    const int index = bsl::min(Histogram::bucketIndex(value, d_precision),
+                               d_numBuckets - 1);
+
+    d_counts_p[index].addRelaxed(1);
+    d_total.addRelaxed(value);
+
+    bsls::Types::Int64 min = d_min.loadRelaxed();
+    while (value < min) {
+        const bsls::Types::Int64 previous = d_min.testAndSwap(min, value);
+        if (previous == min) {
+            break;
+        }
+        min = previous;
+    }
+
+    bsls::Types::Int64 max = d_max.loadRelaxed();
+    while (value > max) {
+        const bsls::Types::Int64 previous = d_max.testAndSwap(max, value);
+        if (previous == max) {
+            break;
+        }
+        max = previous;
+    }
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 HistogramCollector::highestTrackableValue() const
+{
+    return d_highestTrackableValue;
+}
+
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+inline
+int HistogramCollector::precision() const
+{
+    return d_precision;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,524 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a lock-free mechanism that records values in
+// atomic bucket counters, and loads them into a 'balm::Histogram' snapshot.
+// We verify that the snapshot reflects the updated values exactly (to within
+// the bucket layout of 'balm_histogram'), that 'loadAndReset' and 'reset'
+// restore the empty state, and that concurrent updates are not lost.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit HistogramCollector(const MetricId&, bslma::Allocator * = 0);
+// [ 2] HistogramCollector(const MetricId&, int, Int64, Allocator * = 0);
+// [ 2] ~HistogramCollector();
+//
+// MANIPULATORS
+// [ 3] void loadAndReset(Histogram *result);
+// [ 3] void reset();
+// [ 3] void update(Int64 value);
+//
+// ACCESSORS
+// [ 2] Int64 highestTrackableValue() const;
+// [ 3] void load(Histogram *result) const;
+// [ 2] const MetricId& metricId() const;
+// [ 2] int precision() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENT UPDATES
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef balm::Histogram          Histogram;
+typedef bsls::Types::Int64       Int64;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void updateJob(Obj             *collector,
+               bslmt::Barrier  *barrier,
+               int              threadIndex,
+               int              numUpdates)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // with each of the 'numUpdates' values in the range
+    // '[threadIndex * numUpdates .. (threadIndex + 1) * numUpdates)'.
+{
+    barrier->wait();
+    const int base = threadIndex * numUpdates;
+    for (int i = 0; i < numUpdates; ++i) {
+        collector->update(base + i);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    balm::Category          myCategory("MyCategory");
+    balm::MetricDescription descA(&myCategory, "A");
+    balm::MetricDescription descB(&myCategory, "B");
+
+    const balm::MetricId METRIC_A(&descA);
+    const balm::MetricId METRIC_B(&descB);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting Request Latencies
+///- - - - - - - - - - - - - - - - - - - -
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "RequestLatency");
+    balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::HistogramCollector' object for 'myMetric', and use
+// the 'update' method to record the latencies (in microseconds) of a number
+// of requests:
+//..
+    balm::HistogramCollector collector(myMetric);
+
+    for (int i = 1; i <= 100; ++i) {
+        collector.update(i);
+    }
+//..
+// Finally, we load the histogram of the collected values, resetting the
+// collector, and obtain the median and 99th-percentile latencies:
+//..
+    balm::Histogram histogram;
+    collector.loadAndReset(&histogram);
+
+    ASSERT(100  == histogram.count());
+    ASSERT(5050 == histogram.total());
+    ASSERT(50   == histogram.valueAtPercentile(50.0));
+    ASSERT(99   == histogram.valueAtPercentile(99.0));
+
+    collector.load(&histogram);
+    ASSERT(0    == histogram.count());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT UPDATES
+        //
+        // Concerns:
+        //: 1 Values updated concurrently by several threads are all reflected
+        //:   in the bucket counts, count, total, minimum, and maximum of the
+        //:   loaded histogram.
+        //:
+        //: 2 'loadAndReset' resets every counter.
+        //
+        // Plan:
+        //: 1 Have several threads update a collector with distinct ranges of
+        //:   values, and compare the loaded histogram with a histogram
+        //:   recording the same values.  (C-1)
+        //:
+        //: 2 Call 'loadAndReset' and verify a subsequent 'load' returns an
+        //:   empty histogram.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENT UPDATES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENT UPDATES" << endl
+                                  << "==================" << endl;
+
+        const int NUM_THREADS = 8;
+        const int NUM_UPDATES = 10000;
+        const int NUM_VALUES  = NUM_THREADS * NUM_UPDATES;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+
+        bslmt::Barrier     barrier(NUM_THREADS);
+        bslmt::ThreadGroup threadGroup;
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            bsl::function<void()> job = bdlf::BindUtil::bind(&updateJob,
+                                                              &mX,
+                                                              &barrier,
+                                                              i,
+                                                              NUM_UPDATES);
+            ASSERT(0 == threadGroup.addThread(job));
+        }
+        threadGroup.joinAll();
+
+        Histogram expected;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            expected.record(i);
+        }
+
+        Histogram result;
+        X.load(&result);
+        ASSERTV(result.count(), NUM_VALUES     == result.count());
+        ASSERTV(result.min(),   0              == result.min());
+        ASSERTV(result.max(),   NUM_VALUES - 1 == result.max());
+        ASSERT(expected == result);
+
+        mX.loadAndReset(&result);
+        ASSERT(expected == result);
+
+        X.load(&result);
+        ASSERT(Histogram() == result);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'update', 'load', 'loadAndReset', AND 'reset'
+        //
+        // Concerns:
+        //: 1 'load' populates a histogram equal to one that recorded the same
+        //:   values.
+        //:
+        //: 2 'load' does not modify the collector, and 'loadAndReset' and
+        //:   'reset' restore the empty state.
+        //:
+        //: 3 Negative values are recorded as 0, and values greater than the
+        //:   highest trackable value are recorded in the last bucket but
+        //:   reflected exactly in the maximum and total.
+        //:
+        //: 4 The result is reconfigured to the collector's precision and
+        //:   highest trackable value, retaining its allocator.
+        //:
+        //: 5 The result of loading an empty collector is an empty histogram.
+        //:
+        //: 6 QoI: asserted precondition violations are detected.
+        //
+        // Plan:
+        //: 1 Update collectors with a set of values, and compare the loaded
+        //:   histograms with histograms recording the same values.
+        //:   (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void loadAndReset(Histogram *result);
+        //   void reset();
+        //   void update(Int64 value);
+        //   void load(Histogram *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'update', 'load', 'loadAndReset', AND 'reset'"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        static const Int64 VALUES[] = {
+            0, 1, 17, 127, 128, 129, 1000, 65535, 65536, 1000000, 123456789,
+            -5, 10000000000LL
+        };
+        const int NUM_VALUES = static_cast<int>(sizeof VALUES /
+                                                sizeof *VALUES);
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator ra("result", veryVerbose);
+
+        Obj mX(METRIC_A, 5, 1000000000LL, &oa); const Obj& X = mX;
+
+        Histogram expected(5, 1000000000LL);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.update(VALUES[i]);
+            expected.record(VALUES[i]);
+        }
+        ASSERT(10000000000LL == expected.max());
+        ASSERT(0             == expected.min());
+
+        Histogram result(&ra);
+        X.load(&result);
+        ASSERT(expected == result);
+        ASSERT(&ra      == result.allocator());
+        ASSERT(5        == result.precision());
+
+        X.load(&result);
+        ASSERT(expected == result);
+
+        mX.loadAndReset(&result);
+        ASSERT(expected == result);
+
+        X.load(&result);
+        ASSERT(Histogram(5, 1000000000LL) == result);
+
+        mX.update(42);
+        mX.reset();
+        X.load(&result);
+        ASSERT(Histogram(5, 1000000000LL) == result);
+
+        mX.update(42);
+        mX.update(43);
+        X.load(&result);
+        ASSERT(2  == result.count());
+        ASSERT(85 == result.total());
+        ASSERT(42 == result.min());
+        ASSERT(43 == result.max());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(X.load(0));
+            ASSERT_FAIL(mX.loadAndReset(0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors create a collector having the specified metric
+        //:   id and histogram configuration.
+        //:
+        //: 2 Memory is obtained from the supplied allocator, or the default
+        //:   allocator if none is supplied, and released on destruction.
+        //:
+        //: 3 QoI: asserted precondition violations are detected.
+        //
+        // Plan:
+        //: 1 Create collectors using test allocators and verify their
+        //:   attributes and memory use.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   explicit HistogramCollector(const MetricId&, Allocator * = 0);
+        //   HistogramCollector(const MetricId&, int, Int64, Allocator * = 0);
+        //   ~HistogramCollector();
+        //   Int64 highestTrackableValue() const;
+        //   const MetricId& metricId() const;
+        //   int precision() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        {
+            Obj mX(METRIC_A); const Obj& X = mX;
+            ASSERT(METRIC_A == X.metricId());
+            ASSERT(Histogram::k_DEFAULT_PRECISION == X.precision());
+            ASSERT(Histogram::k_DEFAULT_HIGHEST_TRACKABLE_VALUE ==
+                                                   X.highestTrackableValue());
+            ASSERT(0 < da.numBytesInUse());
+        }
+        ASSERT(0 == da.numBytesInUse());
+
+        {
+            Obj mX(METRIC_B, 4, 1000, &oa); const Obj& X = mX;
+            ASSERT(METRIC_B == X.metricId());
+            ASSERT(4        == X.precision());
+            ASSERT(1000     == X.highestTrackableValue());
+            ASSERT(0        <  oa.numBytesInUse());
+            ASSERT(0        == da.numBytesInUse());
+        }
+        ASSERT(0 == oa.numBytesInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            // The configuration is validated by 'balm::Histogram' when the
+            // number of buckets is computed.
+
+            ASSERT_FAIL_RAW(
+                          Obj(METRIC_A, Histogram::k_MIN_PRECISION - 1, 1000));
+            ASSERT_PASS(Obj(METRIC_A, Histogram::k_MIN_PRECISION,     1000));
+            ASSERT_PASS(Obj(METRIC_A, Histogram::k_MAX_PRECISION,     1000));
+            ASSERT_FAIL_RAW(
+                          Obj(METRIC_A, Histogram::k_MAX_PRECISION + 1, 1000));
+            ASSERT_FAIL_RAW(Obj(METRIC_A, 7, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Update a collector, and load and reset the collected histogram.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+
+        mX.update(10);
+        mX.update(20);
+        mX.update(30);
+
+        Histogram result;
+        X.load(&result);
+        ASSERT(3  == result.count());
+        ASSERT(60 == result.total());
+        ASSERT(10 == result.min());
+        ASSERT(30 == result.max());
+        ASSERT(20 == result.valueAtPercentile(50.0));
+
+        if (veryVerbose) { P(result) }
+
+        mX.loadAndReset(&result);
+        ASSERT(3 == result.count());
+
+        X.load(&result);
+        ASSERT(0 == result.count());
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
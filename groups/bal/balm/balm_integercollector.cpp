@@ -12,9 +12,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_integercollector_cpp,"$Id$ $CSID$")
 
+#include <bslma_default.h>
+
 #include <bsls_types.h>
 
 #include <bsl_climits.h>
+#include <bsl_new.h>
 
 namespace BloombergLP {
 
@@ -31,54 +34,38 @@ const int balm::IntegerCollector::DEFAULT_MAX = INT_MIN;
 #endif
 
 namespace balm {
-// MANIPULATORS
-void IntegerCollector::loadAndReset(MetricRecord *records)
+
+// PRIVATE ACCESSORS
+void IntegerCollector::lockAllShards() const
 {
-    int                count;
-    bsls::Types::Int64 total;
-    int                min;
-    int                max;
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
-
-        d_count = 0;
-        d_total = 0;
-        d_min   = k_DEFAULT_MIN;
-        d_max   = k_DEFAULT_MAX;
+    for (int i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].d_lock.lockWithBackoff();
     }
-    // Perform the conversion to double values outside of the lock.
-    records->metricId() = d_metricId;
-    records->count()    = count;
-    records->total()    = static_cast<double>(total);
-    records->min()      = (k_DEFAULT_MIN == min)
-                        ? MetricRecord::k_DEFAULT_MIN
-                        : min;
-    records->max()      = (k_DEFAULT_MAX == max)
-                        ? MetricRecord::k_DEFAULT_MAX
-                        : max;
 }
 
-// ACCESSORS
-void IntegerCollector::load(MetricRecord *record) const
+void IntegerCollector::unlockAllShards() const
 {
-    int                count;
-    bsls::Types::Int64 total;
-    int                min;
-    int                max;
-
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
+    for (int i = d_numShards - 1; 0 <= i; --i) {
+        d_shards_p[i].d_lock.unlock();
+    }
+}
+
+void IntegerCollector::loadRaw(MetricRecord *record) const
+{
+    int                count = 0;
+    bsls::Types::Int64 total = 0;
+    int                min   = k_DEFAULT_MIN;
+    int                max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < d_numShards; ++i) {
+        const Shard& shard = d_shards_p[i];
+
+        count += shard.d_count;
+        total += shard.d_total;
+        min   =  bsl::min(min, shard.d_min);
+        max   =  bsl::max(max, shard.d_max);
     }
 
-    // Perform the conversion to double values outside of the lock.
     record->metricId() = d_metricId;
     record->count()    = count;
     record->total()    = static_cast<double>(total);
@@ -90,6 +77,87 @@ void IntegerCollector::load(MetricRecord *record) const
                        : max;
 }
 
+// CREATORS
+IntegerCollector::IntegerCollector(const MetricId&   metricId,
+                                   bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_shards_p(0)
+, d_numShards(CollectorShardUtil::numShards())
+, d_storage_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // Allocate one shard more than needed, so that the shards can be aligned
+    // on a cache-line boundary within the allocated storage.
+
+    d_storage_p = d_allocator_p->allocate((d_numShards + 1) * k_SHARD_SIZE);
+
+    char                       *buffer  = static_cast<char *>(d_storage_p);
+    const bsls::Types::UintPtr  address =
+                               reinterpret_cast<bsls::Types::UintPtr>(buffer);
+    const bsls::Types::UintPtr  offset  =
+        (k_SHARD_SIZE - address % k_SHARD_SIZE) % k_SHARD_SIZE;
+
+    d_shards_p = reinterpret_cast<Shard *>(buffer + offset);
+
+    // Value-initializing a shard zero-initializes its spin lock, which is
+    // equivalent to 'bsls::SpinLock::s_unlocked'.
+
+    for (int i = 0; i < d_numShards; ++i) {
+        resetShard(new (d_shards_p + i) Shard());
+    }
+}
+
+IntegerCollector::~IntegerCollector()
+{
+    // 'Shard' is trivially destructible.
+
+    d_allocator_p->deallocate(d_storage_p);
+}
+
+// MANIPULATORS
+void IntegerCollector::reset()
+{
+    lockAllShards();
+    for (int i = 0; i < d_numShards; ++i) {
+        resetShard(d_shards_p + i);
+    }
+    unlockAllShards();
+}
+
+void IntegerCollector::loadAndReset(MetricRecord *records)
+{
+    lockAllShards();
+    loadRaw(records);
+    for (int i = 0; i < d_numShards; ++i) {
+        resetShard(d_shards_p + i);
+    }
+    unlockAllShards();
+}
+
+void IntegerCollector::setCountTotalMinMax(int count,
+                                           int total,
+                                           int min,
+                                           int max)
+{
+    lockAllShards();
+    for (int i = 1; i < d_numShards; ++i) {
+        resetShard(d_shards_p + i);
+    }
+    d_shards_p[0].d_count = count;
+    d_shards_p[0].d_total = total;
+    d_shards_p[0].d_min   = min;
+    d_shards_p[0].d_max   = max;
+    unlockAllShards();
+}
+
+// ACCESSORS
+void IntegerCollector::load(MetricRecord *record) const
+{
+    lockAllShards();
+    loadRaw(record);
+    unlockAllShards();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -18,7 +18,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balm::IntegerCollector: a container for collecting integral values
 //
-//@SEE_ALSO:
+//@SEE_ALSO: balm_collector, balm_collectorshardutil
 //
 //@DESCRIPTION: This component provides a class for collecting and aggregating
 // the values of an integral metric.  The 'balm::IntegerCollector' records the
@@ -44,6 +44,17 @@ BSLS_IDENT("$Id: $")
 // non-creator operations on a given instance can be safely invoked
 // simultaneously from multiple threads.
 //
+///Performance
+///-----------
+// As with 'balm::Collector', the state of a 'balm::IntegerCollector' is
+// divided into 'balm::CollectorShardUtil::numShards()' cache-line-sized
+// shards, each guarded by its own spin lock.  'update' and
+// 'accumulateCountTotalMinMax' lock only the shard assigned to the calling
+// thread, backing off (and yielding the processor) while that shard is locked
+// by another thread, while 'load', 'loadAndReset', 'reset', and
+// 'setCountTotalMinMax' lock every shard, so that they observe and modify a
+// consistent state.
+//
 ///Usage
 ///-----
 // The following example creates a 'balm::IntegerCollector', modifies its
@@ -83,17 +94,47 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <balm_collectorshardutil.h>
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
 
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_spinlock.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
 namespace balm {
 
+                       // ============================
+                       // struct IntegerCollector_Shard
+                       // ============================
+
+struct IntegerCollector_Shard {
+    // This component-private 'struct' provides the aggregated values of one
+    // shard of an 'IntegerCollector', padded to occupy exactly one cache
+    // line.
+
+    // DATA
+    bsls::SpinLock     d_lock;   // synchronizes access to this shard
+    int                d_count;  // aggregated count of events
+    bsls::Types::Int64 d_total;  // total of values across events
+    int                d_min;    // minimum value across events
+    int                d_max;    // maximum value across events
+    char               d_pad[CollectorShardUtil::k_SHARD_SIZE
+                             - sizeof(bsls::SpinLock)
+                             - 3 * sizeof(int)
+                             - sizeof(bsls::Types::Int64)];
+                                 // padding to the size of a cache line
+};
+
+BSLMF_ASSERT(sizeof(IntegerCollector_Shard) ==
+                                             CollectorShardUtil::k_SHARD_SIZE);
+
                            // ======================
                            // class IntegerCollector
                            // ======================
@@ -101,25 +142,62 @@ namespace balm {
 class IntegerCollector {
     // This class provides a mechanism for collecting and aggregating the
     // value of an integer metric over a period of time.  The collector
-    // contains a 'MetricId' object identifying the metric being collected,
-    // the number of times an event occurred, and the total, minimum, and
-    // maximum aggregates of the associated measurement value.  The default
+    // contains a 'MetricId' object identifying the metric being collected
+    // and, divided among a set of striped shards, the number of times an
+    // event occurred, and the total, minimum, and maximum aggregates of the
+    // associated measurement value.  The default
     // value for the count is 0, the default value for the total is 0, the
     // default value for the minimum is 'k_DEFAULT_MIN', and the default value
     // for the maximum is 'k_DEFAULT_MAX'.
 
+    // PRIVATE TYPES
+    typedef IntegerCollector_Shard Shard;
+
+    enum { k_SHARD_SIZE = CollectorShardUtil::k_SHARD_SIZE };
+
     // DATA
-    MetricId             d_metricId;  // metric identifier
-    int                  d_count;     // aggregated count of events
-    bsls::Types::Int64   d_total;     // total of values across events
-    int                  d_min;       // minimum value across events
-    int                  d_max;       // maximum value across events
-    mutable bslmt::Mutex d_mutex;     // synchronizes access to data
+    MetricId          d_metricId;     // metric identifier
+
+    Shard            *d_shards_p;     // cache-line aligned array of
+                                      // 'd_numShards' shards within
+                                      // 'd_storage_p'
+
+    int               d_numShards;    // number of shards
+
+    void             *d_storage_p;    // storage for the shards, over-sized
+                                      // so that they can be aligned on a
+                                      // cache-line boundary (owned)
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
 
     // NOT IMPLEMENTED
     IntegerCollector(const IntegerCollector&);
     IntegerCollector& operator=(const IntegerCollector&);
 
+    // PRIVATE CLASS METHODS
+    static void resetShard(Shard *shard);
+        // Set the count and total of the specified 'shard' to 0, its minimum
+        // to 'k_DEFAULT_MIN', and its maximum to 'k_DEFAULT_MAX'.  The
+        // behavior is undefined unless the calling thread holds the lock of
+        // 'shard'.
+
+    // PRIVATE ACCESSORS
+    void lockAllShards() const;
+        // Acquire the lock of every shard of this collector, in increasing
+        // order of shard index, backing off while a lock is held by another
+        // thread.
+
+    void unlockAllShards() const;
+        // Release the lock of every shard of this collector.  The behavior is
+        // undefined unless the calling thread holds the lock of every shard.
+
+    void loadRaw(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the count, total, minimum, and maximum values
+        // aggregated over all shards, converting default minimum and maximum
+        // values as described in 'load'.  The behavior is undefined unless
+        // the calling thread holds the lock of every shard.
+
   public:
     // PUBLIC CONSTANTS
     static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
@@ -129,11 +207,18 @@ class IntegerCollector {
     static const int DEFAULT_MAX;
 #endif
 
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(IntegerCollector,
+                                   bslma::UsesBslmaAllocator);
+
     // CREATORS
-    IntegerCollector(const MetricId& metricId);
+    explicit IntegerCollector(const MetricId&   metricId,
+                              bslma::Allocator *basicAllocator = 0);
         // Create an integer collector for a metric having the specified
         // 'metricId', and having an initial count of 0, total of 0, min of
-        // 'k_DEFAULT_MIN', and max of 'k_DEFAULT_MAX'.
+        // 'k_DEFAULT_MIN', and max of 'k_DEFAULT_MAX'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
 
     ~IntegerCollector();
         // Destroy this object.
@@ -205,42 +290,28 @@ class IntegerCollector {
                            // class IntegerCollector
                            // ----------------------
 
-// CREATORS
-inline
-IntegerCollector::IntegerCollector(const MetricId& metricId)
-: d_metricId(metricId)
-, d_count(0)
-, d_total(0)
-, d_min(k_DEFAULT_MIN)
-, d_max(k_DEFAULT_MAX)
-, d_mutex()
-{
-}
-
+// PRIVATE CLASS METHODS
 inline
-IntegerCollector::~IntegerCollector()
+void IntegerCollector::resetShard(Shard *shard)
 {
+    shard->d_count = 0;
+    shard->d_total = 0;
+    shard->d_min   = k_DEFAULT_MIN;
+    shard->d_max   = k_DEFAULT_MAX;
 }
 
 // MANIPULATORS
-inline
-void IntegerCollector::reset()
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = 0;
-    d_total = 0;
-    d_min   = k_DEFAULT_MIN;
-    d_max   = k_DEFAULT_MAX;
-}
-
 inline
 void IntegerCollector::update(int value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    ++d_count;
-    d_total += value;
-    d_min = bsl::min(value, d_min);
-    d_max = bsl::max(value, d_max);
+    Shard *shard = d_shards_p + CollectorShardUtil::shardIndex();
+
+    shard->d_lock.lockWithBackoff();
+    ++shard->d_count;
+    shard->d_total += value;
+    shard->d_min = bsl::min(value, shard->d_min);
+    shard->d_max = bsl::max(value, shard->d_max);
+    shard->d_lock.unlock();
 }
 
 inline
@@ -249,24 +320,14 @@ void IntegerCollector::accumulateCountTotalMinMax(int count,
                                                   int min,
                                                   int max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count += count;
-    d_total += total;
-    d_min   = bsl::min(min, d_min);
-    d_max   = bsl::max(max, d_max);
-}
-
-inline
-void IntegerCollector::setCountTotalMinMax(int count,
-                                           int total,
-                                           int min,
-                                           int max)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = count;
-    d_total = total;
-    d_min   = min;
-    d_max   = max;
+    Shard *shard = d_shards_p + CollectorShardUtil::shardIndex();
+
+    shard->d_lock.lockWithBackoff();
+    shard->d_count += count;
+    shard->d_total += total;
+    shard->d_min   = bsl::min(min, shard->d_min);
+    shard->d_max   = bsl::max(max, shard->d_max);
+    shard->d_lock.unlock();
 }
 
 // ACCESSORS
@@ -11,6 +11,7 @@
 
 #include <bslma_testallocator.h>
 #include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
 #include <bdlmt_fixedthreadpool.h>
 #include <bdlf_bind.h>
 
@@ -63,7 +64,8 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [ 9] CONCURRENT UPDATES
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -216,6 +218,21 @@ void ConcurrencyTest::runTest()
     d_pool.drain();
 }
 
+void updateJob(balm::IntegerCollector *collector,
+               bslmt::Barrier         *barrier,
+               int                     threadIndex,
+               int                     numUpdates)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // the specified 'numUpdates' times with the values in the range
+    // '[threadIndex * numUpdates .. (threadIndex + 1) * numUpdates)', where
+    // 'threadIndex' is the specified index of the calling thread.
+{
+    barrier->wait();
+    for (int i = 0; i < numUpdates; ++i) {
+        collector->update(threadIndex * numUpdates + i);
+    }
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -248,7 +265,7 @@ int main(int argc, char *argv[])
     Id metric_E(DESC_E); const Id& METRIC_E = metric_E;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -303,6 +320,68 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCURRENT UPDATES
+        //
+        // Concerns:
+        //: 1 Values updated concurrently by several threads, each of which
+        //:   may be assigned a different shard, are all reflected in the
+        //:   count, total, minimum, and maximum loaded from the collector.
+        //:
+        //: 2 'loadAndReset' resets every shard.
+        //
+        // Plan:
+        //: 1 Create more threads than there are shards, and have each thread
+        //:   update the collector with a distinct range of values.  Verify
+        //:   the loaded aggregates.  (C-1)
+        //:
+        //: 2 Call 'loadAndReset' and verify a subsequent 'load' returns the
+        //:   default record.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENT UPDATES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENT UPDATES" << endl
+                                  << "==================" << endl;
+
+        const int NUM_THREADS = 2 * balm::CollectorShardUtil::numShards();
+        const int NUM_UPDATES = 10000;
+        const int NUM_VALUES  = NUM_THREADS * NUM_UPDATES;
+
+        Obj mX(METRIC_A); const Obj& MX = mX;
+
+        bslmt::Barrier     barrier(NUM_THREADS);
+        bslmt::ThreadGroup threadGroup;
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            bsl::function<void()> job = bdlf::BindUtil::bind(&updateJob,
+                                                              &mX,
+                                                              &barrier,
+                                                              i,
+                                                              NUM_UPDATES);
+            ASSERT(0 == threadGroup.addThread(job));
+        }
+        threadGroup.joinAll();
+
+        Rec record;
+        MX.load(&record);
+
+        const double EXP_TOTAL = (static_cast<double>(NUM_VALUES - 1)
+                                                            * NUM_VALUES) / 2;
+
+        ASSERT(METRIC_A       == record.metricId());
+        ASSERTV(record.count(), NUM_VALUES     == record.count());
+        ASSERTV(record.total(), EXP_TOTAL      == record.total());
+        ASSERTV(record.min(),   0              == record.min());
+        ASSERTV(record.max(),   NUM_VALUES - 1 == record.max());
+
+        mX.loadAndReset(&record);
+        ASSERTV(record.count(), NUM_VALUES == record.count());
+
+        MX.load(&record);
+        ASSERT(Rec(METRIC_A) == record);
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -0,0 +1,256 @@
+// balm_latencyprobe.cpp                                              -*-C++-*-
+#include <balm_latencyprobe.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_latencyprobe_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_utility.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each thread caches, in thread-local storage, the id of the last recorder it
+// used together with its buffer in that recorder, so that 'threadBuffer'
+// normally costs two thread-local loads and a comparison.  Recorders are
+// identified by a process-wide counter rather than by address, so that a
+// recorder created at the address of a destroyed recorder cannot match a
+// stale cache entry.  On a cache miss (or where thread-local storage is
+// unavailable) the buffer is found, or created, in a map keyed by thread id
+// under a mutex.
+//
+// The buffer is a single-producer, single-consumer ring: the owning thread
+// writes a span and then publishes it with a release store of 'd_head', and
+// the draining thread acquires 'd_head', processes the spans, and releases
+// the slots by a release store of 'd_tail'.  Concurrent drains are serialized
+// by 'd_drainLock', so each buffer has at most one consumer.
+
+namespace BloombergLP {
+namespace {
+
+bsls::AtomicOperations::AtomicTypes::Int64 g_nextRecorderId = { 0 };
+    // id to be assigned (after increment) to the next recorder created
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(bsls::Types::Int64, g_cachedRecorderId, 0);
+    // id of the recorder whose buffer is cached by the current thread
+
+BSLMT_THREAD_LOCAL_VARIABLE(balm::LatencyProbe_ThreadBuffer *,
+                            g_cachedBuffer,
+                            0);
+    // buffer of the current thread in the recorder 'g_cachedRecorderId'
+#endif
+
+}  // close unnamed namespace
+
+namespace balm {
+
+                       // -------------------------------
+                       // class LatencyProbe_ThreadBuffer
+                       // -------------------------------
+
+// CREATORS
+LatencyProbe_ThreadBuffer::LatencyProbe_ThreadBuffer(
+                                              int               capacity,
+                                              int               threadIndex,
+                                              bslma::Allocator *basicAllocator)
+: d_head(0)
+, d_depth(0)
+, d_tail(0)
+, d_numDropped(0)
+, d_entries_p(0)
+, d_mask(capacity - 1)
+, d_threadIndex(threadIndex)
+, d_allocator_p(basicAllocator)
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+    BSLS_ASSERT(basicAllocator);
+
+    d_entries_p = static_cast<LatencyProbe_Entry *>(
+             d_allocator_p->allocate(capacity * sizeof(LatencyProbe_Entry)));
+}
+
+LatencyProbe_ThreadBuffer::~LatencyProbe_ThreadBuffer()
+{
+    d_allocator_p->deallocate(d_entries_p);
+}
+
+// MANIPULATORS
+int LatencyProbe_ThreadBuffer::drain(const SpanCallback *callback)
+{
+    const bsls::Types::Int64 tail = d_tail.loadRelaxed();
+    const bsls::Types::Int64 head = d_head.loadAcquire();
+
+    for (bsls::Types::Int64 i = tail; i < head; ++i) {
+        const LatencyProbe_Entry& entry = d_entries_p[i & d_mask];
+
+        const bsls::Types::Int64 duration =
+                                     bsls::CycleCounter::convertToNanoseconds(
+                                        entry.d_endTicks - entry.d_startTicks);
+
+        entry.d_probe_p->update(duration);
+        if (callback) {
+            (*callback)(entry.d_probe_p,
+                        d_threadIndex,
+                        entry.d_depth,
+                        entry.d_startTicks,
+                        duration);
+        }
+    }
+
+    d_tail.storeRelease(head);
+
+    return static_cast<int>(head - tail);
+}
+
+                        // --------------------------
+                        // class LatencyProbeRecorder
+                        // --------------------------
+
+// PRIVATE MANIPULATORS
+int LatencyProbeRecorder::drainImp(
+                       const LatencyProbe_ThreadBuffer::SpanCallback *callback)
+{
+    bslmt::LockGuard<bslmt::Mutex> drainGuard(&d_drainLock);
+
+    bsl::vector<LatencyProbe_ThreadBuffer *> buffers(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_buffersLock);
+        buffers = d_bufferList;
+    }
+
+    int numDrained = 0;
+    for (bsl::size_t i = 0; i < buffers.size(); ++i) {
+        numDrained += buffers[i]->drain(callback);
+    }
+    return numDrained;
+}
+
+LatencyProbe_ThreadBuffer *LatencyProbeRecorder::lookupThreadBuffer()
+{
+    const bsls::Types::Uint64 threadId = bslmt::ThreadUtil::selfIdAsUint64();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_buffersLock);
+
+    BufferMap::iterator it = d_buffers.find(threadId);
+    if (it != d_buffers.end()) {
+        return it->second;                                            // RETURN
+    }
+
+    d_bufferList.reserve(d_bufferList.size() + 1);
+
+    LatencyProbe_ThreadBuffer *buffer =
+                  new (*d_allocator_p) LatencyProbe_ThreadBuffer(
+                                         d_bufferCapacity,
+                                         static_cast<int>(d_bufferList.size()),
+                                         d_allocator_p);
+
+    bslma::RawDeleterProctor<LatencyProbe_ThreadBuffer, bslma::Allocator>
+                                               proctor(buffer, d_allocator_p);
+
+    d_buffers.insert(bsl::make_pair(threadId, buffer));
+    d_bufferList.push_back(buffer);  // Capacity was reserved above.
+
+    proctor.release();
+    return buffer;
+}
+
+// CREATORS
+LatencyProbeRecorder::LatencyProbeRecorder(bslma::Allocator *basicAllocator)
+: d_id(bsls::AtomicOperations::addInt64NvRelaxed(&g_nextRecorderId, 1))
+, d_bufferCapacity(k_DEFAULT_BUFFER_CAPACITY)
+, d_buffers(basicAllocator)
+, d_bufferList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+LatencyProbeRecorder::LatencyProbeRecorder(int               bufferCapacity,
+                                           bslma::Allocator *basicAllocator)
+: d_id(bsls::AtomicOperations::addInt64NvRelaxed(&g_nextRecorderId, 1))
+, d_bufferCapacity(static_cast<int>(bdlb::BitUtil::roundUpToBinaryPower(
+                                 static_cast<bsl::uint32_t>(bufferCapacity))))
+, d_buffers(basicAllocator)
+, d_bufferList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < bufferCapacity);
+    BSLS_ASSERT(bufferCapacity <= 1 << 30);
+}
+
+LatencyProbeRecorder::~LatencyProbeRecorder()
+{
+    for (bsl::size_t i = 0; i < d_bufferList.size(); ++i) {
+        d_allocator_p->deleteObjectRaw(d_bufferList[i]);
+    }
+}
+
+// MANIPULATORS
+LatencyProbe_ThreadBuffer *LatencyProbeRecorder::threadBuffer()
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(g_cachedRecorderId == d_id)) {
+        return g_cachedBuffer;                                        // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    LatencyProbe_ThreadBuffer *buffer = lookupThreadBuffer();
+    g_cachedBuffer     = buffer;
+    g_cachedRecorderId = d_id;
+    return buffer;
+#else
+    return lookupThreadBuffer();
+#endif
+}
+
+// ACCESSORS
+bsls::Types::Int64 LatencyProbeRecorder::numDropped() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_buffersLock);
+
+    bsls::Types::Int64 numDropped = 0;
+    for (bsl::size_t i = 0; i < d_bufferList.size(); ++i) {
+        numDropped += d_bufferList[i]->numDropped();
+    }
+    return numDropped;
+}
+
+int LatencyProbeRecorder::numThreads() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_buffersLock);
+
+    return static_cast<int>(d_bufferList.size());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
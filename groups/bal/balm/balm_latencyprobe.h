@@ -0,0 +1,583 @@
+// balm_latencyprobe.h                                                -*-C++-*-
+#ifndef INCLUDED_BALM_LATENCYPROBE
+#define INCLUDED_BALM_LATENCYPROBE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide low-overhead scoped latency probes feeding histograms.
+//
+//@CLASSES:
+//   balm::LatencyProbeRecorder: per-thread buffers of completed probe spans
+//   balm::LatencyProbeGuard: scoped guard timing a span of code
+//
+//@SEE_ALSO: balm_histogramcollector, balm_stopwatchscopedguard,
+//           bsls_cyclecounter
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'balm::LatencyProbeRecorder', and a scoped guard, 'balm::LatencyProbeGuard',
+// for measuring the latency of spans of code that are executed so frequently
+// (or are so short) that the overhead of 'balm::StopwatchScopedGuard' is
+// significant.  A 'balm::LatencyProbeGuard' reads the processor's cycle
+// counter (see 'bsls_cyclecounter') on construction and destruction, and
+// appends the completed span to a buffer owned by the current thread.  The
+// spans are later *drained* from every thread's buffer by a call to
+// 'balm::LatencyProbeRecorder::drain' (typically from a thread other than
+// those being measured), which converts the duration of each span to
+// nanoseconds and records it in the 'balm::HistogramCollector' identifying
+// the probe.
+//
+// A *probe* is identified by the address of the 'balm::HistogramCollector'
+// into which its spans are drained; a probe's histogram collector is
+// typically obtained, once, from
+// 'balm::CollectorRepository::getDefaultHistogramCollector', so that the
+// quantiles of its latency are published with the other metrics of its
+// category (see {'balm_collectorrepository'|Histogram Collectors}).  Creating
+// a guard with a null probe address creates a disabled guard that does
+// nothing.
+//
+///Overhead
+///--------
+// In the common case, constructing and destroying a 'balm::LatencyProbeGuard'
+// performs two reads of the cycle counter, a thread-local lookup of the
+// current thread's buffer, and a store of the span into that buffer.  It
+// acquires no lock, performs no atomic read-modify-write operation, does not
+// allocate memory, and does not touch any cache line shared with other
+// threads (except when the buffer is full).  The first span recorded by a
+// thread for a given recorder allocates that thread's buffer.  Each thread
+// caches the buffer of the last recorder it used, so a thread alternating
+// between spans recorded to different recorders takes a slower path (that
+// locks a mutex) whenever the recorder changes; applications should
+// generally use a single recorder.
+//
+// If a thread records spans faster than they are drained, so that its buffer
+// (of 'bufferCapacity()' spans) fills, additional spans are discarded and
+// counted by 'numDropped'.
+//
+///Nested Spans and Tracing
+///------------------------
+// Guards on the same thread may be nested, and each span records its nesting
+// *depth* (0 for a span that was not started within another span of the same
+// recorder on the same thread) as well as the index of the thread that
+// recorded it.  In addition to updating the histogram collectors, 'drain'
+// optionally invokes a callback for every span drained, supplying its probe,
+// thread index, depth, starting tick count, and duration, which can be used
+// to reconstruct a trace of the nested spans executed on each thread.
+//
+///Draining Asynchronously
+///-----------------------
+// Spans are not reflected in the histogram collectors until they are drained.
+// An application publishing its metrics through a 'balm::MetricsManager' can
+// drain its recorder immediately before each collection of the probes'
+// category by registering a 'balm::MetricsManager::RecordsCollectionCallback'
+// (which the metrics manager invokes before collecting its repository) that
+// calls 'drain' and appends no records, e.g.:
+//..
+//  void drainProbes(balm::LatencyProbeRecorder      *recorder,
+//                   bsl::vector<balm::MetricRecord> *,
+//                   bool)
+//  {
+//      recorder->drain();
+//  }
+//
+//  // ...
+//
+//  manager.registerCollectionCallback(
+//                       "MyCategory",
+//                       bdlf::BindUtil::bind(&drainProbes,
+//                                            &recorder,
+//                                            bdlf::PlaceHolders::_1,
+//                                            bdlf::PlaceHolders::_2));
+//..
+// Alternatively, 'drain' may be invoked periodically by a
+// 'bdlmt::EventScheduler'.
+//
+///Thread Safety
+///-------------
+// 'balm::LatencyProbeRecorder' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  A 'balm::LatencyProbeGuard' object
+// must be destroyed by the thread that created it.  A thread's buffer is
+// retained by the recorder after the thread exits (and is reused by any
+// later thread having the same thread id), so the memory used by a recorder
+// grows with the number of distinct threads that use it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Latency of a Function
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to measure the distribution of the latency of a function
+// that is called very frequently.  We start by creating a 'balm::MetricId'
+// object by hand, but in practice, the probe's histogram collector should be
+// obtained from a 'balm::CollectorRepository' (such as the one owned by a
+// 'balm::MetricsManager'):
+//..
+//  balm::Category          myCategory("MyCategory");
+//  balm::MetricDescription description(&myCategory, "ProcessLatency");
+//  balm::MetricId          myMetric(&description);
+//
+//  balm::HistogramCollector probe(myMetric);
+//..
+// Next, we create a recorder, and calibrate the cycle counter at start-up so
+// that the first drain does not incur the cost of calibration:
+//..
+//  balm::LatencyProbeRecorder recorder;
+//  bsls::CycleCounter::calibrate();
+//..
+// Then, we place a guard at the top of the function we want to measure:
+//..
+//  void process(balm::HistogramCollector   *probe,
+//               balm::LatencyProbeRecorder *recorder)
+//  {
+//      balm::LatencyProbeGuard guard(probe, recorder);
+//
+//      // ... do work ...
+//  }
+//..
+// Now, we call the function a number of times:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      process(&probe, &recorder);
+//  }
+//..
+// Finally, we drain the recorder (typically from a publication thread), and
+// observe that the histogram collector reflects each call:
+//..
+//  assert(100 == recorder.drain());
+//
+//  balm::Histogram histogram;
+//  probe.load(&histogram);
+//  assert(100 == histogram.count());
+//  assert(0   == recorder.numDropped());
+//..
+
+#include <balscm_version.h>
+
+#include <balm_histogramcollector.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_cyclecounter.h>
+#include <bsls_types.h>
+
+#include <bsl_functional.h>
+#include <bsl_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                        // =========================
+                        // struct LatencyProbe_Entry
+                        // =========================
+
+struct LatencyProbe_Entry {
+    // This component-private 'struct' describes a completed span held in a
+    // 'LatencyProbe_ThreadBuffer'.
+
+    // PUBLIC DATA
+    HistogramCollector *d_probe_p;     // probe (held, not owned)
+    bsls::Types::Int64  d_startTicks;  // cycle counter at start
+    bsls::Types::Int64  d_endTicks;    // cycle counter at end
+    int                 d_depth;       // nesting depth
+};
+
+                       // ===============================
+                       // class LatencyProbe_ThreadBuffer
+                       // ===============================
+
+class LatencyProbe_ThreadBuffer {
+    // This component-private class provides a single-producer,
+    // single-consumer ring buffer of completed spans recorded by one thread.
+    // The producer (the owning thread) appends spans using 'leaveSpan', and
+    // the consumer (a thread holding the recorder's drain lock) removes them
+    // using 'drain'.
+
+    // PRIVATE TYPES
+    enum { k_CACHE_LINE_SIZE = 64 };
+
+    // DATA
+    bsls::AtomicInt64   d_head;           // index of the next span to append;
+                                          // modified only by the producer
+
+    int                 d_depth;          // current nesting depth; accessed
+                                          // only by the producer
+
+    char                d_producerPad[k_CACHE_LINE_SIZE];
+                                          // separates producer and consumer
+                                          // data
+
+    bsls::AtomicInt64   d_tail;           // index of the next span to
+                                          // drain; modified only by the
+                                          // consumer
+
+    bsls::AtomicInt64   d_numDropped;     // number of spans discarded
+                                          // because the buffer was full
+
+    LatencyProbe_Entry *d_entries_p;      // ring of spans (owned)
+
+    bsls::Types::Int64  d_mask;           // capacity - 1
+
+    int                 d_threadIndex;    // index of the owning thread
+
+    bslma::Allocator   *d_allocator_p;    // memory allocator (held, not
+                                          // owned)
+
+    // NOT IMPLEMENTED
+    LatencyProbe_ThreadBuffer(const LatencyProbe_ThreadBuffer&);
+    LatencyProbe_ThreadBuffer& operator=(const LatencyProbe_ThreadBuffer&);
+
+  public:
+    // TYPES
+    typedef bsl::function<void(const HistogramCollector *,
+                               int,
+                               int,
+                               bsls::Types::Int64,
+                               bsls::Types::Int64)> SpanCallback;
+        // 'SpanCallback' is an alias for the callback invoked by 'drain'; see
+        // 'LatencyProbeRecorder::SpanCallback'.
+
+    // CREATORS
+    LatencyProbe_ThreadBuffer(int               capacity,
+                              int               threadIndex,
+                              bslma::Allocator *basicAllocator);
+        // Create an empty buffer having the specified 'capacity' for the
+        // thread having the specified 'threadIndex', using the specified
+        // 'basicAllocator' to supply memory.  The behavior is undefined
+        // unless 'capacity' is a positive power of two.
+
+    ~LatencyProbe_ThreadBuffer();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int drain(const SpanCallback *callback);
+        // Record the duration of each span in this buffer in its probe,
+        // invoke the optionally specified 'callback' (if not 0) for each
+        // span, and remove the spans from this buffer.  Return the number of
+        // spans drained.  The behavior is undefined if this method is invoked
+        // concurrently with itself.
+
+    int enterSpan();
+        // Increment the nesting depth of the owning thread, and return its
+        // value before the increment.  The behavior is undefined unless this
+        // method is invoked by the thread owning this buffer.
+
+    void leaveSpan(HistogramCollector *probe,
+                   bsls::Types::Int64  startTicks,
+                   bsls::Types::Int64  endTicks,
+                   int                 depth);
+        // Restore the nesting depth of the owning thread to the specified
+        // 'depth', and append a span for the specified 'probe' having the
+        // specified 'startTicks', 'endTicks', and 'depth', unless this buffer
+        // is full, in which case increment the number of dropped spans.  The
+        // behavior is undefined unless this method is invoked by the thread
+        // owning this buffer.
+
+    // ACCESSORS
+    bsls::Types::Int64 numDropped() const;
+        // Return the number of spans discarded because this buffer was full.
+};
+
+                        // ==========================
+                        // class LatencyProbeRecorder
+                        // ==========================
+
+class LatencyProbeRecorder {
+    // This class provides a mechanism holding, for each thread that records a
+    // span, a buffer of the spans completed by that thread (see
+    // 'LatencyProbeGuard'), and draining those spans into the histogram
+    // collectors identifying their probes.
+
+    // PRIVATE TYPES
+    typedef bsl::map<bsls::Types::Uint64, LatencyProbe_ThreadBuffer *>
+                                                                   BufferMap;
+        // 'BufferMap' is an alias for a map from a thread id to the buffer
+        // of that thread.
+
+    // DATA
+    const bsls::Types::Int64   d_id;         // unique id of this recorder
+
+    const int                  d_bufferCapacity;
+                                             // capacity of each buffer
+
+    BufferMap                  d_buffers;    // buffer of each thread (owned)
+
+    bsl::vector<LatencyProbe_ThreadBuffer *>
+                               d_bufferList; // buffers in order of creation
+
+    mutable bslmt::Mutex       d_buffersLock;
+                                             // synchronizes access to
+                                             // 'd_buffers' and 'd_bufferList'
+
+    bslmt::Mutex               d_drainLock;  // serializes 'drain'
+
+    bslma::Allocator          *d_allocator_p;
+                                             // memory allocator (held, not
+                                             // owned)
+
+    // NOT IMPLEMENTED
+    LatencyProbeRecorder(const LatencyProbeRecorder&);
+    LatencyProbeRecorder& operator=(const LatencyProbeRecorder&);
+
+    // PRIVATE MANIPULATORS
+    LatencyProbe_ThreadBuffer *lookupThreadBuffer();
+        // Return the address of the buffer of the current thread, creating
+        // it if necessary.
+
+    int drainImp(const LatencyProbe_ThreadBuffer::SpanCallback *callback);
+        // Drain every buffer, invoking the optionally specified 'callback'
+        // (if not 0) for each span, and return the number of spans drained.
+
+  public:
+    // TYPES
+    typedef LatencyProbe_ThreadBuffer::SpanCallback SpanCallback;
+        // 'SpanCallback' is an alias for a callback invoked by 'drain' for
+        // each span drained, with the following signature:
+        //..
+        //  void (const HistogramCollector *probe,
+        //        int                       threadIndex,
+        //        int                       depth,
+        //        bsls::Types::Int64        startTicks,
+        //        bsls::Types::Int64        durationNanoseconds);
+        //..
+        // where 'threadIndex' identifies the thread that recorded the span
+        // (threads are numbered from 0 in the order of their first span),
+        // 'depth' is the nesting depth of the span on that thread, and
+        // 'startTicks' is the value of 'bsls::CycleCounter::now()' at the
+        // start of the span.
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_BUFFER_CAPACITY = 4096  // default spans per thread buffer
+    };
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(LatencyProbeRecorder,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit LatencyProbeRecorder(bslma::Allocator *basicAllocator = 0);
+    explicit LatencyProbeRecorder(int               bufferCapacity,
+                                  bslma::Allocator *basicAllocator = 0);
+        // Create a recorder having no thread buffers.  Optionally specify a
+        // 'bufferCapacity' indicating the minimum number of spans that each
+        // thread's buffer can hold; if 'bufferCapacity' is not specified,
+        // 'k_DEFAULT_BUFFER_CAPACITY' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < bufferCapacity <= 1 << 30'.  Note that the
+        // capacity is rounded up to a power of two.
+
+    ~LatencyProbeRecorder();
+        // Destroy this object, discarding any spans not yet drained.  The
+        // behavior is undefined unless no 'LatencyProbeGuard' referring to
+        // this recorder exists.
+
+    // MANIPULATORS
+    int drain();
+    int drain(const SpanCallback& callback);
+        // Record the duration, in nanoseconds, of every span recorded by any
+        // thread since the previous call to 'drain' in the histogram
+        // collector identifying its probe, and remove the spans from their
+        // buffers.  Optionally specify a 'callback' invoked for each span
+        // drained (see 'SpanCallback').  Return the number of spans drained.
+        // Spans completed concurrently with a call to 'drain' may be drained
+        // by that call or the next.  Note that spans of different threads
+        // are drained in order of the threads, and spans of the same thread
+        // are drained in order of completion (so that an enclosing span is
+        // drained after the spans nested within it).
+
+    LatencyProbe_ThreadBuffer *threadBuffer();
+        // Return the address of the buffer of the current thread, creating
+        // it if necessary.  Note that this method is intended for use by
+        // 'LatencyProbeGuard'.
+
+    // ACCESSORS
+    int bufferCapacity() const;
+        // Return the number of spans that each thread's buffer can hold.
+
+    bsls::Types::Int64 numDropped() const;
+        // Return the total number of spans discarded because a thread's
+        // buffer was full.
+
+    int numThreads() const;
+        // Return the number of threads having a buffer in this recorder.
+};
+
+                          // =======================
+                          // class LatencyProbeGuard
+                          // =======================
+
+class LatencyProbeGuard {
+    // This class provides a scoped guard recording the span of its own
+    // lifetime, for a probe, in the buffer of the current thread in a
+    // 'LatencyProbeRecorder'.
+
+    // DATA
+    HistogramCollector        *d_probe_p;     // probe (held, not owned)
+
+    LatencyProbe_ThreadBuffer *d_buffer_p;    // buffer of this thread, or 0
+                                              // if disabled
+
+    bsls::Types::Int64         d_startTicks;  // cycle counter at start
+
+    int                        d_depth;       // nesting depth of this span
+
+    // NOT IMPLEMENTED
+    LatencyProbeGuard(const LatencyProbeGuard&);
+    LatencyProbeGuard& operator=(const LatencyProbeGuard&);
+
+  public:
+    // CREATORS
+    LatencyProbeGuard(HistogramCollector   *probe,
+                      LatencyProbeRecorder *recorder);
+        // Create a guard that, if the specified 'probe' is not 0, records the
+        // span from its construction to its destruction for 'probe' in the
+        // specified 'recorder'.  If 'probe' is 0, this guard is disabled and
+        // has no effect.  The behavior is undefined unless 'recorder' is
+        // valid if 'probe' is not 0, and 'probe' and 'recorder' remain valid
+        // until this guard is destroyed and its span is drained.
+
+    ~LatencyProbeGuard();
+        // Record the span of this guard, unless it is disabled, and destroy
+        // this object.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if this guard records its span, and 'false'
+        // otherwise.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // -------------------------------
+                       // class LatencyProbe_ThreadBuffer
+                       // -------------------------------
+
+// MANIPULATORS
+inline
+int LatencyProbe_ThreadBuffer::enterSpan()
+{
+    return d_depth++;
+}
+
+inline
+void LatencyProbe_ThreadBuffer::leaveSpan(HistogramCollector *probe,
+                                          bsls::Types::Int64  startTicks,
+                                          bsls::Types::Int64  endTicks,
+                                          int                 depth)
+{
+    d_depth = depth;
+
+    const bsls::Types::Int64 head = d_head.loadRelaxed();
+    if (head - d_tail.loadAcquire() > d_mask) {
+        d_numDropped.addRelaxed(1);
+        return;                                                       // RETURN
+    }
+
+    LatencyProbe_Entry& entry = d_entries_p[head & d_mask];
+    entry.d_probe_p    = probe;
+    entry.d_startTicks = startTicks;
+    entry.d_endTicks   = endTicks;
+    entry.d_depth      = depth;
+
+    d_head.storeRelease(head + 1);
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 LatencyProbe_ThreadBuffer::numDropped() const
+{
+    return d_numDropped.loadRelaxed();
+}
+
+                        // --------------------------
+                        // class LatencyProbeRecorder
+                        // --------------------------
+
+// MANIPULATORS
+inline
+int LatencyProbeRecorder::drain()
+{
+    return drainImp(0);
+}
+
+inline
+int LatencyProbeRecorder::drain(const SpanCallback& callback)
+{
+    return drainImp(&callback);
+}
+
+// ACCESSORS
+inline
+int LatencyProbeRecorder::bufferCapacity() const
+{
+    return d_bufferCapacity;
+}
+
+                          // -----------------------
+                          // class LatencyProbeGuard
+                          // -----------------------
+
+// CREATORS
+inline
+LatencyProbeGuard::LatencyProbeGuard(HistogramCollector   *probe,
+                                     LatencyProbeRecorder *recorder)
+: d_probe_p(probe)
+, d_buffer_p(0)
+, d_startTicks(0)
+, d_depth(0)
+{
+    if (probe) {
+        d_buffer_p   = recorder->threadBuffer();
+        d_depth      = d_buffer_p->enterSpan();
+        d_startTicks = bsls::CycleCounter::now();
+    }
+}
+
+inline
+LatencyProbeGuard::~LatencyProbeGuard()
+{
+    if (d_buffer_p) {
+        const bsls::Types::Int64 endTicks = bsls::CycleCounter::now();
+        d_buffer_p->leaveSpan(d_probe_p, d_startTicks, endTicks, d_depth);
+    }
+}
+
+// ACCESSORS
+inline
+bool LatencyProbeGuard::isEnabled() const
+{
+    return 0 != d_buffer_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
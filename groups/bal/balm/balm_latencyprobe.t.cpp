@@ -0,0 +1,959 @@
+// balm_latencyprobe.t.cpp                                            -*-C++-*-
+#include <balm_latencyprobe.h>
+
+#include <balm_category.h>
+#include <balm_histogram.h>
+#include <balm_histogramcollector.h>
+#include <balm_metricdescription.h>
+#include <balm_metricid.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_cyclecounter.h>
+#include <bsls_stopwatch.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a recorder holding a single-producer,
+// single-consumer buffer of spans per thread, and a scoped guard recording
+// spans in that buffer.  We first test the component-private buffer, then the
+// recorder's management of per-thread buffers, then the guard (including
+// nested spans and disabled guards), and finally the concurrent recording and
+// draining of spans by several threads.
+// ----------------------------------------------------------------------------
+// LatencyProbe_ThreadBuffer
+// [ 2] LatencyProbe_ThreadBuffer(int, int, bslma::Allocator *);
+// [ 2] int drain(const SpanCallback *callback);
+// [ 2] int enterSpan();
+// [ 2] void leaveSpan(HistogramCollector *, Int64, Int64, int);
+// [ 2] Int64 numDropped() const;
+//
+// LatencyProbeRecorder
+// [ 3] explicit LatencyProbeRecorder(bslma::Allocator *basicAllocator = 0);
+// [ 3] LatencyProbeRecorder(int, bslma::Allocator *basicAllocator = 0);
+// [ 3] ~LatencyProbeRecorder();
+// [ 4] int drain();
+// [ 4] int drain(const SpanCallback& callback);
+// [ 3] LatencyProbe_ThreadBuffer *threadBuffer();
+// [ 3] int bufferCapacity() const;
+// [ 4] Int64 numDropped() const;
+// [ 3] int numThreads() const;
+//
+// LatencyProbeGuard
+// [ 4] LatencyProbeGuard(HistogramCollector *, LatencyProbeRecorder *);
+// [ 4] ~LatencyProbeGuard();
+// [ 4] bool isEnabled() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENT RECORDING AND DRAINING
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'LatencyProbeGuard' VERSUS 'bsls::Stopwatch'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::LatencyProbeRecorder      Obj;
+typedef balm::LatencyProbeGuard         Guard;
+typedef balm::LatencyProbe_ThreadBuffer Buffer;
+typedef balm::HistogramCollector        Probe;
+typedef balm::Histogram                 Histogram;
+typedef bsls::Types::Int64              Int64;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct SpanRecord {
+    // This 'struct' holds the attributes of a span supplied to a span
+    // callback.
+
+    const Probe *d_probe_p;
+    int          d_threadIndex;
+    int          d_depth;
+    Int64        d_startTicks;
+    Int64        d_duration;
+};
+
+void recordSpan(bsl::vector<SpanRecord> *spans,
+                const Probe             *probe,
+                int                      threadIndex,
+                int                      depth,
+                Int64                    startTicks,
+                Int64                    duration)
+    // Append a record of the span having the specified 'probe',
+    // 'threadIndex', 'depth', 'startTicks', and 'duration' to the specified
+    // 'spans'.
+{
+    SpanRecord record = { probe, threadIndex, depth, startTicks, duration };
+    spans->push_back(record);
+}
+
+Obj::SpanCallback spanCallback(bsl::vector<SpanRecord> *spans)
+    // Return a span callback appending to the specified 'spans'.
+{
+    using namespace bdlf::PlaceHolders;
+    return bdlf::BindUtil::bind(&recordSpan, spans, _1, _2, _3, _4, _5);
+}
+
+Int64 monotonicNanoseconds()
+    // Return the current time of the monotonic system clock in nanoseconds.
+{
+    return bsls::SystemTime::nowMonotonicClock().totalNanoseconds();
+}
+
+void spin(Int64 nanoseconds)
+    // Busy-wait for at least the specified 'nanoseconds'.
+{
+    const Int64 start = monotonicNanoseconds();
+    while (monotonicNanoseconds() - start < nanoseconds) {
+    }
+}
+
+void recordJob(Obj             *recorder,
+               Probe           *probe,
+               bslmt::Barrier  *barrier,
+               int              numSpans)
+    // Wait on the specified 'barrier', then record the specified 'numSpans'
+    // spans for the specified 'probe' in the specified 'recorder', each
+    // enclosing a nested span for 'probe'.
+{
+    barrier->wait();
+    for (int i = 0; i < numSpans; ++i) {
+        Guard outer(probe, recorder);
+        Guard inner(probe, recorder);
+    }
+}
+
+void drainJob(Obj *recorder, bsls::AtomicInt *done, bsls::AtomicInt64 *total)
+    // Drain the specified 'recorder' until the specified 'done' flag is set,
+    // then drain it once more, accumulating the number of spans drained in
+    // the specified 'total'.
+{
+    while (!done->load()) {
+        total->add(recorder->drain());
+        bslmt::ThreadUtil::yield();
+    }
+    total->add(recorder->drain());
+}
+
+void getThreadBuffer(Obj *recorder, Buffer **result)
+    // Load into the specified 'result' the address of the current thread's
+    // buffer in the specified 'recorder'.
+{
+    *result = recorder->threadBuffer();
+}
+
+void process(balm::HistogramCollector   *probe,
+             balm::LatencyProbeRecorder *recorder)
+    // Do work measured by the specified 'probe' in the specified 'recorder'.
+{
+    balm::LatencyProbeGuard guard(probe, recorder);
+
+    // ... do work ...
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    balm::Category          myCategory("MyCategory");
+    balm::MetricDescription descA(&myCategory, "A");
+    balm::MetricDescription descB(&myCategory, "B");
+
+    const balm::MetricId METRIC_A(&descA);
+    const balm::MetricId METRIC_B(&descB);
+
+    bsls::CycleCounter::calibrate();
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Latency of a Function
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to measure the distribution of the latency of a function
+// that is called very frequently.  We start by creating a 'balm::MetricId'
+// object by hand, but in practice, the probe's histogram collector should be
+// obtained from a 'balm::CollectorRepository' (such as the one owned by a
+// 'balm::MetricsManager'):
+//..
+    balm::Category          myCategory("MyCategory");
+    balm::MetricDescription description(&myCategory, "ProcessLatency");
+    balm::MetricId          myMetric(&description);
+
+    balm::HistogramCollector probe(myMetric);
+//..
+// Next, we create a recorder, and calibrate the cycle counter at start-up so
+// that the first drain does not incur the cost of calibration:
+//..
+    balm::LatencyProbeRecorder recorder;
+    bsls::CycleCounter::calibrate();
+//..
+// Then, we place a guard at the top of the function we want to measure:
+//..
+//  void process(balm::HistogramCollector   *probe,
+//               balm::LatencyProbeRecorder *recorder)
+//  {
+//      balm::LatencyProbeGuard guard(probe, recorder);
+//
+//      // ... do work ...
+//  }
+//..
+// Now, we call the function a number of times:
+//..
+    for (int i = 0; i < 100; ++i) {
+        process(&probe, &recorder);
+    }
+//..
+// Finally, we drain the recorder (typically from a publication thread), and
+// observe that the histogram collector reflects each call:
+//..
+    ASSERT(100 == recorder.drain());
+
+    balm::Histogram histogram;
+    probe.load(&histogram);
+    ASSERT(100 == histogram.count());
+    ASSERT(0   == recorder.numDropped());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENT RECORDING AND DRAINING
+        //
+        // Concerns:
+        //: 1 Spans recorded concurrently by several threads, while another
+        //:   thread drains the recorder, are each drained exactly once or
+        //:   counted as dropped.
+        //:
+        //: 2 Each thread is assigned its own buffer and thread index.
+        //
+        // Plan:
+        //: 1 Have several threads record nested spans in a recorder having
+        //:   small buffers, while another thread repeatedly drains it.
+        //:   Verify that the number of spans drained plus the number dropped
+        //:   equals the number recorded, and that the probe's histogram
+        //:   reflects the spans drained.  (C-1)
+        //:
+        //: 2 Drain the spans of a second run with a callback, and verify the
+        //:   thread indices.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENT RECORDING AND DRAINING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT RECORDING AND DRAINING" << endl
+                          << "=================================" << endl;
+
+        const int NUM_THREADS = 4;
+        const int NUM_SPANS   = 20000;
+        const int NUM_TOTAL   = NUM_THREADS * NUM_SPANS * 2;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj   mX(256, &oa); const Obj& X = mX;
+        Probe probe(METRIC_A, &oa);
+
+        bsls::AtomicInt    done(0);
+        bsls::AtomicInt64  drained(0);
+        bslmt::Barrier     barrier(NUM_THREADS);
+        bslmt::ThreadGroup recorders;
+        bslmt::ThreadGroup drainer;
+
+        ASSERT(0 == drainer.addThread(bdlf::BindUtil::bind(&drainJob,
+                                                           &mX,
+                                                           &done,
+                                                           &drained)));
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            ASSERT(0 == recorders.addThread(bdlf::BindUtil::bind(&recordJob,
+                                                                 &mX,
+                                                                 &probe,
+                                                                 &barrier,
+                                                                 NUM_SPANS)));
+        }
+        recorders.joinAll();
+        done.store(1);
+        drainer.joinAll();
+
+        if (veryVerbose) { P_(drained) P(X.numDropped()) }
+
+        ASSERTV(X.numThreads(), NUM_THREADS == X.numThreads());
+        ASSERTV(drained, X.numDropped(),
+                NUM_TOTAL == drained + X.numDropped());
+
+        Histogram histogram;
+        probe.load(&histogram);
+        ASSERTV(histogram.count(), drained == histogram.count());
+
+        // Second run, drained with a callback once all threads complete.
+
+        Obj   mY(NUM_SPANS * 2, &oa); const Obj& Y = mY;
+        bslmt::Barrier barrier2(NUM_THREADS);
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            ASSERT(0 == recorders.addThread(bdlf::BindUtil::bind(&recordJob,
+                                                                 &mY,
+                                                                 &probe,
+                                                                 &barrier2,
+                                                                 NUM_SPANS)));
+        }
+        recorders.joinAll();
+
+        bsl::vector<SpanRecord> spans;
+        ASSERT(NUM_TOTAL == mY.drain(spanCallback(&spans)));
+        ASSERT(0         == Y.numDropped());
+        ASSERT(NUM_TOTAL == static_cast<int>(spans.size()));
+
+        int counts[NUM_THREADS] = { 0 };
+        for (bsl::size_t i = 0; i < spans.size(); ++i) {
+            ASSERTV(i, 0 <= spans[i].d_threadIndex);
+            ASSERTV(i, NUM_THREADS > spans[i].d_threadIndex);
+            if (0 <= spans[i].d_threadIndex
+             && NUM_THREADS > spans[i].d_threadIndex) {
+                ++counts[spans[i].d_threadIndex];
+            }
+        }
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            ASSERTV(i, counts[i], NUM_SPANS * 2 == counts[i]);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'LatencyProbeGuard' AND 'drain'
+        //
+        // Concerns:
+        //: 1 A guard records a span whose duration is that of its lifetime.
+        //:
+        //: 2 A guard having a null probe is disabled, and records nothing.
+        //:
+        //: 3 Nested guards record their nesting depth, and the depth is
+        //:   restored when a guard is destroyed.
+        //:
+        //: 4 'drain' records each span in its probe, invokes the callback (if
+        //:   any) for each span in order of completion, and returns the number
+        //:   of spans drained.
+        //:
+        //: 5 Spans beyond the capacity of a buffer are dropped and counted.
+        //
+        // Plan:
+        //: 1 Record spans of known minimum duration, and verify the drained
+        //:   durations.  (C-1)
+        //:
+        //: 2 Create a disabled guard, and verify nothing is drained.  (C-2)
+        //:
+        //: 3 Record nested spans for two probes, drain them with a callback,
+        //:   and verify the order, depth, and probe of each span.  (C-3..4)
+        //:
+        //: 4 Record more spans than the capacity of a buffer, and verify
+        //:   'numDropped'.  (C-5)
+        //
+        // Testing:
+        //   int drain();
+        //   int drain(const SpanCallback& callback);
+        //   Int64 numDropped() const;
+        //   LatencyProbeGuard(HistogramCollector *, LatencyProbeRecorder *);
+        //   ~LatencyProbeGuard();
+        //   bool isEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'LatencyProbeGuard' AND 'drain'" << endl
+                          << "===============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Probe probeA(METRIC_A, &oa);
+        Probe probeB(METRIC_B, &oa);
+
+        const Int64 NUM_PROBE_BLOCKS = oa.numBlocksInUse();
+
+        if (verbose) cout << "\tDuration." << endl;
+        {
+            Obj mX(&oa);
+
+            const Int64 DURATION = 2 * 1000 * 1000;
+            for (int i = 0; i < 3; ++i) {
+                Guard guard(&probeA, &mX);
+                ASSERT(guard.isEnabled());
+                spin(DURATION);
+            }
+
+            bsl::vector<SpanRecord> spans;
+            ASSERT(3 == mX.drain(spanCallback(&spans)));
+            ASSERT(3 == spans.size());
+            for (bsl::size_t i = 0; i < spans.size(); ++i) {
+                if (veryVerbose) { P(spans[i].d_duration) }
+
+                ASSERTV(i, &probeA == spans[i].d_probe_p);
+                ASSERTV(i, spans[i].d_duration, DURATION - DURATION / 20 <=
+                                                         spans[i].d_duration);
+                ASSERTV(i, spans[i].d_duration, DURATION * 10 >=
+                                                         spans[i].d_duration);
+            }
+
+            Histogram histogram;
+            probeA.loadAndReset(&histogram);
+            ASSERT(3 == histogram.count());
+            ASSERT(spans[0].d_duration + spans[1].d_duration +
+                                   spans[2].d_duration == histogram.total());
+
+            ASSERT(0 == mX.drain());
+        }
+
+        if (verbose) cout << "\tDisabled guard." << endl;
+        {
+            Obj mX(&oa); const Obj& X = mX;
+            {
+                Guard guard(0, &mX);
+                ASSERT(!guard.isEnabled());
+            }
+            {
+                Guard guard(0, 0);
+                ASSERT(!guard.isEnabled());
+            }
+            ASSERT(0 == mX.drain());
+            ASSERT(0 == X.numThreads());
+        }
+
+        if (verbose) cout << "\tNested spans." << endl;
+        {
+            Obj mX(&oa);
+            {
+                Guard g0(&probeA, &mX);
+                {
+                    Guard g1(&probeB, &mX);
+                    {
+                        Guard g2(&probeA, &mX);
+                    }
+                    Guard g3(0, &mX);
+                    Guard g4(&probeB, &mX);
+                }
+                Guard g5(&probeB, &mX);
+            }
+            {
+                Guard g6(&probeA, &mX);
+            }
+
+            static const struct {
+                int          d_line;
+                const Probe *d_probe_p;
+                int          d_depth;
+            } DATA[] = {
+                { L_, &probeA, 2 },  // g2
+                { L_, &probeB, 2 },  // g4
+                { L_, &probeB, 1 },  // g1
+                { L_, &probeB, 1 },  // g5
+                { L_, &probeA, 0 },  // g0
+                { L_, &probeA, 0 },  // g6
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            bsl::vector<SpanRecord> spans;
+            ASSERT(NUM_DATA == mX.drain(spanCallback(&spans)));
+            ASSERT(NUM_DATA == static_cast<int>(spans.size()));
+
+            for (int i = 0; i < NUM_DATA && i < (int)spans.size(); ++i) {
+                const int LINE = DATA[i].d_line;
+
+                ASSERTV(LINE, DATA[i].d_probe_p == spans[i].d_probe_p);
+                ASSERTV(LINE, DATA[i].d_depth   == spans[i].d_depth);
+                ASSERTV(LINE, 0                 == spans[i].d_threadIndex);
+                ASSERTV(LINE, 0                 <= spans[i].d_duration);
+            }
+
+            // The outermost span encloses the others.
+
+            ASSERT(spans[4].d_startTicks <= spans[2].d_startTicks);
+            ASSERT(spans[2].d_startTicks <= spans[0].d_startTicks);
+            ASSERT(spans[4].d_duration   >= spans[2].d_duration);
+
+            Histogram histogram;
+            probeA.loadAndReset(&histogram);
+            ASSERT(3 == histogram.count());
+            probeB.loadAndReset(&histogram);
+            ASSERT(3 == histogram.count());
+        }
+
+        if (verbose) cout << "\tDropped spans." << endl;
+        {
+            Obj mX(4, &oa); const Obj& X = mX;
+            for (int i = 0; i < 10; ++i) {
+                Guard guard(&probeA, &mX);
+            }
+            ASSERT(6 == X.numDropped());
+            ASSERT(4 == mX.drain());
+
+            for (int i = 0; i < 3; ++i) {
+                Guard guard(&probeA, &mX);
+            }
+            ASSERT(6 == X.numDropped());
+            ASSERT(3 == mX.drain());
+
+            Histogram histogram;
+            probeA.loadAndReset(&histogram);
+            ASSERT(7 == histogram.count());
+        }
+        ASSERT(NUM_PROBE_BLOCKS == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'LatencyProbeRecorder' CREATORS AND 'threadBuffer'
+        //
+        // Concerns:
+        //: 1 A recorder initially has no thread buffers, and has the default
+        //:   or specified (rounded up to a power of two) buffer capacity.
+        //:
+        //: 2 'threadBuffer' returns the same buffer on repeated calls by the
+        //:   same thread, and distinct buffers for distinct threads and
+        //:   distinct recorders, even when a thread alternates between
+        //:   recorders.
+        //:
+        //: 3 A recorder created at the address of a destroyed recorder does
+        //:   not return the destroyed recorder's buffers.
+        //:
+        //: 4 Memory is supplied by the specified allocator, and released on
+        //:   destruction.
+        //:
+        //: 5 QoI: asserted precondition violations are detected.
+        //
+        // Plan:
+        //: 1 Create recorders and obtain buffers from several threads, and
+        //:   verify the buffers returned and memory used.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   explicit LatencyProbeRecorder(bslma::Allocator *basicAllocator);
+        //   LatencyProbeRecorder(int, bslma::Allocator *basicAllocator);
+        //   ~LatencyProbeRecorder();
+        //   LatencyProbe_ThreadBuffer *threadBuffer();
+        //   int bufferCapacity() const;
+        //   int numThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                    << "'LatencyProbeRecorder' CREATORS AND 'threadBuffer'"
+                    << endl
+                    << "=================================================="
+                    << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        {
+            Obj mX; const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_BUFFER_CAPACITY == X.bufferCapacity());
+            ASSERT(0                              == X.numThreads());
+
+            Buffer *buffer = mX.threadBuffer();
+            ASSERT(0      <  da.numBlocksInUse());
+            ASSERT(buffer == mX.threadBuffer());
+            ASSERT(1      == X.numThreads());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        {
+            ASSERT(1    == Obj(1,    &oa).bufferCapacity());
+            ASSERT(2    == Obj(2,    &oa).bufferCapacity());
+            ASSERT(4    == Obj(3,    &oa).bufferCapacity());
+            ASSERT(1024 == Obj(1000, &oa).bufferCapacity());
+            ASSERT(1024 == Obj(1024, &oa).bufferCapacity());
+        }
+
+        {
+            Obj mX(&oa); const Obj& X = mX;
+            Obj mY(&oa); const Obj& Y = mY;
+
+            Buffer *bufferX = mX.threadBuffer();
+            Buffer *bufferY = mY.threadBuffer();
+            ASSERT(bufferX != bufferY);
+
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(bufferX == mX.threadBuffer());
+                ASSERT(bufferY == mY.threadBuffer());
+            }
+            ASSERT(1 == X.numThreads());
+            ASSERT(1 == Y.numThreads());
+
+            Buffer *other = 0;
+            bslmt::ThreadGroup threads;
+            ASSERT(0 == threads.addThread(bdlf::BindUtil::bind(
+                                                              &getThreadBuffer,
+                                                              &mX,
+                                                              &other)));
+            threads.joinAll();
+            ASSERT(0       != other);
+            ASSERT(bufferX != other);
+            ASSERT(2       == X.numThreads());
+            ASSERT(1       == Y.numThreads());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        {
+            // A new recorder, possibly at the same address as a destroyed
+            // one, must not use the stale cached buffer.
+
+            for (int i = 0; i < 4; ++i) {
+                Obj mX(&oa); const Obj& X = mX;
+                ASSERT(0 == X.numThreads());
+                mX.threadBuffer();
+                ASSERT(1 == X.numThreads());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(0, &oa));
+            ASSERT_PASS(Obj(1, &oa));
+            ASSERT_PASS(Obj(1 << 30, &oa));
+            ASSERT_FAIL(Obj((1 << 30) + 1, &oa));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'LatencyProbe_ThreadBuffer'
+        //
+        // Concerns:
+        //: 1 'enterSpan' returns the current depth and increments it, and
+        //:   'leaveSpan' restores it.
+        //:
+        //: 2 'leaveSpan' appends spans until the buffer is full, and then
+        //:   counts dropped spans.
+        //:
+        //: 3 'drain' records the duration of each span in its probe, invokes
+        //:   the callback (if any) for each span in order, and empties the
+        //:   buffer, such that the buffer can be reused indefinitely.
+        //:
+        //: 4 Memory is supplied by the specified allocator, and released on
+        //:   destruction.
+        //
+        // Plan:
+        //: 1 Append spans with known ticks to a small buffer, and drain them,
+        //:   repeatedly, verifying the spans drained.  (C-1..4)
+        //
+        // Testing:
+        //   LatencyProbe_ThreadBuffer(int, int, bslma::Allocator *);
+        //   int drain(const SpanCallback *callback);
+        //   int enterSpan();
+        //   void leaveSpan(HistogramCollector *, Int64, Int64, int);
+        //   Int64 numDropped() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'LatencyProbe_ThreadBuffer'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Probe probe(METRIC_A, &oa);
+
+        const double RATE = bsls::CycleCounter::nanosecondsPerTick();
+        const Int64  NUM_PROBE_BLOCKS = oa.numBlocksInUse();
+        {
+            Buffer mX(8, 3, &oa);
+            ASSERT(NUM_PROBE_BLOCKS + 1 == oa.numBlocksInUse());
+
+            ASSERT(0 == mX.enterSpan());
+            ASSERT(1 == mX.enterSpan());
+            mX.leaveSpan(&probe, 100, 200, 1);
+            ASSERT(1 == mX.enterSpan());
+            mX.leaveSpan(&probe, 300, 400, 1);
+            mX.leaveSpan(&probe, 0, 1000000, 0);
+            ASSERT(0 == mX.enterSpan());
+            mX.leaveSpan(&probe, 0, 0, 0);
+
+            bsl::vector<SpanRecord> spans;
+            Obj::SpanCallback       callback = spanCallback(&spans);
+            ASSERT(4 == mX.drain(&callback));
+            ASSERT(4 == spans.size());
+
+            static const struct {
+                int   d_line;
+                int   d_depth;
+                Int64 d_startTicks;
+                Int64 d_ticks;
+            } DATA[] = {
+                { L_, 1, 100,       100 },
+                { L_, 1, 300,       100 },
+                { L_, 0,   0,   1000000 },
+                { L_, 0,   0,         0 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int   LINE = DATA[i].d_line;
+                const Int64 EXP  = bsls::CycleCounter::convertToNanoseconds(
+                                                              DATA[i].d_ticks);
+
+                ASSERTV(LINE, &probe             == spans[i].d_probe_p);
+                ASSERTV(LINE, 3                  == spans[i].d_threadIndex);
+                ASSERTV(LINE, DATA[i].d_depth    == spans[i].d_depth);
+                ASSERTV(LINE, DATA[i].d_startTicks == spans[i].d_startTicks);
+                ASSERTV(LINE, EXP                == spans[i].d_duration);
+            }
+            if (veryVerbose) { P(RATE) }
+
+            Histogram histogram;
+            probe.loadAndReset(&histogram);
+            ASSERT(4 == histogram.count());
+            ASSERT(0 == histogram.min());
+
+            // Fill and overflow the buffer repeatedly.
+
+            for (int round = 0; round < 5; ++round) {
+                for (int i = 0; i < 10; ++i) {
+                    const int depth = mX.enterSpan();
+                    ASSERTV(round, i, 0 == depth);
+                    mX.leaveSpan(&probe, i, i + 1, depth);
+                }
+                ASSERTV(round, 2 * (round + 1) == mX.numDropped());
+                ASSERTV(round, 8 == mX.drain(0));
+                ASSERTV(round, 0 == mX.drain(0));
+            }
+            probe.loadAndReset(&histogram);
+            ASSERT(40 == histogram.count());
+        }
+        ASSERT(NUM_PROBE_BLOCKS == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The classes are sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Record spans using guards, drain the recorder, and verify the
+        //:   probe's histogram.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Probe probe(METRIC_A);
+        Obj   mX;   const Obj& X = mX;
+
+        for (int i = 0; i < 10; ++i) {
+            Guard guard(&probe, &mX);
+        }
+        ASSERT(1  == X.numThreads());
+        ASSERT(10 == mX.drain());
+        ASSERT(0  == mX.drain());
+        ASSERT(0  == X.numDropped());
+
+        Histogram histogram;
+        probe.load(&histogram);
+        ASSERT(10 == histogram.count());
+
+        if (veryVerbose) { P(histogram) }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'LatencyProbeGuard' VERSUS 'bsls::Stopwatch'
+        //
+        // Concerns:
+        //: 1 The overhead of a 'LatencyProbeGuard' is a few nanoseconds, and
+        //:   substantially less than that of timing with 'bsls::Stopwatch'.
+        //
+        // Plan:
+        //: 1 Time a large number of empty guarded scopes, draining
+        //:   periodically, and compare with a 'bsls::Stopwatch' started and
+        //:   stopped in each scope.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'LatencyProbeGuard' VERSUS 'bsls::Stopwatch'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: 'LatencyProbeGuard' VERSUS 'bsls::Stopwatch'"
+             << endl
+             << "========================================================="
+             << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 10000000;
+        const int BATCH          = Obj::k_DEFAULT_BUFFER_CAPACITY;
+
+        Probe probe(METRIC_A);
+        Obj   mX;
+
+        Int64 drainTime = 0;
+        Int64 start     = monotonicNanoseconds();
+        for (int i = 0; i < NUM_ITERATIONS; i += BATCH) {
+            for (int j = 0; j < BATCH; ++j) {
+                Guard guard(&probe, &mX);
+            }
+            const Int64 drainStart = monotonicNanoseconds();
+            mX.drain();
+            drainTime += monotonicNanoseconds() - drainStart;
+        }
+        const Int64 guardTime = monotonicNanoseconds() - start - drainTime;
+
+        double sink = 0;
+        start = monotonicNanoseconds();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            bsls::Stopwatch stopwatch;
+            stopwatch.start();
+            stopwatch.stop();
+            sink += stopwatch.accumulatedWallTime();
+        }
+        const Int64 stopwatchTime = monotonicNanoseconds() - start;
+
+        cout << "LatencyProbeGuard: "
+             << static_cast<double>(guardTime) / NUM_ITERATIONS
+             << " ns/scope (drain: "
+             << static_cast<double>(drainTime) / NUM_ITERATIONS
+             << " ns/span)" << endl
+             << "bsls::Stopwatch:   "
+             << static_cast<double>(stopwatchTime) / NUM_ITERATIONS
+             << " ns/scope" << endl;
+        if (veryVerbose) { P(sink) }
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
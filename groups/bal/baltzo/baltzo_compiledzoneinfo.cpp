@@ -0,0 +1,151 @@
+// baltzo_compiledzoneinfo.cpp                                        -*-C++-*-
+#include <baltzo_compiledzoneinfo.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baltzo_compiledzoneinfo_cpp,"$Id$ $CSID$")
+
+#include <baltzo_errorcode.h>
+#include <baltzo_localtimedescriptor.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace baltzo {
+
+                           // ----------------------
+                           // class CompiledZoneinfo
+                           // ----------------------
+
+// PRIVATE ACCESSORS
+int CompiledZoneinfo::findTransitionIndexOutOfRange(TimeT64 utcTime) const
+{
+    // The last element of 'd_utcTimes' is the sentinel, which is excluded from
+    // the search.
+
+    const bsl::vector<TimeT64>::const_iterator it =
+                                  bsl::upper_bound(d_utcTimes.begin(),
+                                                   d_utcTimes.end() - 1,
+                                                   utcTime);
+
+    return d_utcTimes.begin() == it
+         ? 0
+         : static_cast<int>(it - d_utcTimes.begin()) - 1;
+}
+
+// PRIVATE MANIPULATORS
+void CompiledZoneinfo::compile(const Zoneinfo& zoneinfo)
+{
+    d_utcTimes.reserve(zoneinfo.numTransitions() + 1);
+    d_offsets.reserve(zoneinfo.numTransitions());
+
+    for (Zoneinfo::TransitionConstIterator it = zoneinfo.beginTransitions();
+         it != zoneinfo.endTransitions();
+         ++it) {
+        d_utcTimes.push_back(it->utcTime());
+        d_offsets.push_back(it->descriptor().utcOffsetInSeconds());
+    }
+    d_utcTimes.push_back(bsl::numeric_limits<TimeT64>::max());
+
+    d_rangeBegin = bdlt::EpochUtil::convertToTimeT64(
+                                          bdlt::Datetime(d_firstYear, 1, 1));
+    d_rangeEnd   = bdlt::EpochUtil::convertToTimeT64(
+                                         bdlt::Datetime(d_lastYear, 12, 31))
+                 + 24 * 60 * 60;
+
+    const TimeT64 numBuckets =
+                   ((d_rangeEnd - d_rangeBegin - 1) >> k_BUCKET_SHIFT) + 1;
+
+    d_buckets.reserve(static_cast<bsl::size_t>(numBuckets));
+
+    int index = 0;
+    for (TimeT64 bucket = 0; bucket < numBuckets; ++bucket) {
+        const TimeT64 bucketBegin = d_rangeBegin
+                                  + (bucket << k_BUCKET_SHIFT);
+        while (d_utcTimes[index + 1] <= bucketBegin) {
+            ++index;
+        }
+        d_buckets.push_back(index);
+    }
+}
+
+// CREATORS
+CompiledZoneinfo::CompiledZoneinfo(const Zoneinfo&        zoneinfo,
+                                   const allocator_type&  allocator)
+: d_utcTimes(allocator)
+, d_offsets(allocator)
+, d_buckets(allocator)
+, d_rangeBegin(0)
+, d_rangeEnd(0)
+, d_firstYear(k_DEFAULT_FIRST_YEAR)
+, d_lastYear(k_DEFAULT_LAST_YEAR)
+, d_identifier(zoneinfo.identifier(), allocator)
+{
+    BSLS_ASSERT(0 < zoneinfo.numTransitions());
+
+    compile(zoneinfo);
+}
+
+CompiledZoneinfo::CompiledZoneinfo(const Zoneinfo&        zoneinfo,
+                                   int                    firstYear,
+                                   int                    lastYear,
+                                   const allocator_type&  allocator)
+: d_utcTimes(allocator)
+, d_offsets(allocator)
+, d_buckets(allocator)
+, d_rangeBegin(0)
+, d_rangeEnd(0)
+, d_firstYear(firstYear)
+, d_lastYear(lastYear)
+, d_identifier(zoneinfo.identifier(), allocator)
+{
+    BSLS_ASSERT(1         <= firstYear);
+    BSLS_ASSERT(firstYear <= lastYear);
+    BSLS_ASSERT(lastYear  <= 9999);
+    BSLS_ASSERT(0 < zoneinfo.numTransitions());
+
+    compile(zoneinfo);
+}
+
+CompiledZoneinfo::~CompiledZoneinfo()
+{
+    BSLS_ASSERT(d_utcTimes.size() == d_offsets.size() + 1);
+}
+
+// ACCESSORS
+int CompiledZoneinfo::convertUtcToLocalTime(
+                                         bdlt::DatetimeTz      *result,
+                                         const bdlt::Datetime&  utcTime) const
+{
+    BSLS_ASSERT(result);
+
+    const int offsetInMinutes = utcOffsetInSeconds(
+                              bdlt::EpochUtil::convertToTimeT64(utcTime)) / 60;
+
+    bdlt::Datetime temp(utcTime);
+    if (0 != temp.addMinutesIfValid(offsetInMinutes)) {
+        return ErrorCode::k_OUT_OF_RANGE;                             // RETURN
+    }
+
+    result->setDatetimeTz(temp, offsetInMinutes);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,362 @@
+// baltzo_compiledzoneinfo.h                                          -*-C++-*-
+#ifndef INCLUDED_BALTZO_COMPILEDZONEINFO
+#define INCLUDED_BALTZO_COMPILEDZONEINFO
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a constant-time lookup table of a time zone's UTC offsets.
+//
+//@CLASSES:
+//  baltzo::CompiledZoneinfo: immutable table of the UTC offsets of a zone
+//
+//@SEE_ALSO: baltzo_zoneinfo, baltzo_zoneinfoutil, baltzo_zoneinfocache
+//
+//@DESCRIPTION: This component provides an immutable mechanism,
+// 'baltzo::CompiledZoneinfo', that is built ("compiled") from a
+// well-formed 'baltzo::Zoneinfo' object, and that returns the UTC offset in
+// effect at a UTC time in constant time for every time within a range of
+// years supplied on construction (by default, 'k_DEFAULT_FIRST_YEAR' to
+// 'k_DEFAULT_LAST_YEAR').  A 'baltzo::Zoneinfo' locates the transition in
+// effect at a UTC time by a binary search of its transitions, which, for a
+// typical time zone having a few hundred transitions, takes about nine
+// dependent, poorly predicted comparisons.  A 'baltzo::CompiledZoneinfo'
+// copies the UTC times and offsets of the transitions into two flat arrays,
+// and divides its range into buckets of '2 ^ k_BUCKET_SHIFT' seconds (about
+// 24 days), recording, for each bucket, the index of the transition in effect
+// at its start.  A lookup therefore computes the bucket of the time with a
+// subtraction and a shift, and then advances past the transitions (almost
+// always none, and at most a few) that occur within the bucket before the
+// time.  Times outside of the range are looked up by binary search, so that
+// the result is the same for every time, only the cost differs.
+//
+// The table of a time zone having a range of 'N' years occupies about '60 * N'
+// bytes, in addition to 12 bytes per transition; the default range of 131
+// years therefore costs less than 8K per time zone.
+//
+// 'convertUtcToLocalTime' has the same contract as
+// 'baltzo::ZoneinfoUtil::convertUtcToLocalTime', except that it does not
+// supply the transition that was applied.
+//
+///Thread Safety
+///-------------
+// 'baltzo::CompiledZoneinfo' objects are immutable once constructed, and their
+// accessors may therefore be called simultaneously from multiple threads.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Converting Many UTC Times to Local Times
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to convert a large number of UTC times to local time in
+// New York.  We compile the time-zone information once, and use the compiled
+// table for every conversion.
+//
+// First, we create a 'baltzo::Zoneinfo' for New York having, after the initial
+// transition, the transitions of 2010:
+//..
+//  baltzo::LocalTimeDescriptor est(-5 * 60 * 60, false, "EST");
+//  baltzo::LocalTimeDescriptor edt(-4 * 60 * 60, true,  "EDT");
+//
+//  typedef bdlt::EpochUtil EpochUtil;
+//
+//  baltzo::Zoneinfo newYork;
+//  newYork.setIdentifier("America/New_York");
+//  newYork.addTransition(EpochUtil::convertToTimeT64(bdlt::Datetime(1, 1, 1)),
+//                        est);
+//  newYork.addTransition(
+//                 EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 3, 14, 7)),
+//                 edt);
+//  newYork.addTransition(
+//                 EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 11, 7, 6)),
+//                 est);
+//..
+// Then, we compile it:
+//..
+//  baltzo::CompiledZoneinfo compiled(newYork);
+//
+//  assert("America/New_York" == compiled.identifier());
+//  assert(3                  == compiled.numTransitions());
+//..
+// Now, we convert a UTC time in summer to local time:
+//..
+//  bdlt::DatetimeTz localTime;
+//  int rc = compiled.convertUtcToLocalTime(&localTime,
+//                                          bdlt::Datetime(2010, 7, 1, 12));
+//  assert(0                             == rc);
+//  assert(bdlt::Datetime(2010, 7, 1, 8) == localTime.localDatetime());
+//  assert(-4 * 60                       == localTime.offset());
+//..
+// Finally, we observe that the offset in effect at a UTC time can also be
+// obtained directly:
+//..
+//  const bdlt::EpochUtil::TimeT64 december =
+//                    EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 12, 1));
+//
+//  assert(-5 * 60 * 60 == compiled.utcOffsetInSeconds(december));
+//..
+
+#include <balscm_version.h>
+
+#include <baltzo_zoneinfo.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_epochutil.h>
+
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baltzo {
+
+                           // ======================
+                           // class CompiledZoneinfo
+                           // ======================
+
+class CompiledZoneinfo {
+    // This class provides an immutable table, compiled from a well-formed
+    // 'Zoneinfo', of the UTC offsets in effect at UTC times, which are looked
+    // up in constant time within a range of years supplied on construction,
+    // and by binary search otherwise.
+    //
+    // This class:
+    //: o is *exception-neutral*
+    //: o is *const* *thread-safe*
+    // For terminology see 'bsldoc_glossary'.
+
+  public:
+    // TYPES
+    typedef bsl::allocator<char> allocator_type;
+
+    // CONSTANTS
+    enum {
+        k_DEFAULT_FIRST_YEAR = 1970,  // first year of the default range
+        k_DEFAULT_LAST_YEAR  = 2100,  // last year of the default range
+
+        k_BUCKET_SHIFT       = 21     // base-2 logarithm of the number of
+                                      // seconds covered by a bucket
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bdlt::EpochUtil::TimeT64 TimeT64;
+
+    // DATA
+    bsl::vector<TimeT64> d_utcTimes;    // UTC times of the transitions,
+                                        // followed by a sentinel greater than
+                                        // every time
+
+    bsl::vector<int>     d_offsets;     // UTC offset, in seconds, of each
+                                        // transition
+
+    bsl::vector<int>     d_buckets;     // index of the transition in effect
+                                        // at the start of each bucket
+
+    TimeT64              d_rangeBegin;  // first UTC time of the range
+
+    TimeT64              d_rangeEnd;    // UTC time one past the range
+
+    int                  d_firstYear;   // first year of the range
+
+    int                  d_lastYear;    // last year of the range
+
+    bsl::string          d_identifier;  // time-zone identifier
+
+    // PRIVATE MANIPULATORS
+    void compile(const Zoneinfo& zoneinfo);
+        // Load into this object the tables of the transitions of the
+        // specified 'zoneinfo' and of the buckets of the range of this
+        // object.  The behavior is undefined unless this object has no
+        // transitions, and 'd_firstYear' and 'd_lastYear' are set.
+
+    // PRIVATE ACCESSORS
+    int findTransitionIndex(TimeT64 utcTime) const;
+        // Return the index of the transition in effect at the specified
+        // 'utcTime'.
+
+    int findTransitionIndexOutOfRange(TimeT64 utcTime) const;
+        // Return the index of the transition in effect at the specified
+        // 'utcTime', found by binary search.  Note that this function is
+        // called for times outside of the range covered by the buckets.
+
+    // NOT IMPLEMENTED
+    CompiledZoneinfo(const CompiledZoneinfo&);
+    CompiledZoneinfo& operator=(const CompiledZoneinfo&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CompiledZoneinfo,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit CompiledZoneinfo(
+                          const Zoneinfo&        zoneinfo,
+                          const allocator_type&  allocator = allocator_type());
+    CompiledZoneinfo(const Zoneinfo&        zoneinfo,
+                     int                    firstYear,
+                     int                    lastYear,
+                     const allocator_type&  allocator = allocator_type());
+        // Create a table of the UTC offsets of the time zone described by the
+        // specified 'zoneinfo', looking up in constant time the UTC times from
+        // the start of the optionally specified 'firstYear' to the end of the
+        // optionally specified 'lastYear'.  If 'firstYear' and 'lastYear' are
+        // not specified, 'k_DEFAULT_FIRST_YEAR' and 'k_DEFAULT_LAST_YEAR' are
+        // used.  Optionally specify an 'allocator' (e.g., the address of a
+        // 'bslma::Allocator' object) to supply memory; otherwise, the default
+        // allocator is used.  The behavior is undefined unless
+        // 'zoneinfo' has at least one transition, and
+        // '1 <= firstYear <= lastYear <= 9999'.  Note that a well-formed
+        // 'zoneinfo' (see 'ZoneinfoUtil::isWellFormed') has a transition at
+        // the earliest representable time, so that every UTC time has a
+        // transition in effect.
+
+    ~CompiledZoneinfo();
+        // Destroy this object.
+
+    // ACCESSORS
+    int convertUtcToLocalTime(bdlt::DatetimeTz      *result,
+                              const bdlt::Datetime&  utcTime) const;
+        // Load, into the specified 'result', the local date-time value,
+        // including the UTC offset in minutes, corresponding to the specified
+        // 'utcTime' in the time zone described by this table.  Return 0 on
+        // success, and 'ErrorCode::k_OUT_OF_RANGE' if the local date-time
+        // value would not be representable by 'bdlt::Datetime', in which case
+        // 'result' is not modified.  Note that this function returns the same
+        // 'result' as 'ZoneinfoUtil::convertUtcToLocalTime' applied to the
+        // 'Zoneinfo' from which this table was compiled.
+
+    int firstYear() const;
+        // Return the first year of the range within which UTC times are
+        // looked up in constant time.
+
+    const bsl::string& identifier() const;
+        // Return a reference providing non-modifiable access to the
+        // identifier of the time zone described by this table.
+
+    bool isInRange(bdlt::EpochUtil::TimeT64 utcTime) const;
+        // Return 'true' if the specified 'utcTime' is within the range of UTC
+        // times looked up in constant time, and 'false' otherwise.
+
+    int lastYear() const;
+        // Return the last year of the range within which UTC times are looked
+        // up in constant time.
+
+    bsl::size_t numTransitions() const;
+        // Return the number of transitions of the time zone described by
+        // this table.
+
+    int utcOffsetInSeconds(bdlt::EpochUtil::TimeT64 utcTime) const;
+        // Return the offset from UTC, in seconds, in effect at the specified
+        // 'utcTime' in the time zone described by this table.  If 'utcTime'
+        // precedes the first transition, the offset of the first transition is
+        // returned.
+
+                                  // Aspects
+
+    allocator_type get_allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class CompiledZoneinfo
+                           // ----------------------
+
+// PRIVATE ACCESSORS
+inline
+int CompiledZoneinfo::findTransitionIndex(TimeT64 utcTime) const
+{
+    if (d_rangeBegin <= utcTime && utcTime < d_rangeEnd) {
+        int index = d_buckets[static_cast<bsl::size_t>(
+                                 (utcTime - d_rangeBegin) >> k_BUCKET_SHIFT)];
+
+        // The sentinel terminates the scan at the last transition.
+
+        while (d_utcTimes[index + 1] <= utcTime) {
+            ++index;
+        }
+        return index;                                                 // RETURN
+    }
+    return findTransitionIndexOutOfRange(utcTime);
+}
+
+// ACCESSORS
+inline
+int CompiledZoneinfo::firstYear() const
+{
+    return d_firstYear;
+}
+
+inline
+const bsl::string& CompiledZoneinfo::identifier() const
+{
+    return d_identifier;
+}
+
+inline
+bool CompiledZoneinfo::isInRange(bdlt::EpochUtil::TimeT64 utcTime) const
+{
+    return d_rangeBegin <= utcTime && utcTime < d_rangeEnd;
+}
+
+inline
+int CompiledZoneinfo::lastYear() const
+{
+    return d_lastYear;
+}
+
+inline
+bsl::size_t CompiledZoneinfo::numTransitions() const
+{
+    return d_offsets.size();
+}
+
+inline
+int CompiledZoneinfo::utcOffsetInSeconds(
+                                     bdlt::EpochUtil::TimeT64 utcTime) const
+{
+    return d_offsets[findTransitionIndex(utcTime)];
+}
+
+                                  // Aspects
+
+inline
+CompiledZoneinfo::allocator_type CompiledZoneinfo::get_allocator() const
+{
+    return d_utcTimes.get_allocator();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
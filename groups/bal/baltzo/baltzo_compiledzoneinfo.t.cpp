@@ -0,0 +1,720 @@
+// baltzo_compiledzoneinfo.t.cpp                                      -*-C++-*-
+#include <baltzo_compiledzoneinfo.h>
+
+#include <baltzo_errorcode.h>
+#include <baltzo_localtimedescriptor.h>
+#include <baltzo_zoneinfo.h>
+#include <baltzo_zoneinfoutil.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_epochutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'baltzo::CompiledZoneinfo' is an immutable table compiled from a
+// 'baltzo::Zoneinfo'.  Its lookups are tested against the binary search of
+// 'baltzo::Zoneinfo::findTransitionForUtcTime', and its conversions against
+// 'baltzo::ZoneinfoUtil::convertUtcToLocalTime', for pseudo-random time zones
+// whose transitions are both sparse and dense (several transitions within a
+// bucket), and for times within, at the boundaries of, and outside of the
+// range of the table.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the default allocator.
+//: o Precondition violations are detected in appropriate build modes.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] CompiledZoneinfo(const Zoneinfo&, const allocator_type& = {});
+// [ 2] CompiledZoneinfo(const Zoneinfo&, int, int, const alloc& = {});
+// [ 2] ~CompiledZoneinfo();
+//
+// ACCESSORS
+// [ 4] int convertUtcToLocalTime(DatetimeTz *, const Datetime&) const;
+// [ 2] int firstYear() const;
+// [ 2] const bsl::string& identifier() const;
+// [ 2] bool isInRange(TimeT64) const;
+// [ 2] int lastYear() const;
+// [ 2] bsl::size_t numTransitions() const;
+// [ 3] int utcOffsetInSeconds(TimeT64) const;
+// [ 2] allocator_type get_allocator() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baltzo::CompiledZoneinfo    Obj;
+typedef baltzo::Zoneinfo            Zone;
+typedef baltzo::LocalTimeDescriptor Desc;
+typedef bdlt::EpochUtil::TimeT64    TimeT64;
+typedef bsls::Types::Uint64         Uint64;
+
+// ============================================================================
+//                              TEST FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+TimeT64 toTimeT(const bdlt::Datetime& value)
+    // Return the interval in seconds from UNIX epoch time of the specified
+    // 'value'.
+{
+    return bdlt::EpochUtil::convertToTimeT64(value);
+}
+
+Uint64 nextRandom(Uint64 *state)
+    // Return the next pseudo-random value of the sequence having the
+    // specified 'state', and update 'state'.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state >> 16;
+}
+
+void makeZone(Zone                  *result,
+              Uint64                 seed,
+              const bdlt::Datetime&  first,
+              const bdlt::Datetime&  last,
+              int                    maxGapInSeconds)
+    // Load into the specified 'result' a well-formed time zone (see
+    // 'baltzo::ZoneinfoUtil::isWellFormed'), generated from the specified
+    // 'seed', having, in addition to its initial transition, a transition
+    // every 29 hours plus 0 to the specified 'maxGapInSeconds' seconds from
+    // the specified 'first' time to the specified 'last' time, each having an
+    // offset, which is usually a whole number of quarter-hours, in the range
+    // '[ -14h .. 14h ]'.  Note that consecutive transitions are separated by
+    // more than the largest difference between two such offsets, so that the
+    // ranges of local times made invalid or ambiguous by consecutive
+    // transitions never overlap.
+{
+    const TimeT64 k_MIN_GAP = 29 * 60 * 60;
+
+    Uint64 state = seed;
+
+    result->setIdentifier("Test/Zone");
+    result->addTransition(u::toTimeT(bdlt::Datetime(1, 1, 1)),
+                          Desc(-17762, false, "LMT"));
+
+    const TimeT64 end = u::toTimeT(last);
+    for (TimeT64 time = u::toTimeT(first);
+         time < end;
+         time += k_MIN_GAP + static_cast<TimeT64>(nextRandom(&state)
+                                                  % (maxGapInSeconds + 1))) {
+        const Uint64 bits   = nextRandom(&state);
+        int          offset = static_cast<int>(bits % 113) * 15 * 60
+                            - 14 * 60 * 60;
+        if (0 == bits % 7) {
+            offset += static_cast<int>(bits % 59);  // not a whole minute
+        }
+        result->addTransition(time, Desc(offset, 0 == bits % 2, "T"));
+    }
+}
+
+int expectedOffset(const Zone& zone, TimeT64 time)
+    // Return the offset in effect at the specified 'time' in the specified
+    // 'zone', as found by the binary search of 'Zoneinfo'.
+{
+    const baltzo::Zoneinfo::TransitionConstIterator it =
+           zone.findTransitionForUtcTime(
+                                    bdlt::EpochUtil::convertFromTimeT64(time));
+
+    return it->descriptor().utcOffsetInSeconds();
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::DefaultAllocatorGuard usageGuard(&ta);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Converting Many UTC Times to Local Times
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to convert a large number of UTC times to local time in
+// New York.  We compile the time-zone information once, and use the compiled
+// table for every conversion.
+//
+// First, we create a 'baltzo::Zoneinfo' for New York having, after the initial
+// transition, the transitions of 2010:
+//..
+    baltzo::LocalTimeDescriptor est(-5 * 60 * 60, false, "EST");
+    baltzo::LocalTimeDescriptor edt(-4 * 60 * 60, true,  "EDT");
+
+    typedef bdlt::EpochUtil EpochUtil;
+
+    baltzo::Zoneinfo newYork;
+    newYork.setIdentifier("America/New_York");
+    newYork.addTransition(EpochUtil::convertToTimeT64(bdlt::Datetime(1, 1, 1)),
+                          est);
+    newYork.addTransition(
+                   EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 3, 14, 7)),
+                   edt);
+    newYork.addTransition(
+                   EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 11, 7, 6)),
+                   est);
+//..
+// Then, we compile it:
+//..
+    baltzo::CompiledZoneinfo compiled(newYork);
+
+    ASSERT("America/New_York" == compiled.identifier());
+    ASSERT(3                  == compiled.numTransitions());
+//..
+// Now, we convert a UTC time in summer to local time:
+//..
+    bdlt::DatetimeTz localTime;
+    int rc = compiled.convertUtcToLocalTime(&localTime,
+                                            bdlt::Datetime(2010, 7, 1, 12));
+    ASSERT(0                             == rc);
+    ASSERT(bdlt::Datetime(2010, 7, 1, 8) == localTime.localDatetime());
+    ASSERT(-4 * 60                       == localTime.offset());
+//..
+// Finally, we observe that the offset in effect at a UTC time can also be
+// obtained directly:
+//..
+    const bdlt::EpochUtil::TimeT64 december =
+                      EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 12, 1));
+
+    ASSERT(-5 * 60 * 60 == compiled.utcOffsetInSeconds(december));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'convertUtcToLocalTime'
+        //
+        // Concerns:
+        //: 1 'convertUtcToLocalTime' loads the same value as
+        //:   'ZoneinfoUtil::convertUtcToLocalTime', including for offsets
+        //:   that are not whole minutes, and times having fractional seconds.
+        //:
+        //: 2 'convertUtcToLocalTime' returns 'ErrorCode::k_OUT_OF_RANGE', and
+        //:   does not modify the result, if the local time is not
+        //:   representable.
+        //
+        // Plan:
+        //: 1 For pseudo-random times in a pseudo-random zone, compare the
+        //:   results of the two functions.  (C-1)
+        //:
+        //: 2 Convert the earliest time in a zone having a negative offset, and
+        //:   the latest time in a zone having a positive offset.  (C-2)
+        //
+        // Testing:
+        //   int convertUtcToLocalTime(DatetimeTz *, const Datetime&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'convertUtcToLocalTime'" << endl
+                          << "===============================" << endl;
+
+        Zone zone(&ta);
+        u::makeZone(&zone,
+                    4,
+                    bdlt::Datetime(1900, 1, 1),
+                    bdlt::Datetime(2200, 1, 1),
+                    90 * 24 * 60 * 60);
+
+        ASSERT(baltzo::ZoneinfoUtil::isWellFormed(zone));
+
+        const Obj X(zone, &ta);
+
+        Uint64 state = 44;
+        for (int i = 0; i < 20000; ++i) {
+            const Uint64  bits = u::nextRandom(&state);
+            const TimeT64 time = u::toTimeT(bdlt::Datetime(1850, 1, 1))
+                               + static_cast<TimeT64>(
+                                                 bits % (400LL * 366 * 86400));
+
+            bdlt::Datetime utcTime = bdlt::EpochUtil::convertFromTimeT64(time);
+            utcTime.addMilliseconds(static_cast<int>(i % 1000));
+
+            bdlt::DatetimeTz                  expected;
+            bdlt::DatetimeTz                  result;
+            baltzo::Zoneinfo::TransitionConstIterator it;
+
+            const int expectedRc = baltzo::ZoneinfoUtil::convertUtcToLocalTime(
+                                                                     &expected,
+                                                                     &it,
+                                                                     utcTime,
+                                                                     zone);
+            const int rc = X.convertUtcToLocalTime(&result, utcTime);
+
+            ASSERTV(utcTime, expectedRc, rc, expectedRc == rc);
+            ASSERTV(utcTime, expected, result, expected == result);
+        }
+
+        if (verbose) cout << "\tTesting out-of-range results." << endl;
+        {
+            Zone west(&ta);
+            west.setIdentifier("West");
+            west.addTransition(u::toTimeT(bdlt::Datetime(1, 1, 1)),
+                               Desc(-60 * 60, false, "W"));
+
+            Zone east(&ta);
+            east.setIdentifier("East");
+            east.addTransition(u::toTimeT(bdlt::Datetime(1, 1, 1)),
+                               Desc(60 * 60, false, "E"));
+
+            const Obj W(west, &ta);
+            const Obj E(east, &ta);
+
+            const bdlt::DatetimeTz INITIAL(bdlt::Datetime(2000, 1, 1), 0);
+
+            bdlt::DatetimeTz result = INITIAL;
+            ASSERT(baltzo::ErrorCode::k_OUT_OF_RANGE ==
+                   W.convertUtcToLocalTime(&result, bdlt::Datetime(1, 1, 1)));
+            ASSERT(INITIAL == result);
+
+            ASSERT(baltzo::ErrorCode::k_OUT_OF_RANGE ==
+                   E.convertUtcToLocalTime(&result,
+                                           bdlt::Datetime(9999, 12, 31, 23)));
+            ASSERT(INITIAL == result);
+
+            ASSERT(0 == E.convertUtcToLocalTime(&result,
+                                                bdlt::Datetime(1, 1, 1)));
+            ASSERT(bdlt::Datetime(1, 1, 1, 1) == result.localDatetime());
+            ASSERT(60                         == result.offset());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'utcOffsetInSeconds'
+        //
+        // Concerns:
+        //: 1 'utcOffsetInSeconds' returns the offset of the transition found
+        //:   by 'Zoneinfo::findTransitionForUtcTime', for times within the
+        //:   range, at its boundaries, and outside of it.
+        //:
+        //: 2 The offset changes exactly at the time of each transition, also
+        //:   when a bucket contains several transitions.
+        //:
+        //: 3 Ranges of a single year, and the full range of 'bdlt::Datetime',
+        //:   are supported.
+        //
+        // Plan:
+        //: 1 For pseudo-random zones having sparse and dense transitions, and
+        //:   a number of ranges, compare 'utcOffsetInSeconds' with the offset
+        //:   found by binary search for the times one second before, at, and
+        //:   one second after each transition, at and around the boundaries
+        //:   of the range, and at pseudo-random times.  (C-1..3)
+        //
+        // Testing:
+        //   int utcOffsetInSeconds(TimeT64) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'utcOffsetInSeconds'" << endl
+                          << "============================" << endl;
+
+        static const struct {
+            int d_line;           // source line number
+            int d_maxGap;         // maximum gap between transitions beyond
+                                  // the minimum of 29 hours (seconds)
+            int d_firstYear;      // first year of the range, or 0 for default
+            int d_lastYear;       // last year of the range
+        } DATA[] = {
+            //LINE  MAX GAP             FIRST  LAST
+            //----  ------------------  -----  ----
+            { L_,   200 * 24 * 3600,        0,    0 },
+            { L_,         2 * 3600,         0,    0 },
+            { L_,    30 * 24 * 3600,     2000, 2000 },
+            { L_,    30 * 24 * 3600,     1950, 2050 },
+            { L_,   200 * 24 * 3600,        1, 9999 },
+            { L_,        12 * 3600,      1999, 2001 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE       = DATA[ti].d_line;
+            const int MAX_GAP    = DATA[ti].d_maxGap;
+            const int FIRST_YEAR = DATA[ti].d_firstYear;
+            const int LAST_YEAR  = DATA[ti].d_lastYear;
+
+            if (veryVerbose) { T_ P_(LINE) P_(FIRST_YEAR) P(LAST_YEAR) }
+
+            const bdlt::Datetime FIRST = MAX_GAP < 24 * 3600
+                                       ? bdlt::Datetime(1995, 1, 1)
+                                       : bdlt::Datetime(1900, 1, 1);
+            const bdlt::Datetime LAST  = MAX_GAP < 24 * 3600
+                                       ? bdlt::Datetime(2005, 1, 1)
+                                       : bdlt::Datetime(2200, 1, 1);
+
+            Zone zone(&ta);
+            u::makeZone(&zone, ti, FIRST, LAST, MAX_GAP);
+            ASSERTV(LINE, baltzo::ZoneinfoUtil::isWellFormed(zone));
+
+            const Obj *objPtr = 0 == FIRST_YEAR
+                              ? new (ta) Obj(zone, &ta)
+                              : new (ta) Obj(zone, FIRST_YEAR, LAST_YEAR, &ta);
+            const Obj& X = *objPtr;
+
+            for (baltzo::Zoneinfo::TransitionConstIterator it =
+                                                      zone.beginTransitions();
+                 it != zone.endTransitions();
+                 ++it) {
+                for (TimeT64 delta = -1; delta <= 1; ++delta) {
+                    const TimeT64 TIME = it->utcTime() + delta;
+
+                    if (TIME < u::toTimeT(bdlt::Datetime(1, 1, 1))) {
+                        continue;
+                    }
+                    ASSERTV(LINE, TIME,
+                            u::expectedOffset(zone, TIME) ==
+                                                   X.utcOffsetInSeconds(TIME));
+                }
+            }
+
+            const TimeT64 BEGIN = u::toTimeT(
+                                       bdlt::Datetime(X.firstYear(), 1, 1));
+            const TimeT64 END   = u::toTimeT(
+                                      bdlt::Datetime(X.lastYear(), 12, 31))
+                                + 24 * 3600;
+
+            ASSERTV(LINE, !X.isInRange(BEGIN - 1));
+            ASSERTV(LINE,  X.isInRange(BEGIN));
+            ASSERTV(LINE,  X.isInRange(END - 1));
+            ASSERTV(LINE, !X.isInRange(END));
+
+            const TimeT64 BOUNDARIES[] = { BEGIN - 1, BEGIN, END - 1, END };
+            for (int i = 0; i < 4; ++i) {
+                const TimeT64 TIME = BOUNDARIES[i];
+
+                if (TIME < u::toTimeT(bdlt::Datetime(1, 1, 1))
+                 || TIME > u::toTimeT(bdlt::Datetime(9999, 12, 31, 23, 59,
+                                                     59))) {
+                    continue;
+                }
+                ASSERTV(LINE, TIME,
+                        u::expectedOffset(zone, TIME) ==
+                                                   X.utcOffsetInSeconds(TIME));
+            }
+
+            Uint64 state = LINE;
+            for (int i = 0; i < 20000; ++i) {
+                const TimeT64 TIME = u::toTimeT(bdlt::Datetime(1800, 1, 1))
+                                   + static_cast<TimeT64>(
+                                      u::nextRandom(&state)
+                                                     % (500LL * 366 * 86400));
+                ASSERTV(LINE, TIME,
+                        u::expectedOffset(zone, TIME) ==
+                                                   X.utcOffsetInSeconds(TIME));
+            }
+
+            ta.deleteObject(objPtr);
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors record the identifier, the transitions, and the
+        //:   range (by default, 'k_DEFAULT_FIRST_YEAR' to
+        //:   'k_DEFAULT_LAST_YEAR').
+        //:
+        //: 2 All memory is supplied by the specified allocator, or by the
+        //:   default allocator if none is specified, and is released on
+        //:   destruction.
+        //:
+        //: 3 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Construct objects with and without a range and an allocator, and
+        //:   verify the accessors and the use of memory.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges and zones without transitions.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CompiledZoneinfo(const Zoneinfo&, const allocator_type& = {});
+        //   CompiledZoneinfo(const Zoneinfo&, int, int, const alloc&);
+        //   ~CompiledZoneinfo();
+        //   int firstYear() const;
+        //   const bsl::string& identifier() const;
+        //   bool isInRange(TimeT64) const;
+        //   int lastYear() const;
+        //   bsl::size_t numTransitions() const;
+        //   allocator_type get_allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator za("zone", veryVeryVeryVerbose);
+
+        Zone zone(&za);
+        u::makeZone(&zone,
+                    2,
+                    bdlt::Datetime(1990, 1, 1),
+                    bdlt::Datetime(2010, 1, 1),
+                    180 * 24 * 3600);
+        zone.setIdentifier("A/Rather/Long/Identifier/That/Allocates");
+
+        {
+            const Obj X(zone, &ta);
+
+            ASSERT(zone.identifier()         == X.identifier());
+            ASSERT(zone.numTransitions()     == X.numTransitions());
+            ASSERT(Obj::k_DEFAULT_FIRST_YEAR == X.firstYear());
+            ASSERT(Obj::k_DEFAULT_LAST_YEAR  == X.lastYear());
+            ASSERT(&ta                       == X.get_allocator().mechanism());
+            ASSERT(0                         <  ta.numBlocksInUse());
+
+            ASSERT( X.isInRange(u::toTimeT(bdlt::Datetime(1970, 1, 1))));
+            ASSERT(!X.isInRange(u::toTimeT(bdlt::Datetime(1969, 12, 31,
+                                                          23, 59, 59))));
+            ASSERT( X.isInRange(u::toTimeT(bdlt::Datetime(2100, 12, 31,
+                                                          23, 59, 59))));
+            ASSERT(!X.isInRange(u::toTimeT(bdlt::Datetime(2101, 1, 1))));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        {
+            const Obj X(zone, 2000, 2001, &ta);
+
+            ASSERT(2000 == X.firstYear());
+            ASSERT(2001 == X.lastYear());
+
+            ASSERT( X.isInRange(u::toTimeT(bdlt::Datetime(2000, 1, 1))));
+            ASSERT( X.isInRange(u::toTimeT(bdlt::Datetime(2001, 12, 31,
+                                                          23, 59, 59))));
+            ASSERT(!X.isInRange(u::toTimeT(bdlt::Datetime(2002, 1, 1))));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            const Obj X(zone);
+
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+            ASSERT(0                 <  defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Zone empty(&za);
+
+            ASSERT_PASS(Obj(zone,     1, 9999, &ta));
+            ASSERT_FAIL(Obj(zone,     0, 2000, &ta));
+            ASSERT_FAIL(Obj(zone,  2001, 2000, &ta));
+            ASSERT_FAIL(Obj(zone,  2000, 10000, &ta));
+            ASSERT_FAIL(Obj(empty, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Compile a zone having a few transitions, and look up times
+        //:   before, at, and after them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Zone zone(&ta);
+        zone.setIdentifier("Breathing");
+        zone.addTransition(u::toTimeT(bdlt::Datetime(1, 1, 1)),
+                           Desc(3600, false, "A"));
+        zone.addTransition(u::toTimeT(bdlt::Datetime(2000, 1, 1)),
+                           Desc(7200, true, "B"));
+        zone.addTransition(u::toTimeT(bdlt::Datetime(2000, 1, 1, 1)),
+                           Desc(-3600, false, "C"));
+
+        const Obj X(zone, &ta);
+
+        ASSERT(3    == X.numTransitions());
+        ASSERT(3600 == X.utcOffsetInSeconds(
+                        u::toTimeT(bdlt::Datetime(1999, 12, 31, 23, 59, 59))));
+        ASSERT(7200 == X.utcOffsetInSeconds(
+                          u::toTimeT(bdlt::Datetime(2000, 1, 1))));
+        ASSERT(7200 == X.utcOffsetInSeconds(
+                          u::toTimeT(bdlt::Datetime(2000, 1, 1, 0, 59, 59))));
+        ASSERT(-3600 == X.utcOffsetInSeconds(
+                          u::toTimeT(bdlt::Datetime(2000, 1, 1, 1))));
+        ASSERT(3600 == X.utcOffsetInSeconds(
+                          u::toTimeT(bdlt::Datetime(1500, 1, 1))));
+        ASSERT(-3600 == X.utcOffsetInSeconds(
+                          u::toTimeT(bdlt::Datetime(3000, 1, 1))));
+
+        bdlt::DatetimeTz result;
+        ASSERT(0 == X.convertUtcToLocalTime(&result,
+                                            bdlt::Datetime(2000, 1, 1, 12)));
+        ASSERT(bdlt::Datetime(2000, 1, 1, 11) == result.localDatetime());
+        ASSERT(-60                            == result.offset());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
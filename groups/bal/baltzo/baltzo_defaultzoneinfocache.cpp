@@ -5,6 +5,7 @@
 BSLS_IDENT_RCSID(baltzo_defaultzoneinfocache_cpp,"$Id$ $CSID$")
 
 #include <baltzo_datafileloader.h>
+#include <baltzo_imagefileloader.h>
 #include <baltzo_testloader.h>  // for testing only
 
 #include <bslmt_once.h>
@@ -47,6 +48,25 @@ baltzo::ZoneinfoCache *initSystemDefaultCache()
 {
     bslma::Allocator *allocator = bslma::Default::globalAllocator();
 
+    const char *imagePath = getenv("BDE_ZONEINFO_IMAGE_PATH");
+    if (0 != imagePath) {
+        static baltzo::ImageFileLoader imageLoader(allocator);
+
+        if (0 == imageLoader.mapImage(imagePath)) {
+            BSLS_LOG_INFO("Environment variable 'BDE_ZONEINFO_IMAGE_PATH' "
+                          "set to '%s'.", imagePath);
+
+            static baltzo::ZoneinfoCache imageCache(&imageLoader, allocator);
+
+            return &imageCache;                                       // RETURN
+        }
+
+        BSLS_LOG_ERROR("Environment variable 'BDE_ZONEINFO_IMAGE_PATH' does "
+                       "not refer to a valid time-zone image file (%s).  "
+                       "Falling back on time-zone information data files.",
+                       imagePath);
+    }
+
     static baltzo::DataFileLoader loader(allocator);
     loader.configureRootPath(
                   baltzo::DefaultZoneinfoCache::defaultZoneinfoDataLocation());
@@ -11,7 +11,7 @@ BSLS_IDENT("$Id: $")
 //  baltzo::DefaultZoneinfoCache: default Zoneinfo cache utilities
 //  baltzo::DefaultZoneinfoCacheScopedGuard: guard for default Zoneinfo cache
 //
-//@SEE_ALSO: baltzo_zoneinfocache, baltzo_timezoneutil
+//@SEE_ALSO: baltzo_zoneinfocache, baltzo_timezoneutil, baltzo_imagefileloader
 //
 //@DESCRIPTION: This component provides a namespace,
 // 'baltzo::DefaultZoneinfoCache', for utility functions that install and
@@ -56,6 +56,18 @@ BSLS_IDENT("$Id: $")
 // requests for that time-zone's data will fail.  Additional information about
 // TZ Database files can be found in 'baltzo_datafileloader'.
 //
+///Default Time Zone Image File
+///- - - - - - - - - - - - - - -
+// If the 'BDE_ZONEINFO_IMAGE_PATH' environment variable is set to the path of
+// a zoneinfo image file (see 'baltzo_zoneinfoimageutil'), the automatically
+// configured default Zoneinfo cache object loads time zones from that file,
+// which is mapped into memory (see 'baltzo_imagefileloader'), instead of from
+// TZ Database files; the processes on a host using the same image file share
+// a single copy of it, and loading a time zone requires neither file-system
+// access nor parsing.  If the image file cannot be mapped, or is not a valid
+// image, an error is logged and the TZ Database files are used as described
+// above.
+//
 ///Thread Safety
 ///-------------
 // The 'baltzo::DefaultZoneinfoCache::defaultCache' method is *thread-safe*
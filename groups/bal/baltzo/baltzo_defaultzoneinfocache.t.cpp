@@ -5,6 +5,7 @@
 #include <baltzo_localtimedescriptor.h>
 #include <baltzo_testloader.h>
 #include <baltzo_zoneinfo.h>
+#include <baltzo_zoneinfoimage.h>
 
 #include <bdls_filesystemutil.h>
 #include <bdls_pathutil.h>
@@ -28,6 +29,7 @@
 #include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
+#include <bsl_sstream.h>
 
 #include <bsl_c_stdlib.h>   // 'putenv'
 
@@ -57,7 +59,8 @@ using namespace std;
 //
 ////---------------------------------------------------------------------------
 // [ 1] BREATHING TEST: 'baltzo::DefaultZoneinfoCache'
-// [ 6] USAGE EXAMPLE
+// [ 6] CONCERN: 'BDE_ZONEINFO_IMAGE_PATH' configures the system cache
+// [ 7] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 //=============================================================================
 
@@ -614,7 +617,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -692,6 +695,75 @@ int main(int argc, char *argv[])
 //  }
 //..
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // SYSTEM DEFAULT CACHE USING AN IMAGE FILE
+        //
+        // Concerns:
+        //: 1 If 'BDE_ZONEINFO_IMAGE_PATH' is set to the path of a valid
+        //:   zoneinfo image file, the automatically-installed default cache
+        //:   loads time zones from that image, and not from the TZ Database
+        //:   files.
+        //
+        // Plan:
+        //: 1 Write an image file having the time zone of
+        //:   "defaultzictest/America/New_York" under another identifier, set
+        //:   'BDE_ZONEINFO_IMAGE_PATH' to its path, and verify that the
+        //:   system default cache finds the time zone having that identifier,
+        //:   but not those that are only in the TZ Database files.  Note that
+        //:   the system default cache is initialized once per process, so
+        //:   this concern must be tested in its own test case.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: 'BDE_ZONEINFO_IMAGE_PATH' configures the system cache
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SYSTEM DEFAULT CACHE USING AN IMAGE FILE" << endl
+                          << "========================================"
+                          << endl;
+
+        const char *IMAGE_FILE = "defaultzictest/image.img";
+
+        baltzo::DataFileLoader loader(&allocator);
+        loader.configureRootPath("defaultzictest");
+
+        Zone zone(&allocator);
+        ASSERT(0 == loader.loadTimeZone(&zone, "America/New_York"));
+        zone.setIdentifier("Image/New_York");
+
+        {
+            const Zone *ZONES[] = { &zone };
+
+            bsl::ostringstream stream;
+            ASSERT(0 == baltzo::ZoneinfoImage::writeImage(stream, ZONES, 1));
+
+            const bsl::string IMAGE = stream.str();
+            writeData(IMAGE_FILE,
+                      IMAGE.data(),
+                      static_cast<int>(IMAGE.size()));
+        }
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        static char imagePath[] =
+                         "BDE_ZONEINFO_IMAGE_PATH=defaultzictest\\image.img";
+        _putenv(imagePath);
+#else
+        static char imagePath[] =
+                           "BDE_ZONEINFO_IMAGE_PATH=defaultzictest/image.img";
+        putenv(imagePath);
+#endif
+
+        Cache *cache = Obj::defaultCache();
+        ASSERT(0 != cache);
+
+        const Zone *TZ = cache->getZoneinfo("Image/New_York");
+        ASSERT(0 != TZ);
+        ASSERT(0 == TZ || zone == *TZ);
+
+        ASSERT(0 == cache->getZoneinfo("America/New_York"));
+        ASSERT(0 == cache->getZoneinfo("Etc/UTC"));
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // 'defaultCache' CLASS METHOD
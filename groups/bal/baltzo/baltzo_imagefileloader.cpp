@@ -0,0 +1,154 @@
+// baltzo_imagefileloader.cpp                                         -*-C++-*-
+#include <baltzo_imagefileloader.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baltzo_imagefileloader_cpp,"$Id$ $CSID$")
+
+#include <baltzo_errorcode.h>
+#include <baltzo_zoneinfo.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_log.h>
+#include <bsls_types.h>
+
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace baltzo {
+
+                           // ---------------------
+                           // class ImageFileLoader
+                           // ---------------------
+
+// CREATORS
+ImageFileLoader::ImageFileLoader()
+: d_image()
+, d_mapping_p(0)
+, d_mappingSize(0)
+, d_imagePath()
+{
+}
+
+ImageFileLoader::ImageFileLoader(const allocator_type& allocator)
+: d_image()
+, d_mapping_p(0)
+, d_mappingSize(0)
+, d_imagePath(allocator)
+{
+}
+
+ImageFileLoader::~ImageFileLoader()
+{
+    unmapImage();
+}
+
+// MANIPULATORS
+int ImageFileLoader::mapImage(const char *path)
+{
+    BSLS_ASSERT(path);
+
+    typedef bdls::FilesystemUtil Util;
+
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    Util::FileDescriptor fd = Util::open(path,
+                                         Util::e_OPEN,
+                                         Util::e_READ_ONLY);
+    if (Util::k_INVALID_FD == fd) {
+        BSLS_LOG_ERROR("Failed to open zoneinfo image file '%s'", path);
+        return k_FAILURE;                                             // RETURN
+    }
+
+    const Util::Offset fileSize = Util::getFileSize(fd);
+    if (fileSize <= 0
+     || static_cast<bsls::Types::Uint64>(fileSize) >
+                           static_cast<bsls::Types::Uint64>(
+                                    bsl::numeric_limits<bsl::size_t>::max())) {
+        BSLS_LOG_ERROR("Invalid size of zoneinfo image file '%s'", path);
+        Util::close(fd);
+        return k_FAILURE;                                             // RETURN
+    }
+
+    const bsl::size_t  size    = static_cast<bsl::size_t>(fileSize);
+    void              *address = 0;
+
+    const int rc = Util::map(fd,
+                             &address,
+                             0,
+                             size,
+                             bdls::MemoryUtil::k_ACCESS_READ);
+
+    // The mapping remains valid after the file is closed.
+
+    Util::close(fd);
+
+    if (0 != rc) {
+        BSLS_LOG_ERROR("Failed to map zoneinfo image file '%s'", path);
+        return k_FAILURE;                                             // RETURN
+    }
+
+    ZoneinfoImage image;
+    if (0 != image.initialize(static_cast<const char *>(address), size)) {
+        BSLS_LOG_ERROR("Malformed zoneinfo image file '%s'", path);
+        Util::unmap(address, size);
+        return k_FAILURE;                                             // RETURN
+    }
+
+    bsl::string imagePath(path, get_allocator());
+
+    unmapImage();
+
+    d_image       = image;
+    d_mapping_p   = address;
+    d_mappingSize = size;
+    d_imagePath.swap(imagePath);
+
+    return k_SUCCESS;
+}
+
+void ImageFileLoader::unmapImage()
+{
+    if (d_mapping_p) {
+        d_image.reset();
+        bdls::FilesystemUtil::unmap(d_mapping_p, d_mappingSize);
+        d_mapping_p   = 0;
+        d_mappingSize = 0;
+        d_imagePath.clear();
+    }
+}
+
+int ImageFileLoader::loadTimeZone(Zoneinfo *result, const char *timeZoneId)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(timeZoneId);
+
+    const int index = d_image.findTimeZone(timeZoneId);
+    if (index < 0) {
+        return ErrorCode::k_UNSUPPORTED_ID;                           // RETURN
+    }
+
+    d_image.loadTimeZone(result, index);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,262 @@
+// baltzo_imagefileloader.h                                           -*-C++-*-
+#ifndef INCLUDED_BALTZO_IMAGEFILELOADER
+#define INCLUDED_BALTZO_IMAGEFILELOADER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a concrete 'baltzo::Loader' for memory-mapped image files.
+//
+//@CLASSES:
+//  baltzo::ImageFileLoader: concrete 'baltzo::Loader' for zoneinfo image files
+//
+//@SEE_ALSO: baltzo_zoneinfoimage, baltzo_zoneinfoimageutil,
+//           baltzo_datafileloader
+//
+//@DESCRIPTION: This component provides a mechanism, 'baltzo::ImageFileLoader',
+// that is a concrete implementation of the 'baltzo::Loader' protocol for
+// loading, into a 'baltzo::Zoneinfo' object, the properties of a time zone
+// described in a zoneinfo image file (see 'baltzo_zoneinfoimage').  The
+// following inheritance hierarchy diagram shows the classes involved and their
+// methods:
+//..
+//   ,-----------------------.
+//  ( baltzo::ImageFileLoader )
+//   `-----------------------'
+//              |      ctor
+//              |      mapImage
+//              |      unmapImage
+//              |      image
+//              |      imagePath
+//              |      isMapped
+//              V
+//       ,--------------.
+//      ( baltzo::Loader )
+//       `--------------'
+//                     dtor
+//                     loadTimeZone
+//..
+// A 'baltzo::ImageFileLoader' is supplied the path of an image file, holding
+// the time zones of an entire Zoneinfo database (typically written by
+// 'baltzo::ZoneinfoImageUtil::writeImageFile'), using the 'mapImage' method.
+// The file is mapped, read-only and shared, into the address space of the
+// process and validated once, after which loading a time zone neither reads
+// a file nor parses the Zoneinfo binary format: the fixed-width records of
+// the time zone are found by a binary search over the identifiers in the image
+// and copied into the 'baltzo::Zoneinfo'.  Since the mapping is shared, every
+// process on a host that maps the same image file shares a single physical
+// copy of it.
+//
+// The image is also accessible, in place, through the 'image' accessor, which
+// allows clients to examine the transitions of a time zone without creating a
+// 'baltzo::Zoneinfo' at all.  Note that the image file must not be modified
+// while it is mapped; an image file should instead be replaced by renaming a
+// new file over it, after which the loaders that have mapped the old file
+// continue to use it until they map the image again.
+//
+///Thread Safety
+///-------------
+// 'baltzo::ImageFileLoader' is *const* *thread-safe*, meaning that accessors
+// may be invoked concurrently from different threads, but it is not safe to
+// access or modify a 'baltzo::ImageFileLoader' in one thread while another
+// thread modifies the same object.  Note that, unlike for most loaders,
+// 'loadTimeZone' does not modify the state of the loader, and may be called
+// concurrently from different threads (but not concurrently with 'mapImage' or
+// 'unmapImage').
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Loading a Time Zone from an Image File
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the image of the system Zoneinfo database has been written to
+// the file "zoneinfo.img" (e.g., by the 'zoneinfo_compiler' tool, or by
+// 'baltzo::ZoneinfoImageUtil::writeImageFile').
+//
+// First, we create a 'baltzo::ImageFileLoader' and map the image file:
+//..
+//  baltzo::ImageFileLoader loader;
+//  int rc = loader.mapImage("zoneinfo.img");
+//  assert(0 == rc);
+//  assert(loader.isMapped());
+//..
+// Then, we load the time zone for New York:
+//..
+//  baltzo::Zoneinfo newYork;
+//  rc = loader.loadTimeZone(&newYork, "America/New_York");
+//  assert(0 == rc);
+//  assert("America/New_York" == newYork.identifier());
+//..
+// Now, we observe that a time zone that is not in the image is reported as
+// unsupported:
+//..
+//  baltzo::Zoneinfo unknown;
+//  rc = loader.loadTimeZone(&unknown, "Not/A_Time_Zone");
+//  assert(baltzo::ErrorCode::k_UNSUPPORTED_ID == rc);
+//..
+// Finally, we supply the loader to a 'baltzo::ZoneinfoCache', so that the
+// time zones used by the process are loaded from the image on demand:
+//..
+//  baltzo::ZoneinfoCache cache(&loader);
+//  const baltzo::Zoneinfo *cached = cache.getZoneinfo("Europe/London");
+//  assert(0 != cached);
+//..
+
+#include <balscm_version.h>
+
+#include <baltzo_loader.h>
+#include <baltzo_zoneinfoimage.h>
+
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace baltzo {
+
+class Zoneinfo;
+
+                           // =====================
+                           // class ImageFileLoader
+                           // =====================
+
+class ImageFileLoader : public Loader {
+    // This class provides a concrete implementation of the 'Loader' protocol
+    // for loading, into a 'Zoneinfo', the properties of a time zone held in a
+    // zoneinfo image file that is mapped into memory.
+
+    // DATA
+    ZoneinfoImage  d_image;        // view of the mapped image
+    void          *d_mapping_p;    // address of the mapping, or 0 if none
+    bsl::size_t    d_mappingSize;  // size of the mapping in bytes
+    bsl::string    d_imagePath;    // path of the mapped image file
+
+  private:
+    // NOT IMPLEMENTED
+    ImageFileLoader(const ImageFileLoader&);
+    ImageFileLoader& operator=(const ImageFileLoader&);
+
+  public:
+    // TYPES
+    typedef bsl::allocator<char> allocator_type;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ImageFileLoader,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    ImageFileLoader();
+    explicit ImageFileLoader(const allocator_type& allocator);
+        // Create a loader having no mapped image.  Optionally specify an
+        // 'allocator' (e.g., the address of a 'bslma::Allocator' object) to
+        // supply memory; otherwise, the default allocator is used.
+
+    virtual ~ImageFileLoader();
+        // Unmap the image mapped by this loader, if any, and destroy this
+        // loader.
+
+    // MANIPULATORS
+    int mapImage(const char *path);
+        // Map, read-only and shared, the zoneinfo image file at the specified
+        // 'path' into memory, and use it to load time zones, unmapping the
+        // image previously mapped by this loader, if any.  Return 0 on
+        // success, and a non-zero value (with no effect) if the file cannot be
+        // opened or mapped, or is not a well-formed image of the version
+        // supported by 'ZoneinfoImage'.  The behavior is undefined if the file
+        // is modified while it is mapped.
+
+    void unmapImage();
+        // Unmap the image mapped by this loader, if any.  Note that
+        // 'loadTimeZone' returns 'ErrorCode::k_UNSUPPORTED_ID' for every time
+        // zone identifier after this call.
+
+    virtual int loadTimeZone(Zoneinfo *result, const char *timeZoneId);
+        // Load into the specified 'result' the time-zone information for the
+        // time zone identified by the specified 'timeZoneId'.  Return 0 on
+        // success, and a non-zero value otherwise.  A return status of
+        // 'ErrorCode::k_UNSUPPORTED_ID' indicates that 'timeZoneId' is not in
+        // the mapped image, or that no image is mapped.  If an error occurs
+        // during this operation, 'result' is unchanged.
+
+    // ACCESSORS
+    const ZoneinfoImage& image() const;
+        // Return a reference providing non-modifiable access to the view of
+        // the image mapped by this loader, which is empty if no image is
+        // mapped.  The view is valid until the image is unmapped.
+
+    const bsl::string& imagePath() const;
+        // Return the path of the image file mapped by this loader, or an empty
+        // string if no image is mapped.
+
+    bool isMapped() const;
+        // Return 'true' if this loader has a mapped image, and 'false'
+        // otherwise.
+
+                        // Aspects
+
+    allocator_type get_allocator() const;
+        // Return the allocator used by this object to supply memory.  Note
+        // that if no allocator was supplied at construction the default
+        // allocator in effect at construction is used.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class ImageFileLoader
+                           // ---------------------
+
+// ACCESSORS
+inline
+const ZoneinfoImage& ImageFileLoader::image() const
+{
+    return d_image;
+}
+
+inline
+const bsl::string& ImageFileLoader::imagePath() const
+{
+    return d_imagePath;
+}
+
+inline
+bool ImageFileLoader::isMapped() const
+{
+    return 0 != d_mapping_p;
+}
+
+                        // Aspects
+
+inline
+ImageFileLoader::allocator_type ImageFileLoader::get_allocator() const
+{
+    return d_imagePath.get_allocator();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,709 @@
+// baltzo_imagefileloader.t.cpp                                       -*-C++-*-
+#include <baltzo_imagefileloader.h>
+
+#include <baltzo_errorcode.h>
+#include <baltzo_localtimedescriptor.h>
+#include <baltzo_zoneinfo.h>
+#include <baltzo_zoneinfocache.h>
+#include <baltzo_zoneinfoimage.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_processutil.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_usesallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'baltzo::ImageFileLoader' maps a zoneinfo image file and loads time zones
+// from it.  Image files of test time zones are written, using
+// 'baltzo::ZoneinfoImage::writeImage', into files whose names include the
+// process id, and removed at the end of each test case.  'mapImage' is tested
+// with files that do not exist, are empty, are truncated, or are not images,
+// and 'loadTimeZone' is tested against the time zones that were written.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ImageFileLoader();
+// [ 2] explicit ImageFileLoader(const allocator_type&);
+// [ 2] ~ImageFileLoader();
+//
+// MANIPULATORS
+// [ 2] int mapImage(const char *);
+// [ 2] void unmapImage();
+// [ 3] int loadTimeZone(Zoneinfo *, const char *);
+//
+// ACCESSORS
+// [ 2] const ZoneinfoImage& image() const;
+// [ 2] const bsl::string& imagePath() const;
+// [ 2] bool isMapped() const;
+// [ 2] allocator_type get_allocator() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baltzo::ImageFileLoader     Obj;
+typedef Obj::allocator_type         AllocType;
+typedef baltzo::Zoneinfo            Zone;
+typedef baltzo::LocalTimeDescriptor Desc;
+typedef bdls::FilesystemUtil        FileUtil;
+
+BSLMF_ASSERT((bsl::uses_allocator<Obj, bsl::allocator<char> >::value));
+BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+// ============================================================================
+//                              TEST FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+bsl::string makeFileName(const char *name)
+    // Return the name of a file, unique to this process, having the specified
+    // 'name'.
+{
+    char buffer[64];
+    bsl::sprintf(buffer,
+                 "baltzo_imagefileloader.%d.",
+                 bdls::ProcessUtil::getProcessId());
+    return bsl::string(buffer) + name;
+}
+
+void makeZone(Zone *result, const char *id, int utcOffsetInSeconds)
+    // Load into the specified 'result' a well-formed time zone having the
+    // specified 'id', an initial transition to the specified
+    // 'utcOffsetInSeconds', and a transition to daylight-saving time in 2020.
+{
+    result->setIdentifier(id);
+    result->addTransition(
+            bdlt::EpochUtil::convertToTimeT64(bdlt::Datetime(1, 1, 1)),
+            Desc(utcOffsetInSeconds, false, "STD"));
+    result->addTransition(
+            bdlt::EpochUtil::convertToTimeT64(bdlt::Datetime(2020, 3, 1)),
+            Desc(utcOffsetInSeconds + 3600, true, "DST"));
+}
+
+void writeFile(const bsl::string& path, const char *data, bsl::size_t length)
+    // Write into the file at the specified 'path' the specified 'length'
+    // bytes at the specified 'data', replacing the file if it exists.
+{
+    bsl::ofstream stream(path.c_str(), bsl::ios::out | bsl::ios::binary);
+    stream.write(data, length);
+    ASSERT(stream);
+}
+
+bsl::string writeImageFile(const bsl::string&  path,
+                           const Zone *const  *timeZones,
+                           int                 numTimeZones)
+    // Write into the file at the specified 'path' the image of the specified
+    // 'numTimeZones' elements of the specified 'timeZones', and return the
+    // image.
+{
+    bsl::ostringstream stream;
+    ASSERT(0 == baltzo::ZoneinfoImage::writeImage(stream,
+                                                  timeZones,
+                                                  numTimeZones));
+    const bsl::string image = stream.str();
+    writeFile(path, image.data(), image.size());
+    return image;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Write an image file having the time zones used by the usage
+        //:   example, incorporate the usage example from the header into the
+        //:   test driver, remove leading comment characters, and replace
+        //:   'assert' with 'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::DefaultAllocatorGuard usageGuard(&ta);
+
+        const bsl::string IMAGE_FILE = u::makeFileName("zoneinfo.img");
+        {
+            Zone london(&ta), newYork(&ta);
+            u::makeZone(&london,  "Europe/London",    0);
+            u::makeZone(&newYork, "America/New_York", -5 * 3600);
+
+            const Zone *ZONES[] = { &london, &newYork };
+            u::writeImageFile(IMAGE_FILE, ZONES, 2);
+        }
+
+        {
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Loading a Time Zone from an Image File
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the image of the system Zoneinfo database has been written to
+// the file "zoneinfo.img" (e.g., by the 'zoneinfo_compiler' tool, or by
+// 'baltzo::ZoneinfoImageUtil::writeImageFile').
+//
+// First, we create a 'baltzo::ImageFileLoader' and map the image file:
+//..
+    baltzo::ImageFileLoader loader;
+    int rc = loader.mapImage(IMAGE_FILE.c_str());
+    ASSERT(0 == rc);
+    ASSERT(loader.isMapped());
+//..
+// Then, we load the time zone for New York:
+//..
+    baltzo::Zoneinfo newYork;
+    rc = loader.loadTimeZone(&newYork, "America/New_York");
+    ASSERT(0 == rc);
+    ASSERT("America/New_York" == newYork.identifier());
+//..
+// Now, we observe that a time zone that is not in the image is reported as
+// unsupported:
+//..
+    baltzo::Zoneinfo unknown;
+    rc = loader.loadTimeZone(&unknown, "Not/A_Time_Zone");
+    ASSERT(baltzo::ErrorCode::k_UNSUPPORTED_ID == rc);
+//..
+// Finally, we supply the loader to a 'baltzo::ZoneinfoCache', so that the
+// time zones used by the process are loaded from the image on demand:
+//..
+    baltzo::ZoneinfoCache cache(&loader);
+    const baltzo::Zoneinfo *cached = cache.getZoneinfo("Europe/London");
+    ASSERT(0 != cached);
+//..
+        }
+
+        FileUtil::remove(IMAGE_FILE);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadTimeZone'
+        //
+        // Concerns:
+        //: 1 'loadTimeZone' loads the time zone written to the image having
+        //:   the identifier, using the allocator of the result.
+        //:
+        //: 2 'loadTimeZone' returns 'ErrorCode::k_UNSUPPORTED_ID', leaving the
+        //:   result unchanged, for an identifier that is not in the image, and
+        //:   for every identifier if no image is mapped.
+        //:
+        //: 3 Time zones loaded by the loader are accepted by a
+        //:   'ZoneinfoCache'.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Map an image file of several time zones, including aliases, and
+        //:   load each of them.  (C-1)
+        //:
+        //: 2 Load identifiers that are not in the image, before and after the
+        //:   image is mapped.  (C-2)
+        //:
+        //: 3 Use the loader with a 'ZoneinfoCache'.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int loadTimeZone(Zoneinfo *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'loadTimeZone'" << endl
+                          << "======================" << endl;
+
+        const bsl::string IMAGE_FILE = u::makeFileName("load.img");
+
+        const struct {
+            int         d_line;
+            const char *d_id;
+            int         d_utcOffsetInSeconds;
+        } DATA[] = {
+            { L_, "America/New_York",     -5 * 3600 },
+            { L_, "Asia/Tokyo",            9 * 3600 },
+            { L_, "Europe/London",         0        },
+            { L_, "Europe/Paris",          1 * 3600 },
+            { L_, "US/Eastern",           -5 * 3600 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bsl::vector<Zone>         zones(NUM_DATA, Zone(&ta), &ta);
+        bsl::vector<const Zone *> pointers(&ta);
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            u::makeZone(&zones[ti],
+                        DATA[ti].d_id,
+                        DATA[ti].d_utcOffsetInSeconds);
+            pointers.push_back(&zones[ti]);
+        }
+        u::writeImageFile(IMAGE_FILE, pointers.data(), NUM_DATA);
+
+        Obj mX(&ta);
+
+        if (veryVerbose) cout << "\tNo image mapped." << endl;
+        {
+            Zone result(&ta);
+            u::makeZone(&result, "Unchanged", 60);
+            const Zone EXP(result, &ta);
+
+            ASSERT(baltzo::ErrorCode::k_UNSUPPORTED_ID ==
+                                      mX.loadTimeZone(&result, "Asia/Tokyo"));
+            ASSERT(EXP == result);
+        }
+
+        ASSERT(0 == mX.mapImage(IMAGE_FILE.c_str()));
+
+        if (veryVerbose) cout << "\tTime zones in the image." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *ID   = DATA[ti].d_id;
+
+            bslma::TestAllocator        la("load", veryVeryVeryVerbose);
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            Zone result(&la);
+            ASSERTV(LINE, 0 == mX.loadTimeZone(&result, ID));
+            ASSERTV(LINE, zones[ti] == result);
+            ASSERTV(LINE, &la == result.allocator());
+            ASSERTV(LINE, dam.isTotalSame());
+        }
+
+        if (veryVerbose) cout << "\tTime zones not in the image." << endl;
+        {
+            const char *IDS[] = { "", "America", "America/New_Yorkx",
+                                  "Asia/Tokyo ", "UTC", "ZZZ" };
+            const int NUM_IDS = static_cast<int>(sizeof IDS / sizeof *IDS);
+
+            for (int ti = 0; ti < NUM_IDS; ++ti) {
+                Zone result(&ta);
+                u::makeZone(&result, "Unchanged", 60);
+                const Zone EXP(result, &ta);
+
+                ASSERTV(ti, baltzo::ErrorCode::k_UNSUPPORTED_ID ==
+                                            mX.loadTimeZone(&result, IDS[ti]));
+                ASSERTV(ti, EXP == result);
+            }
+        }
+
+        if (veryVerbose) cout << "\tUsing a 'ZoneinfoCache'." << endl;
+        {
+            baltzo::ZoneinfoCache cache(&mX, &ta);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const Zone *zone = cache.getZoneinfo(DATA[ti].d_id);
+                ASSERTV(ti, 0 != zone);
+                ASSERTV(ti, 0 == zone || zones[ti] == *zone);
+            }
+            ASSERT(0 == cache.getZoneinfo("Not/A_Time_Zone"));
+        }
+
+        if (veryVerbose) cout << "\tAfter 'unmapImage'." << endl;
+        {
+            mX.unmapImage();
+
+            Zone result(&ta);
+            ASSERT(baltzo::ErrorCode::k_UNSUPPORTED_ID ==
+                                      mX.loadTimeZone(&result, "Asia/Tokyo"));
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Zone result(&ta);
+            ASSERT_PASS(mX.loadTimeZone(&result, "Asia/Tokyo"));
+            ASSERT_FAIL(mX.loadTimeZone(0,       "Asia/Tokyo"));
+            ASSERT_FAIL(mX.loadTimeZone(&result, 0));
+        }
+
+        FileUtil::remove(IMAGE_FILE);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'mapImage', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed loader has no mapped image, and uses the
+        //:   allocator supplied at construction, or the default allocator.
+        //:
+        //: 2 'mapImage' maps an image file, after which the view returned by
+        //:   'image' refers to the contents of the file, and 'imagePath' is
+        //:   the path of the file.
+        //:
+        //: 3 'mapImage' fails, with no effect, for a file that does not
+        //:   exist, is empty, is truncated, or is not an image.
+        //:
+        //: 4 'mapImage' replaces a previously mapped image.
+        //:
+        //: 5 'unmapImage' and the destructor unmap the image, and 'unmapImage'
+        //:   has no effect if no image is mapped.
+        //:
+        //: 6 The mapping does not depend on the file remaining at its path.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create loaders with and without an allocator.  (C-1)
+        //:
+        //: 2 Write image files of different time zones, and map each of them
+        //:   in turn, comparing the view with the written image.  (C-2, 4)
+        //:
+        //: 3 Map files that are not valid images after mapping a valid one.
+        //:   (C-3)
+        //:
+        //: 4 Unmap the image, and call 'unmapImage' again.  (C-5)
+        //:
+        //: 5 Remove an image file while it is mapped, and access the view.
+        //:   (C-6)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   ImageFileLoader();
+        //   explicit ImageFileLoader(const allocator_type&);
+        //   ~ImageFileLoader();
+        //   int mapImage(const char *);
+        //   void unmapImage();
+        //   const ZoneinfoImage& image() const;
+        //   const bsl::string& imagePath() const;
+        //   bool isMapped() const;
+        //   allocator_type get_allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, 'mapImage', AND ACCESSORS"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        if (veryVerbose) cout << "\tConstruction." << endl;
+        {
+            const Obj X;
+            ASSERT(&defaultAllocator == X.get_allocator());
+            ASSERT(false == X.isMapped());
+            ASSERT(X.imagePath().empty());
+            ASSERT(0 == X.image().numTimeZones());
+
+            const Obj Y(&ta);
+            ASSERT(&ta == Y.get_allocator());
+            ASSERT(false == Y.isMapped());
+        }
+
+        const bsl::string FILE_A    = u::makeFileName("a.img");
+        const bsl::string FILE_B    = u::makeFileName("b.img");
+        const bsl::string EMPTY     = u::makeFileName("empty.img");
+        const bsl::string TRUNCATED = u::makeFileName("truncated.img");
+        const bsl::string GARBAGE   = u::makeFileName("garbage.img");
+        const bsl::string MISSING   = u::makeFileName("missing.img");
+
+        Zone a(&ta), b1(&ta), b2(&ta);
+        u::makeZone(&a,  "Zone/A",  3600);
+        u::makeZone(&b1, "Zone/B1", 7200);
+        u::makeZone(&b2, "Zone/B2", -7200);
+
+        const Zone *ZONES_A[] = { &a };
+        const Zone *ZONES_B[] = { &b1, &b2 };
+
+        const bsl::string IMAGE_A = u::writeImageFile(FILE_A, ZONES_A, 1);
+        const bsl::string IMAGE_B = u::writeImageFile(FILE_B, ZONES_B, 2);
+
+        u::writeFile(EMPTY, "", 0);
+        u::writeFile(TRUNCATED, IMAGE_A.data(), IMAGE_A.size() - 8);
+        {
+            bsl::string garbage(IMAGE_A.size(), 'x');
+            u::writeFile(GARBAGE, garbage.data(), garbage.size());
+        }
+
+        if (veryVerbose) cout << "\tMapping images." << endl;
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.mapImage(FILE_A.c_str()));
+            ASSERT(true   == X.isMapped());
+            ASSERT(FILE_A == X.imagePath());
+            ASSERT(IMAGE_A.size() == X.image().length());
+            ASSERT(0 == bsl::memcmp(IMAGE_A.data(),
+                                    X.image().data(),
+                                    IMAGE_A.size()));
+            ASSERT(1 == X.image().numTimeZones());
+            ASSERT(0 == X.image().findTimeZone("Zone/A"));
+
+            const char *FAILURES[] = {
+                MISSING.c_str(),
+                EMPTY.c_str(),
+                TRUNCATED.c_str(),
+                GARBAGE.c_str(),
+                "",
+            };
+            const int NUM_FAILURES =
+                         static_cast<int>(sizeof FAILURES / sizeof *FAILURES);
+
+            for (int ti = 0; ti < NUM_FAILURES; ++ti) {
+                const char *const PATH = FAILURES[ti];
+
+                if (veryVeryVerbose) { T_ T_ P(PATH) }
+
+                ASSERTV(PATH, 0 != mX.mapImage(PATH));
+                ASSERTV(PATH, true   == X.isMapped());
+                ASSERTV(PATH, FILE_A == X.imagePath());
+                ASSERTV(PATH, 0 == X.image().findTimeZone("Zone/A"));
+            }
+
+            ASSERT(0 == mX.mapImage(FILE_B.c_str()));
+            ASSERT(true   == X.isMapped());
+            ASSERT(FILE_B == X.imagePath());
+            ASSERT(IMAGE_B.size() == X.image().length());
+            ASSERT(2 == X.image().numTimeZones());
+            ASSERT(0 >  X.image().findTimeZone("Zone/A"));
+            ASSERT(1 == X.image().findTimeZone("Zone/B2"));
+
+            // The mapping remains valid after the file is removed.
+
+            ASSERT(0 == FileUtil::remove(FILE_B));
+            ASSERT(0 == bsl::memcmp(IMAGE_B.data(),
+                                    X.image().data(),
+                                    IMAGE_B.size()));
+
+            Zone result(&ta);
+            X.image().loadTimeZone(&result, 0);
+            ASSERT(b1 == result);
+
+            mX.unmapImage();
+            ASSERT(false == X.isMapped());
+            ASSERT(X.imagePath().empty());
+            ASSERT(0 == X.image().numTimeZones());
+            ASSERT(0 == X.image().data());
+
+            mX.unmapImage();
+            ASSERT(false == X.isMapped());
+
+            ASSERT(0 != mX.mapImage(FILE_B.c_str()));
+            ASSERT(false == X.isMapped());
+
+            ASSERT(dam.isTotalSame());
+        }
+
+        if (veryVerbose) cout << "\tDestruction." << endl;
+        {
+            Obj mX(&ta);
+            ASSERT(0 == mX.mapImage(FILE_A.c_str()));
+
+            // The destructor unmaps the image.
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+            ASSERT_PASS(mX.mapImage(FILE_A.c_str()));
+            ASSERT_FAIL(mX.mapImage(0));
+        }
+
+        FileUtil::remove(FILE_A);
+        FileUtil::remove(EMPTY);
+        FileUtil::remove(TRUNCATED);
+        FileUtil::remove(GARBAGE);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write an image file, map it, and load a time zone.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::string IMAGE_FILE = u::makeFileName("breathing.img");
+
+        Zone zone(&ta);
+        u::makeZone(&zone, "Breathing/Zone", 3600);
+
+        const Zone *ZONES[] = { &zone };
+        u::writeImageFile(IMAGE_FILE, ZONES, 1);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(false == X.isMapped());
+
+            ASSERT(0 == mX.mapImage(IMAGE_FILE.c_str()));
+            ASSERT(true == X.isMapped());
+            ASSERT(1 == X.image().numTimeZones());
+
+            Zone result(&ta);
+            ASSERT(0 == mX.loadTimeZone(&result, "Breathing/Zone"));
+            ASSERT(zone == result);
+
+            ASSERT(0 != mX.loadTimeZone(&result, "Breathing/Other"));
+        }
+
+        FileUtil::remove(IMAGE_FILE);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
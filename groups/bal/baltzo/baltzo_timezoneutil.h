@@ -490,6 +490,28 @@ struct TimeZoneUtil {
         // operation would have been outside the range of values representable
         // by the 'result' type.
 
+    static int convertUtcToLocalTime(bdlt::DatetimeTz      *results,
+                                     const char            *targetTimeZoneId,
+                                     const bdlt::Datetime  *utcTimes,
+                                     int                    numTimes);
+        // Load, into each of the specified 'numTimes' elements of the
+        // specified 'results' array, the local date-time value (in the time
+        // zone indicated by the specified 'targetTimeZoneId') corresponding to
+        // the element at the same index of the specified 'utcTimes' array.
+        // The offset from UTC of the time zone is rounded down to minute
+        // precision.  Return 0 on success, and a non-zero value otherwise.  A
+        // return value of 'ErrorCode::k_UNSUPPORTED_ID' indicates that
+        // 'targetTimeZoneId' was not recognized, in which case 'results' is
+        // not modified, and a return value of 'ErrorCode::k_OUT_OF_RANGE'
+        // indicates that the result of the operation would have been outside
+        // the range of values representable by 'bdlt::DatetimeTz' for at least
+        // one element, in which case that element of 'results' is not
+        // modified, and every other element is loaded.  The behavior is
+        // undefined unless '0 <= numTimes', and 'results' and 'utcTimes' each
+        // refer to an array of at least 'numTimes' elements.  Note that this
+        // function is considerably faster than converting each time
+        // individually, as the time zone is looked up only once.
+
     static int convertLocalToLocalTime(LocalDatetime         *result,
                                        const char            *targetTimeZoneId,
                                        const LocalDatetime&   srcTime);
@@ -702,6 +724,26 @@ int TimeZoneUtil::convertUtcToLocalTime(
                                          DefaultZoneinfoCache::defaultCache());
 }
 
+inline
+int TimeZoneUtil::convertUtcToLocalTime(
+                                       bdlt::DatetimeTz      *results,
+                                       const char            *targetTimeZoneId,
+                                       const bdlt::Datetime  *utcTimes,
+                                       int                    numTimes)
+{
+    BSLS_ASSERT(results || 0 == numTimes);
+    BSLS_ASSERT(targetTimeZoneId);
+    BSLS_ASSERT(utcTimes || 0 == numTimes);
+    BSLS_ASSERT(0 <= numTimes);
+
+    return TimeZoneUtilImp::convertUtcToLocalTime(
+                                         results,
+                                         targetTimeZoneId,
+                                         utcTimes,
+                                         numTimes,
+                                         DefaultZoneinfoCache::defaultCache());
+}
+
 inline
 int TimeZoneUtil::convertLocalToLocalTime(
                                         LocalDatetime        *result,
@@ -46,6 +46,7 @@ using namespace bsl;
 // CLASS METHODS
 // [ 6] convertUtcToLocalTime(LclDatetm *, const char *, const Datetm&);
 // [ 6] convertUtcToLocalTime(DatetmTz *, const char *, const Datetm&);
+// [12] convertUtcToLocalTime(DatetmTz *, const ch *, const Datetm *, int)
 // [ 8] convertLocalToLocalTime(LclDatetm *, const ch *, const LclDatetm&)
 // [ 8] convertLocalToLocalTime(LclDatetm *, const ch *, const DatetmTz&);
 // [ 8] convertLocalToLocalTime(DatetmTz *, const ch *, const LclDatetm&);
@@ -68,7 +69,7 @@ using namespace bsl;
 // [ 9] validateLocalTime(bool * result, const DatetmTz&, const char *TZ);
 // ----------------------------------------------------------------------------
 // [11] TESTING TIME CONVERSION OUT OF RANGE
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 // ============================================================================
 
 // ============================================================================
@@ -920,7 +921,7 @@ int main(int argc, char *argv[])
     baltzo::DefaultZoneinfoCache::setDefaultCache(&testCache);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -1182,6 +1183,78 @@ int main(int argc, char *argv[])
         }
         ASSERT(0 == defaultAllocator.numBytesInUse());
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'convertUtcToLocalTime' (BATCH)
+        //
+        // Concerns:
+        //: 1 The batch 'convertUtcToLocalTime' uses the default time zone
+        //:   cache, and loads each element of 'results' with the value that
+        //:   the single-value 'convertUtcToLocalTime' loads.
+        //:
+        //: 2 The method returns a non-zero value when given a bogus id.
+        //
+        // Plan:
+        //: 1 Convert a sequence of UTC times spanning several transitions of
+        //:   "America/New_York" and "Europe/Rome" in a single call, and
+        //:   compare each element with the result of the single-value
+        //:   'convertUtcToLocalTime'.  (C-1)
+        //:
+        //: 2 Call the batch 'convertUtcToLocalTime' with a bogus time zone
+        //:   id.  (C-2)
+        //
+        // Testing:
+        //   convertUtcToLocalTime(DatetmTz *, const ch *, const Datetm *, int)
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl
+                          << "CLASS METHOD 'convertUtcToLocalTime' (BATCH)"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        enum { k_NUM_TIMES = 1000 };
+
+        bdlt::Datetime utcTimes[k_NUM_TIMES];
+        {
+            bdlt::Datetime time(2005, 1, 1, 0, 30);
+            for (int i = 0; i < k_NUM_TIMES; ++i) {
+                utcTimes[i] = time;
+                time.addHours(43);
+            }
+        }
+
+        const char *IDS[] = { "America/New_York", "Europe/Rome" };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const char *TZID = IDS[ti];
+
+            bdlt::DatetimeTz results[k_NUM_TIMES];
+
+            ASSERTV(TZID, 0 == Obj::convertUtcToLocalTime(results,
+                                                          TZID,
+                                                          utcTimes,
+                                                          k_NUM_TIMES));
+
+            for (int i = 0; i < k_NUM_TIMES; ++i) {
+                bdlt::DatetimeTz expected;
+                ASSERTV(TZID, i, 0 == Obj::convertUtcToLocalTime(&expected,
+                                                                 TZID,
+                                                                 utcTimes[i]));
+                ASSERTV(TZID, i, expected, results[i],
+                        expected == results[i]);
+            }
+        }
+
+        {
+            bdlt::DatetimeTz results[2];
+
+            const int rc = Obj::convertUtcToLocalTime(results,
+                                                      "bogusId",
+                                                      utcTimes,
+                                                      2);
+            ASSERTV(rc, baltzo::ErrorCode::k_UNSUPPORTED_ID == rc);
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 144183882
@@ -4,6 +4,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baltzo_timezoneutilimp_cpp,"$Id$ $CSID$")
 
+#include <baltzo_compiledzoneinfo.h>
 #include <baltzo_defaultzoneinfocache.h>
 #include <baltzo_errorcode.h>
 #include <baltzo_localtimedescriptor.h>
@@ -55,6 +56,32 @@ int lookupTimeZone(const baltzo::Zoneinfo **timeZone,
     return rc;
 }
 
+static
+int lookupCompiledTimeZone(const baltzo::CompiledZoneinfo **timeZone,
+                           const char                      *timeZoneId,
+                           baltzo::ZoneinfoCache           *cache)
+    // Load, into the specified 'timeZone', the address of the compiled time
+    // zone information having the specified 'timeZoneId' from the specified
+    // 'cache'.  Return 0 on success, and a non-zero value otherwise.  A return
+    // status of 'baltzo::ErrorCode::k_UNSUPPORTED_ID' indicates that
+    // 'timeZoneId' is not recognized.
+{
+    BSLS_ASSERT(timeZone);
+    BSLS_ASSERT(timeZoneId);
+    BSLS_ASSERT(cache);
+
+    int rc = 0;
+    *timeZone = cache->getCompiledZoneinfo(&rc, timeZoneId);
+    BSLS_ASSERT((0 == rc && 0 != *timeZone) || (0 != rc && 0 == *timeZone));
+
+    if (0 == *timeZone) {
+        BSLS_LOG_INFO("No data found for time zone '%s' (rc = %d).",
+                      timeZoneId, rc);
+    }
+
+    return rc;
+}
+
 static
 baltzo::Zoneinfo::TransitionConstIterator findTransitionWithDstFlag(
                      const bool                                       dstFlag,
@@ -214,21 +241,40 @@ int TimeZoneUtilImp::convertUtcToLocalTime(
     BSLS_ASSERT(resultTimeZoneId);
     BSLS_ASSERT(cache);
 
-    const Zoneinfo *timeZone;
-    int rc = lookupTimeZone(&timeZone, resultTimeZoneId, cache);
+    const CompiledZoneinfo *timeZone;
+    int rc = lookupCompiledTimeZone(&timeZone, resultTimeZoneId, cache);
     if (0 != rc) {
         return rc;                                                    // RETURN
     }
 
-    Zoneinfo::TransitionConstIterator it;
-    rc = ZoneinfoUtil::convertUtcToLocalTime(result,
-                                             &it,
-                                             utcTime,
-                                             *timeZone);
+    return timeZone->convertUtcToLocalTime(result, utcTime);
+}
+
+int TimeZoneUtilImp::convertUtcToLocalTime(
+                                       bdlt::DatetimeTz      *results,
+                                       const char            *resultTimeZoneId,
+                                       const bdlt::Datetime  *utcTimes,
+                                       int                    numTimes,
+                                       ZoneinfoCache         *cache)
+{
+    BSLS_ASSERT(results || 0 == numTimes);
+    BSLS_ASSERT(resultTimeZoneId);
+    BSLS_ASSERT(utcTimes || 0 == numTimes);
+    BSLS_ASSERT(0 <= numTimes);
+    BSLS_ASSERT(cache);
+
+    const CompiledZoneinfo *timeZone;
+    int rc = lookupCompiledTimeZone(&timeZone, resultTimeZoneId, cache);
     if (0 != rc) {
         return rc;                                                    // RETURN
     }
-    return 0;
+
+    for (int i = 0; i < numTimes; ++i) {
+        if (0 != timeZone->convertUtcToLocalTime(results + i, utcTimes[i])) {
+            rc = ErrorCode::k_OUT_OF_RANGE;
+        }
+    }
+    return rc;
 }
 
 int TimeZoneUtilImp::initLocalTime(bdlt::DatetimeTz        *result,
@@ -173,6 +173,28 @@ struct TimeZoneUtilImp {
         // indicates that an out of range value of 'result' would have
         // occurred.
 
+    static int convertUtcToLocalTime(bdlt::DatetimeTz      *results,
+                                     const char            *resultTimeZoneId,
+                                     const bdlt::Datetime  *utcTimes,
+                                     int                    numTimes,
+                                     ZoneinfoCache         *cache);
+        // Load, into each of the specified 'numTimes' elements of the
+        // specified 'results' array, the local date-time value, in the time
+        // zone indicated by the specified 'resultTimeZoneId', corresponding to
+        // the element at the same index of the specified 'utcTimes' array,
+        // using time zone information supplied by the specified 'cache'.
+        // Return 0 on success, and a non-zero value otherwise.  A return
+        // status of 'ErrorCode::k_UNSUPPORTED_ID' indicates that
+        // 'resultTimeZoneId' is not recognized, in which case 'results' is not
+        // modified, and a return status of 'ErrorCode::k_OUT_OF_RANGE'
+        // indicates that an out of range value would have occurred for at
+        // least one element, in which case that element of 'results' is not
+        // modified, and every other element is loaded.  The behavior is
+        // undefined unless '0 <= numTimes', and 'results' and 'utcTimes' each
+        // refer to an array of at least 'numTimes' elements.  Note that the
+        // time zone is looked up once, and that each element is converted in
+        // constant time (see 'baltzo_compiledzoneinfo').
+
     static void createLocalTimePeriod(
                           LocalTimePeriod                          *result,
                           const Zoneinfo::TransitionConstIterator&  transition,
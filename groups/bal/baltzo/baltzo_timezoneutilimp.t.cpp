@@ -31,6 +31,7 @@
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 #undef DS
 
@@ -58,9 +59,10 @@ using namespace bsl;
 // [ 4] 'initLocalTime(DatetimeTz *, Datetime& , char *, Dst, Cache *)
 // [ 5] 'createLocalTimePeriod(Period *, TransitionConstIter, Zoneinfo)'
 // [ 6] 'loadLocalTimePeriodForUtc(DatetimeTz *, Datetime& , char *, Cache *)
+// [ 7] convertUtcToLocalTime(DatetimeTz *, char *, Datetime *, int, ...)
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
 //-----------------------------------------------------------------------------
@@ -998,7 +1000,7 @@ int main(int argc, char *argv[])
     baltzo::DefaultZoneinfoCache::setDefaultCache(&badCache);
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1127,6 +1129,142 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'convertUtcToLocalTime' (BATCH):
+        //
+        // Concerns:
+        //: 1 Each element of 'results' is loaded with the value that the
+        //:   single-value 'convertUtcToLocalTime' loads for the corresponding
+        //:   element of 'utcTimes'.
+        //:
+        //: 2 Return 'Err::k_UNSUPPORTED_ID', and do not modify 'results', if
+        //:   an invalid time zone id is passed.
+        //:
+        //: 3 An element whose conversion would be out of range is not
+        //:   modified, every other element is loaded, and
+        //:   'Err::k_OUT_OF_RANGE' is returned.
+        //:
+        //: 4 A batch of 0 elements succeeds.
+        //
+        // Plan:
+        //: 1 For each of a set of time zones, convert a sequence of UTC times,
+        //:   spanning the years 1900 to 2200 at an interval of about 17 days,
+        //:   in a single call, and compare each element with the result of
+        //:   the single-value 'convertUtcToLocalTime'.  (C-1)
+        //:
+        //: 2 Invoke the batch 'convertUtcToLocalTime' passing an invalid time
+        //:   zone id and check the result and the elements.  (C-2)
+        //:
+        //: 3 Convert a batch whose last element is the maximum 'Datetime'
+        //:   value in a time zone having a positive UTC offset.  (C-3)
+        //:
+        //: 4 Convert an empty batch.  (C-4)
+        //
+        // Testing:
+        //   convertUtcToLocalTime(DatetimeTz *, char *, Datetime *, int, ...)
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl << "'convertUtcToLocalTime' (BATCH)" << endl
+                                  << "===============================" << endl;
+
+        enum { k_NUM_TIMES = 6500 };
+
+        bsl::vector<bdlt::Datetime> utcTimes(Z);
+        utcTimes.reserve(k_NUM_TIMES);
+        {
+            bdlt::Datetime time(1900, 1, 1, 3, 17, 29);
+            for (int i = 0; i < k_NUM_TIMES; ++i) {
+                utcTimes.push_back(time);
+                time.addSeconds(17 * 24 * 60 * 60 - 2387);
+            }
+        }
+
+        if (veryVerbose) cout << "\tCompare with single conversions." << endl;
+        {
+            const char *IDS[] = { NY, RY, SA, GMT, GP1, GP2, GM1, RM,
+                                  ALLDST, OLDDST };
+            const int NUM_IDS = static_cast<int>(sizeof IDS / sizeof *IDS);
+
+            for (int ti = 0; ti < NUM_IDS; ++ti) {
+                const char *TZID = IDS[ti];
+
+                if (veryVeryVerbose) { T_ T_ P(TZID) }
+
+                bsl::vector<bdlt::DatetimeTz> results(k_NUM_TIMES, Z);
+
+                LOOP_ASSERT(TZID, 0 == Obj::convertUtcToLocalTime(
+                                                                  &results[0],
+                                                                  TZID,
+                                                                  &utcTimes[0],
+                                                                  k_NUM_TIMES,
+                                                                  &testCache));
+
+                for (int i = 0; i < k_NUM_TIMES; ++i) {
+                    bdlt::DatetimeTz expected;
+                    LOOP2_ASSERT(TZID, i, 0 == Obj::convertUtcToLocalTime(
+                                                                  &expected,
+                                                                  TZID,
+                                                                  utcTimes[i],
+                                                                  &testCache));
+                    LOOP3_ASSERT(TZID, i, results[i],
+                                 expected == results[i]);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting an invalid time zone id." << endl;
+        {
+            const bdlt::DatetimeTz INITIAL(bdlt::Datetime(2000, 1, 1), 7);
+
+            bsl::vector<bdlt::DatetimeTz> results(3, INITIAL, Z);
+
+            ASSERT(EUID == Obj::convertUtcToLocalTime(&results[0],
+                                                      "bogusId",
+                                                      &utcTimes[0],
+                                                      3,
+                                                      &testCache));
+            for (int i = 0; i < 3; ++i) {
+                LOOP_ASSERT(i, INITIAL == results[i]);
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting an out of range element." << endl;
+        {
+            const bdlt::DatetimeTz INITIAL(bdlt::Datetime(2000, 1, 1), 7);
+
+            const bdlt::Datetime UTC_TIMES[] = {
+                bdlt::Datetime(2010, 1, 1, 12),
+                bdlt::Datetime(9999, 12, 31, 23, 59, 59, 999),
+                bdlt::Datetime(2010, 7, 1, 12),
+            };
+
+            bsl::vector<bdlt::DatetimeTz> results(3, INITIAL, Z);
+
+            ASSERT(Err::k_OUT_OF_RANGE == Obj::convertUtcToLocalTime(
+                                                                  &results[0],
+                                                                  RY,
+                                                                  UTC_TIMES,
+                                                                  3,
+                                                                  &testCache));
+
+            ASSERT(bdlt::Datetime(2010, 1, 1, 15) ==
+                                                 results[0].localDatetime());
+            ASSERT(INITIAL                        == results[1]);
+            ASSERT(bdlt::Datetime(2010, 7, 1, 15) ==
+                                                 results[2].localDatetime());
+        }
+
+        if (veryVerbose) cout << "\tTesting an empty batch." << endl;
+        {
+            bdlt::DatetimeTz result;
+
+            ASSERT(0 == Obj::convertUtcToLocalTime(&result,
+                                                   NY,
+                                                   &utcTimes[0],
+                                                   0,
+                                                   &testCache));
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // CLASS METHOD 'loadLocalTimePeriodForUtc':
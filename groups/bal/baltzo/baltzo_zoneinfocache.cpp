@@ -7,16 +7,20 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp, "$Id$ $CSID$")
 #include <baltzo_errorcode.h>         // for testing only
 #include <baltzo_zoneinfoutil.h>
 
-#include <bslmt_readlockguard.h>
-#include <bslmt_writelockguard.h>
+#include <bdlb_hashutil.h>
 
 #include <bslma_allocator.h>
+#include <bslma_deallocatorproctor.h>
 #include <bslma_rawdeleterproctor.h>
 
 #include <bslmf_assert.h>
 
+#include <bslmt_lockguard.h>
+
 #include <bsls_log.h>
 
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
 #include <bsl_set.h>
 #include <bsl_string.h>
 
@@ -27,21 +31,56 @@ namespace baltzo {
                             // class ZoneinfoCache
                             // -------------------
 
-// CREATORS
-ZoneinfoCache::~ZoneinfoCache()
+// PRIVATE CLASS METHODS
+void ZoneinfoCache::insertEntry(Table *table, const Entry *entry)
 {
-    for (ZoneinfoMap::iterator it  = d_cache.begin();
-                               it != d_cache.end();
-                               ++it) {
-        BSLS_ASSERT(0 != it->second);
-        d_allocator.mechanism()->deleteObject(it->second);
+    BSLS_ASSERT(table);
+    BSLS_ASSERT(entry);
+    BSLS_ASSERT(table->d_size < table->d_capacity);
+
+    const bsl::size_t mask = table->d_capacity - 1;
+
+    bsl::size_t index = entry->d_hash & mask;
+    while (0 != table->d_slots_p[index].loadRelaxed()) {
+        index = (index + 1) & mask;
+    }
+
+    // The release store publishes the entry, and the objects it refers to, to
+    // the threads that subsequently load the slot.
+
+    table->d_slots_p[index].storeRelease(entry);
+    ++table->d_size;
+}
+
+// PRIVATE MANIPULATORS
+ZoneinfoCache::Table *ZoneinfoCache::createTable(bsl::size_t capacity)
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    bslma::Allocator *allocator = d_allocator.mechanism();
+
+    Table *table = static_cast<Table *>(allocator->allocate(sizeof(Table)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(table, allocator);
+
+    void *slots = allocator->allocate(capacity * sizeof(Slot));
+
+    table->d_slots_p  = static_cast<Slot *>(slots);
+    table->d_capacity = capacity;
+    table->d_size     = 0;
+
+    for (bsl::size_t i = 0; i < capacity; ++i) {
+        new (table->d_slots_p + i) Slot(0);
     }
+
+    proctor.release();
+    return table;
 }
 
-// MANIPULATORS
-const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
+int ZoneinfoCache::getEntry(const Entry **result, const char *timeZoneId)
 {
-    BSLS_ASSERT(0 != rc);
+    BSLS_ASSERT(0 != result);
     BSLS_ASSERT(0 != timeZoneId);
 
     enum {
@@ -52,89 +91,159 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
     BSLMF_ASSERT(static_cast<int>(ErrorCode::k_UNSUPPORTED_ID) !=
                  static_cast<int>(FAILURE));
 
-    const Zoneinfo *result = lookupZoneinfo(timeZoneId);
+    *result = findEntry(timeZoneId);
+    if (0 != *result) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    // 'timeZoneId' may have been added to the cache between the call to
+    // 'findEntry', and the acquisition of 'd_lock'.
 
-    if (0 != result) {
-        *rc = 0;
-        return result;                                                // RETURN
+    *result = findEntry(timeZoneId);
+    if (0 != *result) {
+        return 0;                                                     // RETURN
     }
 
-    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
+    bslma::Allocator *allocator = d_allocator.mechanism();
 
-    // We use 'lower_bound' to return the position where the 'timeZoneId'
-    // should be (even if it is not in the map), so that it can be used as an
-    // insertion hint.
+    // Create a proctor for the new time zone value.
 
-    ZoneinfoMap::iterator it = d_cache.lower_bound(timeZoneId);
+    Zoneinfo *newTimeZonePtr = new (*allocator) Zoneinfo(allocator);
 
-    if (d_cache.end() != it && !(d_cache.key_comp()(timeZoneId, it->first))) {
-        // 'timeZoneId' must have been added to the map between the call to
-        // 'lookupTimeZone', and the acquisition of the write-lock on 'd_lock'.
+    bslma::RawDeleterProctor<Zoneinfo, bslma::Allocator> proctor(
+                                                                newTimeZonePtr,
+                                                                allocator);
 
-        BSLS_ASSERT(0 != it->second);
-        *rc    = 0;
-        result = it->second;
+    int rc = d_loader_p->loadTimeZone(newTimeZonePtr, timeZoneId);
+    if (0 != rc) {
+        if (ErrorCode::k_UNSUPPORTED_ID != rc) {
+            BSLS_LOG_ERROR("Unexpected error code loading time zone "
+                           "%s : %d", timeZoneId, rc);
+        }
+        return rc;                                                    // RETURN
+    }
+    if (!ZoneinfoUtil::isWellFormed(*newTimeZonePtr)) {
+        BSLS_LOG_ERROR("Loaded zone info object for %s is not well-formed",
+                       timeZoneId);
+        return FAILURE;                                               // RETURN
     }
-    else {
-        // Create a proctor for the new time zone value.
 
-        Zoneinfo *newTimeZonePtr =
-            new (*(d_allocator.mechanism())) Zoneinfo(d_allocator.mechanism());
+    if (newTimeZonePtr->identifier() != timeZoneId) {
+        BSLS_LOG_ERROR("Loaded time zone id %s does not match "
+                       "request id: %s",
+                       newTimeZonePtr->identifier().c_str(),
+                       timeZoneId);
+        return FAILURE;                                               // RETURN
+    }
 
-        bslma::RawDeleterProctor<Zoneinfo, bslma::Allocator>  proctor(
-                                                      newTimeZonePtr,
-                                                      d_allocator.mechanism());
+    CompiledZoneinfo *newCompiledPtr =
+                 new (*allocator) CompiledZoneinfo(*newTimeZonePtr, allocator);
 
-        *rc = d_loader_p->loadTimeZone(newTimeZonePtr, timeZoneId);
-        if (0 != *rc) {
-            if (ErrorCode::k_UNSUPPORTED_ID != *rc) {
-                BSLS_LOG_ERROR("Unexpected error code loading time zone "
-                               "%s : %d", timeZoneId, *rc);
-            }
-            return 0;                                                 // RETURN
-        }
-        if (!ZoneinfoUtil::isWellFormed(*newTimeZonePtr)) {
-            BSLS_LOG_ERROR("Loaded zone info object for %s is not well-formed",
-                           timeZoneId);
-            *rc = FAILURE;
-            return 0;                                                 // RETURN
-        }
+    bslma::RawDeleterProctor<CompiledZoneinfo, bslma::Allocator>
+                                       compiledProctor(newCompiledPtr,
+                                                       allocator);
 
-        if (newTimeZonePtr->identifier() != timeZoneId) {
-            BSLS_LOG_ERROR("Loaded time zone id %s does not match "
-                           "request id: %s",
-                           newTimeZonePtr->identifier().c_str(),
-                           timeZoneId);
-            *rc = FAILURE;
-            return 0;                                                 // RETURN
-        }
+    Entry *entry = new (*allocator) Entry;
+
+    bslma::DeallocatorProctor<bslma::Allocator> entryProctor(entry,
+                                                             allocator);
+
+    const bsl::string& id = newTimeZonePtr->identifier();
+
+    entry->d_timeZoneId_p = id.c_str();
+    entry->d_hash         = bdlb::HashUtil::hash1(id.c_str(),
+                                                  static_cast<int>(id.size()));
+    entry->d_zoneinfo_p   = newTimeZonePtr;
+    entry->d_compiled_p   = newCompiledPtr;
 
-        d_cache.insert(
-                  it,
-                  ZoneinfoMap::value_type(newTimeZonePtr->identifier().c_str(),
-                                          newTimeZonePtr));
-        result = newTimeZonePtr;
+    d_entries.reserve(d_entries.size() + 1);
 
-        // The pointer has been copied, so the proctor must release ownership.
+    // Replace the current table by one of twice the capacity if the new entry
+    // would make it more than half full.  Nothing can throw once the new
+    // table is created.
+
+    Table *table = d_table_p.loadRelaxed();
+    if (0 == table || table->d_capacity < 2 * (table->d_size + 1)) {
+        d_tables.reserve(d_tables.size() + 1);
+
+        table = createTable(0 == table
+                            ? static_cast<bsl::size_t>(k_INITIAL_CAPACITY)
+                            : 2 * table->d_capacity);
+        d_tables.push_back(table);
+
+        for (bsl::size_t i = 0; i < d_entries.size(); ++i) {
+            insertEntry(table, d_entries[i]);
+        }
+        insertEntry(table, entry);
 
-        proctor.release();
+        d_table_p.storeRelease(table);
     }
+    else {
+        insertEntry(table, entry);
+    }
+    d_entries.push_back(entry);
+
+    // The entry has been published, so the proctors must release ownership.
+
+    entryProctor.release();
+    compiledProctor.release();
+    proctor.release();
 
-    return result;
+    *result = entry;
+    return 0;
 }
 
-// ACCESSORS
-const Zoneinfo *ZoneinfoCache::lookupZoneinfo(const char *timeZoneId) const
+// PRIVATE ACCESSORS
+const ZoneinfoCache::Entry *ZoneinfoCache::findEntry(
+                                                  const char *timeZoneId) const
 {
     BSLS_ASSERT(0 != timeZoneId);
 
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
+    const Table *table = d_table_p.loadAcquire();
+    if (0 == table) {
+        return 0;                                                     // RETURN
+    }
+
+    const unsigned int hash = bdlb::HashUtil::hash1(
+                                timeZoneId,
+                                static_cast<int>(bsl::strlen(timeZoneId)));
+    const bsl::size_t  mask = table->d_capacity - 1;
 
-    ZoneinfoMap::const_iterator it = d_cache.find(timeZoneId);
-    if (d_cache.end() != it) {
-        return it->second;                                            // RETURN
+    // The table is never full, so that the probe reaches an empty slot.
+
+    for (bsl::size_t index = hash & mask;; index = (index + 1) & mask) {
+        const Entry *entry = table->d_slots_p[index].loadAcquire();
+        if (0 == entry) {
+            return 0;                                                 // RETURN
+        }
+        if (hash == entry->d_hash
+         && 0 == bsl::strcmp(entry->d_timeZoneId_p, timeZoneId)) {
+            return entry;                                             // RETURN
+        }
+    }
+}
+
+// CREATORS
+ZoneinfoCache::~ZoneinfoCache()
+{
+    bslma::Allocator *allocator = d_allocator.mechanism();
+
+    for (bsl::size_t i = 0; i < d_entries.size(); ++i) {
+        Entry *entry = d_entries[i];
+
+        BSLS_ASSERT(0 != entry->d_zoneinfo_p);
+        BSLS_ASSERT(0 != entry->d_compiled_p);
+
+        allocator->deleteObject(entry->d_compiled_p);
+        allocator->deleteObject(entry->d_zoneinfo_p);
+        allocator->deallocate(entry);
+    }
+    for (bsl::size_t i = 0; i < d_tables.size(); ++i) {
+        allocator->deallocate(d_tables[i]->d_slots_p);
+        allocator->deallocate(d_tables[i]);
     }
-    return 0;
 }
 
 }  // close package namespace
@@ -10,7 +10,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  baltzo::ZoneinfoCache: a cache for time-zone information
 //
-//@SEE_ALSO: baltzo_zoneinfo, baltzo_defaultzoneinfocache
+//@SEE_ALSO: baltzo_zoneinfo, baltzo_compiledzoneinfo,
+//           baltzo_defaultzoneinfocache
 //
 //@DESCRIPTION: This component defines a class, 'baltzo::ZoneinfoCache', that
 // serves as a cache of 'baltzo::Zoneinfo' objects.  A time-zone cache is
@@ -22,6 +23,34 @@ BSLS_IDENT("$Id: $")
 // 'getZoneinfo' and 'lookupZoneinfo'.  Addresses returned by either of these
 // methods are valid for the lifetime of the cache.
 //
+// Each time zone loaded into the cache is also compiled into a
+// 'baltzo::CompiledZoneinfo' (see 'baltzo_compiledzoneinfo'), a table that
+// provides the UTC offset in effect at a UTC time in constant time, and whose
+// address is returned by 'getCompiledZoneinfo' and 'lookupCompiledZoneinfo'.
+//
+///Lock-Free Lookup
+///----------------
+// Time zones are loaded rarely (typically once per time zone over the
+// lifetime of a process), and looked up very frequently, often from many
+// threads at once.  Lookups therefore take no lock: the cache publishes,
+// through an atomic pointer, an open-addressing hash table of immutable
+// entries, each holding the identifier and the addresses of the 'Zoneinfo'
+// and 'CompiledZoneinfo' objects of a time zone.  A lookup hashes the
+// identifier and probes the published table, so that concurrent lookups
+// neither contend on a shared reader count nor write to shared memory.
+//
+// Loading a time zone is serialized by a mutex.  The loading thread loads and
+// compiles the time zone, and publishes its entry by storing the entry's
+// address into an empty slot of the current table.  A table is never more
+// than half full: when an entry would exceed that load, a table of twice the
+// capacity is filled with all of the entries and published in place of the
+// current one.  Because a thread may still be probing a replaced table, a
+// replaced table is released only when the cache is destroyed; the capacities
+// of the tables growing geometrically, the replaced tables occupy less memory
+// than the current one.  Entries, as well as the 'Zoneinfo' and
+// 'CompiledZoneinfo' objects they refer to, are never modified once
+// published, and are released only when the cache is destroyed.
+//
 ///Thread Safety
 ///-------------
 // 'baltzo::ZoneinfoCache' is fully *thread-safe*, meaning that all non-creator
@@ -146,23 +175,23 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <baltzo_compiledzoneinfo.h>
 #include <baltzo_loader.h>
 #include <baltzo_zoneinfo.h>
 
-#include <bdlb_cstringless.h>
-
 #include <bslma_stdallocator.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
 
-#include <bslmt_rwmutex.h>
+#include <bslmt_mutex.h>
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_review.h>
 
-#include <bsl_map.h>
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace baltzo {
@@ -191,18 +220,79 @@ class ZoneinfoCache {
 
   private:
     // PRIVATE TYPES
-    typedef bsl::map<const char *, Zoneinfo *, bdlb::CStringLess> ZoneinfoMap;
+    struct Entry {
+        // A cached time zone.  Entries are immutable once published.
 
-    // DATA
-    ZoneinfoMap             d_cache;      // cached time-zone info, indexed by
-                                          // time-zone id
+        const char       *d_timeZoneId_p;  // time-zone id (held, not owned)
+
+        unsigned int      d_hash;          // hash of 'd_timeZoneId_p'
+
+        Zoneinfo         *d_zoneinfo_p;    // time-zone information (owned)
+
+        CompiledZoneinfo *d_compiled_p;    // compiled time-zone information
+                                           // (owned)
+    };
+
+    typedef bsls::AtomicPointer<const Entry> Slot;
+
+    enum { k_INITIAL_CAPACITY = 16 };  // capacity of the first table
 
-    Loader                 *d_loader_p;   // loader used to obtain time-zone
-                                          // information (held, not owned)
+    struct Table {
+        // An open-addressing hash table of entries, probed linearly, that is
+        // never more than half full.
 
-    mutable bslmt::RWMutex  d_lock;       // cache access synchronization
+        Slot        *d_slots_p;   // array of 'd_capacity' slots (owned)
 
-    allocator_type          d_allocator;  // allocator used to supply memory
+        bsl::size_t  d_capacity;  // number of slots, a power of 2
+
+        bsl::size_t  d_size;      // number of published entries
+    };
+
+    // DATA
+    bsl::vector<Entry *>        d_entries;    // cached time zones, in the
+                                              // order loaded (owned)
+
+    bsl::vector<Table *>        d_tables;     // every table published, the
+                                              // current one last (owned)
+
+    bsls::AtomicPointer<Table>  d_table_p;    // current table, or 0 if no
+                                              // time zone is cached (held,
+                                              // not owned)
+
+    Loader                     *d_loader_p;   // loader used to obtain
+                                              // time-zone information (held,
+                                              // not owned)
+
+    bslmt::Mutex                d_lock;       // serializes the loading of
+                                              // time zones
+
+    allocator_type              d_allocator;  // allocator used to supply
+                                              // memory
+
+    // PRIVATE CLASS METHODS
+    static void insertEntry(Table *table, const Entry *entry);
+        // Publish the specified 'entry' in the first empty slot of the
+        // specified 'table' at or after the slot indicated by its hash.  The
+        // behavior is undefined unless 'table' has an empty slot.
+
+    // PRIVATE MANIPULATORS
+    Table *createTable(bsl::size_t capacity);
+        // Return the address of a new, empty table having the specified
+        // 'capacity', allocated using the allocator of this object.  The
+        // behavior is undefined unless 'capacity' is a power of 2.
+
+    int getEntry(const Entry **result, const char *timeZoneId);
+        // Load into the specified 'result' the address of the entry for the
+        // time zone having the specified 'timeZoneId', loading that time zone
+        // if it has not been previously cached.  Return 0 on success,
+        // 'ErrorCode::k_UNSUPPORTED_ID' if the time-zone identifier is not
+        // supported, and a negative value otherwise.
+
+    // PRIVATE ACCESSORS
+    const Entry *findEntry(const char *timeZoneId) const;
+        // Return the address of the entry having the specified 'timeZoneId'
+        // in the current table, and 0 if there is no such entry, without
+        // taking a lock.
 
     // NOT IMPLEMENTED
     ZoneinfoCache(const ZoneinfoCache&);
@@ -249,7 +339,30 @@ class ZoneinfoCache {
         // valid for the lifetime of this object.  The behavior is undefined if
         // 'rc' is 0.
 
+    const CompiledZoneinfo *getCompiledZoneinfo(int        *rc,
+                                                const char *timeZoneId);
+        // Return the address of the non-modifiable 'CompiledZoneinfo' object
+        // compiled from the time-zone information identified by the specified
+        // 'timeZoneId', or 0 if the operation does not succeed.  If the
+        // information for 'timeZoneId' has not been previously cached, then
+        // attempt to populate this object using the 'loader' supplied at
+        // construction.  Load into the specified 'rc' 0 if the operation
+        // succeeds, 'ErrorCode::k_UNSUPPORTED_ID' if the time-zone identifier
+        // is not supported, and a negative value if the operation does not
+        // succeed for any other reason.  If the returned address is non-zero,
+        // the object it refers to remains valid for the lifetime of this
+        // object.
+
     // ACCESSORS
+    const CompiledZoneinfo *lookupCompiledZoneinfo(
+                                                const char *timeZoneId) const;
+        // Return the address of the non-modifiable 'CompiledZoneinfo' object
+        // compiled from the cached description of the time zone identified by
+        // the specified 'timeZoneId', and 0 if information for 'timeZoneId'
+        // has not previously been cached.  If the returned address is
+        // non-zero, the object it refers to remains valid for the lifetime of
+        // this object.
+
     const Zoneinfo *lookupZoneinfo(const char *timeZoneId) const;
         // Return the address of the non-modifiable cached description of the
         // time zone identified by the specified 'timeZoneId', and 0 if
@@ -276,8 +389,11 @@ class ZoneinfoCache {
 // CREATORS
 inline
 ZoneinfoCache::ZoneinfoCache(Loader *loader, const allocator_type&  allocator)
-: d_cache(allocator)
+: d_entries(allocator)
+, d_tables(allocator)
+, d_table_p(0)
 , d_loader_p(loader)
+, d_lock()
 , d_allocator(allocator)
 {
     BSLS_ASSERT(0 != loader);
@@ -293,6 +409,50 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(const char *timeZoneId)
     return getZoneinfo(&rc, timeZoneId);
 }
 
+inline
+const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
+{
+    BSLS_ASSERT(0 != rc);
+    BSLS_ASSERT(0 != timeZoneId);
+
+    const Entry *entry;
+    *rc = getEntry(&entry, timeZoneId);
+    return 0 == *rc ? entry->d_zoneinfo_p : 0;
+}
+
+inline
+const CompiledZoneinfo *ZoneinfoCache::getCompiledZoneinfo(
+                                                       int        *rc,
+                                                       const char *timeZoneId)
+{
+    BSLS_ASSERT(0 != rc);
+    BSLS_ASSERT(0 != timeZoneId);
+
+    const Entry *entry;
+    *rc = getEntry(&entry, timeZoneId);
+    return 0 == *rc ? entry->d_compiled_p : 0;
+}
+
+// ACCESSORS
+inline
+const CompiledZoneinfo *ZoneinfoCache::lookupCompiledZoneinfo(
+                                                  const char *timeZoneId) const
+{
+    BSLS_ASSERT(0 != timeZoneId);
+
+    const Entry *entry = findEntry(timeZoneId);
+    return entry ? entry->d_compiled_p : 0;
+}
+
+inline
+const Zoneinfo *ZoneinfoCache::lookupZoneinfo(const char *timeZoneId) const
+{
+    BSLS_ASSERT(0 != timeZoneId);
+
+    const Entry *entry = findEntry(timeZoneId);
+    return entry ? entry->d_zoneinfo_p : 0;
+}
+
 inline
 ZoneinfoCache::allocator_type ZoneinfoCache::get_allocator() const
 {
@@ -1,6 +1,7 @@
 // baltzo_zoneinfocache.t.cpp                                         -*-C++-*-
 #include <baltzo_zoneinfocache.h>
 
+#include <baltzo_compiledzoneinfo.h>
 #include <baltzo_errorcode.h>
 #include <baltzo_localtimedescriptor.h>
 #include <baltzo_zoneinfo.h>
@@ -27,6 +28,7 @@
 #include <bsls_types.h>
 
 #include <bsl_climits.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
@@ -76,13 +78,17 @@ using namespace std;
 // [ 6] const baltzo::Zoneinfo *getZoneinfo(const char *timeZoneId);
 // [ 5] const baltzo::Zoneinfo *getZoneinfo(int *rc, const char *timeZoneId);
 //
+// [ 9] const CompiledZoneinfo *getCompiledZoneinfo(int *, const char *);
+//
 // ACCESSORS
+// [ 9] const CompiledZoneinfo *lookupCompiledZoneinfo(const char *) const;
 // [ 6] const baltzo::Zoneinfo *lookupZoneinfo(const char *timeZoneId) const;
 // [ 4] allocator_type get_allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 // [ 8] CONCERN: All methods are thread-safe
+// [ 9] CONCERN: Lookups remain valid as the cache grows.
 // [ 7] CONCERN: ACCESSOR methods are declared 'const'.
 // [ 6] CONCERN: CREATOR & MANIPULATOR parameters are declared 'const'.
 // [ 7] CONCERN: No memory is ever allocated from the global allocator.
@@ -513,6 +519,78 @@ extern "C" void *workerThread(void *arg)
 
 }  // close namespace BALTZO_ZONEINFOCACHE_CONCURRENCY
 
+// ============================================================================
+//                 COMPILED ZONEINFO CONCERNS RELATED ENTRIES
+// ----------------------------------------------------------------------------
+
+namespace BALTZO_ZONEINFOCACHE_COMPILED {
+
+enum {
+    k_NUM_IDS   = 200,  // number of time zones loaded by the test
+    k_ID_LENGTH = 8     // size of the buffer holding each identifier
+};
+
+char IDS[k_NUM_IDS][k_ID_LENGTH];  // time-zone identifiers, "Z000", ...
+
+bsls::AtomicPointer<const baltzo::CompiledZoneinfo> COMPILED[k_NUM_IDS];
+    // address returned for each time zone by the first 'getCompiledZoneinfo'
+
+int utcOffset(int index)
+    // Return the UTC offset, in seconds, of the time zone having the
+    // specified 'index'.
+{
+    return (index - k_NUM_IDS / 2) * 60;
+}
+
+struct ThreadData {
+    Obj            *d_cache_p;    // cache under test
+    bslmt::Barrier *d_barrier_p;  // testing barrier
+    bsls::AtomicInt d_nextId;     // distinguishes the threads
+};
+
+extern "C" void *compiledWorkerThread(void *arg)
+{
+    ThreadData *p      = static_cast<ThreadData *>(arg);
+    const int   stride = 2 * p->d_nextId.add(1) + 1;  // coprime to 200
+
+    Obj& mX = *p->d_cache_p; const Obj& X = mX;
+
+    p->d_barrier_p->wait();
+
+    // Each thread loads the time zones in a different order, so that tables
+    // are replaced while other threads are looking up.
+
+    for (int n = 0; n < k_NUM_IDS; ++n) {
+        const int   i  = (n * stride) % k_NUM_IDS;
+        const char *ID = IDS[i];
+
+        typedef baltzo::CompiledZoneinfo Compiled;
+
+        const Compiled *result   = X.lookupCompiledZoneinfo(ID);
+        const Compiled *EXPECTED = COMPILED[i].loadAcquire();
+        ASSERTV(ID, 0 == result || 0 == EXPECTED || EXPECTED == result);
+
+        int rc = -1;
+        result = mX.getCompiledZoneinfo(&rc, ID);
+        ASSERTV(ID, rc, 0 == rc);
+        ASSERTV(ID, 0 != result);
+
+        const Compiled *previous = COMPILED[i].testAndSwap(0, result);
+        ASSERTV(ID, 0 == previous || previous == result);
+        ASSERTV(ID, utcOffset(i) == result->utcOffsetInSeconds(0));
+    }
+
+    p->d_barrier_p->wait();
+
+    for (int i = 0; i < k_NUM_IDS; ++i) {
+        ASSERTV(IDS[i],
+                COMPILED[i].loadRelaxed() == X.lookupCompiledZoneinfo(IDS[i]));
+    }
+    return 0;
+}
+
+}  // close namespace BALTZO_ZONEINFOCACHE_COMPILED
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -648,7 +726,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&globalAllocator);
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -782,6 +860,126 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING COMPILED ZONEINFO
+        //
+        // Concerns:
+        //: 1 'getCompiledZoneinfo' returns the 'CompiledZoneinfo' compiled
+        //:   from the 'Zoneinfo' returned by 'getZoneinfo' for the same
+        //:   identifier, loading the time zone if it is not cached, and
+        //:   'lookupCompiledZoneinfo' returns the same address once it is
+        //:   cached, and 0 before.
+        //:
+        //: 2 'getCompiledZoneinfo' reports the errors of 'getZoneinfo'.
+        //:
+        //: 3 Every time zone remains accessible, at the same address, as the
+        //:   cache grows, also while other threads are loading time zones.
+        //:
+        //: 4 All memory is supplied by the object allocator, and released on
+        //:   destruction.
+        //
+        // Plan:
+        //: 1 Load a number of time zones that causes the table of the cache
+        //:   to be replaced several times, and verify the results of the
+        //:   accessors for every time zone after each load.  (C-1, 3..4)
+        //:
+        //: 2 Request an unsupported and an invalid time zone.  (C-2)
+        //:
+        //: 3 Load the same time zones from several threads in different
+        //:   orders, and verify that each identifier yields a single address.
+        //:   (C-3)
+        //
+        // Testing:
+        //   const CompiledZoneinfo *getCompiledZoneinfo(int *, const char *);
+        //   const CompiledZoneinfo *lookupCompiledZoneinfo(const char *);
+        //   CONCERN: Lookups remain valid as the cache grows.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING COMPILED ZONEINFO" << endl
+                                  << "=========================" << endl;
+
+        using namespace BALTZO_ZONEINFOCACHE_COMPILED;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        TestDriverTestLoader testLoader(&ta);
+        for (int i = 0; i < k_NUM_IDS; ++i) {
+            bsl::sprintf(IDS[i], "Z%03d", i);
+            testLoader.addTimeZone(IDS[i], utcOffset(i), false, "Z");
+        }
+        testLoader.addTimeZone("Invalid", 0, false, 0);
+
+        if (verbose) cout << "\tTesting sequential loads." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&testLoader, &oa); const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM_IDS; ++i) {
+                const char *ID = IDS[i];
+
+                ASSERTV(ID, 0 == X.lookupCompiledZoneinfo(ID));
+
+                int rc = -1;
+                const baltzo::CompiledZoneinfo *compiled =
+                                               mX.getCompiledZoneinfo(&rc, ID);
+                ASSERTV(ID, rc, 0 == rc);
+                ASSERTV(ID, 0 != compiled);
+                ASSERTV(ID, ID == compiled->identifier());
+                ASSERTV(ID, utcOffset(i) == compiled->utcOffsetInSeconds(0));
+                ASSERTV(ID, compiled == X.lookupCompiledZoneinfo(ID));
+
+                const Zone *zone = X.lookupZoneinfo(ID);
+                ASSERTV(ID, 0 != zone);
+                ASSERTV(ID, zone == mX.getZoneinfo(&rc, ID));
+                ASSERTV(ID, compiled->numTransitions() ==
+                                                      zone->numTransitions());
+
+                for (int j = 0; j <= i; ++j) {
+                    const baltzo::CompiledZoneinfo *previous =
+                                            X.lookupCompiledZoneinfo(IDS[j]);
+                    ASSERTV(ID, IDS[j], 0 != previous);
+                    ASSERTV(ID, IDS[j], IDS[j] == previous->identifier());
+                }
+            }
+
+            int rc = 0;
+            ASSERT(0 == mX.getCompiledZoneinfo(&rc, "Unknown"));
+            ASSERT(UNSUPPORTED_ERR == rc);
+            ASSERT(0 == X.lookupCompiledZoneinfo("Unknown"));
+
+            rc = 0;
+            ASSERT(0 == mX.getCompiledZoneinfo(&rc, "Invalid"));
+            ASSERT(0 != rc);
+            ASSERT(UNSUPPORTED_ERR != rc);
+            ASSERT(0 == X.lookupCompiledZoneinfo("Invalid"));
+
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            ASSERT(0 <  oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tTesting concurrent loads." << endl;
+        {
+            enum { k_NUM_THREADS = 4 };
+
+            bslma::TestAllocator oa;  // thread-safe
+
+            bslmt::Barrier barrier(k_NUM_THREADS);
+            Obj            mX(&testLoader, &oa);
+            ThreadData     args;
+
+            args.d_cache_p   = &mX;
+            args.d_barrier_p = &barrier;
+
+            executeInParallel(k_NUM_THREADS, compiledWorkerThread, &args);
+
+            for (int i = 0; i < k_NUM_IDS; ++i) {
+                ASSERTV(i, COMPILED[i].loadRelaxed() ==
+                                            mX.lookupCompiledZoneinfo(IDS[i]));
+            }
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING CONCURRENT ACCESS
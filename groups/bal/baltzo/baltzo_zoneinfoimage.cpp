@@ -0,0 +1,588 @@
+// baltzo_zoneinfoimage.cpp                                           -*-C++-*-
+#include <baltzo_zoneinfoimage.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baltzo_zoneinfoimage_cpp,"$Id$ $CSID$")
+
+#include <baltzo_localtimedescriptor.h>
+#include <baltzo_zoneinfo.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_ios.h>
+#include <bsl_map.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baltzo {
+
+namespace {
+
+typedef unsigned int                   Uint32;
+typedef bsls::Types::Uint64            Uint64;
+typedef bdlt::EpochUtil::TimeT64       TimeT64;
+typedef ZoneinfoImage_Header           Header;
+typedef ZoneinfoImage_TimeZoneRecord   TimeZoneRecord;
+typedef ZoneinfoImage_DescriptorRecord DescriptorRecord;
+
+BSLMF_ASSERT(64 == sizeof(Header));
+BSLMF_ASSERT(32 == sizeof(TimeZoneRecord));
+BSLMF_ASSERT(16 == sizeof(DescriptorRecord));
+BSLMF_ASSERT(8  == sizeof(TimeT64));
+BSLMF_ASSERT(4  == sizeof(Uint32));
+
+const char   k_MAGIC[8]        = { 'B', 'A', 'L', 'T', 'Z', 'O', 'I', 'M' };
+const Uint32 k_BYTE_ORDER_MARK = 0x01020304;
+
+                               // ============
+                               // class Layout
+                               // ============
+
+class Layout {
+    // This class computes the offsets of the sections of an image from the
+    // number of records in each section.
+
+    // DATA
+    Uint64 d_descriptorsOffset;
+    Uint64 d_transitionTimesOffset;
+    Uint64 d_transitionDescriptorsOffset;
+    Uint64 d_stringsOffset;
+    Uint64 d_length;
+
+  public:
+    // CREATORS
+    Layout(Uint64 numTimeZones,
+           Uint64 numDescriptors,
+           Uint64 numTransitions,
+           Uint64 stringsLength)
+        // Create the layout of an image having the specified 'numTimeZones',
+        // 'numDescriptors', and 'numTransitions', and a strings section of the
+        // specified 'stringsLength'.
+    : d_descriptorsOffset(sizeof(Header)
+                        + numTimeZones * sizeof(TimeZoneRecord))
+    , d_transitionTimesOffset(d_descriptorsOffset
+                            + numDescriptors * sizeof(DescriptorRecord))
+    , d_transitionDescriptorsOffset(d_transitionTimesOffset
+                                  + numTransitions * sizeof(TimeT64))
+    , d_stringsOffset(d_transitionDescriptorsOffset
+                    + numTransitions * sizeof(Uint32))
+    , d_length((d_stringsOffset + stringsLength + 7) & ~Uint64(7))
+    {
+    }
+
+    // ACCESSORS
+    Uint64 descriptorsOffset() const
+        // Return the offset of the descriptor records.
+    {
+        return d_descriptorsOffset;
+    }
+
+    Uint64 length() const
+        // Return the length of the image, padded to a multiple of 8 bytes.
+    {
+        return d_length;
+    }
+
+    Uint64 stringsOffset() const
+        // Return the offset of the strings section.
+    {
+        return d_stringsOffset;
+    }
+
+    Uint64 timeZonesOffset() const
+        // Return the offset of the time-zone records.
+    {
+        return sizeof(Header);
+    }
+
+    Uint64 transitionDescriptorsOffset() const
+        // Return the offset of the descriptor indices of the transitions.
+    {
+        return d_transitionDescriptorsOffset;
+    }
+
+    Uint64 transitionTimesOffset() const
+        // Return the offset of the times of the transitions.
+    {
+        return d_transitionTimesOffset;
+    }
+};
+
+                             // =================
+                             // class StringTable
+                             // =================
+
+class StringTable {
+    // This class accumulates the strings section of an image, storing each
+    // distinct string once.
+
+    // DATA
+    bsl::string                   d_strings;  // null-terminated strings
+    bsl::map<bsl::string, Uint32> d_offsets;  // offset of each string
+
+  public:
+    // CREATORS
+    StringTable()
+        // Create an empty string table.
+    {
+    }
+
+    // MANIPULATORS
+    Uint32 add(const bsl::string& value)
+        // Return the offset of the specified 'value' in the strings section,
+        // appending 'value' and a null character to the section if it is not
+        // already present.
+    {
+        bsl::map<bsl::string, Uint32>::const_iterator it =
+                                                       d_offsets.find(value);
+        if (d_offsets.end() != it) {
+            return it->second;                                        // RETURN
+        }
+
+        const Uint32 offset = static_cast<Uint32>(d_strings.size());
+        d_strings.append(value);
+        d_strings.push_back('\0');
+        d_offsets[value] = offset;
+        return offset;
+    }
+
+    // ACCESSORS
+    const bsl::string& strings() const
+        // Return a reference providing non-modifiable access to the strings
+        // section.
+    {
+        return d_strings;
+    }
+};
+
+bool hasNoNullCharacter(const bsl::string& value)
+    // Return 'true' if the specified 'value' contains no null character, and
+    // 'false' otherwise.
+{
+    return bsl::strlen(value.c_str()) == value.size();
+}
+
+bool isLessById(const Zoneinfo *lhs, const Zoneinfo *rhs)
+    // Return 'true' if the identifier of the specified 'lhs' is less than that
+    // of the specified 'rhs', as determined by 'bsl::strcmp', and 'false'
+    // otherwise.
+{
+    return bsl::strcmp(lhs->identifier().c_str(),
+                       rhs->identifier().c_str()) < 0;
+}
+
+void appendTransitionsKey(bsl::string *result, const Zoneinfo& timeZone)
+    // Append, to the specified 'result', a string that identifies the
+    // transitions of the specified 'timeZone', so that two time zones have
+    // the same string if and only if they have the same transitions.
+{
+    for (Zoneinfo::TransitionConstIterator it = timeZone.beginTransitions();
+         it != timeZone.endTransitions();
+         ++it) {
+        const TimeT64              time       = it->utcTime();
+        const LocalTimeDescriptor& descriptor = it->descriptor();
+        const int                  offset     =
+                                             descriptor.utcOffsetInSeconds();
+
+        result->append(reinterpret_cast<const char *>(&time), sizeof time);
+        result->append(reinterpret_cast<const char *>(&offset),
+                       sizeof offset);
+        result->push_back(descriptor.dstInEffectFlag() ? '\1' : '\0');
+        result->append(descriptor.description());
+        result->push_back('\0');
+    }
+}
+
+}  // close unnamed namespace
+
+                            // -------------------
+                            // class ZoneinfoImage
+                            // -------------------
+
+// CLASS METHODS
+int ZoneinfoImage::writeImage(bsl::ostream&          stream,
+                              const Zoneinfo *const *timeZones,
+                              int                    numTimeZones)
+{
+    BSLS_ASSERT(0 <= numTimeZones);
+    BSLS_ASSERT(timeZones || 0 == numTimeZones);
+
+    enum { k_SUCCESS = 0, k_INVALID_TIME_ZONE = 1, k_TOO_LARGE = 2,
+           k_WRITE_FAILED = 3 };
+
+    for (int i = 0; i < numTimeZones; ++i) {
+        BSLS_ASSERT(timeZones[i]);
+    }
+
+    bsl::vector<const Zoneinfo *> sorted(timeZones, timeZones + numTimeZones);
+    bsl::sort(sorted.begin(), sorted.end(), &isLessById);
+
+    for (bsl::size_t i = 0; i < sorted.size(); ++i) {
+        const Zoneinfo& timeZone = *sorted[i];
+
+        if (0 == timeZone.numTransitions()
+         || timeZone.identifier().empty()
+         || !hasNoNullCharacter(timeZone.identifier())
+         || !hasNoNullCharacter(timeZone.posixExtendedRangeDescription())
+         || (0 < i && !isLessById(sorted[i - 1], sorted[i]))) {
+            return k_INVALID_TIME_ZONE;                               // RETURN
+        }
+    }
+
+    bsl::vector<TimeZoneRecord>   timeZoneRecords;
+    bsl::vector<DescriptorRecord> descriptorRecords;
+    bsl::vector<TimeT64>          transitionTimes;
+    bsl::vector<Uint32>           transitionDescriptors;
+    StringTable                   strings;
+
+    bsl::map<bsl::string, bsl::size_t> sharedTransitions;
+        // index of the first time zone having each distinct sequence of
+        // transitions
+
+    timeZoneRecords.reserve(sorted.size());
+
+    for (bsl::size_t i = 0; i < sorted.size(); ++i) {
+        const Zoneinfo& timeZone = *sorted[i];
+
+        TimeZoneRecord record;
+        bsl::memset(&record, 0, sizeof record);
+
+        record.d_identifier = strings.add(timeZone.identifier());
+        record.d_posixExtendedRangeDescription =
+                         strings.add(timeZone.posixExtendedRangeDescription());
+
+        bsl::string key;
+        appendTransitionsKey(&key, timeZone);
+
+        bsl::map<bsl::string, bsl::size_t>::const_iterator shared =
+                                                   sharedTransitions.find(key);
+        if (sharedTransitions.end() != shared) {
+            const TimeZoneRecord& original = timeZoneRecords[shared->second];
+
+            record.d_firstDescriptor = original.d_firstDescriptor;
+            record.d_numDescriptors  = original.d_numDescriptors;
+            record.d_firstTransition = original.d_firstTransition;
+            record.d_numTransitions  = original.d_numTransitions;
+            timeZoneRecords.push_back(record);
+            continue;                                               // CONTINUE
+        }
+        sharedTransitions[key] = i;
+
+        const bsl::size_t firstDescriptor = descriptorRecords.size();
+
+        record.d_firstDescriptor = static_cast<Uint32>(firstDescriptor);
+        record.d_firstTransition = static_cast<Uint32>(transitionTimes.size());
+        record.d_numTransitions  =
+                                static_cast<Uint32>(timeZone.numTransitions());
+
+        for (Zoneinfo::TransitionConstIterator it =
+                                                   timeZone.beginTransitions();
+             it != timeZone.endTransitions();
+             ++it) {
+            const LocalTimeDescriptor& descriptor = it->descriptor();
+
+            if (!hasNoNullCharacter(descriptor.description())) {
+                return k_INVALID_TIME_ZONE;                           // RETURN
+            }
+
+            DescriptorRecord descriptorRecord;
+            bsl::memset(&descriptorRecord, 0, sizeof descriptorRecord);
+
+            descriptorRecord.d_utcOffsetInSeconds =
+                                               descriptor.utcOffsetInSeconds();
+            descriptorRecord.d_dstInEffectFlag    =
+                                             descriptor.dstInEffectFlag();
+            descriptorRecord.d_description        =
+                                         strings.add(descriptor.description());
+
+            // A time zone has few distinct descriptors, which are found by a
+            // linear search.
+
+            bsl::size_t index = firstDescriptor;
+            while (index < descriptorRecords.size()
+                && 0 != bsl::memcmp(&descriptorRecords[index],
+                                    &descriptorRecord,
+                                    sizeof descriptorRecord)) {
+                ++index;
+            }
+            if (descriptorRecords.size() == index) {
+                descriptorRecords.push_back(descriptorRecord);
+            }
+
+            transitionTimes.push_back(it->utcTime());
+            transitionDescriptors.push_back(
+                                 static_cast<Uint32>(index - firstDescriptor));
+        }
+
+        record.d_numDescriptors = static_cast<Uint32>(descriptorRecords.size()
+                                                      - firstDescriptor);
+        timeZoneRecords.push_back(record);
+    }
+
+    const Layout layout(timeZoneRecords.size(),
+                        descriptorRecords.size(),
+                        transitionTimes.size(),
+                        strings.strings().size());
+
+    if (layout.length() > 0xFFFFFFFFu) {
+        return k_TOO_LARGE;                                           // RETURN
+    }
+
+    bsl::vector<char> image(static_cast<bsl::size_t>(layout.length()), 0);
+
+    Header header;
+    bsl::memset(&header, 0, sizeof header);
+    bsl::memcpy(header.d_magic, k_MAGIC, sizeof k_MAGIC);
+    header.d_version        = k_VERSION;
+    header.d_byteOrderMark  = k_BYTE_ORDER_MARK;
+    header.d_numTimeZones   = static_cast<Uint32>(timeZoneRecords.size());
+    header.d_numDescriptors = static_cast<Uint32>(descriptorRecords.size());
+    header.d_numTransitions = static_cast<Uint32>(transitionTimes.size());
+    header.d_stringsLength  = static_cast<Uint32>(strings.strings().size());
+    header.d_imageLength    = layout.length();
+
+    char *base = image.data();
+
+    bsl::memcpy(base, &header, sizeof header);
+    if (!timeZoneRecords.empty()) {
+        bsl::memcpy(base + layout.timeZonesOffset(),
+                    timeZoneRecords.data(),
+                    timeZoneRecords.size() * sizeof(TimeZoneRecord));
+        bsl::memcpy(base + layout.descriptorsOffset(),
+                    descriptorRecords.data(),
+                    descriptorRecords.size() * sizeof(DescriptorRecord));
+        bsl::memcpy(base + layout.transitionTimesOffset(),
+                    transitionTimes.data(),
+                    transitionTimes.size() * sizeof(TimeT64));
+        bsl::memcpy(base + layout.transitionDescriptorsOffset(),
+                    transitionDescriptors.data(),
+                    transitionDescriptors.size() * sizeof(Uint32));
+        bsl::memcpy(base + layout.stringsOffset(),
+                    strings.strings().data(),
+                    strings.strings().size());
+    }
+
+    stream.write(base, static_cast<bsl::streamsize>(image.size()));
+
+    return stream ? k_SUCCESS : k_WRITE_FAILED;
+}
+
+// MANIPULATORS
+int ZoneinfoImage::initialize(const char *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    enum { k_SUCCESS = 0, k_MISALIGNED = 1, k_TOO_SHORT = 2,
+           k_UNSUPPORTED = 3, k_MALFORMED = 4 };
+
+    reset();
+
+    if (0 != reinterpret_cast<bsls::Types::UintPtr>(data) % k_ALIGNMENT) {
+        return k_MISALIGNED;                                          // RETURN
+    }
+    if (length < sizeof(Header)) {
+        return k_TOO_SHORT;                                           // RETURN
+    }
+
+    const Header& header = *reinterpret_cast<const Header *>(data);
+
+    if (0 != bsl::memcmp(header.d_magic, k_MAGIC, sizeof k_MAGIC)
+     || k_VERSION         != header.d_version
+     || k_BYTE_ORDER_MARK != header.d_byteOrderMark) {
+        return k_UNSUPPORTED;                                         // RETURN
+    }
+
+    const Uint32 numTimeZones   = header.d_numTimeZones;
+    const Uint32 numDescriptors = header.d_numDescriptors;
+    const Uint32 numTransitions = header.d_numTransitions;
+    const Uint32 stringsLength  = header.d_stringsLength;
+
+    const Layout layout(numTimeZones,
+                        numDescriptors,
+                        numTransitions,
+                        stringsLength);
+
+    if (layout.length() != header.d_imageLength) {
+        return k_MALFORMED;                                           // RETURN
+    }
+    if (length < layout.length()) {
+        return k_TOO_SHORT;                                           // RETURN
+    }
+
+    const TimeZoneRecord   *timeZones   =
+                                reinterpret_cast<const TimeZoneRecord *>(
+                                            data + layout.timeZonesOffset());
+    const DescriptorRecord *descriptors =
+                              reinterpret_cast<const DescriptorRecord *>(
+                                          data + layout.descriptorsOffset());
+    const TimeT64          *times       = reinterpret_cast<const TimeT64 *>(
+                                      data + layout.transitionTimesOffset());
+    const Uint32           *indices     = reinterpret_cast<const Uint32 *>(
+                                data + layout.transitionDescriptorsOffset());
+    const char             *strings     = data + layout.stringsOffset();
+
+    // Every string offset that is less than 'stringsLength' refers to a
+    // null-terminated string within the image if the section ends with a null
+    // character.
+
+    if (0 != stringsLength && '\0' != strings[stringsLength - 1]) {
+        return k_MALFORMED;                                           // RETURN
+    }
+
+    for (Uint32 i = 0; i < numDescriptors; ++i) {
+        const DescriptorRecord& descriptor = descriptors[i];
+
+        if (stringsLength <= descriptor.d_description
+         || 1 < descriptor.d_dstInEffectFlag
+         || !LocalTimeDescriptor::isValidUtcOffsetInSeconds(
+                                            descriptor.d_utcOffsetInSeconds)) {
+            return k_MALFORMED;                                       // RETURN
+        }
+    }
+
+    for (Uint32 i = 0; i < numTimeZones; ++i) {
+        const TimeZoneRecord& timeZone = timeZones[i];
+
+        if (stringsLength <= timeZone.d_identifier
+         || stringsLength <= timeZone.d_posixExtendedRangeDescription
+         || 0 == timeZone.d_numDescriptors
+         || 0 == timeZone.d_numTransitions
+         || numDescriptors - timeZone.d_numDescriptors
+                                              < timeZone.d_firstDescriptor
+         || numDescriptors < timeZone.d_numDescriptors
+         || numTransitions - timeZone.d_numTransitions
+                                              < timeZone.d_firstTransition
+         || numTransitions < timeZone.d_numTransitions) {
+            return k_MALFORMED;                                       // RETURN
+        }
+
+        if (0 < i && 0 <= bsl::strcmp(strings + timeZones[i - 1].d_identifier,
+                                      strings + timeZone.d_identifier)) {
+            return k_MALFORMED;                                       // RETURN
+        }
+
+        const Uint32 first = timeZone.d_firstTransition;
+        const Uint32 last  = first + timeZone.d_numTransitions;
+
+        for (Uint32 j = first; j < last; ++j) {
+            if (timeZone.d_numDescriptors <= indices[j]
+             || (first < j && times[j] <= times[j - 1])) {
+                return k_MALFORMED;                                   // RETURN
+            }
+        }
+    }
+
+    d_data_p                  = data;
+    d_length                  = static_cast<bsl::size_t>(layout.length());
+    d_numTimeZones            = static_cast<int>(numTimeZones);
+    d_timeZones_p             = timeZones;
+    d_descriptors_p           = descriptors;
+    d_transitionTimes_p       = times;
+    d_transitionDescriptors_p = indices;
+    d_strings_p               = strings;
+
+    return k_SUCCESS;
+}
+
+// ACCESSORS
+int ZoneinfoImage::findTimeZone(const char *timeZoneId) const
+{
+    BSLS_ASSERT(timeZoneId);
+
+    int low  = 0;
+    int high = d_numTimeZones;
+
+    while (low < high) {
+        const int middle = low + (high - low) / 2;
+        const char *id  = d_strings_p + d_timeZones_p[middle].d_identifier;
+        const int   cmp = bsl::strcmp(timeZoneId, id);
+
+        if (0 == cmp) {
+            return middle;                                            // RETURN
+        }
+        if (cmp < 0) {
+            high = middle;
+        }
+        else {
+            low = middle + 1;
+        }
+    }
+    return -1;
+}
+
+int ZoneinfoImage::findTransitionForUtcTime(
+                                 int                      timeZoneIndex,
+                                 bdlt::EpochUtil::TimeT64 utcTime) const
+{
+    BSLS_ASSERT(0 <= timeZoneIndex);
+    BSLS_ASSERT(timeZoneIndex < d_numTimeZones);
+
+    const TimeT64 *begin = transitionTimes(timeZoneIndex);
+    const TimeT64 *end   = begin + numTransitions(timeZoneIndex);
+    const TimeT64 *it    = bsl::upper_bound(begin, end, utcTime);
+
+    return begin == it ? 0 : static_cast<int>(it - begin) - 1;
+}
+
+void ZoneinfoImage::loadTimeZone(Zoneinfo *result, int timeZoneIndex) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= timeZoneIndex);
+    BSLS_ASSERT(timeZoneIndex < d_numTimeZones);
+
+    const Zoneinfo::allocator_type allocator = result->get_allocator();
+    const TimeZoneRecord&          record    = d_timeZones_p[timeZoneIndex];
+
+    bsl::vector<LocalTimeDescriptor> descriptors(allocator);
+    descriptors.reserve(record.d_numDescriptors);
+    for (Uint32 i = 0; i < record.d_numDescriptors; ++i) {
+        const DescriptorRecord& descriptor =
+                                d_descriptors_p[record.d_firstDescriptor + i];
+
+        descriptors.push_back(LocalTimeDescriptor(
+                                      descriptor.d_utcOffsetInSeconds,
+                                      0 != descriptor.d_dstInEffectFlag,
+                                      d_strings_p + descriptor.d_description,
+                                      allocator));
+    }
+
+    Zoneinfo timeZone(allocator);
+    timeZone.setIdentifier(d_strings_p + record.d_identifier);
+    timeZone.setPosixExtendedRangeDescription(
+                         d_strings_p + record.d_posixExtendedRangeDescription);
+
+    const TimeT64 *times   = d_transitionTimes_p + record.d_firstTransition;
+    const Uint32  *indices = d_transitionDescriptors_p
+                           + record.d_firstTransition;
+
+    for (Uint32 i = 0; i < record.d_numTransitions; ++i) {
+        timeZone.addTransition(times[i], descriptors[indices[i]]);
+    }
+
+    result->swap(timeZone);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
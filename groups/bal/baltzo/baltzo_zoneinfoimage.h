@@ -0,0 +1,564 @@
+// baltzo_zoneinfoimage.h                                             -*-C++-*-
+#ifndef INCLUDED_BALTZO_ZONEINFOIMAGE
+#define INCLUDED_BALTZO_ZONEINFOIMAGE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a memory-mappable image of a set of time zones.
+//
+//@CLASSES:
+//  baltzo::ZoneinfoImage: non-owning view of a preparsed time-zone image
+//
+//@SEE_ALSO: baltzo_imagefileloader, baltzo_zoneinfoimageutil, baltzo_zoneinfo
+//
+//@DESCRIPTION: This component provides a class, 'baltzo::ZoneinfoImage',
+// that is a non-owning view of an *image*: a single, contiguous, versioned
+// block of memory holding the preparsed properties of a set of time zones,
+// in fixed-width records that are used in place, without parsing or copying.
+// An image is written by the class method 'writeImage' from a sequence of
+// 'baltzo::Zoneinfo' objects, and is typically deployed as a file that every
+// process on a host maps into memory (see 'baltzo_imagefileloader'), so that
+// the processes share a single physical copy of the time-zone data, and that
+// no process reads, parses, or allocates memory for the data of a time zone
+// until (and unless) it needs a 'baltzo::Zoneinfo' object for that time zone.
+//
+// A 'baltzo::ZoneinfoImage' is bound to the memory of an image by
+// 'initialize', which verifies that the memory holds a well-formed image of
+// the version supported by this component, written on a platform having the
+// same byte order, so that no accessor of a successfully initialized view
+// accesses memory outside of the image.  The time zones of an image are
+// identified by an index, which can be found, by a binary search of the sorted
+// time-zone identifiers, using 'findTimeZone'.  The transitions of a time zone
+// are then available in place: 'transitionTimes' returns the address of the
+// ordered array of the UTC times of the transitions, and the local-time
+// properties in effect after a transition are returned by
+// 'utcOffsetInSeconds', 'dstInEffectFlag', and 'description'.  Alternatively,
+// 'loadTimeZone' loads a 'baltzo::Zoneinfo' having the same value as the one
+// from which the time zone was written.
+//
+///Image Format
+///------------
+// An image consists of the following sections, each beginning at an offset
+// that is a multiple of 8 bytes (so that an image at an address aligned to 8
+// bytes, such as the address of a memory-mapped file, can be accessed in
+// place):
+//..
+//  +----------------------------------+
+//  | header                           |  64 bytes: magic "BALTZOIM", version,
+//  |                                  |  byte-order mark, and section sizes
+//  +----------------------------------+
+//  | time-zone records                |  32 bytes each, sorted by identifier
+//  +----------------------------------+
+//  | local-time descriptor records    |  16 bytes each
+//  +----------------------------------+
+//  | transition times                 |  8 bytes each ('TimeT64')
+//  +----------------------------------+
+//  | transition descriptor indices    |  4 bytes each
+//  +----------------------------------+
+//  | strings                          |  null-terminated, deduplicated
+//  +----------------------------------+
+//..
+// Each time-zone record refers to a range of descriptor records and a range of
+// transitions, and each transition refers to a descriptor in the range of its
+// time zone.  Time zones having the same transitions, such as the aliases
+// "US/Eastern" and "America/New_York", share their descriptors and
+// transitions.  Integers are written in the byte order of the writing
+// platform.
+//
+///Thread Safety
+///-------------
+// 'baltzo::ZoneinfoImage' is *const* *thread-safe*, meaning that accessors may
+// be invoked concurrently from different threads, but it is not safe to
+// access or modify a 'baltzo::ZoneinfoImage' in one thread while another
+// thread modifies the same object.  Note that the memory of an image is never
+// modified by this component.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Writing and Reading an Image
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to make the time-zone information for New York
+// available to several processes without each of them parsing it.
+//
+// First, we create a 'baltzo::Zoneinfo' for New York having, after the initial
+// transition, the transitions of 2010:
+//..
+//  baltzo::LocalTimeDescriptor est(-5 * 60 * 60, false, "EST");
+//  baltzo::LocalTimeDescriptor edt(-4 * 60 * 60, true,  "EDT");
+//
+//  typedef bdlt::EpochUtil EpochUtil;
+//
+//  baltzo::Zoneinfo newYork;
+//  newYork.setIdentifier("America/New_York");
+//  newYork.addTransition(EpochUtil::convertToTimeT64(bdlt::Datetime(1, 1, 1)),
+//                        est);
+//  newYork.addTransition(
+//                 EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 3, 14, 7)),
+//                 edt);
+//  newYork.addTransition(
+//                 EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 11, 7, 6)),
+//                 est);
+//..
+// Then, we write an image holding that time zone to a string stream (in
+// practice, the image would be written to a file; see
+// 'baltzo_zoneinfoimageutil'):
+//..
+//  const baltzo::Zoneinfo *timeZones[] = { &newYork };
+//
+//  bsl::ostringstream stream;
+//  int rc = baltzo::ZoneinfoImage::writeImage(stream, timeZones, 1);
+//  assert(0 == rc);
+//..
+// Next, we copy the image to a buffer aligned to 8 bytes, as the memory of a
+// mapped file would be, and bind a view to it:
+//..
+//  const bsl::string imageData = stream.str();
+//
+//  bsl::vector<bsls::Types::Int64> buffer(imageData.size() / 8);
+//  bsl::memcpy(buffer.data(), imageData.data(), imageData.size());
+//
+//  baltzo::ZoneinfoImage image;
+//  rc = image.initialize(reinterpret_cast<const char *>(buffer.data()),
+//                        imageData.size());
+//  assert(0 == rc);
+//  assert(1 == image.numTimeZones());
+//..
+// Now, we find the time zone, and the transition in effect in July 2010, and
+// examine its properties in place:
+//..
+//  const int index = image.findTimeZone("America/New_York");
+//  assert(0 == index);
+//  assert(3 == image.numTransitions(index));
+//
+//  const int transition = image.findTransitionForUtcTime(
+//                 index,
+//                 EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 7, 1)));
+//  assert(1 == transition);
+//
+//  assert(-4 * 60 * 60 == image.utcOffsetInSeconds(index, transition));
+//  assert(true         == image.dstInEffectFlag(index, transition));
+//  assert(0 == bsl::strcmp("EDT", image.description(index, transition)));
+//..
+// Finally, we load a 'baltzo::Zoneinfo' from the image, and observe that it
+// has the value of the one that was written:
+//..
+//  baltzo::Zoneinfo loaded;
+//  image.loadTimeZone(&loaded, index);
+//  assert(newYork == loaded);
+//..
+
+#include <balscm_version.h>
+
+#include <bdlt_epochutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iosfwd.h>
+
+namespace BloombergLP {
+namespace baltzo {
+
+class Zoneinfo;
+
+                        // ===========================
+                        // struct ZoneinfoImage_Header
+                        // ===========================
+
+struct ZoneinfoImage_Header {
+    // This component-private 'struct' provides the layout of the header that
+    // begins an image.
+
+    // DATA
+    char                d_magic[8];         // "BALTZOIM" (not terminated)
+    unsigned int        d_version;          // version of the format
+    unsigned int        d_byteOrderMark;    // 0x01020304, in native order
+    unsigned int        d_numTimeZones;     // number of time-zone records
+    unsigned int        d_numDescriptors;   // number of descriptor records
+    unsigned int        d_numTransitions;   // number of transitions
+    unsigned int        d_stringsLength;    // length of the strings section
+    bsls::Types::Uint64 d_imageLength;      // length of the image
+    bsls::Types::Uint64 d_reserved[3];      // zero
+};
+
+                    // ===================================
+                    // struct ZoneinfoImage_TimeZoneRecord
+                    // ===================================
+
+struct ZoneinfoImage_TimeZoneRecord {
+    // This component-private 'struct' provides the layout of the record of a
+    // time zone in an image.
+
+    // DATA
+    unsigned int        d_identifier;       // offset of the identifier in
+                                            // the strings section
+
+    unsigned int        d_posixExtendedRangeDescription;
+                                            // offset of the POSIX TZ
+                                            // description in the strings
+                                            // section
+
+    unsigned int        d_firstDescriptor;  // index of the first descriptor
+    unsigned int        d_numDescriptors;   // number of descriptors
+    unsigned int        d_firstTransition;  // index of the first transition
+    unsigned int        d_numTransitions;   // number of transitions
+    unsigned int        d_reserved[2];      // zero
+};
+
+                   // =====================================
+                   // struct ZoneinfoImage_DescriptorRecord
+                   // =====================================
+
+struct ZoneinfoImage_DescriptorRecord {
+    // This component-private 'struct' provides the layout of the record of a
+    // local-time descriptor in an image.
+
+    // DATA
+    int                 d_utcOffsetInSeconds;  // UTC offset
+    unsigned int        d_dstInEffectFlag;     // 1 if DST is in effect, and
+                                               // 0 otherwise
+
+    unsigned int        d_description;         // offset of the description
+                                               // in the strings section
+
+    unsigned int        d_reserved;            // zero
+};
+
+                            // ===================
+                            // class ZoneinfoImage
+                            // ===================
+
+class ZoneinfoImage {
+    // This class provides a non-owning, read-only view of an image holding the
+    // preparsed properties of a set of time zones, which are accessed in place
+    // (see {Image Format}).  The image must remain valid, and unmodified, for
+    // as long as a view refers to it.
+    //
+    // This class:
+    //: o is *exception-neutral*
+    //: o is *const* *thread-safe*
+    // For terminology see 'bsldoc_glossary'.
+
+    // PRIVATE TYPES
+    typedef bdlt::EpochUtil::TimeT64       TimeT64;
+    typedef ZoneinfoImage_TimeZoneRecord   TimeZoneRecord;
+    typedef ZoneinfoImage_DescriptorRecord DescriptorRecord;
+
+    // DATA
+    const char             *d_data_p;           // image (held, not owned)
+    bsl::size_t             d_length;           // length of the image
+    int                     d_numTimeZones;     // number of time zones
+    const TimeZoneRecord   *d_timeZones_p;      // time-zone records
+    const DescriptorRecord *d_descriptors_p;    // descriptor records
+    const TimeT64          *d_transitionTimes_p;
+                                                // UTC times of transitions
+
+    const unsigned int     *d_transitionDescriptors_p;
+                                                // descriptor of each
+                                                // transition, relative to
+                                                // its time zone's first
+
+    const char             *d_strings_p;        // strings section
+
+    // PRIVATE ACCESSORS
+    const DescriptorRecord& descriptorRecord(int timeZoneIndex,
+                                             int transitionIndex) const;
+        // Return a reference providing non-modifiable access to the record
+        // of the local-time descriptor in effect after the transition having
+        // the specified 'transitionIndex' in the time zone having the
+        // specified 'timeZoneIndex'.  The behavior is undefined unless
+        // '0 <= timeZoneIndex < numTimeZones()' and
+        // '0 <= transitionIndex < numTransitions(timeZoneIndex)'.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_VERSION   = 1,  // version of the image format written and read by
+                          // this component
+
+        k_ALIGNMENT = 8   // alignment required of the address of an image
+    };
+
+    // CLASS METHODS
+    static int writeImage(bsl::ostream&          stream,
+                          const Zoneinfo *const *timeZones,
+                          int                    numTimeZones);
+        // Write, to the specified 'stream', an image of the time zones
+        // described by the specified 'numTimeZones' elements of the specified
+        // 'timeZones' array.  Return 0 on success, and a non-zero value (with
+        // no effect on 'stream') if an element of 'timeZones' has no
+        // transitions, or has an identifier that is empty or contains a null
+        // character, if two elements have the same identifier, or if the image
+        // would exceed 4 GB.  If the write to 'stream' fails, return a
+        // non-zero value, and the state of 'stream' is unspecified.  The
+        // behavior is undefined unless '0 <= numTimeZones' and 'timeZones'
+        // refers to an array of at least 'numTimeZones' non-null elements.
+        // Note that the time zones are written in order of their identifiers,
+        // regardless of their order in 'timeZones'.
+
+    // CREATORS
+    ZoneinfoImage();
+        // Create a view of an empty image having no time zones.
+
+    // ZoneinfoImage(const ZoneinfoImage& original) = default;
+        // Create a view of the image viewed by the specified 'original'.
+
+    // ~ZoneinfoImage() = default;
+        // Destroy this object.  Note that the image is not affected.
+
+    // MANIPULATORS
+    // ZoneinfoImage& operator=(const ZoneinfoImage& rhs) = default;
+        // Make this object a view of the image viewed by the specified 'rhs',
+        // and return a reference providing modifiable access to this object.
+
+    int initialize(const char *data, bsl::size_t length);
+        // Make this object a view of the image at the specified 'data' address
+        // having at least the specified 'length' bytes.  Return 0 on success,
+        // and a non-zero value (leaving this object a view of an empty image)
+        // if 'data' is not aligned to 'k_ALIGNMENT' bytes, or if the first
+        // 'length' bytes at 'data' do not begin with a well-formed image of
+        // version 'k_VERSION' written on a platform having the byte order of
+        // this one.  The behavior is undefined unless 'data' refers to at
+        // least 'length' readable bytes, which remain valid and unmodified
+        // while this object refers to them.  Note that this method reads the
+        // whole image, in time proportional to the number of transitions.
+
+    void reset();
+        // Make this object a view of an empty image having no time zones.
+
+    // ACCESSORS
+    const char *data() const;
+        // Return the address of the image viewed by this object, or 0 if this
+        // object is a view of an empty image.
+
+    bool dstInEffectFlag(int timeZoneIndex, int transitionIndex) const;
+        // Return 'true' if daylight-saving time is in effect after the
+        // transition having the specified 'transitionIndex' in the time zone
+        // having the specified 'timeZoneIndex', and 'false' otherwise.  The
+        // behavior is undefined unless
+        // '0 <= timeZoneIndex < numTimeZones()' and
+        // '0 <= transitionIndex < numTransitions(timeZoneIndex)'.
+
+    const char *description(int timeZoneIndex, int transitionIndex) const;
+        // Return the address of the null-terminated description (e.g., "EST")
+        // of the local time in effect after the transition having the
+        // specified 'transitionIndex' in the time zone having the specified
+        // 'timeZoneIndex'.  The behavior is undefined unless
+        // '0 <= timeZoneIndex < numTimeZones()' and
+        // '0 <= transitionIndex < numTransitions(timeZoneIndex)'.
+
+    int findTimeZone(const char *timeZoneId) const;
+        // Return the index of the time zone having the specified
+        // 'timeZoneId', or a negative value if the image has no such time
+        // zone.
+
+    int findTransitionForUtcTime(int                      timeZoneIndex,
+                                 bdlt::EpochUtil::TimeT64 utcTime) const;
+        // Return the index of the last transition at or before the specified
+        // 'utcTime' in the time zone having the specified 'timeZoneIndex', or
+        // 0 if 'utcTime' is before the first transition of that time zone.
+        // The behavior is undefined unless
+        // '0 <= timeZoneIndex < numTimeZones()'.
+
+    bsl::size_t length() const;
+        // Return the length of the image viewed by this object, or 0 if this
+        // object is a view of an empty image.
+
+    void loadTimeZone(Zoneinfo *result, int timeZoneIndex) const;
+        // Load, into the specified 'result', the time-zone information of the
+        // time zone having the specified 'timeZoneIndex'.  The behavior is
+        // undefined unless '0 <= timeZoneIndex < numTimeZones()'.  Note that
+        // 'result' has the same value as the 'Zoneinfo' from which the time
+        // zone was written.
+
+    int numTimeZones() const;
+        // Return the number of time zones in the image viewed by this object.
+
+    int numTransitions(int timeZoneIndex) const;
+        // Return the number of transitions of the time zone having the
+        // specified 'timeZoneIndex'.  The behavior is undefined unless
+        // '0 <= timeZoneIndex < numTimeZones()'.
+
+    const char *posixExtendedRangeDescription(int timeZoneIndex) const;
+        // Return the address of the null-terminated POSIX TZ description of
+        // the local-time transitions, after the last transition, of the time
+        // zone having the specified 'timeZoneIndex'.  The behavior is
+        // undefined unless '0 <= timeZoneIndex < numTimeZones()'.
+
+    const char *timeZoneId(int timeZoneIndex) const;
+        // Return the address of the null-terminated identifier of the time
+        // zone having the specified 'timeZoneIndex'.  The behavior is
+        // undefined unless '0 <= timeZoneIndex < numTimeZones()'.  Note that
+        // the identifiers of the time zones of an image are in increasing
+        // order, as determined by 'bsl::strcmp'.
+
+    const bdlt::EpochUtil::TimeT64 *transitionTimes(int timeZoneIndex) const;
+        // Return the address of the array, having 'numTransitions' elements
+        // in increasing order, of the UTC times of the transitions of the
+        // time zone having the specified 'timeZoneIndex'.  The behavior is
+        // undefined unless '0 <= timeZoneIndex < numTimeZones()'.
+
+    int utcOffsetInSeconds(int timeZoneIndex, int transitionIndex) const;
+        // Return the offset from UTC, in seconds, of the local time in effect
+        // after the transition having the specified 'transitionIndex' in the
+        // time zone having the specified 'timeZoneIndex'.  The behavior is
+        // undefined unless '0 <= timeZoneIndex < numTimeZones()' and
+        // '0 <= transitionIndex < numTransitions(timeZoneIndex)'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class ZoneinfoImage
+                            // -------------------
+
+// PRIVATE ACCESSORS
+inline
+const ZoneinfoImage_DescriptorRecord& ZoneinfoImage::descriptorRecord(
+                                                     int timeZoneIndex,
+                                                     int transitionIndex) const
+{
+    BSLS_ASSERT(0 <= timeZoneIndex);
+    BSLS_ASSERT(timeZoneIndex < d_numTimeZones);
+    BSLS_ASSERT(0 <= transitionIndex);
+    BSLS_ASSERT(transitionIndex < numTransitions(timeZoneIndex));
+
+    const TimeZoneRecord& timeZone = d_timeZones_p[timeZoneIndex];
+
+    return d_descriptors_p[
+                 timeZone.d_firstDescriptor
+               + d_transitionDescriptors_p[timeZone.d_firstTransition
+                                         + transitionIndex]];
+}
+
+// CREATORS
+inline
+ZoneinfoImage::ZoneinfoImage()
+: d_data_p(0)
+, d_length(0)
+, d_numTimeZones(0)
+, d_timeZones_p(0)
+, d_descriptors_p(0)
+, d_transitionTimes_p(0)
+, d_transitionDescriptors_p(0)
+, d_strings_p(0)
+{
+}
+
+// MANIPULATORS
+inline
+void ZoneinfoImage::reset()
+{
+    *this = ZoneinfoImage();
+}
+
+// ACCESSORS
+inline
+const char *ZoneinfoImage::data() const
+{
+    return d_data_p;
+}
+
+inline
+bool ZoneinfoImage::dstInEffectFlag(int timeZoneIndex,
+                                    int transitionIndex) const
+{
+    return 0 != descriptorRecord(timeZoneIndex,
+                                 transitionIndex).d_dstInEffectFlag;
+}
+
+inline
+const char *ZoneinfoImage::description(int timeZoneIndex,
+                                       int transitionIndex) const
+{
+    return d_strings_p
+         + descriptorRecord(timeZoneIndex, transitionIndex).d_description;
+}
+
+inline
+bsl::size_t ZoneinfoImage::length() const
+{
+    return d_length;
+}
+
+inline
+int ZoneinfoImage::numTimeZones() const
+{
+    return d_numTimeZones;
+}
+
+inline
+int ZoneinfoImage::numTransitions(int timeZoneIndex) const
+{
+    BSLS_ASSERT(0 <= timeZoneIndex);
+    BSLS_ASSERT(timeZoneIndex < d_numTimeZones);
+
+    return static_cast<int>(d_timeZones_p[timeZoneIndex].d_numTransitions);
+}
+
+inline
+const char *ZoneinfoImage::posixExtendedRangeDescription(
+                                                    int timeZoneIndex) const
+{
+    BSLS_ASSERT(0 <= timeZoneIndex);
+    BSLS_ASSERT(timeZoneIndex < d_numTimeZones);
+
+    return d_strings_p
+         + d_timeZones_p[timeZoneIndex].d_posixExtendedRangeDescription;
+}
+
+inline
+const char *ZoneinfoImage::timeZoneId(int timeZoneIndex) const
+{
+    BSLS_ASSERT(0 <= timeZoneIndex);
+    BSLS_ASSERT(timeZoneIndex < d_numTimeZones);
+
+    return d_strings_p + d_timeZones_p[timeZoneIndex].d_identifier;
+}
+
+inline
+const bdlt::EpochUtil::TimeT64 *ZoneinfoImage::transitionTimes(
+                                                    int timeZoneIndex) const
+{
+    BSLS_ASSERT(0 <= timeZoneIndex);
+    BSLS_ASSERT(timeZoneIndex < d_numTimeZones);
+
+    return d_transitionTimes_p
+         + d_timeZones_p[timeZoneIndex].d_firstTransition;
+}
+
+inline
+int ZoneinfoImage::utcOffsetInSeconds(int timeZoneIndex,
+                                      int transitionIndex) const
+{
+    return descriptorRecord(timeZoneIndex,
+                            transitionIndex).d_utcOffsetInSeconds;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
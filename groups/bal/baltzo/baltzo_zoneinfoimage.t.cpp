@@ -0,0 +1,1056 @@
+// baltzo_zoneinfoimage.t.cpp                                         -*-C++-*-
+#include <baltzo_zoneinfoimage.h>
+
+#include <baltzo_localtimedescriptor.h>
+#include <baltzo_zoneinfo.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'baltzo::ZoneinfoImage' is a view of an image written by its class method
+// 'writeImage'.  Images of pseudo-random time zones, including aliases that
+// share their transitions, are written and read back, and every accessor is
+// compared with the 'baltzo::Zoneinfo' from which the image was written.
+// Since an image is typically read from a file, 'initialize' must reject every
+// image that is not well-formed, which is tested by corrupting each field of a
+// valid image, by truncating it, and by flipping pseudo-random bytes, checking
+// that the accessors of a view that accepts a corrupted image never access
+// memory outside of it.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the default allocator, except by
+//:   'writeImage', which uses it for temporary storage.
+//: o Precondition violations are detected in appropriate build modes.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int writeImage(ostream&, const Zoneinfo *const *, int);
+// [ 3] int writeImage(ostream&, const Zoneinfo *const *, int);
+//
+// CREATORS
+// [ 2] ZoneinfoImage();
+//
+// MANIPULATORS
+// [ 2] int initialize(const char *, bsl::size_t);
+// [ 4] int initialize(const char *, bsl::size_t);
+// [ 2] void reset();
+//
+// ACCESSORS
+// [ 2] const char *data() const;
+// [ 2] bool dstInEffectFlag(int, int) const;
+// [ 2] const char *description(int, int) const;
+// [ 2] int findTimeZone(const char *) const;
+// [ 2] int findTransitionForUtcTime(int, TimeT64) const;
+// [ 2] bsl::size_t length() const;
+// [ 2] void loadTimeZone(Zoneinfo *, int) const;
+// [ 2] int numTimeZones() const;
+// [ 2] int numTransitions(int) const;
+// [ 2] const char *posixExtendedRangeDescription(int) const;
+// [ 2] const char *timeZoneId(int) const;
+// [ 2] const TimeT64 *transitionTimes(int) const;
+// [ 2] int utcOffsetInSeconds(int, int) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baltzo::ZoneinfoImage       Obj;
+typedef baltzo::Zoneinfo            Zone;
+typedef baltzo::LocalTimeDescriptor Desc;
+typedef bdlt::EpochUtil::TimeT64    TimeT64;
+typedef bsls::Types::Int64          Int64;
+typedef bsls::Types::Uint64         Uint64;
+
+// ============================================================================
+//                              TEST FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+TimeT64 toTimeT(const bdlt::Datetime& value)
+    // Return the interval in seconds from UNIX epoch time of the specified
+    // 'value'.
+{
+    return bdlt::EpochUtil::convertToTimeT64(value);
+}
+
+Uint64 nextRandom(Uint64 *state)
+    // Return the next pseudo-random value of the sequence having the
+    // specified 'state', and update 'state'.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state >> 16;
+}
+
+void makeZone(Zone *result, Uint64 seed, const char *id, int numTransitions)
+    // Load into the specified 'result' a well-formed time zone having the
+    // specified 'id' and, in addition to its initial transition, the specified
+    // 'numTransitions' transitions, generated from the specified 'seed', whose
+    // local times have one of a few descriptors.
+{
+    static const char *const DESCRIPTIONS[] = { "AST", "ADT", "BST", "XYZ" };
+
+    Uint64 state = seed;
+
+    result->setIdentifier(id);
+    result->setPosixExtendedRangeDescription(0 == seed % 3 ? "" : "AST4ADT");
+    result->addTransition(u::toTimeT(bdlt::Datetime(1, 1, 1)),
+                          Desc(-17762, false, "LMT"));
+
+    TimeT64 time = u::toTimeT(bdlt::Datetime(1900, 1, 1));
+    for (int i = 0; i < numTransitions; ++i) {
+        const Uint64 bits = nextRandom(&state);
+
+        time += 1 + static_cast<TimeT64>(bits % (200 * 24 * 60 * 60));
+        result->addTransition(time,
+                              Desc(static_cast<int>(bits % 5) * 3600 - 14400,
+                                   0 == bits % 2,
+                                   DESCRIPTIONS[bits % 4]));
+    }
+}
+
+int writeImage(bsl::vector<Int64> *result,
+               const Zone *const  *timeZones,
+               int                 numTimeZones)
+    // Write, into the specified 'result', aligned to 8 bytes, the image of the
+    // specified 'numTimeZones' elements of the specified 'timeZones', and
+    // return the length of the image, or a negative value if 'writeImage'
+    // fails.
+{
+    bsl::ostringstream stream;
+    if (0 != Obj::writeImage(stream, timeZones, numTimeZones)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::string image = stream.str();
+
+    result->assign((image.size() + 7) / 8, 0);
+    bsl::memcpy(result->data(), image.data(), image.size());
+    return static_cast<int>(image.size());
+}
+
+const char *data(const bsl::vector<Int64>& buffer)
+    // Return the address of the first byte of the specified 'buffer'.
+{
+    return reinterpret_cast<const char *>(buffer.data());
+}
+
+void touchEverything(int *checksum, const Obj& image)
+    // Call every accessor of the specified 'image' for each of its time zones
+    // and transitions, and accumulate into the specified 'checksum' a value
+    // that depends on every result, so that the accesses are not optimized
+    // away.
+{
+    for (int i = 0; i < image.numTimeZones(); ++i) {
+        *checksum += static_cast<int>(bsl::strlen(image.timeZoneId(i)));
+        *checksum += static_cast<int>(bsl::strlen(
+                                     image.posixExtendedRangeDescription(i)));
+        ASSERTV(i, i == image.findTimeZone(image.timeZoneId(i)));
+
+        const TimeT64 *times = image.transitionTimes(i);
+        for (int j = 0; j < image.numTransitions(i); ++j) {
+            *checksum += static_cast<int>(times[j]);
+            *checksum += image.utcOffsetInSeconds(i, j);
+            *checksum += image.dstInEffectFlag(i, j);
+            *checksum += static_cast<int>(
+                                   bsl::strlen(image.description(i, j)));
+        }
+        *checksum += image.findTransitionForUtcTime(i, 0);
+    }
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::DefaultAllocatorGuard usageGuard(&ta);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Writing and Reading an Image
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to make the time-zone information for New York
+// available to several processes without each of them parsing it.
+//
+// First, we create a 'baltzo::Zoneinfo' for New York having, after the initial
+// transition, the transitions of 2010:
+//..
+    baltzo::LocalTimeDescriptor est(-5 * 60 * 60, false, "EST");
+    baltzo::LocalTimeDescriptor edt(-4 * 60 * 60, true,  "EDT");
+
+    typedef bdlt::EpochUtil EpochUtil;
+
+    baltzo::Zoneinfo newYork;
+    newYork.setIdentifier("America/New_York");
+    newYork.addTransition(EpochUtil::convertToTimeT64(bdlt::Datetime(1, 1, 1)),
+                          est);
+    newYork.addTransition(
+                   EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 3, 14, 7)),
+                   edt);
+    newYork.addTransition(
+                   EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 11, 7, 6)),
+                   est);
+//..
+// Then, we write an image holding that time zone to a string stream (in
+// practice, the image would be written to a file; see
+// 'baltzo_zoneinfoimageutil'):
+//..
+    const baltzo::Zoneinfo *timeZones[] = { &newYork };
+
+    bsl::ostringstream stream;
+    int rc = baltzo::ZoneinfoImage::writeImage(stream, timeZones, 1);
+    ASSERT(0 == rc);
+//..
+// Next, we copy the image to a buffer aligned to 8 bytes, as the memory of a
+// mapped file would be, and bind a view to it:
+//..
+    const bsl::string imageData = stream.str();
+
+    bsl::vector<bsls::Types::Int64> buffer(imageData.size() / 8);
+    bsl::memcpy(buffer.data(), imageData.data(), imageData.size());
+
+    baltzo::ZoneinfoImage image;
+    rc = image.initialize(reinterpret_cast<const char *>(buffer.data()),
+                          imageData.size());
+    ASSERT(0 == rc);
+    ASSERT(1 == image.numTimeZones());
+//..
+// Now, we find the time zone, and the transition in effect in July 2010, and
+// examine its properties in place:
+//..
+    const int index = image.findTimeZone("America/New_York");
+    ASSERT(0 == index);
+    ASSERT(3 == image.numTransitions(index));
+
+    const int transition = image.findTransitionForUtcTime(
+                   index,
+                   EpochUtil::convertToTimeT64(bdlt::Datetime(2010, 7, 1)));
+    ASSERT(1 == transition);
+
+    ASSERT(-4 * 60 * 60 == image.utcOffsetInSeconds(index, transition));
+    ASSERT(true         == image.dstInEffectFlag(index, transition));
+    ASSERT(0 == bsl::strcmp("EDT", image.description(index, transition)));
+//..
+// Finally, we load a 'baltzo::Zoneinfo' from the image, and observe that it
+// has the value of the one that was written:
+//..
+    baltzo::Zoneinfo loaded;
+    image.loadTimeZone(&loaded, index);
+    ASSERT(newYork == loaded);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'initialize' WITH MALFORMED IMAGES
+        //
+        // Concerns:
+        //: 1 'initialize' fails for a misaligned address, and for a length
+        //:   that is less than the length of the image.
+        //:
+        //: 2 'initialize' fails for an image having another magic number,
+        //:   version, or byte order.
+        //:
+        //: 3 'initialize' fails for an image having a field that refers
+        //:   outside of its section, an invalid UTC offset or DST flag, time
+        //:   zones that are not sorted, or transitions that are not
+        //:   increasing.
+        //:
+        //: 4 A view that fails to initialize is a view of an empty image.
+        //:
+        //: 5 A view that accepts an image having arbitrarily corrupted bytes
+        //:   never accesses memory outside of the image.
+        //
+        // Plan:
+        //: 1 Initialize a view with a valid image at an offset of 4 bytes,
+        //:   and with every length less than that of the image.  (C-1, 4)
+        //:
+        //: 2 Corrupt the header fields of a valid image.  (C-2, 4)
+        //:
+        //: 3 Corrupt, one at a time, the fields of the records of a valid
+        //:   image, and its transitions.  (C-3, 4)
+        //:
+        //: 4 Replace pseudo-random bytes of a valid image with pseudo-random
+        //:   values, and call every accessor of the views that accept the
+        //:   result.  (C-5)
+        //
+        // Testing:
+        //   int initialize(const char *, bsl::size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'initialize' WITH MALFORMED IMAGES"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        typedef baltzo::ZoneinfoImage_Header           Header;
+        typedef baltzo::ZoneinfoImage_TimeZoneRecord   TimeZoneRecord;
+        typedef baltzo::ZoneinfoImage_DescriptorRecord DescriptorRecord;
+
+        Zone a(&ta), b(&ta), c(&ta);
+        u::makeZone(&a, 1, "A/One",   5);
+        u::makeZone(&b, 2, "B/Two",   7);
+        u::makeZone(&c, 3, "C/Three", 3);
+
+        const Zone *ZONES[] = { &a, &b, &c };
+
+        bsl::vector<Int64> VALID(&ta);
+        const int LENGTH = u::writeImage(&VALID, ZONES, 3);
+        ASSERT(0 < LENGTH);
+
+        {
+            Obj mX;
+            ASSERT(0 == mX.initialize(u::data(VALID), LENGTH));
+            ASSERT(3 == mX.numTimeZones());
+        }
+
+        if (veryVerbose) cout << "\tAlignment and length." << endl;
+        {
+            bsl::vector<Int64> buffer(VALID.size() + 1, 0, &ta);
+            char *misaligned = reinterpret_cast<char *>(buffer.data()) + 4;
+            bsl::memcpy(misaligned, u::data(VALID), LENGTH);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 != mX.initialize(misaligned, LENGTH));
+            ASSERT(0 == X.numTimeZones());
+            ASSERT(0 == X.data());
+
+            for (int length = 0; length < LENGTH; ++length) {
+                ASSERTV(length, 0 != mX.initialize(u::data(VALID), length));
+                ASSERTV(length, 0 == X.numTimeZones());
+            }
+        }
+
+        if (veryVerbose) cout << "\tHeader." << endl;
+        {
+            for (int field = 0; field < 9; ++field) {
+                bsl::vector<Int64> image(VALID, &ta);
+                Header& header = *reinterpret_cast<Header *>(image.data());
+
+                switch (field) {
+                  case 0: header.d_magic[7]       = 'X';            break;
+                  case 1: header.d_version        = 2;              break;
+                  case 2: header.d_byteOrderMark  = 0x04030201;     break;
+                  case 3: header.d_numTimeZones  += 1;              break;
+                  case 4: header.d_numDescriptors -= 1;             break;
+                  case 5: header.d_numTransitions += 2;             break;
+                  case 6: header.d_stringsLength  += 8;             break;
+                  case 7: header.d_imageLength    += 8;             break;
+                  case 8: header.d_numTimeZones   = 0xFFFFFFFF;     break;
+                }
+
+                Obj mX;  const Obj& X = mX;
+                ASSERTV(field,
+                        0 != mX.initialize(u::data(image),
+                                           image.size() * 8));
+                ASSERTV(field, 0 == X.numTimeZones());
+            }
+        }
+
+        if (veryVerbose) cout << "\tRecords." << endl;
+        {
+            const Header& header = *reinterpret_cast<const Header *>(
+                                                              VALID.data());
+
+            const bsl::size_t descriptorsOffset =
+                       sizeof(Header) + 3 * sizeof(TimeZoneRecord);
+            const bsl::size_t timesOffset =
+                       descriptorsOffset
+                     + header.d_numDescriptors * sizeof(DescriptorRecord);
+            const bsl::size_t indicesOffset =
+                       timesOffset + header.d_numTransitions * sizeof(Int64);
+            const bsl::size_t stringsOffset =
+                       indicesOffset + header.d_numTransitions * 4;
+
+            for (int field = 0; field < 17; ++field) {
+                bsl::vector<Int64> image(VALID, &ta);
+                char *base = reinterpret_cast<char *>(image.data());
+
+                TimeZoneRecord *zones = reinterpret_cast<TimeZoneRecord *>(
+                                                        base + sizeof(Header));
+                DescriptorRecord *descriptors =
+                                    reinterpret_cast<DescriptorRecord *>(
+                                                     base + descriptorsOffset);
+                Int64 *times = reinterpret_cast<Int64 *>(base + timesOffset);
+                unsigned int *indices = reinterpret_cast<unsigned int *>(
+                                                         base + indicesOffset);
+                char *strings = base + stringsOffset;
+
+                switch (field) {
+                  case 0: zones[1].d_identifier = header.d_stringsLength;
+                    break;
+                  case 1: zones[1].d_posixExtendedRangeDescription =
+                                                       header.d_stringsLength;
+                    break;
+                  case 2: zones[2].d_firstDescriptor =
+                                                  header.d_numDescriptors;
+                    break;
+                  case 3: zones[2].d_numDescriptors += 1;
+                    break;
+                  case 4: zones[2].d_numDescriptors = 0;
+                    break;
+                  case 5: zones[2].d_firstTransition = 0xFFFFFFFF;
+                    break;
+                  case 6: zones[2].d_numTransitions += 1;
+                    break;
+                  case 7: zones[2].d_numTransitions = 0;
+                    break;
+                  case 8: zones[0].d_identifier = zones[2].d_identifier;
+                    break;
+                  case 9: zones[1].d_identifier = zones[1 - 1].d_identifier;
+                    break;
+                  case 10: descriptors[0].d_description =
+                                                       header.d_stringsLength;
+                    break;
+                  case 11: descriptors[0].d_dstInEffectFlag = 2;
+                    break;
+                  case 12: descriptors[0].d_utcOffsetInSeconds = 86400;
+                    break;
+                  case 13: indices[1] = zones[0].d_numDescriptors;
+                    break;
+                  case 14: times[2] = times[1];
+                    break;
+                  case 15: times[1] = times[0] - 1;
+                    break;
+                  case 16: strings[header.d_stringsLength - 1] = 'X';
+                    break;
+                }
+
+                Obj mX;  const Obj& X = mX;
+                ASSERTV(field,
+                        0 != mX.initialize(u::data(image),
+                                           image.size() * 8));
+                ASSERTV(field, 0 == X.numTimeZones());
+            }
+        }
+
+        if (veryVerbose) cout << "\tPseudo-random corruption." << endl;
+        {
+            Uint64 state = 4711;
+            int    numAccepted = 0;
+            int    checksum    = 0;
+
+            for (int trial = 0; trial < 20000; ++trial) {
+                bsl::vector<Int64> image(VALID, &ta);
+                unsigned char *base = reinterpret_cast<unsigned char *>(
+                                                                image.data());
+
+                const int numChanges = 1 + static_cast<int>(
+                                                 u::nextRandom(&state) % 3);
+                for (int i = 0; i < numChanges; ++i) {
+                    const Uint64 bits = u::nextRandom(&state);
+                    base[bits % LENGTH] = static_cast<unsigned char>(
+                                                                   bits >> 32);
+                }
+
+                Obj mX;  const Obj& X = mX;
+                if (0 == mX.initialize(u::data(image), LENGTH)) {
+                    ++numAccepted;
+                    u::touchEverything(&checksum, X);
+                }
+                else {
+                    ASSERTV(trial, 0 == X.numTimeZones());
+                }
+            }
+            if (veryVerbose) { T_ P_(numAccepted) P(checksum) }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'writeImage' ERRORS
+        //
+        // Concerns:
+        //: 1 'writeImage' fails, without writing, for a time zone having no
+        //:   transitions, an empty identifier, or a null character in a
+        //:   string, and for two time zones having the same identifier.
+        //:
+        //: 2 'writeImage' fails if the stream fails.
+        //:
+        //: 3 'writeImage' of no time zones writes a valid image.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write images of invalid time zones and check that the stream is
+        //:   empty.  (C-1)
+        //:
+        //: 2 Write an image to a stream in a failed state.  (C-2)
+        //:
+        //: 3 Write and read an image of no time zones.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int writeImage(ostream&, const Zoneinfo *const *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'writeImage' ERRORS" << endl
+                          << "===========================" << endl;
+
+        Zone valid(&ta);
+        u::makeZone(&valid, 1, "Valid/Zone", 3);
+
+        if (veryVerbose) cout << "\tInvalid time zones." << endl;
+        {
+            Zone empty(&ta);
+            empty.setIdentifier("Empty/Zone");
+
+            Zone noId(&ta);
+            u::makeZone(&noId, 2, "", 3);
+
+            Zone nullInId(&ta);
+            u::makeZone(&nullInId, 3, "Null", 3);
+            nullInId.setIdentifier(bsl::string("Nu\0ll", 5));
+
+            Zone nullInPosix(&ta);
+            u::makeZone(&nullInPosix, 4, "Null/Posix", 3);
+            nullInPosix.setPosixExtendedRangeDescription(
+                                                   bsl::string("E\0ST", 4));
+
+            Zone nullInDescription(&ta);
+            u::makeZone(&nullInDescription, 5, "Null/Description", 0);
+            nullInDescription.addTransition(0, Desc(0, false,
+                                                    bsl::string("U\0C", 3)));
+
+            Zone duplicate(&ta);
+            u::makeZone(&duplicate, 6, "Valid/Zone", 5);
+
+            const Zone *const DATA[][2] = {
+                { &valid, &empty             },
+                { &noId,  &valid             },
+                { &valid, &nullInId          },
+                { &valid, &nullInPosix       },
+                { &valid, &nullInDescription },
+                { &valid, &duplicate         },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                bsl::ostringstream stream;
+                ASSERTV(ti, 0 != Obj::writeImage(stream, DATA[ti], 2));
+                ASSERTV(ti, stream.str().empty());
+            }
+        }
+
+        if (veryVerbose) cout << "\tFailed stream." << endl;
+        {
+            const Zone *ZONES[] = { &valid };
+
+            bsl::ostringstream stream;
+            stream.setstate(bsl::ios::badbit);
+            ASSERT(0 != Obj::writeImage(stream, ZONES, 1));
+        }
+
+        if (veryVerbose) cout << "\tNo time zones." << endl;
+        {
+            bsl::vector<Int64> buffer(&ta);
+            const int length = u::writeImage(&buffer, 0, 0);
+            ASSERT(64 == length);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.initialize(u::data(buffer), length));
+            ASSERT(0 == X.numTimeZones());
+            ASSERT(0 >  X.findTimeZone("Valid/Zone"));
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Zone *ZONES[] = { &valid, 0 };
+
+            bsl::ostringstream stream;
+            ASSERT_PASS(Obj::writeImage(stream, ZONES,  1));
+            ASSERT_FAIL(Obj::writeImage(stream, ZONES,  2));
+            ASSERT_FAIL(Obj::writeImage(stream, ZONES, -1));
+            ASSERT_FAIL(Obj::writeImage(stream, 0,      1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING ROUND TRIP
+        //
+        // Concerns:
+        //: 1 A default-constructed view is a view of an empty image.
+        //:
+        //: 2 'initialize' accepts an image written by 'writeImage', and the
+        //:   time zones are in order of their identifiers.
+        //:
+        //: 3 The accessors of each time zone return the values of the
+        //:   'Zoneinfo' from which it was written, and 'loadTimeZone' loads a
+        //:   'Zoneinfo' having the same value, using the allocator of the
+        //:   result.
+        //:
+        //: 4 'findTimeZone' finds every time zone, and no other.
+        //:
+        //: 5 'findTransitionForUtcTime' returns the transition found by
+        //:   'Zoneinfo::findTransitionForUtcTime', and 0 for a time before the
+        //:   first transition.
+        //:
+        //: 6 Time zones having the same transitions share them in the image.
+        //:
+        //: 7 'reset' makes a view of an empty image.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write images of sets of pseudo-random time zones of different
+        //:   sizes, in reverse order of identifiers, and including aliases
+        //:   (time zones of different identifiers and the same transitions),
+        //:   and compare the accessors of the views of the images with the
+        //:   time zones.  (C-1..5)
+        //:
+        //: 2 Compare the length of an image having aliases with the length of
+        //:   an image of the same time zones without the aliases.  (C-6)
+        //:
+        //: 3 Reset a view.  (C-7)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   int writeImage(ostream&, const Zoneinfo *const *, int);
+        //   ZoneinfoImage();
+        //   int initialize(const char *, bsl::size_t);
+        //   void reset();
+        //   const char *data() const;
+        //   bool dstInEffectFlag(int, int) const;
+        //   const char *description(int, int) const;
+        //   int findTimeZone(const char *) const;
+        //   int findTransitionForUtcTime(int, TimeT64) const;
+        //   bsl::size_t length() const;
+        //   void loadTimeZone(Zoneinfo *, int) const;
+        //   int numTimeZones() const;
+        //   int numTransitions(int) const;
+        //   const char *posixExtendedRangeDescription(int) const;
+        //   const char *timeZoneId(int) const;
+        //   const TimeT64 *transitionTimes(int) const;
+        //   int utcOffsetInSeconds(int, int) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ROUND TRIP" << endl
+                          << "==================" << endl;
+
+        if (veryVerbose) cout << "\tDefault construction." << endl;
+        {
+            const Obj X;
+
+            ASSERT(0 == X.data());
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.numTimeZones());
+            ASSERT(0 >  X.findTimeZone("A"));
+        }
+
+        if (veryVerbose) cout << "\tRound trips." << endl;
+
+        const int NUM_ZONES_DATA[] = { 1, 2, 3, 10, 50 };
+        const int NUM_NUM_ZONES    = static_cast<int>(
+                               sizeof NUM_ZONES_DATA / sizeof *NUM_ZONES_DATA);
+
+        for (int ti = 0; ti < NUM_NUM_ZONES; ++ti) {
+            const int NUM_ZONES = NUM_ZONES_DATA[ti];
+
+            if (veryVeryVerbose) { T_ T_ P(NUM_ZONES) }
+
+            bsl::vector<Zone>         zones(NUM_ZONES, Zone(&ta), &ta);
+            bsl::vector<const Zone *> pointers(&ta);
+
+            for (int i = 0; i < NUM_ZONES; ++i) {
+                // Identifiers in reverse order; every fourth zone is an alias
+                // of the previous one.
+
+                char id[32];
+                bsl::sprintf(id, "Zone/%03d", NUM_ZONES - i);
+
+                if (0 < i && 0 == i % 4) {
+                    zones[i] = zones[i - 1];
+                    zones[i].setIdentifier(id);
+                }
+                else {
+                    u::makeZone(&zones[i], i + 1, id, i * 7 % 60);
+                }
+                pointers.push_back(&zones[i]);
+            }
+
+            bsl::vector<Int64> buffer(&ta);
+            const int LENGTH = u::writeImage(&buffer,
+                                             pointers.data(),
+                                             NUM_ZONES);
+            ASSERTV(NUM_ZONES, 0 < LENGTH);
+            ASSERTV(NUM_ZONES, 0 == LENGTH % 8);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERTV(NUM_ZONES, 0 == mX.initialize(u::data(buffer), LENGTH));
+
+            ASSERTV(NUM_ZONES, u::data(buffer) == X.data());
+            ASSERTV(NUM_ZONES, LENGTH == static_cast<int>(X.length()));
+            ASSERTV(NUM_ZONES, NUM_ZONES == X.numTimeZones());
+
+            for (int i = 0; i < NUM_ZONES; ++i) {
+                const Zone& ZONE  = zones[i];
+                const int   INDEX = NUM_ZONES - 1 - i;
+
+                ASSERTV(NUM_ZONES, i,
+                        INDEX == X.findTimeZone(ZONE.identifier().c_str()));
+                ASSERTV(NUM_ZONES, i,
+                        ZONE.identifier() == X.timeZoneId(INDEX));
+                ASSERTV(NUM_ZONES, i,
+                        ZONE.posixExtendedRangeDescription() ==
+                                      X.posixExtendedRangeDescription(INDEX));
+                ASSERTV(NUM_ZONES, i,
+                        static_cast<int>(ZONE.numTransitions()) ==
+                                                    X.numTransitions(INDEX));
+
+                const TimeT64 *times = X.transitionTimes(INDEX);
+
+                int j = 0;
+                for (Zone::TransitionConstIterator it =
+                                                       ZONE.beginTransitions();
+                     it != ZONE.endTransitions();
+                     ++it, ++j) {
+                    const Desc& DESC = it->descriptor();
+
+                    ASSERTV(i, j, it->utcTime() == times[j]);
+                    ASSERTV(i, j, DESC.utcOffsetInSeconds() ==
+                                              X.utcOffsetInSeconds(INDEX, j));
+                    ASSERTV(i, j, DESC.dstInEffectFlag() ==
+                                                 X.dstInEffectFlag(INDEX, j));
+                    ASSERTV(i, j, DESC.description() ==
+                                                     X.description(INDEX, j));
+
+                    // The transition is found at, and just after, its time,
+                    // and the previous one just before it.
+
+                    ASSERTV(i, j, j == X.findTransitionForUtcTime(
+                                                          INDEX,
+                                                          it->utcTime()));
+                    ASSERTV(i, j, j == X.findTransitionForUtcTime(
+                                                          INDEX,
+                                                          it->utcTime() + 1));
+                    if (0 < j) {
+                        ASSERTV(i, j, j - 1 == X.findTransitionForUtcTime(
+                                                          INDEX,
+                                                          it->utcTime() - 1));
+                    }
+                }
+                ASSERTV(i, 0 == X.findTransitionForUtcTime(
+                                                    INDEX,
+                                                    times[0] - 86400));
+
+                // Compare with 'Zoneinfo' at pseudo-random times.
+
+                Uint64 state = i;
+                for (int k = 0; k < 100; ++k) {
+                    const TimeT64 TIME = u::toTimeT(bdlt::Datetime(1900, 1, 1))
+                                       + static_cast<TimeT64>(
+                                              u::nextRandom(&state)
+                                                  % (120LL * 365 * 86400));
+
+                    const Zone::TransitionConstIterator EXP =
+                                       ZONE.findTransitionForUtcTime(
+                                  bdlt::EpochUtil::convertFromTimeT64(TIME));
+
+                    ASSERTV(i, k, EXP->utcTime() ==
+                         times[X.findTransitionForUtcTime(INDEX, TIME)]);
+                }
+
+                bslma::TestAllocator        la("load", veryVeryVeryVerbose);
+                bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+                Zone loaded(&la);
+                u::makeZone(&loaded, 99, "Overwritten", 3);
+                X.loadTimeZone(&loaded, INDEX);
+
+                ASSERTV(NUM_ZONES, i, ZONE == loaded);
+                ASSERTV(NUM_ZONES, i, &la == loaded.allocator());
+                ASSERTV(NUM_ZONES, i, dam.isTotalSame());
+            }
+
+            ASSERTV(NUM_ZONES, 0 > X.findTimeZone(""));
+            ASSERTV(NUM_ZONES, 0 > X.findTimeZone("Zone/000"));
+            ASSERTV(NUM_ZONES, 0 > X.findTimeZone("Zone/0010"));
+            ASSERTV(NUM_ZONES, 0 > X.findTimeZone("Zone/999"));
+            ASSERTV(NUM_ZONES, 0 > X.findTimeZone("Zone/00"));
+
+            // Aliases share transitions.
+
+            if (4 < NUM_ZONES) {
+                bsl::vector<const Zone *> unaliased(&ta);
+                for (int i = 0; i < NUM_ZONES; ++i) {
+                    if (0 == i || 0 != i % 4) {
+                        unaliased.push_back(&zones[i]);
+                    }
+                }
+
+                bsl::vector<Int64> other(&ta);
+                const int OTHER_LENGTH = u::writeImage(
+                                           &other,
+                                           unaliased.data(),
+                                           static_cast<int>(unaliased.size()));
+
+                const int NUM_ALIASES = NUM_ZONES
+                                      - static_cast<int>(unaliased.size());
+
+                // Each alias adds a record and an identifier of 9 bytes.
+
+                ASSERTV(NUM_ZONES, LENGTH, OTHER_LENGTH,
+                        LENGTH <= OTHER_LENGTH + NUM_ALIASES * (32 + 9) + 7);
+            }
+
+            mX.reset();
+            ASSERTV(NUM_ZONES, 0 == X.data());
+            ASSERTV(NUM_ZONES, 0 == X.length());
+            ASSERTV(NUM_ZONES, 0 == X.numTimeZones());
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Zone zone(&ta);
+            u::makeZone(&zone, 1, "A", 3);
+            const Zone *ZONES[] = { &zone };
+
+            bsl::vector<Int64> buffer(&ta);
+            const int LENGTH = u::writeImage(&buffer, ZONES, 1);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.initialize(u::data(buffer), LENGTH));
+
+            Zone result(&ta);
+
+            ASSERT_PASS(X.numTransitions(0));
+            ASSERT_FAIL(X.numTransitions(1));
+            ASSERT_FAIL(X.numTransitions(-1));
+            ASSERT_PASS(X.utcOffsetInSeconds(0, 3));
+            ASSERT_FAIL(X.utcOffsetInSeconds(0, 4));
+            ASSERT_FAIL(X.utcOffsetInSeconds(0, -1));
+            ASSERT_FAIL(X.timeZoneId(1));
+            ASSERT_FAIL(X.transitionTimes(1));
+            ASSERT_FAIL(X.findTransitionForUtcTime(1, 0));
+            ASSERT_FAIL(X.findTimeZone(0));
+            ASSERT_PASS(X.loadTimeZone(&result, 0));
+            ASSERT_FAIL(X.loadTimeZone(&result, 1));
+            ASSERT_FAIL(X.loadTimeZone(0, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write an image of two time zones, and read it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Zone a(&ta);
+        a.setIdentifier("Breathing/A");
+        a.addTransition(u::toTimeT(bdlt::Datetime(1, 1, 1)),
+                        Desc(3600, false, "A"));
+        a.addTransition(u::toTimeT(bdlt::Datetime(2000, 1, 1)),
+                        Desc(7200, true, "B"));
+
+        Zone b(&ta);
+        b.setIdentifier("Breathing/B");
+        b.addTransition(u::toTimeT(bdlt::Datetime(1, 1, 1)),
+                        Desc(-3600, false, "C"));
+
+        const Zone *ZONES[] = { &b, &a };
+
+        bsl::vector<Int64> buffer(&ta);
+        const int LENGTH = u::writeImage(&buffer, ZONES, 2);
+        ASSERT(0 < LENGTH);
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == mX.initialize(u::data(buffer), LENGTH));
+        ASSERT(2 == X.numTimeZones());
+        ASSERT(0 == X.findTimeZone("Breathing/A"));
+        ASSERT(1 == X.findTimeZone("Breathing/B"));
+        ASSERT(0 >  X.findTimeZone("Breathing/C"));
+        ASSERT(2 == X.numTransitions(0));
+        ASSERT(1 == X.numTransitions(1));
+        ASSERT(7200 == X.utcOffsetInSeconds(0, 1));
+        ASSERT(0 == bsl::strcmp("C", X.description(1, 0)));
+
+        Zone loaded(&ta);
+        X.loadTimeZone(&loaded, 0);
+        ASSERT(a == loaded);
+        X.loadTimeZone(&loaded, 1);
+        ASSERT(b == loaded);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,228 @@
+// baltzo_zoneinfoimageutil.cpp                                      -*-C++-*-
+#include <baltzo_zoneinfoimageutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baltzo_zoneinfoimageutil_cpp,"$Id$ $CSID$")
+
+#include <baltzo_datafileloader.h>
+#include <baltzo_loader.h>
+#include <baltzo_zoneinfo.h>
+#include <baltzo_zoneinfoimage.h>
+#include <baltzo_zoneinfoutil.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bdls_processutil.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_log.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_ios.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace baltzo {
+namespace {
+
+typedef bdls::FilesystemUtil FilesystemUtil;
+
+bool isZoneinfoBinaryFile(const bsl::string& path)
+    // Return 'true' if the file at the specified 'path' starts with the magic
+    // number of a Zoneinfo binary file, and 'false' otherwise.
+{
+    FilesystemUtil::FileDescriptor fd = FilesystemUtil::open(
+                                                 path,
+                                                 FilesystemUtil::e_OPEN,
+                                                 FilesystemUtil::e_READ_ONLY);
+    if (FilesystemUtil::k_INVALID_FD == fd) {
+        return false;                                                 // RETURN
+    }
+
+    char      magic[4];
+    const int numBytes = FilesystemUtil::read(fd, magic, sizeof magic);
+
+    FilesystemUtil::close(fd);
+
+    return static_cast<int>(sizeof magic) == numBytes
+        && 0 == bsl::memcmp(magic, "TZif", sizeof magic);
+}
+
+int appendTimeZoneIds(bsl::vector<bsl::string> *result,
+                      const bsl::string&        directory,
+                      const bsl::string&        prefix)
+    // Append to the specified 'result' the identifiers, each starting with
+    // the specified 'prefix', of the time zones in the specified 'directory'
+    // and, recursively, in its subdirectories.  Return 0 on success, and a
+    // non-zero value otherwise.
+{
+    bsl::string pattern(directory);
+    bdls::PathUtil::appendRaw(&pattern, "*");
+
+    bsl::vector<bsl::string> paths;
+    if (0 > FilesystemUtil::findMatchingPaths(&paths, pattern)) {
+        return -1;                                                    // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < paths.size(); ++i) {
+        const bsl::string& path = paths[i];
+
+        bsl::string leaf;
+        if (0 != bdls::PathUtil::getLeaf(&leaf, path)) {
+            continue;                                               // CONTINUE
+        }
+
+        if (FilesystemUtil::isDirectory(path)) {
+            if (prefix.empty() && ("posix" == leaf || "right" == leaf)) {
+                continue;                                           // CONTINUE
+            }
+            if (0 != appendTimeZoneIds(result, path, prefix + leaf + '/')) {
+                return -1;                                            // RETURN
+            }
+        }
+        else if (FilesystemUtil::isRegularFile(path, true)
+              && isZoneinfoBinaryFile(path)) {
+            result->push_back(prefix + leaf);
+        }
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // struct ZoneinfoImageUtil
+                          // ------------------------
+
+// CLASS METHODS
+int ZoneinfoImageUtil::loadTimeZoneIds(bsl::vector<bsl::string> *result,
+                                       const char               *rootPath)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(rootPath);
+
+    result->clear();
+
+    if (!FilesystemUtil::isDirectory(rootPath, true)) {
+        BSLS_LOG_ERROR("Invalid Zoneinfo root directory '%s'", rootPath);
+        return -1;                                                    // RETURN
+    }
+
+    if (0 != appendTimeZoneIds(result, rootPath, bsl::string())) {
+        BSLS_LOG_ERROR("Failed to read Zoneinfo root directory '%s'",
+                       rootPath);
+        return -1;                                                    // RETURN
+    }
+
+    bsl::sort(result->begin(), result->end());
+    return 0;
+}
+
+int ZoneinfoImageUtil::writeImage(
+                                 bsl::ostream&                   stream,
+                                 Loader                         *loader,
+                                 const bsl::vector<bsl::string>& timeZoneIds)
+{
+    BSLS_ASSERT(loader);
+
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    bsl::vector<Zoneinfo> timeZones(timeZoneIds.size(),
+                                    Zoneinfo(allocator),
+                                    allocator);
+
+    bsl::vector<const Zoneinfo *> pointers(allocator);
+    pointers.reserve(timeZoneIds.size());
+
+    for (bsl::size_t i = 0; i < timeZoneIds.size(); ++i) {
+        const char *id = timeZoneIds[i].c_str();
+
+        if (0 != loader->loadTimeZone(&timeZones[i], id)) {
+            BSLS_LOG_ERROR("Failed to load time zone '%s'", id);
+            return -1;                                                // RETURN
+        }
+        if (!ZoneinfoUtil::isWellFormed(timeZones[i])) {
+            BSLS_LOG_ERROR("Time zone '%s' is not well-formed", id);
+            return -1;                                                // RETURN
+        }
+        pointers.push_back(&timeZones[i]);
+    }
+
+    return ZoneinfoImage::writeImage(stream,
+                                     pointers.data(),
+                                     static_cast<int>(pointers.size()));
+}
+
+int ZoneinfoImageUtil::writeImageFile(const char *imagePath,
+                                      const char *rootPath)
+{
+    BSLS_ASSERT(imagePath);
+    BSLS_ASSERT(rootPath);
+
+    bsl::vector<bsl::string> timeZoneIds;
+    if (0 != loadTimeZoneIds(&timeZoneIds, rootPath)) {
+        return -1;                                                    // RETURN
+    }
+
+    DataFileLoader loader;
+    loader.configureRootPath(rootPath);
+
+    char suffix[32];
+    bsl::sprintf(suffix, ".%d.tmp", bdls::ProcessUtil::getProcessId());
+
+    const bsl::string temporaryPath = bsl::string(imagePath) + suffix;
+
+    {
+        bsl::ofstream stream(temporaryPath.c_str(),
+                             bsl::ios::out | bsl::ios::binary);
+        if (!stream.is_open()) {
+            BSLS_LOG_ERROR("Failed to create zoneinfo image file '%s'",
+                           temporaryPath.c_str());
+            return -1;                                                // RETURN
+        }
+
+        int rc = writeImage(stream, &loader, timeZoneIds);
+
+        stream.close();
+
+        if (0 != rc || !stream) {
+            BSLS_LOG_ERROR("Failed to write zoneinfo image file '%s'",
+                           temporaryPath.c_str());
+            FilesystemUtil::remove(temporaryPath);
+            return -1;                                                // RETURN
+        }
+    }
+
+    if (0 != FilesystemUtil::move(temporaryPath, imagePath)) {
+        BSLS_LOG_ERROR("Failed to rename zoneinfo image file '%s' to '%s'",
+                       temporaryPath.c_str(),
+                       imagePath);
+        FilesystemUtil::remove(temporaryPath);
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,149 @@
+// baltzo_zoneinfoimageutil.h                                         -*-C++-*-
+#ifndef INCLUDED_BALTZO_ZONEINFOIMAGEUTIL
+#define INCLUDED_BALTZO_ZONEINFOIMAGEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to compile a Zoneinfo database into an image.
+//
+//@CLASSES:
+//  baltzo::ZoneinfoImageUtil: utilities for writing zoneinfo images
+//
+//@SEE_ALSO: baltzo_zoneinfoimage, baltzo_imagefileloader,
+//           baltzo_datafileloader
+//
+//@DESCRIPTION: This component provides a namespace,
+// 'baltzo::ZoneinfoImageUtil', for utility functions that compile the time
+// zones of a Zoneinfo database into a zoneinfo image (see
+// 'baltzo_zoneinfoimage'), which can then be mapped into memory by a
+// 'baltzo::ImageFileLoader'.
+//
+// 'loadTimeZoneIds' finds the identifiers of the time zones in the directory
+// hierarchy of a Zoneinfo database (see 'baltzo_datafileloader'), 'writeImage'
+// writes the image of the time zones having a sequence of identifiers,
+// obtained from any 'baltzo::Loader', to a stream, and 'writeImageFile'
+// combines the two to compile a Zoneinfo database into an image file.
+//
+///Time-Zone Identifiers of a Zoneinfo Database
+///--------------------------------------------
+// The identifier of a time zone is the path of its Zoneinfo binary file
+// relative to the root directory of the database, using '/' as the separator.
+// 'loadTimeZoneIds' recurses into the directories of the hierarchy (but not
+// into symbolic links to directories), and includes every file, or symbolic
+// link to a file, that starts with the magic number of a Zoneinfo binary file
+// ("TZif"), so that the data files that are not time zones (e.g.,
+// "zone.tab") are excluded, and the time zones that are aliases of others
+// (typically symbolic links, e.g., "US/Eastern") are included.  The top-level
+// directories "posix" and "right", which some distributions provide as copies
+// of the database using other conventions for leap seconds, are excluded.
+//
+// Note that the transitions of time zones that are aliases are stored once in
+// the image (see 'baltzo_zoneinfoimage').
+//
+///Replacing an Image File
+///-----------------------
+// 'writeImageFile' writes the image to a temporary file in the directory of
+// the image file, and then renames it to the image file, so that processes
+// having mapped a previous image file at the same path continue to see a
+// consistent image (see 'baltzo_imagefileloader').
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Compiling the System Zoneinfo Database
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to compile the Zoneinfo database installed in
+// "/usr/share/zoneinfo" into an image file, which the processes on the host
+// will map into memory to load time zones.
+//
+// First, we write the image file:
+//..
+//  int rc = baltzo::ZoneinfoImageUtil::writeImageFile("zoneinfo.img",
+//                                                     "/usr/share/zoneinfo");
+//  assert(0 == rc);
+//..
+// Then, we map the image file using a 'baltzo::ImageFileLoader':
+//..
+//  baltzo::ImageFileLoader loader;
+//  rc = loader.mapImage("zoneinfo.img");
+//  assert(0 == rc);
+//..
+// Finally, we observe that the image has the time zones of the database:
+//..
+//  bsl::vector<bsl::string> timeZoneIds;
+//  rc = baltzo::ZoneinfoImageUtil::loadTimeZoneIds(&timeZoneIds,
+//                                                  "/usr/share/zoneinfo");
+//  assert(0 == rc);
+//  assert(static_cast<int>(timeZoneIds.size()) ==
+//                                            loader.image().numTimeZones());
+//..
+
+#include <balscm_version.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baltzo {
+
+class Loader;
+
+                          // ========================
+                          // struct ZoneinfoImageUtil
+                          // ========================
+
+struct ZoneinfoImageUtil {
+    // This 'struct' provides a namespace for utility functions that compile
+    // time zones into zoneinfo images.
+
+    // CLASS METHODS
+    static int loadTimeZoneIds(bsl::vector<bsl::string> *result,
+                               const char               *rootPath);
+        // Load into the specified 'result', in ascending order, the
+        // identifiers of the time zones of the Zoneinfo database having the
+        // specified 'rootPath' as its root directory (see {Time-Zone
+        // Identifiers of a Zoneinfo Database}).  Return 0 on success, and a
+        // non-zero value, leaving 'result' in a valid but unspecified state,
+        // if 'rootPath' is not a directory or cannot be read.
+
+    static int writeImage(bsl::ostream&                   stream,
+                          Loader                         *loader,
+                          const bsl::vector<bsl::string>& timeZoneIds);
+        // Write to the specified 'stream' the image of the time zones, loaded
+        // by the specified 'loader', having the specified 'timeZoneIds'.
+        // Return 0 on success, and a non-zero value otherwise.  This function
+        // fails, without writing to 'stream', if 'loader' fails to load one of
+        // the time zones, if a loaded time zone is not well-formed (see
+        // 'ZoneinfoUtil::isWellFormed'), or if 'timeZoneIds' has duplicates.
+
+    static int writeImageFile(const char *imagePath, const char *rootPath);
+        // Write to the file at the specified 'imagePath' the image of the time
+        // zones of the Zoneinfo database having the specified 'rootPath' as
+        // its root directory, replacing the file, if it exists (see
+        // {Replacing an Image File}).  Return 0 on success, and a non-zero
+        // value, leaving the file at 'imagePath' unchanged, otherwise.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,742 @@
+// baltzo_zoneinfoimageutil.t.cpp                                     -*-C++-*-
+#include <baltzo_zoneinfoimageutil.h>
+
+#include <baltzo_datafileloader.h>
+#include <baltzo_errorcode.h>
+#include <baltzo_imagefileloader.h>
+#include <baltzo_localtimedescriptor.h>
+#include <baltzo_testloader.h>
+#include <baltzo_zoneinfo.h>
+#include <baltzo_zoneinfoimage.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bdls_processutil.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides utility functions that compile the time
+// zones of a Zoneinfo database into a zoneinfo image.  A small Zoneinfo
+// directory hierarchy, including files that are not time zones, aliases, and
+// the "posix" and "right" directories, is created in a directory whose name
+// includes the process id, and removed at the end of each test case.  In
+// addition, if the system Zoneinfo database is installed, it is compiled, and
+// every time zone loaded from the image is compared with the time zone loaded
+// from its Zoneinfo binary file.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int loadTimeZoneIds(bsl::vector<bsl::string> *, const char *);
+// [ 3] int writeImage(ostream&, Loader *, const vector<string>&);
+// [ 4] int writeImageFile(const char *, const char *);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baltzo::ZoneinfoImageUtil   Util;
+typedef baltzo::Zoneinfo            Zone;
+typedef baltzo::LocalTimeDescriptor Desc;
+typedef bdls::FilesystemUtil        FileUtil;
+
+static const char *const SYSTEM_ROOT_PATH = "/usr/share/zoneinfo";
+
+static const unsigned char ASIA_BANGKOK_DATA[] = {
+    0x54, 0x5a, 0x69, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0xa2, 0x6a, 0x67, 0xc4,
+    0x01, 0x00, 0x00, 0x5e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x62, 0x70, 0x00,
+    0x04, 0x42, 0x4d, 0x54, 0x00, 0x49, 0x43, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x54, 0x5a, 0x69, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff,
+    0xff, 0x56, 0xb6, 0x85, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x6a, 0x67,
+    0xc4, 0x01, 0x02, 0x00, 0x00, 0x5e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x5e,
+    0x3c, 0x00, 0x04, 0x00, 0x00, 0x62, 0x70, 0x00, 0x08, 0x4c, 0x4d, 0x54,
+    0x00, 0x42, 0x4d, 0x54, 0x00, 0x49, 0x43, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x49, 0x43, 0x54, 0x2d, 0x37, 0x0a
+};
+
+// ============================================================================
+//                              TEST FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+bsl::string makeFileName(const char *name)
+    // Return the name of a file, unique to this process, having the specified
+    // 'name'.
+{
+    char buffer[64];
+    bsl::sprintf(buffer,
+                 "baltzo_zoneinfoimageutil.%d.",
+                 bdls::ProcessUtil::getProcessId());
+    return bsl::string(buffer) + name;
+}
+
+void writeFile(const bsl::string& root,
+               const char        *relativePath,
+               const void        *data,
+               bsl::size_t        length)
+    // Write into the file at the specified 'relativePath' from the specified
+    // 'root' directory the specified 'length' bytes at the specified 'data',
+    // creating the directories of the path if they do not exist.
+{
+    bsl::string path(root);
+    bdls::PathUtil::appendRaw(&path, relativePath);
+
+    ASSERTV(path, 0 == FileUtil::createDirectories(path, false));
+
+    bsl::ofstream stream(path.c_str(), bsl::ios::out | bsl::ios::binary);
+    stream.write(static_cast<const char *>(data), length);
+    ASSERTV(path, stream);
+}
+
+void createZoneinfoTree(bsl::vector<bsl::string> *timeZoneIds,
+                        const bsl::string&        root)
+    // Create, at the specified 'root', a Zoneinfo directory hierarchy having
+    // time zones, aliases, files that are not time zones, and the "posix" and
+    // "right" directories, and load into the specified 'timeZoneIds', in
+    // ascending order, the identifiers of its time zones.
+{
+    const void        *DATA   = ASIA_BANGKOK_DATA;
+    const bsl::size_t  LENGTH = sizeof ASIA_BANGKOK_DATA;
+
+    writeFile(root, "Asia/Bangkok",           DATA, LENGTH);
+    writeFile(root, "Asia/Ho_Chi_Minh",       DATA, LENGTH);
+    writeFile(root, "Etc/Deep/Nested/Zone",   DATA, LENGTH);
+    writeFile(root, "Indochina",              DATA, LENGTH);
+    writeFile(root, "posix/Asia/Bangkok",     DATA, LENGTH);
+    writeFile(root, "right/Asia/Bangkok",     DATA, LENGTH);
+    writeFile(root, "Etc/posix/Asia/Bangkok", DATA, LENGTH);
+    writeFile(root, "zone.tab",               "# Not a time zone\n", 18);
+    writeFile(root, "Asia/TZi",               "TZi", 3);
+    writeFile(root, "tzdata.zi",              "", 0);
+
+    bsl::string emptyDirectory(root);
+    bdls::PathUtil::appendRaw(&emptyDirectory, "Empty");
+    FileUtil::createDirectories(emptyDirectory, true);
+
+    timeZoneIds->clear();
+    timeZoneIds->push_back("Asia/Bangkok");
+    timeZoneIds->push_back("Asia/Ho_Chi_Minh");
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+    // A symbolic link to a time zone is an alias, but a symbolic link to a
+    // directory is not followed.
+
+    const bsl::string LINK     = root + "/Asia/Saigon";
+    const bsl::string DIR_LINK = root + "/Linked";
+    ASSERT(0 == ::symlink("Ho_Chi_Minh", LINK.c_str()));
+    ASSERT(0 == ::symlink("Asia", DIR_LINK.c_str()));
+
+    timeZoneIds->push_back("Asia/Saigon");
+#endif
+
+    timeZoneIds->push_back("Etc/Deep/Nested/Zone");
+    timeZoneIds->push_back("Etc/posix/Asia/Bangkok");
+    timeZoneIds->push_back("Indochina");
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   The example is skipped if the system Zoneinfo database is not
+        //:   installed.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        if (!baltzo::DataFileLoader::isPlausibleZoneinfoRootPath(
+                                                           SYSTEM_ROOT_PATH)) {
+            if (verbose) cout << "\tSystem Zoneinfo database not found."
+                              << endl;
+            break;
+        }
+
+        bslma::DefaultAllocatorGuard usageGuard(&ta);
+
+        const bsl::string IMAGE_FILE = u::makeFileName("zoneinfo.img");
+
+        {
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Compiling the System Zoneinfo Database
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to compile the Zoneinfo database installed in
+// "/usr/share/zoneinfo" into an image file, which the processes on the host
+// will map into memory to load time zones.
+//
+// First, we write the image file:
+//..
+    int rc = baltzo::ZoneinfoImageUtil::writeImageFile(IMAGE_FILE.c_str(),
+                                                       "/usr/share/zoneinfo");
+    ASSERT(0 == rc);
+//..
+// Then, we map the image file using a 'baltzo::ImageFileLoader':
+//..
+    baltzo::ImageFileLoader loader;
+    rc = loader.mapImage(IMAGE_FILE.c_str());
+    ASSERT(0 == rc);
+//..
+// Finally, we observe that the image has the time zones of the database:
+//..
+    bsl::vector<bsl::string> timeZoneIds;
+    rc = baltzo::ZoneinfoImageUtil::loadTimeZoneIds(&timeZoneIds,
+                                                    "/usr/share/zoneinfo");
+    ASSERT(0 == rc);
+    ASSERT(static_cast<int>(timeZoneIds.size()) ==
+                                              loader.image().numTimeZones());
+//..
+        }
+
+        FileUtil::remove(IMAGE_FILE);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'writeImageFile'
+        //
+        // Concerns:
+        //: 1 'writeImageFile' writes the image of every time zone of the
+        //:   database, replacing an existing file.
+        //:
+        //: 2 Every time zone loaded from the image file has the value of the
+        //:   time zone loaded from its Zoneinfo binary file.
+        //:
+        //: 3 'writeImageFile' fails, leaving an existing file unchanged and
+        //:   leaving no temporary file, if the root path is not a directory,
+        //:   or a time zone of the database cannot be loaded.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Compile a test Zoneinfo hierarchy into an existing file, map it,
+        //:   and compare each of its time zones with the time zone loaded by a
+        //:   'DataFileLoader'.  (C-1, 2)
+        //:
+        //: 2 If the system Zoneinfo database is installed, repeat P-1 with it.
+        //:   (C-1, 2)
+        //:
+        //: 3 Compile a missing directory, and a hierarchy having a malformed
+        //:   time zone, into an existing file.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int writeImageFile(const char *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'writeImageFile'" << endl
+                          << "========================" << endl;
+
+        const bsl::string ROOT       = u::makeFileName("root");
+        const bsl::string IMAGE_FILE = u::makeFileName("test.img");
+
+        bsl::vector<bsl::string> EXP_IDS;
+        u::createZoneinfoTree(&EXP_IDS, ROOT);
+
+        bsl::vector<bsl::string> ROOTS;
+        ROOTS.push_back(ROOT);
+        if (baltzo::DataFileLoader::isPlausibleZoneinfoRootPath(
+                                                           SYSTEM_ROOT_PATH)) {
+            ROOTS.push_back(SYSTEM_ROOT_PATH);
+        }
+        else if (verbose) {
+            cout << "\tSystem Zoneinfo database not found." << endl;
+        }
+
+        for (bsl::size_t ti = 0; ti < ROOTS.size(); ++ti) {
+            const bsl::string& ROOT_PATH = ROOTS[ti];
+
+            if (veryVerbose) { T_ P(ROOT_PATH) }
+
+            u::writeFile(".", IMAGE_FILE.c_str(), "old", 3);
+
+            ASSERTV(ROOT_PATH, 0 == Util::writeImageFile(IMAGE_FILE.c_str(),
+                                                         ROOT_PATH.c_str()));
+
+            bsl::vector<bsl::string> ids;
+            ASSERTV(ROOT_PATH, 0 == Util::loadTimeZoneIds(&ids,
+                                                          ROOT_PATH.c_str()));
+            if (0 == ti) {
+                ASSERTV(ROOT_PATH, EXP_IDS == ids);
+            }
+
+            baltzo::ImageFileLoader imageLoader(&ta);
+            ASSERTV(ROOT_PATH, 0 == imageLoader.mapImage(IMAGE_FILE.c_str()));
+
+            const baltzo::ZoneinfoImage& IMAGE = imageLoader.image();
+            ASSERTV(ROOT_PATH, static_cast<int>(ids.size()) ==
+                                                         IMAGE.numTimeZones());
+
+            baltzo::DataFileLoader fileLoader(&ta);
+            fileLoader.configureRootPath(ROOT_PATH.c_str());
+
+            for (bsl::size_t i = 0; i < ids.size(); ++i) {
+                const char *ID = ids[i].c_str();
+
+                Zone fromImage(&ta), fromFile(&ta);
+                ASSERTV(ID, 0 == imageLoader.loadTimeZone(&fromImage, ID));
+                ASSERTV(ID, 0 == fileLoader.loadTimeZone(&fromFile,   ID));
+                ASSERTV(ID, fromFile == fromImage);
+            }
+
+            if (veryVerbose) {
+                T_ P_(IMAGE.numTimeZones()) P(IMAGE.length())
+            }
+        }
+
+        if (veryVerbose) cout << "\tFailures." << endl;
+        {
+            const bsl::string MISSING   = u::makeFileName("missing");
+            const bsl::string MALFORMED = u::makeFileName("malformed");
+
+            u::writeFile(MALFORMED, "Asia/Bangkok",
+                         ASIA_BANGKOK_DATA, sizeof ASIA_BANGKOK_DATA);
+            u::writeFile(MALFORMED, "Asia/Broken",
+                         ASIA_BANGKOK_DATA, sizeof ASIA_BANGKOK_DATA - 20);
+
+            const char *ROOT_PATHS[] = { MISSING.c_str(), MALFORMED.c_str() };
+
+            for (int ti = 0; ti < 2; ++ti) {
+                u::writeFile(".", IMAGE_FILE.c_str(), "old", 3);
+
+                ASSERTV(ti, 0 != Util::writeImageFile(IMAGE_FILE.c_str(),
+                                                      ROOT_PATHS[ti]));
+
+                bsl::ifstream stream(IMAGE_FILE.c_str());
+                bsl::string   contents;
+                stream >> contents;
+                ASSERTV(ti, contents, "old" == contents);
+
+                bsl::vector<bsl::string> temporaryFiles;
+                FileUtil::findMatchingPaths(&temporaryFiles,
+                                            (IMAGE_FILE + ".*").c_str());
+                ASSERTV(ti, temporaryFiles.empty());
+            }
+
+            FileUtil::remove(MALFORMED, true);
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Util::writeImageFile(0, ROOT.c_str()));
+            ASSERT_FAIL(Util::writeImageFile(IMAGE_FILE.c_str(), 0));
+        }
+
+        FileUtil::remove(IMAGE_FILE);
+        FileUtil::remove(ROOT, true);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'writeImage'
+        //
+        // Concerns:
+        //: 1 'writeImage' writes the image of the time zones, loaded by the
+        //:   loader, having the identifiers.
+        //:
+        //: 2 'writeImage' fails, without writing, if a time zone cannot be
+        //:   loaded, is not well-formed, or if an identifier is duplicated.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a 'TestLoader', write images of sets of time zones, and
+        //:   compare the time zones of the images with those of the loader.
+        //:   (C-1)
+        //:
+        //: 2 Write images of sets having an unknown identifier, a time zone
+        //:   that is not well-formed, and a duplicate identifier.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   int writeImage(ostream&, Loader *, const vector<string>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'writeImage'" << endl
+                          << "====================" << endl;
+
+        const bdlt::EpochUtil::TimeT64 FIRST =
+                 bdlt::EpochUtil::convertToTimeT64(bdlt::Datetime(1, 1, 1));
+
+        baltzo::TestLoader loader(&ta);
+
+        const char *IDS[] = { "Zone/A", "Zone/B", "Zone/C" };
+        for (int i = 0; i < 3; ++i) {
+            Zone zone(&ta);
+            zone.setIdentifier(IDS[i]);
+            zone.addTransition(FIRST, Desc(i * 3600, false, "STD"));
+            zone.addTransition(FIRST + 1000000000LL * (i + 1),
+                               Desc(i * 3600 + 1800, true, "DST"));
+            loader.setTimeZone(zone);
+        }
+        {
+            // A time zone that is not well-formed, having no initial
+            // transition at 1/1/1.
+
+            Zone zone(&ta);
+            zone.setIdentifier("Zone/Malformed");
+            zone.addTransition(0, Desc(0, false, "UTC"));
+            loader.setTimeZone(zone);
+        }
+
+        if (veryVerbose) cout << "\tSets of time zones." << endl;
+        {
+            for (int n = 0; n <= 3; ++n) {
+                bsl::vector<bsl::string> ids(IDS, IDS + n);
+
+                bsl::ostringstream stream;
+                ASSERTV(n, 0 == Util::writeImage(stream, &loader, ids));
+
+                const bsl::string DATA = stream.str();
+
+                bsl::vector<bsls::Types::Int64> buffer(DATA.size() / 8 + 1);
+                bsl::memcpy(buffer.data(), DATA.data(), DATA.size());
+
+                baltzo::ZoneinfoImage image;
+                ASSERTV(n, 0 == image.initialize(
+                                 reinterpret_cast<const char *>(buffer.data()),
+                                 DATA.size()));
+                ASSERTV(n, n == image.numTimeZones());
+
+                for (int i = 0; i < n; ++i) {
+                    Zone fromImage(&ta), fromLoader(&ta);
+                    image.loadTimeZone(&fromImage, i);
+                    ASSERTV(n, i, 0 == loader.loadTimeZone(&fromLoader,
+                                                           IDS[i]));
+                    ASSERTV(n, i, fromLoader == fromImage);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tFailures." << endl;
+        {
+            const char *const DATA[][3] = {
+                { "Zone/A", "Zone/Unknown",   "Zone/B" },
+                { "Zone/A", "Zone/Malformed", "Zone/B" },
+                { "Zone/A", "Zone/B",         "Zone/A" },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                bsl::vector<bsl::string> ids(DATA[ti], DATA[ti] + 3);
+
+                bsl::ostringstream stream;
+                ASSERTV(ti, 0 != Util::writeImage(stream, &loader, ids));
+                ASSERTV(ti, stream.str().empty());
+            }
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<bsl::string> ids;
+            bsl::ostringstream       stream;
+
+            ASSERT_PASS(Util::writeImage(stream, &loader, ids));
+            ASSERT_FAIL(Util::writeImage(stream, 0,       ids));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadTimeZoneIds'
+        //
+        // Concerns:
+        //: 1 'loadTimeZoneIds' loads, in ascending order, the relative paths,
+        //:   using '/' as the separator, of the Zoneinfo binary files of the
+        //:   hierarchy, recursing into subdirectories.
+        //:
+        //: 2 Files that are not Zoneinfo binary files, the top-level "posix"
+        //:   and "right" directories, and symbolic links to directories are
+        //:   excluded, and symbolic links to Zoneinfo binary files are
+        //:   included.
+        //:
+        //: 3 'loadTimeZoneIds' fails if the root path is not a directory.
+        //:
+        //: 4 The previous contents of the result are discarded.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a test Zoneinfo hierarchy, having each kind of file and
+        //:   directory, and compare the result with the expected identifiers.
+        //:   (C-1, 2, 4)
+        //:
+        //: 2 Load the identifiers of a missing directory, and of a file.
+        //:   (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int loadTimeZoneIds(bsl::vector<bsl::string> *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'loadTimeZoneIds'" << endl
+                          << "=========================" << endl;
+
+        const bsl::string ROOT = u::makeFileName("root");
+
+        bsl::vector<bsl::string> EXP_IDS;
+        u::createZoneinfoTree(&EXP_IDS, ROOT);
+
+        {
+            bsl::vector<bsl::string> ids;
+            ids.push_back("Previous");
+
+            ASSERT(0 == Util::loadTimeZoneIds(&ids, ROOT.c_str()));
+            ASSERTV(ids.size(), EXP_IDS == ids);
+
+            if (veryVerbose) {
+                for (bsl::size_t i = 0; i < ids.size(); ++i) {
+                    T_ P(ids[i])
+                }
+            }
+
+            // A trailing separator is accepted.
+
+            ASSERT(0 == Util::loadTimeZoneIds(&ids, (ROOT + "/").c_str()));
+            ASSERTV(ids.size(), EXP_IDS == ids);
+        }
+
+        if (veryVerbose) cout << "\tFailures." << endl;
+        {
+            bsl::vector<bsl::string> ids;
+
+            const bsl::string MISSING = u::makeFileName("missing");
+            ASSERT(0 != Util::loadTimeZoneIds(&ids, MISSING.c_str()));
+
+            const bsl::string FILE = ROOT + "/Indochina";
+            ASSERT(0 != Util::loadTimeZoneIds(&ids, FILE.c_str()));
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<bsl::string> ids;
+            ASSERT_PASS(Util::loadTimeZoneIds(&ids, ROOT.c_str()));
+            ASSERT_FAIL(Util::loadTimeZoneIds(0,    ROOT.c_str()));
+            ASSERT_FAIL(Util::loadTimeZoneIds(&ids, 0));
+        }
+
+        FileUtil::remove(ROOT, true);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The utility is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Compile a test Zoneinfo hierarchy into an image file, and load a
+        //:   time zone from it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::string ROOT       = u::makeFileName("root");
+        const bsl::string IMAGE_FILE = u::makeFileName("breathing.img");
+
+        bsl::vector<bsl::string> EXP_IDS;
+        u::createZoneinfoTree(&EXP_IDS, ROOT);
+
+        ASSERT(0 == Util::writeImageFile(IMAGE_FILE.c_str(), ROOT.c_str()));
+
+        {
+            baltzo::ImageFileLoader loader(&ta);
+            ASSERT(0 == loader.mapImage(IMAGE_FILE.c_str()));
+            ASSERT(static_cast<int>(EXP_IDS.size()) ==
+                                               loader.image().numTimeZones());
+
+            Zone zone(&ta);
+            ASSERT(0 == loader.loadTimeZone(&zone, "Asia/Bangkok"));
+            ASSERT("Asia/Bangkok" == zone.identifier());
+            ASSERT(3 == zone.numTransitions());
+        }
+
+        FileUtil::remove(IMAGE_FILE);
+        FileUtil::remove(ROOT, true);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
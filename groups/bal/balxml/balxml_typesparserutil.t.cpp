@@ -1493,6 +1493,14 @@ int main(int argc, char *argv[])
                 { L_,     "+INFX",     posInf,          },
                 { L_,     "-INFX",     -posInf,         },
                 { L_,     "NaNX",      qNaN             },
+                { L_,     " 1.5X",     1.5              },
+                { L_,     "+1.5X",     1.5              },
+                { L_,     "1e-999X",   0.0              },
+                { L_,     "4.9406564584124654e-324X",
+                                       4.9406564584124654e-324 },
+                { L_,     "0.100000000000000000000000000000000000000000000"
+                          "00000000000000000000000000000000000000000001X",
+                                       0.1              },
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -1516,6 +1524,24 @@ int main(int argc, char *argv[])
                     LOOP2_ASSERT(LINE, X, EXPECTED_RESULT == X);
                 }
             }
+
+            static const char *const INVALID[] = {
+                "", "+-1", "1.5 ", "1e999", "-1e999", "0x1p3", "1.5e"
+            };
+            const int NUM_INVALID = sizeof INVALID / sizeof *INVALID;
+
+            for (int i = 0; i < NUM_INVALID; ++i) {
+                const char *INPUT        = INVALID[i];
+                const int   INPUT_LENGTH =
+                                          static_cast<int>(bsl::strlen(INPUT));
+
+                Type mX = 42;  const Type& X = mX;
+
+                int retCode = Util::parseDefault(&mX, INPUT, INPUT_LENGTH);
+
+                LOOP2_ASSERT(INPUT, retCode, 0 != retCode);
+                LOOP2_ASSERT(INPUT, X, 42 == X);
+            }
         }
 
         if (verbose) cout << "\nUsing 'Decimal64'." << endl;
@@ -16,21 +16,24 @@ BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 #include <bdlde_base64encoder.h>
 #include <bdldfp_decimalutil.h>
 
+#include <bslalg_numericformatterutil.h>
 #include <bsla_fallthrough.h>
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cfloat.h>
-#include <bsl_cstdio.h>
-#include <bsl_cstring.h>
 #include <bsl_iterator.h>
+#include <bsl_string.h>
 
 namespace BloombergLP {
 
 namespace {
 namespace u {
 
+typedef bslalg::NumericFormatterUtil Util;
+
 // HELPER FUNCTIONS
 
 template <class INPUT_ITERATOR>
@@ -599,29 +602,23 @@ bsl::ostream& printDecimalImpl(bsl::ostream& stream,
       } break;
     }
 
+    BSLS_ASSERT(0 < precision);
     BSLS_ASSERT(precision <= DBL_DIG);
 
-    // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-    // 'sprintf', even though the former calls the latter.  Also, note that
-    // 'snprintf' is 15% slower than 'sprintf' on Sun.
+    // Write as 'sprintf' with "%#.*f" would, without depending on the locale.
+    // Since 'precision' is positive, a period is always written.
 
     char buffer[DBL_MAX_10_EXP + DBL_DIG + 4];  // buffer with headroom
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-    // format: "-"  forces left alignment, "#" always prints period
-    const int len = bsl::sprintf(buffer, "%-#1.*f", precision, object);
-    (void)len; BSLS_ASSERT(len < (int) sizeof buffer);
+    char *end = Util::toChars(buffer,
+                              buffer + sizeof buffer,
+                              object,
+                              Util::e_FIXED,
+                              precision);
+    BSLS_ASSERT(end);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
-
-    const char *ptr = bsl::strchr(buffer, '.');
-    BSLS_ASSERT(ptr != 0);
+    const char *ptr = bsl::find(buffer, end, '.');
+    BSLS_ASSERT(ptr != end);
 
     int integralLen = static_cast<int>(ptr - buffer);
 
@@ -637,7 +634,7 @@ bsl::ostream& printDecimalImpl(bsl::ostream& stream,
 
     ++ptr;  // move ptr to the first fraction digit
 
-    int fractionLen = static_cast<int>(bsl::strlen(ptr));
+    int fractionLen = static_cast<int>(end - ptr);
 
     if (fractionLen > maxFractionLen) {
         fractionLen = maxFractionLen;
@@ -670,10 +667,6 @@ bsl::ostream& printDecimalWithOptions(bsl::ostream& stream,
     // Ex: for totalDigits = 4, 65.43, 1234, 1.456 etc Maximum number of
     // fraction digits refers to the digits following the decimal point.
 
-    const int BUF_SIZE = 128;
-    char buffer[BUF_SIZE];
-    bsl::memset(buffer, 0, BUF_SIZE);
-
     if (maxTotalDigits < 2) {
         // At least two digits must be printed one before and one after the
         // decimal.
@@ -691,21 +684,33 @@ bsl::ostream& printDecimalWithOptions(bsl::ostream& stream,
         maxFractionDigits = maxTotalDigits - 1;
     }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-    // format: "-"  forces left alignment, "#" always prints period
-    const int len = bsl::sprintf(buffer, "%-#1.*f", maxFractionDigits, object);
-    (void)len; BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+    // Write as 'sprintf' with "%#.*f" would, without depending on the locale.
+    // Since 'maxFractionDigits' is positive, a period is always written.  The
+    // buffer on the stack is large enough for any 'double' unless more than
+    // 'DBL_DIG' fraction digits are requested.
+
+    char        smallBuffer[DBL_MAX_10_EXP + DBL_DIG + 4];
+    bsl::string largeBuffer;
+    char       *buffer = smallBuffer;
+
+    char *end = Util::toChars(buffer,
+                              buffer + sizeof smallBuffer,
+                              object,
+                              Util::e_FIXED,
+                              maxFractionDigits);
+    if (!end) {
+        largeBuffer.resize(DBL_MAX_10_EXP + maxFractionDigits + 4);
+        buffer = &largeBuffer[0];
+        end    = Util::toChars(buffer,
+                               buffer + largeBuffer.size(),
+                               object,
+                               Util::e_FIXED,
+                               maxFractionDigits);
+        BSLS_ASSERT(end);
+    }
 
-    const char *ptr = bsl::strchr(buffer, '.');
-    BSLS_ASSERT(ptr != 0);
+    const char *ptr = bsl::find(buffer, end, '.');
+    BSLS_ASSERT(ptr != end);
 
     int integralLen = static_cast<int>(ptr - buffer);
     if (object < 0) {
@@ -986,26 +991,19 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Write as 'sprintf' with "%.*g" would, without depending on the
+        // locale.
 
         char buffer[FLT_DIG + 20];  // buffer with headroom
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len =
-                    bsl::sprintf(buffer, "%.*g", FLT_DIG + 1, (double) object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        const char *end = u::Util::toChars(buffer,
+                                           buffer + sizeof buffer,
+                                           object,
+                                           u::Util::e_GENERAL,
+                                           FLT_DIG + 1);
+        BSLS_ASSERT(end);
 
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       } break;
     }
 
@@ -1032,25 +1030,19 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Write as 'sprintf' with "%.*g" would, without depending on the
+        // locale.
 
         char buffer[DBL_DIG + 20];  // buffer with headroom
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len = bsl::sprintf(buffer, "%.*g", DBL_DIG + 1, object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        const char *end = u::Util::toChars(buffer,
+                                           buffer + sizeof buffer,
+                                           object,
+                                           u::Util::e_GENERAL,
+                                           DBL_DIG + 1);
+        BSLS_ASSERT(end);
 
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       } break;
     }
 
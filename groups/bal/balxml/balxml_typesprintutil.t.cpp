@@ -91,16 +91,6 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
-// ============================================================================
-//                   MACROS FOR TESTING WORKAROUNDS
-// ----------------------------------------------------------------------------
-
-#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
-    // 'snprintf' on older Windows libraries outputs an additional '0' in the
-    // exponent for scientific notation.
-# define BALXML_TYPESPRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS 1
-#endif
-
 // ============================================================================
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1179,12 +1169,6 @@ int main(int argc, char *argv[])
         {
             typedef float Type;
 
-#if defined(BALXML_TYPESPRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
-#define ZERO   "0"
-#else
-#define ZERO
-#endif
-
             static const struct {
                 int         d_lineNum;
                 Type        d_input;
@@ -1195,12 +1179,12 @@ int main(int argc, char *argv[])
                 { L_,     -1.0f,          "-1"                            },
                 { L_,     -0.1f,          "-0.1"                          },
                 { L_,     -0.1234567f,    "-0.1234567"                    },
-                { L_,     -1.234567e-35f, "-1.234567e-" ZERO "35"         },
+                { L_,     -1.234567e-35f, "-1.234567e-35"                 },
                 { L_,     0.0f,           "0"                             },
                 { L_,     0.1f,           "0.1"                           },
                 { L_,     1.0f,           "1"                             },
                 { L_,     1234567.0f,     "1234567"                       },
-                { L_,     1.234567e35f,   "1.234567e+" ZERO "35"          },
+                { L_,     1.234567e35f,   "1.234567e+35"                  },
                 { L_,     bsl::numeric_limits<float>::infinity(),
                                           "+INF"                          },
                 { L_,    -bsl::numeric_limits<float>::infinity(),
@@ -1208,7 +1192,6 @@ int main(int argc, char *argv[])
                 { L_,     bsl::numeric_limits<float>::signaling_NaN(),
                                           "NaN"                           },
             };
-#undef ZERO
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
             for (int i = 0; i < NUM_DATA; ++i) {
@@ -5043,6 +5026,16 @@ int main(int argc, char *argv[])
          { L_, 123456789.012345,  19,     7, "123456789.0123450"     },
          { L_, 123456789.012345,  20,     7, "123456789.0123450"     },
 
+         // more digits than fit in a buffer on the stack
+
+         { L_, 1.0e300,          400,    30,
+           "10000000000000000525047602552044202487044685811081591549"
+           "15854115511802457988908195786371375080447864043704443832"
+           "88387817694252323536043057564479218478670698284838720092"
+           "65758037378302337947880900593689532349707999450811190389"
+           "67640880074652742780142494579258788820056842838115669472"
+           "196386865459400540160.000000000000000000000000000000" },
+
          { L_,  bsl::numeric_limits<double>::infinity(), 0, 0, "+INF"},
          { L_, -bsl::numeric_limits<double>::infinity(), 0, 0, "-INF"},
          { L_,  bsl::numeric_limits<double>::signaling_NaN(), 0, 0, "NaN"},
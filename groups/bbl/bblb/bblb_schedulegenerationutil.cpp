@@ -4,15 +4,23 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bblb_schedulegenerationutil_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
 #include <bdlt_calendar.h>
 #include <bdlt_calendarutil.h>
 #include <bdlt_date.h>
 #include <bdlt_dateutil.h>
 #include <bdlt_serialdateimputil.h>
 
+#include <bslmt_latch.h>
+
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
 #include <bsl_cstdlib.h>
 
 namespace BloombergLP {
@@ -230,6 +238,540 @@ int adjustMonthRange(int *startSerialMonth,
     return e_VALID_RANGE;
 }
 
+static
+inline int selectBusinessDay(bsl::uint32_t businessDays, int n)
+    // Return the day of the month of the specified 'n'th business day of a
+    // month whose business days are the set bits of the specified
+    // 'businessDays' (bit 'd - 1' being set if day 'd' is a business day),
+    // counting from the first day of the month if 'n' is positive, and from
+    // the last day of the month otherwise.  If the month has fewer than
+    // 'abs(n)' business days, return the business day furthest from the day
+    // counting starts from.  Return 0 if 'businessDays' is 0.  The behavior
+    // is undefined unless '0 != n'.
+{
+    BSLS_ASSERT(0 != n);
+
+    if (0 == businessDays) {
+        return 0;                                                     // RETURN
+    }
+
+    const int numBusinessDays = bdlb::BitUtil::numBitsSet(businessDays);
+
+    const int index = 0 < n ? bsl::min(n, numBusinessDays)
+                            : bsl::max(numBusinessDays + n + 1, 1);
+
+    for (int i = 1; i < index; ++i) {
+        businessDays &= businessDays - 1;
+    }
+
+    return bdlb::BitUtil::numTrailingUnsetBits(businessDays) + 1;
+}
+
+namespace {
+
+                        // ==========================
+                        // class DayIntervalGenerator
+                        // ==========================
+
+class DayIntervalGenerator {
+    // This class generates the schedules described by an array of
+    // 'ScheduleGenerationUtil::DayIntervalSpec' objects.
+
+    // DATA
+    const ScheduleGenerationUtil::DayIntervalSpec *d_specs_p;  // specs (held,
+                                                               // not owned)
+
+  public:
+    // CREATORS
+    explicit DayIntervalGenerator(
+                        const ScheduleGenerationUtil::DayIntervalSpec *specs);
+        // Create a generator of the schedules described by the specified
+        // 'specs'.
+
+    // ACCESSORS
+    int count(int index) const;
+        // Return the number of dates in the schedule described by the spec
+        // at the specified 'index'.
+
+    void generate(bdlt::Date *schedule, int index) const;
+        // Load, into the 'count(index)' elements of the specified 'schedule'
+        // array, the schedule described by the spec at the specified 'index'.
+};
+
+                     // ==================================
+                     // class BusinessDayOfMonthGenerator
+                     // ==================================
+
+class BusinessDayOfMonthGenerator {
+    // This class generates the schedules described by an array of
+    // 'ScheduleGenerationUtil::BusinessDayOfMonthSpec' objects from the
+    // business days, tabulated on construction, of the months they cover.
+
+    // DATA
+    const ScheduleGenerationUtil::BusinessDayOfMonthSpec
+                               *d_specs_p;            // specs (held, not
+                                                      // owned)
+
+    bsl::vector<bsl::uint32_t>  d_businessDays;       // business days of each
+                                                      // month covered, as bit
+                                                      // masks, or 0 if not
+                                                      // entirely in the range
+                                                      // of the calendar
+
+    int                         d_firstSerialMonth;   // serial month of
+                                                      // 'd_businessDays[0]'
+
+    // PRIVATE ACCESSORS
+    bsl::uint32_t businessDays(int serialMonth) const;
+        // Return the business days of the month having the specified
+        // 'serialMonth'.
+
+    int computeMonths(
+            int                                                 *startMonth,
+            int                                                 *endMonth,
+            const ScheduleGenerationUtil::BusinessDayOfMonthSpec&  spec) const;
+        // Return the number of dates in the schedule described by the
+        // specified 'spec', and load, into the specified 'startMonth' and
+        // 'endMonth', the serial months of its first and last dates if that
+        // number is not 0.
+
+  public:
+    // CREATORS
+    BusinessDayOfMonthGenerator(
+                  const ScheduleGenerationUtil::BusinessDayOfMonthSpec *specs,
+                  int                                                numSpecs,
+                  const bdlt::Calendar&                              calendar);
+        // Create a generator of the schedules described by the specified
+        // 'numSpecs' elements of the specified 'specs' array, tabulating the
+        // business days, according to the specified 'calendar', of the months
+        // those schedules cover.  The behavior is undefined unless
+        // '0 < numSpecs'.
+
+    // ACCESSORS
+    int count(int index) const;
+        // Return the number of dates in the schedule described by the spec
+        // at the specified 'index'.
+
+    void generate(bdlt::Date *schedule, int index) const;
+        // Load, into the 'count(index)' elements of the specified 'schedule'
+        // array, the schedule described by the spec at the specified 'index'.
+};
+
+                          // =====================
+                          // class BatchGeneration
+                          // =====================
+
+template <class GENERATOR>
+class BatchGeneration {
+    // This class implements one pass over the schedules of a batch, which
+    // either counts the dates of each schedule or generates them, by chunks
+    // of consecutive schedules claimed by the threads taking part.
+
+    // PRIVATE TYPES
+    enum { k_CHUNK_SIZE = 256 };  // number of schedules in a chunk
+
+    class Job {
+        // This class runs a pass on a thread of a thread pool.
+
+        // DATA
+        BatchGeneration *d_batch_p;  // pass (held, not owned)
+
+        bslmt::Latch    *d_latch_p;  // latch on which the thread running the
+                                     // pass waits (held, not owned)
+
+      public:
+        // CREATORS
+        Job(BatchGeneration *batch, bslmt::Latch *latch)
+            // Create a job taking part in the specified 'batch', and arriving
+            // at the specified 'latch' when done.
+        : d_batch_p(batch)
+        , d_latch_p(latch)
+        {
+        }
+
+        // ACCESSORS
+        void operator()() const
+            // Process chunks of the batch of this job until none remain, and
+            // arrive at the latch of this job.
+        {
+            d_batch_p->processChunks();
+            d_latch_p->arrive();
+        }
+    };
+
+    // DATA
+    const GENERATOR&  d_generator;   // generator of the schedules
+
+    bsl::size_t      *d_offsets_p;   // offsets of the schedules, whose
+                                     // element 'i + 1' is loaded with the
+                                     // length of schedule 'i' if
+                                     // 'd_schedules_p' is 0
+
+    bdlt::Date       *d_schedules_p; // schedules, or 0 to count them
+
+    int               d_numSpecs;    // number of schedules
+
+    bsls::AtomicInt   d_nextChunk;   // index of the next chunk to process
+
+    // PRIVATE MANIPULATORS
+    void processChunks();
+        // Process chunks of this batch until none remain.
+
+  public:
+    // CREATORS
+    BatchGeneration(const GENERATOR&  generator,
+                    bsl::size_t      *offsets,
+                    bdlt::Date       *schedules,
+                    int               numSpecs);
+        // Create a pass over the specified 'numSpecs' schedules of the
+        // specified 'generator' that loads, into each element 'i + 1' of the
+        // specified 'offsets' array, the length of schedule 'i' if the
+        // specified 'schedules' is 0, and otherwise loads each schedule 'i'
+        // into 'schedules' at index 'offsets[i]'.
+
+    // MANIPULATORS
+    void run(bdlmt::FixedThreadPool *threadPool);
+        // Run this pass on the calling thread and, if the specified
+        // 'threadPool' is not 0, on threads of 'threadPool', and return once
+        // the pass is complete.
+};
+
+                        // --------------------------
+                        // class DayIntervalGenerator
+                        // --------------------------
+
+// CREATORS
+DayIntervalGenerator::DayIntervalGenerator(
+                          const ScheduleGenerationUtil::DayIntervalSpec *specs)
+: d_specs_p(specs)
+{
+}
+
+// ACCESSORS
+int DayIntervalGenerator::count(int index) const
+{
+    const ScheduleGenerationUtil::DayIntervalSpec& spec = d_specs_p[index];
+
+    BSLS_ASSERT(spec.d_earliest <= spec.d_latest);
+    BSLS_ASSERT(1 <= spec.d_intervalInDays);
+
+    const int startCount = rationalCeiling(spec.d_earliest - spec.d_example,
+                                           spec.d_intervalInDays);
+    const int endCount   = rationalFloor(spec.d_latest - spec.d_example,
+                                         spec.d_intervalInDays);
+
+    return startCount <= endCount ? endCount - startCount + 1 : 0;
+}
+
+void DayIntervalGenerator::generate(bdlt::Date *schedule, int index) const
+{
+    const ScheduleGenerationUtil::DayIntervalSpec& spec = d_specs_p[index];
+
+    const int startCount = rationalCeiling(spec.d_earliest - spec.d_example,
+                                           spec.d_intervalInDays);
+    const int endCount   = rationalFloor(spec.d_latest - spec.d_example,
+                                         spec.d_intervalInDays);
+
+    for (int i = startCount; i <= endCount; ++i) {
+        *schedule++ = spec.d_example + spec.d_intervalInDays * i;
+    }
+}
+
+                     // ---------------------------------
+                     // class BusinessDayOfMonthGenerator
+                     // ---------------------------------
+
+// PRIVATE ACCESSORS
+inline
+bsl::uint32_t BusinessDayOfMonthGenerator::businessDays(int serialMonth) const
+{
+    BSLS_ASSERT(d_firstSerialMonth <= serialMonth);
+    BSLS_ASSERT(serialMonth - d_firstSerialMonth <
+                                      static_cast<int>(d_businessDays.size()));
+
+    return d_businessDays[serialMonth - d_firstSerialMonth];
+}
+
+int BusinessDayOfMonthGenerator::computeMonths(
+             int                                                 *startMonth,
+             int                                                 *endMonth,
+             const ScheduleGenerationUtil::BusinessDayOfMonthSpec&  spec) const
+{
+    int earliestSerialMonth;
+    int earliestDay;
+    computeSerialMonthAndDay(&earliestSerialMonth,
+                             &earliestDay,
+                             spec.d_earliest);
+
+    int latestSerialMonth;
+    int latestDay;
+    computeSerialMonthAndDay(&latestSerialMonth, &latestDay, spec.d_latest);
+
+    int startSerialMonth;
+    int endSerialMonth;
+
+    if (computeMonthRange(&startSerialMonth,
+                          &endSerialMonth,
+                          earliestSerialMonth,
+                          latestSerialMonth,
+                          YM2SERIAL(spec.d_exampleYear, spec.d_exampleMonth),
+                          spec.d_intervalInMonths)
+     || startSerialMonth > endSerialMonth) {
+        return 0;                                                     // RETURN
+    }
+
+    // The months of the schedule are now within the tabulated range.
+
+    const int startDay = selectBusinessDay(businessDays(startSerialMonth),
+                                           spec.d_targetBusinessDayOfMonth);
+    const int endDay   = selectBusinessDay(businessDays(endSerialMonth),
+                                           spec.d_targetBusinessDayOfMonth);
+
+    if (0 == startDay
+     || 0 == endDay
+     || adjustMonthRange(&startSerialMonth,
+                         &endSerialMonth,
+                         startDay,
+                         endDay,
+                         earliestDay,
+                         latestDay,
+                         earliestSerialMonth,
+                         latestSerialMonth,
+                         spec.d_intervalInMonths)
+     || startSerialMonth > endSerialMonth) {
+        return 0;                                                     // RETURN
+    }
+
+    // As for the single-schedule function, the schedule is empty if any of
+    // its months has no business day.
+
+    for (int sm = startSerialMonth;
+         sm <= endSerialMonth;
+         sm += spec.d_intervalInMonths) {
+        if (0 == businessDays(sm)) {
+            return 0;                                                 // RETURN
+        }
+    }
+
+    *startMonth = startSerialMonth;
+    *endMonth   = endSerialMonth;
+
+    return (endSerialMonth - startSerialMonth) / spec.d_intervalInMonths + 1;
+}
+
+// CREATORS
+BusinessDayOfMonthGenerator::BusinessDayOfMonthGenerator(
+                 const ScheduleGenerationUtil::BusinessDayOfMonthSpec *specs,
+                 int                                                 numSpecs,
+                 const bdlt::Calendar&                               calendar)
+: d_specs_p(specs)
+, d_businessDays()
+, d_firstSerialMonth(0)
+{
+    BSLS_ASSERT(specs);
+    BSLS_ASSERT(0 < numSpecs);
+
+    int firstSerialMonth = k_MAX_SERIAL_MONTH;
+    int lastSerialMonth  = k_MIN_SERIAL_MONTH;
+
+    for (int i = 0; i < numSpecs; ++i) {
+        int serialMonth;
+        int day;
+
+        computeSerialMonthAndDay(&serialMonth, &day, specs[i].d_earliest);
+        firstSerialMonth = bsl::min(firstSerialMonth, serialMonth);
+
+        computeSerialMonthAndDay(&serialMonth, &day, specs[i].d_latest);
+        lastSerialMonth  = bsl::max(lastSerialMonth, serialMonth);
+    }
+
+    d_firstSerialMonth = firstSerialMonth;
+
+    if (firstSerialMonth > lastSerialMonth) {
+        return;                                                       // RETURN
+    }
+
+    d_businessDays.resize(lastSerialMonth - firstSerialMonth + 1, 0);
+
+    for (int sm = firstSerialMonth; sm <= lastSerialMonth; ++sm) {
+        const int year  = SERIAL2Y(sm);
+        const int month = SERIAL2M(sm);
+
+        const bdlt::Date first(year, month, 1);
+        const bdlt::Date last(year,
+                              month,
+                              bdlt::SerialDateImpUtil::lastDayOfMonth(year,
+                                                                      month));
+
+        if (!calendar.isInRange(first) || !calendar.isInRange(last)) {
+            continue;
+        }
+
+        bsl::uint32_t mask = 0;
+        for (int day = 0; day < last.day(); ++day) {
+            if (calendar.isBusinessDay(first + day)) {
+                mask |= static_cast<bsl::uint32_t>(1) << day;
+            }
+        }
+        d_businessDays[sm - firstSerialMonth] = mask;
+    }
+}
+
+// ACCESSORS
+int BusinessDayOfMonthGenerator::count(int index) const
+{
+    const ScheduleGenerationUtil::BusinessDayOfMonthSpec& spec =
+                                                            d_specs_p[index];
+
+    BSLS_ASSERT(spec.d_earliest <= spec.d_latest);
+    BSLS_ASSERT(1 <= spec.d_intervalInMonths);
+    BSLS_ASSERT(1 <= spec.d_exampleYear  && 9999 >= spec.d_exampleYear);
+    BSLS_ASSERT(1 <= spec.d_exampleMonth &&   12 >= spec.d_exampleMonth);
+    BSLS_ASSERT(   -31 <= spec.d_targetBusinessDayOfMonth
+                &&  31 >= spec.d_targetBusinessDayOfMonth
+                &&   0 != spec.d_targetBusinessDayOfMonth);
+
+    int startSerialMonth;
+    int endSerialMonth;
+
+    return computeMonths(&startSerialMonth, &endSerialMonth, spec);
+}
+
+void BusinessDayOfMonthGenerator::generate(bdlt::Date *schedule,
+                                           int         index) const
+{
+    const ScheduleGenerationUtil::BusinessDayOfMonthSpec& spec =
+                                                            d_specs_p[index];
+
+    int startSerialMonth;
+    int endSerialMonth;
+
+    if (0 == computeMonths(&startSerialMonth, &endSerialMonth, spec)) {
+        return;                                                       // RETURN
+    }
+
+    for (int sm = startSerialMonth;
+         sm <= endSerialMonth;
+         sm += spec.d_intervalInMonths) {
+        *schedule++ = bdlt::Date(
+                          SERIAL2Y(sm),
+                          SERIAL2M(sm),
+                          selectBusinessDay(businessDays(sm),
+                                            spec.d_targetBusinessDayOfMonth));
+    }
+}
+
+                          // ---------------------
+                          // class BatchGeneration
+                          // ---------------------
+
+// PRIVATE MANIPULATORS
+template <class GENERATOR>
+void BatchGeneration<GENERATOR>::processChunks()
+{
+    for (;;) {
+        const int begin = (d_nextChunk++) * k_CHUNK_SIZE;
+        if (begin >= d_numSpecs) {
+            return;                                                   // RETURN
+        }
+        const int end = bsl::min(begin + k_CHUNK_SIZE, d_numSpecs);
+
+        if (0 == d_schedules_p) {
+            for (int i = begin; i < end; ++i) {
+                d_offsets_p[i + 1] = d_generator.count(i);
+            }
+        }
+        else {
+            for (int i = begin; i < end; ++i) {
+                d_generator.generate(d_schedules_p + d_offsets_p[i], i);
+            }
+        }
+    }
+}
+
+// CREATORS
+template <class GENERATOR>
+BatchGeneration<GENERATOR>::BatchGeneration(const GENERATOR&  generator,
+                                            bsl::size_t      *offsets,
+                                            bdlt::Date       *schedules,
+                                            int               numSpecs)
+: d_generator(generator)
+, d_offsets_p(offsets)
+, d_schedules_p(schedules)
+, d_numSpecs(numSpecs)
+, d_nextChunk(0)
+{
+}
+
+// MANIPULATORS
+template <class GENERATOR>
+void BatchGeneration<GENERATOR>::run(bdlmt::FixedThreadPool *threadPool)
+{
+    const int numChunks = (d_numSpecs + k_CHUNK_SIZE - 1) / k_CHUNK_SIZE;
+
+    // The calling thread processes chunks too, so that one fewer job than
+    // there are chunks is ever useful.
+
+    const int numJobs = threadPool
+                      ? bsl::min(threadPool->numThreads(), numChunks - 1)
+                      : 0;
+
+    if (0 >= numJobs) {
+        processChunks();
+        return;                                                       // RETURN
+    }
+
+    bslmt::Latch latch(numJobs);
+
+    for (int i = 0; i < numJobs; ++i) {
+        if (0 != threadPool->enqueueJob(Job(this, &latch))) {
+            latch.arrive();
+        }
+    }
+
+    processChunks();
+
+    latch.wait();
+}
+
+template <class GENERATOR>
+void generateSchedules(bsl::vector<bdlt::Date>  *schedules,
+                       bsl::vector<bsl::size_t> *offsets,
+                       const GENERATOR&          generator,
+                       int                       numSpecs,
+                       bdlmt::FixedThreadPool   *threadPool)
+    // Load, into the specified 'schedules', the concatenation of the
+    // specified 'numSpecs' schedules of the specified 'generator', and load,
+    // into the specified 'offsets', the index of the first date of each of
+    // those schedules followed by the size of 'schedules', using the threads
+    // of the specified 'threadPool', if not 0, in addition to the calling
+    // thread.
+{
+    offsets->resize(numSpecs + 1);
+    (*offsets)[0] = 0;
+
+    BatchGeneration<GENERATOR>(generator,
+                               offsets->data(),
+                               0,
+                               numSpecs).run(threadPool);
+
+    for (int i = 0; i < numSpecs; ++i) {
+        (*offsets)[i + 1] += (*offsets)[i];
+    }
+
+    schedules->clear();
+    schedules->resize((*offsets)[numSpecs]);
+
+    if (!schedules->empty()) {
+        BatchGeneration<GENERATOR>(generator,
+                                   offsets->data(),
+                                   schedules->data(),
+                                   numSpecs).run(threadPool);
+    }
+}
+
+}  // close unnamed namespace
+
                       // -----------------------------
                       // struct ScheduleGenerationUtil
                       // -----------------------------
@@ -257,6 +799,25 @@ void ScheduleGenerationUtil::generateFromDayInterval(
     }
 }
 
+void ScheduleGenerationUtil::generateFromDayInterval(
+                                     bsl::vector<bdlt::Date>  *schedules,
+                                     bsl::vector<bsl::size_t> *offsets,
+                                     const DayIntervalSpec    *specs,
+                                     int                       numSpecs,
+                                     bdlmt::FixedThreadPool   *threadPool)
+{
+    BSLS_ASSERT(schedules);
+    BSLS_ASSERT(offsets);
+    BSLS_ASSERT(specs || 0 == numSpecs);
+    BSLS_ASSERT(0 <= numSpecs);
+
+    generateSchedules(schedules,
+                      offsets,
+                      DayIntervalGenerator(specs),
+                      numSpecs,
+                      threadPool);
+}
+
 void ScheduleGenerationUtil::generateFromDayOfMonth(
                                      bsl::vector<bdlt::Date> *schedule,
                                      const bdlt::Date&        earliest,
@@ -449,6 +1010,32 @@ void ScheduleGenerationUtil::generateFromBusinessDayOfMonth(
     }
 }
 
+void ScheduleGenerationUtil::generateFromBusinessDayOfMonth(
+                                 bsl::vector<bdlt::Date>      *schedules,
+                                 bsl::vector<bsl::size_t>     *offsets,
+                                 const BusinessDayOfMonthSpec *specs,
+                                 int                           numSpecs,
+                                 const bdlt::Calendar&         calendar,
+                                 bdlmt::FixedThreadPool       *threadPool)
+{
+    BSLS_ASSERT(schedules);
+    BSLS_ASSERT(offsets);
+    BSLS_ASSERT(specs || 0 == numSpecs);
+    BSLS_ASSERT(0 <= numSpecs);
+
+    if (0 == numSpecs) {
+        schedules->clear();
+        offsets->assign(1, 0);
+        return;                                                       // RETURN
+    }
+
+    generateSchedules(schedules,
+                      offsets,
+                      BusinessDayOfMonthGenerator(specs, numSpecs, calendar),
+                      numSpecs,
+                      threadPool);
+}
+
 void ScheduleGenerationUtil::generateFromDayOfWeekAfterDayOfMonth(
                                      bsl::vector<bdlt::Date> *schedule,
                                      const bdlt::Date&        earliest,
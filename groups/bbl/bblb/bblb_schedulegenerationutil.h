@@ -73,6 +73,28 @@ BSLS_IDENT("$Id: $")
 //                                          the month.
 //..
 //
+///Generating Many Schedules
+///-------------------------
+// 'generateFromDayInterval' and 'generateFromBusinessDayOfMonth' are also
+// overloaded to generate, in one call, the schedules of many instruments (for
+// example, those of a portfolio).  Each schedule is described by a
+// 'DayIntervalSpec' or a 'BusinessDayOfMonthSpec', whose members are the
+// arguments of the corresponding single-schedule function.  The schedules are
+// loaded, one after the other, into a single 'bsl::vector<bdlt::Date>', and
+// the index of the first date of each schedule is loaded into a second vector
+// of "offsets", having one more element than there are schedules, so that
+// the dates of the schedule described by 'specs[i]' are the elements of the
+// half-open range '[offsets[i], offsets[i + 1])'.
+//
+// Each date of a schedule is computed directly, and the output is allocated
+// once, after the lengths of all schedules have been computed.  Generating
+// schedules from business days of the month first tabulates, for each month
+// covered by any of the schedules, the set of business days of the month (as
+// a bit mask), so that each date is then selected from a bit mask rather than
+// found by querying the calendar.  Optionally, the schedules can be generated
+// by the threads of a 'bdlmt::FixedThreadPool' (in addition to the calling
+// thread); since the schedules are independent, the result is the same.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -112,6 +134,60 @@ BSLS_IDENT("$Id: $")
 //  assert(bdlt::Date(2014,  4, 23) == schedule[2]);
 //  assert(bdlt::Date(2015,  1, 23) == schedule[3]);
 //..
+//
+///Example 2: Generating the Schedules of a Portfolio
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we hold two instruments paying coupons on the second business
+// day of every third month and on the last business day of every sixth month,
+// respectively, and want their coupon dates in 2013.
+//
+// First, we define a calendar having Saturdays and Sundays as weekend days:
+//..
+//  bdlt::Calendar calendar;
+//  calendar.setValidRange(bdlt::Date(2012, 1, 1), bdlt::Date(2014, 12, 31));
+//  calendar.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+//  calendar.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+//..
+// Then, we describe the two schedules, both taking January 2013 as the
+// example month:
+//..
+//  typedef bblb::ScheduleGenerationUtil::BusinessDayOfMonthSpec Spec;
+//
+//  const Spec specs[] = {
+//      // earliest, latest, example year and month, interval in months, and
+//      // business day of the month
+//
+//      { bdlt::Date(2013, 1, 1), bdlt::Date(2013, 12, 31), 2013, 1, 3,  2 },
+//      { bdlt::Date(2013, 1, 1), bdlt::Date(2013, 12, 31), 2013, 1, 6, -1 }
+//  };
+//..
+// Next, we generate both schedules in one call:
+//..
+//  bsl::vector<bdlt::Date>  schedules;
+//  bsl::vector<bsl::size_t> offsets;
+//
+//  bblb::ScheduleGenerationUtil::generateFromBusinessDayOfMonth(&schedules,
+//                                                               &offsets,
+//                                                               specs,
+//                                                               2,
+//                                                               calendar);
+//..
+// Finally, we verify that the first schedule has four dates and the second
+// schedule two:
+//..
+//  assert(3 == offsets.size());
+//  assert(0 == offsets[0]);
+//  assert(4 == offsets[1]);
+//  assert(6 == offsets[2]);
+//
+//  assert(bdlt::Date(2013,  1,  2) == schedules[0]);
+//  assert(bdlt::Date(2013,  4,  2) == schedules[1]);
+//  assert(bdlt::Date(2013,  7,  2) == schedules[2]);
+//  assert(bdlt::Date(2013, 10,  2) == schedules[3]);
+//
+//  assert(bdlt::Date(2013,  1, 31) == schedules[4]);
+//  assert(bdlt::Date(2013,  7, 31) == schedules[5]);
+//..
 
 #include <bblscm_version.h>
 
@@ -119,9 +195,11 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_date.h>
 #include <bdlt_dayofweek.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
+namespace bdlmt { class FixedThreadPool; }
 namespace bblb {
 
                       // =============================
@@ -132,6 +210,44 @@ struct ScheduleGenerationUtil {
     // This 'struct' provides a namespace for utility functions that generate
     // schedules.
 
+    // TYPES
+    struct DayIntervalSpec {
+        // This 'struct' describes a schedule generated by
+        // 'generateFromDayInterval'.
+
+        bdlt::Date d_earliest;        // earliest date of the schedule
+
+        bdlt::Date d_latest;          // latest date of the schedule
+
+        bdlt::Date d_example;         // date from which the dates of the
+                                      // schedule are integral multiples of
+                                      // 'd_intervalInDays' away
+
+        int        d_intervalInDays;  // number of days between dates
+    };
+
+    struct BusinessDayOfMonthSpec {
+        // This 'struct' describes a schedule generated by
+        // 'generateFromBusinessDayOfMonth'.
+
+        bdlt::Date d_earliest;                  // earliest date of the
+                                                // schedule
+
+        bdlt::Date d_latest;                    // latest date of the schedule
+
+        int        d_exampleYear;               // year and month from which
+        int        d_exampleMonth;              // the months of the schedule
+                                                // are integral multiples of
+                                                // 'd_intervalInMonths' away
+
+        int        d_intervalInMonths;          // number of months between
+                                                // dates
+
+        int        d_targetBusinessDayOfMonth;  // business day of the month,
+                                                // counted from the end of the
+                                                // month if negative
+    };
+
     // CLASS METHODS
     static void generateFromDayInterval(
                                       bsl::vector<bdlt::Date> *schedule,
@@ -146,6 +262,26 @@ struct ScheduleGenerationUtil {
         // behavior is undefined unless 'earliest <= latest' and
         // '1 <= intervalInDays'.
 
+    static void generateFromDayInterval(
+                                     bsl::vector<bdlt::Date>  *schedules,
+                                     bsl::vector<bsl::size_t> *offsets,
+                                     const DayIntervalSpec    *specs,
+                                     int                       numSpecs,
+                                     bdlmt::FixedThreadPool   *threadPool = 0);
+        // Load, into the specified 'schedules', the concatenation of the
+        // schedules described by each of the specified 'numSpecs' elements of
+        // the specified 'specs' array, as generated by the single-schedule
+        // 'generateFromDayInterval', and load, into the specified 'offsets',
+        // the 'numSpecs + 1' indices in 'schedules' at which each schedule
+        // begins, followed by the size of 'schedules'.  Optionally specify a
+        // 'threadPool' whose threads also generate schedules; otherwise, all
+        // schedules are generated by the calling thread.  The behavior is
+        // undefined unless '0 <= numSpecs', 'specs' refers to an array having
+        // at least 'numSpecs' elements, each of which satisfies the
+        // preconditions of the single-schedule 'generateFromDayInterval', and,
+        // if 'threadPool' is specified, this function is not called by one of
+        // its threads.  Note that 'specs' may be 0 if 'numSpecs' is 0.
+
     static void generateFromDayOfMonth(
                                   bsl::vector<bdlt::Date> *schedule,
                                   const bdlt::Date&        earliest,
@@ -196,6 +332,28 @@ struct ScheduleGenerationUtil {
         // '1 <= intervalInMonths', and
         // '1 <= abs(targetBusinessDayOfMonth) <= 31'.
 
+    static void generateFromBusinessDayOfMonth(
+                                 bsl::vector<bdlt::Date>      *schedules,
+                                 bsl::vector<bsl::size_t>     *offsets,
+                                 const BusinessDayOfMonthSpec *specs,
+                                 int                           numSpecs,
+                                 const bdlt::Calendar&         calendar,
+                                 bdlmt::FixedThreadPool       *threadPool = 0);
+        // Load, into the specified 'schedules', the concatenation of the
+        // schedules described by each of the specified 'numSpecs' elements of
+        // the specified 'specs' array, as generated, using the specified
+        // 'calendar', by the single-schedule 'generateFromBusinessDayOfMonth',
+        // and load, into the specified 'offsets', the 'numSpecs + 1' indices
+        // in 'schedules' at which each schedule begins, followed by the size
+        // of 'schedules'.  Optionally specify a 'threadPool' whose threads
+        // also generate schedules; otherwise, all schedules are generated by
+        // the calling thread.  The behavior is undefined unless
+        // '0 <= numSpecs', 'specs' refers to an array having at least
+        // 'numSpecs' elements, each of which satisfies the preconditions of
+        // the single-schedule 'generateFromBusinessDayOfMonth', and, if
+        // 'threadPool' is specified, this function is not called by one of its
+        // threads.  Note that 'specs' may be 0 if 'numSpecs' is 0.
+
     static void generateFromDayOfWeekAfterDayOfMonth(
                                      bsl::vector<bdlt::Date> *schedule,
                                      const bdlt::Date&        earliest,
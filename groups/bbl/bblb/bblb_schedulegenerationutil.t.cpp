@@ -1,6 +1,8 @@
 // bblb_schedulegenerationutil.t.cpp                                  -*-C++-*-
 #include <bblb_schedulegenerationutil.h>
 
+#include <bdlmt_fixedthreadpool.h>
+
 #include <bdlt_calendar.h>
 #include <bdlt_calendarloader.h>
 #include <bdlt_date.h>
@@ -17,6 +19,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
@@ -37,6 +40,8 @@ using namespace bsl;
 // provide a way to generate an infinite series of dates and compute a subset
 // of it.  The general plan is that the methods are tested against a set of
 // tabulated test vectors, and negative tests for preconditions are conducted.
+// The methods generating many schedules at once are tested against the methods
+// generating a single schedule.
 // The test vectors cover the permutations of interest of relations of the type
 // 'earliest <= example <= latest' as well as edge cases for the resulting
 // schedule.
@@ -46,8 +51,10 @@ using namespace bsl;
 // [ 4] generateFromBusinessDayOfMonth(s, e, l, c, eY, eM, i, tBDOM);
 // [ 5] generateFromDayOfWeekAfterDayOfMonth(s, e, l, d, eY, eM, i, DOM);
 // [ 6] generateFromDayOfWeekInMonth(s, e, l, d, eY, eM, i, oW);
+// [ 7] generateFromDayInterval(ss, os, specs, n, pool);
+// [ 7] generateFromBusinessDayOfMonth(ss, os, specs, n, c, pool);
 // ----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [ 1] toString(output, date)
 // ----------------------------------------------------------------------------
 
@@ -215,7 +222,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -275,6 +282,319 @@ int main(int argc, char *argv[])
     ASSERT(bdlt::Date(2014,  4, 23) == schedule[2]);
     ASSERT(bdlt::Date(2015,  1, 23) == schedule[3]);
 //..
+//
+///Example 2: Generating the Schedules of a Portfolio
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we hold two instruments paying coupons on the second business
+// day of every third month and on the last business day of every sixth month,
+// respectively, and want their coupon dates in 2013.
+//
+// First, we define a calendar having Saturdays and Sundays as weekend days:
+//..
+    bdlt::Calendar calendar;
+    calendar.setValidRange(bdlt::Date(2012, 1, 1), bdlt::Date(2014, 12, 31));
+    calendar.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+    calendar.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+//..
+// Then, we describe the two schedules, both taking January 2013 as the
+// example month:
+//..
+    typedef bblb::ScheduleGenerationUtil::BusinessDayOfMonthSpec Spec;
+
+    const Spec specs[] = {
+        // earliest, latest, example year and month, interval in months, and
+        // business day of the month
+
+        { bdlt::Date(2013, 1, 1), bdlt::Date(2013, 12, 31), 2013, 1, 3,  2 },
+        { bdlt::Date(2013, 1, 1), bdlt::Date(2013, 12, 31), 2013, 1, 6, -1 }
+    };
+//..
+// Next, we generate both schedules in one call:
+//..
+    bsl::vector<bdlt::Date>  schedules;
+    bsl::vector<bsl::size_t> offsets;
+
+    bblb::ScheduleGenerationUtil::generateFromBusinessDayOfMonth(&schedules,
+                                                                 &offsets,
+                                                                 specs,
+                                                                 2,
+                                                                 calendar);
+//..
+// Finally, we verify that the first schedule has four dates and the second
+// schedule two:
+//..
+    ASSERT(3 == offsets.size());
+    ASSERT(0 == offsets[0]);
+    ASSERT(4 == offsets[1]);
+    ASSERT(6 == offsets[2]);
+
+    ASSERT(bdlt::Date(2013,  1,  2) == schedules[0]);
+    ASSERT(bdlt::Date(2013,  4,  2) == schedules[1]);
+    ASSERT(bdlt::Date(2013,  7,  2) == schedules[2]);
+    ASSERT(bdlt::Date(2013, 10,  2) == schedules[3]);
+
+    ASSERT(bdlt::Date(2013,  1, 31) == schedules[4]);
+    ASSERT(bdlt::Date(2013,  7, 31) == schedules[5]);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH GENERATION
+        //
+        // Concerns:
+        //: 1 Each schedule generated by the batch methods is the schedule
+        //:   generated by the corresponding single-schedule method, and the
+        //:   offsets delimit the schedules in order.
+        //:
+        //: 2 The result is the same whether or not a thread pool is supplied.
+        //:
+        //: 3 Schedules covering months outside the valid range of the
+        //:   calendar, or months without business days, are empty.
+        //:
+        //: 4 Generating zero schedules yields a single zero offset.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Generate pseudo-random specifications, including ranges partly
+        //:   outside the valid range of the calendars, and compare the result
+        //:   of the batch methods, invoked with and without a thread pool,
+        //:   with the result of the single-schedule methods.  (C-1..3)
+        //:
+        //: 2 Invoke the batch methods with no specifications.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-5)
+        //
+        // Testing:
+        //   generateFromDayInterval(ss, os, specs, n, pool);
+        //   generateFromBusinessDayOfMonth(ss, os, specs, n, c, pool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH GENERATION" << endl
+                          << "========================" << endl;
+
+        typedef Obj::DayIntervalSpec        DISpec;
+        typedef Obj::BusinessDayOfMonthSpec BDSpec;
+
+        bdlt::PackedCalendar weekendsAndHolidays;
+        bdlt::PackedCalendar noBusinessDays(bdlt::Date(2000, 1, 1),
+                                            bdlt::Date(2020, 1, 1));
+        bdlt::PackedCalendar noLateBusinessDays(bdlt::Date(2000, 1, 1),
+                                                bdlt::Date(2020, 1, 1));
+
+        TestCalendarLoader loader;
+        loader.load(&weekendsAndHolidays, "");
+
+        {
+            bdlt::DayOfWeekSet dows;
+
+            for (int d = 1; d <= 7; ++d) {
+                noBusinessDays.addWeekendDay(
+                                    static_cast<bdlt::DayOfWeek::Enum>(d));
+                dows.add(static_cast<bdlt::DayOfWeek::Enum>(d));
+            }
+            noLateBusinessDays.addWeekendDay(DAY(SAT));
+            noLateBusinessDays.addWeekendDay(DAY(SUN));
+            noLateBusinessDays.addWeekendDaysTransition(
+                                                 bdlt::Date(2016, 6, 1), dows);
+        }
+
+        const bdlt::Calendar CALENDARS[] = {
+            bdlt::Calendar(weekendsAndHolidays),
+            bdlt::Calendar(noBusinessDays),
+            bdlt::Calendar(noLateBusinessDays)
+        };
+        const int NUM_CALENDARS = sizeof CALENDARS / sizeof *CALENDARS;
+
+        const int NUM_SPECS = 1000;
+
+        const bdlt::Date BASE(1998, 1, 1);  // 1998 to 2022 covers the valid
+                                            // range of the calendars
+
+        bsl::srand(1);
+
+        bsl::vector<DISpec> diSpecs(NUM_SPECS);
+        bsl::vector<BDSpec> bdSpecs(NUM_SPECS);
+
+        for (int i = 0; i < NUM_SPECS; ++i) {
+            const bdlt::Date earliest = BASE + bsl::rand() % (25 * 365);
+            const bdlt::Date latest   = earliest + bsl::rand() % (6 * 365);
+
+            DISpec& di = diSpecs[i];
+            di.d_earliest       = earliest;
+            di.d_latest         = latest;
+            di.d_example        = BASE + bsl::rand() % (30 * 365);
+            di.d_intervalInDays = 1 + bsl::rand() % 100;
+
+            const int target = 1 + bsl::rand() % 31;
+
+            BDSpec& bd = bdSpecs[i];
+            bd.d_earliest                 = earliest;
+            bd.d_latest                   = latest;
+            bd.d_exampleYear              = 1990 + bsl::rand() % 40;
+            bd.d_exampleMonth             = 1 + bsl::rand() % 12;
+            bd.d_intervalInMonths         = 1 + bsl::rand() % 12;
+            bd.d_targetBusinessDayOfMonth = bsl::rand() % 2 ? target
+                                                            : -target;
+        }
+
+        bdlmt::FixedThreadPool pool(4, 16);
+        ASSERT(0 == pool.start());
+
+        for (int withPool = 0; withPool < 2; ++withPool) {
+            bdlmt::FixedThreadPool *pool_p = withPool ? &pool : 0;
+
+            if (veryVerbose) { T_ P(withPool) }
+
+            bsl::vector<bdlt::Date>  schedules;
+            bsl::vector<bsl::size_t> offsets;
+            bsl::vector<bdlt::Date>  expected;
+
+            Obj::generateFromDayInterval(&schedules,
+                                         &offsets,
+                                         diSpecs.data(),
+                                         NUM_SPECS,
+                                         pool_p);
+
+            ASSERTV(withPool, NUM_SPECS + 1 == offsets.size());
+            ASSERTV(withPool, 0 == offsets.front());
+            ASSERTV(withPool, schedules.size() == offsets.back());
+
+            for (int i = 0; i < NUM_SPECS; ++i) {
+                const DISpec& SPEC = diSpecs[i];
+
+                Obj::generateFromDayInterval(&expected,
+                                             SPEC.d_earliest,
+                                             SPEC.d_latest,
+                                             SPEC.d_example,
+                                             SPEC.d_intervalInDays);
+
+                ASSERTV(withPool, i, offsets[i] <= offsets[i + 1]);
+                ASSERTV(withPool, i, expected.size(),
+                        expected.size() == offsets[i + 1] - offsets[i]);
+
+                if (expected.size() == offsets[i + 1] - offsets[i]) {
+                    for (bsl::size_t j = 0; j < expected.size(); ++j) {
+                        ASSERTV(withPool, i, j,
+                                expected[j] == schedules[offsets[i] + j]);
+                    }
+                }
+            }
+
+            for (int ci = 0; ci < NUM_CALENDARS; ++ci) {
+                const bdlt::Calendar& CALENDAR = CALENDARS[ci];
+
+                if (veryVerbose) { T_ T_ P(ci) }
+
+                Obj::generateFromBusinessDayOfMonth(&schedules,
+                                                    &offsets,
+                                                    bdSpecs.data(),
+                                                    NUM_SPECS,
+                                                    CALENDAR,
+                                                    pool_p);
+
+                ASSERTV(withPool, ci, NUM_SPECS + 1 == offsets.size());
+                ASSERTV(withPool, ci, 0 == offsets.front());
+                ASSERTV(withPool, ci, schedules.size() == offsets.back());
+
+                for (int i = 0; i < NUM_SPECS; ++i) {
+                    const BDSpec& SPEC = bdSpecs[i];
+
+                    Obj::generateFromBusinessDayOfMonth(
+                                           &expected,
+                                           SPEC.d_earliest,
+                                           SPEC.d_latest,
+                                           SPEC.d_exampleYear,
+                                           SPEC.d_exampleMonth,
+                                           SPEC.d_intervalInMonths,
+                                           CALENDAR,
+                                           SPEC.d_targetBusinessDayOfMonth);
+
+                    ASSERTV(withPool, ci, i, offsets[i] <= offsets[i + 1]);
+                    ASSERTV(withPool, ci, i, expected.size(),
+                            expected.size() == offsets[i + 1] - offsets[i]);
+
+                    if (expected.size() == offsets[i + 1] - offsets[i]) {
+                        for (bsl::size_t j = 0; j < expected.size(); ++j) {
+                            ASSERTV(withPool, ci, i, j,
+                                    expected[j] == schedules[offsets[i] + j]);
+                        }
+                    }
+                }
+            }
+
+            // no specifications
+
+            schedules.assign(3, bdlt::Date());
+            offsets.assign(3, 7);
+
+            Obj::generateFromDayInterval(&schedules, &offsets, 0, 0, pool_p);
+
+            ASSERTV(withPool, schedules.empty());
+            ASSERTV(withPool, 1 == offsets.size() && 0 == offsets[0]);
+
+            schedules.assign(3, bdlt::Date());
+            offsets.assign(3, 7);
+
+            Obj::generateFromBusinessDayOfMonth(&schedules,
+                                                &offsets,
+                                                0,
+                                                0,
+                                                CALENDARS[0],
+                                                pool_p);
+
+            ASSERTV(withPool, schedules.empty());
+            ASSERTV(withPool, 1 == offsets.size() && 0 == offsets[0]);
+        }
+
+        pool.stop();
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<bdlt::Date>  s;
+            bsl::vector<bsl::size_t> o;
+
+            DISpec di = { bdlt::Date(2000, 1, 1),
+                          bdlt::Date(2000, 12, 31),
+                          bdlt::Date(2000, 1, 1),
+                          7 };
+            BDSpec bd = { bdlt::Date(2000, 1, 1),
+                          bdlt::Date(2000, 12, 31),
+                          2000,
+                          1,
+                          1,
+                          1 };
+
+            const bdlt::Calendar& C = CALENDARS[0];
+
+            ASSERT_PASS(Obj::generateFromDayInterval(&s, &o, &di,  1));
+            ASSERT_FAIL(Obj::generateFromDayInterval( 0, &o, &di,  1));
+            ASSERT_FAIL(Obj::generateFromDayInterval(&s,  0, &di,  1));
+            ASSERT_FAIL(Obj::generateFromDayInterval(&s, &o, &di, -1));
+            ASSERT_FAIL(Obj::generateFromDayInterval(&s, &o,   0,  1));
+
+            di.d_intervalInDays = 0;
+            ASSERT_FAIL(Obj::generateFromDayInterval(&s, &o, &di,  1));
+
+            ASSERT_PASS(Obj::generateFromBusinessDayOfMonth(&s, &o, &bd,  1,
+                                                            C));
+            ASSERT_FAIL(Obj::generateFromBusinessDayOfMonth( 0, &o, &bd,  1,
+                                                            C));
+            ASSERT_FAIL(Obj::generateFromBusinessDayOfMonth(&s,  0, &bd,  1,
+                                                            C));
+            ASSERT_FAIL(Obj::generateFromBusinessDayOfMonth(&s, &o, &bd, -1,
+                                                            C));
+            ASSERT_FAIL(Obj::generateFromBusinessDayOfMonth(&s, &o,   0,  1,
+                                                            C));
+
+            bd.d_intervalInMonths = 0;
+            ASSERT_FAIL(Obj::generateFromBusinessDayOfMonth(&s, &o, &bd,  1,
+                                                            C));
+        }
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -1100,6 +1420,109 @@ int main(int argc, char *argv[])
         toString(&output, date);
         ASSERTV(output.str(), output.str() == "");
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BATCH GENERATION
+        //
+        // Concerns:
+        //: 1 Generating the schedules of many instruments in one call is
+        //:   faster than generating them one at a time.
+        //
+        // Plan:
+        //: 1 Time the generation of the quarterly business-day schedules of
+        //:   100,000 instruments using the single-schedule method, the batch
+        //:   method, and the batch method with a thread pool.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BATCH GENERATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: BATCH GENERATION" << endl
+                          << "=============================" << endl;
+
+        typedef Obj::BusinessDayOfMonthSpec BDSpec;
+
+        const int NUM_SPECS = 100000;
+
+        bdlt::PackedCalendar packedCalendar;
+        TestCalendarLoader   loader;
+        loader.load(&packedCalendar, "");
+
+        const bdlt::Calendar calendar(packedCalendar);
+
+        bsl::vector<BDSpec> specs(NUM_SPECS);
+        for (int i = 0; i < NUM_SPECS; ++i) {
+            BDSpec& spec = specs[i];
+
+            spec.d_earliest                 = bdlt::Date(2001, 1, 1) + i % 365;
+            spec.d_latest                   = spec.d_earliest + 10 * 365;
+            spec.d_exampleYear              = 2001;
+            spec.d_exampleMonth             = 1 + i % 12;
+            spec.d_intervalInMonths         = 3;
+            spec.d_targetBusinessDayOfMonth = i % 2 ? 1 + i % 5 : -1;
+        }
+
+        bsl::vector<bdlt::Date>  schedule;
+        bsl::vector<bdlt::Date>  schedules;
+        bsl::vector<bsl::size_t> offsets;
+
+        bsls::Stopwatch timer;
+
+        bsl::size_t numDates = 0;
+
+        timer.start();
+        for (int i = 0; i < NUM_SPECS; ++i) {
+            const BDSpec& SPEC = specs[i];
+
+            Obj::generateFromBusinessDayOfMonth(
+                                              &schedule,
+                                              SPEC.d_earliest,
+                                              SPEC.d_latest,
+                                              SPEC.d_exampleYear,
+                                              SPEC.d_exampleMonth,
+                                              SPEC.d_intervalInMonths,
+                                              calendar,
+                                              SPEC.d_targetBusinessDayOfMonth);
+            numDates += schedule.size();
+        }
+        timer.stop();
+
+        cout << "single-schedule:   " << timer.elapsedTime() << "s ("
+             << numDates << " dates)" << endl;
+
+        timer.reset();
+        timer.start();
+        Obj::generateFromBusinessDayOfMonth(&schedules,
+                                            &offsets,
+                                            specs.data(),
+                                            NUM_SPECS,
+                                            calendar);
+        timer.stop();
+
+        ASSERT(numDates == schedules.size());
+
+        cout << "batch:             " << timer.elapsedTime() << "s" << endl;
+
+        bdlmt::FixedThreadPool pool(4, 16);
+        ASSERT(0 == pool.start());
+
+        timer.reset();
+        timer.start();
+        Obj::generateFromBusinessDayOfMonth(&schedules,
+                                            &offsets,
+                                            specs.data(),
+                                            NUM_SPECS,
+                                            calendar,
+                                            &pool);
+        timer.stop();
+
+        pool.stop();
+
+        ASSERT(numDates == schedules.size());
+
+        cout << "batch (4 threads): " << timer.elapsedTime() << "s" << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
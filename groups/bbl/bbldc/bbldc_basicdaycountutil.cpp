@@ -20,6 +20,69 @@ BSLS_IDENT_RCSID(bbldc_basicdaycountutil_cpp,"$Id$ $CSID$")
 
 namespace BloombergLP {
 namespace bbldc {
+namespace {
+
+template <class CONVENTION>
+void loadDaysDiffs(int              *results,
+                   const bdlt::Date *beginDates,
+                   const bdlt::Date *endDates,
+                   int               numPeriods)
+    // Load, into each of the specified 'numPeriods' elements of the specified
+    // 'results' array, the number of days between the elements at the same
+    // index of the specified 'beginDates' and 'endDates' arrays according to
+    // the (template parameter) 'CONVENTION'.
+{
+    for (int i = 0; i < numPeriods; ++i) {
+        results[i] = CONVENTION::daysDiff(beginDates[i], endDates[i]);
+    }
+}
+
+void loadActualDaysDiffs(int              *results,
+                         const bdlt::Date *beginDates,
+                         const bdlt::Date *endDates,
+                         int               numPeriods)
+    // Load, into each of the specified 'numPeriods' elements of the specified
+    // 'results' array, the actual number of days between the elements at the
+    // same index of the specified 'beginDates' and 'endDates' arrays.
+{
+    for (int i = 0; i < numPeriods; ++i) {
+        results[i] = endDates[i] - beginDates[i];
+    }
+}
+
+template <class CONVENTION>
+void loadYearsDiffs(double           *results,
+                    const bdlt::Date *beginDates,
+                    const bdlt::Date *endDates,
+                    int               numPeriods)
+    // Load, into each of the specified 'numPeriods' elements of the specified
+    // 'results' array, the number of years between the elements at the same
+    // index of the specified 'beginDates' and 'endDates' arrays according to
+    // the (template parameter) 'CONVENTION'.
+{
+    for (int i = 0; i < numPeriods; ++i) {
+        results[i] = CONVENTION::yearsDiff(beginDates[i], endDates[i]);
+    }
+}
+
+void loadActualYearsDiffs(double           *results,
+                          const bdlt::Date *beginDates,
+                          const bdlt::Date *endDates,
+                          int               numPeriods,
+                          double            daysPerYear)
+    // Load, into each of the specified 'numPeriods' elements of the specified
+    // 'results' array, the actual number of days between the elements at the
+    // same index of the specified 'beginDates' and 'endDates' arrays divided
+    // by the specified 'daysPerYear'.  Note that storing each quotient in
+    // 'results' removes any extra precision available in floating-point
+    // registers, so the results match those of the single-period methods.
+{
+    for (int i = 0; i < numPeriods; ++i) {
+        results[i] = (endDates[i] - beginDates[i]) / daysPerYear;
+    }
+}
+
+}  // close unnamed namespace
 
                          // ------------------------
                          // struct BasicDayCountUtil
@@ -69,6 +132,65 @@ int BasicDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
     return numDays;
 }
 
+void BasicDayCountUtil::daysDiff(int                      *results,
+                                 const bdlt::Date         *beginDates,
+                                 const bdlt::Date         *endDates,
+                                 int                       numPeriods,
+                                 DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(results    || 0 == numPeriods);
+    BSLS_ASSERT(beginDates || 0 == numPeriods);
+    BSLS_ASSERT(endDates   || 0 == numPeriods);
+    BSLS_ASSERT(0 <= numPeriods);
+
+    switch (convention) {
+      case DayCountConvention::e_ACTUAL_360:
+      case DayCountConvention::e_ACTUAL_365_FIXED:
+      case DayCountConvention::e_ISDA_ACTUAL_ACTUAL: {
+        loadActualDaysDiffs(results, beginDates, endDates, numPeriods);
+      } break;
+      case DayCountConvention::e_ISDA_30_360_EOM: {
+        loadDaysDiffs<bbldc::TerminatedIsda30360Eom>(results,
+                                                     beginDates,
+                                                     endDates,
+                                                     numPeriods);
+      } break;
+      case DayCountConvention::e_ISMA_30_360: {
+        loadDaysDiffs<bbldc::BasicIsma30360>(results,
+                                             beginDates,
+                                             endDates,
+                                             numPeriods);
+      } break;
+      case DayCountConvention::e_NL_365: {
+        loadDaysDiffs<bbldc::BasicNl365>(results,
+                                         beginDates,
+                                         endDates,
+                                         numPeriods);
+      } break;
+      case DayCountConvention::e_PSA_30_360_EOM: {
+        loadDaysDiffs<bbldc::BasicPsa30360Eom>(results,
+                                               beginDates,
+                                               endDates,
+                                               numPeriods);
+      } break;
+      case DayCountConvention::e_SIA_30_360_EOM: {
+        loadDaysDiffs<bbldc::BasicSia30360Eom>(results,
+                                               beginDates,
+                                               endDates,
+                                               numPeriods);
+      } break;
+      case DayCountConvention::e_SIA_30_360_NEOM: {
+        loadDaysDiffs<bbldc::BasicSia30360Neom>(results,
+                                                beginDates,
+                                                endDates,
+                                                numPeriods);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 bool BasicDayCountUtil::isSupported(DayCountConvention::Enum convention)
 {
     bool rv = true;
@@ -136,6 +258,72 @@ double BasicDayCountUtil::yearsDiff(const bdlt::Date&        beginDate,
     return numYears;
 }
 
+void BasicDayCountUtil::yearsDiff(double                   *results,
+                                  const bdlt::Date         *beginDates,
+                                  const bdlt::Date         *endDates,
+                                  int                       numPeriods,
+                                  DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(results    || 0 == numPeriods);
+    BSLS_ASSERT(beginDates || 0 == numPeriods);
+    BSLS_ASSERT(endDates   || 0 == numPeriods);
+    BSLS_ASSERT(0 <= numPeriods);
+
+    switch (convention) {
+      case DayCountConvention::e_ACTUAL_360: {
+        loadActualYearsDiffs(results, beginDates, endDates, numPeriods, 360.0);
+      } break;
+      case DayCountConvention::e_ACTUAL_365_FIXED: {
+        loadActualYearsDiffs(results, beginDates, endDates, numPeriods, 365.0);
+      } break;
+      case DayCountConvention::e_ISDA_30_360_EOM: {
+        loadYearsDiffs<bbldc::TerminatedIsda30360Eom>(results,
+                                                      beginDates,
+                                                      endDates,
+                                                      numPeriods);
+      } break;
+      case DayCountConvention::e_ISDA_ACTUAL_ACTUAL: {
+        loadYearsDiffs<bbldc::BasicIsdaActualActual>(results,
+                                                     beginDates,
+                                                     endDates,
+                                                     numPeriods);
+      } break;
+      case DayCountConvention::e_ISMA_30_360: {
+        loadYearsDiffs<bbldc::BasicIsma30360>(results,
+                                              beginDates,
+                                              endDates,
+                                              numPeriods);
+      } break;
+      case DayCountConvention::e_NL_365: {
+        loadYearsDiffs<bbldc::BasicNl365>(results,
+                                          beginDates,
+                                          endDates,
+                                          numPeriods);
+      } break;
+      case DayCountConvention::e_PSA_30_360_EOM: {
+        loadYearsDiffs<bbldc::BasicPsa30360Eom>(results,
+                                                beginDates,
+                                                endDates,
+                                                numPeriods);
+      } break;
+      case DayCountConvention::e_SIA_30_360_EOM: {
+        loadYearsDiffs<bbldc::BasicSia30360Eom>(results,
+                                                beginDates,
+                                                endDates,
+                                                numPeriods);
+      } break;
+      case DayCountConvention::e_SIA_30_360_NEOM: {
+        loadYearsDiffs<bbldc::BasicSia30360Neom>(results,
+                                                 beginDates,
+                                                 endDates,
+                                                 numPeriods);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -20,6 +20,17 @@ BSLS_IDENT("$Id: $")
 // 'DayCountConvention::Enum' argument indicating which particular day-count
 // convention to apply.
 //
+///Computing Many Periods
+///----------------------
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// compute the results for many '(beginDate, endDate)' pairs (e.g., the accrual
+// periods of a cash-flow schedule) in one call.  The convention is resolved
+// once per call rather than once per pair, and, for the actual-day
+// conventions (e.g., 'e_ACTUAL_360'), each result is computed in a loop over
+// the serial-date values of the dates that the compiler can vectorize.  Each
+// result has the same value as the result of the corresponding single-pair
+// method.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -52,6 +63,45 @@ BSLS_IDENT("$Id: $")
 //  // Need fuzzy comparison since 'yearsDiff' is a 'double'.
 //  assert(0.1999 < yearsDiff && 0.2001 > yearsDiff);
 //..
+//
+///Example 2: Computing the Year Fractions of a Schedule
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need the year fractions of the accrual periods of a schedule of
+// quarterly payments according to the Actual/360 convention.  First, we create
+// the schedule:
+//..
+//  const bdlt::Date schedule[] = { bdlt::Date(2018,  1, 15),
+//                                  bdlt::Date(2018,  4, 15),
+//                                  bdlt::Date(2018,  7, 15),
+//                                  bdlt::Date(2018, 10, 15),
+//                                  bdlt::Date(2019,  1, 15) };
+//
+//  const int numPeriods = sizeof schedule / sizeof *schedule - 1;
+//..
+// Then, we compute the year fractions of all of the periods in one call, the
+// begin dates of the periods being the first 'numPeriods' dates of the
+// schedule, and the end dates being the last 'numPeriods' dates:
+//..
+//  double fractions[numPeriods];
+//
+//  bbldc::BasicDayCountUtil::yearsDiff(
+//                                    fractions,
+//                                    schedule,
+//                                    schedule + 1,
+//                                    numPeriods,
+//                                    bbldc::DayCountConvention::e_ACTUAL_360);
+//..
+// Finally, we verify that each fraction has the value computed by the
+// single-period method:
+//..
+//  for (int i = 0; i < numPeriods; ++i) {
+//      assert(bbldc::BasicDayCountUtil::yearsDiff(
+//                                    schedule[i],
+//                                    schedule[i + 1],
+//                                    bbldc::DayCountConvention::e_ACTUAL_360)
+//                                                           == fractions[i]);
+//  }
+//..
 
 #include <bblscm_version.h>
 
@@ -80,6 +130,21 @@ struct BasicDayCountUtil {
         // 'beginDate <= endDate' then the result is non-negative.  Note that
         // reversing the order of 'beginDate' and 'endDate' negates the result.
 
+    static void daysDiff(int                      *results,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         int                       numPeriods,
+                         DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numPeriods' elements of the
+        // specified 'results' array, the (signed) number of days between the
+        // elements at the same index of the specified 'beginDates' and
+        // 'endDates' arrays according to the specified day-count
+        // 'convention'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numPeriods', and 'results',
+        // 'beginDates', and 'endDates' each refer to an array of at least
+        // 'numPeriods' elements.  Note that each element of 'results' has the
+        // value returned by the single-period 'daysDiff' for the same dates.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -95,6 +160,21 @@ struct BasicDayCountUtil {
         // 'beginDate' and 'endDate' negates the result; specifically,
         // '|yearsDiff(b, e, c) + yearsDiff(e, b, c)| <= 1.0e-15' for all dates
         // 'b' and 'e', and day-count conventions 'c'.
+
+    static void yearsDiff(double                   *results,
+                          const bdlt::Date         *beginDates,
+                          const bdlt::Date         *endDates,
+                          int                       numPeriods,
+                          DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numPeriods' elements of the
+        // specified 'results' array, the (signed fractional) number of years
+        // between the elements at the same index of the specified
+        // 'beginDates' and 'endDates' arrays according to the specified
+        // day-count 'convention'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numPeriods', and 'results',
+        // 'beginDates', and 'endDates' each refer to an array of at least
+        // 'numPeriods' elements.  Note that each element of 'results' has the
+        // value returned by the single-period 'yearsDiff' for the same dates.
 };
 
 }  // close package namespace
@@ -11,6 +11,7 @@
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -28,8 +29,10 @@ using namespace bsl;
 // [ 2] int daysDiff(beginDate, endDate, convention);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(beginDate, endDate, convention);
+// [ 4] void daysDiff(results, beginDates, endDates, numPeriods, conv);
+// [ 4] void yearsDiff(results, beginDates, endDates, numPeriods, conv);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -119,7 +122,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -173,6 +176,206 @@ int main(int argc, char *argv[])
     // Need fuzzy comparison since 'yearsDiff' is a 'double'.
     ASSERT(0.1999 < yearsDiff && 0.2001 > yearsDiff);
 //..
+//
+///Example 2: Computing the Year Fractions of a Schedule
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need the year fractions of the accrual periods of a schedule of
+// quarterly payments according to the Actual/360 convention.  First, we create
+// the schedule:
+//..
+    const bdlt::Date schedule[] = { bdlt::Date(2018,  1, 15),
+                                    bdlt::Date(2018,  4, 15),
+                                    bdlt::Date(2018,  7, 15),
+                                    bdlt::Date(2018, 10, 15),
+                                    bdlt::Date(2019,  1, 15) };
+
+    const int numPeriods = sizeof schedule / sizeof *schedule - 1;
+//..
+// Then, we compute the year fractions of all of the periods in one call, the
+// begin dates of the periods being the first 'numPeriods' dates of the
+// schedule, and the end dates being the last 'numPeriods' dates:
+//..
+    double fractions[numPeriods];
+
+    bbldc::BasicDayCountUtil::yearsDiff(
+                                      fractions,
+                                      schedule,
+                                      schedule + 1,
+                                      numPeriods,
+                                      bbldc::DayCountConvention::e_ACTUAL_360);
+//..
+// Finally, we verify that each fraction has the value computed by the
+// single-period method:
+//..
+    for (int i = 0; i < numPeriods; ++i) {
+        ASSERT(bbldc::BasicDayCountUtil::yearsDiff(
+                                      schedule[i],
+                                      schedule[i + 1],
+                                      bbldc::DayCountConvention::e_ACTUAL_360)
+                                                             == fractions[i]);
+    }
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING MULTI-PERIOD 'daysDiff' AND 'yearsDiff'
+        //   Verify the methods taking arrays of dates load the results of the
+        //   single-period methods.
+        //
+        // Concerns:
+        //: 1 For each supported convention, each result has the value
+        //:   returned by the single-period method for the same dates (in
+        //:   particular, the floating-point results are identical, not merely
+        //:   close).
+        //:
+        //: 2 Reversed and empty periods are handled.
+        //:
+        //: 3 No element of 'results' beyond 'numPeriods' is modified.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create arrays of pseudo-random pairs of dates, including dates at
+        //:   the ends of months and years, reversed pairs, and equal pairs.
+        //:   For each supported convention, apply the methods to the arrays
+        //:   and verify each result is equal to the result of the
+        //:   single-period method.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void daysDiff(results, beginDates, endDates, numPeriods, conv);
+        //   void yearsDiff(results, beginDates, endDates, numPeriods, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "TESTING MULTI-PERIOD 'daysDiff' AND 'yearsDiff'"
+                      << endl
+                      << "==============================================="
+                      << endl;
+
+        static const Enum CONVENTIONS[] = {
+            ACTUAL_360,
+            ACTUAL_365_FIXED,
+            ISDA_30_360_EOM,
+            ISDA_ACTUAL_ACTUAL,
+            ISMA_30_360,
+            NL_365,
+            PSA_30_360_EOM,
+            SIA_30_360_EOM,
+            SIA_30_360_NEOM
+        };
+        const int NUM_CONVENTIONS = sizeof CONVENTIONS / sizeof *CONVENTIONS;
+
+        const int NUM_PERIODS = 2000;
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        {
+            const bdlt::Date FIRST(1700, 1, 1);
+            const bdlt::Date LAST(2300, 12, 31);
+
+            unsigned int seed = 12345;
+            while (static_cast<int>(beginDates.size()) < NUM_PERIODS) {
+                seed = seed * 1103515245 + 12345;
+                const bdlt::Date B = FIRST + static_cast<int>(
+                                           (seed >> 8) % (LAST - FIRST + 1));
+                seed = seed * 1103515245 + 12345;
+                const int        n = static_cast<int>((seed >> 8) % 800);
+                const bdlt::Date E = B + n;
+
+                switch (beginDates.size() % 4) {
+                  case 0: {
+                    beginDates.push_back(B);  endDates.push_back(E);
+                  } break;
+                  case 1: {
+                    beginDates.push_back(E);  endDates.push_back(B);
+                  } break;
+                  case 2: {
+                    // Month-end dates exercise the end-of-month rules of the
+                    // 30/360 conventions.
+
+                    int y, m, d;
+                    E.getYearMonthDay(&y, &m, &d);
+                    const bdlt::Date EOM = (12 == m
+                                            ? bdlt::Date(y + 1, 1, 1)
+                                            : bdlt::Date(y, m + 1, 1)) - 1;
+                    beginDates.push_back(B);  endDates.push_back(EOM);
+                  } break;
+                  default: {
+                    beginDates.push_back(B);  endDates.push_back(B);
+                  } break;
+                }
+            }
+        }
+
+        for (int ci = 0; ci < NUM_CONVENTIONS; ++ci) {
+            const Enum CONV = CONVENTIONS[ci];
+
+            if (veryVerbose) { T_ P(CONV) }
+
+            bsl::vector<int>    days(NUM_PERIODS + 1, -1);
+            bsl::vector<double> years(NUM_PERIODS + 1, -1.0);
+
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_PERIODS,
+                           CONV);
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_PERIODS,
+                            CONV);
+
+            for (int i = 0; i < NUM_PERIODS; ++i) {
+                const bdlt::Date& B = beginDates[i];
+                const bdlt::Date& E = endDates[i];
+
+                LOOP4_ASSERT(CONV, B, E, days[i],
+                             Util::daysDiff(B, E, CONV) == days[i]);
+                LOOP4_ASSERT(CONV, B, E, years[i],
+                             Util::yearsDiff(B, E, CONV) == years[i]);
+            }
+            LOOP_ASSERT(CONV, -1   == days[NUM_PERIODS]);
+            LOOP_ASSERT(CONV, -1.0 == years[NUM_PERIODS]);
+        }
+
+        { // negative testing
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Date DATE(2012, 1, 1);
+            int              days;
+            double           years;
+
+            ASSERT_PASS(Util::daysDiff(&days, &DATE, &DATE, 1, ACTUAL_360));
+            ASSERT_PASS(Util::daysDiff(0, 0, 0, 0, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(0, &DATE, &DATE, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(&days, 0, &DATE, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(&days, &DATE, 0, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(&days, &DATE, &DATE, -1, ACTUAL_360));
+            ASSERT_OPT_FAIL(Util::daysDiff(&days,
+                                           &DATE,
+                                           &DATE,
+                                           1,
+                                           INVALID_CONVENTION));
+
+            ASSERT_PASS(Util::yearsDiff(&years, &DATE, &DATE, 1, ACTUAL_360));
+            ASSERT_PASS(Util::yearsDiff(0, 0, 0, 0, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(0, &DATE, &DATE, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(&years, 0, &DATE, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(&years, &DATE, 0, 1, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(&years,
+                                        &DATE,
+                                        &DATE,
+                                        -1,
+                                        ACTUAL_360));
+            ASSERT_OPT_FAIL(Util::yearsDiff(&years,
+                                            &DATE,
+                                            &DATE,
+                                            1,
+                                            INVALID_CONVENTION));
+        }
       } break;
       case 3: {
         // --------------------------------------------------------------------
@@ -6,6 +6,120 @@ BSLS_IDENT_RCSID(bbldc_calendarbus252_cpp,"$Id$ $CSID$")
 
 namespace BloombergLP {
 namespace bbldc {
+namespace {
+
+                         // ========================
+                         // class BusinessDayCounter
+                         // ========================
+
+class BusinessDayCounter {
+    // This class provides the number of business days of a calendar that
+    // precede a date, computed incrementally from the number of business days
+    // preceding the previously supplied date.
+
+    // DATA
+    const bdlt::Calendar& d_calendar;  // calendar defining business days
+    bdlt::Date            d_date;      // most recently supplied date
+    int                   d_count;     // business days in
+                                       // '[d_calendar.firstDate() .. d_date)'
+
+  private:
+    // NOT IMPLEMENTED
+    BusinessDayCounter(const BusinessDayCounter&);
+    BusinessDayCounter& operator=(const BusinessDayCounter&);
+
+  public:
+    // CREATORS
+    explicit BusinessDayCounter(const bdlt::Calendar& calendar);
+        // Create a counter of the business days of the specified 'calendar'.
+        // The behavior is undefined unless 'calendar' outlives this object.
+
+    // MANIPULATORS
+    int numBusinessDaysBefore(const bdlt::Date& date);
+        // Return the number of business days of the calendar of this counter
+        // in the range '[firstDate .. date)', where 'firstDate' is the first
+        // date in the range of that calendar.  The behavior is undefined
+        // unless the calendar of this counter 'isInRange(date)'.
+};
+
+                         // ------------------------
+                         // class BusinessDayCounter
+                         // ------------------------
+
+// CREATORS
+BusinessDayCounter::BusinessDayCounter(const bdlt::Calendar& calendar)
+: d_calendar(calendar)
+, d_date(calendar.firstDate())
+, d_count(0)
+{
+}
+
+// MANIPULATORS
+int BusinessDayCounter::numBusinessDaysBefore(const bdlt::Date& date)
+{
+    BSLS_ASSERT_SAFE(d_calendar.isInRange(date));
+
+    if (d_date < date) {
+        d_count += d_calendar.numBusinessDays(d_date, date - 1);
+    }
+    else if (date < d_date) {
+        d_count -= d_calendar.numBusinessDays(date, d_date - 1);
+    }
+    d_date = date;
+
+    return d_count;
+}
+
+}  // close unnamed namespace
+
+                          // ---------------------
+                          // struct CalendarBus252
+                          // ---------------------
+
+// CLASS METHODS
+void CalendarBus252::daysDiff(int                   *results,
+                              const bdlt::Date      *beginDates,
+                              const bdlt::Date      *endDates,
+                              int                    numPeriods,
+                              const bdlt::Calendar&  calendar)
+{
+    BSLS_ASSERT(results    || 0 == numPeriods);
+    BSLS_ASSERT(beginDates || 0 == numPeriods);
+    BSLS_ASSERT(endDates   || 0 == numPeriods);
+    BSLS_ASSERT(0 <= numPeriods);
+
+    BusinessDayCounter counter(calendar);
+
+    for (int i = 0; i < numPeriods; ++i) {
+        const int numBegin = counter.numBusinessDaysBefore(beginDates[i]);
+
+        results[i] = counter.numBusinessDaysBefore(endDates[i]) - numBegin;
+    }
+}
+
+void CalendarBus252::yearsDiff(double                *results,
+                               const bdlt::Date      *beginDates,
+                               const bdlt::Date      *endDates,
+                               int                    numPeriods,
+                               const bdlt::Calendar&  calendar)
+{
+    BSLS_ASSERT(results    || 0 == numPeriods);
+    BSLS_ASSERT(beginDates || 0 == numPeriods);
+    BSLS_ASSERT(endDates   || 0 == numPeriods);
+    BSLS_ASSERT(0 <= numPeriods);
+
+    BusinessDayCounter counter(calendar);
+
+    for (int i = 0; i < numPeriods; ++i) {
+        const int numBegin = counter.numBusinessDaysBefore(beginDates[i]);
+        const int numEnd   = counter.numBusinessDaysBefore(endDates[i]);
+
+        // Storing the result value in 'results' removes extra-precision
+        // available in floating-point registers.
+
+        results[i] = static_cast<double>(numEnd - numBegin) / 252.0;
+    }
+}
 
 }  // close package namespace
 }  // close enterprise namespace
@@ -20,6 +20,20 @@ BSLS_IDENT("$Id: $")
 // negates the result.  When the two dates have the same value, the day count
 // is 0.  The year fraction is the day count divided by 252.
 //
+///Computing Many Periods
+///----------------------
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// compute the results for many '(beginDate, endDate)' pairs (e.g., the accrual
+// periods of a cash-flow schedule) in one call.  These overloads count the
+// business days incrementally: the number of business days preceding each
+// date is obtained from that of the previously visited date by counting only
+// the business days between the two dates (a population count over the
+// non-business-day bits of the calendar).  Therefore, when the end date of a
+// period is the begin date of the next period, as in a schedule, the calendar
+// is scanned once from the first to the last date of the schedule, rather
+// than once per period.  Each result has the same value as the result of the
+// corresponding single-period method.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -87,6 +101,23 @@ struct CalendarBus252 {
         // 'beginDate' and 'endDate' negates the result and that the result is
         // 0 when 'beginDate == endDate'.
 
+    static void daysDiff(int                   *results,
+                         const bdlt::Date      *beginDates,
+                         const bdlt::Date      *endDates,
+                         int                    numPeriods,
+                         const bdlt::Calendar&  calendar);
+        // Load, into each of the specified 'numPeriods' elements of the
+        // specified 'results' array, the (signed) number of days between the
+        // elements at the same index of the specified 'beginDates' and
+        // 'endDates' arrays according to the BUS-252 day-count convention
+        // with the specified 'calendar' providing the definition of business
+        // days.  The behavior is undefined unless '0 <= numPeriods',
+        // 'results', 'beginDates', and 'endDates' each refer to an array of at
+        // least 'numPeriods' elements, and each of those elements of
+        // 'beginDates' and 'endDates' is in the range of 'calendar'.  Note
+        // that each element of 'results' has the value returned by the
+        // single-period 'daysDiff' for the same dates.
+
     static double yearsDiff(const bdlt::Date&     beginDate,
                             const bdlt::Date&     endDate,
                             const bdlt::Calendar& calendar);
@@ -100,6 +131,23 @@ struct CalendarBus252 {
         // the result; specifically,
         // '|yearsDiff(b, e, c) + yearsDiff(e, b, c)| <= 1.0e-15' for all
         // calendars 'c' and valid dates 'b' and 'e'.
+
+    static void yearsDiff(double                *results,
+                          const bdlt::Date      *beginDates,
+                          const bdlt::Date      *endDates,
+                          int                    numPeriods,
+                          const bdlt::Calendar&  calendar);
+        // Load, into each of the specified 'numPeriods' elements of the
+        // specified 'results' array, the (signed fractional) number of years
+        // between the elements at the same index of the specified
+        // 'beginDates' and 'endDates' arrays according to the BUS-252
+        // day-count convention with the specified 'calendar' providing the
+        // definition of business days.  The behavior is undefined unless
+        // '0 <= numPeriods', 'results', 'beginDates', and 'endDates' each
+        // refer to an array of at least 'numPeriods' elements, and each of
+        // those elements of 'beginDates' and 'endDates' is in the range of
+        // 'calendar'.  Note that each element of 'results' has the value
+        // returned by the single-period 'yearsDiff' for the same dates.
 };
 
 // ============================================================================
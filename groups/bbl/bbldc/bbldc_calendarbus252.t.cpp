@@ -29,8 +29,10 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] int daysDiff(beginDate, endDate, calendar);
 // [ 2] double yearsDiff(beginDate, endDate, calendar);
+// [ 3] void daysDiff(results, beginDates, endDates, numPeriods, calendar);
+// [ 3] void yearsDiff(results, beginDates, endDates, numPeriods, calendar);
 // ----------------------------------------------------------------------------
-// [ 3] USAGE EXAMPLE
+// [ 4] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -121,7 +123,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -175,6 +177,173 @@ int main(int argc, char *argv[])
     // Need fuzzy comparison since 'yearsDiff' is a 'double'.
     ASSERT(yearsDiff > 0.2063 && yearsDiff < 0.2064);
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING MULTI-PERIOD 'daysDiff' AND 'yearsDiff'
+        //   Verify the methods taking arrays of dates load the results of the
+        //   single-period methods.
+        //
+        // Concerns:
+        //: 1 Each result has the value returned by the single-period method
+        //:   for the same dates, whether the periods are contiguous (as in a
+        //:   schedule), overlapping, reversed, or empty.
+        //:
+        //: 2 The result is correct when a date is the first or the last date
+        //:   in the range of the calendar.
+        //:
+        //: 3 No element of 'results' beyond 'numPeriods' is modified.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a calendar having weekend days and holidays spanning
+        //:   several years, create a schedule of monthly dates from the first
+        //:   to the last date of the calendar, and arrays of pseudo-random
+        //:   pairs of dates in the range of the calendar.  Apply the methods
+        //:   to the periods of the schedule and to the pairs, and verify each
+        //:   result is equal to the result of the single-period method.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void daysDiff(results, beginDates, endDates, numPeriods, cal);
+        //   void yearsDiff(results, beginDates, endDates, numPeriods, cal);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "TESTING MULTI-PERIOD 'daysDiff' AND 'yearsDiff'"
+                      << endl
+                      << "==============================================="
+                      << endl;
+
+        const bdlt::Date FIRST(2010, 1, 1);
+        const bdlt::Date LAST(2019, 12, 31);
+
+        bdlt::Calendar mX;  const bdlt::Calendar& X = mX;
+        mX.setValidRange(FIRST, LAST);
+        mX.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+        mX.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+
+        unsigned int seed = 12345;
+        for (int i = 0; i < 100; ++i) {
+            seed = seed * 1103515245 + 12345;
+            mX.addHoliday(FIRST + static_cast<int>((seed >> 8)
+                                                   % (LAST - FIRST + 1)));
+        }
+
+        if (verbose) cout << "\nTesting a schedule." << endl;
+        {
+            bsl::vector<bdlt::Date> schedule;
+            for (int year = 2010; year <= 2019; ++year) {
+                for (int month = 1; month <= 12; ++month) {
+                    schedule.push_back(bdlt::Date(year, month, 1));
+                }
+            }
+            schedule.push_back(LAST);
+
+            const int NUM_PERIODS = static_cast<int>(schedule.size()) - 1;
+
+            bsl::vector<int>    days(NUM_PERIODS + 1, -1);
+            bsl::vector<double> years(NUM_PERIODS + 1, -1.0);
+
+            Util::daysDiff(days.data(),
+                           schedule.data(),
+                           schedule.data() + 1,
+                           NUM_PERIODS,
+                           X);
+            Util::yearsDiff(years.data(),
+                            schedule.data(),
+                            schedule.data() + 1,
+                            NUM_PERIODS,
+                            X);
+
+            for (int i = 0; i < NUM_PERIODS; ++i) {
+                const bdlt::Date& B = schedule[i];
+                const bdlt::Date& E = schedule[i + 1];
+
+                if (veryVerbose) { T_ P_(B) P_(E) P(days[i]) }
+
+                LOOP3_ASSERT(B, E, days[i],
+                             Util::daysDiff(B, E, X) == days[i]);
+                LOOP3_ASSERT(B, E, years[i],
+                             Util::yearsDiff(B, E, X) == years[i]);
+            }
+            ASSERT(-1   == days[NUM_PERIODS]);
+            ASSERT(-1.0 == years[NUM_PERIODS]);
+        }
+
+        if (verbose) cout << "\nTesting arbitrary periods." << endl;
+        {
+            const int NUM_PERIODS = 1000;
+
+            bsl::vector<bdlt::Date> beginDates;
+            bsl::vector<bdlt::Date> endDates;
+
+            beginDates.push_back(FIRST);  endDates.push_back(LAST);
+            beginDates.push_back(LAST);   endDates.push_back(FIRST);
+            beginDates.push_back(LAST);   endDates.push_back(LAST);
+            beginDates.push_back(FIRST);  endDates.push_back(FIRST);
+
+            while (static_cast<int>(beginDates.size()) < NUM_PERIODS) {
+                seed = seed * 1103515245 + 12345;
+                const int b = static_cast<int>((seed >> 8)
+                                               % (LAST - FIRST + 1));
+                seed = seed * 1103515245 + 12345;
+                const int e = static_cast<int>((seed >> 8)
+                                               % (LAST - FIRST + 1));
+
+                beginDates.push_back(FIRST + b);
+                endDates.push_back(FIRST + e);
+            }
+
+            bsl::vector<int>    days(NUM_PERIODS);
+            bsl::vector<double> years(NUM_PERIODS);
+
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_PERIODS,
+                           X);
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_PERIODS,
+                            X);
+
+            for (int i = 0; i < NUM_PERIODS; ++i) {
+                const bdlt::Date& B = beginDates[i];
+                const bdlt::Date& E = endDates[i];
+
+                LOOP3_ASSERT(B, E, days[i],
+                             Util::daysDiff(B, E, X) == days[i]);
+                LOOP3_ASSERT(B, E, years[i],
+                             Util::yearsDiff(B, E, X) == years[i]);
+            }
+        }
+
+        { // negative testing
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Date DATE(2015, 6, 1);
+            int              days;
+            double           years;
+
+            ASSERT_PASS(Util::daysDiff(&days, &DATE, &DATE, 1, CB));
+            ASSERT_PASS(Util::daysDiff(0, 0, 0, 0, CB));
+            ASSERT_FAIL(Util::daysDiff(0, &DATE, &DATE, 1, CB));
+            ASSERT_FAIL(Util::daysDiff(&days, 0, &DATE, 1, CB));
+            ASSERT_FAIL(Util::daysDiff(&days, &DATE, 0, 1, CB));
+            ASSERT_FAIL(Util::daysDiff(&days, &DATE, &DATE, -1, CB));
+
+            ASSERT_PASS(Util::yearsDiff(&years, &DATE, &DATE, 1, CB));
+            ASSERT_PASS(Util::yearsDiff(0, 0, 0, 0, CB));
+            ASSERT_FAIL(Util::yearsDiff(0, &DATE, &DATE, 1, CB));
+            ASSERT_FAIL(Util::yearsDiff(&years, 0, &DATE, 1, CB));
+            ASSERT_FAIL(Util::yearsDiff(&years, &DATE, 0, 1, CB));
+            ASSERT_FAIL(Util::yearsDiff(&years, &DATE, &DATE, -1, CB));
+        }
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
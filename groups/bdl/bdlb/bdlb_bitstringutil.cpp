@@ -904,6 +904,122 @@ TYPE absRaw(TYPE x)
     return x < 0 ? -x : x;
 }
 
+                        // for 'findNth*'
+
+static inline
+int selectSetBit(uint64_t value, int n)
+    // Return the index of the specified 'n'th least-significant set bit in
+    // the specified 'value'.  The behavior is undefined unless
+    // '0 < n <= BitUtil::numBitsSet(value)'.
+{
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(n <= BitUtil::numBitsSet(value));
+
+    // Narrow the search to the half, then quarter, then eighth of 'value'
+    // containing the bit, then clear the lower set bits of that byte.
+
+    int index = 0;
+    for (int width = 32; width >= 8; width /= 2) {
+        const int count = BitUtil::numBitsSet(value & lt64Raw(width));
+        if (count < n) {
+            n     -= count;
+            value >>= width;
+            index += width;
+        }
+    }
+
+    while (--n) {
+        value &= value - 1;
+    }
+
+    return index + BitUtil::numTrailingUnsetBits(value);
+}
+
+static
+size_t findNthAtMaxIndex(const uint64_t *bitString,
+                         size_t          begin,
+                         size_t          end,
+                         size_t          n,
+                         uint64_t        flip)
+    // Return the index of the specified 'n'th most-significant set bit in the
+    // range '[begin .. end)' of the specified 'bitString' with each word
+    // XOR-ed with the specified 'flip', if such a bit exists, and
+    // 'BitStringUtil::k_INVALID_INDEX' otherwise.  The behavior is undefined
+    // unless '0 < n', 'begin <= end', and 'end' is less than or equal to the
+    // length of 'bitString'.  Note that a 'flip' of all 1 bits finds the
+    // 'n'th 0 bit of 'bitString', and a 'flip' of 0 finds its 'n'th 1 bit.
+{
+    if (begin == end) {
+        return bdlb::BitStringUtil::k_INVALID_INDEX;                  // RETURN
+    }
+
+    const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
+    const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
+    const size_t beginWord =       begin  / k_BITS_PER_UINT64;
+    const int    beginIdx  =   u32(begin) % k_BITS_PER_UINT64;
+
+    uint64_t value = (bitString[lastWord] ^ flip) & BitMaskUtil::lt64(endPos);
+
+    for (size_t ii = lastWord; ; value = bitString[--ii] ^ flip) {
+        if (ii == beginWord) {
+            value &= ge64Raw(beginIdx);
+        }
+
+        const size_t count = BitUtil::numBitsSet(value);
+        if (n <= count) {
+            return ii * k_BITS_PER_UINT64
+                 + selectSetBit(value, static_cast<int>(count - n + 1));
+                                                                      // RETURN
+        }
+        if (ii == beginWord) {
+            return bdlb::BitStringUtil::k_INVALID_INDEX;              // RETURN
+        }
+        n -= count;
+    }
+}
+
+static
+size_t findNthAtMinIndex(const uint64_t *bitString,
+                         size_t          begin,
+                         size_t          end,
+                         size_t          n,
+                         uint64_t        flip)
+    // Return the index of the specified 'n'th least-significant set bit in
+    // the range '[begin .. end)' of the specified 'bitString' with each word
+    // XOR-ed with the specified 'flip', if such a bit exists, and
+    // 'BitStringUtil::k_INVALID_INDEX' otherwise.  The behavior is undefined
+    // unless '0 < n', 'begin <= end', and 'end' is less than or equal to the
+    // length of 'bitString'.  Note that a 'flip' of all 1 bits finds the
+    // 'n'th 0 bit of 'bitString', and a 'flip' of 0 finds its 'n'th 1 bit.
+{
+    if (begin == end) {
+        return bdlb::BitStringUtil::k_INVALID_INDEX;                  // RETURN
+    }
+
+    const size_t beginWord =       begin  / k_BITS_PER_UINT64;
+    const int    beginIdx  =   u32(begin) % k_BITS_PER_UINT64;
+    const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
+    const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
+
+    uint64_t value = (bitString[beginWord] ^ flip) & ge64Raw(beginIdx);
+
+    for (size_t ii = beginWord; ; value = bitString[++ii] ^ flip) {
+        if (ii == lastWord) {
+            value &= BitMaskUtil::lt64(endPos);
+        }
+
+        const size_t count = BitUtil::numBitsSet(value);
+        if (n <= count) {
+            return ii * k_BITS_PER_UINT64
+                 + selectSetBit(value, static_cast<int>(n));          // RETURN
+        }
+        if (ii == lastWord) {
+            return bdlb::BitStringUtil::k_INVALID_INDEX;              // RETURN
+        }
+        n -= count;
+    }
+}
+
                         // for 'areEqual'
 
 static inline
@@ -1995,6 +2111,54 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString,
            : k_INVALID_INDEX;
 }
 
+size_t BitStringUtil::findNth0AtMaxIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          n)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < n);
+
+    return findNthAtMaxIndex(bitString, begin, end, n, ~0ULL);
+}
+
+size_t BitStringUtil::findNth0AtMinIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          n)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < n);
+
+    return findNthAtMinIndex(bitString, begin, end, n, ~0ULL);
+}
+
+size_t BitStringUtil::findNth1AtMaxIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          n)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < n);
+
+    return findNthAtMaxIndex(bitString, begin, end, n, 0);
+}
+
+size_t BitStringUtil::findNth1AtMinIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          n)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < n);
+
+    return findNthAtMinIndex(bitString, begin, end, n, 0);
+}
+
 bool BitStringUtil::isAny0(const uint64_t *bitString,
                            size_t          index,
                            size_t          numBits)
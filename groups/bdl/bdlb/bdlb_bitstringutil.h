@@ -187,14 +187,26 @@ BSLS_IDENT("$Id: $")
 //
 //                                     Find
 // +--------------------------------------------------------------------------+
-// | find0AtMaxIndex | Locate the highest-order 0 bit in a range.             |
+// | find0AtMaxIndex    | Locate the highest-order 0 bit in a range.          |
 // +--------------------------------------------------------------------------+
-// | find0AtMinIndex | Locate the lowest-order 0 bit in a range.              |
+// | find0AtMinIndex    | Locate the lowest-order 0 bit in a range.           |
 // +--------------------------------------------------------------------------+
-// | find1AtMaxIndex | Locate the highest-order 1 bit in a range.             |
+// | find1AtMaxIndex    | Locate the highest-order 1 bit in a range.          |
 // +--------------------------------------------------------------------------+
-// | find1AtMinIndex | Locate the lowest-order 1 bit in a range.              |
+// | find1AtMinIndex    | Locate the lowest-order 1 bit in a range.           |
 // +--------------------------------------------------------------------------+
+// | findNth0AtMaxIndex | Locate the 'n'th highest-order 0 bit in a range.    |
+// +--------------------------------------------------------------------------+
+// | findNth0AtMinIndex | Locate the 'n'th lowest-order 0 bit in a range.     |
+// +--------------------------------------------------------------------------+
+// | findNth1AtMaxIndex | Locate the 'n'th highest-order 1 bit in a range.    |
+// +--------------------------------------------------------------------------+
+// | findNth1AtMinIndex | Locate the 'n'th lowest-order 1 bit in a range.     |
+// +--------------------------------------------------------------------------+
+//
+// The 'findNth*' functions count the bits of a range a word at a time (i.e.,
+// 'k_BITS_PER_UINT64' bits per population count), so locating the 'n'th bit
+// takes time proportional to the number of words examined, not to 'n'.
 //
 //
 //                                     Count
@@ -721,6 +733,50 @@ struct BitStringUtil {
         // unless 'begin <= end' and 'end' is less than or equal to the length
         // of 'bitString'.
 
+    static bsl::size_t findNth0AtMaxIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          n);
+        // Return the index of the specified 'n'th most-significant 0 bit in
+        // the specified 'bitString' in the specified range '[begin .. end)'
+        // (i.e., the 0 bit having exactly 'n - 1' 0 bits above it in the
+        // range), if such a bit exists, and 'k_INVALID_INDEX' otherwise.  The
+        // behavior is undefined unless '0 < n', 'begin <= end', and 'end' is
+        // less than or equal to the length of 'bitString'.
+
+    static bsl::size_t findNth0AtMinIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          n);
+        // Return the index of the specified 'n'th least-significant 0 bit in
+        // the specified 'bitString' in the specified range '[begin .. end)'
+        // (i.e., the 0 bit having exactly 'n - 1' 0 bits below it in the
+        // range), if such a bit exists, and 'k_INVALID_INDEX' otherwise.  The
+        // behavior is undefined unless '0 < n', 'begin <= end', and 'end' is
+        // less than or equal to the length of 'bitString'.
+
+    static bsl::size_t findNth1AtMaxIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          n);
+        // Return the index of the specified 'n'th most-significant 1 bit in
+        // the specified 'bitString' in the specified range '[begin .. end)'
+        // (i.e., the 1 bit having exactly 'n - 1' 1 bits above it in the
+        // range), if such a bit exists, and 'k_INVALID_INDEX' otherwise.  The
+        // behavior is undefined unless '0 < n', 'begin <= end', and 'end' is
+        // less than or equal to the length of 'bitString'.
+
+    static bsl::size_t findNth1AtMinIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          n);
+        // Return the index of the specified 'n'th least-significant 1 bit in
+        // the specified 'bitString' in the specified range '[begin .. end)'
+        // (i.e., the 1 bit having exactly 'n - 1' 1 bits below it in the
+        // range), if such a bit exists, and 'k_INVALID_INDEX' otherwise.  The
+        // behavior is undefined unless '0 < n', 'begin <= end', and 'end' is
+        // less than or equal to the length of 'bitString'.
+
                                 // Count
 
     static bool isAny0(const bsl::uint64_t *bitString,
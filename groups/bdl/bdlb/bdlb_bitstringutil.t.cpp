@@ -75,13 +75,17 @@ using bsl::flush;
 // [20] St find1AtMaxIndex(U64 *bitString, St begin, St end);
 // [22] St find1AtMinIndex(const uint64_t *bitString, St length);
 // [22] St find1AtMinIndex(U64 *bitString, St begin, St end);
+// [23] St findNth0AtMaxIndex(U64 *bitString, St begin, St end, St n);
+// [23] St findNth0AtMinIndex(U64 *bitString, St begin, St end, St n);
+// [23] St findNth1AtMaxIndex(U64 *bitString, St begin, St end, St n);
+// [23] St findNth1AtMinIndex(U64 *bitString, St begin, St end, St n);
 // [ 6] bool isAny0(const uint64_t *bitString, St index, St numBits);
 // [ 6] bool isAny1(const uint64_t *bitString, St index, St numBits);
 // [13] St num0(const uint64_t *bitString, St index, St numBits);
 // [13] St num1(const uint64_t *bitString, St index, St numBits);
 // [12] OS& print(OS& stream, U64 *bs, St nb, int lvl, int spl);
 // ----------------------------------------------------------------------------
-// [23] USAGE EXAMPLE
+// [24] USAGE EXAMPLE
 // [ 1] void populateBitString(U64 *bitString, St idx, char *ascii);
 // [ 1] void populateBitStringHex(U64 *bitString, St idx, char *ascii);
 // ----------------------------------------------------------------------------
@@ -944,6 +948,56 @@ size_t findAtMinOracle(uint64_t *bitString,
     return k_INVALID_INDEX;
 }
 
+size_t findNthAtMaxOracle(uint64_t *bitString,
+                          size_t    begin,
+                          size_t    end,
+                          size_t    n,
+                          bool      value)
+    // Return the index of the specified 'n'th highest-order bit that matches
+    // the specified 'value' in the bit string starting at the specified
+    // 'begin' index and ending before the specified 'end' index in the
+    // specified 'bitString', and 'k_INVALID_INDEX' if there are fewer than
+    // 'n' such bits.  The behavior is undefined unless 'begin <= end' and
+    // '0 < n'.  Note that this function provides an inefficient but reliable
+    // way of implementing the 'findNth*AtMaxIndex' functions for testing.
+{
+    ASSERT(begin <= end);
+    ASSERT(0 < n);
+
+    for (size_t ii = end; ii > begin; --ii) {
+        if (Util::bit(bitString, ii - 1) == value && 0 == --n) {
+            return ii - 1;                                            // RETURN
+        }
+    }
+
+    return k_INVALID_INDEX;
+}
+
+size_t findNthAtMinOracle(uint64_t *bitString,
+                          size_t    begin,
+                          size_t    end,
+                          size_t    n,
+                          bool      value)
+    // Return the index of the specified 'n'th lowest-order bit that matches
+    // the specified 'value' in the bit string starting at the specified
+    // 'begin' index and ending before the specified 'end' index in the
+    // specified 'bitString', and 'k_INVALID_INDEX' if there are fewer than
+    // 'n' such bits.  The behavior is undefined unless 'begin <= end' and
+    // '0 < n'.  Note that this function provides an inefficient but reliable
+    // way of implementing the 'findNth*AtMinIndex' functions for testing.
+{
+    ASSERT(begin <= end);
+    ASSERT(0 < n);
+
+    for (size_t ii = begin; ii < end; ++ii) {
+        if (Util::bit(bitString, ii) == value && 0 == --n) {
+            return ii;                                                // RETURN
+        }
+    }
+
+    return k_INVALID_INDEX;
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -961,7 +1015,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 23: {
+      case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1111,6 +1165,123 @@ int main(int argc, char *argv[])
     ASSERT(false == isOffMay28);
 //..
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING 'findNth0AtMaxIndex', 'findNth0AtMinIndex',
+        //         'findNth1AtMaxIndex', AND 'findNth1AtMinIndex'
+        //   Ensure the methods return the expected value.
+        //
+        // Concerns:
+        //: 1 The functions return the index of the 'n'th bit having the
+        //:   value sought, counting from the appropriate end of the range,
+        //:   and 'k_INVALID_INDEX' if the range has fewer than 'n' such bits.
+        //:
+        //: 2 Bits outside of the range '[begin .. end)' are ignored, whether
+        //:   the range is within one word or spans several words.
+        //:
+        //: 3 The bit string is not modified.
+        //:
+        //: 4 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write the 'findNthAtMaxOracle' and 'findNthAtMinOracle' oracles,
+        //:   which examine the bits one at a time.
+        //:
+        //: 2 For bit strings of special and garbage values created by
+        //:   'setUpArray', iterate over ranges '[begin .. end)' and values of
+        //:   'n' up to one more than the number of bits in the range, and
+        //:   verify the result of each function is the result of its oracle.
+        //:   (C-1..2)
+        //:
+        //: 3 After applying each function, verify that the bit string has not
+        //:   been modified.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-4)
+        //
+        // Testing:
+        //   St findNth0AtMaxIndex(U64 *bitString, St begin, St end, St n);
+        //   St findNth0AtMinIndex(U64 *bitString, St begin, St end, St n);
+        //   St findNth1AtMaxIndex(U64 *bitString, St begin, St end, St n);
+        //   St findNth1AtMinIndex(U64 *bitString, St begin, St end, St n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'findNth*'\n"
+                               "==================\n";
+
+        enum { NUM_BITS = SET_UP_ARRAY_DIM * k_BITS_PER_UINT64 };
+
+        uint64_t bits[SET_UP_ARRAY_DIM], control[SET_UP_ARRAY_DIM];
+
+        for (int ii = 0; ii < 60; ) {
+            const int II = ii;
+            setUpArray(control, &ii, !veryVerbose);
+            wordCpy(bits, control, sizeof(bits));
+
+            if (veryVerbose) {
+                P_(II);    P(pHex(bits, NUM_BITS));
+            }
+
+            for (size_t begin = 0; begin <= NUM_BITS;
+                                               incSizeT(&begin, NUM_BITS)) {
+                for (size_t end = begin; end <= NUM_BITS;
+                                                 incSizeT(&end, NUM_BITS)) {
+                    const size_t maxN = end - begin + 1;
+                    for (size_t n = 1; n <= maxN; incSizeT(&n, maxN)) {
+                        const size_t EXP_MAX_0 =
+                               findNthAtMaxOracle(bits, begin, end, n, false);
+                        const size_t EXP_MIN_0 =
+                               findNthAtMinOracle(bits, begin, end, n, false);
+                        const size_t EXP_MAX_1 =
+                                findNthAtMaxOracle(bits, begin, end, n, true);
+                        const size_t EXP_MIN_1 =
+                                findNthAtMinOracle(bits, begin, end, n, true);
+
+                        ASSERTV(II, begin, end, n, EXP_MAX_0 ==
+                               Util::findNth0AtMaxIndex(bits, begin, end, n));
+                        ASSERTV(II, begin, end, n, EXP_MIN_0 ==
+                               Util::findNth0AtMinIndex(bits, begin, end, n));
+                        ASSERTV(II, begin, end, n, EXP_MAX_1 ==
+                               Util::findNth1AtMaxIndex(bits, begin, end, n));
+                        ASSERTV(II, begin, end, n, EXP_MIN_1 ==
+                               Util::findNth1AtMinIndex(bits, begin, end, n));
+                    }
+                    ASSERT(0 == wordCmp(bits, control, sizeof(bits)));
+                }
+            }
+        }
+
+        if (verbose) cout << "Negative testing\n";
+        {
+            bsls::AssertTestHandlerGuard guard;
+
+            uint64_t bits[2] = { 0, 0 };
+
+            ASSERT_PASS(Util::findNth0AtMaxIndex(bits,  0, 128, 1));
+            ASSERT_PASS(Util::findNth0AtMaxIndex(bits,  5,   5, 1));
+            ASSERT_FAIL(Util::findNth0AtMaxIndex(   0,  0, 128, 1));
+            ASSERT_FAIL(Util::findNth0AtMaxIndex(bits,  6,   5, 1));
+            ASSERT_FAIL(Util::findNth0AtMaxIndex(bits,  0, 128, 0));
+
+            ASSERT_PASS(Util::findNth0AtMinIndex(bits,  0, 128, 1));
+            ASSERT_PASS(Util::findNth0AtMinIndex(bits,  5,   5, 1));
+            ASSERT_FAIL(Util::findNth0AtMinIndex(   0,  0, 128, 1));
+            ASSERT_FAIL(Util::findNth0AtMinIndex(bits,  6,   5, 1));
+            ASSERT_FAIL(Util::findNth0AtMinIndex(bits,  0, 128, 0));
+
+            ASSERT_PASS(Util::findNth1AtMaxIndex(bits,  0, 128, 1));
+            ASSERT_PASS(Util::findNth1AtMaxIndex(bits,  5,   5, 1));
+            ASSERT_FAIL(Util::findNth1AtMaxIndex(   0,  0, 128, 1));
+            ASSERT_FAIL(Util::findNth1AtMaxIndex(bits,  6,   5, 1));
+            ASSERT_FAIL(Util::findNth1AtMaxIndex(bits,  0, 128, 0));
+
+            ASSERT_PASS(Util::findNth1AtMinIndex(bits,  0, 128, 1));
+            ASSERT_PASS(Util::findNth1AtMinIndex(bits,  5,   5, 1));
+            ASSERT_FAIL(Util::findNth1AtMinIndex(   0,  0, 128, 1));
+            ASSERT_FAIL(Util::findNth1AtMinIndex(bits,  6,   5, 1));
+            ASSERT_FAIL(Util::findNth1AtMinIndex(bits,  0, 128, 0));
+        }
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING 'find1AtMinIndex' METHODS
@@ -6,173 +6,14 @@ BSLS_IDENT_RCSID(bdlb_numericparseutil_cpp, "$Id$ $CSID$")
 
 #include <bdlb_chartype.h>
 
-#include <bslma_allocator.h>
-#include <bslma_default.h>
-#include <bsls_assert.h>
-#include <bsls_platform.h>
+#include <bslalg_numericparserutil.h>
 #include <bslmf_assert.h>
-
-#include <bsl_cstdlib.h>  // strtod
-#include <bsl_clocale.h>  // setlocale
-
-#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
-// Needed for fixing the broken 'strtod', see below.
-#include <bdlb_string.h>
-#include <bdlb_chartype.h>
-#include <bsl_limits.h>
-#endif
+#include <bsls_assert.h>
 
 namespace BloombergLP {
 
 namespace bdlb {
 
-namespace {
-
-#if defined(BSLS_PLATFORM_OS_LINUX)
-static
-int doubleSign(double number)
-    // Return 0 if the specified 'number' is positive, and a non-zero value
-    // otherwise.  This function is needed only until we have all platforms
-    // updated to C++11 that supports the 'signbit' function.
-{
-    const unsigned char *bytes = reinterpret_cast<unsigned char *>(&number);
-
-#ifdef BSLS_PLATFORM_IS_BIG_ENDIAN
-    static bsl::size_t pos = 0;
-#elif defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
-    static bsl::size_t pos = sizeof(double) - 1;
-#endif
-    return bytes[pos] & 0x80;
-}
-#endif
-
-}  // close unnamed namespace
-
-
-#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
-// 'strtod' is broken in Visual Studio up to (including) Visual Studio 2013.
-// The function does not parse the special 'double' values NaN and Infinity as
-// specified on http://en.cppreference.com/w/cpp/string/byte/strtof.  When
-// Microsoft's 'strod' reports that it could not parse its input string the
-// following functions are used to attempt to parse them as NaN or Infinity.
-
-namespace {
-
-static bool isPrefixCaseless(const bslstl::StringRef& inputString,
-                             const bslstl::StringRef& prefix)
-    // Check if the specified 'inputString' has the specified 'prefix' with
-    // case insensitive comparison.  Return 'true' if the prefix matches and
-    // 'false' otherwise.
-{
-    if (inputString.length() < prefix.length()) {
-        return false;                                                 // RETURN
-    }
-
-    return String::areEqualCaseless(inputString.data(), prefix.length(),
-                                    prefix.data(),      prefix.length());
-}
-
-static bool safeCheck(const bslstl::StringRef&     inputString,
-                      bslstl::StringRef::size_type pos,
-                      char                         ch)
-    // Check in the specified 'inputString', if the characters at the specified
-    // 'pos', if such position exists, equals to the specified 'ch'.
-{
-    return (inputString.length() > pos) && inputString[pos] == ch;
-}
-
-static bool isNanString(bslstl::StringRef        *remainder,
-                        const bslstl::StringRef&  inputString)
-    // Check the specified 'inputString' if its prefix is a "NaN" string
-    // representation (see
-    // http://en.cppreference.com/w/cpp/string/byte/strtof).  If it is, load
-    // the rest of the 'inputString' into the specified 'remainder' and return
-    // 'true'; otherwise do not change 'remainder' and return 'false'.
-{
-
-    if (!isPrefixCaseless(inputString, "NaN")) {
-        return false;                                                 // RETURN
-    }
-
-    if (!safeCheck(inputString, 3, '(')) {
-        remainder->assign(inputString.data() + 3, inputString.length() - 3);
-        return true;                                                  // RETURN
-    }
-
-    typedef bslstl::StringRef::size_type size_type;
-    for (size_type i = 4; i < inputString.length(); ++i) {
-        const char ch = inputString[i];
-
-        if (ch == ')') {
-            ++i; // Include the ')'
-            remainder->assign(inputString.data() + i,
-                              inputString.length() - i);
-            return true;                                              // RETURN
-        }
-
-        if (ch != '_' && !CharType::isAlnum(ch)) {
-            break;
-        }
-    }
-
-    return false;
-}
-
-static int parseNanAndInf(double            *result,
-                          bslstl::StringRef *remainder,
-                          bslstl::StringRef  inputString)
-    // Check the specified 'inputString' if its prefix is a "NaN" or Infinity
-    // string representation
-    // (see http://en.cppreference.com/w/cpp/string/byte/strtof).  If it is,
-    // load the result of the conversion into the specified 'result', load the
-    // rest of the 'inputString' into the specified 'remainder' and return
-    // zero; otherwise do not change 'remainder' and return a non-zero value.
-{
-    int sign = 1;
-
-    if (inputString[0] == '+' || inputString[0] == '-') {
-        if (inputString[0] == '-') {
-            sign = -1;
-        }
-        if (inputString.size() == 1) {
-            return -4;                                                // RETURN
-        }
-        inputString.assign(inputString.data() + 1, inputString.length() - 1);
-    }
-
-    if (isPrefixCaseless(inputString, "INFINITY")) {
-        *result = sign * bsl::numeric_limits<double>::infinity();
-        remainder->assign(inputString.data() + 8, inputString.length() - 8);
-        return 0;                                                     // RETURN
-    }
-
-    if (isPrefixCaseless(inputString, "INF")) {
-        *result = sign * bsl::numeric_limits<double>::infinity();
-        remainder->assign(inputString.data() + 3, inputString.length() - 3);
-        return 0;                                                     // RETURN
-    }
-
-    if (isNanString(remainder, inputString)) {
-        // This is the only way of making a negative quiet NaN on Microsoft
-        // Visual C++.  Multiplying with -1 does not work, it remains positive.
-        // Assigning first positive then negating changes the value from QNAN
-        // to something called IND.
-        if (sign == -1) {
-            *result = -bsl::numeric_limits<double>::quiet_NaN();
-        }
-        else {
-            *result = bsl::numeric_limits<double>::quiet_NaN();
-        }
-        return 0;                                                     // RETURN
-    }
-
-    return -3;
-}
-
-}  // close unnamed namespace
-
-#endif  // End of Microsoft Visual Studio 2013 and lower specific code
-
 typedef bsls::Types::Int64  Int64;
 typedef bsls::Types::Uint64 Uint64;
 
@@ -206,12 +47,7 @@ int NumericParseUtil::parseDouble(double                   *result,
     BSLS_ASSERT(remainder);
     BSLS_ASSERT(result);
 
-#ifdef BSLS_PLATFORM_OS_WINDOWS
-    // 'setlocale' is slow on Windows, see '{drqs 161551330}'.
-    BSLS_ASSERT_SAFE(bsl::setlocale(0, 0) == bslstl::StringRef("C"));
-#else
-    BSLS_ASSERT(bsl::setlocale(0, 0) == bslstl::StringRef("C"));
-#endif
+    typedef bslalg::NumericParserUtil ParserUtil;
 
     // An empty string cannot be a number.
 
@@ -220,70 +56,40 @@ int NumericParseUtil::parseDouble(double                   *result,
         return -1;                                                    // RETURN
     }
 
-    // We need to ensure that the string does not start with a whitespace
-    // because our contract says so, but our current implementation happens to
-    // allow leading whitespace.
-
     if (CharType::isSpace(inputString[0])) {
         *remainder = inputString;
         return -2;                                                    // RETURN
     }
 
-    static const size_type k_BUFFER_SIZE = 128;
-
-    const bool             useLocalBuffer =
-                                       (inputString.length() <= k_BUFFER_SIZE);
-
-    char                   localBuffer[k_BUFFER_SIZE + 1];
-    char                  *buffer = localBuffer;
+    // 'fromChars' parses an optional '-', but, unlike 'strtod', no '+', which
+    // we skip here.
 
-    bslma::Allocator      *allocator = bslma::Default::defaultAllocator();
+    const char *first = inputString.data();
+    const char *last  = first + inputString.length();
+    const char *begin = '+' == *first ? first + 1 : first;
 
-    if (!useLocalBuffer) {
-        buffer = static_cast<char *>(allocator->allocate(
-                                                    inputString.length() + 1));
+    if (begin != first && begin != last && '-' == *begin) {
+        *remainder = inputString;
+        return -3;                                                    // RETURN
     }
 
-    memcpy(buffer, inputString.data(), inputString.length());
-    buffer[inputString.length()] = 0;
-
-    char         *endPtr;
-    const double  rv = bsl::strtod(buffer, &endPtr);
-    size_type endPos = (endPtr - buffer);
-    remainder->assign(&inputString[0] + endPos, inputString.length() - endPos);
-
-    if (!useLocalBuffer) {
-        allocator->deallocate(buffer);
-    }
+    // Values out of range are loaded as the infinity or the zero that
+    // 'strtod' would return, which is not an error of this function.
 
-    if (endPtr != buffer) {
-        *result = rv;
-#if defined(BSLS_PLATFORM_OS_LINUX)
-        // 'strtod' is broken in libstdc++, parsing negative NaN into positive
-        // NaN.  We are not checking for compilers because both clang and g++
-        // exhibit the fault on Linux.
-        if (*result != *result && inputString[0] == '-') {
-            if (!doubleSign(*result)) {
-                // If 'result' is (incorrectly) a positive NaN value, reverse
-                // the sign
-                *result = -*result;
-            }
-        }
-#endif
-        return 0;                                                     // RETURN
+    double                   value;
+    const char              *end;
+    const ParserUtil::Status status = ParserUtil::fromChars(&value,
+                                                            &end,
+                                                            begin,
+                                                            last);
+    if (ParserUtil::e_INVALID == status) {
+        *remainder = inputString;
+        return -3;                                                    // RETURN
     }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
-    // 'strtod' is broken in Visual Studio up to (including) Visual Studio
-    // 2013.  The 'strtod' function does not parse the special 'double' values
-    // NaN and Infinity as specified on
-    // http://en.cppreference.com/w/cpp/string/byte/strtof.  We are here when
-    // Microsoft's 'strod' reports that it could not parse the input string so
-    // we call following function to attempt to parse them as NaN or Infinity.
-    return parseNanAndInf(result, remainder, inputString);
-#else
-    return -3;
-#endif
+    *result = value;
+    remainder->assign(end, last - end);
+    return 0;
 }
 
 int NumericParseUtil::parseInt(int                      *result,
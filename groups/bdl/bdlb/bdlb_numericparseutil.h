@@ -93,9 +93,14 @@ BSLS_IDENT("$Id: $")
 ///Floating Point Values
 ///---------------------
 // The conversion from text to values of type 'double' results in the closest
-// representable value to the decimal text.  Note that this is the same as for
-// the standard library function 'strtod'.  For example, the ASCII string
-// "3.14159" is converted, on some platforms, to 3.1415899999999999.
+// representable value to the decimal text, regardless of its number of
+// digits.  Note that this is the same as for the standard library function
+// 'strtod'.  For example, the ASCII string "3.14159" is converted to
+// 3.1415899999999999.  Unlike 'strtod', the conversion does not depend on the
+// locale, does not copy or allocate, and does not accept hexadecimal floating
+// point numbers (see 'bslalg_numericparserutil').  Decimal text whose value
+// overflows is converted to an infinity, and decimal text whose value
+// underflows is converted to zero, as 'strtod' does.
 //
 ///Special Floating Point Values
 ///- - - - - - - - - - - - - - -
@@ -201,9 +206,7 @@ struct NumericParseUtil {
         // successfully parsed text, or the position at which a parse failure
         // was detected.  Return zero on success, and a non-zero value
         // otherwise.  The value of 'result' is unchanged if a parse failure
-        // occurs.  The behavior is undefined unless the current locale is the
-        // "C" locale, such that 'strcmp(setlocale(0, 0), "C") == 0'.  For more
-        // information see {Floating Point Values}.
+        // occurs.  For more information see {Floating Point Values}.
 
     static int parseInt(int                      *result,
                         const bslstl::StringRef&  inputString,
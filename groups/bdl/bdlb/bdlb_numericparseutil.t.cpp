@@ -1476,11 +1476,25 @@ int main(int argc, char *argv[])
         //:    3 The value is just large/small than representable
         //:    4 "Interesting" values from "A Program for Testing IEEE
         //:      Decimal-Binary Conversions", Vern Paxson, ICIR 1991.
+        //:
+        //:  4 The input is parsed in place, without allocating memory, need
+        //:    not be null-terminated, and may have any number of digits.
+        //:
+        //:  5 Values out of range are parsed as an infinity or zero, and
+        //:    hexadecimal floating point numbers are not parsed.
         //
         // Plan:
         //: 1 Use the table-driven approach with columns for input, base, and
         //:   expected result.  Use category partitioning to create a suite of
         //:   test vectors for an enumerated set of bases.
+        //:
+        //: 2 Parse a number of several hundred digits, followed in memory by
+        //:   more digits that are not part of the input, with the default
+        //:   allocator being a test allocator, and verify the value, the
+        //:   remainder, and that no memory was allocated.  (C-4)
+        //:
+        //: 3 Parse values out of range and a hexadecimal number, and verify
+        //:   the results.  (C-5)
         //
         // Testing:
         //   parseDouble(double *res, StringRef *rest, StringRef in)
@@ -1998,6 +2012,61 @@ int main(int argc, char *argv[])
                 } // end for si....
             }
         }
+
+        if (verbose) cout << "\nTesting long and unterminated input." << endl;
+        {
+            bslma::TestAllocator         da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            // The first 400 characters of 'input' are "1.2500...0", which is
+            // followed by digits that are not part of the parsed input.
+
+            bsl::string input(1000, '9', &testAllocator);
+            input.replace(0, 4, "1.25");
+            bsl::fill(input.begin() + 4, input.begin() + 400, '0');
+
+            double    result = 0;
+            StringRef rest;
+            int       rv = NumericParseUtil::parseDouble(
+                                              &result,
+                                              &rest,
+                                              StringRef(input.data(), 400));
+            ASSERTV(rv,                          0    == rv);
+            ASSERTV(result,                      1.25 == result);
+            ASSERTV(rest.data() - input.data(),  rest.empty());
+            ASSERTV(da.numAllocations(),         0    == da.numAllocations());
+
+            rv = NumericParseUtil::parseDouble(&result,
+                                               &rest,
+                                               StringRef(input.data(), 401));
+            ASSERTV(rv,     0    == rv);
+            ASSERTV(result, 1.25 == result);
+        }
+
+        if (verbose) cout << "\nTesting out of range and hex input." << endl;
+        {
+            double    result = 0;
+            StringRef rest;
+
+            ASSERT(0 == NumericParseUtil::parseDouble(&result,
+                                                      &rest,
+                                                      "1e999"));
+            ASSERT(bsl::numeric_limits<double>::infinity() == result);
+            ASSERT(rest.empty());
+
+            ASSERT(0 == NumericParseUtil::parseDouble(&result,
+                                                      &rest,
+                                                      "-1e-999"));
+            ASSERT(0 == result);
+            ASSERT(doubleSign(result));
+            ASSERT(rest.empty());
+
+            ASSERT(0 == NumericParseUtil::parseDouble(&result,
+                                                      &rest,
+                                                      "0x1p3"));
+            ASSERT(0      == result);
+            ASSERT("x1p3" == rest);
+        }
       } break;
       case 3: {
         // --------------------------------------------------------------------
@@ -935,6 +935,54 @@ class BitArray {
         // is not specified and 'effectiveEnd == end' otherwise.  The behavior
         // is undefined unless 'begin <= effectiveEnd <= length()'.
 
+    bsl::size_t findNth0AtMaxIndex(bsl::size_t n,
+                                   bsl::size_t begin = 0,
+                                   bsl::size_t end   = k_INVALID_INDEX) const;
+        // Return the index of the specified 'n'th most-significant 0 bit in
+        // this array in the range optionally specified by 'begin' and 'end'
+        // (i.e., the 0 bit having exactly 'n - 1' 0 bits above it in the
+        // range), and 'k_INVALID_INDEX' if the range has fewer than 'n' 0
+        // bits.  The range is '[begin .. effectiveEnd)', where
+        // 'effectiveEnd == length()' if 'end' is not specified and
+        // 'effectiveEnd == end' otherwise.  The behavior is undefined unless
+        // '0 < n' and 'begin <= effectiveEnd <= length()'.
+
+    bsl::size_t findNth0AtMinIndex(bsl::size_t n,
+                                   bsl::size_t begin = 0,
+                                   bsl::size_t end   = k_INVALID_INDEX) const;
+        // Return the index of the specified 'n'th least-significant 0 bit in
+        // this array in the range optionally specified by 'begin' and 'end'
+        // (i.e., the 0 bit having exactly 'n - 1' 0 bits below it in the
+        // range), and 'k_INVALID_INDEX' if the range has fewer than 'n' 0
+        // bits.  The range is '[begin .. effectiveEnd)', where
+        // 'effectiveEnd == length()' if 'end' is not specified and
+        // 'effectiveEnd == end' otherwise.  The behavior is undefined unless
+        // '0 < n' and 'begin <= effectiveEnd <= length()'.
+
+    bsl::size_t findNth1AtMaxIndex(bsl::size_t n,
+                                   bsl::size_t begin = 0,
+                                   bsl::size_t end   = k_INVALID_INDEX) const;
+        // Return the index of the specified 'n'th most-significant 1 bit in
+        // this array in the range optionally specified by 'begin' and 'end'
+        // (i.e., the 1 bit having exactly 'n - 1' 1 bits above it in the
+        // range), and 'k_INVALID_INDEX' if the range has fewer than 'n' 1
+        // bits.  The range is '[begin .. effectiveEnd)', where
+        // 'effectiveEnd == length()' if 'end' is not specified and
+        // 'effectiveEnd == end' otherwise.  The behavior is undefined unless
+        // '0 < n' and 'begin <= effectiveEnd <= length()'.
+
+    bsl::size_t findNth1AtMinIndex(bsl::size_t n,
+                                   bsl::size_t begin = 0,
+                                   bsl::size_t end   = k_INVALID_INDEX) const;
+        // Return the index of the specified 'n'th least-significant 1 bit in
+        // this array in the range optionally specified by 'begin' and 'end'
+        // (i.e., the 1 bit having exactly 'n - 1' 1 bits below it in the
+        // range), and 'k_INVALID_INDEX' if the range has fewer than 'n' 1
+        // bits.  The range is '[begin .. effectiveEnd)', where
+        // 'effectiveEnd == length()' if 'end' is not specified and
+        // 'effectiveEnd == end' otherwise.  The behavior is undefined unless
+        // '0 < n' and 'begin <= effectiveEnd <= length()'.
+
     bool isAny0() const;
         // Return 'true' if the value of any bit in this array is 0, and
         // 'false' otherwise.
@@ -1738,6 +1786,66 @@ bsl::size_t BitArray::find1AtMinIndex(bsl::size_t begin, bsl::size_t end) const
     return bdlb::BitStringUtil::find1AtMinIndex(data(), begin, end);
 }
 
+inline
+bsl::size_t BitArray::findNth0AtMaxIndex(bsl::size_t n,
+                                        bsl::size_t begin,
+                                        bsl::size_t end) const
+{
+    if (k_INVALID_INDEX == end) {
+        end = d_length;
+    }
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+
+    return bdlb::BitStringUtil::findNth0AtMaxIndex(data(), begin, end, n);
+}
+
+inline
+bsl::size_t BitArray::findNth0AtMinIndex(bsl::size_t n,
+                                        bsl::size_t begin,
+                                        bsl::size_t end) const
+{
+    if (k_INVALID_INDEX == end) {
+        end = d_length;
+    }
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+
+    return bdlb::BitStringUtil::findNth0AtMinIndex(data(), begin, end, n);
+}
+
+inline
+bsl::size_t BitArray::findNth1AtMaxIndex(bsl::size_t n,
+                                        bsl::size_t begin,
+                                        bsl::size_t end) const
+{
+    if (k_INVALID_INDEX == end) {
+        end = d_length;
+    }
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+
+    return bdlb::BitStringUtil::findNth1AtMaxIndex(data(), begin, end, n);
+}
+
+inline
+bsl::size_t BitArray::findNth1AtMinIndex(bsl::size_t n,
+                                        bsl::size_t begin,
+                                        bsl::size_t end) const
+{
+    if (k_INVALID_INDEX == end) {
+        end = d_length;
+    }
+    BSLS_ASSERT(0 < n);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+
+    return bdlb::BitStringUtil::findNth1AtMinIndex(data(), begin, end, n);
+}
+
 inline
 bool BitArray::isAny0() const
 {
@@ -134,6 +134,10 @@ using bsl::uint64_t;
 // [28] size_t find0AtMinIndex(size_t begin, size_t end) const;
 // [27] size_t find1AtMaxIndex(size_t begin, size_t end) const;
 // [28] size_t find1AtMinIndex(size_t begin, size_t end) const;
+// [31] size_t findNth0AtMaxIndex(size_t n, size_t begin, size_t end) const;
+// [31] size_t findNth0AtMinIndex(size_t n, size_t begin, size_t end) const;
+// [31] size_t findNth1AtMaxIndex(size_t n, size_t begin, size_t end) const;
+// [31] size_t findNth1AtMinIndex(size_t n, size_t begin, size_t end) const;
 // [ 4] bool isAny0() const;
 // [ 4] bool isAny1() const;
 // [ 4] bool isEmpty() const;
@@ -157,7 +161,7 @@ using bsl::uint64_t;
 // [ 5] ostream& operator<<(ostream&, const BitArray&);
 // [ 8] void swap(BitArray& lhs, BitArray& rhs);
 //-----------------------------------------------------------------------------
-// [31] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 // [ 3] BitArray gDispatch(const char *spec);
 // [ 3] BitArray& gg(BitArray* object, const char *spec);
 // [ 3] BitArray& ggDispatch(BitArray* object, const char *spec);
@@ -1361,6 +1365,151 @@ void testFind1AtMinIndex()
         }
 }
 
+static
+void testFindNthIndex()
+    // Test all overloads of the 'findNth[01]At(Max|Min)Index' methods.  See
+    // documentation in case 31 of the main 'switch' statement.
+{
+        bslma::TestAllocator testAllocator(veryVeryVerbose);
+
+        const char *SPECS[] = {
+           "0",      "01",     "011",    "0110",   "01100", "111111",
+           "0110001",         "01100011",         "011000110",
+           "0000100011100001001100000100110",
+           "00001000111000010011000001001101",
+           "000010001110000100110000010011010000100011100001001100000100110",
+           "0000100011100001001100000100110100001000111000010011000001001100",
+           "00001000111000010011000001001101000010001110000100110000010011001",
+           "xhaq5haq5w3", "xh4w7q9ha", "xqah5yca532wdwb",
+           "xh01wwww0", "xwwww0h01h0", "xww0h01h0ww0",
+           0}; // Null string required as last element.
+
+        {
+            // Verify results for empty array.
+
+            const Obj X;
+            ASSERT(k_INVALID_INDEX == X.findNth0AtMaxIndex(1));
+            ASSERT(k_INVALID_INDEX == X.findNth0AtMinIndex(1));
+            ASSERT(k_INVALID_INDEX == X.findNth1AtMaxIndex(1));
+            ASSERT(k_INVALID_INDEX == X.findNth1AtMinIndex(1));
+        }
+
+        for (int ti = 0; SPECS[ti]; ++ti) {
+            for (int flip = 0; flip < 2; ++flip) {
+                const char *const DST = SPECS[ti];
+
+                Obj          mX;
+                const Obj&   X      = ggDispatch(&mX, DST);
+                const size_t curLen = X.length();
+
+                if (flip) {
+                    mX.toggleAll();
+                }
+
+                const Obj XX(X, &testAllocator);
+                ASSERT(XX.length() == curLen);
+
+                const Int64 BB = testAllocator.numBlocksTotal();
+
+                // Since the 'find[01]At(Max|Min)Index' methods are tested in
+                // cases 27 and 28, they are used as oracles: the 'n'th bit
+                // from the bottom of a range is found by repeatedly finding
+                // the next bit above the previous one.
+
+                for (size_t begin = 0; begin <= curLen; begin += 3) {
+                    for (size_t end = begin; end <= curLen; ++end) {
+                        size_t exp0Min = begin, exp1Min = begin;
+                        size_t exp0Max = end,   exp1Max = end;
+
+                        for (size_t n = 1; n <= end - begin + 1; ++n) {
+                            exp0Min = k_INVALID_INDEX == exp0Min
+                                    ? k_INVALID_INDEX
+                                    : X.find0AtMinIndex(exp0Min + (n > 1),
+                                                        end);
+                            exp1Min = k_INVALID_INDEX == exp1Min
+                                    ? k_INVALID_INDEX
+                                    : X.find1AtMinIndex(exp1Min + (n > 1),
+                                                        end);
+                            exp0Max = k_INVALID_INDEX == exp0Max
+                                    ? k_INVALID_INDEX
+                                    : X.find0AtMaxIndex(begin, exp0Max);
+                            exp1Max = k_INVALID_INDEX == exp1Max
+                                    ? k_INVALID_INDEX
+                                    : X.find1AtMaxIndex(begin, exp1Max);
+
+                            ASSERTV(DST, flip, begin, end, n, exp0Min ==
+                                        X.findNth0AtMinIndex(n, begin, end));
+                            ASSERTV(DST, flip, begin, end, n, exp1Min ==
+                                        X.findNth1AtMinIndex(n, begin, end));
+                            ASSERTV(DST, flip, begin, end, n, exp0Max ==
+                                        X.findNth0AtMaxIndex(n, begin, end));
+                            ASSERTV(DST, flip, begin, end, n, exp1Max ==
+                                        X.findNth1AtMaxIndex(n, begin, end));
+
+                            if (curLen == end) {
+                                ASSERT(X.findNth0AtMinIndex(n, begin) ==
+                                                                      exp0Min);
+                                ASSERT(X.findNth1AtMaxIndex(n, begin) ==
+                                                                      exp1Max);
+
+                                if (0 == begin) {
+                                    ASSERT(X.findNth0AtMaxIndex(n) ==
+                                                                      exp0Max);
+                                    ASSERT(X.findNth1AtMinIndex(n) ==
+                                                                      exp1Min);
+                                }
+                            }
+                        }
+
+                        ASSERT(XX == X);
+                    }
+                }
+
+                ASSERT(BB == testAllocator.numBlocksTotal());
+            }
+        }
+
+        {
+            Obj mX;    const Obj& X = ggDispatch(&mX, "xwa");
+
+            bsls::AssertTestHandlerGuard guard;
+
+            size_t len = X.length();
+
+            ASSERT_PASS(X.findNth0AtMinIndex(1));
+            ASSERT_PASS(X.findNth0AtMinIndex(1, len / 2));
+            ASSERT_PASS(X.findNth0AtMinIndex(1,     len,     len));
+            ASSERT_FAIL(X.findNth0AtMinIndex(0));
+            ASSERT_FAIL(X.findNth0AtMinIndex(1, len + 1));
+            ASSERT_FAIL(X.findNth0AtMinIndex(1, len / 2, len/2-1));
+            ASSERT_FAIL(X.findNth0AtMinIndex(1,       0, len + 1));
+
+            ASSERT_PASS(X.findNth0AtMaxIndex(1));
+            ASSERT_PASS(X.findNth0AtMaxIndex(1, len / 2));
+            ASSERT_PASS(X.findNth0AtMaxIndex(1,     len,     len));
+            ASSERT_FAIL(X.findNth0AtMaxIndex(0));
+            ASSERT_FAIL(X.findNth0AtMaxIndex(1, len + 1));
+            ASSERT_FAIL(X.findNth0AtMaxIndex(1, len / 2, len/2-1));
+            ASSERT_FAIL(X.findNth0AtMaxIndex(1,       0, len + 1));
+
+            ASSERT_PASS(X.findNth1AtMinIndex(1));
+            ASSERT_PASS(X.findNth1AtMinIndex(1, len / 2));
+            ASSERT_PASS(X.findNth1AtMinIndex(1,     len,     len));
+            ASSERT_FAIL(X.findNth1AtMinIndex(0));
+            ASSERT_FAIL(X.findNth1AtMinIndex(1, len + 1));
+            ASSERT_FAIL(X.findNth1AtMinIndex(1, len / 2, len/2-1));
+            ASSERT_FAIL(X.findNth1AtMinIndex(1,       0, len + 1));
+
+            ASSERT_PASS(X.findNth1AtMaxIndex(1));
+            ASSERT_PASS(X.findNth1AtMaxIndex(1, len / 2));
+            ASSERT_PASS(X.findNth1AtMaxIndex(1,     len,     len));
+            ASSERT_FAIL(X.findNth1AtMaxIndex(0));
+            ASSERT_FAIL(X.findNth1AtMaxIndex(1, len + 1));
+            ASSERT_FAIL(X.findNth1AtMaxIndex(1, len / 2, len/2-1));
+            ASSERT_FAIL(X.findNth1AtMaxIndex(1,       0, len + 1));
+        }
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1417,7 +1566,7 @@ int main(int argc, char *argv[])
     strcat(LONG_SPEC_9, LONG_SPEC_1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1438,6 +1587,58 @@ int main(int argc, char *argv[])
 
         testUsage();
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // TESTING FINDNTH[01]AT(MAX|MIN)INDEX METHODS
+        //   Ensure the methods return the expected value.
+        //
+        // Concerns:
+        //: 1 The correct result is obtained, including 'k_INVALID_INDEX' when
+        //:   the range has fewer than 'n' bits of the value sought.
+        //:
+        //: 2 The object is unchanged.
+        //:
+        //: 3 Memory is not allocated.
+        //:
+        //: 4 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each of a sequence of specifications and their complements,
+        //:   create an object X from that specification.
+        //:
+        //: 2 Copy construct 'XX' from 'X', to be compared later to ensure 'X'
+        //:   hasn't changed.
+        //:
+        //: 3 Iterate over ranges '[begin .. end)' of 'X', and over 'n' from 1
+        //:   to one more than the length of the range.
+        //:
+        //: 4 Find the expected 'n'th set and clear bits from each end of the
+        //:   range by applying the (previously tested) 'find[01]AtMinIndex'
+        //:   and 'find[01]AtMaxIndex' methods 'n' times.
+        //:
+        //: 5 Call the functions, allowing optional args to default if the
+        //:   default values match 'begin' or 'end', and observe that the
+        //:   results are as expected.  (C-1)
+        //:
+        //: 6 Verify that 'XX == X'.  (C-2)
+        //:
+        //: 7 After the loops, verify that no memory has been allocated since
+        //:   'XX' was created.  (C-3)
+        //:
+        //: 8 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   size_t findNth0AtMaxIndex(size_t n, size_t b, size_t e) const;
+        //   size_t findNth0AtMinIndex(size_t n, size_t b, size_t e) const;
+        //   size_t findNth1AtMaxIndex(size_t n, size_t b, size_t e) const;
+        //   size_t findNth1AtMinIndex(size_t n, size_t b, size_t e) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING FINDNTH[01]AT(MAX|MIN)INDEX METHODS\n"
+                               "===========================================\n";
+
+        testFindNthIndex();
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING RANGE-BASED NUM0, NUM1
@@ -0,0 +1,449 @@
+// bdlcc_epochreclaimer.cpp                                           -*-C++-*-
+#include <bdlcc_epochreclaimer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_epochreclaimer_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_once.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_log.h>
+#include <bsls_logseverity.h>
+
+#include <bsl_cstring.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// This component implements the classic three-epoch scheme.  A pinned thread
+// announces the global epoch it observed in its record.  The global epoch can
+// advance from 'E' to 'E + 1' only once every pinned thread has announced
+// 'E'.  An object retired while the global epoch is 'E' was unlinked before
+// the retirement, so any thread that can still reach it is pinned at an epoch
+// no later than 'E'; once the global epoch reaches 'E + 2' no such thread can
+// remain pinned, and the object can be released.  Each record therefore keeps
+// one limbo list per epoch modulo 3.
+//
+// Records are never deallocated before the reclaimer is destroyed, so the
+// record list can be traversed without protection.  A record released by an
+// exiting thread keeps its limbo lists, and is reused (together with the
+// pending retirements) by the next thread that needs a record.
+//
+// Each thread owns a 'ThreadRecords' table, reached through a single
+// process-wide thread-specific storage key, mapping reclaimer slots to the
+// records of that thread.  The owning thread reads its table without
+// synchronization.  The table array is replaced (when a thread first uses a
+// slot beyond its length) only by the owning thread while holding the
+// registry lock, and an element is cleared, also under the lock, only by the
+// destructor of the reclaimer owning that slot; as no thread may use a
+// reclaimer while it is being destroyed, the owning thread never reads an
+// element concurrently with its being cleared.  The thread-exit handler
+// releases the records of the exiting thread under the same lock, so it never
+// observes a record whose reclaimer has been destroyed.  Slots of destroyed
+// reclaimers are reused, and the free-slot list is kept with a capacity at
+// least the number of slots ever assigned, so that a destructor returning its
+// slot never allocates.
+//
+// The registry is created once and intentionally never destroyed, so that it
+// remains usable by threads exiting during static destruction.
+
+namespace BloombergLP {
+namespace bdlcc {
+namespace {
+
+struct ThreadRecords {
+    // This 'struct' holds the records owned by a thread, indexed by the slot
+    // of the reclaimer to which each record belongs.
+
+    void          **d_records_p;  // records, indexed by slot (owned)
+
+    int             d_numSlots;   // length of 'd_records_p'
+
+    ThreadRecords  *d_prev_p;     // previous table in the registry
+
+    ThreadRecords  *d_next_p;     // next table in the registry
+};
+
+struct Registry {
+    // This 'struct' holds the process-wide state shared by all reclaimers.
+
+    bslmt::Mutex            d_lock;             // guards all members below
+                                                // and the tables' arrays
+
+    bslmt::ThreadUtil::Key  d_key;              // key of the thread's
+                                                // 'ThreadRecords'
+
+    bool                    d_isKeyValid;       // 'true' if 'd_key' was
+                                                // created
+
+    ThreadRecords          *d_threadRecords_p;  // list of all tables
+
+    int                     d_numSlots;         // number of slots assigned
+
+    bsl::vector<int>        d_freeSlots;        // slots of destroyed
+                                                // reclaimers
+
+    bslma::Allocator       *d_allocator_p;      // memory allocator (held, not
+                                                // owned)
+
+    explicit Registry(bslma::Allocator *allocator)
+    : d_isKeyValid(false)
+    , d_threadRecords_p(0)
+    , d_numSlots(0)
+    , d_freeSlots(allocator)
+    , d_allocator_p(allocator)
+    {
+    }
+};
+
+extern "C"
+void bdlcc_EpochReclaimer_releaseThreadRecords(void *threadRecords);
+    // Release the records in the specified 'threadRecords' table of the
+    // exiting thread, and destroy the table.
+
+Registry& registry()
+    // Return a reference to the process-wide registry, creating it on first
+    // use.
+{
+    static Registry *s_registry_p;
+
+    BSLMT_ONCE_DO {
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        Registry *registry = new (*allocator) Registry(allocator);
+
+        registry->d_isKeyValid = 0 == bslmt::ThreadUtil::createKey(
+                                   &registry->d_key,
+                                   &bdlcc_EpochReclaimer_releaseThreadRecords);
+        if (!registry->d_isKeyValid) {
+            bsls::Log::platformDefaultMessageHandler(
+                   bsls::LogSeverity::e_ERROR,
+                   __FILE__,
+                   __LINE__,
+                   "Failed to create the thread-specific storage key of "
+                   "'bdlcc::EpochReclaimer'; records will be located by "
+                   "thread id and not reused after thread exit.");
+        }
+        s_registry_p = registry;
+    }
+
+    return *s_registry_p;
+}
+
+extern "C"
+void bdlcc_EpochReclaimer_releaseThreadRecords(void *threadRecords)
+{
+    Registry&      reg   = registry();
+    ThreadRecords *table = static_cast<ThreadRecords *>(threadRecords);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&reg.d_lock);
+
+        for (int i = 0; i < table->d_numSlots; ++i) {
+            if (table->d_records_p[i]) {
+                EpochReclaimer::releaseThreadRecord(table->d_records_p[i]);
+            }
+        }
+
+        if (table->d_prev_p) {
+            table->d_prev_p->d_next_p = table->d_next_p;
+        }
+        else {
+            reg.d_threadRecords_p = table->d_next_p;
+        }
+        if (table->d_next_p) {
+            table->d_next_p->d_prev_p = table->d_prev_p;
+        }
+    }
+
+    reg.d_allocator_p->deallocate(table->d_records_p);
+    reg.d_allocator_p->deallocate(table);
+}
+
+ThreadRecords *threadRecords(int slot)
+    // Return the table of the calling thread, creating it if necessary, and
+    // grow the table, if necessary, to hold the specified 'slot'.  Return 0
+    // if the per-thread tables are unavailable.
+{
+    Registry& reg = registry();
+    if (!reg.d_isKeyValid) {
+        return 0;                                                     // RETURN
+    }
+
+    ThreadRecords *table = static_cast<ThreadRecords *>(
+                                   bslmt::ThreadUtil::getSpecific(reg.d_key));
+    if (table && slot < table->d_numSlots) {
+        return table;                                                 // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&reg.d_lock);
+
+    if (0 == table) {
+        table = static_cast<ThreadRecords *>(
+                           reg.d_allocator_p->allocate(sizeof(ThreadRecords)));
+        table->d_records_p = 0;
+        table->d_numSlots  = 0;
+        table->d_prev_p    = 0;
+        table->d_next_p    = reg.d_threadRecords_p;
+        if (reg.d_threadRecords_p) {
+            reg.d_threadRecords_p->d_prev_p = table;
+        }
+        reg.d_threadRecords_p = table;
+
+        bslmt::ThreadUtil::setSpecific(reg.d_key, table);
+    }
+
+    const bsl::size_t   size    = reg.d_numSlots * sizeof(void *);
+    void              **records = static_cast<void **>(
+                                           reg.d_allocator_p->allocate(size));
+
+    bsl::memset(records, 0, size);
+    if (table->d_numSlots) {
+        bsl::memcpy(records,
+                    table->d_records_p,
+                    table->d_numSlots * sizeof(void *));
+    }
+    reg.d_allocator_p->deallocate(table->d_records_p);
+
+    table->d_records_p = records;
+    table->d_numSlots  = reg.d_numSlots;
+
+    return table;
+}
+
+}  // close unnamed namespace
+
+                           // --------------------
+                           // class EpochReclaimer
+                           // --------------------
+
+// PRIVATE MANIPULATORS
+EpochReclaimer::Record *EpochReclaimer::acquireRecord()
+{
+    // Prepare the table of the calling thread first, so that a failure to
+    // allocate it does not leave a record marked as in use.
+
+    ThreadRecords *table = threadRecords(d_slot);
+
+    Record *rec = d_records_p.loadAcquire();
+    while (rec) {
+        if (!rec->d_inUse.loadRelaxed()
+         && !rec->d_inUse.testAndSwap(false, true)) {
+            break;
+        }
+        rec = rec->d_next_p;
+    }
+
+    if (0 == rec) {
+        rec = new (*d_allocator_p) Record();
+        rec->d_inUse.storeRelaxed(true);
+        rec->d_nesting    = 0;
+        rec->d_numRetired = 0;
+        for (int i = 0; i < k_NUM_EPOCHS; ++i) {
+            rec->d_limboEpoch[i] = 0;
+            rec->d_limbo_p[i]    = new (*d_allocator_p) bsl::vector<Retired>(
+                                                                d_allocator_p);
+        }
+
+        Record *head = d_records_p.loadRelaxed();
+        do {
+            rec->d_next_p = head;
+            head          = d_records_p.testAndSwap(rec->d_next_p, rec);
+        } while (head != rec->d_next_p);
+    }
+
+    rec->d_owner.storeRelaxed(bslmt::ThreadUtil::selfIdAsUint64());
+
+    if (table) {
+        table->d_records_p[d_slot] = rec;
+    }
+    return rec;
+}
+
+void EpochReclaimer::collect(Record *record)
+{
+    const bsls::Types::Uint64 epoch = d_epoch.load();
+
+    for (int i = 0; i < k_NUM_EPOCHS; ++i) {
+        if (record->d_limboEpoch[i] + 2 <= epoch) {
+            releaseLimbo(record->d_limbo_p[i]);
+        }
+    }
+}
+
+void EpochReclaimer::releaseLimbo(bsl::vector<Retired> *limbo)
+{
+    for (bsl::size_t i = 0; i < limbo->size(); ++i) {
+        const Retired& retired = (*limbo)[i];
+        retired.d_deleter(retired.d_object_p, retired.d_allocator_p);
+    }
+    limbo->clear();
+}
+
+bool EpochReclaimer::tryAdvance()
+{
+    const bsls::Types::Uint64 epoch = d_epoch.load();
+
+    for (Record *rec = d_records_p.loadAcquire(); rec; rec = rec->d_next_p) {
+        const bsls::Types::Uint64 state = rec->d_state.load();
+        if ((state & 1) && (state >> 1) != epoch) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return epoch == d_epoch.testAndSwap(epoch, epoch + 1);
+}
+
+// CLASS METHODS
+void EpochReclaimer::releaseThreadRecord(void *record)
+{
+    Record *rec = static_cast<Record *>(record);
+
+    BSLS_ASSERT(0 == rec->d_nesting);
+
+    rec->d_owner.storeRelaxed(0);
+    rec->d_inUse.storeRelease(false);
+}
+
+// CREATORS
+EpochReclaimer::EpochReclaimer(bslma::Allocator *basicAllocator)
+: d_epoch(0)
+, d_records_p(0)
+, d_slot(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    Registry& reg = registry();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&reg.d_lock);
+
+    if (reg.d_freeSlots.empty()) {
+        reg.d_freeSlots.reserve(reg.d_numSlots + 1);
+        d_slot = reg.d_numSlots++;
+    }
+    else {
+        d_slot = reg.d_freeSlots.back();
+        reg.d_freeSlots.pop_back();
+    }
+}
+
+EpochReclaimer::~EpochReclaimer()
+{
+    Registry& reg = registry();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&reg.d_lock);
+
+        for (ThreadRecords *table = reg.d_threadRecords_p;
+             table;
+             table = table->d_next_p) {
+            if (d_slot < table->d_numSlots) {
+                table->d_records_p[d_slot] = 0;
+            }
+        }
+        reg.d_freeSlots.push_back(d_slot);
+    }
+
+    Record *rec = d_records_p.loadRelaxed();
+    while (rec) {
+        Record *next = rec->d_next_p;
+
+        BSLS_ASSERT(0 == (rec->d_state.loadRelaxed() & 1));
+
+        for (int i = 0; i < k_NUM_EPOCHS; ++i) {
+            releaseLimbo(rec->d_limbo_p[i]);
+            d_allocator_p->deleteObject(rec->d_limbo_p[i]);
+        }
+        d_allocator_p->deleteObject(rec);
+        rec = next;
+    }
+}
+
+// PRIVATE ACCESSORS
+EpochReclaimer::Record *EpochReclaimer::record() const
+{
+    const Registry& reg = registry();
+
+    if (reg.d_isKeyValid) {
+        const ThreadRecords *table = static_cast<const ThreadRecords *>(
+                                   bslmt::ThreadUtil::getSpecific(reg.d_key));
+
+        return table && d_slot < table->d_numSlots
+               ? static_cast<Record *>(table->d_records_p[d_slot])
+               : 0;                                                   // RETURN
+    }
+
+    const bsls::Types::Uint64 self = bslmt::ThreadUtil::selfIdAsUint64();
+
+    for (Record *rec = d_records_p.loadAcquire(); rec; rec = rec->d_next_p) {
+        if (self == rec->d_owner.loadRelaxed()) {
+            return rec;                                               // RETURN
+        }
+    }
+    return 0;
+}
+
+// MANIPULATORS
+void EpochReclaimer::reclaim()
+{
+    Record *rec = record();
+    if (0 == rec) {
+        rec = acquireRecord();
+    }
+
+    rec->d_numRetired = 0;
+    tryAdvance();
+    collect(rec);
+}
+
+void EpochReclaimer::retire(void             *object,
+                            Deleter           deleter,
+                            bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(object);
+    BSLS_ASSERT(deleter);
+
+    Record *rec = record();
+    if (0 == rec) {
+        rec = acquireRecord();
+    }
+
+    const bsls::Types::Uint64 epoch = d_epoch.load();
+    const int                 index = static_cast<int>(epoch % k_NUM_EPOCHS);
+
+    if (rec->d_limboEpoch[index] != epoch) {
+        // The list holds objects retired at least three epochs ago, all of
+        // which are unreachable.
+
+        releaseLimbo(rec->d_limbo_p[index]);
+        rec->d_limboEpoch[index] = epoch;
+    }
+
+    Retired retired = { object, deleter, allocator };
+    rec->d_limbo_p[index]->push_back(retired);
+
+    if (++rec->d_numRetired >= k_BATCH_SIZE) {
+        reclaim();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,494 @@
+// bdlcc_epochreclaimer.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLCC_EPOCHRECLAIMER
+#define INCLUDED_BDLCC_EPOCHRECLAIMER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide epoch-based reclamation of memory shared between threads.
+//
+//@CLASSES:
+//  bdlcc::EpochReclaimer: epoch-based memory reclamation mechanism
+//  bdlcc::EpochReclaimerGuard: guard pinning the calling thread to a reclaimer
+//
+//@SEE_ALSO: bdlcc_lockfreeunorderedmap
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlcc::EpochReclaimer',
+// that allows the nodes of a concurrent data structure to be read without
+// locks or reference counts, and a guard, 'bdlcc::EpochReclaimerGuard', that
+// brackets such reads.  A thread accessing shared objects *pins* itself to
+// the reclaimer for the duration of the access.  A thread that unlinks an
+// object from the data structure does not free it immediately; instead it
+// *retires* the object, supplying a deleter and an allocator, and the
+// reclaimer invokes the deleter once no pinned thread can still hold a
+// reference to the object.
+//
+// Pinning and unpinning touch only memory owned by the calling thread, so
+// readers do not contend on a shared counter or lock.  This makes the
+// mechanism suitable for taking shared atomic operations off the read path of
+// read-mostly containers.
+//
+///Epochs
+///------
+// The reclaimer maintains a global epoch number.  A thread that pins announces
+// the epoch it observed in a per-thread record.  The global epoch advances
+// only once every pinned thread has observed the current epoch, and an object
+// retired in epoch 'E' is released once the global epoch reaches 'E + 2', at
+// which point no thread pinned before the retirement can remain pinned.
+//
+// Retired objects are collected in per-thread lists, and the calling thread
+// attempts to advance the epoch and release its reclaimable objects once per
+// 'k_BATCH_SIZE' retirements, so that memory is freed in batches and the cost
+// of scanning the per-thread records is amortized.  'reclaim' can be called to
+// make such an attempt explicitly.  Note that a thread that stays pinned
+// indefinitely prevents the epoch from advancing, and therefore prevents all
+// retired memory from being released.  All retired objects are released when
+// the reclaimer is destroyed.
+//
+///Per-Thread Records
+///------------------
+// A per-thread record is allocated the first time a thread pins or retires.
+// Records are located through a table owned by each thread and indexed by a
+// small integer *slot* assigned to each reclaimer on construction (and reused
+// once the reclaimer is destroyed).  The per-thread tables are reached through
+// a single thread-specific storage key shared by all reclaimers in the
+// process, so the number of 'bdlcc::EpochReclaimer' objects is not limited by
+// the number of keys (see 'bslmt::ThreadUtil::createKey') available.  When a
+// thread exits, its records (including any objects it retired that have not
+// yet been released) are made available to the next threads that need one;
+// records are deallocated only when their reclaimer is destroyed.
+//
+// Should the shared key be unavailable (because the process has exhausted its
+// thread-specific storage keys), an error is logged and the reclaimers fall
+// back to locating the record of the calling thread by thread id.  In that
+// mode, the records of exited threads are not made available for reuse.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::EpochReclaimer' is fully thread-safe (see
+// {'bsldoc_glossary'|Fully Thread-Safe}), assuming that the allocator is fully
+// thread-safe.  Deleters may be invoked from any thread that calls 'retire'
+// or 'reclaim', and from the thread destroying the reclaimer.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Lock-Free Configuration Holder
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server holds a configuration object that is read by many
+// threads and occasionally replaced.  We want readers to access the current
+// configuration without taking a lock, while ensuring that a replaced
+// configuration is not freed while a reader may still be using it.
+//
+// First, we define the configuration holder, which publishes the
+// configuration through an atomic pointer and owns an
+// 'bdlcc::EpochReclaimer':
+//..
+//  class ConfigHolder {
+//      // This class holds a configuration string that can be read and
+//      // replaced concurrently.
+//
+//      // DATA
+//      bsls::AtomicPointer<bsl::string>  d_config;     // current config
+//      mutable bdlcc::EpochReclaimer     d_reclaimer;  // reclamation
+//      bslma::Allocator                 *d_allocator_p;
+//
+//    public:
+//      // CREATORS
+//      explicit ConfigHolder(bslma::Allocator *basicAllocator = 0)
+//      : d_config(0)
+//      , d_reclaimer(basicAllocator)
+//      , d_allocator_p(bslma::Default::allocator(basicAllocator))
+//      {
+//          d_config = new (*d_allocator_p) bsl::string(d_allocator_p);
+//      }
+//
+//      ~ConfigHolder()
+//      {
+//          d_allocator_p->deleteObject(d_config.load());
+//      }
+//
+//      // MANIPULATORS
+//      void setConfig(const bsl::string& config)
+//          // Replace the configuration with the specified 'config'.
+//      {
+//          bsl::string *newConfig = new (*d_allocator_p) bsl::string(
+//                                                              config,
+//                                                              d_allocator_p);
+//          bsl::string *oldConfig = d_config.swap(newConfig);
+//..
+// The previous configuration is no longer reachable by readers that pin from
+// now on, but readers pinned earlier may still be using it, so we retire it
+// instead of deleting it:
+//..
+//          d_reclaimer.retireObject(oldConfig, d_allocator_p);
+//      }
+//
+//      // ACCESSORS
+//      bsl::size_t configLength() const
+//          // Return the length of the current configuration.
+//      {
+//          bdlcc::EpochReclaimerGuard guard(&d_reclaimer);
+//
+//          return d_config.loadAcquire()->length();
+//      }
+//  };
+//..
+// Then, we create a holder and replace its configuration a number of times:
+//..
+//  ConfigHolder holder;
+//
+//  for (int i = 0; i < 1000; ++i) {
+//      holder.setConfig(bsl::string(i % 10, 'x'));
+//  }
+//..
+// Finally, we read the current configuration:
+//..
+//  assert(9 == holder.configLength());
+//..
+// Note that the configurations retired by 'setConfig' are released in batches
+// as the epoch advances, and any that remain are released when the holder,
+// and therefore the reclaimer, is destroyed.
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                           // ====================
+                           // class EpochReclaimer
+                           // ====================
+
+class EpochReclaimer {
+    // This class provides epoch-based reclamation of objects shared between
+    // threads.  A thread accessing shared objects must bracket the access with
+    // calls to 'pin' and 'unpin' (or use an 'EpochReclaimerGuard'); objects
+    // passed to 'retire' are released only after every thread pinned at the
+    // time of the call has unpinned.
+
+  public:
+    // PUBLIC TYPES
+    typedef void (*Deleter)(void *object, bslma::Allocator *allocator);
+        // 'Deleter' is an alias for a function that destroys and deallocates
+        // the specified 'object' using the specified 'allocator'.
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_BATCH_SIZE = 64  // number of retirements by a thread between
+                           // attempts to advance the global epoch
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Retired {
+        // A retired object awaiting reclamation.
+
+        void             *d_object_p;     // retired object
+        Deleter           d_deleter;      // function releasing 'd_object_p'
+        bslma::Allocator *d_allocator_p;  // allocator passed to 'd_deleter'
+    };
+
+    enum {
+        k_NUM_EPOCHS = 3  // number of distinct epochs that may hold retired
+                          // objects
+    };
+
+    struct Record {
+        // Per-thread state.  'd_state' is the only member read by other
+        // threads; all other members are accessed only by the owning thread.
+
+        bsls::AtomicUint64    d_state;       // '(epoch << 1) | isPinned'
+
+        bsls::AtomicBool      d_inUse;       // 'true' if owned by a thread
+
+        bsls::AtomicUint64    d_owner;       // id of the owning thread, or 0
+
+        Record               *d_next_p;      // next record (immutable once
+                                             // published)
+
+        int                   d_nesting;     // number of nested 'pin' calls
+
+        int                   d_numRetired;  // retirements since last attempt
+                                             // to advance the epoch
+
+        bsls::Types::Uint64   d_limboEpoch[k_NUM_EPOCHS];
+                                             // epoch of each limbo list
+
+        bsl::vector<Retired> *d_limbo_p[k_NUM_EPOCHS];
+                                             // objects retired, by epoch
+
+        char                  d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                             // padding to prevent false
+                                             // sharing between records
+    };
+
+    // DATA
+    bsls::AtomicUint64           d_epoch;       // global epoch
+
+    bsls::AtomicPointer<Record>  d_records_p;   // list of all records
+
+    int                          d_slot;        // index of this reclaimer's
+                                                // records in the per-thread
+                                                // tables
+
+    bslma::Allocator            *d_allocator_p; // memory allocator (held, not
+                                                // owned)
+
+    // NOT IMPLEMENTED
+    EpochReclaimer(const EpochReclaimer&);
+    EpochReclaimer& operator=(const EpochReclaimer&);
+
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static void deleteObject(void *object, bslma::Allocator *allocator);
+        // Destroy the specified 'object' of (template parameter) 'TYPE' and
+        // return its memory to the specified 'allocator'.
+
+    // PRIVATE MANIPULATORS
+    Record *acquireRecord();
+        // Return the address of a record owned by the calling thread,
+        // obtaining an unused record or allocating a new record, and make it
+        // the record of the calling thread for this reclaimer.  The behavior
+        // is undefined if the calling thread already owns a record of this
+        // reclaimer.
+
+    void collect(Record *record);
+        // Release the objects retired to the specified 'record' that can no
+        // longer be accessed by any thread.
+
+    void releaseLimbo(bsl::vector<Retired> *limbo);
+        // Invoke the deleter of every object in the specified 'limbo' list,
+        // and make 'limbo' empty.
+
+    bool tryAdvance();
+        // Advance the global epoch if every pinned thread has observed the
+        // current epoch.  Return 'true' if the epoch was advanced, and
+        // 'false' otherwise.
+
+    // PRIVATE ACCESSORS
+    Record *record() const;
+        // Return the address of the record owned by the calling thread, or 0
+        // if the calling thread does not own a record.
+
+  public:
+    // CLASS METHODS
+    static void releaseThreadRecord(void *record);
+        // Mark the specified 'record' as no longer owned by a thread.  This
+        // method is invoked, for each record owned by the exiting thread, on
+        // thread exit, and should not be called directly.
+
+    // CREATORS
+    explicit EpochReclaimer(bslma::Allocator *basicAllocator = 0);
+        // Create a reclaimer.  Optionally specify a 'basicAllocator' used to
+        // supply memory for the per-thread records.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Note that the
+        // memory of retired objects is released using the allocator supplied
+        // to 'retire', and that the per-thread tables shared by all
+        // reclaimers are supplied by 'bslma::NewDeleteAllocator'.
+
+    ~EpochReclaimer();
+        // Release all retired objects and destroy this reclaimer.  The
+        // behavior is undefined unless no thread is pinned.
+
+    // MANIPULATORS
+    void pin();
+        // Prevent the objects currently reachable by the calling thread from
+        // being reclaimed until the matching call to 'unpin'.  Calls to 'pin'
+        // may be nested.
+
+    void reclaim();
+        // Attempt to advance the global epoch, and release the objects
+        // retired by the calling thread that can no longer be accessed by any
+        // thread.  Note that this method is invoked implicitly once per
+        // 'k_BATCH_SIZE' calls to 'retire' by a thread.
+
+    void retire(void *object, Deleter deleter, bslma::Allocator *allocator);
+        // Schedule the specified 'object' to be released by invoking the
+        // specified 'deleter' with 'object' and the specified 'allocator'
+        // once no thread can still access 'object'.  The behavior is
+        // undefined unless 'object' is no longer reachable by threads that
+        // pin after this call, and 'deleter' does not invoke any method of
+        // this reclaimer.  Note that 'deleter' may be invoked before this
+        // method returns.
+
+    template <class TYPE>
+    void retireObject(TYPE *object, bslma::Allocator *allocator);
+        // Schedule the specified 'object' to be destroyed and its memory
+        // returned to the specified 'allocator' once no thread can still
+        // access 'object'.  The behavior is undefined unless 'object' was
+        // allocated from 'allocator', and 'object' is no longer reachable by
+        // threads that pin after this call.
+
+    void unpin();
+        // Release the protection established by the matching call to 'pin'.
+        // The behavior is undefined unless the calling thread is pinned.
+
+    // ACCESSORS
+    bsls::Types::Uint64 epoch() const;
+        // Return the current global epoch of this reclaimer.
+
+    bool isPinned() const;
+        // Return 'true' if the calling thread is pinned to this reclaimer, and
+        // 'false' otherwise.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this reclaimer to supply memory.
+};
+
+                         // =========================
+                         // class EpochReclaimerGuard
+                         // =========================
+
+class EpochReclaimerGuard {
+    // This class implements a guard that pins the calling thread to an
+    // 'EpochReclaimer' for its lifetime.
+
+    // DATA
+    EpochReclaimer *d_reclaimer_p;  // reclaimer (held, not owned)
+
+    // NOT IMPLEMENTED
+    EpochReclaimerGuard(const EpochReclaimerGuard&);
+    EpochReclaimerGuard& operator=(const EpochReclaimerGuard&);
+
+  public:
+    // CREATORS
+    explicit EpochReclaimerGuard(EpochReclaimer *reclaimer);
+        // Create a guard that pins the calling thread to the specified
+        // 'reclaimer'.
+
+    ~EpochReclaimerGuard();
+        // Unpin the calling thread and destroy this guard.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                           // --------------------
+                           // class EpochReclaimer
+                           // --------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+void EpochReclaimer::deleteObject(void *object, bslma::Allocator *allocator)
+{
+    allocator->deleteObject(static_cast<TYPE *>(object));
+}
+
+// MANIPULATORS
+inline
+void EpochReclaimer::pin()
+{
+    Record *rec = record();
+    if (0 == rec) {
+        rec = acquireRecord();
+    }
+    if (0 == rec->d_nesting++) {
+        // The sequentially consistent store orders the announcement of the
+        // epoch before any subsequent load of a shared object.
+
+        rec->d_state.store((d_epoch.load() << 1) | 1);
+    }
+}
+
+template <class TYPE>
+inline
+void EpochReclaimer::retireObject(TYPE *object, bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(allocator);
+
+    retire(const_cast<void *>(static_cast<const volatile void *>(object)),
+           &deleteObject<TYPE>,
+           allocator);
+}
+
+inline
+void EpochReclaimer::unpin()
+{
+    Record *rec = record();
+
+    BSLS_ASSERT(rec);
+    BSLS_ASSERT(0 < rec->d_nesting);
+
+    if (0 == --rec->d_nesting) {
+        rec->d_state.storeRelease(0);
+    }
+}
+
+// ACCESSORS
+inline
+bsls::Types::Uint64 EpochReclaimer::epoch() const
+{
+    return d_epoch.load();
+}
+
+inline
+bool EpochReclaimer::isPinned() const
+{
+    const Record *rec = record();
+
+    return rec && 0 < rec->d_nesting;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *EpochReclaimer::allocator() const
+{
+    return d_allocator_p;
+}
+
+                         // -------------------------
+                         // class EpochReclaimerGuard
+                         // -------------------------
+
+// CREATORS
+inline
+EpochReclaimerGuard::EpochReclaimerGuard(EpochReclaimer *reclaimer)
+: d_reclaimer_p(reclaimer)
+{
+    BSLS_ASSERT(reclaimer);
+
+    d_reclaimer_p->pin();
+}
+
+inline
+EpochReclaimerGuard::~EpochReclaimerGuard()
+{
+    d_reclaimer_p->unpin();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
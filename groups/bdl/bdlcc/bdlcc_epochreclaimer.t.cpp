@@ -0,0 +1,894 @@
+// bdlcc_epochreclaimer.t.cpp                                         -*-C++-*-
+
+#include <bdlcc_epochreclaimer.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_latch.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides an epoch-based reclamation mechanism.  We
+// first verify, with a single thread of execution, that pinning nests, that
+// retired objects are not released while the retiring thread is pinned, that
+// they are released once the epoch has advanced twice, and that the
+// destructor releases all remaining objects.  We then verify that a pinned
+// thread prevents the release of objects retired by another thread, that the
+// records of exited threads are reused, and finally, that concurrent readers
+// never observe a released object.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Records are allocated from the object allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] EpochReclaimer(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~EpochReclaimer();
+//
+// MANIPULATORS
+// [ 2] void pin();
+// [ 3] void reclaim();
+// [ 3] void retire(void *object, Deleter deleter, Allocator *allocator);
+// [ 4] void retireObject(TYPE *object, bslma::Allocator *allocator);
+// [ 2] void unpin();
+//
+// ACCESSORS
+// [ 3] Uint64 epoch() const;
+// [ 2] bool isPinned() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// EpochReclaimerGuard
+// [ 2] EpochReclaimerGuard(EpochReclaimer *reclaimer);
+// [ 2] ~EpochReclaimerGuard();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 5] CONCERN: a pinned thread delays release of other threads' objects
+// [ 5] CONCERN: records of exited threads are reused
+// [ 6] CONCERN: concurrent readers never observe released objects
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::EpochReclaimer      Obj;
+typedef bdlcc::EpochReclaimerGuard Guard;
+typedef bsls::Types::Uint64        Uint64;
+
+// ============================================================================
+//                   GLOBAL STRUCTS/FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsls::AtomicInt s_numDeleted(0);
+
+void countingDeleter(void *object, bslma::Allocator *allocator)
+    // Deallocate the specified 'object' using the specified 'allocator', and
+    // increment 's_numDeleted'.
+{
+    allocator->deallocate(object);
+    ++s_numDeleted;
+}
+
+void retireBlocks(Obj *reclaimer, int numBlocks, bslma::Allocator *allocator)
+    // Allocate the specified 'numBlocks' blocks from the specified
+    // 'allocator', and retire them to the specified 'reclaimer' using
+    // 'countingDeleter'.
+{
+    for (int i = 0; i < numBlocks; ++i) {
+        reclaimer->retire(allocator->allocate(16),
+                          &countingDeleter,
+                          allocator);
+    }
+}
+
+void pinAndWait(Obj *reclaimer, bslmt::Latch *pinned, bslmt::Latch *done)
+    // Pin the calling thread to the specified 'reclaimer', arrive on the
+    // specified 'pinned' latch, and remain pinned until the specified 'done'
+    // latch is released.
+{
+    Guard guard(reclaimer);
+
+    pinned->arrive();
+    done->wait();
+}
+
+                            // ================
+                            // struct Payload
+                            // ================
+
+struct Payload {
+    // An object published to readers in the concurrency test.  'd_magic' is
+    // overwritten when the object is released, so that a reader accessing a
+    // released object can detect it.
+
+    enum { k_LIVE = 0x1234567, k_DEAD = 0x7654321 };
+
+    bsls::AtomicInt d_magic;
+    int             d_value;
+
+    explicit Payload(int value)
+        // Create a live payload having the specified 'value'.
+    : d_magic(k_LIVE)
+    , d_value(value)
+    {
+    }
+
+    ~Payload()
+        // Mark this object as released and destroy it.
+    {
+        d_magic = k_DEAD;
+    }
+};
+
+                          // ===================
+                          // class StressTestJob
+                          // ===================
+
+class StressTestJob {
+    // This class implements a job run by each thread of the concurrency test.
+    // Writer threads replace the published payload and retire the previous
+    // one, and reader threads verify that the payload they observe is live.
+
+    // DATA
+    Obj                          *d_reclaimer_p;
+    bsls::AtomicPointer<Payload> *d_payload_p;
+    bslmt::Barrier               *d_barrier_p;
+    bool                          d_isWriter;
+    int                           d_numIterations;
+    bslma::Allocator             *d_allocator_p;
+
+  public:
+    // CREATORS
+    StressTestJob(Obj                          *reclaimer,
+                  bsls::AtomicPointer<Payload> *payload,
+                  bslmt::Barrier               *barrier,
+                  bool                          isWriter,
+                  int                           numIterations,
+                  bslma::Allocator             *allocator)
+        // Create a job operating on the specified 'payload' protected by the
+        // specified 'reclaimer', synchronizing on the specified 'barrier',
+        // acting as a writer if the specified 'isWriter' is 'true', running
+        // the specified 'numIterations', and using the specified 'allocator'
+        // to supply memory for new payloads.
+    : d_reclaimer_p(reclaimer)
+    , d_payload_p(payload)
+    , d_barrier_p(barrier)
+    , d_isWriter(isWriter)
+    , d_numIterations(numIterations)
+    , d_allocator_p(allocator)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()()
+        // Run this job.
+    {
+        d_barrier_p->wait();
+
+        for (int i = 0; i < d_numIterations; ++i) {
+            if (d_isWriter) {
+                Payload *newPayload = new (*d_allocator_p) Payload(i);
+                Payload *oldPayload = d_payload_p->swap(newPayload);
+
+                d_reclaimer_p->retireObject(oldPayload, d_allocator_p);
+            }
+            else {
+                Guard guard(d_reclaimer_p);
+
+                const Payload *payload = d_payload_p->loadAcquire();
+                for (int j = 0; j < 10; ++j) {
+                    ASSERTV(i, j, Payload::k_LIVE == payload->d_magic);
+                }
+            }
+        }
+    }
+};
+
+// ============================================================================
+//                            USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Lock-Free Configuration Holder
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server holds a configuration object that is read by many
+// threads and occasionally replaced.  We want readers to access the current
+// configuration without taking a lock, while ensuring that a replaced
+// configuration is not freed while a reader may still be using it.
+//
+// First, we define the configuration holder, which publishes the
+// configuration through an atomic pointer and owns an
+// 'bdlcc::EpochReclaimer':
+//..
+    class ConfigHolder {
+        // This class holds a configuration string that can be read and
+        // replaced concurrently.
+
+        // DATA
+        bsls::AtomicPointer<bsl::string>  d_config;     // current config
+        mutable bdlcc::EpochReclaimer     d_reclaimer;  // reclamation
+        bslma::Allocator                 *d_allocator_p;
+
+      public:
+        // CREATORS
+        explicit ConfigHolder(bslma::Allocator *basicAllocator = 0)
+        : d_config(0)
+        , d_reclaimer(basicAllocator)
+        , d_allocator_p(bslma::Default::allocator(basicAllocator))
+        {
+            d_config = new (*d_allocator_p) bsl::string(d_allocator_p);
+        }
+
+        ~ConfigHolder()
+        {
+            d_allocator_p->deleteObject(d_config.load());
+        }
+
+        // MANIPULATORS
+        void setConfig(const bsl::string& config)
+            // Replace the configuration with the specified 'config'.
+        {
+            bsl::string *newConfig = new (*d_allocator_p) bsl::string(
+                                                              config,
+                                                              d_allocator_p);
+            bsl::string *oldConfig = d_config.swap(newConfig);
+//..
+// The previous configuration is no longer reachable by readers that pin from
+// now on, but readers pinned earlier may still be using it, so we retire it
+// instead of deleting it:
+//..
+            d_reclaimer.retireObject(oldConfig, d_allocator_p);
+        }
+
+        // ACCESSORS
+        bsl::size_t configLength() const
+            // Return the length of the current configuration.
+        {
+            bdlcc::EpochReclaimerGuard guard(&d_reclaimer);
+
+            return d_config.loadAcquire()->length();
+        }
+    };
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we create a holder and replace its configuration a number of times:
+//..
+    ConfigHolder holder;
+
+    for (int i = 0; i < 1000; ++i) {
+        holder.setConfig(bsl::string(i % 10, 'x'));
+    }
+//..
+// Finally, we read the current configuration:
+//..
+    ASSERT(9 == holder.configLength());
+//..
+// Note that the configurations retired by 'setConfig' are released in batches
+// as the epoch advances, and any that remain are released when the holder,
+// and therefore the reclaimer, is destroyed.
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT READERS AND WRITERS
+        //
+        // Concerns:
+        //: 1 An object retired while a reader may hold a reference to it is
+        //:   not released until that reader unpins.
+        //:
+        //: 2 All retired objects are eventually released.
+        //
+        // Plan:
+        //: 1 Publish a payload through an atomic pointer.  Run reader threads
+        //:   that pin, load the payload, and repeatedly verify that it is
+        //:   live, concurrently with writer threads that replace the payload
+        //:   and retire the previous one.  (C-1)
+        //:
+        //: 2 Verify that no memory is outstanding after the reclaimer and the
+        //:   last payload are destroyed.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: concurrent readers never observe released objects
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT READERS AND WRITERS" << endl
+                          << "==============================" << endl;
+
+        enum {
+            k_NUM_READERS    = 6,
+            k_NUM_WRITERS    = 2,
+            k_NUM_ITERATIONS = 20000
+        };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            bsls::AtomicPointer<Payload> payload(new (oa) Payload(-1));
+            {
+                Obj            mX(&oa);
+                bslmt::Barrier barrier(k_NUM_READERS + k_NUM_WRITERS);
+
+                bslmt::ThreadGroup threads(&oa);
+                for (int i = 0; i < k_NUM_READERS + k_NUM_WRITERS; ++i) {
+                    threads.addThread(StressTestJob(&mX,
+                                                    &payload,
+                                                    &barrier,
+                                                    i < k_NUM_WRITERS,
+                                                    k_NUM_ITERATIONS,
+                                                    &oa));
+                }
+                threads.joinAll();
+
+                if (veryVerbose) { P(mX.epoch()) }
+            }
+            oa.deleteObject(payload.load());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MULTIPLE THREADS
+        //
+        // Concerns:
+        //: 1 An object retired by one thread is not released while another
+        //:   thread, pinned before the retirement, remains pinned.
+        //:
+        //: 2 The object is released once that thread unpins.
+        //:
+        //: 3 The record of an exited thread is reused by a subsequent thread,
+        //:   and objects retired by an exited thread are released.
+        //:
+        //: 4 The number of reclaimers that can exist at once is not limited
+        //:   by the number of thread-specific storage keys, and a reclaimer
+        //:   reusing the slot of a destroyed reclaimer does not observe the
+        //:   records of its predecessor.
+        //
+        // Plan:
+        //: 1 Pin a second thread, then retire objects from the main thread
+        //:   and call 'reclaim' repeatedly; verify that none are released.
+        //:   (C-1)
+        //:
+        //: 2 Let the second thread unpin and exit, call 'reclaim' repeatedly,
+        //:   and verify that all objects are released.  (C-2)
+        //:
+        //: 3 Run several threads in sequence, each retiring objects, and
+        //:   verify that the number of blocks allocated by the reclaimer does
+        //:   not grow, and that all objects are released on destruction.
+        //:   (C-3)
+        //:
+        //: 4 Create more reclaimers than the number of thread-specific storage
+        //:   keys available on common platforms, and pin each of them from
+        //:   the main thread and from a second thread.  Destroy every other
+        //:   reclaimer, create replacements, and verify that the replacements
+        //:   are not pinned and that the remaining reclaimers still are.
+        //:   (C-4)
+        //
+        // Testing:
+        //   CONCERN: a pinned thread delays release of other threads' objects
+        //   CONCERN: records of exited threads are reused
+        //   CONCERN: number of reclaimers is not limited by TSS keys
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MULTIPLE THREADS" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator oa("object",   veryVeryVeryVerbose);
+        bslma::TestAllocator ra("retired",  veryVeryVeryVerbose);
+        bslma::TestAllocator ta("thread",   veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tA pinned thread delays reclamation." << endl;
+        {
+            Obj mX(&oa);
+
+            bslmt::Latch pinned(1);
+            bslmt::Latch done(1);
+
+            bslmt::ThreadGroup threads(&ta);
+            threads.addThread(bdlf::BindUtil::bindS(&ta,
+                                                    &pinAndWait,
+                                                    &mX,
+                                                    &pinned,
+                                                    &done));
+            pinned.wait();
+
+            s_numDeleted = 0;
+            retireBlocks(&mX, 10, &ra);
+            for (int i = 0; i < 10; ++i) {
+                mX.reclaim();
+            }
+            ASSERTV(s_numDeleted, 0 == s_numDeleted);
+            ASSERTV(ra.numBlocksInUse(), 10 == ra.numBlocksInUse());
+
+            done.arrive();
+            threads.joinAll();
+
+            for (int i = 0; i < 3; ++i) {
+                mX.reclaim();
+            }
+            ASSERTV(s_numDeleted, 10 == s_numDeleted);
+            ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tRecords of exited threads are reused."
+                          << endl;
+        {
+            Obj mX(&oa);
+
+            s_numDeleted = 0;
+            bsls::Types::Int64 numBlocks = 0;
+            for (int i = 0; i < 5; ++i) {
+                bslmt::ThreadGroup threads(&ta);
+                threads.addThread(bdlf::BindUtil::bindS(&ta,
+                                                        &retireBlocks,
+                                                        &mX,
+                                                        3,
+                                                        &ra));
+                threads.joinAll();
+
+                if (0 == i) {
+                    numBlocks = oa.numBlocksInUse();
+                }
+                ASSERTV(i, numBlocks, oa.numBlocksInUse(),
+                        numBlocks == oa.numBlocksInUse());
+            }
+        }
+        ASSERTV(s_numDeleted, 15 == s_numDeleted);
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tMany reclaimers exist at once." << endl;
+        {
+            enum { k_NUM_RECLAIMERS = 2048 };
+
+            bsl::vector<Obj *> reclaimers(&oa);
+            for (int i = 0; i < k_NUM_RECLAIMERS; ++i) {
+                reclaimers.push_back(new (oa) Obj(&oa));
+            }
+
+            s_numDeleted = 0;
+            for (int i = 0; i < k_NUM_RECLAIMERS; ++i) {
+                reclaimers[i]->pin();
+                retireBlocks(reclaimers[i], 1, &ra);
+            }
+
+            bslmt::ThreadGroup threads(&ta);
+            for (int i = 0; i < k_NUM_RECLAIMERS; i += 512) {
+                threads.addThread(bdlf::BindUtil::bindS(&ta,
+                                                        &retireBlocks,
+                                                        reclaimers[i],
+                                                        1,
+                                                        &ra));
+            }
+            threads.joinAll();
+
+            for (int i = 0; i < k_NUM_RECLAIMERS; i += 2) {
+                reclaimers[i]->unpin();
+                oa.deleteObject(reclaimers[i]);
+                reclaimers[i] = new (oa) Obj(&oa);
+            }
+
+            for (int i = 0; i < k_NUM_RECLAIMERS; ++i) {
+                const bool isPinned = reclaimers[i]->isPinned();
+
+                ASSERTV(i, isPinned, (1 == i % 2) == isPinned);
+
+                if (isPinned) {
+                    reclaimers[i]->unpin();
+                }
+                oa.deleteObject(reclaimers[i]);
+            }
+        }
+        ASSERTV(s_numDeleted, 2052 == s_numDeleted);
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'retireObject'
+        //
+        // Concerns:
+        //: 1 'retireObject' destroys the object and returns its memory to the
+        //:   supplied allocator, which may differ from the allocator of the
+        //:   reclaimer.
+        //:
+        //: 2 Objects of different types may be retired to one reclaimer.
+        //
+        // Plan:
+        //: 1 Retire strings and payloads allocated from a second test
+        //:   allocator, and verify that all memory is returned to that
+        //:   allocator and that the payload destructors ran.  (C-1..2)
+        //
+        // Testing:
+        //   void retireObject(TYPE *object, bslma::Allocator *allocator);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'retireObject'" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator ra("retired", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);
+
+            for (int i = 0; i < 3 * Obj::k_BATCH_SIZE; ++i) {
+                bsl::string *s = new (ra) bsl::string(
+                                  "a string too long for the small buffer",
+                                  &ra);
+                mX.retireObject(s, &ra);
+
+                mX.retireObject(new (ra) Payload(i), &ra);
+            }
+
+            // Batched reclamation released some of the objects.
+
+            ASSERTV(ra.numBlocksInUse(),
+                    0 < ra.numBlocksInUse()
+                 && ra.numBlocksInUse() < 9 * Obj::k_BATCH_SIZE);
+        }
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'retire', 'reclaim', AND 'epoch'
+        //
+        // Concerns:
+        //: 1 An object retired by a pinned thread is not released while that
+        //:   thread is pinned, however many times 'reclaim' is called.
+        //:
+        //: 2 Once no thread is pinned, each call to 'reclaim' advances the
+        //:   epoch, and retired objects are released within three calls.
+        //:
+        //: 3 'retire' attempts reclamation once per 'k_BATCH_SIZE' calls.
+        //:
+        //: 4 The destructor releases all outstanding retired objects.
+        //
+        // Plan:
+        //: 1 Pin, retire objects, call 'reclaim' and verify that nothing is
+        //:   released and that the epoch advances at most once.  (C-1)
+        //:
+        //: 2 Unpin, call 'reclaim', and verify the epoch advances and the
+        //:   objects are released.  (C-2)
+        //:
+        //: 3 Retire many objects without pinning and verify that objects are
+        //:   released before the reclaimer is destroyed.  (C-3)
+        //:
+        //: 4 Retire objects and destroy the reclaimer; verify that all
+        //:   objects are released.  (C-4)
+        //
+        // Testing:
+        //   void reclaim();
+        //   void retire(void *object, Deleter deleter, Allocator *allocator);
+        //   Uint64 epoch() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'retire', 'reclaim', AND 'epoch'" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator ra("retired", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == X.epoch());
+
+            s_numDeleted = 0;
+            {
+                Guard guard(&mX);
+
+                retireBlocks(&mX, 10, &ra);
+                for (int i = 0; i < 10; ++i) {
+                    mX.reclaim();
+                }
+                ASSERTV(X.epoch(), 1 >= X.epoch());
+                ASSERTV(s_numDeleted, 0 == s_numDeleted);
+            }
+
+            const Uint64 epoch = X.epoch();
+            for (int i = 0; i < 3; ++i) {
+                mX.reclaim();
+            }
+            ASSERTV(epoch, X.epoch(), epoch + 3 == X.epoch());
+            ASSERTV(s_numDeleted, 10 == s_numDeleted);
+            ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+
+            s_numDeleted = 0;
+            retireBlocks(&mX, 10 * Obj::k_BATCH_SIZE, &ra);
+            ASSERTV(s_numDeleted, 0 < s_numDeleted);
+            ASSERTV(ra.numBlocksInUse(),
+                    ra.numBlocksInUse() <= 3 * Obj::k_BATCH_SIZE);
+
+            retireBlocks(&mX, 5, &ra);
+        }
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PINNING AND GUARD
+        //
+        // Concerns:
+        //: 1 The reclaimer uses the supplied allocator, or the default
+        //:   allocator if none is supplied.
+        //:
+        //: 2 'pin' and 'unpin' nest, and 'isPinned' reflects the state of the
+        //:   calling thread.
+        //:
+        //: 3 'EpochReclaimerGuard' pins for its lifetime.
+        //:
+        //: 4 Memory allocated for the per-thread record is released when the
+        //:   reclaimer is destroyed.
+        //
+        // Plan:
+        //: 1 Create reclaimers with and without an allocator and verify
+        //:   'allocator'.  (C-1)
+        //:
+        //: 2 Pin and unpin in nested fashion, directly and using guards, and
+        //:   verify 'isPinned' after each step.  (C-2..3)
+        //:
+        //: 3 Verify that the object allocator has no outstanding memory after
+        //:   destruction.  (C-4)
+        //
+        // Testing:
+        //   EpochReclaimer(bslma::Allocator *basicAllocator = 0);
+        //   ~EpochReclaimer();
+        //   void pin();
+        //   void unpin();
+        //   bool isPinned() const;
+        //   bslma::Allocator *allocator() const;
+        //   EpochReclaimerGuard(EpochReclaimer *reclaimer);
+        //   ~EpochReclaimerGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PINNING AND GUARD" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(0   == oa.numBlocksTotal());
+
+            ASSERT(false == X.isPinned());
+
+            mX.pin();
+            ASSERT(true  == X.isPinned());
+            ASSERT(0     <  oa.numBlocksInUse());
+
+            mX.pin();
+            ASSERT(true  == X.isPinned());
+
+            mX.unpin();
+            ASSERT(true  == X.isPinned());
+
+            mX.unpin();
+            ASSERT(false == X.isPinned());
+
+            {
+                Guard guard(&mX);
+                ASSERT(true == X.isPinned());
+                {
+                    Guard guard2(&mX);
+                    ASSERT(true == X.isPinned());
+                }
+                ASSERT(true == X.isPinned());
+            }
+            ASSERT(false == X.isPinned());
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            {
+                Guard guard(&mY);
+                ASSERT(false == X.isPinned());
+                ASSERT(true  == Y.isPinned());
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a reclaimer, pin, retire objects, unpin, and verify that
+        //:   all objects are released by the destructor.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator ra("retired", veryVeryVeryVerbose);
+
+        s_numDeleted = 0;
+        {
+            Obj mX(&oa);
+
+            mX.pin();
+            retireBlocks(&mX, 3, &ra);
+            mX.unpin();
+
+            ASSERTV(ra.numBlocksInUse(), 3 == ra.numBlocksInUse());
+        }
+        ASSERTV(s_numDeleted, 3 == s_numDeleted);
+        ASSERTV(ra.numBlocksInUse(), 0 == ra.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
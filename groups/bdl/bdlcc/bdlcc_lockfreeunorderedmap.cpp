@@ -0,0 +1,30 @@
+// bdlcc_lockfreeunorderedmap.cpp                                     -*-C++-*-
+#include <bdlcc_lockfreeunorderedmap.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_lockfreeunorderedmap_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Element nodes carry an odd split-order key (the bit-reversed hash with the
+// low bit set) and bucket sentinels an even one, so that a sentinel always
+// sorts before the elements of its bucket.  A node is logically removed by
+// setting the low bit of its 'd_next' pointer, and physically unlinked by the
+// next traversal that encounters it.  Unlinked nodes and replaced values are
+// released through a 'bdlcc::EpochReclaimer'.
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
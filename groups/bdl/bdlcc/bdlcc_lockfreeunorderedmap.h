@@ -0,0 +1,1409 @@
+// bdlcc_lockfreeunorderedmap.h                                       -*-C++-*-
+#ifndef INCLUDED_BDLCC_LOCKFREEUNORDEREDMAP
+#define INCLUDED_BDLCC_LOCKFREEUNORDEREDMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free, split-ordered concurrent unordered map.
+//
+//@CLASSES:
+//  bdlcc::LockFreeUnorderedMap: lock-free hash map
+//
+//@SEE_ALSO: bdlcc_stripedunorderedmap, bdlcc_epochreclaimer
+//
+//@DESCRIPTION: This component provides a single concurrent (fully thread-safe)
+// associative container, 'bdlcc::LockFreeUnorderedMap', that maps keys to
+// values without using any locks.  Lookups ('getValue', 'visitReadOnly') do
+// not write to any memory shared with other threads, and modifications
+// ('insert', 'setValue', 'erase', ...) complete with a small number of
+// compare-and-swap operations.  The container is intended for read-mostly
+// tables accessed from many threads, where the reader-writer locks used by
+// 'bdlcc::StripedUnorderedMap' become a point of contention even when no
+// writer is present.
+//
+// The interface follows that of 'bdlcc::StripedUnorderedMap': values are
+// returned *by* *value* ('getValue'), and values are modified in place through
+// user-supplied functors ('setComputedValue', 'update', 'visit').  No
+// iterators are provided.
+//
+// The 'bdlcc::LockFreeUnorderedMap' class is an *irregular* value-semantic
+// type, even if 'KEY' and 'VALUE' are VSTs.  This class does not implement
+// equality comparison, assignment operator, or copy constructor.
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::LockFreeUnorderedMap' class template is fully thread-safe (see
+// {'bsldoc_glossary'|Fully Thread-Safe}), assuming that the allocator is fully
+// thread-safe.  Each method is executed by the calling thread.
+//
+///Implementation Overview
+///-----------------------
+// The map is a *split-ordered* list (see Shalev and Shavit, "Split-Ordered
+// Lists: Lock-Free Extensible Hash Tables", JACM 53(3), 2006): all elements
+// are kept in a single lock-free linked list sorted by the bit-reversed hash
+// of their keys, and the bucket array is a table of shortcuts into that list.
+// Growing the bucket array never moves an element; new buckets are
+// initialized lazily by inserting a sentinel node into the list.  The bucket
+// array is allocated in segments of doubling size, so that it can grow
+// without copying and without blocking concurrent readers.
+//
+// Each element's value is held in a separately allocated object.  Modifying
+// the value of an element creates a new value object and atomically publishes
+// it, so that a concurrent 'getValue' always observes a complete value.
+//
+///Memory Reclamation
+/// - - - - - - - - -
+// Nodes and values removed from the map may still be in use by concurrent
+// readers, so they are not freed immediately.  Instead, they are *retired*
+// and released once every thread that might have observed them has left the
+// map (epoch-based reclamation, see 'bdlcc_epochreclaimer').  Memory is
+// therefore released in batches, and the footprint of a map subject to heavy
+// modification may temporarily exceed that of its live elements.  All retired
+// memory is released when the map is destroyed.
+//
+// By default, each map owns its own 'bdlcc::EpochReclaimer'.  Alternatively,
+// a reclaimer may be supplied on construction and shared by any number of
+// maps (and other data structures), which avoids a reclaimer, and its
+// per-thread records, per map when many small maps are created.  Nodes retired
+// by a map sharing a reclaimer are released by that reclaimer, possibly after
+// the map has been destroyed, so the allocator of such a map must remain valid
+// until the reclaimer is destroyed.  Note also that a thread pinned to a
+// shared reclaimer while accessing one map delays the release of memory
+// retired by every map sharing it.
+//
+///Visitor Semantics
+///-----------------
+// The functor passed to 'setComputedValue', 'update', and 'visit' is invoked
+// on a *copy* of the current value of the element, and the modified copy is
+// then published.  If another thread modifies the same element in the
+// meantime, the functor is invoked again on a copy of the newer value.
+// Therefore, the functor may be invoked more than once for a single call, and
+// must not have side effects other than modifying the supplied value.
+// 'visitReadOnly' invokes its functor directly on the stored value and does
+// not copy.
+//
+///Runtime Complexity
+///------------------
+//..
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | insert, setValue, setComputedValue, update         | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | erase, getValue                                    | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | clear, visit, visitReadOnly                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Number of Buckets
+///-----------------
+// The number of buckets is doubled whenever the number of elements exceeds
+// 'maxLoadFactor() * bucketCount()'.  The number of buckets never decreases,
+// and the bucket shortcuts (a node each) are retained until the map is
+// destroyed.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// This example shows some basic usage of 'bdlcc::LockFreeUnorderedMap'.
+//
+// First, we define a 'bdlcc::LockFreeUnorderedMap' object, 'sessions', that
+// maps 'int' session handles to 'bsl::string' user names:
+//..
+//  bdlcc::LockFreeUnorderedMap<int, bsl::string> sessions;
+//..
+// Then, we insert three elements into the map and verify that the size is the
+// expected value:
+//..
+//  assert(0 == sessions.size());
+//  sessions.insert(0, "Alex");
+//  sessions.insert(1, "John");
+//  sessions.insert(2, "Rob");
+//  assert(3 == sessions.size());
+//..
+// Next, we use the 'getValue' method to retrieve the previously inserted
+// string associated with the value 1:
+//..
+//  bsl::string value;
+//  bsl::size_t rc = sessions.getValue(&value, 1);
+//  assert(1      == rc);
+//  assert("John" == value);
+//..
+// Now, we change the value associated with 1 from "John" to "Jack" and confirm
+// that the size of the map has not changed:
+//..
+//  rc = sessions.setValue(1, "Jack");
+//  assert(1 == rc);
+//  assert(3 == sessions.size());
+//
+//  rc = sessions.getValue(&value, 1);
+//  assert(1      == rc);
+//  assert("Jack" == value);
+//..
+// Finally, we erase the element '(2, "Rob")' from the map, confirm that the
+// map size is decremented, and that element can no longer be found in the map:
+//..
+//  rc = sessions.erase(2);
+//  assert(1 == rc);
+//  assert(2 == sessions.size());
+//
+//  rc = sessions.getValue(&value, 2);
+//  assert(0 == rc);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_epochreclaimer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_deleterhelper.h>
+#include <bslma_destructionutil.h>
+#include <bslma_rawdeleterproctor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                      // ==============================
+                      // struct LockFreeUnorderedMap_Util
+                      // ==============================
+
+struct LockFreeUnorderedMap_Util {
+    // This component-private utility 'struct' provides the split-order key
+    // computations used by 'LockFreeUnorderedMap'.
+
+    // CLASS METHODS
+    static bsls::Types::Uint64 bucketKey(bsls::Types::Uint64 bucket);
+        // Return the split-order key of the sentinel node of the specified
+        // 'bucket'.  The returned value is even.
+
+    static bsls::Types::Uint64 elementKey(bsls::Types::Uint64 hashValue);
+        // Return the split-order key of an element having the specified
+        // 'hashValue'.  The returned value is odd.
+
+    static bsls::Types::Uint64 parentBucket(bsls::Types::Uint64 bucket);
+        // Return the index of the bucket from which the specified 'bucket' is
+        // split, i.e., 'bucket' with its most significant set bit cleared.
+        // The behavior is undefined unless '0 < bucket'.
+
+    static bsls::Types::Uint64 reverseBits(bsls::Types::Uint64 value);
+        // Return the specified 'value' with the order of its bits reversed.
+
+    static int segmentIndex(bsl::size_t *offset, bsls::Types::Uint64 bucket);
+        // Return the index of the bucket segment holding the specified
+        // 'bucket', and load into the specified 'offset' the position of
+        // 'bucket' within that segment.  Segment 0 holds buckets 0 and 1, and
+        // segment 'i', for '0 < i', holds buckets '[2^i .. 2^(i+1))'.
+};
+
+                        // ==========================
+                        // class LockFreeUnorderedMap
+                        // ==========================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class LockFreeUnorderedMap {
+    // This class template defines a fully thread-safe container that provides
+    // a mapping from keys (of template parameter type 'KEY') to their
+    // associated mapped values (of template parameter type 'VALUE').  No
+    // operation takes a lock, and lookups do not modify memory shared with
+    // other threads.
+    //
+    // The interface is inspired by, but not identical to that of
+    // 'bdlcc::StripedUnorderedMap'.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::function<bool (VALUE *, const KEY&)> VisitorFunction;
+        // An alias to a function meeting the following contract:
+        //..
+        //  bool visitorFunction(VALUE *value, const KEY& key);
+        //      // Visit the specified 'value' attribute associated with the
+        //      // specified 'key'.  Return 'true' if this function may be
+        //      // called on additional elements, and 'false' otherwise (i.e.,
+        //      // if no other elements should be visited).  Note that this
+        //      // functor can change the value associated with 'key'.
+        //..
+
+    typedef bsl::function<bool (const VALUE&, const KEY&)>
+                                                       ReadOnlyVisitorFunction;
+        // An alias to a function meeting the following contract:
+        //..
+        //  bool readOnlyVisitorFunction(const VALUE& value, const KEY& key);
+        //      // Visit the specified 'value' attribute associated with the
+        //      // specified 'key'.  Return 'true' if this function may be
+        //      // called on additional elements, and 'false' otherwise (i.e.,
+        //      // if no other elements should be visited).
+        //..
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_NUM_BUCKETS = 16,  // Default number of buckets
+        k_MAX_LOAD_FACTOR     =  2   // Maximum number of elements per bucket
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef EpochReclaimer            Reclaimer;
+    typedef EpochReclaimerGuard       PinGuard;
+    typedef LockFreeUnorderedMap_Util Util;
+    typedef bsls::Types::Uint64       Uint64;
+    typedef bsls::Types::UintPtr      UintPtr;
+
+    struct Node {
+        // A node of the split-ordered list.  Sentinel nodes (having an even
+        // 'd_splitKey') have no key and no value.
+
+        bsls::AtomicPointer<Node>  d_next;      // next node; the low bit is
+                                                // set if this node is
+                                                // logically removed
+
+        Uint64                     d_splitKey;  // split-order key
+
+        bsls::AtomicPointer<VALUE> d_value;     // current value (element
+                                                // nodes only)
+
+        bsls::ObjectBuffer<KEY>    d_key;       // key (element nodes only)
+    };
+
+    typedef bsls::AtomicPointer<Node> Bucket;
+
+    enum {
+        k_NUM_SEGMENTS = 64  // maximum number of bucket segments
+    };
+
+    // DATA
+    bsls::ObjectBuffer<Reclaimer>
+                               d_ownReclaimer;  // reclaimer used if none is
+                                                // supplied on construction
+
+    Reclaimer                 *d_reclaimer_p;   // retired node reclamation
+                                                // (held, and owned if it is
+                                                // 'd_ownReclaimer')
+
+    bsls::AtomicPointer<Bucket>
+                               d_segments[k_NUM_SEGMENTS];
+                                                // bucket segments, allocated
+                                                // on demand
+
+    Node                      *d_head_p;        // sentinel of bucket 0, head
+                                                // of the list
+
+    bsls::AtomicUint64         d_numBuckets;    // current number of buckets
+
+    bsls::AtomicInt64          d_size;          // number of elements
+
+    HASH                       d_hasher;        // hash functor
+
+    EQUAL                      d_comparator;    // key-equality functor
+
+    bslma::Allocator          *d_allocator_p;   // memory allocator (held, not
+                                                // owned)
+
+    // NOT IMPLEMENTED
+    LockFreeUnorderedMap(const LockFreeUnorderedMap&);
+    LockFreeUnorderedMap& operator=(const LockFreeUnorderedMap&);
+
+    // PRIVATE CLASS METHODS
+    static void deleteNode(void *node, bslma::Allocator *allocator);
+        // Destroy the key and value of the specified element 'node' and
+        // deallocate it using the specified 'allocator'.
+
+    static void deleteValue(void *value, bslma::Allocator *allocator);
+        // Destroy and deallocate the specified 'value' using the specified
+        // 'allocator'.
+
+    static bool isMarked(const Node *pointer);
+        // Return 'true' if the specified 'pointer' has its removal mark set,
+        // and 'false' otherwise.
+
+    static Node *marked(Node *pointer);
+        // Return the specified 'pointer' with its removal mark set.
+
+    static Node *unmarked(Node *pointer);
+        // Return the specified 'pointer' with its removal mark cleared.
+
+    // PRIVATE MANIPULATORS
+    Node *bucketNode(Uint64 bucket);
+        // Return the sentinel node of the specified 'bucket', initializing
+        // the bucket if necessary.
+
+    void expand(Uint64 numBuckets);
+        // Double the number of buckets if the size of this map exceeds the
+        // maximum load factor for the specified 'numBuckets'.
+
+    void initialize(bsl::size_t numInitialBuckets, Reclaimer *reclaimer);
+        // Allocate the initial buckets of this map for at least the
+        // specified 'numInitialBuckets' and use the specified 'reclaimer', or
+        // a reclaimer owned by this map if 'reclaimer' is 0, to release the
+        // memory retired by this map.
+
+    bool find(Bucket **prevLink,
+              Node   **current,
+              Node    *start,
+              Uint64   splitKey,
+              const KEY *key);
+        // Search the list, beginning after the specified 'start' node, for
+        // the node having the specified 'splitKey' and, if 'key' is not 0,
+        // the specified '*key'.  Load into the specified 'prevLink' the
+        // address of the link pointing to the first node not ordered before
+        // the searched-for node, and into the specified 'current' that node
+        // (or 0).  Return 'true' if the node is found, and 'false' otherwise.
+        // Logically removed nodes encountered are unlinked and retired.  The
+        // behavior is undefined unless the calling thread is pinned.
+
+    Node *insertNode(Node *node, Node *start);
+        // Insert the specified 'node' into the list after the specified
+        // 'start' node unless a node with an equivalent key is already in the
+        // list.  Return 'node' if it was inserted, and the equivalent node
+        // otherwise.  The behavior is undefined unless the calling thread is
+        // pinned.
+
+    Node *newElement(const KEY& key, Uint64 splitKey, VALUE *value);
+        // Return a new element node having the specified 'key', 'splitKey',
+        // and 'value'.  On exception, 'value' is destroyed and deallocated.
+
+    VALUE *newValue(const VALUE& value);
+    VALUE *newValue(bslmf::MovableRef<VALUE> value);
+        // Return a newly allocated copy of the specified 'value'.
+
+    int modify(Node *node, const VisitorFunction& visitor);
+        // Publish a copy of the value of the specified element 'node' that
+        // has been modified by the specified 'visitor', retrying if the value
+        // was concurrently modified.  Return the result of the invocation of
+        // 'visitor' whose modification was published.  The behavior is
+        // undefined unless the calling thread is pinned.
+
+    void replaceValue(Node *node, VALUE *value);
+        // Make the specified 'value' the value of the specified element
+        // 'node', and retire the previous value.  The behavior is undefined
+        // unless the calling thread is pinned.
+
+    template <class VALUE_TYPE>
+    bsl::size_t setValueImp(const KEY& key, VALUE_TYPE value);
+        // Set the value of the element having the specified 'key' to the
+        // specified 'value', inserting '(key, value)' if no such element
+        // exists.  Return 1 if 'key' was found, and 0 otherwise.
+
+    // PRIVATE ACCESSORS
+    const Node *findNode(const KEY& key) const;
+        // Return the element node having the specified 'key', or 0 if no such
+        // element is in this map.  This method does not modify any shared
+        // memory.  The behavior is undefined unless the calling thread is
+        // pinned.
+
+    Bucket *segment(bsl::size_t *offset, Uint64 bucket) const;
+        // Return the address of the segment holding the specified 'bucket',
+        // or 0 if that segment has not been allocated, and load into the
+        // specified 'offset' the position of 'bucket' within the segment.
+
+  public:
+    // CREATORS
+    explicit LockFreeUnorderedMap(
+                   bsl::size_t       numInitialBuckets = k_DEFAULT_NUM_BUCKETS,
+                   bslma::Allocator *basicAllocator    = 0);
+        // Create an empty 'LockFreeUnorderedMap' object.  Optionally specify
+        // 'numInitialBuckets', the minimum initial number of buckets (rounded
+        // up to a power of 2).  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    explicit LockFreeUnorderedMap(
+                   EpochReclaimer   *reclaimer,
+                   bsl::size_t       numInitialBuckets = k_DEFAULT_NUM_BUCKETS,
+                   bslma::Allocator *basicAllocator    = 0);
+        // Create an empty 'LockFreeUnorderedMap' object that uses the
+        // specified 'reclaimer' to release the memory it retires (see {Memory
+        // Reclamation}).  Optionally specify 'numInitialBuckets', the minimum
+        // initial number of buckets (rounded up to a power of 2).  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'reclaimer' outlives this
+        // map, and the allocator of this map remains valid until 'reclaimer'
+        // is destroyed.
+
+    ~LockFreeUnorderedMap();
+        // Destroy this hash map.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all elements from this hash map.  Elements inserted
+        // concurrently with this call may or may not be removed.
+
+    bsl::size_t erase(const KEY& key);
+        // Erase from this hash map the element having the specified 'key'.
+        // Return 1 on success and 0 if 'key' does not exist.  Note that the
+        // returned value equals the number of elements removed.
+
+    bsl::size_t insert(const KEY& key, const VALUE& value);
+        // Insert into this hash map an element having the specified 'key' and
+        // 'value'.  If 'key' already exists in this hash map, the value
+        // attribute of that element is set to 'value'.  Return 1 if an element
+        // is inserted, and 0 if an existing element is updated.  Note that the
+        // return value equals the number of elements inserted.
+
+    bsl::size_t insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+        // Insert into this hash map an element having the specified 'key' and
+        // the specified move-insertable 'value'.  If 'key' already exists in
+        // this hash map, the value attribute of that element is set to
+        // 'value'.  Return 1 if an element is inserted, and 0 if an existing
+        // element is updated.  The 'value' object is left in a valid but
+        // unspecified state.  Note that the return value equals the number of
+        // elements inserted.
+
+    int setComputedValue(const KEY& key, const VisitorFunction& visitor);
+        // Invoke the specified 'visitor' on a copy of the value associated
+        // with the specified 'key' and publish the result (see {Visitor
+        // Semantics}).  If no element in the map has 'key', insert
+        // '(key, VALUE())' and invoke 'visitor' on the default constructed
+        // value before the element is published.  Return 1 if 'key' was found
+        // and 'visitor' returned 'true', 0 if 'key' was not found, and -1 if
+        // 'key' was found and 'visitor' returned 'false'.  The behavior is
+        // undefined if 'visitor' accesses this map.  Note that a return value
+        // of '0' implies that an element was inserted.
+
+    bsl::size_t setValue(const KEY& key, const VALUE& value);
+        // Set the value attribute of the element in this hash map having the
+        // specified 'key' to the specified 'value'.  If no such element
+        // exists, insert '(key, value)'.  Return 1 if 'key' was found, and 0
+        // otherwise.  Note that the return value equals the number of
+        // elements found having 'key'.
+
+    bsl::size_t setValue(const KEY& key, bslmf::MovableRef<VALUE> value);
+        // Set the value attribute of the element in this hash map having the
+        // specified 'key' to the specified move-insertable 'value'.  If no
+        // such element exists, insert '(key, value)'.  Return 1 if 'key' was
+        // found, and 0 otherwise.  The 'value' object is left in a valid but
+        // unspecified state.  Note that the return value equals the number of
+        // elements found having 'key'.
+
+    int update(const KEY& key, const VisitorFunction& visitor);
+        // Invoke the specified 'visitor' on a copy of the value of the
+        // element (if one exists) in this hash map having the specified 'key'
+        // and publish the result (see {Visitor Semantics}).  Return the number
+        // of elements updated or -1 if 'visitor' returned 'false'.  The
+        // behavior is undefined if 'visitor' accesses this map.
+
+    int visit(const VisitorFunction& visitor);
+        // Invoke the specified 'visitor' (in an unspecified order) on a copy
+        // of the value of each element in this hash table, and publish the
+        // result (see {Visitor Semantics}), until each element has been
+        // visited or until 'visitor' returns 'false'.  Return the number of
+        // elements visited or the negation of that value if visitations
+        // stopped because 'visitor' returned 'false'.  Elements inserted or
+        // removed during the execution of 'visit' may or may not be visited.
+        // The behavior is undefined if 'visitor' accesses this map.
+
+    // ACCESSORS
+    bsl::size_t bucketCount() const;
+        // Return the number of buckets in the array of buckets maintained by
+        // this hash map.  Note that the value returned may be obsolete by the
+        // time it is received.
+
+    bool empty() const;
+        // Return 'true' if this hash map contains no elements, and 'false'
+        // otherwise.
+
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this hash map.
+
+    bsl::size_t getValue(VALUE *value, const KEY& key) const;
+        // Load, into the specified '*value', the value attribute of the
+        // element in this hash map having the specified 'key'.  Return 1 on
+        // success and 0 if 'key' does not exist in this hash map.  This
+        // method does not modify memory shared with other threads.  Note that
+        // the return value equals the number of values returned.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this hash map.
+
+    float loadFactor() const;
+        // Return the current quotient of the size of this hash map and the
+        // number of buckets.
+
+    float maxLoadFactor() const;
+        // Return the maximum load factor allowed for this hash map.  If an
+        // insert operation causes the load factor to exceed
+        // 'maxLoadFactor()', the number of buckets is doubled.
+
+    bsl::size_t size() const;
+        // Return the current number of elements in this hash map.
+
+    int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+        // Invoke the specified 'visitor' (in an unspecified order) on the
+        // value of each element in this hash table until each element has
+        // been visited or until 'visitor' returns 'false'.  Return the number
+        // of elements visited or the negation of that value if visitations
+        // stopped because 'visitor' returned 'false'.  Elements inserted or
+        // removed during the execution of 'visitReadOnly' may or may not be
+        // visited.  The behavior is undefined if 'visitor' modifies this map.
+
+                               // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this hash map to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                      // ------------------------------
+                      // struct LockFreeUnorderedMap_Util
+                      // ------------------------------
+
+// CLASS METHODS
+inline
+bsls::Types::Uint64 LockFreeUnorderedMap_Util::bucketKey(
+                                                    bsls::Types::Uint64 bucket)
+{
+    return reverseBits(bucket);
+}
+
+inline
+bsls::Types::Uint64 LockFreeUnorderedMap_Util::elementKey(
+                                                 bsls::Types::Uint64 hashValue)
+{
+    return reverseBits(hashValue) | 1;
+}
+
+inline
+bsls::Types::Uint64 LockFreeUnorderedMap_Util::parentBucket(
+                                                    bsls::Types::Uint64 bucket)
+{
+    BSLS_ASSERT(0 < bucket);
+
+    bsls::Types::Uint64 highBit = bucket;
+    while (highBit & (highBit - 1)) {
+        highBit &= highBit - 1;
+    }
+    return bucket & ~highBit;
+}
+
+inline
+bsls::Types::Uint64 LockFreeUnorderedMap_Util::reverseBits(
+                                                     bsls::Types::Uint64 value)
+{
+    value = ((value >> 1) & 0x5555555555555555ULL)
+          | ((value & 0x5555555555555555ULL) << 1);
+    value = ((value >> 2) & 0x3333333333333333ULL)
+          | ((value & 0x3333333333333333ULL) << 2);
+    value = ((value >> 4) & 0x0F0F0F0F0F0F0F0FULL)
+          | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    value = ((value >> 8) & 0x00FF00FF00FF00FFULL)
+          | ((value & 0x00FF00FF00FF00FFULL) << 8);
+    value = ((value >> 16) & 0x0000FFFF0000FFFFULL)
+          | ((value & 0x0000FFFF0000FFFFULL) << 16);
+    return (value >> 32) | (value << 32);
+}
+
+inline
+int LockFreeUnorderedMap_Util::segmentIndex(bsl::size_t         *offset,
+                                            bsls::Types::Uint64  bucket)
+{
+    BSLS_ASSERT(offset);
+
+    if (bucket < 2) {
+        *offset = static_cast<bsl::size_t>(bucket);
+        return 0;                                                     // RETURN
+    }
+
+    int index = 0;
+    for (bsls::Types::Uint64 v = bucket; v > 1; v >>= 1) {
+        ++index;
+    }
+    *offset = static_cast<bsl::size_t>(
+                                 bucket - (static_cast<bsls::Types::Uint64>(1)
+                                                                    << index));
+    return index;
+}
+
+                        // --------------------------
+                        // class LockFreeUnorderedMap
+                        // --------------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::deleteNode(
+                                                  void             *node,
+                                                  bslma::Allocator *allocator)
+{
+    Node *n = static_cast<Node *>(node);
+
+    deleteValue(n->d_value.loadRelaxed(), allocator);
+    bslma::DestructionUtil::destroy(n->d_key.address());
+    allocator->deallocate(n);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::deleteValue(
+                                                  void             *value,
+                                                  bslma::Allocator *allocator)
+{
+    bslma::DeleterHelper::deleteObject(static_cast<VALUE *>(value),
+                                       allocator);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::isMarked(
+                                                           const Node *pointer)
+{
+    return reinterpret_cast<UintPtr>(pointer) & 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::Node *
+LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::marked(Node *pointer)
+{
+    return reinterpret_cast<Node *>(reinterpret_cast<UintPtr>(pointer) | 1);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::Node *
+LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::unmarked(Node *pointer)
+{
+    return reinterpret_cast<Node *>(reinterpret_cast<UintPtr>(pointer)
+                                                    & ~static_cast<UintPtr>(1));
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::Node *
+LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::bucketNode(Uint64 bucket)
+{
+    bsl::size_t  offset;
+    Bucket      *seg = segment(&offset, bucket);
+
+    if (0 == seg) {
+        const int   index = Util::segmentIndex(&offset, bucket);
+        bsl::size_t count = 0 == index
+                            ? 2
+                            : static_cast<bsl::size_t>(1) << index;
+
+        Bucket *newSeg = static_cast<Bucket *>(
+                              d_allocator_p->allocate(count * sizeof(Bucket)));
+        for (bsl::size_t i = 0; i < count; ++i) {
+            new (newSeg + i) Bucket();
+        }
+
+        seg = d_segments[index].testAndSwap(0, newSeg);
+        if (0 == seg) {
+            seg = newSeg;
+        }
+        else {
+            d_allocator_p->deallocate(newSeg);
+        }
+    }
+
+    Node *node = seg[offset].loadAcquire();
+    if (node) {
+        return node;                                                  // RETURN
+    }
+
+    Node *parent = bucketNode(Util::parentBucket(bucket));
+
+    Node *sentinel = static_cast<Node *>(d_allocator_p->allocate(
+                                                                sizeof(Node)));
+    new (&sentinel->d_next) bsls::AtomicPointer<Node>();
+    new (&sentinel->d_value) bsls::AtomicPointer<VALUE>();
+    sentinel->d_splitKey = Util::bucketKey(bucket);
+
+    node = insertNode(sentinel, parent);
+    if (node != sentinel) {
+        // Another thread initialized this bucket; 'sentinel' was never
+        // published.
+
+        d_allocator_p->deallocate(sentinel);
+    }
+
+    seg[offset].testAndSwap(0, node);
+    return node;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::expand(Uint64 numBuckets)
+{
+    if (static_cast<Uint64>(d_size.loadRelaxed())
+                                          > numBuckets * k_MAX_LOAD_FACTOR
+     && numBuckets < (static_cast<Uint64>(1) << (k_NUM_SEGMENTS - 1))) {
+        d_numBuckets.testAndSwap(numBuckets, numBuckets * 2);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::initialize(
+                                               bsl::size_t  numInitialBuckets,
+                                               Reclaimer   *reclaimer)
+{
+    Uint64 numBuckets = 2;
+    while (numBuckets < numInitialBuckets
+        && numBuckets < (static_cast<Uint64>(1) << (k_NUM_SEGMENTS - 1))) {
+        numBuckets *= 2;
+    }
+    d_numBuckets = numBuckets;
+
+    d_head_p = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
+    new (&d_head_p->d_next) bsls::AtomicPointer<Node>();
+    new (&d_head_p->d_value) bsls::AtomicPointer<VALUE>();
+    d_head_p->d_splitKey = Util::bucketKey(0);
+
+    Bucket *seg = static_cast<Bucket *>(
+                                  d_allocator_p->allocate(2 * sizeof(Bucket)));
+    new (seg)     Bucket(d_head_p);
+    new (seg + 1) Bucket();
+    d_segments[0] = seg;
+
+    if (reclaimer) {
+        d_reclaimer_p = reclaimer;
+    }
+    else {
+        d_reclaimer_p = new (d_ownReclaimer.buffer()) Reclaimer(d_allocator_p);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::find(Bucket    **prevLink,
+                                                         Node      **current,
+                                                         Node       *start,
+                                                         Uint64      splitKey,
+                                                         const KEY  *key)
+{
+    for (;;) {
+        Bucket *prev = &start->d_next;
+        Node   *curr = unmarked(prev->loadAcquire());
+        bool    restart = false;
+
+        while (curr) {
+            Node *next = curr->d_next.loadAcquire();
+
+            if (isMarked(next)) {
+                // 'curr' is logically removed; unlink it.
+
+                Node *succ = unmarked(next);
+                if (prev->testAndSwap(curr, succ) != curr) {
+                    restart = true;
+                    break;
+                }
+                d_reclaimer_p->retire(curr, &deleteNode, d_allocator_p);
+                curr = succ;
+                continue;
+            }
+
+            if (curr->d_splitKey > splitKey) {
+                break;
+            }
+
+            if (curr->d_splitKey == splitKey
+             && (0 == key
+              || d_comparator(*curr->d_key.address(), *key))) {
+                *prevLink = prev;
+                *current  = curr;
+                return true;                                          // RETURN
+            }
+
+            prev = &curr->d_next;
+            curr = next;
+        }
+
+        if (!restart) {
+            *prevLink = prev;
+            *current  = curr;
+            return false;                                             // RETURN
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::Node *
+LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::insertNode(Node *node,
+                                                          Node *start)
+{
+    const bool  isElement = node->d_splitKey & 1;
+    const KEY  *key       = isElement ? node->d_key.address() : 0;
+
+    for (;;) {
+        Bucket *prev;
+        Node   *curr;
+
+        if (find(&prev, &curr, start, node->d_splitKey, key)) {
+            return curr;                                              // RETURN
+        }
+
+        node->d_next.storeRelaxed(curr);
+        if (prev->testAndSwap(curr, node) == curr) {
+            return node;                                              // RETURN
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::Node *
+LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::newElement(const KEY&  key,
+                                                          Uint64      splitKey,
+                                                          VALUE      *value)
+{
+    bslma::RawDeleterProctor<VALUE, bslma::Allocator> valueProctor(
+                                                                value,
+                                                                d_allocator_p);
+
+    Node *node = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
+    bslma::DeallocatorProctor<bslma::Allocator> nodeProctor(node,
+                                                            d_allocator_p);
+
+    bslma::ConstructionUtil::construct(node->d_key.address(),
+                                       d_allocator_p,
+                                       key);
+    nodeProctor.release();
+    valueProctor.release();
+
+    new (&node->d_next) bsls::AtomicPointer<Node>();
+    new (&node->d_value) bsls::AtomicPointer<VALUE>(value);
+    node->d_splitKey = splitKey;
+    return node;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+VALUE *LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::newValue(
+                                                            const VALUE& value)
+{
+    VALUE *result = static_cast<VALUE *>(
+                                       d_allocator_p->allocate(sizeof(VALUE)));
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(result, d_allocator_p);
+
+    bslma::ConstructionUtil::construct(result, d_allocator_p, value);
+    proctor.release();
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+VALUE *LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::newValue(
+                                               bslmf::MovableRef<VALUE> value)
+{
+    VALUE *result = static_cast<VALUE *>(
+                                       d_allocator_p->allocate(sizeof(VALUE)));
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(result, d_allocator_p);
+
+    bslma::ConstructionUtil::construct(result,
+                                       d_allocator_p,
+                                       bslmf::MovableRefUtil::move(value));
+    proctor.release();
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::modify(
+                                               Node                   *node,
+                                               const VisitorFunction&  visitor)
+{
+    for (;;) {
+        VALUE *current = node->d_value.loadAcquire();
+        VALUE *copy    = newValue(*current);
+
+        bslma::RawDeleterProctor<VALUE, bslma::Allocator> proctor(
+                                                                copy,
+                                                                d_allocator_p);
+
+        const bool result = visitor(copy, *node->d_key.address());
+
+        if (node->d_value.testAndSwap(current, copy) == current) {
+            proctor.release();
+            d_reclaimer_p->retire(current, &deleteValue, d_allocator_p);
+            return result ? 1 : -1;                                   // RETURN
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::replaceValue(Node  *node,
+                                                                 VALUE *value)
+{
+    VALUE *previous = node->d_value.swap(value);
+    d_reclaimer_p->retire(previous, &deleteValue, d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VALUE_TYPE>
+bsl::size_t LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::setValueImp(
+                                                          const KEY&  key,
+                                                          VALUE_TYPE  value)
+{
+    VALUE *newV = newValue(value);
+
+    PinGuard guard(d_reclaimer_p);
+
+    const Uint64 hashValue  = d_hasher(key);
+    const Uint64 numBuckets = d_numBuckets.loadAcquire();
+    Node        *start      = bucketNode(hashValue & (numBuckets - 1));
+
+    Node *node = newElement(key, Util::elementKey(hashValue), newV);
+    Node *curr = insertNode(node, start);
+
+    if (curr != node) {
+        // 'key' is already present; 'node' was never published.
+
+        node->d_value.storeRelaxed(0);
+        bslma::DestructionUtil::destroy(node->d_key.address());
+        d_allocator_p->deallocate(node);
+
+        replaceValue(curr, newV);
+        return 1;                                                     // RETURN
+    }
+
+    ++d_size;
+    expand(numBuckets);
+    return 0;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+const typename LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::Node *
+LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::findNode(const KEY& key) const
+{
+    const Uint64 hashValue = d_hasher(key);
+    const Uint64 splitKey  = Util::elementKey(hashValue);
+
+    // Find the nearest initialized bucket without initializing any.
+
+    Uint64      bucket = hashValue & (d_numBuckets.loadAcquire() - 1);
+    const Node *start  = 0;
+    for (;;) {
+        bsl::size_t  offset;
+        Bucket      *seg = segment(&offset, bucket);
+        if (seg) {
+            start = seg[offset].loadAcquire();
+            if (start) {
+                break;
+            }
+        }
+        bucket = Util::parentBucket(bucket);
+    }
+
+    const Node *curr = unmarked(start->d_next.loadAcquire());
+    while (curr) {
+        Node *next = curr->d_next.loadAcquire();
+
+        if (curr->d_splitKey > splitKey) {
+            return 0;                                                 // RETURN
+        }
+        if (curr->d_splitKey == splitKey
+         && !isMarked(next)
+         && d_comparator(*curr->d_key.address(), key)) {
+            return curr;                                              // RETURN
+        }
+        curr = unmarked(next);
+    }
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::Bucket *
+LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::segment(
+                                                    bsl::size_t *offset,
+                                                    Uint64       bucket) const
+{
+    return d_segments[Util::segmentIndex(offset, bucket)].loadAcquire();
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::LockFreeUnorderedMap(
+                                           bsl::size_t       numInitialBuckets,
+                                           bslma::Allocator *basicAllocator)
+: d_reclaimer_p(0)
+, d_head_p(0)
+, d_numBuckets(2)
+, d_size(0)
+, d_hasher()
+, d_comparator()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(numInitialBuckets, 0);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::LockFreeUnorderedMap(
+                                           EpochReclaimer   *reclaimer,
+                                           bsl::size_t       numInitialBuckets,
+                                           bslma::Allocator *basicAllocator)
+: d_reclaimer_p(0)
+, d_head_p(0)
+, d_numBuckets(2)
+, d_size(0)
+, d_hasher()
+, d_comparator()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(reclaimer);
+
+    initialize(numInitialBuckets, reclaimer);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::~LockFreeUnorderedMap()
+{
+    Node *node = d_head_p;
+    while (node) {
+        Node *next = unmarked(node->d_next.loadRelaxed());
+        if (node->d_splitKey & 1) {
+            deleteNode(node, d_allocator_p);
+        }
+        else {
+            d_allocator_p->deallocate(node);
+        }
+        node = next;
+    }
+
+    for (int i = 0; i < k_NUM_SEGMENTS; ++i) {
+        Bucket *seg = d_segments[i].loadRelaxed();
+        if (seg) {
+            d_allocator_p->deallocate(seg);
+        }
+    }
+
+    if (d_reclaimer_p == &d_ownReclaimer.object()) {
+        bslma::DestructionUtil::destroy(d_reclaimer_p);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    PinGuard guard(d_reclaimer_p);
+
+    Node *curr = unmarked(d_head_p->d_next.loadAcquire());
+    while (curr) {
+        Node *next = curr->d_next.loadAcquire();
+        if ((curr->d_splitKey & 1) && !isMarked(next)) {
+            if (curr->d_next.testAndSwap(next, marked(next)) == next) {
+                --d_size;
+            }
+            continue;
+        }
+        curr = unmarked(next);
+    }
+
+    // Unlink the removed nodes.
+
+    Bucket *prev;
+    Node   *last;
+    find(&prev, &last, d_head_p, ~static_cast<Uint64>(0), 0);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    PinGuard guard(d_reclaimer_p);
+
+    const Uint64 hashValue = d_hasher(key);
+    const Uint64 splitKey  = Util::elementKey(hashValue);
+    Node        *start     = bucketNode(hashValue
+                                         & (d_numBuckets.loadAcquire() - 1));
+
+    for (;;) {
+        Bucket *prev;
+        Node   *curr;
+
+        if (!find(&prev, &curr, start, splitKey, &key)) {
+            return 0;                                                 // RETURN
+        }
+
+        Node *next = curr->d_next.loadAcquire();
+        if (isMarked(next)) {
+            continue;
+        }
+
+        if (curr->d_next.testAndSwap(next, marked(next)) == next) {
+            --d_size;
+            if (prev->testAndSwap(curr, next) == curr) {
+                d_reclaimer_p->retire(curr, &deleteNode, d_allocator_p);
+            }
+            else {
+                find(&prev, &curr, start, splitKey, &key);
+            }
+            return 1;                                                 // RETURN
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                                            const KEY&   key,
+                                                            const VALUE& value)
+{
+    return 1 - setValueImp<const VALUE&>(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                                const KEY&               key,
+                                                bslmf::MovableRef<VALUE> value)
+{
+    return 1 - setValueImp<bslmf::MovableRef<VALUE> >(
+                                           key,
+                                           bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::setComputedValue(
+                                                const KEY&             key,
+                                                const VisitorFunction& visitor)
+{
+    PinGuard guard(d_reclaimer_p);
+
+    Node *node = const_cast<Node *>(findNode(key));
+    if (node) {
+        return modify(node, visitor);                                 // RETURN
+    }
+
+    VALUE *value = static_cast<VALUE *>(
+                                       d_allocator_p->allocate(sizeof(VALUE)));
+    {
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(value,
+                                                            d_allocator_p);
+
+        bslma::ConstructionUtil::construct(value, d_allocator_p);
+        proctor.release();
+    }
+    {
+        bslma::RawDeleterProctor<VALUE, bslma::Allocator> proctor(
+                                                                value,
+                                                                d_allocator_p);
+
+        visitor(value, key);
+        proctor.release();
+    }
+
+    const Uint64 hashValue  = d_hasher(key);
+    const Uint64 numBuckets = d_numBuckets.loadAcquire();
+    Node        *start      = bucketNode(hashValue & (numBuckets - 1));
+
+    node = newElement(key, Util::elementKey(hashValue), value);
+
+    Node *curr = insertNode(node, start);
+    if (curr != node) {
+        // An element having 'key' was inserted concurrently.
+
+        deleteNode(node, d_allocator_p);
+        return modify(curr, visitor);                                 // RETURN
+    }
+
+    ++d_size;
+    expand(numBuckets);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::setValue(
+                                                            const KEY&   key,
+                                                            const VALUE& value)
+{
+    return setValueImp<const VALUE&>(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::setValue(
+                                                const KEY&               key,
+                                                bslmf::MovableRef<VALUE> value)
+{
+    return setValueImp<bslmf::MovableRef<VALUE> >(
+                                           key,
+                                           bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::update(
+                                                const KEY&             key,
+                                                const VisitorFunction& visitor)
+{
+    PinGuard guard(d_reclaimer_p);
+
+    Node *node = const_cast<Node *>(findNode(key));
+    if (0 == node) {
+        return 0;                                                     // RETURN
+    }
+    return modify(node, visitor);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::visit(
+                                                const VisitorFunction& visitor)
+{
+    PinGuard guard(d_reclaimer_p);
+
+    int   count = 0;
+    Node *curr  = unmarked(d_head_p->d_next.loadAcquire());
+    while (curr) {
+        Node *next = curr->d_next.loadAcquire();
+        if ((curr->d_splitKey & 1) && !isMarked(next)) {
+            ++count;
+            if (modify(curr, visitor) < 0) {
+                return -count;                                        // RETURN
+            }
+        }
+        curr = unmarked(next);
+    }
+    return count;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::bucketCount() const
+{
+    return static_cast<bsl::size_t>(d_numBuckets.loadAcquire());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return 0 == size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::getValue(
+                                                         VALUE      *value,
+                                                         const KEY&  key) const
+{
+    BSLS_ASSERT(value);
+
+    PinGuard guard(d_reclaimer_p);
+
+    const Node *node = findNode(key);
+    if (0 == node) {
+        return 0;                                                     // RETURN
+    }
+    *value = *node->d_value.loadAcquire();
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::loadFactor() const
+{
+    return static_cast<float>(size()) / static_cast<float>(bucketCount());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::maxLoadFactor() const
+{
+    return static_cast<float>(k_MAX_LOAD_FACTOR);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsls::Types::Int64 size = d_size.loadRelaxed();
+    return size > 0 ? static_cast<bsl::size_t>(size) : 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
+                                 const ReadOnlyVisitorFunction& visitor) const
+{
+    PinGuard guard(d_reclaimer_p);
+
+    int         count = 0;
+    const Node *curr  = unmarked(d_head_p->d_next.loadAcquire());
+    while (curr) {
+        Node *next = curr->d_next.loadAcquire();
+        if ((curr->d_splitKey & 1) && !isMarked(next)) {
+            ++count;
+            if (!visitor(*curr->d_value.loadAcquire(),
+                         *curr->d_key.address())) {
+                return -count;                                        // RETURN
+            }
+        }
+        curr = unmarked(next);
+    }
+    return count;
+}
+
+                               // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL>::allocator()
+                                                                          const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlcc::LockFreeUnorderedMap<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type {
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1145 @@
+// bdlcc_lockfreeunorderedmap.t.cpp                                   -*-C++-*-
+
+#include <bdlcc_lockfreeunorderedmap.h>
+
+#include <bdlcc_stripedunorderedmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a lock-free concurrent hash map.  The
+// basic functionality ('insert', 'getValue', 'erase', 'size') is verified
+// first with a single thread of execution, using a test allocator to confirm
+// that all memory (including memory retired through the epoch-based
+// reclaimer) is released.  The functor-based manipulators, growth of the
+// bucket array, and hash collisions are then verified.  Finally, concurrency
+// is exercised by multiple threads inserting, erasing, and reading
+// overlapping sets of keys.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+// ----------------------------------------------------------------------------
+// CLASS METHODS (component-private)
+// [ 2] Uint64 LockFreeUnorderedMap_Util::reverseBits(Uint64);
+// [ 2] Uint64 LockFreeUnorderedMap_Util::bucketKey(Uint64);
+// [ 2] Uint64 LockFreeUnorderedMap_Util::elementKey(Uint64);
+// [ 2] Uint64 LockFreeUnorderedMap_Util::parentBucket(Uint64);
+// [ 2] int LockFreeUnorderedMap_Util::segmentIndex(size_t *, Uint64);
+//
+// CREATORS
+// [ 3] LockFreeUnorderedMap(size_t numInitialBuckets, Allocator *bA);
+// [ 3] LockFreeUnorderedMap(EpochReclaimer *, size_t, Allocator *bA);
+// [ 3] ~LockFreeUnorderedMap();
+//
+// MANIPULATORS
+// [ 5] void clear();
+// [ 3] size_t erase(const KEY& key);
+// [ 3] size_t insert(const KEY& key, const VALUE& value);
+// [ 3] size_t insert(const KEY& key, MovableRef<VALUE> value);
+// [ 4] int setComputedValue(const KEY& key, const VisitorFunction& visitor);
+// [ 4] size_t setValue(const KEY& key, const VALUE& value);
+// [ 4] size_t setValue(const KEY& key, MovableRef<VALUE> value);
+// [ 4] int update(const KEY& key, const VisitorFunction& visitor);
+// [ 5] int visit(const VisitorFunction& visitor);
+//
+// ACCESSORS
+// [ 6] size_t bucketCount() const;
+// [ 3] bool empty() const;
+// [ 3] EQUAL equalFunction() const;
+// [ 3] size_t getValue(VALUE *value, const KEY& key) const;
+// [ 3] HASH hashFunction() const;
+// [ 6] float loadFactor() const;
+// [ 6] float maxLoadFactor() const;
+// [ 3] size_t size() const;
+// [ 5] int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+// [ 3] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 6] CONCERN: growth of the bucket array and hash collisions
+// [ 7] CONCERN: concurrent insert, erase, and lookup
+// [-1] PERFORMANCE: LockFreeUnorderedMap vs StripedUnorderedMap
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::LockFreeUnorderedMap<int, bsl::string> Obj;
+typedef bdlcc::LockFreeUnorderedMap_Util              Util;
+typedef bsls::Types::Uint64                           Uint64;
+
+// ============================================================================
+//                   GLOBAL STRUCTS/FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct BadHash {
+    // A hash functor mapping every key to one of four values, to force
+    // collisions.
+
+    bsl::size_t operator()(int key) const
+        // Return a hash value for the specified 'key'.
+    {
+        return static_cast<bsl::size_t>(key & 3);
+    }
+};
+
+bool incrementValue(int *value, const int&)
+    // Increment the specified '*value' and return 'true'.
+{
+    ++*value;
+    return true;
+}
+
+bool rejectValue(int *value, const int&)
+    // Set the specified '*value' to -1 and return 'false'.
+{
+    *value = -1;
+    return false;
+}
+
+bool sumValues(int *sum, const int& value, const int&)
+    // Add the specified 'value' to the specified '*sum' and return 'true'.
+{
+    *sum += value;
+    return true;
+}
+
+bool stopAfter(int *count, int limit, const int&, const int&)
+    // Increment the specified '*count' and return 'true' if the result is
+    // less than the specified 'limit', and 'false' otherwise.
+{
+    return ++*count < limit;
+}
+
+                          // ====================
+                          // class StressTestJob
+                          // ====================
+
+class StressTestJob {
+    // This class implements a job run by each thread of the concurrency test.
+    // Each thread owns a disjoint range of keys that it inserts, verifies,
+    // and erases, and in addition reads the keys of a shared, stable range.
+
+    // DATA
+    bdlcc::LockFreeUnorderedMap<int, int> *d_map_p;
+    bslmt::Barrier                        *d_barrier_p;
+    int                                    d_threadIndex;
+    int                                    d_numKeys;
+    int                                    d_numIterations;
+
+  public:
+    // CREATORS
+    StressTestJob(bdlcc::LockFreeUnorderedMap<int, int> *map,
+                  bslmt::Barrier                        *barrier,
+                  int                                    threadIndex,
+                  int                                    numKeys,
+                  int                                    numIterations)
+        // Create a job operating on the specified 'map', synchronizing on the
+        // specified 'barrier', for the thread with the specified
+        // 'threadIndex', using the specified 'numKeys' private keys, and
+        // running the specified 'numIterations'.
+    : d_map_p(map)
+    , d_barrier_p(barrier)
+    , d_threadIndex(threadIndex)
+    , d_numKeys(numKeys)
+    , d_numIterations(numIterations)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()()
+        // Run this job.
+    {
+        const int base = (d_threadIndex + 1) * 1000000;
+
+        d_barrier_p->wait();
+
+        for (int iter = 0; iter < d_numIterations; ++iter) {
+            for (int i = 0; i < d_numKeys; ++i) {
+                ASSERTV(d_threadIndex, i,
+                        1 == d_map_p->insert(base + i, iter));
+            }
+            for (int i = 0; i < d_numKeys; ++i) {
+                int value = -1;
+                ASSERTV(d_threadIndex, i,
+                        1 == d_map_p->getValue(&value, base + i));
+                ASSERTV(d_threadIndex, i, iter == value);
+
+                // Shared, stable keys are always present.
+
+                ASSERTV(d_threadIndex, i,
+                        1 == d_map_p->getValue(&value, i % 100));
+                ASSERTV(d_threadIndex, i, i % 100 == value);
+            }
+            for (int i = 0; i < d_numKeys; i += 2) {
+                ASSERTV(d_threadIndex, i, 1 == d_map_p->erase(base + i));
+            }
+            for (int i = 1; i < d_numKeys; i += 2) {
+                ASSERTV(d_threadIndex, i,
+                        1 == d_map_p->update(base + i, &incrementValue));
+                ASSERTV(d_threadIndex, i, 1 == d_map_p->erase(base + i));
+            }
+            for (int i = 0; i < d_numKeys; ++i) {
+                int value;
+                ASSERTV(d_threadIndex, i,
+                        0 == d_map_p->getValue(&value, base + i));
+            }
+        }
+    }
+};
+
+// ============================================================================
+//                          PERFORMANCE TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace perf {
+
+enum { k_MAX_THREADS = 256, k_STRIDE = 16 };
+
+void createMap(bdlcc::LockFreeUnorderedMap<int, int> **map,
+               int                                     numKeys,
+               bslma::Allocator                       *basicAllocator)
+    // Load into the specified 'map' a new map sized for the specified
+    // 'numKeys', using the specified 'basicAllocator' to supply memory.
+{
+    *map = new (*basicAllocator) bdlcc::LockFreeUnorderedMap<int, int>(
+                                                              numKeys,
+                                                              basicAllocator);
+}
+
+void createMap(bdlcc::StripedUnorderedMap<int, int> **map,
+               int                                    numKeys,
+               bslma::Allocator                      *basicAllocator)
+    // Load into the specified 'map' a new map sized for the specified
+    // 'numKeys', using the specified 'basicAllocator' to supply memory.
+{
+    *map = new (*basicAllocator) bdlcc::StripedUnorderedMap<int, int>(
+                                                              numKeys,
+                                                              64,
+                                                              basicAllocator);
+}
+
+template <class MAP>
+class Benchmark {
+    // This class provides the run functions used to compare the throughput
+    // of a hash map type 'MAP' under a read-mostly workload.
+
+    // DATA
+    MAP               *d_map_p;
+    int                d_numKeys;
+    bsl::vector<int>   d_state;      // per-thread key sequence, padded
+    bslma::Allocator  *d_allocator_p;
+
+  public:
+    // CREATORS
+    Benchmark(int numKeys, bslma::Allocator *basicAllocator)
+        // Create a benchmark on a map populated with the specified 'numKeys'
+        // elements, using the specified 'basicAllocator' to supply memory.
+    : d_map_p(0)
+    , d_numKeys(numKeys)
+    , d_state(2 * k_MAX_THREADS * k_STRIDE, 0, basicAllocator)
+    , d_allocator_p(basicAllocator)
+    {
+        createMap(&d_map_p, numKeys, basicAllocator);
+        for (int i = 0; i < numKeys; ++i) {
+            d_map_p->insert(i, i);
+        }
+    }
+
+    ~Benchmark()
+        // Destroy this object.
+    {
+        d_allocator_p->deleteObject(d_map_p);
+    }
+
+    // MANIPULATORS
+    void read(int threadIndex)
+        // Look up a key of the map, using the specified 'threadIndex' to
+        // select the key sequence.
+    {
+        int& state = d_state[threadIndex * k_STRIDE];
+        state = (state + 7919) % d_numKeys;
+
+        int value;
+        d_map_p->getValue(&value, state);
+    }
+
+    void write(int threadIndex)
+        // Replace the value of a key of the map, using the specified
+        // 'threadIndex' to select the key sequence.
+    {
+        int& state = d_state[(k_MAX_THREADS + threadIndex) * k_STRIDE];
+        state = (state + 104729) % d_numKeys;
+
+        d_map_p->setValue(state, threadIndex);
+    }
+};
+
+template <class MAP>
+void runBenchmark(const char *name,
+                  int         numReaders,
+                  int         numWriters,
+                  int         numKeys,
+                  int         numMillis,
+                  int         numSamples)
+    // Print, tagged with the specified 'name', the median throughput of
+    // 'numReaders' reader threads and 'numWriters' writer threads accessing a
+    // map of type 'MAP' holding the specified 'numKeys' elements, running
+    // the specified 'numSamples' samples of 'numMillis' milliseconds.
+{
+    bslma::NewDeleteAllocator        nalloc;
+    Benchmark<MAP>                   bench(numKeys, &nalloc);
+    bslmt::ThroughputBenchmark       tb(&nalloc);
+    bslmt::ThroughputBenchmarkResult result(&nalloc);
+
+    const int readerGroup = tb.addThreadGroup(
+                      bdlf::BindUtil::bind(&Benchmark<MAP>::read,
+                                           &bench,
+                                           bdlf::PlaceHolders::_1),
+                      numReaders,
+                      0);
+    int writerGroup = -1;
+    if (numWriters) {
+        writerGroup = tb.addThreadGroup(
+                      bdlf::BindUtil::bind(&Benchmark<MAP>::write,
+                                           &bench,
+                                           bdlf::PlaceHolders::_1),
+                      numWriters,
+                      0);
+    }
+
+    tb.execute(&result, numMillis, numSamples);
+
+    double readMedian  = 0;
+    double writeMedian = 0;
+    result.getMedian(&readMedian, readerGroup);
+    if (writerGroup >= 0) {
+        result.getMedian(&writeMedian, writerGroup);
+    }
+
+    bsl::cout << name << "," << numReaders << "," << numWriters << ","
+              << bsl::fixed << bsl::setprecision(0) << readMedian << ","
+              << writeMedian << "\n";
+}
+
+}  // close namespace perf
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// This example shows some basic usage of 'bdlcc::LockFreeUnorderedMap'.
+//
+// First, we define a 'bdlcc::LockFreeUnorderedMap' object, 'sessions', that
+// maps 'int' session handles to 'bsl::string' user names:
+//..
+    bdlcc::LockFreeUnorderedMap<int, bsl::string> sessions;
+//..
+// Then, we insert three elements into the map and verify that the size is the
+// expected value:
+//..
+    ASSERT(0 == sessions.size());
+    sessions.insert(0, "Alex");
+    sessions.insert(1, "John");
+    sessions.insert(2, "Rob");
+    ASSERT(3 == sessions.size());
+//..
+// Next, we use the 'getValue' method to retrieve the previously inserted
+// string associated with the value 1:
+//..
+    bsl::string value;
+    bsl::size_t rc = sessions.getValue(&value, 1);
+    ASSERT(1      == rc);
+    ASSERT("John" == value);
+//..
+// Now, we change the value associated with 1 from "John" to "Jack" and confirm
+// that the size of the map has not changed:
+//..
+    rc = sessions.setValue(1, "Jack");
+    ASSERT(1 == rc);
+    ASSERT(3 == sessions.size());
+
+    rc = sessions.getValue(&value, 1);
+    ASSERT(1      == rc);
+    ASSERT("Jack" == value);
+//..
+// Finally, we erase the element '(2, "Rob")' from the map, confirm that the
+// map size is decremented, and that element can no longer be found in the map:
+//..
+    rc = sessions.erase(2);
+    ASSERT(1 == rc);
+    ASSERT(2 == sessions.size());
+
+    rc = sessions.getValue(&value, 2);
+    ASSERT(0 == rc);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENT INSERT, ERASE, AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Elements inserted by one thread are found by that thread, and
+        //:   erased elements are no longer found, while other threads are
+        //:   concurrently modifying the map.
+        //:
+        //: 2 Elements not modified by any thread are always found.
+        //:
+        //: 3 All memory is released when the map is destroyed.
+        //
+        // Plan:
+        //: 1 Populate a map with a stable range of keys.  Run several threads
+        //:   that each repeatedly insert, look up, update, and erase a
+        //:   private range of keys, and look up the stable keys.  (C-1..2)
+        //:
+        //: 2 Verify the final size, and use a test allocator to verify that
+        //:   no memory is leaked.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: concurrent insert, erase, and lookup
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT INSERT, ERASE, AND LOOKUP" << endl
+                          << "====================================" << endl;
+
+        enum { k_NUM_THREADS = 8, k_NUM_KEYS = 500, k_NUM_ITERATIONS = 20 };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            bdlcc::LockFreeUnorderedMap<int, int> mX(2, &oa);
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i, i);
+            }
+
+            bslmt::Barrier     barrier(k_NUM_THREADS);
+            bslmt::ThreadGroup threads(&oa);
+
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                threads.addThread(StressTestJob(&mX,
+                                                &barrier,
+                                                t,
+                                                k_NUM_KEYS,
+                                                k_NUM_ITERATIONS));
+            }
+            threads.joinAll();
+
+            ASSERTV(mX.size(), 100 == mX.size());
+
+            for (int i = 0; i < 100; ++i) {
+                int value = -1;
+                ASSERTV(i, 1 == mX.getValue(&value, i));
+                ASSERTV(i, i == value);
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // BUCKET GROWTH AND HASH COLLISIONS
+        //
+        // Concerns:
+        //: 1 The number of buckets doubles when the load factor exceeds
+        //:   'maxLoadFactor()', and all elements remain accessible.
+        //:
+        //: 2 Keys having identical hash values are distinguished by the
+        //:   equality functor.
+        //
+        // Plan:
+        //: 1 Insert a large number of elements into a map with 2 initial
+        //:   buckets, verify 'bucketCount' and 'loadFactor', and look up
+        //:   and erase every element.  (C-1)
+        //:
+        //: 2 Repeat with a hash functor that maps all keys to four values.
+        //:   (C-2)
+        //
+        // Testing:
+        //   size_t bucketCount() const;
+        //   float loadFactor() const;
+        //   float maxLoadFactor() const;
+        //   CONCERN: growth of the bucket array and hash collisions
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BUCKET GROWTH AND HASH COLLISIONS" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            enum { k_NUM_ELEMENTS = 10000 };
+
+            bdlcc::LockFreeUnorderedMap<int, int> mX(2, &oa);
+            const bdlcc::LockFreeUnorderedMap<int, int>& X = mX;
+
+            ASSERT(2   == X.bucketCount());
+            ASSERT(2.0 == X.maxLoadFactor());
+
+            for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                ASSERTV(i, 1 == mX.insert(i, -i));
+                ASSERTV(i, X.loadFactor() <= X.maxLoadFactor() + 1.0f);
+            }
+            ASSERTV(X.bucketCount(), k_NUM_ELEMENTS / 2 <= X.bucketCount());
+            ASSERTV(X.bucketCount(), k_NUM_ELEMENTS * 2 >= X.bucketCount());
+
+            for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                int value = 1;
+                ASSERTV(i, 1  == X.getValue(&value, i));
+                ASSERTV(i, -i == value);
+            }
+            for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            ASSERT(X.empty());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        {
+            enum { k_NUM_ELEMENTS = 500 };
+
+            bdlcc::LockFreeUnorderedMap<int, int, BadHash> mX(4, &oa);
+            const bdlcc::LockFreeUnorderedMap<int, int, BadHash>& X = mX;
+
+            for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                ASSERTV(i, 1 == mX.insert(i, i * 3));
+            }
+            ASSERT(k_NUM_ELEMENTS == X.size());
+
+            for (int i = 0; i < k_NUM_ELEMENTS; i += 3) {
+                ASSERTV(i, 1 == mX.erase(i));
+                ASSERTV(i, 0 == mX.erase(i));
+            }
+            for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                int value = -1;
+                if (0 == i % 3) {
+                    ASSERTV(i, 0 == X.getValue(&value, i));
+                }
+                else {
+                    ASSERTV(i, 1     == X.getValue(&value, i));
+                    ASSERTV(i, i * 3 == value);
+                }
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'visit', 'visitReadOnly', AND 'clear'
+        //
+        // Concerns:
+        //: 1 'visit' and 'visitReadOnly' invoke the visitor once for each
+        //:   element, and stop when the visitor returns 'false', returning
+        //:   the negated number of visited elements.
+        //:
+        //: 2 Modifications made by the 'visit' visitor are published.
+        //:
+        //: 3 'clear' removes all elements, and the map is usable afterwards.
+        //
+        // Plan:
+        //: 1 Populate a map, and verify the results of 'visit' and
+        //:   'visitReadOnly' with visitors that accumulate values and that
+        //:   stop early.  (C-1..2)
+        //:
+        //: 2 Call 'clear', verify that the map is empty, and insert again.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void clear();
+        //   int visit(const VisitorFunction& visitor);
+        //   int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'visit', 'visitReadOnly', AND 'clear'" << endl
+                          << "=====================================" << endl;
+
+        typedef bdlcc::LockFreeUnorderedMap<int, int> IntMap;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            IntMap mX(16, &oa);  const IntMap& X = mX;
+
+            for (int i = 1; i <= 100; ++i) {
+                mX.insert(i, i);
+            }
+
+            int sum = 0;
+            ASSERT(100 == X.visitReadOnly(
+                           bdlf::BindUtil::bind(&sumValues,
+                                                &sum,
+                                                bdlf::PlaceHolders::_1,
+                                                bdlf::PlaceHolders::_2)));
+            ASSERTV(sum, 5050 == sum);
+
+            ASSERT(100 == mX.visit(&incrementValue));
+
+            sum = 0;
+            X.visitReadOnly(bdlf::BindUtil::bind(&sumValues,
+                                                 &sum,
+                                                 bdlf::PlaceHolders::_1,
+                                                 bdlf::PlaceHolders::_2));
+            ASSERTV(sum, 5150 == sum);
+
+            int count = 0;
+            ASSERT(-10 == X.visitReadOnly(
+                           bdlf::BindUtil::bind(&stopAfter,
+                                                &count,
+                                                10,
+                                                bdlf::PlaceHolders::_1,
+                                                bdlf::PlaceHolders::_2)));
+            ASSERT(-1 == mX.visit(&rejectValue));
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 == X.visitReadOnly(
+                           bdlf::BindUtil::bind(&sumValues,
+                                                &sum,
+                                                bdlf::PlaceHolders::_1,
+                                                bdlf::PlaceHolders::_2)));
+
+            ASSERT(1 == mX.insert(7, 7));
+            ASSERT(1 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'setValue', 'setComputedValue', AND 'update'
+        //
+        // Concerns:
+        //: 1 'setValue' replaces the value of an existing element and returns
+        //:   1, or inserts a new element and returns 0.
+        //:
+        //: 2 'setComputedValue' inserts a default-constructed value modified
+        //:   by the visitor and returns 0 if the key is absent, and otherwise
+        //:   returns 1 or -1 depending on the result of the visitor.
+        //:
+        //: 3 'update' does nothing and returns 0 if the key is absent.
+        //
+        // Plan:
+        //: 1 Use the methods on a map of 'int' to 'int', and verify the
+        //:   return values and resulting values.  (C-1..3)
+        //
+        // Testing:
+        //   int setComputedValue(const KEY& key, const VisitorFunction& v);
+        //   size_t setValue(const KEY& key, const VALUE& value);
+        //   size_t setValue(const KEY& key, MovableRef<VALUE> value);
+        //   int update(const KEY& key, const VisitorFunction& visitor);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'setValue', 'setComputedValue', AND 'update'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        typedef bdlcc::LockFreeUnorderedMap<int, int> IntMap;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            IntMap mX(16, &oa);  const IntMap& X = mX;
+
+            int value = 0;
+
+            ASSERT(0 == mX.setValue(1, 10));
+            ASSERT(1 == mX.setValue(1, 11));
+            ASSERT(1 == X.getValue(&value, 1));
+            ASSERT(11 == value);
+
+            int moved = 12;
+            ASSERT(1 == mX.setValue(1, bslmf::MovableRefUtil::move(moved)));
+            ASSERT(1 == X.getValue(&value, 1));
+            ASSERT(12 == value);
+
+            ASSERT(0 == mX.setComputedValue(2, &incrementValue));
+            ASSERT(1 == X.getValue(&value, 2));
+            ASSERT(1 == value);
+            ASSERT(1 == mX.setComputedValue(2, &incrementValue));
+            ASSERT(1 == X.getValue(&value, 2));
+            ASSERT(2 == value);
+            ASSERT(-1 == mX.setComputedValue(2, &rejectValue));
+            ASSERT(1 == X.getValue(&value, 2));
+            ASSERT(-1 == value);
+
+            ASSERT(0 == mX.update(3, &incrementValue));
+            ASSERT(0 == X.getValue(&value, 3));
+            ASSERT(1 == mX.update(1, &incrementValue));
+            ASSERT(1 == X.getValue(&value, 1));
+            ASSERT(13 == value);
+            ASSERT(-1 == mX.update(1, &rejectValue));
+
+            ASSERT(2 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 'insert' adds an element and returns 1, or updates an existing
+        //:   element and returns 0.
+        //:
+        //: 2 'getValue' finds inserted elements, and 'erase' removes them.
+        //:
+        //: 3 'size' and 'empty' reflect the number of elements.
+        //:
+        //: 4 All memory comes from the object allocator and is released on
+        //:   destruction, including memory retired by 'erase' and value
+        //:   replacement.
+        //:
+        //: 5 Maps constructed with a shared reclaimer retire memory to that
+        //:   reclaimer, which releases it, possibly after the maps are
+        //:   destroyed.
+        //
+        // Plan:
+        //: 1 Insert, look up, and erase elements of a map using a test
+        //:   allocator, verifying return values and accessors after each
+        //:   operation.  (C-1..3)
+        //:
+        //: 2 Verify that no memory is in use after the map is destroyed, and
+        //:   that the default allocator is used only when no allocator is
+        //:   supplied.  (C-4)
+        //:
+        //: 3 Create many maps sharing one reclaimer and erase elements from
+        //:   each.  Verify that some erased elements are still held by the
+        //:   reclaimer after the maps are destroyed, and that they are
+        //:   released by subsequent calls to 'reclaim'.  (C-5)
+        //
+        // Testing:
+        //   LockFreeUnorderedMap(size_t numInitialBuckets, Allocator *bA);
+        //   LockFreeUnorderedMap(EpochReclaimer *, size_t, Allocator *bA);
+        //   ~LockFreeUnorderedMap();
+        //   size_t erase(const KEY& key);
+        //   size_t insert(const KEY& key, const VALUE& value);
+        //   size_t insert(const KEY& key, MovableRef<VALUE> value);
+        //   bool empty() const;
+        //   EQUAL equalFunction() const;
+        //   size_t getValue(VALUE *value, const KEY& key) const;
+        //   HASH hashFunction() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                          << "========================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(Obj::k_DEFAULT_NUM_BUCKETS, &oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.equalFunction()(3, 3));
+            ASSERT(X.hashFunction()(3) == bsl::hash<int>()(3));
+
+            bsl::string value;
+            ASSERT(0 == X.getValue(&value, 1));
+
+            const char *VALUES[] = { "a", "bb",
+                            "a string long enough to allocate memory", "" };
+            const int   NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < 200; ++i) {
+                ASSERTV(i, 1 == mX.insert(i, VALUES[i % NUM_VALUES]));
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+            }
+            ASSERT(!X.empty());
+
+            for (int i = 0; i < 200; ++i) {
+                ASSERTV(i, 1 == X.getValue(&value, i));
+                ASSERTV(i, VALUES[i % NUM_VALUES] == value);
+            }
+
+            for (int i = 0; i < 200; ++i) {
+                bsl::string s(VALUES[(i + 1) % NUM_VALUES]);
+                ASSERTV(i, 0 == mX.insert(i,
+                                          bslmf::MovableRefUtil::move(s)));
+                ASSERTV(i, 1 == X.getValue(&value, i));
+                ASSERTV(i, VALUES[(i + 1) % NUM_VALUES] == value);
+            }
+            ASSERT(200 == X.size());
+
+            for (int i = 0; i < 200; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+                ASSERTV(i, 0 == mX.erase(i));
+                ASSERTV(i, 0 == X.getValue(&value, i));
+            }
+            ASSERT(100 == X.size());
+
+            for (int i = 1; i < 200; i += 2) {
+                ASSERTV(i, 1 == X.getValue(&value, i));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        {
+            Obj mX;
+            ASSERT(&defaultAllocator == mX.allocator());
+            mX.insert(1, "one");
+        }
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\tMaps sharing a reclaimer." << endl;
+        {
+            enum { k_NUM_MAPS = 100 };
+
+            bslma::TestAllocator ra("reclaimer", veryVeryVeryVerbose);
+
+            bdlcc::EpochReclaimer reclaimer(&ra);
+            {
+                bsl::vector<Obj *> maps(&oa);
+                for (int i = 0; i < k_NUM_MAPS; ++i) {
+                    maps.push_back(new (oa) Obj(&reclaimer, 4, &oa));
+                }
+
+                for (int i = 0; i < k_NUM_MAPS; ++i) {
+                    for (int j = 0; j < 10; ++j) {
+                        maps[i]->insert(j, "a string long enough to allocate");
+                    }
+                    for (int j = 0; j < 10; j += 2) {
+                        ASSERTV(i, j, 1 == maps[i]->erase(j));
+                    }
+                    ASSERTV(i, 5 == maps[i]->size());
+                }
+                for (int i = 0; i < k_NUM_MAPS; ++i) {
+                    oa.deleteObject(maps[i]);
+                }
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 < oa.numBlocksInUse());
+
+            reclaimer.reclaim();
+            reclaimer.reclaim();
+            reclaimer.reclaim();
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SPLIT-ORDER UTILITIES
+        //
+        // Concerns:
+        //: 1 'reverseBits' reverses the order of bits.
+        //:
+        //: 2 Bucket keys are even and element keys are odd, and the sentinel
+        //:   of a bucket orders before the elements hashed to it.
+        //:
+        //: 3 'parentBucket' clears the most significant set bit.
+        //:
+        //: 4 'segmentIndex' maps buckets to doubling segments.
+        //
+        // Plan:
+        //: 1 Verify the functions on representative values.  (C-1..4)
+        //
+        // Testing:
+        //   Uint64 LockFreeUnorderedMap_Util::reverseBits(Uint64);
+        //   Uint64 LockFreeUnorderedMap_Util::bucketKey(Uint64);
+        //   Uint64 LockFreeUnorderedMap_Util::elementKey(Uint64);
+        //   Uint64 LockFreeUnorderedMap_Util::parentBucket(Uint64);
+        //   int LockFreeUnorderedMap_Util::segmentIndex(size_t *, Uint64);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SPLIT-ORDER UTILITIES" << endl
+                          << "=====================" << endl;
+
+        ASSERT(0 == Util::reverseBits(0));
+        ASSERT(0x8000000000000000ULL == Util::reverseBits(1));
+        ASSERT(1 == Util::reverseBits(0x8000000000000000ULL));
+        ASSERT(0xF0F0000000000000ULL == Util::reverseBits(0x0F0F));
+        Uint64 v = 1;
+        for (int i = 0; i < 1000; ++i, v = v * 6364136223846793005ULL + 1) {
+            ASSERTV(v, v == Util::reverseBits(Util::reverseBits(v)));
+        }
+
+        for (Uint64 b = 0; b < 1000; ++b) {
+            ASSERTV(b, 0 == (Util::bucketKey(b) & 1));
+            ASSERTV(b, 1 == (Util::elementKey(b) & 1));
+            ASSERTV(b, Util::bucketKey(b) < Util::elementKey(b));
+        }
+
+        ASSERT(0  == Util::parentBucket(1));
+        ASSERT(0  == Util::parentBucket(2));
+        ASSERT(1  == Util::parentBucket(3));
+        ASSERT(5  == Util::parentBucket(13));
+        ASSERT(0  == Util::parentBucket(64));
+
+        static const struct {
+            int    d_line;
+            Uint64 d_bucket;
+            int    d_segment;
+            int    d_offset;
+        } DATA[] = {
+            { L_,    0, 0,   0 },
+            { L_,    1, 0,   1 },
+            { L_,    2, 1,   0 },
+            { L_,    3, 1,   1 },
+            { L_,    4, 2,   0 },
+            { L_,    7, 2,   3 },
+            { L_, 1000, 9, 488 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            bsl::size_t offset = 99;
+            ASSERTV(LINE, DATA[ti].d_segment ==
+                                Util::segmentIndex(&offset, DATA[ti].d_bucket));
+            ASSERTV(LINE, DATA[ti].d_offset == static_cast<int>(offset));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert, look up, and erase elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(Obj::k_DEFAULT_NUM_BUCKETS, &oa);  const Obj& X = mX;
+
+            ASSERT(0 == X.size());
+            ASSERT(1 == mX.insert(1, "one"));
+            ASSERT(1 == mX.insert(2, "two"));
+            ASSERT(0 == mX.insert(1, "uno"));
+            ASSERT(2 == X.size());
+
+            bsl::string value;
+            ASSERT(1 == X.getValue(&value, 1));
+            ASSERT("uno" == value);
+            ASSERT(1 == mX.erase(1));
+            ASSERT(0 == X.getValue(&value, 1));
+            ASSERT(1 == X.size());
+
+            if (veryVerbose) { P_(X.size()) P(X.bucketCount()) }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: LOCK-FREE VS STRIPED MAP
+        //   Compare the median throughput of readers (and optionally writers)
+        //   of 'bdlcc::LockFreeUnorderedMap' and 'bdlcc::StripedUnorderedMap'
+        //   for an increasing number of threads.  Command line parameters:
+        //   2nd parameter: maximum number of reader threads (defaults to 8).
+        //   3rd parameter: number of writer threads (defaults to 0).
+        //   4th parameter: number of keys (defaults to 10000).
+        //   5th parameter: milliseconds per sample (defaults to 1000).
+        //   6th parameter: number of samples (defaults to 5).
+        //
+        // Concerns:
+        //: 1 Read throughput of 'LockFreeUnorderedMap' scales with the number
+        //:   of threads.
+        //
+        // Plan:
+        //: 1 Run 'bslmt::ThroughputBenchmark' on each map type, doubling the
+        //:   number of readers, and print the results as CSV.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: LockFreeUnorderedMap vs StripedUnorderedMap
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: LOCK-FREE VS STRIPED MAP" << endl
+                          << "=====================================" << endl;
+
+        const int maxReaders = argc > 2 ? atoi(argv[2]) :     8;
+        const int numWriters = argc > 3 ? atoi(argv[3]) :     0;
+        const int numKeys    = argc > 4 ? atoi(argv[4]) : 10000;
+        const int numMillis  = argc > 5 ? atoi(argv[5]) :  1000;
+        const int numSamples = argc > 6 ? atoi(argv[6]) :     5;
+
+        typedef bdlcc::LockFreeUnorderedMap<int, int> LockFreeMap;
+        typedef bdlcc::StripedUnorderedMap<int, int>  StripedMap;
+
+        bsl::cout << "Map,Readers,Writers,ReadOps/s,WriteOps/s\n";
+        for (int numReaders = 1; numReaders <= maxReaders; numReaders *= 2) {
+            perf::runBenchmark<LockFreeMap>("LockFree",
+                                            numReaders,
+                                            numWriters,
+                                            numKeys,
+                                            numMillis,
+                                            numSamples);
+            perf::runBenchmark<StripedMap>("Striped",
+                                           numReaders,
+                                           numWriters,
+                                           numKeys,
+                                           numMillis,
+                                           numSamples);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.  The
+    // benchmarks create threads, which may use the global allocator.
+
+    if (test >= 0) {
+        LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                    0 == globalAllocator.numBlocksTotal());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,31 @@
+// bdlcc_readoptimizedobjectcatalog.cpp                               -*-C++-*-
+#include <bdlcc_readoptimizedobjectcatalog.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_readoptimizedobjectcatalog_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// A lookup validates the handle, loads the object pointer, and validates the
+// handle again.  Writers publish a slot by storing the object pointer before
+// the busy handle, and free a slot by storing the non-busy handle before
+// clearing the object pointer.  Therefore, if both loads of the handle match,
+// the object pointer was loaded while the slot held the object designated by
+// the handle (barring 256 intervening reuses of the slot), and the epoch guard
+// held by the lookup keeps that object alive until the copy is complete.
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
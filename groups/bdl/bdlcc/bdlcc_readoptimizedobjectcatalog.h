@@ -0,0 +1,925 @@
+// bdlcc_readoptimizedobjectcatalog.h                                 -*-C++-*-
+#ifndef INCLUDED_BDLCC_READOPTIMIZEDOBJECTCATALOG
+#define INCLUDED_BDLCC_READOPTIMIZEDOBJECTCATALOG
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an indexed object container with lock-free lookups.
+//
+//@CLASSES:
+//  bdlcc::ReadOptimizedObjectCatalog: indexed container with lock-free reads
+//  bdlcc::ReadOptimizedObjectCatalogIter: iterator over the catalog
+//
+//@SEE_ALSO: bdlcc_objectcatalog, bdlcc_epochreclaimer
+//
+//@DESCRIPTION: This component provides a thread-safe, indexed catalog of
+// objects, 'bdlcc::ReadOptimizedObjectCatalog', having the same interface and
+// handle semantics as 'bdlcc::ObjectCatalog', but in which the lookup
+// operations, 'find' and 'isMember', do not take a lock and do not write to
+// any memory shared between threads.  Only the modifying operations ('add',
+// 'remove', 'removeAll', and 'replace') serialize on a mutex.
+//
+// 'bdlcc::ObjectCatalog' takes a read lock on a 'bslmt::RWMutex' for every
+// lookup, which is an atomic read-modify-write operation on a cache line
+// shared by all readers.  When many threads look up handles concurrently (for
+// example, every I/O callback of a multi-threaded reactor resolving a session
+// handle), that cache line moves from core to core on every lookup even in
+// the absence of writers.  'bdlcc::ReadOptimizedObjectCatalog' is intended
+// for such read-mostly workloads.
+//
+///Handles
+///-------
+// A handle encodes the index of the slot holding the object and a generation
+// count of that slot, in the same format as 'bdlcc::ObjectCatalog'.  A lookup
+// validates the handle against the slot's current handle using acquire loads,
+// so that a handle of a removed object is rejected even if its slot has been
+// reused, unless the slot was reused 256 times in the meantime.
+//
+///Slot Array Growth
+///-----------------
+// Slots are allocated in segments of doubling size, and a segment is never
+// moved or released before the catalog is destroyed.  The slot array can
+// therefore grow while lookups are in progress.  Note that 'removeAll' makes
+// all slots available for reuse, but does not release them.  A catalog has a
+// maximum capacity of 2^23 objects.
+//
+///Value Lifetime
+///--------------
+// Each object is held in a separately allocated buffer.  'replace' publishes a
+// new buffer, and 'remove' unpublishes the existing one; in both cases the
+// previous object is destroyed only once no concurrent lookup can still be
+// accessing it (see 'bdlcc_epochreclaimer').  Consequently:
+//
+//: o 'remove' and 'removeAll' *copy* (rather than move) the removed objects
+//:   into the optionally supplied buffer, because a concurrent 'find' may be
+//:   copying the same object.
+//:
+//: o Destruction of removed or replaced objects is deferred, and such objects
+//:   may be destroyed by any thread that subsequently modifies the catalog.
+//:
+//: o 'value' does not protect the object it refers to, so the returned
+//:   reference remains valid only until the object is removed or replaced:
+//:   from then on, the object may be destroyed as soon as *any* thread
+//:   modifies the catalog.  Use 'find', which copies the object while it is
+//:   protected, if the object may be removed or replaced concurrently.
+//
+///Iteration
+///---------
+// 'bdlcc::ReadOptimizedObjectCatalogIter' iterates over the objects of a
+// catalog, holding the catalog's modification lock for its lifetime.
+// Lookups proceed concurrently with iteration, but modifications block until
+// the iterator is destroyed.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::ReadOptimizedObjectCatalog' is fully thread-safe (see
+// {'bsldoc_glossary'|Fully Thread-Safe}), assuming that the allocator is fully
+// thread-safe.  'TYPE' must be copy-constructible, and its copy constructor
+// and 'operator==' must be safe to invoke concurrently on the same object.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Session Table
+/// - - - - - - - - - - - -
+// Suppose that a server keeps a table of client sessions that is consulted,
+// using an opaque handle, on every I/O event, and modified only when sessions
+// are opened or closed.
+//
+// First, we create a catalog of session names:
+//..
+//  bdlcc::ReadOptimizedObjectCatalog<bsl::string> sessions;
+//..
+// Then, we open two sessions, and give the resulting handles to the I/O
+// layer:
+//..
+//  int handleA = sessions.add("alpha");
+//  int handleB = sessions.add("beta");
+//  assert(2 == sessions.length());
+//..
+// Next, on each I/O event, we look up the session by handle.  This lookup
+// does not take a lock and may proceed concurrently on any number of threads:
+//..
+//  bsl::string name;
+//  assert(0       == sessions.find(handleA, &name));
+//  assert("alpha" == name);
+//  assert(sessions.isMember("beta"));
+//..
+// Finally, we close a session.  Subsequent lookups using its handle fail,
+// even once its slot is reused by a new session:
+//..
+//  assert(0 == sessions.remove(handleB));
+//  int handleC = sessions.add("gamma");
+//
+//  assert(0       != sessions.find(handleB));
+//  assert(0       == sessions.find(handleC, &name));
+//  assert("gamma" == name);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_epochreclaimer.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_scalarprimitives.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+template <class TYPE>
+class ReadOptimizedObjectCatalogIter;
+
+                     // ================================
+                     // class ReadOptimizedObjectCatalog
+                     // ================================
+
+template <class TYPE>
+class ReadOptimizedObjectCatalog {
+    // This class defines an indexed object catalog of 'TYPE' objects in which
+    // lookups are lock-free and modifications are serialized by a mutex.  This
+    // container is *exception* *neutral* with no guarantee of rollback: if an
+    // exception is thrown during the invocation of a method on a pre-existing
+    // instance, the object is left in a valid but undefined state.  In no
+    // event is memory leaked or a mutex left in a locked state.
+
+    // PRIVATE TYPES
+    enum {
+        // Masks used for breaking up a handle, identical to those of
+        // 'bdlcc::ObjectCatalog'.
+
+        k_INDEX_MASK      = 0x007fffff,
+        k_BUSY_INDICATOR  = 0x00800000,
+        k_GENERATION_INC  = 0x01000000,
+        k_GENERATION_MASK = 0xff000000
+    };
+
+    enum {
+        k_FIRST_SEGMENT_BITS = 6,   // log2 of the number of slots in the
+                                    // first segment
+
+        k_NUM_SEGMENTS       = 18   // number of segments needed to hold
+                                    // 'k_BUSY_INDICATOR' slots
+    };
+
+    struct Node {
+        // A slot of the catalog.  'd_handle' and 'd_value_p' are read
+        // concurrently by lookups; 'd_nextFree_p' is accessed only under the
+        // modification lock.
+
+        bsls::AtomicInt            d_handle;      // current handle; the busy
+                                                  // bit is set if occupied
+
+        bsls::AtomicPointer<TYPE>  d_value_p;     // object, or 0 if free
+
+        Node                      *d_nextFree_p;  // next free slot
+    };
+
+    // DATA
+    bsls::AtomicPointer<Node>  d_segments[k_NUM_SEGMENTS];
+                                              // slot segments, allocated on
+                                              // demand
+
+    bsls::AtomicInt            d_numSlots;    // number of slots ever used
+
+    Node                      *d_nextFreeNode_p;
+                                              // free list
+
+    bsls::AtomicInt            d_length;      // number of objects
+
+    mutable EpochReclaimer     d_reclaimer;   // deferred destruction of
+                                              // removed objects
+
+    mutable bslmt::Mutex       d_lock;        // serializes modifications
+
+    bslma::Allocator          *d_allocator_p; // memory allocator (held, not
+                                              // owned)
+
+    // FRIENDS
+    friend class ReadOptimizedObjectCatalogIter<TYPE>;
+
+    // NOT IMPLEMENTED
+    ReadOptimizedObjectCatalog(const ReadOptimizedObjectCatalog&)
+                                                          BSLS_KEYWORD_DELETED;
+    ReadOptimizedObjectCatalog& operator=(const ReadOptimizedObjectCatalog&)
+                                                          BSLS_KEYWORD_DELETED;
+
+    // PRIVATE CLASS METHODS
+    static int segmentIndex(int *offset, int index);
+        // Return the index of the segment holding the slot having the
+        // specified 'index', and load into the specified 'offset' the position
+        // of the slot within that segment.  Segment 's' holds
+        // '2^(k_FIRST_SEGMENT_BITS + s)' slots.
+
+    // PRIVATE MANIPULATORS
+    Node *acquireNode();
+        // Return a free slot, removed from the free list or newly allocated.
+        // The behavior is undefined unless the modification lock is held.
+
+    void freeNode(Node *node);
+        // Unpublish the object held by the specified 'node', retire it, and
+        // add 'node' to the free list.  The behavior is undefined unless the
+        // modification lock is held and 'node' is occupied.
+
+    int publish(Node *node, TYPE *value);
+        // Publish the specified 'value' in the specified free 'node', and
+        // return the resulting handle.  The behavior is undefined unless the
+        // modification lock is held.
+
+    // PRIVATE ACCESSORS
+    Node *findNode(int handle) const;
+        // Return the address of the slot having the specified 'handle', or 0
+        // if no slot has 'handle'.  Note that the returned slot may be
+        // concurrently modified unless the modification lock is held.
+
+    Node *nodeAt(int index) const;
+        // Return the address of the slot having the specified 'index', or 0
+        // if that slot has not been allocated.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ReadOptimizedObjectCatalog,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    ReadOptimizedObjectCatalog(bslma::Allocator *basicAllocator = 0);
+        // Create an empty object catalog.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~ReadOptimizedObjectCatalog();
+        // Destroy this object catalog.  The behavior is undefined unless no
+        // other thread is accessing this catalog.
+
+    // MANIPULATORS
+    int add(const TYPE& object);
+        // Add the value of the specified 'object' to this catalog and return a
+        // non-zero integer handle that may be used to refer to the object in
+        // future calls to this catalog.  The behavior is undefined if the
+        // catalog was full.
+
+    int add(bslmf::MovableRef<TYPE> object);
+        // Add the value of the specified 'object' to this catalog and return a
+        // non-zero integer handle that may be used to refer to the object in
+        // future calls to this catalog, leaving 'object' in an unspecified but
+        // valid state.  The behavior is undefined if the catalog was full.
+
+    int remove(int handle, TYPE *valueBuffer = 0);
+        // Optionally load into the optionally specified 'valueBuffer' the
+        // value of the object having the specified 'handle' and remove it from
+        // this catalog.  Return zero on success, and a non-zero value if the
+        // 'handle' is not contained in this catalog.  Note that 'valueBuffer'
+        // is assigned into (by copy), and thus must point to a valid 'TYPE'
+        // instance.
+
+    void removeAll(bsl::vector<TYPE> *buffer = 0);
+        // Remove all objects that are currently held in this catalog and
+        // optionally load into the optionally specified 'buffer' copies of the
+        // removed objects.
+
+    int replace(int handle, const TYPE& newObject);
+        // Replace the object having the specified 'handle' with the specified
+        // 'newObject'.  Return 0 on success, and a non-zero value if the
+        // handle is not contained in this catalog.
+
+    int replace(int handle, bslmf::MovableRef<TYPE> newObject);
+        // Replace the object having the specified 'handle' with the specified
+        // 'newObject', leaving 'newObject' in an unspecified but valid state.
+        // Return 0 on success, and a non-zero value if the handle is not
+        // contained in this catalog.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object.
+
+    int find(int handle) const;
+    int find(int handle, TYPE *valueBuffer) const;
+        // Locate the object having the specified 'handle' and optionally load
+        // its value into the optionally specified 'valueBuffer'.  Return zero
+        // on success, and a non-zero value if the 'handle' is not contained in
+        // this catalog.  Note that 'valueBuffer' is assigned into, and thus
+        // must point to a valid 'TYPE' instance.  Note that this method does
+        // not take a lock.
+
+    bool isMember(const TYPE& object) const;
+        // Return 'true' if the catalog contains an item that compares equal to
+        // the specified 'object' and 'false' otherwise.  Note that this method
+        // does not take a lock, and that objects added or removed
+        // concurrently may or may not be considered.
+
+    int length() const;
+        // Return a "snapshot" of the number of items currently contained in
+        // this catalog.
+
+    const TYPE& value(int handle) const;
+        // Return a 'const' reference to the object having the specified
+        // 'handle'.  The behavior is undefined unless 'handle' is contained in
+        // this catalog.  Note that the returned reference may be invalidated
+        // by any modification of this catalog, by any thread, once the object
+        // has been removed or replaced (see {Value Lifetime}).
+
+    // FOR TESTING PURPOSES ONLY
+
+    void verifyState() const;
+        // Verify that this catalog is in a consistent state.  This function is
+        // introduced for testing purposes only.
+};
+
+                   // ====================================
+                   // class ReadOptimizedObjectCatalogIter
+                   // ====================================
+
+template <class TYPE>
+class ReadOptimizedObjectCatalogIter {
+    // Provide thread safe iteration through all the objects of a
+    // 'ReadOptimizedObjectCatalog' of parameterized 'TYPE'.  The order of the
+    // iteration is implementation defined.  An iterator is *valid* if it is
+    // associated with an object in the catalog, otherwise it is *invalid*.
+    // The modification lock of the catalog is held for the lifetime of the
+    // iterator, so that the catalog cannot be modified while it is iterated
+    // (lookups may nevertheless proceed concurrently).
+
+    // DATA
+    const ReadOptimizedObjectCatalog<TYPE> *d_catalog_p;
+    int                                     d_index;
+
+    // NOT IMPLEMENTED
+    ReadOptimizedObjectCatalogIter(const ReadOptimizedObjectCatalogIter&)
+                                                          BSLS_KEYWORD_DELETED;
+    ReadOptimizedObjectCatalogIter& operator=(
+                                        const ReadOptimizedObjectCatalogIter&)
+                                                          BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+    explicit ReadOptimizedObjectCatalogIter(
+                             const ReadOptimizedObjectCatalog<TYPE>& catalog);
+        // Create an iterator for the specified 'catalog' and associate it with
+        // the first member of the 'catalog'.  If the 'catalog' is empty then
+        // the iterator is initialized to be invalid.  The modification lock of
+        // 'catalog' is held for the duration of iterator's life.
+
+    ~ReadOptimizedObjectCatalogIter();
+        // Destroy this iterator and release the modification lock of the
+        // catalog associated with it.
+
+    // MANIPULATORS
+    void operator++();
+        // Advance this iterator to refer to the next object of the associated
+        // catalog; if there is no next object in the associated catalog, then
+        // this iterator becomes *invalid*.  The behavior is undefined unless
+        // this iterator is valid.
+
+    // ACCESSORS
+    operator const void *() const;
+        // Return non-zero if the iterator is *valid*, and 0 otherwise.
+
+    bsl::pair<int, TYPE> operator()() const;
+        // Return a pair containing the handle (as the first element of the
+        // pair) and the object (as the second element of the pair) associated
+        // with this iterator.  The behavior is undefined unless the iterator
+        // is *valid*.
+
+    int handle() const;
+        // Return the handle referred to by the iterator.  The behavior is
+        // undefined unless the iterator is *valid*.
+
+    const TYPE& value() const;
+        // Return a 'const' reference to the value referred to by the iterator.
+        // The behavior is undefined unless the iterator is *valid*.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // class ReadOptimizedObjectCatalog
+                     // --------------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+inline
+int ReadOptimizedObjectCatalog<TYPE>::segmentIndex(int *offset, int index)
+{
+    BSLS_ASSERT(offset);
+    BSLS_ASSERT(0 <= index);
+
+    const bsl::uint32_t block = (static_cast<bsl::uint32_t>(index)
+                                                 >> k_FIRST_SEGMENT_BITS) + 1;
+    const int           seg   = 31 - bdlb::BitUtil::numLeadingUnsetBits(block);
+
+    *offset = index - (((1 << seg) - 1) << k_FIRST_SEGMENT_BITS);
+    return seg;
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+typename ReadOptimizedObjectCatalog<TYPE>::Node *
+ReadOptimizedObjectCatalog<TYPE>::acquireNode()
+{
+    if (d_nextFreeNode_p) {
+        Node *node       = d_nextFreeNode_p;
+        d_nextFreeNode_p = node->d_nextFree_p;
+        return node;                                                  // RETURN
+    }
+
+    // If the number of slots grows as big as the flags used to indicate BUSY
+    // and generations, then the handle will be all mixed up!
+
+    const int index = d_numSlots.loadRelaxed();
+
+    BSLS_REVIEW_OPT(index < static_cast<int>(k_BUSY_INDICATOR));
+
+    int       offset;
+    const int seg = segmentIndex(&offset, index);
+
+    if (0 == offset) {
+        const int size = 1 << (k_FIRST_SEGMENT_BITS + seg);
+
+        Node *segment = static_cast<Node *>(
+                                 d_allocator_p->allocate(size * sizeof(Node)));
+        for (int i = 0; i < size; ++i) {
+            new (&segment[i]) Node();
+            segment[i].d_handle.storeRelaxed(index + i);
+            segment[i].d_nextFree_p = 0;
+        }
+
+        // Lookups load the segment with acquire semantics, and therefore
+        // observe the initialized slots.
+
+        d_segments[seg].storeRelease(segment);
+    }
+
+    d_numSlots.storeRelease(index + 1);
+
+    return d_segments[seg].loadRelaxed() + offset;
+}
+
+template <class TYPE>
+void ReadOptimizedObjectCatalog<TYPE>::freeNode(Node *node)
+{
+    BSLS_ASSERT(node->d_handle.loadRelaxed() & k_BUSY_INDICATOR);
+
+    // Unpublish the object before retiring it, so that lookups starting after
+    // the retirement cannot reach it.
+
+    int handle = node->d_handle.loadRelaxed();
+    handle += k_GENERATION_INC;
+    handle &= ~k_BUSY_INDICATOR;
+    node->d_handle.storeRelease(handle);
+
+    TYPE *value = node->d_value_p.swap(0);
+    d_reclaimer.retireObject(value, d_allocator_p);
+
+    node->d_nextFree_p = d_nextFreeNode_p;
+    d_nextFreeNode_p   = node;
+
+    --d_length;
+}
+
+template <class TYPE>
+int ReadOptimizedObjectCatalog<TYPE>::publish(Node *node, TYPE *value)
+{
+    // Publish the value before the handle, so that a lookup validating the
+    // new handle observes the value.
+
+    node->d_value_p.storeRelease(value);
+
+    const int handle = node->d_handle.loadRelaxed() | k_BUSY_INDICATOR;
+    node->d_handle.storeRelease(handle);
+
+    ++d_length;
+    return handle;
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+typename ReadOptimizedObjectCatalog<TYPE>::Node *
+ReadOptimizedObjectCatalog<TYPE>::nodeAt(int index) const
+{
+    int       offset;
+    const int seg     = segmentIndex(&offset, index);
+    Node     *segment = d_segments[seg].loadAcquire();
+
+    return segment ? segment + offset : 0;
+}
+
+template <class TYPE>
+inline
+typename ReadOptimizedObjectCatalog<TYPE>::Node *
+ReadOptimizedObjectCatalog<TYPE>::findNode(int handle) const
+{
+    const int index = handle & k_INDEX_MASK;
+
+    if (!(handle & k_BUSY_INDICATOR)) {
+        return 0;                                                     // RETURN
+    }
+
+    Node *node = nodeAt(index);
+
+    return node && node->d_handle.loadAcquire() == handle ? node : 0;
+}
+
+// CREATORS
+template <class TYPE>
+ReadOptimizedObjectCatalog<TYPE>::ReadOptimizedObjectCatalog(
+                                              bslma::Allocator *basicAllocator)
+: d_numSlots(0)
+, d_nextFreeNode_p(0)
+, d_length(0)
+, d_reclaimer(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE>
+ReadOptimizedObjectCatalog<TYPE>::~ReadOptimizedObjectCatalog()
+{
+    removeAll();
+
+    for (int seg = 0; seg < k_NUM_SEGMENTS; ++seg) {
+        Node *segment = d_segments[seg].loadRelaxed();
+        if (segment) {
+            d_allocator_p->deallocate(segment);
+        }
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+int ReadOptimizedObjectCatalog<TYPE>::add(const TYPE& object)
+{
+    TYPE *value = static_cast<TYPE *>(d_allocator_p->allocate(sizeof(TYPE)));
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(value, d_allocator_p);
+
+    // We need to use the copyConstruct logic to pass the allocator through.
+
+    bslalg::ScalarPrimitives::copyConstruct(value, object, d_allocator_p);
+    proctor.release();
+
+    bslma::RawDeleterProctor<TYPE, bslma::Allocator> deleter(value,
+                                                             d_allocator_p);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    const int handle = publish(acquireNode(), value);
+    deleter.release();
+
+    return handle;
+}
+
+template <class TYPE>
+int ReadOptimizedObjectCatalog<TYPE>::add(bslmf::MovableRef<TYPE> object)
+{
+    TYPE& local = object;
+
+    TYPE *value = static_cast<TYPE *>(d_allocator_p->allocate(sizeof(TYPE)));
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(value, d_allocator_p);
+
+    // We need to use the moveConstruct logic to pass the allocator through.
+
+    bslalg::ScalarPrimitives::moveConstruct(value, local, d_allocator_p);
+    proctor.release();
+
+    bslma::RawDeleterProctor<TYPE, bslma::Allocator> deleter(value,
+                                                             d_allocator_p);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    const int handle = publish(acquireNode(), value);
+    deleter.release();
+
+    return handle;
+}
+
+template <class TYPE>
+int ReadOptimizedObjectCatalog<TYPE>::remove(int handle, TYPE *valueBuffer)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    Node *node = findNode(handle);
+
+    if (!node) {
+        return -1;                                                    // RETURN
+    }
+
+    if (valueBuffer) {
+        *valueBuffer = *node->d_value_p.loadRelaxed();
+    }
+
+    freeNode(node);
+
+    return 0;
+}
+
+template <class TYPE>
+void ReadOptimizedObjectCatalog<TYPE>::removeAll(bsl::vector<TYPE> *buffer)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    const int numSlots = d_numSlots.loadRelaxed();
+    for (int i = 0; i < numSlots; ++i) {
+        Node *node = nodeAt(i);
+
+        if (node->d_handle.loadRelaxed() & k_BUSY_INDICATOR) {
+            if (buffer) {
+                buffer->push_back(*node->d_value_p.loadRelaxed());
+            }
+            freeNode(node);
+        }
+    }
+}
+
+template <class TYPE>
+int ReadOptimizedObjectCatalog<TYPE>::replace(int         handle,
+                                              const TYPE& newObject)
+{
+    TYPE *value = static_cast<TYPE *>(d_allocator_p->allocate(sizeof(TYPE)));
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(value, d_allocator_p);
+
+    // We need to use the copyConstruct logic to pass the allocator through.
+
+    bslalg::ScalarPrimitives::copyConstruct(value, newObject, d_allocator_p);
+    proctor.release();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    Node *node = findNode(handle);
+
+    if (!node) {
+        d_allocator_p->deleteObject(value);
+        return -1;                                                    // RETURN
+    }
+
+    d_reclaimer.retireObject(node->d_value_p.swap(value), d_allocator_p);
+
+    return 0;
+}
+
+template <class TYPE>
+int ReadOptimizedObjectCatalog<TYPE>::replace(
+                                             int                     handle,
+                                             bslmf::MovableRef<TYPE> newObject)
+{
+    TYPE& local = newObject;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    Node *node = findNode(handle);
+
+    if (!node) {
+        return -1;                                                    // RETURN
+    }
+
+    TYPE *value = static_cast<TYPE *>(d_allocator_p->allocate(sizeof(TYPE)));
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(value, d_allocator_p);
+
+    // We need to use the moveConstruct logic to pass the allocator through.
+
+    bslalg::ScalarPrimitives::moveConstruct(value, local, d_allocator_p);
+    proctor.release();
+
+    d_reclaimer.retireObject(node->d_value_p.swap(value), d_allocator_p);
+
+    return 0;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bslma::Allocator *ReadOptimizedObjectCatalog<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class TYPE>
+inline
+int ReadOptimizedObjectCatalog<TYPE>::find(int handle) const
+{
+    return 0 == findNode(handle) ? -1 : 0;
+}
+
+template <class TYPE>
+int ReadOptimizedObjectCatalog<TYPE>::find(int handle, TYPE *valueBuffer) const
+{
+    EpochReclaimerGuard guard(&d_reclaimer);
+
+    Node *node = findNode(handle);
+
+    if (!node) {
+        return -1;                                                    // RETURN
+    }
+
+    const TYPE *value = node->d_value_p.loadAcquire();
+
+    // The slot may have been freed and reused after 'findNode' validated the
+    // handle, in which case 'value' belongs to another object.  Validate the
+    // handle again; 'value' itself remains accessible until 'guard' is
+    // destroyed.
+
+    if (!value || node->d_handle.loadAcquire() != handle) {
+        return -1;                                                    // RETURN
+    }
+
+    *valueBuffer = *value;
+
+    return 0;
+}
+
+template <class TYPE>
+bool ReadOptimizedObjectCatalog<TYPE>::isMember(const TYPE& object) const
+{
+    EpochReclaimerGuard guard(&d_reclaimer);
+
+    const int numSlots = d_numSlots.loadAcquire();
+    for (int i = 0; i < numSlots; ++i) {
+        const Node *node = nodeAt(i);
+
+        if (node->d_handle.loadAcquire() & k_BUSY_INDICATOR) {
+            const TYPE *value = node->d_value_p.loadAcquire();
+
+            if (value && *value == object) {
+                return true;                                          // RETURN
+            }
+        }
+    }
+
+    return false;
+}
+
+template <class TYPE>
+inline
+int ReadOptimizedObjectCatalog<TYPE>::length() const
+{
+    return d_length;
+}
+
+template <class TYPE>
+inline
+const TYPE& ReadOptimizedObjectCatalog<TYPE>::value(int handle) const
+{
+    Node *node = findNode(handle);
+
+    BSLS_ASSERT(node);
+
+    return *node->d_value_p.loadAcquire();
+}
+
+template <class TYPE>
+void ReadOptimizedObjectCatalog<TYPE>::verifyState() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    const int numSlots = d_numSlots.loadRelaxed();
+
+    BSLS_ASSERT(0        <= d_length);
+    BSLS_ASSERT(numSlots >= d_length);
+
+    int numBusy = 0, numFree = 0;
+    for (int i = 0; i < numSlots; ++i) {
+        const Node *node = nodeAt(i);
+
+        BSLS_ASSERT(node);
+
+        const int handle = node->d_handle.loadRelaxed();
+
+        BSLS_ASSERT((handle & static_cast<int>(k_INDEX_MASK)) == i);
+
+        if (handle & k_BUSY_INDICATOR) {
+            BSLS_ASSERT(node->d_value_p.loadRelaxed());
+            ++numBusy;
+        }
+        else {
+            BSLS_ASSERT(!node->d_value_p.loadRelaxed());
+            ++numFree;
+        }
+    }
+    BSLS_ASSERT(numBusy           == d_length);
+    BSLS_ASSERT(numFree + numBusy == numSlots);
+
+    for (const Node *p = d_nextFreeNode_p; p; p = p->d_nextFree_p) {
+        BSLS_ASSERT(!(p->d_handle.loadRelaxed() & k_BUSY_INDICATOR));
+        --numFree;
+    }
+    BSLS_ASSERT(0 == numFree);
+}
+
+                   // ------------------------------------
+                   // class ReadOptimizedObjectCatalogIter
+                   // ------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+ReadOptimizedObjectCatalogIter<TYPE>::ReadOptimizedObjectCatalogIter(
+                               const ReadOptimizedObjectCatalog<TYPE>& catalog)
+: d_catalog_p(&catalog)
+, d_index(-1)
+{
+    d_catalog_p->d_lock.lock();
+    operator++();
+}
+
+template <class TYPE>
+inline
+ReadOptimizedObjectCatalogIter<TYPE>::~ReadOptimizedObjectCatalogIter()
+{
+    d_catalog_p->d_lock.unlock();
+}
+
+// MANIPULATORS
+template <class TYPE>
+void ReadOptimizedObjectCatalogIter<TYPE>::operator++()
+{
+    typedef ReadOptimizedObjectCatalog<TYPE> Catalog;
+
+    const int numSlots = d_catalog_p->d_numSlots.loadRelaxed();
+
+    ++d_index;
+    while (d_index < numSlots
+        && !(d_catalog_p->nodeAt(d_index)->d_handle.loadRelaxed()
+                                                & Catalog::k_BUSY_INDICATOR)) {
+        ++d_index;
+    }
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+ReadOptimizedObjectCatalogIter<TYPE>::operator const void *() const
+{
+    return d_index < d_catalog_p->d_numSlots.loadRelaxed() ? this : 0;
+}
+
+template <class TYPE>
+inline
+bsl::pair<int, TYPE> ReadOptimizedObjectCatalogIter<TYPE>::operator()() const
+{
+    return bsl::pair<int, TYPE>(handle(), value());
+}
+
+template <class TYPE>
+inline
+int ReadOptimizedObjectCatalogIter<TYPE>::handle() const
+{
+    BSLS_ASSERT(d_index < d_catalog_p->d_numSlots.loadRelaxed());
+
+    return d_catalog_p->nodeAt(d_index)->d_handle.loadRelaxed();
+}
+
+template <class TYPE>
+inline
+const TYPE& ReadOptimizedObjectCatalogIter<TYPE>::value() const
+{
+    BSLS_ASSERT(d_index < d_catalog_p->d_numSlots.loadRelaxed());
+
+    return *d_catalog_p->nodeAt(d_index)->d_value_p.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,989 @@
+// bdlcc_readoptimizedobjectcatalog.t.cpp                             -*-C++-*-
+
+#include <bdlcc_readoptimizedobjectcatalog.h>
+
+#include <bdlcc_objectcatalog.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides an indexed object catalog with lock-free
+// lookups.  The basic operations are first verified with a single thread,
+// using 'verifyState' and a test allocator to check the consistency of the
+// catalog and that removed objects are eventually released.  Handles of
+// removed objects must be rejected even after their slots are reused, and the
+// catalog must grow across several slot segments.  Finally, concurrent
+// lookups are run against concurrent modifications.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ReadOptimizedObjectCatalog(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~ReadOptimizedObjectCatalog();
+//
+// MANIPULATORS
+// [ 2] int add(const TYPE& object);
+// [ 3] int add(bslmf::MovableRef<TYPE> object);
+// [ 2] int remove(int handle, TYPE *valueBuffer = 0);
+// [ 3] void removeAll(bsl::vector<TYPE> *buffer = 0);
+// [ 3] int replace(int handle, const TYPE& newObject);
+// [ 3] int replace(int handle, bslmf::MovableRef<TYPE> newObject);
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] int find(int handle) const;
+// [ 2] int find(int handle, TYPE *valueBuffer) const;
+// [ 4] bool isMember(const TYPE& object) const;
+// [ 2] int length() const;
+// [ 2] const TYPE& value(int handle) const;
+// [ 2] void verifyState() const;
+//
+// ReadOptimizedObjectCatalogIter
+// [ 4] ReadOptimizedObjectCatalogIter(const Catalog& catalog);
+// [ 4] ~ReadOptimizedObjectCatalogIter();
+// [ 4] void operator++();
+// [ 4] operator const void *() const;
+// [ 4] bsl::pair<int, TYPE> operator()() const;
+// [ 4] int handle() const;
+// [ 4] const TYPE& value() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 5] CONCERN: growth of the slot array and reuse of slots
+// [ 6] CONCERN: concurrent lookups and modifications
+// [-1] PERFORMANCE: ReadOptimizedObjectCatalog vs ObjectCatalog
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::ReadOptimizedObjectCatalog<bsl::string>     Obj;
+typedef bdlcc::ReadOptimizedObjectCatalogIter<bsl::string> Iter;
+
+static const char LONG_STRING[] = "a string too long for the small buffer";
+
+// ============================================================================
+//                   GLOBAL STRUCTS/FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bsl::string makeValue(int n)
+    // Return a string of 'n % 50 + 20' copies of the character 'A + n % 26'.
+    // Note that a string returned by this function can be checked for
+    // consistency by 'isValidValue'.
+{
+    return bsl::string(n % 50 + 20, static_cast<char>('A' + n % 26));
+}
+
+bool isValidValue(const bsl::string& value)
+    // Return 'true' if the specified 'value' is consistent with a string
+    // returned by 'makeValue', and 'false' otherwise.
+{
+    if (value.length() < 20) {
+        return false;                                                 // RETURN
+    }
+    for (bsl::size_t i = 1; i < value.length(); ++i) {
+        if (value[i] != value[0]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                          // ===================
+                          // class StressTestJob
+                          // ===================
+
+class StressTestJob {
+    // This class implements a job run by each thread of the concurrency test.
+    // Reader threads look up a set of stable handles whose values are
+    // continually replaced, and writer threads add, look up, replace and
+    // remove their own objects, causing slots to be reused and the slot array
+    // to grow.
+
+    // DATA
+    Obj              *d_catalog_p;
+    const int        *d_handles_p;
+    int               d_numHandles;
+    bslmt::Barrier   *d_barrier_p;
+    int               d_threadIndex;
+    bool              d_isWriter;
+    int               d_numIterations;
+
+  public:
+    // CREATORS
+    StressTestJob(Obj            *catalog,
+                  const int      *handles,
+                  int             numHandles,
+                  bslmt::Barrier *barrier,
+                  int             threadIndex,
+                  bool            isWriter,
+                  int             numIterations)
+        // Create a job operating on the specified 'catalog' holding the
+        // specified 'numHandles' stable 'handles', synchronizing on the
+        // specified 'barrier', for the thread with the specified
+        // 'threadIndex', acting as a writer if the specified 'isWriter' is
+        // 'true', and running the specified 'numIterations'.
+    : d_catalog_p(catalog)
+    , d_handles_p(handles)
+    , d_numHandles(numHandles)
+    , d_barrier_p(barrier)
+    , d_threadIndex(threadIndex)
+    , d_isWriter(isWriter)
+    , d_numIterations(numIterations)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()()
+        // Run this job.
+    {
+        d_barrier_p->wait();
+
+        bsl::string value;
+        for (int i = 0; i < d_numIterations; ++i) {
+            const int stable = d_handles_p[(i + d_threadIndex) % d_numHandles];
+
+            if (d_isWriter) {
+                const int n = i * 7 + d_threadIndex;
+
+                ASSERTV(d_threadIndex, i,
+                        0 == d_catalog_p->replace(stable, makeValue(n)));
+
+                int handles[4];
+                for (int j = 0; j < 4; ++j) {
+                    handles[j] = d_catalog_p->add(makeValue(n + j));
+                }
+                for (int j = 0; j < 4; ++j) {
+                    ASSERTV(d_threadIndex, i, j,
+                            0 == d_catalog_p->find(handles[j], &value));
+                    ASSERTV(d_threadIndex, i, j, makeValue(n + j) == value);
+                }
+                for (int j = 0; j < 4; ++j) {
+                    ASSERTV(d_threadIndex, i, j,
+                            0 == d_catalog_p->remove(handles[j]));
+                    ASSERTV(d_threadIndex, i, j,
+                            0 != d_catalog_p->find(handles[j], &value));
+                }
+            }
+            else {
+                ASSERTV(d_threadIndex, i,
+                        0 == d_catalog_p->find(stable, &value));
+                ASSERTV(d_threadIndex, i, value, isValidValue(value));
+
+                if (0 == i % 64) {
+                    ASSERTV(d_threadIndex, i,
+                            !d_catalog_p->isMember(bsl::string("none")));
+                }
+            }
+        }
+    }
+};
+
+// ============================================================================
+//                          PERFORMANCE TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace perf {
+
+enum { k_MAX_THREADS = 256, k_STRIDE = 16 };
+
+template <class CATALOG>
+class Benchmark {
+    // This class provides the run functions used to compare the lookup
+    // throughput of a catalog type 'CATALOG'.
+
+    // DATA
+    CATALOG           d_catalog;
+    bsl::vector<int>  d_handles;
+    bsl::vector<int>  d_state;      // per-thread index sequence, padded
+
+  public:
+    // CREATORS
+    Benchmark(int numHandles, bslma::Allocator *basicAllocator)
+        // Create a benchmark on a catalog populated with the specified
+        // 'numHandles' objects, using the specified 'basicAllocator' to supply
+        // memory.
+    : d_catalog(basicAllocator)
+    , d_handles(basicAllocator)
+    , d_state(2 * k_MAX_THREADS * k_STRIDE, 0, basicAllocator)
+    {
+        for (int i = 0; i < numHandles; ++i) {
+            d_handles.push_back(d_catalog.add(i));
+        }
+    }
+
+    // MANIPULATORS
+    void read(int threadIndex)
+        // Look up an object of the catalog, using the specified 'threadIndex'
+        // to select the handle sequence.
+    {
+        int& state = d_state[threadIndex * k_STRIDE];
+        state = (state + 7919) % static_cast<int>(d_handles.size());
+
+        int value;
+        d_catalog.find(d_handles[state], &value);
+    }
+
+    void write(int threadIndex)
+        // Replace an object of the catalog, using the specified 'threadIndex'
+        // to select the handle sequence.
+    {
+        int& state = d_state[(k_MAX_THREADS + threadIndex) * k_STRIDE];
+        state = (state + 104729) % static_cast<int>(d_handles.size());
+
+        d_catalog.replace(d_handles[state], threadIndex);
+    }
+};
+
+template <class CATALOG>
+void runBenchmark(const char *name,
+                  int         numReaders,
+                  int         numWriters,
+                  int         numHandles,
+                  int         numMillis,
+                  int         numSamples)
+    // Print, tagged with the specified 'name', the median throughput of
+    // 'numReaders' reader threads and 'numWriters' writer threads accessing a
+    // catalog of type 'CATALOG' holding the specified 'numHandles' objects,
+    // running the specified 'numSamples' samples of 'numMillis' milliseconds.
+{
+    bslma::NewDeleteAllocator        nalloc;
+    Benchmark<CATALOG>               bench(numHandles, &nalloc);
+    bslmt::ThroughputBenchmark       tb(&nalloc);
+    bslmt::ThroughputBenchmarkResult result(&nalloc);
+
+    const int readerGroup = tb.addThreadGroup(
+                      bdlf::BindUtil::bind(&Benchmark<CATALOG>::read,
+                                           &bench,
+                                           bdlf::PlaceHolders::_1),
+                      numReaders,
+                      0);
+    int writerGroup = -1;
+    if (numWriters) {
+        writerGroup = tb.addThreadGroup(
+                      bdlf::BindUtil::bind(&Benchmark<CATALOG>::write,
+                                           &bench,
+                                           bdlf::PlaceHolders::_1),
+                      numWriters,
+                      0);
+    }
+
+    tb.execute(&result, numMillis, numSamples);
+
+    double readMedian  = 0;
+    double writeMedian = 0;
+    result.getMedian(&readMedian, readerGroup);
+    if (writerGroup >= 0) {
+        result.getMedian(&writeMedian, writerGroup);
+    }
+
+    bsl::cout << name << "," << numReaders << "," << numWriters << ","
+              << bsl::fixed << bsl::setprecision(0) << readMedian << ","
+              << writeMedian << "\n";
+}
+
+}  // close namespace perf
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Session Table
+/// - - - - - - - - - - - -
+// Suppose that a server keeps a table of client sessions that is consulted,
+// using an opaque handle, on every I/O event, and modified only when sessions
+// are opened or closed.
+//
+// First, we create a catalog of session names:
+//..
+    bdlcc::ReadOptimizedObjectCatalog<bsl::string> sessions;
+//..
+// Then, we open two sessions, and give the resulting handles to the I/O
+// layer:
+//..
+    int handleA = sessions.add("alpha");
+    int handleB = sessions.add("beta");
+    ASSERT(2 == sessions.length());
+//..
+// Next, on each I/O event, we look up the session by handle.  This lookup
+// does not take a lock and may proceed concurrently on any number of threads:
+//..
+    bsl::string name;
+    ASSERT(0       == sessions.find(handleA, &name));
+    ASSERT("alpha" == name);
+    ASSERT(sessions.isMember("beta"));
+//..
+// Finally, we close a session.  Subsequent lookups using its handle fail,
+// even once its slot is reused by a new session:
+//..
+    ASSERT(0 == sessions.remove(handleB));
+    int handleC = sessions.add("gamma");
+
+    ASSERT(0       != sessions.find(handleB));
+    ASSERT(0       == sessions.find(handleC, &name));
+    ASSERT("gamma" == name);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT LOOKUPS AND MODIFICATIONS
+        //
+        // Concerns:
+        //: 1 A lookup concurrent with replacement of the object returns either
+        //:   the previous or the new value, never a partially destroyed one.
+        //:
+        //: 2 Handles returned by 'add' are immediately usable, and handles of
+        //:   removed objects are rejected, while other threads modify the
+        //:   catalog.
+        //:
+        //: 3 All memory is released once the catalog is destroyed.
+        //
+        // Plan:
+        //: 1 Populate a catalog with stable handles.  Run reader threads
+        //:   looking up the stable handles and checking the consistency of the
+        //:   values, concurrently with writer threads replacing the values of
+        //:   the stable handles, and adding, looking up, and removing their
+        //:   own objects.  (C-1..2)
+        //:
+        //: 2 Verify the state of the catalog and of the allocator.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: concurrent lookups and modifications
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT LOOKUPS AND MODIFICATIONS" << endl
+                          << "====================================" << endl;
+
+        enum {
+            k_NUM_READERS    = 6,
+            k_NUM_WRITERS    = 2,
+            k_NUM_HANDLES    = 16,
+            k_NUM_ITERATIONS = 20000
+        };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            int handles[k_NUM_HANDLES];
+            for (int i = 0; i < k_NUM_HANDLES; ++i) {
+                handles[i] = mX.add(makeValue(i));
+            }
+
+            bslmt::Barrier     barrier(k_NUM_READERS + k_NUM_WRITERS);
+            bslmt::ThreadGroup threads(&oa);
+            for (int i = 0; i < k_NUM_READERS + k_NUM_WRITERS; ++i) {
+                threads.addThread(StressTestJob(&mX,
+                                                handles,
+                                                k_NUM_HANDLES,
+                                                &barrier,
+                                                i,
+                                                i < k_NUM_WRITERS,
+                                                k_NUM_ITERATIONS));
+            }
+            threads.joinAll();
+
+            ASSERTV(X.length(), k_NUM_HANDLES == X.length());
+            X.verifyState();
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // GROWTH AND SLOT REUSE
+        //
+        // Concerns:
+        //: 1 The catalog grows across several slot segments, and all handles
+        //:   remain valid.
+        //:
+        //: 2 A removed slot is reused, and the handle of the removed object is
+        //:   rejected after the reuse.
+        //:
+        //: 3 'removeAll' makes all slots available for reuse without releasing
+        //:   them.
+        //
+        // Plan:
+        //: 1 Add many objects and verify each handle.  (C-1)
+        //:
+        //: 2 Remove and re-add objects; verify that the new handles have the
+        //:   same slot index as the removed ones, and that the old handles are
+        //:   rejected.  (C-2)
+        //:
+        //: 3 Call 'removeAll', then add objects and verify that no additional
+        //:   memory is allocated for slots.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: growth of the slot array and reuse of slots
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GROWTH AND SLOT REUSE" << endl
+                          << "=====================" << endl;
+
+        enum { k_NUM_OBJECTS = 10000, k_INDEX_MASK = 0x007fffff };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            bdlcc::ReadOptimizedObjectCatalog<int> mX(&oa);
+            const bdlcc::ReadOptimizedObjectCatalog<int>& X = mX;
+
+            bsl::vector<int> handles;
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                handles.push_back(mX.add(i));
+            }
+            ASSERTV(X.length(), k_NUM_OBJECTS == X.length());
+            X.verifyState();
+
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                int value = -1;
+                ASSERTV(i, 0 == X.find(handles[i], &value));
+                ASSERTV(i, i == value);
+                ASSERTV(i, i == (handles[i] & k_INDEX_MASK));
+            }
+
+            for (int i = 0; i < k_NUM_OBJECTS; i += 97) {
+                const int oldHandle = handles[i];
+
+                ASSERTV(i, 0 == mX.remove(oldHandle));
+
+                const int newHandle = mX.add(-i);
+
+                ASSERTV(i, oldHandle != newHandle);
+                ASSERTV(i, (oldHandle & k_INDEX_MASK) ==
+                                                 (newHandle & k_INDEX_MASK));
+                ASSERTV(i, 0 != X.find(oldHandle));
+                ASSERTV(i, 0 == X.find(newHandle));
+                ASSERTV(i, -i == X.value(newHandle));
+            }
+            X.verifyState();
+
+            mX.removeAll();
+            ASSERTV(X.length(), 0 == X.length());
+            X.verifyState();
+
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                ASSERTV(i, 0 != X.find(handles[i]));
+            }
+
+            const bsls::Types::Int64 numBlocks = oa.numBlocksInUse();
+            for (int i = 0; i < 100; ++i) {
+                mX.add(i);
+            }
+            ASSERTV(numBlocks, oa.numBlocksInUse(),
+                    numBlocks + 100 >= oa.numBlocksInUse());
+            X.verifyState();
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ITERATION AND 'isMember'
+        //
+        // Concerns:
+        //: 1 The iterator visits each object exactly once, and reports its
+        //:   handle and value.
+        //:
+        //: 2 An iterator over an empty catalog is invalid.
+        //:
+        //: 3 'isMember' reports whether an equal object is in the catalog.
+        //
+        // Plan:
+        //: 1 Add objects, remove some, and iterate; verify the handles and
+        //:   values visited.  (C-1..2)
+        //:
+        //: 2 Verify 'isMember' for present and absent objects.  (C-3)
+        //
+        // Testing:
+        //   ReadOptimizedObjectCatalogIter(const Catalog& catalog);
+        //   ~ReadOptimizedObjectCatalogIter();
+        //   void operator++();
+        //   operator const void *() const;
+        //   bsl::pair<int, TYPE> operator()() const;
+        //   int handle() const;
+        //   const TYPE& value() const;
+        //   bool isMember(const TYPE& object) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATION AND 'isMember'" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            {
+                Iter it(X);
+                ASSERT(!it);
+            }
+            ASSERT(false == X.isMember("A"));
+
+            int handles[10];
+            for (int i = 0; i < 10; ++i) {
+                const bsl::string s(1, static_cast<char>('A' + i));
+                handles[i] = mX.add(s);
+            }
+            for (int i = 0; i < 10; i += 3) {
+                ASSERTV(i, 0 == mX.remove(handles[i]));
+            }
+
+            int numVisited = 0;
+            for (Iter it(X); it; ++it) {
+                const bsl::pair<int, bsl::string> p = it();
+                const int i = p.second[0] - 'A';
+
+                ASSERTV(i, 0 <= i && i < 10);
+                ASSERTV(i, 0 != i % 3);
+                ASSERTV(i, handles[i] == p.first);
+                ASSERTV(i, handles[i] == it.handle());
+                ASSERTV(i, p.second   == it.value());
+                ++numVisited;
+            }
+            ASSERTV(numVisited, 6 == numVisited);
+
+            for (int i = 0; i < 10; ++i) {
+                const bsl::string s(1, static_cast<char>('A' + i));
+                ASSERTV(i, (0 != i % 3) == X.isMember(s));
+            }
+            ASSERT(false == X.isMember("Z"));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'replace', 'removeAll', AND MOVE OVERLOADS
+        //
+        // Concerns:
+        //: 1 'replace' changes the value of an existing object, leaves the
+        //:   handle valid, and fails for an invalid handle.
+        //:
+        //: 2 The 'MovableRef' overloads of 'add' and 'replace' store the
+        //:   value.
+        //:
+        //: 3 'remove' optionally loads the removed value.
+        //:
+        //: 4 'removeAll' removes all objects, and optionally loads them.
+        //:
+        //: 5 Replaced and removed objects are eventually released.
+        //
+        // Plan:
+        //: 1 Exercise each method and verify the results with 'find', and the
+        //:   absence of leaks with a test allocator.  (C-1..5)
+        //
+        // Testing:
+        //   int add(bslmf::MovableRef<TYPE> object);
+        //   void removeAll(bsl::vector<TYPE> *buffer = 0);
+        //   int replace(int handle, const TYPE& newObject);
+        //   int replace(int handle, bslmf::MovableRef<TYPE> newObject);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'replace', 'removeAll', AND MOVE OVERLOADS"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bsl::string value(&sa);
+
+            const int h1 = mX.add(LONG_STRING);
+            bsl::string moved(LONG_STRING, &sa);
+            const int h2 = mX.add(bslmf::MovableRefUtil::move(moved));
+
+            ASSERT(0 == X.find(h2, &value));
+            ASSERT(LONG_STRING == value);
+
+            ASSERT(0 == mX.replace(h1, "one"));
+            ASSERT(0 == X.find(h1, &value));
+            ASSERT("one" == value);
+
+            bsl::string two("two", &sa);
+            ASSERT(0 == mX.replace(h2, bslmf::MovableRefUtil::move(two)));
+            ASSERT(0 == X.find(h2, &value));
+            ASSERT("two" == value);
+
+            ASSERT(0 != mX.replace(h1 ^ 0x01000000, "bad"));
+            bsl::string bad("bad", &sa);
+            ASSERT(0 != mX.replace(h1 ^ 0x01000000,
+                                   bslmf::MovableRefUtil::move(bad)));
+            ASSERT("bad" == bad);
+            ASSERT(2 == X.length());
+
+            ASSERT(0 == mX.remove(h1, &value));
+            ASSERT("one" == value);
+            ASSERT(0 != mX.remove(h1, &value));
+            ASSERT(1 == X.length());
+
+            for (int i = 0; i < 5; ++i) {
+                mX.add(makeValue(i));
+            }
+
+            bsl::vector<bsl::string> buffer(&sa);
+            mX.removeAll(&buffer);
+            ASSERTV(buffer.size(), 6 == buffer.size());
+            ASSERT(0 == X.length());
+            ASSERT(0 != X.find(h2));
+            X.verifyState();
+
+            for (int i = 0; i < 1000; ++i) {
+                const int h = mX.add(makeValue(i));
+                ASSERTV(i, 0 == mX.replace(h, makeValue(i + 1)));
+                ASSERTV(i, 0 == mX.remove(h));
+            }
+            X.verifyState();
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The catalog uses the supplied allocator, or the default allocator
+        //:   if none is supplied.
+        //:
+        //: 2 'add' returns distinct non-zero handles, by which the objects can
+        //:   be found.
+        //:
+        //: 3 'remove' invalidates the handle, and fails for an invalid handle.
+        //:
+        //: 4 'find' fails for handles never returned by 'add'.
+        //:
+        //: 5 All memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Add, find, and remove objects, verifying 'length', 'value', and
+        //:   'verifyState' after each step, and the allocator on
+        //:   destruction.  (C-1..5)
+        //
+        // Testing:
+        //   ReadOptimizedObjectCatalog(bslma::Allocator *basicAllocator = 0);
+        //   ~ReadOptimizedObjectCatalog();
+        //   int add(const TYPE& object);
+        //   int remove(int handle, TYPE *valueBuffer = 0);
+        //   bslma::Allocator *allocator() const;
+        //   int find(int handle) const;
+        //   int find(int handle, TYPE *valueBuffer) const;
+        //   int length() const;
+        //   const TYPE& value(int handle) const;
+        //   void verifyState() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            mX.add(LONG_STRING);
+        }
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(0   == X.length());
+            ASSERT(0   != X.find(0));
+            ASSERT(0   != X.find(0x00800000));
+            ASSERT(0   != X.find(-1));
+            X.verifyState();
+
+            enum { k_NUM = 100 };
+            int handles[k_NUM];
+            for (int i = 0; i < k_NUM; ++i) {
+                handles[i] = mX.add(makeValue(i));
+                ASSERTV(i, 0 != handles[i]);
+                ASSERTV(i, i + 1 == X.length());
+                for (int j = 0; j < i; ++j) {
+                    ASSERTV(i, j, handles[i] != handles[j]);
+                }
+            }
+            X.verifyState();
+
+            bsl::string value;
+            for (int i = 0; i < k_NUM; ++i) {
+                ASSERTV(i, 0 == X.find(handles[i]));
+                ASSERTV(i, 0 == X.find(handles[i], &value));
+                ASSERTV(i, makeValue(i) == value);
+                ASSERTV(i, makeValue(i) == X.value(handles[i]));
+            }
+
+            for (int i = 0; i < k_NUM; i += 2) {
+                ASSERTV(i, 0 == mX.remove(handles[i]));
+                ASSERTV(i, 0 != mX.remove(handles[i]));
+                ASSERTV(i, 0 != X.find(handles[i]));
+                ASSERTV(i, 0 != X.find(handles[i], &value));
+            }
+            ASSERTV(X.length(), k_NUM / 2 == X.length());
+            X.verifyState();
+
+            for (int i = 1; i < k_NUM; i += 2) {
+                ASSERTV(i, 0 == X.find(handles[i], &value));
+                ASSERTV(i, makeValue(i) == value);
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, add, find, replace, and remove objects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const int h1 = mX.add("one");
+            const int h2 = mX.add("two");
+            ASSERT(2 == X.length());
+
+            bsl::string value;
+            ASSERT(0 == X.find(h1, &value));
+            ASSERT("one" == value);
+            ASSERT(0 == mX.replace(h2, "deux"));
+            ASSERT(0 == X.find(h2, &value));
+            ASSERT("deux" == value);
+            ASSERT(0 == mX.remove(h1));
+            ASSERT(0 != X.find(h1));
+            ASSERT(1 == X.length());
+            X.verifyState();
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ReadOptimizedObjectCatalog vs ObjectCatalog
+        //   Compare the median throughput of readers (and optionally writers)
+        //   of 'bdlcc::ReadOptimizedObjectCatalog' and 'bdlcc::ObjectCatalog'
+        //   for an increasing number of threads.  Command line parameters:
+        //   2nd parameter: maximum number of reader threads (defaults to 8).
+        //   3rd parameter: number of writer threads (defaults to 0).
+        //   4th parameter: number of objects (defaults to 10000).
+        //   5th parameter: milliseconds per sample (defaults to 1000).
+        //   6th parameter: number of samples (defaults to 5).
+        //
+        // Concerns:
+        //: 1 Lookup throughput of 'ReadOptimizedObjectCatalog' scales with
+        //:   the number of threads.
+        //
+        // Plan:
+        //: 1 Run 'bslmt::ThroughputBenchmark' on each catalog type, doubling
+        //:   the number of readers, and print the results as CSV.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: ReadOptimizedObjectCatalog vs ObjectCatalog
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: READ-OPTIMIZED VS RWMUTEX CATALOG"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        const int maxReaders = argc > 2 ? atoi(argv[2]) :     8;
+        const int numWriters = argc > 3 ? atoi(argv[3]) :     0;
+        const int numObjects = argc > 4 ? atoi(argv[4]) : 10000;
+        const int numMillis  = argc > 5 ? atoi(argv[5]) :  1000;
+        const int numSamples = argc > 6 ? atoi(argv[6]) :     5;
+
+        typedef bdlcc::ReadOptimizedObjectCatalog<int> ReadOptimizedCatalog;
+        typedef bdlcc::ObjectCatalog<int>              RWMutexCatalog;
+
+        bsl::cout << "Catalog,Readers,Writers,ReadOps/s,WriteOps/s\n";
+        for (int numReaders = 1; numReaders <= maxReaders; numReaders *= 2) {
+            perf::runBenchmark<ReadOptimizedCatalog>("ReadOptimized",
+                                                     numReaders,
+                                                     numWriters,
+                                                     numObjects,
+                                                     numMillis,
+                                                     numSamples);
+            perf::runBenchmark<RWMutexCatalog>("ObjectCatalog",
+                                               numReaders,
+                                               numWriters,
+                                               numObjects,
+                                               numMillis,
+                                               numSamples);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.  The
+    // benchmarks create threads, which may use the global allocator.
+
+    if (test >= 0) {
+        LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                    0 == globalAllocator.numBlocksTotal());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,50 @@
+// bdlcc_timingwheel.cpp                                              -*-C++-*-
+#include <bdlcc_timingwheel.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_timingwheel_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The wheel keeps a current tick, 'd_currentTick', and places each item in the
+// level corresponding to the most significant base-256 digit in which the tick
+// of the item differs from the current tick, and in the slot of that level
+// given by the digit of the item.  Items whose tick precedes the current tick
+// are placed as if their tick were the current one.  Hence:
+//
+//: o The slots of level 0 that are occupied are at or after the digit of the
+//:   current tick, and each holds the items of a single tick.
+//:
+//: o The slots of a level 'L > 0' that are occupied are strictly after the
+//:   digit of the current tick at level 'L', and each holds the items of a
+//:   range of '256**L' ticks.
+//:
+//: o Every item of a level precedes every item of a higher level.
+//
+// so that the first occupied slot, found with at most 8 scans of a bitmap of
+// 256 bits, holds the items having the lowest time values.  Advancing the
+// current tick to the first tick of that slot leaves the placement of every
+// other item valid; when the slot is of a level greater than 0, its items are
+// then re-placed, which moves each of them to a lower level.  The current tick
+// never goes past the tick of the time value supplied to 'popLE', so that
+// items added later for an earlier time are still found in the first slot.
+//
+// The lowest time value is cached, and the cache is invalidated only when an
+// item having that time value is removed, so that a client repeatedly adding
+// and cancelling timers that are not the next to expire never scans a slot.
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1320 @@
+// bdlcc_timingwheel.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLCC_TIMINGWHEEL
+#define INCLUDED_BDLCC_TIMINGWHEEL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a time event queue with constant-time add and remove.
+//
+//@CLASSES:
+//  bdlcc::TimingWheel: hierarchical timing wheel with 'TimeQueue' interface
+//
+//@SEE_ALSO: bdlcc_timequeue, bdlmt_timereventscheduler
+//
+//@DESCRIPTION: This component provides a thread-safe, templatized time event
+// queue, 'bdlcc::TimingWheel', implemented as a hashed hierarchical timing
+// wheel.  'bdlcc::TimingWheel' provides the same interface as
+// 'bdlcc::TimeQueue', and the same guarantees on the order in which items are
+// retrieved, but adds, removes, and updates items in constant time rather than
+// in time logarithmic in the number of distinct time values in the queue.  It
+// is intended for workloads such as I/O timeouts, where a large number of
+// items is added and nearly all of them are removed before they expire.
+//
+// The items are exchanged with clients by proxy of 'bdlcc::TimeQueueItem',
+// and are identified by handles and optional keys having exactly the same
+// semantics as those of 'bdlcc::TimeQueue' (see {'bdlcc_timequeue'}),
+// including the 'numIndexBits' constructor parameter limiting the number of
+// items in the queue.
+//
+///Tick Granularity
+///----------------
+// A 'bdlcc::TimingWheel' divides time into *ticks* of a duration, the *tick
+// granularity*, supplied at construction (one millisecond by default).  The
+// wheel is made of 8 levels of 256 slots each: each slot of level 'L' holds
+// the items expiring within a range of '256**L' ticks, so that an item is
+// placed in its slot with a constant number of operations regardless of how
+// far in the future it expires.  As time advances, the items of a slot of
+// level 'L > 0' are redistributed ("cascaded") into the slots of the lower
+// levels, until they reach level 0, where each slot holds the items expiring
+// within a single tick.
+//
+// The tick granularity affects only performance, not the result of any
+// operation: the time value of each item is kept exactly, and items are
+// retrieved in increasing time order and only once their time is reached,
+// exactly as by 'bdlcc::TimeQueue'.  A coarser granularity requires fewer
+// cascades to retrieve an item, and a finer granularity fewer comparisons to
+// order the items expiring within a tick.  A good granularity is usually the
+// precision with which the client needs its timers to expire.
+//
+///Comparison to 'bdlcc::TimeQueue'
+///--------------------------------
+// 'bdlcc::TimeQueue' keeps its items in a 'bsl::map' keyed by time value, so
+// that adding an item with a new time value, and removing the last item having
+// a given time value, takes time logarithmic in the number of distinct time
+// values, under the lock of the queue.  'bdlcc::TimingWheel' performs both
+// operations in constant time.  In exchange, retrieving the lowest time value
+// ('minTime', and the 'newMinTime' and 'isNewTop' optional outputs) requires
+// examining the items of the first non-empty slot, unless the lowest time
+// value is already known to the wheel, and each item is moved at most once per
+// level before it expires.
+//
+///Thread Safety
+///-------------
+// It is safe to access or modify two distinct 'bdlcc::TimingWheel' objects
+// simultaneously, each from a separate thread.  It is safe to access or modify
+// a single 'bdlcc::TimingWheel' object simultaneously from two or more
+// separate threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: I/O Timeouts
+///- - - - - - - - - - - -
+// Suppose that a server arms a read timeout for each request it sends to a
+// peer, and disarms it when the response arrives, which is almost always
+// before the timeout expires.
+//
+// First, we create a timing wheel of connection identifiers with a tick
+// granularity of 10 milliseconds, which is the precision we need for timeouts:
+//..
+//  bdlcc::TimingWheel<int> timeouts(bsls::TimeInterval(0, 10 * 1000 * 1000));
+//..
+// Then, we arm timeouts for three requests sent at time 'now':
+//..
+//  const bsls::TimeInterval now(1000, 0);
+//
+//  bdlcc::TimingWheel<int>::Handle h1 =
+//                               timeouts.add(now + bsls::TimeInterval(5), 1);
+//  bdlcc::TimingWheel<int>::Handle h2 =
+//                               timeouts.add(now + bsls::TimeInterval(5), 2);
+//  bdlcc::TimingWheel<int>::Handle h3 =
+//                               timeouts.add(now + bsls::TimeInterval(2), 3);
+//  assert(3 == timeouts.length());
+//..
+// Next, the responses to the first and third requests arrive, and we disarm
+// their timeouts:
+//..
+//  assert(0 == timeouts.remove(h1));
+//  assert(0 == timeouts.remove(h3));
+//..
+// Finally, after 6 seconds, we retrieve the expired timeouts and find that
+// only the second request timed out:
+//..
+//  bsl::vector<bdlcc::TimeQueueItem<int> > expired;
+//  timeouts.popLE(now + bsls::TimeInterval(6), &expired);
+//
+//  assert(1  == expired.size());
+//  assert(2  == expired[0].data());
+//  assert(h2 == expired[0].handle());
+//  assert(0  == timeouts.length());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_timequeue.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_scalarprimitives.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                             // =================
+                             // class TimingWheel
+                             // =================
+
+template <class DATA>
+class TimingWheel {
+    // This parameterized class provides a thread-safe time event queue having
+    // the same interface and ordering guarantees as 'TimeQueue<DATA>', and
+    // implemented as a hierarchical timing wheel, in which items are added,
+    // removed, and updated in constant time.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64  Int64;
+    typedef bsl::uint64_t       Uint64;
+
+    enum {
+        k_NUM_INDEX_BITS_MIN     = 8,
+        k_NUM_INDEX_BITS_MAX     = 24,
+        k_NUM_INDEX_BITS_DEFAULT = 17
+    };
+
+    enum {
+        k_LEVEL_BITS     = 8,                       // log2 of slots per level
+        k_NUM_SLOTS      = 1 << k_LEVEL_BITS,       // slots per level
+        k_SLOT_MASK      = k_NUM_SLOTS - 1,
+        k_NUM_LEVELS     = 64 / k_LEVEL_BITS,       // levels to cover 2**64
+        k_NUM_WORDS      = k_NUM_SLOTS / 64,        // bitmap words per level
+        k_NUM_ALL_SLOTS  = k_NUM_LEVELS * k_NUM_SLOTS
+    };
+
+  public:
+    // TYPES
+    typedef typename TimeQueue<DATA>::Handle Handle;
+        // 'Handle' defines an alias for uniquely identifying a valid item in
+        // the timing wheel, having the same semantics as 'TimeQueue::Handle'.
+
+    typedef typename TimeQueue<DATA>::Key    Key;
+        // 'Key' defines an alias for the client-supplied key optionally
+        // identifying an item in the timing wheel.
+
+  private:
+    // PRIVATE TYPES
+    struct Node {
+        // This struct provides a node of the doubly-linked circular list of
+        // items held in a slot of the wheel.  Free nodes are singly linked
+        // through 'd_next_p', and have a null 'd_prev_p'.
+
+        // PUBLIC DATA MEMBERS
+        int                       d_index;     // handle of the item
+        int                       d_slot;      // slot holding the item
+        Uint64                    d_sequence;  // order of insertion
+        bsls::TimeInterval        d_time;      // time value of the item
+        Key                       d_key;       // key of the item
+        Node                     *d_prev_p;    // previous node in the slot
+        Node                     *d_next_p;    // next node in the slot
+        bsls::ObjectBuffer<DATA>  d_data;      // data of the item
+
+        // CREATORS
+        Node()
+        : d_index(0)
+        , d_slot(-1)
+        , d_sequence(0)
+        , d_key(0)
+        , d_prev_p(0)
+        , d_next_p(0)
+            // Create a 'Node' having a time value of 0.
+        {
+        }
+    };
+
+    // DATA
+    const int                  d_indexMask;
+    const int                  d_indexIterationMask;
+    const int                  d_indexIterationInc;
+
+    const Int64                d_granularity;     // nanoseconds per tick
+
+    mutable bslmt::Mutex       d_mutex;           // used for synchronizing
+                                                  // access to this wheel
+
+    bsl::vector<Node *>        d_nodeArray;       // array of nodes in this
+                                                  // wheel
+
+    bsls::AtomicPointer<Node>  d_nextFreeNode_p;  // pointer to the next free
+                                                  // node (the free list is
+                                                  // singly linked only, using
+                                                  // 'd_next_p')
+
+    bsl::vector<Node *>        d_slots;           // head of the circular list
+                                                  // of each slot, by
+                                                  // 'level * 256 + slot'
+
+    Uint64                     d_occupied[k_NUM_LEVELS][k_NUM_WORDS];
+                                                  // bitmap of the non-empty
+                                                  // slots of each level
+
+    Uint64                     d_currentTick;     // tick up to which the
+                                                  // wheel has advanced
+
+    Uint64                     d_sequence;        // insertion counter
+
+    mutable bsls::TimeInterval d_minTime;         // lowest time value, if
+                                                  // 'd_isMinTimeValid'
+
+    mutable bool               d_isMinTimeValid;  // 'true' if 'd_minTime' is
+                                                  // the lowest time value
+
+    bsl::vector<Node *>        d_scratch;         // nodes being ordered
+
+    bsls::AtomicInt            d_length;          // number of items currently
+                                                  // in this wheel
+
+    bslma::Allocator          *d_allocator_p;     // allocator (held, not
+                                                  // owned)
+
+    // PRIVATE CLASS METHODS
+    static bool isLess(const Node *lhs, const Node *rhs);
+        // Return 'true' if the item held by the specified 'lhs' node is to be
+        // retrieved before that held by the specified 'rhs' node, that is if
+        // it has a lower time value or, having the same time value, was added
+        // earlier, and 'false' otherwise.
+
+    // PRIVATE MANIPULATORS
+    void cascade(int slot);
+        // Redistribute the items held in the specified 'slot' of a level
+        // greater than 0 into the lower levels.  The behavior is undefined
+        // unless 'd_currentTick' is the first tick of 'slot'.
+
+    void freeNode(Node *node);
+        // Prepare the specified 'node' for being reused on the free list by
+        // incrementing the iteration count.  Set 'd_prev_p' field to 0.
+
+    Node *getFreeNode();
+        // Return a node from the free list, or a new node if the free list is
+        // empty, or 0 if the maximum number of items has been reached.
+
+    void link(Node *node);
+        // Insert the specified 'node' in the slot corresponding to its time
+        // value.
+
+    void popImp(const bsls::TimeInterval&          time,
+                int                                maxTimers,
+                bsl::vector<TimeQueueItem<DATA> > *buffer,
+                int                               *newLength,
+                bsls::TimeInterval                *newMinTime);
+        // Implement 'popLE' for the specified 'time', 'maxTimers', 'buffer',
+        // 'newLength', and 'newMinTime'.
+
+    void putFreeNode(Node *node);
+        // Destroy the data located at the specified 'node' and reattach this
+        // 'node' to the front of the free list.  Note that the caller must not
+        // have acquired the lock to this wheel.
+
+    void putFreeNodeList(Node *begin);
+        // Destroy the 'DATA' of every node in the singly-linked list starting
+        // at the specified 'begin' node and ending with a null pointer, and
+        // reattach these nodes to the front of the free list.  Note that the
+        // caller must not have acquired the lock to this wheel.
+
+    void unlink(Node *node);
+        // Remove the specified 'node' from the slot holding it.
+
+    // PRIVATE ACCESSORS
+    Node *findNode(Handle handle, const Key& key) const;
+        // Return the node holding the item having the specified 'handle' and
+        // 'key', or 0 if there is no such item.
+
+    int firstSlot() const;
+        // Return the index of the slot holding the items having the lowest
+        // time values, or -1 if this wheel is empty.
+
+    void loadMinTime() const;
+        // Make 'd_minTime' hold the lowest time value in this wheel.  The
+        // behavior is undefined unless this wheel is not empty.
+
+    Uint64 slotTick(int slot) const;
+        // Return the first tick covered by the specified 'slot'.
+
+    Uint64 toTick(const bsls::TimeInterval& time) const;
+        // Return the tick containing the specified 'time', or 'd_currentTick'
+        // if 'time' precedes it.
+
+    // NOT IMPLEMENTED
+    TimingWheel(const TimingWheel&) BSLS_KEYWORD_DELETED;
+    TimingWheel& operator=(const TimingWheel&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimingWheel, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TimingWheel(bslma::Allocator *basicAllocator = 0);
+    explicit TimingWheel(const bsls::TimeInterval&  tickGranularity,
+                         bslma::Allocator          *basicAllocator = 0);
+    TimingWheel(const bsls::TimeInterval&  tickGranularity,
+                int                        numIndexBits,
+                bslma::Allocator          *basicAllocator = 0);
+        // Create an empty timing wheel.  Optionally specify a
+        // 'tickGranularity' defining the duration of a tick of the wheel; if
+        // 'tickGranularity' is not specified, one millisecond is used.
+        // Optionally specify 'numIndexBits' to configure the number of index
+        // bits used by this object; if 'numIndexBits' is not specified a
+        // default value of 17 is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'bsls::TimeInterval() < tickGranularity' and
+        // '8 <= numIndexBits <= 24'.  See {Tick Granularity} and
+        // {'bdlcc_timequeue'} for more information regarding
+        // 'tickGranularity' and 'numIndexBits', respectively.
+
+    ~TimingWheel();
+        // Destroy this timing wheel.
+
+    // MANIPULATORS
+    Handle add(const bsls::TimeInterval&  time,
+               const DATA&                data,
+               int                       *isNewTop = 0,
+               int                       *newLength = 0);
+    Handle add(const bsls::TimeInterval&  time,
+               const DATA&                data,
+               const Key&                 key,
+               int                       *isNewTop = 0,
+               int                       *newLength = 0);
+        // Add a new item to this wheel having the specified 'time' value, and
+        // associated 'data'.  Optionally use the specified 'key' to uniquely
+        // identify the item in subsequent calls to 'remove' and 'update'.
+        // Optionally load into the optionally specified 'isNewTop' a non-zero
+        // value if the item is now the lowest item in this wheel, and a 0
+        // value otherwise.  If specified, load into the optionally specified
+        // 'newLength', the new number of items in this wheel.  Return a value
+        // that may be used to identify the newly added item in future calls to
+        // this wheel on success, and -1 if the maximum number of items has
+        // been reached.
+
+    Handle add(const TimeQueueItem<DATA>&  item,
+               int                        *isNewTop = 0,
+               int                        *newLength = 0);
+        // Add the value of the specified 'item' to this wheel.  Optionally
+        // load into the optionally specified 'isNewTop' a non-zero value if
+        // the item is now the lowest element in this wheel, and a 0 value
+        // otherwise.  If specified, load into the optionally specified
+        // 'newLength', the new number of elements in this wheel.  Return a
+        // value that may be used to identify the newly added item in future
+        // calls to this wheel on success, and -1 if the maximum number of
+        // items has been reached.
+
+    int popFront(TimeQueueItem<DATA> *buffer = 0,
+                 int                 *newLength = 0,
+                 bsls::TimeInterval  *newMinTime = 0);
+        // Atomically remove the top item from this wheel, and optionally load
+        // into the optionally specified 'buffer' the time and associated data
+        // of the item removed.  Optionally load into the optionally specified
+        // 'newLength', the number of items remaining in the wheel.  Optionally
+        // load into the optionally specified 'newMinTime' the new lowest time
+        // in this wheel.  Return 0 on success, and a non-zero value if there
+        // are no items in the wheel.
+
+    void popLE(const bsls::TimeInterval&          time,
+               bsl::vector<TimeQueueItem<DATA> > *buffer = 0,
+               int                               *newLength = 0,
+               bsls::TimeInterval                *newMinTime = 0);
+        // Remove from this wheel all the items that have a time value less
+        // than or equal to the specified 'time', and optionally append into
+        // the optionally specified 'buffer' a list of the removed items,
+        // ordered by their corresponding time values (top item first).
+        // Optionally load into the optionally specified 'newLength' the number
+        // of items remaining in this wheel, and into the optionally specified
+        // 'newMinTime' the lowest remaining time value in this wheel.  Note
+        // that 'newMinTime' is only loaded if there are items remaining in the
+        // wheel.
+
+    void popLE(const bsls::TimeInterval&          time,
+               int                                maxTimers,
+               bsl::vector<TimeQueueItem<DATA> > *buffer = 0,
+               int                               *newLength = 0,
+               bsls::TimeInterval                *newMinTime = 0);
+        // Remove from this wheel up to the specified 'maxTimers' number of
+        // items that have a time value less than or equal to the specified
+        // 'time', and optionally append into the optionally specified 'buffer'
+        // a list of the removed items, ordered by their corresponding time
+        // values (top item first).  Optionally load into the optionally
+        // specified 'newLength' the number of items remaining in this wheel,
+        // and into the optionally specified 'newMinTime' the lowest remaining
+        // time value in this wheel.  The behavior is undefined unless
+        // '0 <= maxTimers'.  Note that 'newMinTime' is only loaded if there
+        // are items remaining in the wheel.
+
+    int remove(Handle               handle,
+               int                 *newLength = 0,
+               bsls::TimeInterval  *newMinTime = 0,
+               TimeQueueItem<DATA> *item = 0);
+    int remove(Handle               handle,
+               const Key&           key,
+               int                 *newLength = 0,
+               bsls::TimeInterval  *newMinTime = 0,
+               TimeQueueItem<DATA> *item = 0);
+        // Remove from this wheel the item having the specified 'handle', and
+        // optionally load into the optionally specified 'item' the time and
+        // data values of the removed item.  Optionally use the specified 'key'
+        // to uniquely identify the item.  If specified, load into the
+        // optionally specified 'newLength' the number of items remaining in
+        // this wheel, and into the optionally specified 'newMinTime' the
+        // resulting lowest time value remaining in the wheel.  Return 0 on
+        // success, and a non-zero value if no item with the 'handle' exists in
+        // the wheel.
+
+    void removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer = 0);
+        // Remove all the items from this wheel.  Optionally specify a 'buffer'
+        // in which to load the removed items, ordered by increasing time
+        // value.
+
+    int update(Handle                     handle,
+               const bsls::TimeInterval&  newTime,
+               int                       *isNewTop = 0);
+    int update(Handle                     handle,
+               const Key&                 key,
+               const bsls::TimeInterval&  newTime,
+               int                       *isNewTop = 0);
+        // Update the time value of the item having the specified 'handle' to
+        // the specified 'newTime' and optionally load into the optionally
+        // specified 'isNewTop' a non-zero value if the modified item is now
+        // the lowest time value in the wheel or zero otherwise.  Optionally
+        // use the specified 'key' to uniquely identify the item.  Return 0 on
+        // success, and a non-zero value if there is currently no item having
+        // the 'handle' registered with this wheel.
+
+    // ACCESSORS
+    bool isRegisteredHandle(Handle handle) const;
+    bool isRegisteredHandle(Handle handle, const Key& key) const;
+        // Return 'true' if an item having specified 'handle' (and optionally
+        // specified 'key') is currently registered with this wheel and false
+        // otherwise.
+
+    int length() const;
+        // Return a "snapshot" of the current number of items in this wheel.
+
+    int minTime(bsls::TimeInterval *buffer) const;
+        // Load into the specified 'buffer', the time value of the lowest time
+        // in this wheel.  Return 0 on success, and a non-zero value if this
+        // wheel is empty.
+
+    bsls::TimeInterval tickGranularity() const;
+        // Return the duration of a tick of this wheel.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // class TimingWheel
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+template <class DATA>
+inline
+bool TimingWheel<DATA>::isLess(const Node *lhs, const Node *rhs)
+{
+    return lhs->d_time < rhs->d_time
+        || (lhs->d_time == rhs->d_time && lhs->d_sequence < rhs->d_sequence);
+}
+
+// PRIVATE MANIPULATORS
+template <class DATA>
+void TimingWheel<DATA>::cascade(int slot)
+{
+    BSLS_ASSERT(k_NUM_SLOTS <= slot);
+    BSLS_ASSERT(slotTick(slot) == d_currentTick);
+
+    Node *first = d_slots[slot];
+
+    const int digit = slot & k_SLOT_MASK;
+
+    d_slots[slot] = 0;
+    d_occupied[slot / k_NUM_SLOTS][digit / 64] &=
+                                    ~(static_cast<Uint64>(1) << (digit & 63));
+
+    // Each item now has the same digit at this level as 'd_currentTick', and
+    // is linked into a lower level.
+
+    Node *node = first;
+    if (node) {
+        do {
+            Node *next = node->d_next_p;
+            link(node);
+            node = next;
+        } while (node != first);
+    }
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::freeNode(Node *node)
+{
+    node->d_index = ((node->d_index + d_indexIterationInc) &
+                         d_indexIterationMask) | (node->d_index & d_indexMask);
+
+    if (!(node->d_index & d_indexIterationMask)) {
+        node->d_index += d_indexIterationInc;
+    }
+    node->d_prev_p = 0;
+    node->d_slot   = -1;
+}
+
+template <class DATA>
+typename TimingWheel<DATA>::Node *TimingWheel<DATA>::getFreeNode()
+{
+    Node *node;
+    if (d_nextFreeNode_p) {
+        // All allocation of nodes goes through this routine, which is guarded
+        // by the mutex.  So no other thread will remove anything from the free
+        // list while this code is executing.  However, other threads may add
+        // to the free list.
+
+        node = d_nextFreeNode_p;
+        Node *next = node->d_next_p;
+        while (node != d_nextFreeNode_p.testAndSwap(node, next)) {
+            node = d_nextFreeNode_p;
+            next = node->d_next_p;
+        }
+    }
+    else {
+        // The number of nodes cannot grow to a size larger than the range of
+        // available indices.
+
+        if (static_cast<int>(d_nodeArray.size()) >= d_indexMask - 1) {
+            return 0;                                                 // RETURN
+        }
+
+        node = new (*d_allocator_p) Node;
+        d_nodeArray.push_back(node);
+        node->d_index =
+                    static_cast<int>(d_nodeArray.size()) | d_indexIterationInc;
+    }
+    return node;
+}
+
+template <class DATA>
+void TimingWheel<DATA>::link(Node *node)
+{
+    const Uint64 tick = toTick(node->d_time);
+    const Uint64 diff = tick ^ d_currentTick;
+
+    // The level of the item is that of the most significant digit in which
+    // its tick differs from the current tick.
+
+    const int level = diff >> k_LEVEL_BITS
+                    ? (63 - bdlb::BitUtil::numLeadingUnsetBits(diff))
+                                                                / k_LEVEL_BITS
+                    : 0;
+    const int digit = static_cast<int>((tick >> (level * k_LEVEL_BITS))
+                                                               & k_SLOT_MASK);
+    const int slot  = level * k_NUM_SLOTS + digit;
+
+    Node *head = d_slots[slot];
+    if (head) {
+        node->d_prev_p = head->d_prev_p;
+        node->d_next_p = head;
+        head->d_prev_p->d_next_p = node;
+        head->d_prev_p = node;
+    }
+    else {
+        node->d_prev_p = node;
+        node->d_next_p = node;
+        d_slots[slot]  = node;
+        d_occupied[level][digit / 64] |=
+                                        static_cast<Uint64>(1) << (digit & 63);
+    }
+    node->d_slot = slot;
+}
+
+template <class DATA>
+void TimingWheel<DATA>::popImp(
+                             const bsls::TimeInterval&          time,
+                             int                                maxTimers,
+                             bsl::vector<TimeQueueItem<DATA> > *buffer,
+                             int                               *newLength,
+                             bsls::TimeInterval                *newMinTime)
+{
+    BSLS_ASSERT(0 <= maxTimers);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const Uint64 target = toTick(time);
+    Node        *begin  = 0;
+
+    while (0 < maxTimers) {
+        const int slot = firstSlot();
+        if (0 > slot || target < slotTick(slot)) {
+            // Nothing expires up to 'target', which the wheel can therefore
+            // reach without moving any item.
+
+            if (d_currentTick < target) {
+                d_currentTick = target;
+            }
+            break;
+        }
+
+        d_currentTick = slotTick(slot);
+
+        if (k_NUM_SLOTS <= slot) {
+            cascade(slot);
+            continue;
+        }
+
+        // The items of a slot of level 0 all expire within a tick, but not
+        // necessarily in order, nor all before 'time'.
+
+        d_scratch.clear();
+        Node *const first = d_slots[slot];
+        Node       *node  = first;
+        do {
+            d_scratch.push_back(node);
+            node = node->d_next_p;
+        } while (node != first);
+
+        bsl::sort(d_scratch.begin(), d_scratch.end(), &isLess);
+
+        const bsl::size_t numNodes = d_scratch.size();
+        bsl::size_t       i        = 0;
+        for (; i < numNodes && 0 < maxTimers; ++i, --maxTimers) {
+            node = d_scratch[i];
+            if (time < node->d_time) {
+                break;
+            }
+            unlink(node);
+            if (buffer) {
+                buffer->push_back(TimeQueueItem<DATA>(node->d_time,
+                                                      node->d_data.object(),
+                                                      node->d_index,
+                                                      node->d_key,
+                                                      d_allocator_p));
+            }
+            freeNode(node);
+            node->d_next_p = begin;
+            begin = node;
+            --d_length;
+            d_isMinTimeValid = false;
+        }
+        if (i < numNodes) {
+            break;
+        }
+    }
+
+    if (newLength) {
+        *newLength = d_length;
+    }
+    if (d_length && newMinTime) {
+        loadMinTime();
+        *newMinTime = d_minTime;
+    }
+
+    lock.release()->unlock();
+    putFreeNodeList(begin);
+}
+
+template <class DATA>
+void TimingWheel<DATA>::putFreeNode(Node *node)
+{
+    node->d_data.object().~DATA();
+
+    Node *nextFreeNode = d_nextFreeNode_p;
+    node->d_next_p = nextFreeNode;
+    while (nextFreeNode != d_nextFreeNode_p.testAndSwap(nextFreeNode, node)) {
+        nextFreeNode = d_nextFreeNode_p;
+        node->d_next_p = nextFreeNode;
+    }
+}
+
+template <class DATA>
+void TimingWheel<DATA>::putFreeNodeList(Node *begin)
+{
+    if (begin) {
+        begin->d_data.object().~DATA();
+
+        Node *end = begin;
+        while (end->d_next_p) {
+            end = end->d_next_p;
+            end->d_data.object().~DATA();
+        }
+
+        Node *nextFreeNode = d_nextFreeNode_p;
+        end->d_next_p = nextFreeNode;
+
+        while (nextFreeNode !=
+                           d_nextFreeNode_p.testAndSwap(nextFreeNode, begin)) {
+            nextFreeNode = d_nextFreeNode_p;
+            end->d_next_p = nextFreeNode;
+        }
+    }
+}
+
+template <class DATA>
+void TimingWheel<DATA>::unlink(Node *node)
+{
+    const int slot = node->d_slot;
+
+    BSLS_ASSERT(0 <= slot && slot < k_NUM_ALL_SLOTS);
+
+    if (node->d_next_p != node) {
+        node->d_prev_p->d_next_p = node->d_next_p;
+        node->d_next_p->d_prev_p = node->d_prev_p;
+        if (d_slots[slot] == node) {
+            d_slots[slot] = node->d_next_p;
+        }
+    }
+    else {
+        const int digit = slot & k_SLOT_MASK;
+
+        d_slots[slot] = 0;
+        d_occupied[slot / k_NUM_SLOTS][digit / 64] &=
+                                    ~(static_cast<Uint64>(1) << (digit & 63));
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class DATA>
+inline
+typename TimingWheel<DATA>::Node *
+TimingWheel<DATA>::findNode(Handle handle, const Key& key) const
+{
+    const int index = (static_cast<int>(handle) & d_indexMask) - 1;
+    if (0 > index || index >= static_cast<int>(d_nodeArray.size())) {
+        return 0;                                                     // RETURN
+    }
+
+    Node *node = d_nodeArray[index];
+    if (node->d_index != static_cast<int>(handle)
+     || node->d_key   != key
+     || 0             == node->d_prev_p) {
+        return 0;                                                     // RETURN
+    }
+    return node;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::firstSlot() const
+{
+    // Slots of level 0 hold the ticks from the current one up to the end of
+    // its range of 256 ticks, and slots of level 'L > 0' the ticks after the
+    // current slot of level 'L'.  Hence the first set bit above the current
+    // digit of the lowest non-empty level identifies the earliest items.
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        const int digit = static_cast<int>(
+                     (d_currentTick >> (level * k_LEVEL_BITS)) & k_SLOT_MASK);
+        const int from  = 0 == level ? digit : digit + 1;
+
+        for (int word = from / 64; word < k_NUM_WORDS; ++word) {
+            Uint64 bits = d_occupied[level][word];
+            if (word == from / 64) {
+                bits &= ~static_cast<Uint64>(0) << (from & 63);
+            }
+            if (bits) {
+                return level * k_NUM_SLOTS                            // RETURN
+                     + word * 64
+                     + bdlb::BitUtil::numTrailingUnsetBits(bits);
+            }
+        }
+    }
+    return -1;
+}
+
+template <class DATA>
+void TimingWheel<DATA>::loadMinTime() const
+{
+    BSLS_ASSERT(0 < d_length);
+
+    if (d_isMinTimeValid) {
+        return;                                                       // RETURN
+    }
+
+    const int slot = firstSlot();
+
+    BSLS_ASSERT(0 <= slot);
+
+    const Node *const first = d_slots[slot];
+    const Node       *node  = first->d_next_p;
+
+    d_minTime = first->d_time;
+    while (node != first) {
+        if (node->d_time < d_minTime) {
+            d_minTime = node->d_time;
+        }
+        node = node->d_next_p;
+    }
+    d_isMinTimeValid = true;
+}
+
+template <class DATA>
+inline
+typename TimingWheel<DATA>::Uint64 TimingWheel<DATA>::slotTick(int slot) const
+{
+    const int    level = slot / k_NUM_SLOTS;
+    const int    shift = level * k_LEVEL_BITS;
+    const Uint64 high  = level + 1 < k_NUM_LEVELS
+                       ? d_currentTick & (~static_cast<Uint64>(0)
+                                                   << (shift + k_LEVEL_BITS))
+                       : 0;
+
+    return high | (static_cast<Uint64>(slot & k_SLOT_MASK) << shift);
+}
+
+template <class DATA>
+typename TimingWheel<DATA>::Uint64
+TimingWheel<DATA>::toTick(const bsls::TimeInterval& time) const
+{
+    // Time values beyond the range of a 64-bit count of nanoseconds share the
+    // last tick, and are ordered by comparing their exact values.
+
+    const Int64 k_MAX_SECONDS = 9000000000LL;
+
+    Uint64 tick;
+    if (time < bsls::TimeInterval()) {
+        tick = 0;
+    }
+    else if (time.seconds() >= k_MAX_SECONDS) {
+        tick = static_cast<Uint64>(LLONG_MAX / d_granularity);
+    }
+    else {
+        tick = static_cast<Uint64>(time.totalNanoseconds() / d_granularity);
+    }
+    return tick < d_currentTick ? d_currentTick : tick;
+}
+
+// CREATORS
+template <class DATA>
+TimingWheel<DATA>::TimingWheel(bslma::Allocator *basicAllocator)
+: d_indexMask((1 << k_NUM_INDEX_BITS_DEFAULT) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_granularity(1000 * 1000)
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_slots(k_NUM_ALL_SLOTS, static_cast<Node *>(0), basicAllocator)
+, d_currentTick(0)
+, d_sequence(0)
+, d_isMinTimeValid(false)
+, d_scratch(basicAllocator)
+, d_length(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    bsl::fill(&d_occupied[0][0],
+              &d_occupied[0][0] + k_NUM_LEVELS * k_NUM_WORDS,
+              static_cast<Uint64>(0));
+}
+
+template <class DATA>
+TimingWheel<DATA>::TimingWheel(const bsls::TimeInterval&  tickGranularity,
+                               bslma::Allocator          *basicAllocator)
+: d_indexMask((1 << k_NUM_INDEX_BITS_DEFAULT) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_granularity(tickGranularity.totalNanoseconds())
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_slots(k_NUM_ALL_SLOTS, static_cast<Node *>(0), basicAllocator)
+, d_currentTick(0)
+, d_sequence(0)
+, d_isMinTimeValid(false)
+, d_scratch(basicAllocator)
+, d_length(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(bsls::TimeInterval() < tickGranularity);
+
+    bsl::fill(&d_occupied[0][0],
+              &d_occupied[0][0] + k_NUM_LEVELS * k_NUM_WORDS,
+              static_cast<Uint64>(0));
+}
+
+template <class DATA>
+TimingWheel<DATA>::TimingWheel(const bsls::TimeInterval&  tickGranularity,
+                               int                        numIndexBits,
+                               bslma::Allocator          *basicAllocator)
+: d_indexMask((1 << numIndexBits) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_granularity(tickGranularity.totalNanoseconds())
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_slots(k_NUM_ALL_SLOTS, static_cast<Node *>(0), basicAllocator)
+, d_currentTick(0)
+, d_sequence(0)
+, d_isMinTimeValid(false)
+, d_scratch(basicAllocator)
+, d_length(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(bsls::TimeInterval() < tickGranularity);
+    BSLS_ASSERT(k_NUM_INDEX_BITS_MIN <= numIndexBits
+             && k_NUM_INDEX_BITS_MAX >= numIndexBits);
+
+    bsl::fill(&d_occupied[0][0],
+              &d_occupied[0][0] + k_NUM_LEVELS * k_NUM_WORDS,
+              static_cast<Uint64>(0));
+}
+
+template <class DATA>
+TimingWheel<DATA>::~TimingWheel()
+{
+    removeAll();
+
+    const int numNodes = static_cast<int>(d_nodeArray.size());
+    for (int i = 0; i < numNodes; ++i) {
+        d_allocator_p->deleteObjectRaw(d_nodeArray[i]);
+    }
+}
+
+// MANIPULATORS
+template <class DATA>
+inline
+typename TimingWheel<DATA>::Handle TimingWheel<DATA>::add(
+                                          const bsls::TimeInterval&  time,
+                                          const DATA&                data,
+                                          int                       *isNewTop,
+                                          int                       *newLength)
+{
+    return add(time, data, Key(0), isNewTop, newLength);
+}
+
+template <class DATA>
+typename TimingWheel<DATA>::Handle TimingWheel<DATA>::add(
+                                          const bsls::TimeInterval&  time,
+                                          const DATA&                data,
+                                          const Key&                 key,
+                                          int                       *isNewTop,
+                                          int                       *newLength)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    Node *node = getFreeNode();
+    if (!node) {
+        return -1;                                                    // RETURN
+    }
+
+    bslalg::ScalarPrimitives::copyConstruct(&node->d_data.object(),
+                                            data,
+                                            d_allocator_p);
+    node->d_time     = time;
+    node->d_key      = key;
+    node->d_sequence = d_sequence++;
+
+    if (isNewTop && d_length) {
+        loadMinTime();
+    }
+
+    int isTop = 0;
+    if (0 == d_length || (d_isMinTimeValid && time < d_minTime)) {
+        d_minTime        = time;
+        d_isMinTimeValid = true;
+        isTop            = 1;
+    }
+
+    link(node);
+    ++d_length;
+
+    if (isNewTop) {
+        *isNewTop = isTop;
+    }
+    if (newLength) {
+        *newLength = d_length;
+    }
+
+    BSLS_ASSERT(-1 != node->d_index);
+    return node->d_index;
+}
+
+template <class DATA>
+inline
+typename TimingWheel<DATA>::Handle TimingWheel<DATA>::add(
+                                         const TimeQueueItem<DATA>&  item,
+                                         int                        *isNewTop,
+                                         int                        *newLength)
+{
+    return add(item.time(), item.data(), item.key(), isNewTop, newLength);
+}
+
+template <class DATA>
+int TimingWheel<DATA>::popFront(TimeQueueItem<DATA> *buffer,
+                                int                 *newLength,
+                                bsls::TimeInterval  *newMinTime)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const int slot = firstSlot();
+    if (0 > slot) {
+        return 1;                                                     // RETURN
+    }
+
+    // The top item is removed without advancing the wheel, as its time may
+    // not be reached yet.
+
+    Node *const first = d_slots[slot];
+    Node       *node  = first;
+    for (Node *it = first->d_next_p; it != first; it = it->d_next_p) {
+        if (isLess(it, node)) {
+            node = it;
+        }
+    }
+
+    if (buffer) {
+        buffer->time()   = node->d_time;
+        buffer->data()   = node->d_data.object();
+        buffer->handle() = node->d_index;
+        buffer->key()    = node->d_key;
+    }
+
+    unlink(node);
+    freeNode(node);
+    --d_length;
+    d_isMinTimeValid = false;
+
+    if (d_length && newMinTime) {
+        loadMinTime();
+        *newMinTime = d_minTime;
+    }
+    if (newLength) {
+        *newLength = d_length;
+    }
+
+    lock.release()->unlock();
+
+    putFreeNode(node);
+    return 0;
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::popLE(const bsls::TimeInterval&          time,
+                              bsl::vector<TimeQueueItem<DATA> > *buffer,
+                              int                               *newLength,
+                              bsls::TimeInterval                *newMinTime)
+{
+    popImp(time, INT_MAX, buffer, newLength, newMinTime);
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::popLE(const bsls::TimeInterval&          time,
+                              int                                maxTimers,
+                              bsl::vector<TimeQueueItem<DATA> > *buffer,
+                              int                               *newLength,
+                              bsls::TimeInterval                *newMinTime)
+{
+    popImp(time, maxTimers, buffer, newLength, newMinTime);
+}
+
+template <class DATA>
+inline
+int TimingWheel<DATA>::remove(Handle               handle,
+                              int                 *newLength,
+                              bsls::TimeInterval  *newMinTime,
+                              TimeQueueItem<DATA> *item)
+{
+    return remove(handle, Key(0), newLength, newMinTime, item);
+}
+
+template <class DATA>
+int TimingWheel<DATA>::remove(Handle               handle,
+                              const Key&           key,
+                              int                 *newLength,
+                              bsls::TimeInterval  *newMinTime,
+                              TimeQueueItem<DATA> *item)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    Node *node = findNode(handle, key);
+    if (!node) {
+        return 1;                                                     // RETURN
+    }
+
+    if (item) {
+        item->time()   = node->d_time;
+        item->data()   = node->d_data.object();
+        item->handle() = node->d_index;
+        item->key()    = node->d_key;
+    }
+
+    if (d_isMinTimeValid && node->d_time == d_minTime) {
+        d_isMinTimeValid = false;
+    }
+
+    unlink(node);
+    freeNode(node);
+    --d_length;
+
+    if (newLength) {
+        *newLength = d_length;
+    }
+    if (d_length && newMinTime) {
+        loadMinTime();
+        *newMinTime = d_minTime;
+    }
+
+    lock.release()->unlock();
+
+    putFreeNode(node);
+    return 0;
+}
+
+template <class DATA>
+void TimingWheel<DATA>::removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_scratch.clear();
+    for (int slot = 0; slot < k_NUM_ALL_SLOTS; ++slot) {
+        Node *const first = d_slots[slot];
+        if (first) {
+            Node *node = first;
+            do {
+                d_scratch.push_back(node);
+                node = node->d_next_p;
+            } while (node != first);
+            d_slots[slot] = 0;
+        }
+    }
+    bsl::fill(&d_occupied[0][0],
+              &d_occupied[0][0] + k_NUM_LEVELS * k_NUM_WORDS,
+              static_cast<Uint64>(0));
+
+    if (buffer) {
+        bsl::sort(d_scratch.begin(), d_scratch.end(), &isLess);
+    }
+
+    Node *begin = 0;
+    for (bsl::size_t i = 0; i < d_scratch.size(); ++i) {
+        Node *node = d_scratch[i];
+        if (buffer) {
+            buffer->push_back(TimeQueueItem<DATA>(node->d_time,
+                                                  node->d_data.object(),
+                                                  node->d_index,
+                                                  node->d_key,
+                                                  d_allocator_p));
+        }
+        freeNode(node);
+        node->d_next_p = begin;
+        begin = node;
+    }
+    d_scratch.clear();
+    d_length         = 0;
+    d_isMinTimeValid = false;
+
+    lock.release()->unlock();
+    putFreeNodeList(begin);
+}
+
+template <class DATA>
+inline
+int TimingWheel<DATA>::update(Handle                     handle,
+                              const bsls::TimeInterval&  newTime,
+                              int                       *isNewTop)
+{
+    return update(handle, Key(0), newTime, isNewTop);
+}
+
+template <class DATA>
+int TimingWheel<DATA>::update(Handle                     handle,
+                              const Key&                 key,
+                              const bsls::TimeInterval&  newTime,
+                              int                       *isNewTop)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    Node *node = findNode(handle, key);
+    if (!node) {
+        return 1;                                                     // RETURN
+    }
+
+    if (d_isMinTimeValid && node->d_time == d_minTime) {
+        d_isMinTimeValid = false;
+    }
+
+    unlink(node);
+    node->d_time     = newTime;
+    node->d_sequence = d_sequence++;
+    link(node);
+
+    if (d_isMinTimeValid && newTime < d_minTime) {
+        d_minTime = newTime;
+    }
+
+    if (isNewTop) {
+        loadMinTime();
+        *isNewTop = newTime == d_minTime;
+    }
+    return 0;
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+bool TimingWheel<DATA>::isRegisteredHandle(Handle handle) const
+{
+    return isRegisteredHandle(handle, Key(0));
+}
+
+template <class DATA>
+inline
+bool TimingWheel<DATA>::isRegisteredHandle(Handle     handle,
+                                           const Key& key) const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    return 0 != findNode(handle, key);
+}
+
+template <class DATA>
+inline
+int TimingWheel<DATA>::length() const
+{
+    return d_length;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::minTime(bsls::TimeInterval *buffer) const
+{
+    BSLS_ASSERT(buffer);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (0 == d_length) {
+        return 1;                                                     // RETURN
+    }
+
+    loadMinTime();
+    *buffer = d_minTime;
+    return 0;
+}
+
+template <class DATA>
+inline
+bsls::TimeInterval TimingWheel<DATA>::tickGranularity() const
+{
+    bsls::TimeInterval result;
+    result.setTotalNanoseconds(d_granularity);
+    return result;
+}
+
+                                  // Aspects
+
+template <class DATA>
+inline
+bslma::Allocator *TimingWheel<DATA>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1086 @@
+// bdlcc_timingwheel.t.cpp                                            -*-C++-*-
+
+#include <bdlcc_timingwheel.h>
+
+#include <bdlcc_timequeue.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a time event queue having the interface
+// of 'bdlcc::TimeQueue' and implemented as a hierarchical timing wheel.  The
+// main concern is that items are retrieved in the same order, and at the same
+// time, as from a 'bdlcc::TimeQueue', for any tick granularity and for time
+// values spread over all the levels of the wheel.  This is verified by
+// applying random sequences of operations to both a 'bdlcc::TimingWheel' and a
+// 'bdlcc::TimeQueue', used as an oracle, and comparing the results.  Handles,
+// keys, memory allocation, and concurrent access are then verified
+// separately.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] TimingWheel(bslma::Allocator *basicAllocator = 0);
+// [ 2] TimingWheel(const TimeInterval& tickGranularity, Allocator *);
+// [ 2] TimingWheel(const TimeInterval& tick, int, Allocator *);
+// [ 2] ~TimingWheel();
+//
+// MANIPULATORS
+// [ 2] Handle add(const TimeInterval& time, const DATA& data, ...);
+// [ 2] Handle add(const TimeInterval&, const DATA&, const Key&, ...);
+// [ 2] Handle add(const TimeQueueItem<DATA>& item, ...);
+// [ 4] int popFront(TimeQueueItem<DATA> *buffer = 0, ...);
+// [ 3] void popLE(const TimeInterval& time, vector<Item> *buffer, ...);
+// [ 4] void popLE(const TimeInterval& time, int maxTimers, ...);
+// [ 2] int remove(Handle handle, ...);
+// [ 2] int remove(Handle handle, const Key& key, ...);
+// [ 5] void removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer = 0);
+// [ 4] int update(Handle handle, const TimeInterval& newTime, ...);
+// [ 4] int update(Handle handle, const Key&, const TimeInterval&, ...);
+//
+// ACCESSORS
+// [ 2] bool isRegisteredHandle(Handle handle) const;
+// [ 2] bool isRegisteredHandle(Handle handle, const Key& key) const;
+// [ 2] int length() const;
+// [ 2] int minTime(bsls::TimeInterval *buffer) const;
+// [ 2] bsls::TimeInterval tickGranularity() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 3] CONCERN: Items are retrieved as from a 'bdlcc::TimeQueue'.
+// [ 5] CONCERN: Memory is supplied by the object allocator.
+// [ 6] CONCERN: Time values before the epoch and far in the future.
+// [ 7] CONCERN: Concurrent access.
+// [-1] PERFORMANCE: schedule and cancel vs 'bdlcc::TimeQueue'
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::TimingWheel<int>   Obj;
+typedef bdlcc::TimeQueue<int>     Oracle;
+typedef bdlcc::TimeQueueItem<int> Item;
+typedef bsls::Types::Int64        Int64;
+
+static const bsls::TimeInterval ONE_MS(0, 1000 * 1000);
+
+// ============================================================================
+//                   GLOBAL STRUCTS/FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+class Random {
+    // This class provides a deterministic pseudo-random number generator.
+
+    // DATA
+    bsls::Types::Uint64 d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned seed)
+        // Create a generator using the specified 'seed'.
+    : d_state(seed * 2654435761ULL + 1)
+    {
+    }
+
+    // MANIPULATORS
+    Int64 operator()(Int64 range)
+        // Return a pseudo-random number in '[0 .. range)'.  The behavior is
+        // undefined unless '0 < range'.
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<Int64>((d_state >> 11) % range);
+    }
+};
+
+bool areEqual(const bsl::vector<Item>& lhs, const bsl::vector<Item>& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' hold items having the
+    // same time values and data in the same order, and 'false' otherwise.
+{
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+    for (bsl::size_t i = 0; i < lhs.size(); ++i) {
+        if (lhs[i].time() != rhs[i].time() || lhs[i].data() != rhs[i].data()) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                           // ===================
+                           // class ConcurrentJob
+                           // ===================
+
+class ConcurrentJob {
+    // This class implements a job of the concurrency test, repeatedly adding
+    // timers and cancelling nearly all of them, while another thread retrieves
+    // the expired ones.
+
+    // DATA
+    Obj             *d_wheel_p;
+    bslmt::Barrier  *d_barrier_p;
+    bsls::AtomicInt *d_numExpired_p;
+    int              d_threadIndex;
+    int              d_numIterations;
+
+  public:
+    // CREATORS
+    ConcurrentJob(Obj             *wheel,
+                  bslmt::Barrier  *barrier,
+                  bsls::AtomicInt *numExpired,
+                  int              threadIndex,
+                  int              numIterations)
+        // Create a job operating on the specified 'wheel', synchronizing on
+        // the specified 'barrier', counting the items expected to expire in
+        // the specified 'numExpired', for the thread with the specified
+        // 'threadIndex', and running the specified 'numIterations'.
+    : d_wheel_p(wheel)
+    , d_barrier_p(barrier)
+    , d_numExpired_p(numExpired)
+    , d_threadIndex(threadIndex)
+    , d_numIterations(numIterations)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()()
+        // Run this job.
+    {
+        Random random(d_threadIndex);
+
+        d_barrier_p->wait();
+
+        for (int i = 0; i < d_numIterations; ++i) {
+            const bsls::TimeInterval time(0, random(1000 * 1000 * 1000));
+
+            const Obj::Handle handle = d_wheel_p->add(time, d_threadIndex);
+            ASSERTV(d_threadIndex, i, -1 != handle);
+
+            if (0 == i % 16) {
+                ++*d_numExpired_p;
+            }
+            else if (0 != d_wheel_p->remove(handle)) {
+                // Expired concurrently.
+
+                ++*d_numExpired_p;
+            }
+        }
+    }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: I/O Timeouts
+///- - - - - - - - - - - -
+// Suppose that a server arms a read timeout for each request it sends to a
+// peer, and disarms it when the response arrives, which is almost always
+// before the timeout expires.
+//
+// First, we create a timing wheel of connection identifiers with a tick
+// granularity of 10 milliseconds, which is the precision we need for timeouts:
+//..
+    bdlcc::TimingWheel<int> timeouts(bsls::TimeInterval(0, 10 * 1000 * 1000));
+//..
+// Then, we arm timeouts for three requests sent at time 'now':
+//..
+    const bsls::TimeInterval now(1000, 0);
+
+    bdlcc::TimingWheel<int>::Handle h1 =
+                                 timeouts.add(now + bsls::TimeInterval(5), 1);
+    bdlcc::TimingWheel<int>::Handle h2 =
+                                 timeouts.add(now + bsls::TimeInterval(5), 2);
+    bdlcc::TimingWheel<int>::Handle h3 =
+                                 timeouts.add(now + bsls::TimeInterval(2), 3);
+    ASSERT(3 == timeouts.length());
+//..
+// Next, the responses to the first and third requests arrive, and we disarm
+// their timeouts:
+//..
+    ASSERT(0 == timeouts.remove(h1));
+    ASSERT(0 == timeouts.remove(h3));
+//..
+// Finally, after 6 seconds, we retrieve the expired timeouts and find that
+// only the second request timed out:
+//..
+    bsl::vector<bdlcc::TimeQueueItem<int> > expired;
+    timeouts.popLE(now + bsls::TimeInterval(6), &expired);
+
+    ASSERT(1  == expired.size());
+    ASSERT(2  == expired[0].data());
+    ASSERT(h2 == expired[0].handle());
+    ASSERT(0  == timeouts.length());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENT ACCESS
+        //
+        // Concerns:
+        //: 1 Items can be added and removed concurrently from several threads
+        //:   while another thread retrieves the expired items, and every item
+        //:   is either removed or retrieved exactly once.
+        //
+        // Plan:
+        //: 1 Run threads adding items and removing nearly all of them, while
+        //:   the main thread retrieves the expired items with 'popLE' for an
+        //:   advancing time.  Verify that the number of items retrieved is the
+        //:   number of items not removed.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Concurrent access.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT ACCESS" << endl
+                          << "=================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 50000 };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(ONE_MS, 20, &oa);  const Obj& X = mX;
+
+            bslmt::Barrier     barrier(k_NUM_THREADS + 1);
+            bsls::AtomicInt    numExpired(0);
+            bslmt::ThreadGroup threads(&oa);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threads.addThread(ConcurrentJob(&mX,
+                                                &barrier,
+                                                &numExpired,
+                                                i,
+                                                k_NUM_ITERATIONS));
+            }
+
+            barrier.wait();
+
+            bsl::vector<Item> buffer(&oa);
+            int               numRetrieved = 0;
+            for (int i = 0; i < 1000; ++i) {
+                buffer.clear();
+                mX.popLE(bsls::TimeInterval(0, i * 1000 * 1000), &buffer);
+                numRetrieved += static_cast<int>(buffer.size());
+            }
+            threads.joinAll();
+
+            buffer.clear();
+            mX.popLE(bsls::TimeInterval(1), &buffer);
+            numRetrieved += static_cast<int>(buffer.size());
+
+            ASSERTV(numRetrieved, numExpired, numRetrieved == numExpired);
+            ASSERTV(X.length(), 0 == X.length());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EXTREME TIME VALUES
+        //
+        // Concerns:
+        //: 1 Time values before the epoch, before the time up to which the
+        //:   wheel has advanced, and far in the future are retrieved in order.
+        //
+        // Plan:
+        //: 1 Advance a wheel, then add items having such time values, and
+        //:   verify the order in which they are retrieved.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Time values before the epoch and far in the future.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXTREME TIME VALUES" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(ONE_MS, &oa);  const Obj& X = mX;
+
+            mX.popLE(bsls::TimeInterval(100));
+
+            const bsls::TimeInterval FAR1(LLONG_MAX / 2, 0);
+            const bsls::TimeInterval FAR2(LLONG_MAX,     0);
+
+            mX.add(FAR2,                            6);
+            mX.add(FAR1,                            5);
+            mX.add(bsls::TimeInterval(100, 5),      4);
+            mX.add(bsls::TimeInterval(50),          3);
+            mX.add(bsls::TimeInterval(0, -1),       2);
+            mX.add(bsls::TimeInterval(-LLONG_MAX),  1);
+            ASSERT(6 == X.length());
+
+            bsls::TimeInterval minTime;
+            ASSERT(0 == X.minTime(&minTime));
+            ASSERT(bsls::TimeInterval(-LLONG_MAX) == minTime);
+
+            bsl::vector<Item> buffer(&oa);
+            mX.popLE(bsls::TimeInterval(100), &buffer);
+            ASSERTV(buffer.size(), 3 == buffer.size());
+            for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+                ASSERTV(i, static_cast<int>(i) + 1 == buffer[i].data());
+            }
+
+            int newLength;
+            mX.popLE(bsls::TimeInterval(1000), &buffer, &newLength, &minTime);
+            ASSERTV(buffer.size(), 4 == buffer.size());
+            ASSERT(2 == newLength);
+            ASSERT(FAR1 == minTime);
+
+            mX.popLE(FAR2, &buffer);
+            ASSERTV(buffer.size(), 6 == buffer.size());
+            for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+                ASSERTV(i, static_cast<int>(i) + 1 == buffer[i].data());
+            }
+            ASSERT(0 == X.length());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'removeAll' AND MEMORY ALLOCATION
+        //
+        // Concerns:
+        //: 1 'removeAll' removes all items, optionally loading them in time
+        //:   order.
+        //:
+        //: 2 'DATA' is constructed using the object allocator, and destroyed
+        //:   when the item is removed.
+        //:
+        //: 3 Nodes of removed items are reused.
+        //
+        // Plan:
+        //: 1 Add and remove 'bsl::string' items and verify the allocators.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   void removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer = 0);
+        //   CONCERN: Memory is supplied by the object allocator.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'removeAll' AND MEMORY ALLOCATION" << endl
+                          << "=================================" << endl;
+
+        typedef bdlcc::TimingWheel<bsl::string>   StringObj;
+        typedef bdlcc::TimeQueueItem<bsl::string> StringItem;
+
+        const char *LONG = "a string long enough to allocate memory";
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            StringObj mX(ONE_MS, &oa);  const StringObj& X = mX;
+
+            const bsl::string value(LONG, &sa);
+            for (int i = 0; i < 100; ++i) {
+                mX.add(bsls::TimeInterval(100 - i), value);
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            ASSERT(100 == X.length());
+
+            bsl::vector<StringItem> buffer(&sa);
+            mX.removeAll(&buffer);
+            ASSERT(0   == X.length());
+            ASSERT(100 == buffer.size());
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, bsls::TimeInterval(i + 1) == buffer[i].time());
+                ASSERTV(i, value == buffer[i].data());
+            }
+
+            const Int64 numBlocks = oa.numBlocksInUse();
+            for (int i = 0; i < 100; ++i) {
+                mX.add(bsls::TimeInterval(i), value);
+            }
+            ASSERTV(numBlocks, oa.numBlocksInUse(),
+                    numBlocks + 100 == oa.numBlocksInUse());
+
+            mX.removeAll();
+            ASSERTV(numBlocks, oa.numBlocksInUse(),
+                    numBlocks == oa.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'update', 'popFront', AND BOUNDED 'popLE'
+        //
+        // Concerns:
+        //: 1 'update' moves an item to its new time value, possibly making it
+        //:   the top item, and fails for an invalid handle or key.
+        //:
+        //: 2 'popFront' removes the top item, even if its time value lies in a
+        //:   slot the wheel has not reached.
+        //:
+        //: 3 'popLE' retrieves at most 'maxTimers' items, and the remaining
+        //:   expired items are retrieved by the next call.
+        //
+        // Plan:
+        //: 1 Exercise each method on items spread over several levels and
+        //:   verify the results.  (C-1..3)
+        //
+        // Testing:
+        //   int popFront(TimeQueueItem<DATA> *buffer = 0, ...);
+        //   void popLE(const TimeInterval& time, int maxTimers, ...);
+        //   int update(Handle handle, const TimeInterval& newTime, ...);
+        //   int update(Handle handle, const Key&, const TimeInterval&, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'update', 'popFront', AND BOUNDED 'popLE'"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(ONE_MS, &oa);  const Obj& X = mX;
+
+            const Obj::Key KEY(&oa);
+
+            const Obj::Handle h1 = mX.add(bsls::TimeInterval(10),   1);
+            const Obj::Handle h2 = mX.add(bsls::TimeInterval(1000), 2, KEY);
+            const Obj::Handle h3 = mX.add(bsls::TimeInterval(0, 5), 3);
+
+            int isNewTop = -1;
+            ASSERT(0 != mX.update(h2, bsls::TimeInterval(1), &isNewTop));
+            ASSERT(0 != mX.update(h1, KEY, bsls::TimeInterval(1)));
+            ASSERT(0 == mX.update(h2, KEY, bsls::TimeInterval(0, 1),
+                                  &isNewTop));
+            ASSERT(1 == isNewTop);
+            ASSERT(0 == mX.update(h3, bsls::TimeInterval(2000), &isNewTop));
+            ASSERT(0 == isNewTop);
+
+            bsls::TimeInterval minTime;
+            ASSERT(0 == X.minTime(&minTime));
+            ASSERT(bsls::TimeInterval(0, 1) == minTime);
+
+            Item item;
+            int  newLength;
+            ASSERT(0 == mX.popFront(&item, &newLength, &minTime));
+            ASSERT(2 == item.data());
+            ASSERT(h2 == item.handle());
+            ASSERT(2 == newLength);
+            ASSERT(bsls::TimeInterval(10) == minTime);
+
+            ASSERT(0 == mX.popFront(&item));
+            ASSERT(1 == item.data());
+            ASSERT(0 == mX.popFront(&item, &newLength));
+            ASSERT(3 == item.data());
+            ASSERT(0 == newLength);
+            ASSERT(0 != mX.popFront(&item));
+
+            for (int i = 0; i < 10; ++i) {
+                mX.add(bsls::TimeInterval(i + 1), i);
+            }
+            mX.add(bsls::TimeInterval(100), 10);
+
+            bsl::vector<Item> buffer(&oa);
+            mX.popLE(bsls::TimeInterval(50), 4, &buffer, &newLength);
+            ASSERT(4 == buffer.size());
+            ASSERT(7 == newLength);
+
+            mX.popLE(bsls::TimeInterval(50), 0, &buffer, &newLength);
+            ASSERT(4 == buffer.size());
+
+            mX.popLE(bsls::TimeInterval(50), 100, &buffer, &newLength,
+                     &minTime);
+            ASSERT(10 == buffer.size());
+            ASSERT(1  == newLength);
+            ASSERT(bsls::TimeInterval(100) == minTime);
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, i == buffer[i].data());
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COMPARISON WITH 'bdlcc::TimeQueue'
+        //
+        // Concerns:
+        //: 1 For any tick granularity, items spread over all the levels of the
+        //:   wheel, including many items having the same time value, are
+        //:   retrieved in the same order and at the same time as from a
+        //:   'bdlcc::TimeQueue'.
+        //:
+        //: 2 'minTime', 'newMinTime', and 'newLength' have the same values as
+        //:   for a 'bdlcc::TimeQueue'.
+        //
+        // Plan:
+        //: 1 For several tick granularities, apply the same random sequence of
+        //:   'add', 'remove', 'update', and 'popLE' operations, for an
+        //:   advancing current time, to a 'bdlcc::TimingWheel' and a
+        //:   'bdlcc::TimeQueue', and compare the results.  (C-1..2)
+        //
+        // Testing:
+        //   void popLE(const TimeInterval& time, vector<Item> *buffer, ...);
+        //   CONCERN: Items are retrieved as from a 'bdlcc::TimeQueue'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COMPARISON WITH 'bdlcc::TimeQueue'" << endl
+                          << "==================================" << endl;
+
+        static const Int64 GRANULARITIES[] = {
+            1, 1000, 1000 * 1000, 1000 * 1000 * 1000, 3 * 7 * 1000 * 1000
+        };
+        static const Int64 SPANS[] = {          // range of the time values
+            1000, 1000 * 1000, 1000LL * 1000 * 1000 * 1000
+        };
+        enum {
+            k_NUM_GRANULARITIES = sizeof GRANULARITIES / sizeof *GRANULARITIES,
+            k_NUM_SPANS         = sizeof SPANS / sizeof *SPANS,
+            k_NUM_OPERATIONS    = 20000
+        };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int gi = 0; gi < k_NUM_GRANULARITIES; ++gi) {
+        for (int si = 0; si < k_NUM_SPANS;         ++si) {
+            const Int64 GRANULARITY = GRANULARITIES[gi];
+            const Int64 SPAN        = SPANS[si];
+
+            if (veryVerbose) { P_(GRANULARITY) P(SPAN) }
+
+            bsls::TimeInterval granularity;
+            granularity.setTotalNanoseconds(GRANULARITY);
+
+            Obj    mX(granularity, &oa);  const Obj& X = mX;
+            Oracle mY(&oa);
+
+            bsl::vector<bsl::pair<Obj::Handle, Oracle::Handle> >
+                                                                handles(&oa);
+            bsl::vector<Item> bufferX(&oa);
+            bsl::vector<Item> bufferY(&oa);
+
+            Random random(gi * 10 + si);
+            Int64  now = SPAN;
+            for (int i = 0; i < k_NUM_OPERATIONS; ++i) {
+                const int op = static_cast<int>(random(100));
+
+                if (op < 50) {
+                    // Add, at times from the past up to far in the future,
+                    // with frequent duplicates.
+
+                    Int64 offset = random(SPAN) - SPAN / 10;
+                    if (0 == random(4)) {
+                        offset = offset / 100 * 100;
+                    }
+                    bsls::TimeInterval time;
+                    time.setTotalNanoseconds(now + offset);
+
+                    int isNewTopX, isNewTopY, lengthX, lengthY;
+                    handles.push_back(bsl::make_pair(
+                                mX.add(time, i, &isNewTopX, &lengthX),
+                                mY.add(time, i, &isNewTopY, &lengthY)));
+                    ASSERTV(GRANULARITY, SPAN, i, lengthX == lengthY);
+                    if (isNewTopY) {
+                        ASSERTV(GRANULARITY, SPAN, i, isNewTopX);
+                    }
+                }
+                else if (op < 75 && !handles.empty()) {
+                    const bsl::size_t j = static_cast<bsl::size_t>(
+                                                       random(handles.size()));
+                    int                lengthX = -1, lengthY = -2;
+                    bsls::TimeInterval minX, minY;
+                    const int rcX = mX.remove(handles[j].first,
+                                              &lengthX,
+                                              &minX);
+                    const int rcY = mY.remove(handles[j].second,
+                                              &lengthY,
+                                              &minY);
+                    ASSERTV(GRANULARITY, SPAN, i, rcX == rcY);
+                    if (0 == rcY) {
+                        ASSERTV(GRANULARITY, SPAN, i, lengthX == lengthY);
+                    }
+                    if (0 == rcY && 0 < lengthY) {
+                        ASSERTV(GRANULARITY, SPAN, i, minX == minY);
+                    }
+                    handles[j] = handles.back();
+                    handles.pop_back();
+                }
+                else if (op < 85 && !handles.empty()) {
+                    const bsl::size_t j = static_cast<bsl::size_t>(
+                                                       random(handles.size()));
+                    bsls::TimeInterval time;
+                    time.setTotalNanoseconds(now + random(SPAN));
+
+                    int isNewTopX, isNewTopY;
+                    const int rcX = mX.update(handles[j].first,
+                                              time,
+                                              &isNewTopX);
+                    const int rcY = mY.update(handles[j].second,
+                                              time,
+                                              &isNewTopY);
+                    ASSERTV(GRANULARITY, SPAN, i, rcX == rcY);
+                    if (0 == rcY && isNewTopY) {
+                        ASSERTV(GRANULARITY, SPAN, i, isNewTopX);
+                    }
+                }
+                else {
+                    now += random(SPAN / 20 + 1);
+
+                    bsls::TimeInterval time;
+                    time.setTotalNanoseconds(now);
+
+                    int                lengthX = -1, lengthY = -2;
+                    bsls::TimeInterval minX, minY;
+                    bufferX.clear();
+                    bufferY.clear();
+                    if (op & 1) {
+                        mX.popLE(time, &bufferX, &lengthX, &minX);
+                        mY.popLE(time, &bufferY, &lengthY, &minY);
+                    }
+                    else {
+                        mX.popLE(time, 5, &bufferX, &lengthX, &minX);
+                        mY.popLE(time, 5, &bufferY, &lengthY, &minY);
+                    }
+                    ASSERTV(GRANULARITY, SPAN, i, areEqual(bufferX, bufferY));
+                    ASSERTV(GRANULARITY, SPAN, i, lengthX == lengthY);
+                    if (0 < lengthY) {
+                        ASSERTV(GRANULARITY, SPAN, i, minX == minY);
+                    }
+                }
+
+                ASSERTV(GRANULARITY, SPAN, i, X.length() == mY.length());
+                bsls::TimeInterval minX, minY;
+                ASSERTV(GRANULARITY, SPAN, i,
+                        X.minTime(&minX) == mY.minTime(&minY));
+                if (0 < X.length()) {
+                    ASSERTV(GRANULARITY, SPAN, i, minX == minY);
+                }
+            }
+
+            bufferX.clear();
+            bufferY.clear();
+            mX.removeAll(&bufferX);
+            mY.removeAll(&bufferY);
+            ASSERTV(GRANULARITY, SPAN, bufferX.size() == bufferY.size());
+            for (bsl::size_t i = 0; i < bufferX.size(); ++i) {
+                ASSERTV(GRANULARITY, SPAN, i,
+                        bufferX[i].time() == bufferY[i].time());
+            }
+        }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS, HANDLES, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The wheel uses the supplied allocator, or the default allocator,
+        //:   and the supplied tick granularity, or one millisecond.
+        //:
+        //: 2 'add' returns distinct handles, and reports whether the item is
+        //:   the new top item and the new length.
+        //:
+        //: 3 'remove' and 'isRegisteredHandle' accept only the handle (and
+        //:   key) of an item in the wheel, and 'remove' loads the removed
+        //:   item, the new length, and the new lowest time value.
+        //:
+        //: 4 A handle is invalidated when its item is removed, even after the
+        //:   node of the item is reused.
+        //:
+        //: 5 'add' fails once the number of items reaches the capacity implied
+        //:   by 'numIndexBits'.
+        //
+        // Plan:
+        //: 1 Exercise each method and verify the results.  (C-1..5)
+        //
+        // Testing:
+        //   TimingWheel(bslma::Allocator *basicAllocator = 0);
+        //   TimingWheel(const TimeInterval& tickGranularity, Allocator *);
+        //   TimingWheel(const TimeInterval& tick, int, Allocator *);
+        //   ~TimingWheel();
+        //   Handle add(const TimeInterval& time, const DATA& data, ...);
+        //   Handle add(const TimeInterval&, const DATA&, const Key&, ...);
+        //   Handle add(const TimeQueueItem<DATA>& item, ...);
+        //   int remove(Handle handle, ...);
+        //   int remove(Handle handle, const Key& key, ...);
+        //   bool isRegisteredHandle(Handle handle) const;
+        //   bool isRegisteredHandle(Handle handle, const Key& key) const;
+        //   int length() const;
+        //   int minTime(bsls::TimeInterval *buffer) const;
+        //   bsls::TimeInterval tickGranularity() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS, HANDLES, AND BASIC "
+                          << "ACCESSORS" << endl
+                          << "========================================="
+                          << "=========" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(ONE_MS            == X.tickGranularity());
+        }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            const bsls::TimeInterval GRANULARITY(0, 500);
+
+            Obj mX(GRANULARITY, &oa);  const Obj& X = mX;
+
+            ASSERT(&oa         == X.allocator());
+            ASSERT(GRANULARITY == X.tickGranularity());
+            ASSERT(0           == X.length());
+
+            bsls::TimeInterval minTime;
+            ASSERT(0 != X.minTime(&minTime));
+
+            int isNewTop = -1, newLength = -1;
+
+            const Obj::Handle h1 = mX.add(bsls::TimeInterval(5),
+                                          1,
+                                          &isNewTop,
+                                          &newLength);
+            ASSERT(1 == isNewTop);
+            ASSERT(1 == newLength);
+
+            const Obj::Handle h2 = mX.add(bsls::TimeInterval(7),
+                                          2,
+                                          &isNewTop,
+                                          &newLength);
+            ASSERT(0 == isNewTop);
+            ASSERT(2 == newLength);
+
+            const Obj::Key KEY(&oa);
+            const Obj::Handle h3 = mX.add(Item(bsls::TimeInterval(3),
+                                               3,
+                                               0,
+                                               KEY),
+                                          &isNewTop,
+                                          &newLength);
+            ASSERT(1 == isNewTop);
+            ASSERT(3 == newLength);
+            ASSERT(h1 != h2 && h2 != h3 && h1 != h3);
+
+            ASSERT(0 == X.minTime(&minTime));
+            ASSERT(bsls::TimeInterval(3) == minTime);
+
+            ASSERT( X.isRegisteredHandle(h1));
+            ASSERT(!X.isRegisteredHandle(h3));
+            ASSERT( X.isRegisteredHandle(h3, KEY));
+            ASSERT(!X.isRegisteredHandle(h1, KEY));
+            ASSERT(!X.isRegisteredHandle(0));
+            ASSERT(!X.isRegisteredHandle(-1));
+
+            ASSERT(0 != mX.remove(h3));
+
+            Item item;
+            ASSERT(0 == mX.remove(h3, KEY, &newLength, &minTime, &item));
+            ASSERT(2                     == newLength);
+            ASSERT(bsls::TimeInterval(5) == minTime);
+            ASSERT(bsls::TimeInterval(3) == item.time());
+            ASSERT(3                     == item.data());
+            ASSERT(h3                    == item.handle());
+            ASSERT(KEY                   == item.key());
+            ASSERT(!X.isRegisteredHandle(h3, KEY));
+            ASSERT(0 != mX.remove(h3, KEY));
+
+            ASSERT(0 == mX.remove(h1, &newLength, &minTime));
+            ASSERT(1                     == newLength);
+            ASSERT(bsls::TimeInterval(7) == minTime);
+
+            // The node of 'h1' is reused, with a new handle.
+
+            const Obj::Handle h4 = mX.add(bsls::TimeInterval(1), 4);
+            ASSERT(h4 != h1);
+            ASSERT(!X.isRegisteredHandle(h1));
+            ASSERT( X.isRegisteredHandle(h4));
+            ASSERT(0 != mX.remove(h1));
+            ASSERT(2 == X.length());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        {
+            Obj mX(ONE_MS, 8, &oa);
+
+            int numAdded = 0;
+            while (-1 != mX.add(bsls::TimeInterval(numAdded), numAdded)) {
+                ++numAdded;
+                ASSERTV(numAdded, numAdded < 256);
+                if (numAdded >= 256) {
+                    break;
+                }
+            }
+            ASSERTV(numAdded, 254 == numAdded);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, add items, and retrieve them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(ONE_MS, &oa);  const Obj& X = mX;
+
+            mX.add(bsls::TimeInterval(3), 3);
+            mX.add(bsls::TimeInterval(1), 1);
+            const Obj::Handle h = mX.add(bsls::TimeInterval(2), 2);
+            mX.add(bsls::TimeInterval(600), 4);
+            ASSERT(4 == X.length());
+            ASSERT(0 == mX.remove(h));
+
+            bsl::vector<Item> buffer(&oa);
+            mX.popLE(bsls::TimeInterval(10), &buffer);
+            ASSERT(2 == buffer.size());
+            ASSERT(1 == buffer[0].data());
+            ASSERT(3 == buffer[1].data());
+            ASSERT(1 == X.length());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SCHEDULE AND CANCEL
+        //   Compare the time taken by 'bdlcc::TimingWheel' and
+        //   'bdlcc::TimeQueue' to add timers and cancel nearly all of them
+        //   before they expire, as for I/O timeouts.  Command line parameters:
+        //   2nd parameter: number of pending timers (defaults to 100000).
+        //   3rd parameter: number of operations (defaults to 2000000).
+        //
+        // Concerns:
+        //: 1 Adding and cancelling timers is faster with a timing wheel.
+        //
+        // Plan:
+        //: 1 Keep a fixed number of timers pending, at times randomly spread
+        //:   over 30 seconds after an advancing current time; repeatedly
+        //:   cancel a random timer and add a new one, retrieving the expired
+        //:   timers every millisecond of simulated time.  Print the results as
+        //:   CSV.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: schedule and cancel vs 'bdlcc::TimeQueue'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: SCHEDULE AND CANCEL" << endl
+                          << "================================" << endl;
+
+        const int numPending    = argc > 2 ? atoi(argv[2]) :  100000;
+        const int numOperations = argc > 3 ? atoi(argv[3]) : 2000000;
+
+        bslma::NewDeleteAllocator nalloc;
+
+        bsl::cout << "Queue,Pending,Operations,Seconds\n";
+        for (int pass = 0; pass < 2; ++pass) {
+            Obj    wheel(ONE_MS, 24, &nalloc);
+            Oracle queue(24, &nalloc);
+
+            bsl::vector<int>  handles(numPending, 0, &nalloc);
+            bsl::vector<Item> expired(&nalloc);
+            Random            random(1);
+            Int64             now = 1000LL * 1000 * 1000 * 1000;
+
+            bsls::Stopwatch stopwatch;
+            stopwatch.start();
+            for (int i = 0; i < numPending + numOperations; ++i) {
+                const int j = i % numPending;
+
+                bsls::TimeInterval time;
+                time.setTotalNanoseconds(now + random(30LL * 1000 * 1000
+                                                                   * 1000));
+                if (0 == pass) {
+                    if (i >= numPending) {
+                        wheel.remove(handles[j]);
+                    }
+                    handles[j] = wheel.add(time, i);
+                }
+                else {
+                    if (i >= numPending) {
+                        queue.remove(handles[j]);
+                    }
+                    handles[j] = queue.add(time, i);
+                }
+
+                if (0 == i % 100) {
+                    now += 1000 * 1000;
+                    time.setTotalNanoseconds(now);
+                    expired.clear();
+                    if (0 == pass) {
+                        wheel.popLE(time, &expired);
+                    }
+                    else {
+                        queue.popLE(time, &expired);
+                    }
+                }
+            }
+            stopwatch.stop();
+
+            bsl::cout << (0 == pass ? "TimingWheel" : "TimeQueue") << ","
+                      << numPending << "," << numOperations << ","
+                      << bsl::fixed << bsl::setprecision(3)
+                      << stopwatch.elapsedTime() << "\n";
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
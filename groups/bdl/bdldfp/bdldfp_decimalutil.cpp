@@ -8,12 +8,15 @@ BSLS_IDENT_RCSID(bdldfp_decimalutil_cpp,"$Id$ $CSID$")
 #include <bdldfp_decimalimputil.h>
 
 #include <bsls_assert.h>
+#include <bsls_types.h>
 #include <bslmf_assert.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_c_errno.h>
 #include <bsl_cmath.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>
+#include <bsl_limits.h>
 #include <errno.h>
 #include <math.h>  // For the  FP_* macros
 
@@ -64,6 +67,374 @@ bool isNanString(const char *str) {
             (str[2] | ' ') == 'n');
 }
 
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+                            // BID64 encoding
+
+const Uint64 k_SIGN_MASK             = 0x8000000000000000ull;
+const Uint64 k_LONG_ENCODING_MASK    = 0x6000000000000000ull;
+const Uint64 k_SPECIAL_MASK          = 0x7800000000000000ull;
+const Uint64 k_SHORT_COEFF_MASK      = 0x001fffffffffffffull;
+const Uint64 k_LONG_COEFF_MASK       = 0x0007ffffffffffffull;
+const Uint64 k_LONG_COEFF_HIGH_BITS  = 0x0020000000000000ull;
+const Uint64 k_EXPONENT_MASK         = 0x3ff;
+const int    k_SHORT_EXPONENT_SHIFT  = 53;
+const int    k_LONG_EXPONENT_SHIFT   = 51;
+const int    k_EXPONENT_BIAS         = 398;
+const int    k_MIN_EXPONENT          = -398;
+const int    k_MAX_EXPONENT          = 369;
+const Int64  k_MAX_COEFFICIENT       = 9999999999999999ll;
+const Uint64 k_MAX_EXACT_FACTOR      = 0xffffffffull;
+const int    k_MAX_DIGITS            = 16;
+
+inline
+Uint64 rawBits(Decimal64 value)
+    // Return the BID encoding of the specified 'value'.
+{
+    return value.value().d_raw;
+}
+
+inline
+bool decodeShort(Uint64 *coefficient, int *exponent, Uint64 bits)
+    // If the specified 'bits' encode a finite value whose coefficient is
+    // stored in the 53 low-order bits (i.e., is less than 2 to the 53rd),
+    // load its coefficient and exponent into the specified 'coefficient' and
+    // 'exponent', and return 'true'; otherwise, return 'false'.
+{
+    if (k_LONG_ENCODING_MASK == (bits & k_LONG_ENCODING_MASK)) {
+        return false;                                                 // RETURN
+    }
+    *coefficient = bits & k_SHORT_COEFF_MASK;
+    *exponent    = static_cast<int>((bits >> k_SHORT_EXPONENT_SHIFT)
+                                                           & k_EXPONENT_MASK)
+                 - k_EXPONENT_BIAS;
+    return true;
+}
+
+inline
+bool decode(Uint64 *coefficient, int *exponent, Uint64 bits)
+    // If the specified 'bits' encode a finite value having a canonical
+    // coefficient, load its coefficient and exponent into the specified
+    // 'coefficient' and 'exponent', and return 'true'; otherwise, return
+    // 'false'.
+{
+    if (decodeShort(coefficient, exponent, bits)) {
+        return true;                                                  // RETURN
+    }
+    if (k_SPECIAL_MASK == (bits & k_SPECIAL_MASK)) {
+        return false;                                                 // RETURN
+    }
+    *coefficient = (bits & k_LONG_COEFF_MASK) | k_LONG_COEFF_HIGH_BITS;
+    *exponent    = static_cast<int>((bits >> k_LONG_EXPONENT_SHIFT)
+                                                           & k_EXPONENT_MASK)
+                 - k_EXPONENT_BIAS;
+    return *coefficient <= static_cast<Uint64>(k_MAX_COEFFICIENT);
+}
+
+inline
+Decimal64 encode(Uint64 coefficient, int exponent, bool isNegative)
+    // Return the 'Decimal64' having the specified 'coefficient' and
+    // 'exponent', and having the sign bit set if the specified 'isNegative'
+    // is 'true'.  The behavior is undefined unless
+    // 'coefficient <= 9999999999999999' and '-398 <= exponent <= 369'.
+{
+    const Uint64 biasedExponent = exponent + k_EXPONENT_BIAS;
+
+    DecimalImpUtil::ValueType64 result;
+    if (coefficient <= k_SHORT_COEFF_MASK) {
+        result.d_raw = (biasedExponent << k_SHORT_EXPONENT_SHIFT)
+                     | coefficient;
+    }
+    else {
+        result.d_raw = k_LONG_ENCODING_MASK
+                     | (biasedExponent << k_LONG_EXPONENT_SHIFT)
+                     | (coefficient & k_LONG_COEFF_MASK);
+    }
+    if (isNegative) {
+        result.d_raw |= k_SIGN_MASK;
+    }
+    return Decimal64(result);
+}
+
+inline
+bool multiplyExactly(Uint64 *coefficient,
+                     int    *exponent,
+                     Uint64  xCoefficient,
+                     int     xExponent,
+                     Uint64  yCoefficient,
+                     int     yExponent)
+    // If the product of the value having the specified 'xCoefficient' and
+    // 'xExponent' and the value having the specified 'yCoefficient' and
+    // 'yExponent' is exactly representable with the exponent
+    // 'xExponent + yExponent', and both coefficients are less than 2 to the
+    // 32nd, load the coefficient and exponent of the product into the
+    // specified 'coefficient' and 'exponent', and return 'true'; otherwise,
+    // return 'false'.
+{
+    if (xCoefficient > k_MAX_EXACT_FACTOR
+     || yCoefficient > k_MAX_EXACT_FACTOR) {
+        return false;                                                 // RETURN
+    }
+    *coefficient = xCoefficient * yCoefficient;
+    *exponent    = xExponent + yExponent;
+    return *coefficient <= static_cast<Uint64>(k_MAX_COEFFICIENT)
+        && k_MIN_EXPONENT <= *exponent
+        && *exponent <= k_MAX_EXPONENT;
+}
+
+                            // =================
+                            // class Accumulator
+                            // =================
+
+class Accumulator {
+    // This class accumulates a sum of 'Decimal64' values, having the value of
+    // adding each term, in order, to the first.  Terms having the exponent of
+    // the sum are added to an integer coefficient as long as it has at most
+    // 16 digits; other terms are added by the decimal floating-point library.
+
+    // DATA
+    Decimal64 d_sum;           // sum, unless 'd_isInteger'
+
+    Int64     d_coefficient;   // signed coefficient of the sum, if
+                               // 'd_isInteger'
+
+    int       d_exponent;      // exponent of the sum, if 'd_isInteger'
+
+    bool      d_isNegZero;     // 'true' if the sum is negative zero
+
+    bool      d_isInteger;     // 'true' if the sum is held in
+                               // 'd_coefficient' and 'd_exponent'
+
+    // PRIVATE MANIPULATORS
+    void load();
+        // Load 'd_sum' into the integer representation if it is a finite
+        // value whose coefficient is less than 2 to the 53rd.
+
+  public:
+    // CREATORS
+    explicit Accumulator(Decimal64 first);
+        // Create an accumulator having the specified 'first' term.
+
+    // MANIPULATORS
+    void add(Decimal64 term);
+        // Add the specified 'term' to the sum.
+
+    void add(Uint64 coefficient, int exponent, bool isNegative);
+        // Add, to the sum, the term having the specified 'coefficient' and
+        // 'exponent' and the sign indicated by the specified 'isNegative'.
+        // The behavior is undefined unless 'coefficient <= 9999999999999999'
+        // and '-398 <= exponent <= 369'.
+
+    // ACCESSORS
+    Decimal64 value() const;
+        // Return the sum.
+};
+
+                            // -----------------
+                            // class Accumulator
+                            // -----------------
+
+// PRIVATE MANIPULATORS
+inline
+void Accumulator::load()
+{
+    const Uint64 bits = rawBits(d_sum);
+
+    Uint64 coefficient;
+    d_isInteger = decodeShort(&coefficient, &d_exponent, bits);
+    if (d_isInteger) {
+        const bool isNegative = bits & k_SIGN_MASK;
+
+        d_coefficient = isNegative ? -static_cast<Int64>(coefficient)
+                                   :  static_cast<Int64>(coefficient);
+        d_isNegZero   = isNegative && 0 == coefficient;
+    }
+}
+
+// CREATORS
+inline
+Accumulator::Accumulator(Decimal64 first)
+: d_sum(first)
+, d_coefficient(0)
+, d_exponent(0)
+, d_isNegZero(false)
+, d_isInteger(false)
+{
+    load();
+}
+
+// MANIPULATORS
+inline
+void Accumulator::add(Decimal64 term)
+{
+    d_sum = value() + term;
+    load();
+}
+
+inline
+void Accumulator::add(Uint64 coefficient, int exponent, bool isNegative)
+{
+    if (d_isInteger && exponent == d_exponent) {
+        const Int64 sum = d_coefficient
+                        + (isNegative ? -static_cast<Int64>(coefficient)
+                                      :  static_cast<Int64>(coefficient));
+
+        if (-k_MAX_COEFFICIENT <= sum && sum <= k_MAX_COEFFICIENT) {
+            // The exact sum is representable, and its sign, if it is zero,
+            // is negative only if both terms are negative zeros.
+
+            d_coefficient = sum;
+            d_isNegZero   = d_isNegZero && isNegative && 0 == coefficient;
+            return;                                                   // RETURN
+        }
+    }
+    add(encode(coefficient, exponent, isNegative));
+}
+
+// ACCESSORS
+inline
+Decimal64 Accumulator::value() const
+{
+    if (!d_isInteger) {
+        return d_sum;                                                 // RETURN
+    }
+    return d_coefficient < 0
+           ? encode(-d_coefficient, d_exponent, true)
+           : encode( d_coefficient, d_exponent, d_isNegZero);
+}
+
+struct Less {
+    // This 'struct' defines the ordering searched by 'indexOfMin'.
+
+    template <class TYPE>
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+};
+
+struct Greater {
+    // This 'struct' defines the ordering searched by 'indexOfMax'.
+
+    template <class TYPE>
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' is greater than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs > rhs;
+    }
+};
+
+template <class ORDER>
+int indexOfFirst(const Decimal64 *values, int numValues, ORDER order)
+    // Return the index of the first of the specified 'numValues' elements of
+    // the specified 'values' array that no other non-NaN element precedes in
+    // the specified 'order', or -1 if every element is NaN.  Elements having
+    // the exponent of the current candidate are compared by coefficient.
+{
+    int index = 0;
+    while (index < numValues && DecimalUtil::isNan(values[index])) {
+        ++index;
+    }
+    if (index == numValues) {
+        return -1;                                                    // RETURN
+    }
+
+    Uint64 bits        = rawBits(values[index]);
+    Uint64 coefficient = 0;
+    int    exponent    = 0;
+    bool   isDecoded   = decodeShort(&coefficient, &exponent, bits);
+    Int64  candidate   = bits & k_SIGN_MASK ? -static_cast<Int64>(coefficient)
+                                          :  static_cast<Int64>(coefficient);
+
+    for (int i = index + 1; i < numValues; ++i) {
+        const Uint64 iBits = rawBits(values[i]);
+        Uint64       iCoefficient;
+        int          iExponent;
+
+        bool precedes;
+        if (isDecoded
+         && decodeShort(&iCoefficient, &iExponent, iBits)
+         && iExponent == exponent) {
+            const Int64 value = iBits & k_SIGN_MASK
+                                ? -static_cast<Int64>(iCoefficient)
+                                :  static_cast<Int64>(iCoefficient);
+
+            precedes = order(value, candidate);
+        }
+        else {
+            precedes = order(values[i], values[index]);
+        }
+
+        if (precedes) {
+            index     = i;
+            isDecoded = decodeShort(&coefficient, &exponent, iBits);
+            candidate = iBits & k_SIGN_MASK
+                        ? -static_cast<Int64>(coefficient)
+                        :  static_cast<Int64>(coefficient);
+        }
+    }
+    return index;
+}
+
+                            // Text conversion
+
+const int k_MAX_TEXT_LENGTH = 24;  // longest text written by 'to_chars'
+
+const char k_DIGIT_PAIRS[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+inline
+int writeDigits(char *end, Uint64 value)
+    // Write the decimal digits of the specified 'value' into the characters
+    // preceding the specified 'end', and return the number of digits written.
+{
+    char *p = end;
+    while (value >= 100) {
+        const unsigned pair = static_cast<unsigned>(value % 100) * 2;
+        value /= 100;
+        *--p = k_DIGIT_PAIRS[pair + 1];
+        *--p = k_DIGIT_PAIRS[pair];
+    }
+    if (value >= 10) {
+        const unsigned pair = static_cast<unsigned>(value) * 2;
+        *--p = k_DIGIT_PAIRS[pair + 1];
+        *--p = k_DIGIT_PAIRS[pair];
+    }
+    else {
+        *--p = static_cast<char>('0' + value);
+    }
+    return static_cast<int>(end - p);
+}
+
+inline
+bool isDigit(char character)
+    // Return 'true' if the specified 'character' is a decimal digit, and
+    // 'false' otherwise.
+{
+    return static_cast<unsigned>(character - '0') < 10;
+}
+
+const char *matchWord(const char *first, const char *last, const char *word)
+    // Return the end of the prefix of the range specified by
+    // '[ first .. last )' that matches the specified lower-case 'word'
+    // without regard to case, or 0 if there is no such prefix.
+{
+    for (; *word; ++word, ++first) {
+        if (first == last || (*first | ' ') != *word) {
+            return 0;                                                 // RETURN
+        }
+    }
+    return first;
+}
+
 }  // close unnamed namespace
 
 
@@ -372,6 +743,422 @@ Decimal128 DecimalUtil::trunc(Decimal128 x, unsigned int precision)
     return x;
 }
 
+                         // Aggregation functions
+
+Decimal64 DecimalUtil::sum(const Decimal64 *values, int numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    if (0 == numValues) {
+        return Decimal64();                                           // RETURN
+    }
+
+    Accumulator result(values[0]);
+    for (int i = 1; i < numValues; ++i) {
+        const Uint64 bits = rawBits(values[i]);
+        Uint64       coefficient;
+        int          exponent;
+
+        if (decodeShort(&coefficient, &exponent, bits)) {
+            result.add(coefficient, exponent, bits & k_SIGN_MASK);
+        }
+        else {
+            result.add(values[i]);
+        }
+    }
+    return result.value();
+}
+
+Decimal64 DecimalUtil::dotProduct(const Decimal64 *x,
+                                  const Decimal64 *y,
+                                  int              numValues)
+{
+    BSLS_ASSERT(x || 0 == numValues);
+    BSLS_ASSERT(y || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    if (0 == numValues) {
+        return Decimal64();                                           // RETURN
+    }
+
+    Accumulator result(x[0] * y[0]);
+    for (int i = 1; i < numValues; ++i) {
+        const Uint64 xBits = rawBits(x[i]);
+        const Uint64 yBits = rawBits(y[i]);
+        Uint64       xCoefficient, yCoefficient, coefficient;
+        int          xExponent,    yExponent,    exponent;
+
+        if (decodeShort(&xCoefficient, &xExponent, xBits)
+         && decodeShort(&yCoefficient, &yExponent, yBits)
+         && multiplyExactly(&coefficient,
+                            &exponent,
+                            xCoefficient,
+                            xExponent,
+                            yCoefficient,
+                            yExponent)) {
+            result.add(coefficient,
+                       exponent,
+                       (xBits ^ yBits) & k_SIGN_MASK);
+        }
+        else {
+            result.add(x[i] * y[i]);
+        }
+    }
+    return result.value();
+}
+
+void DecimalUtil::scale(Decimal64       *result,
+                        const Decimal64 *values,
+                        int              numValues,
+                        Decimal64        factor)
+{
+    BSLS_ASSERT(result || 0 == numValues);
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    const Uint64 fBits = rawBits(factor);
+    Uint64       fCoefficient;
+    int          fExponent;
+
+    if (!decodeShort(&fCoefficient, &fExponent, fBits)) {
+        for (int i = 0; i < numValues; ++i) {
+            result[i] = values[i] * factor;
+        }
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < numValues; ++i) {
+        const Uint64 bits = rawBits(values[i]);
+        Uint64       vCoefficient, coefficient;
+        int          vExponent,    exponent;
+
+        if (decodeShort(&vCoefficient, &vExponent, bits)
+         && multiplyExactly(&coefficient,
+                            &exponent,
+                            vCoefficient,
+                            vExponent,
+                            fCoefficient,
+                            fExponent)) {
+            result[i] = encode(coefficient,
+                               exponent,
+                               (bits ^ fBits) & k_SIGN_MASK);
+        }
+        else {
+            result[i] = values[i] * factor;
+        }
+    }
+}
+
+int DecimalUtil::indexOfMin(const Decimal64 *values, int numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    return indexOfFirst(values, numValues, Less());
+}
+
+int DecimalUtil::indexOfMax(const Decimal64 *values, int numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    return indexOfFirst(values, numValues, Greater());
+}
+
+// FREE FUNCTIONS
+bsl::to_chars_result to_chars(char *first, char *last, Decimal64 value)
+{
+    BSLS_ASSERT(first <= last);
+
+    const Uint64 bits = rawBits(value);
+    Uint64       coefficient;
+    int          exponent;
+
+    if (!decode(&coefficient, &exponent, bits)
+     && k_SPECIAL_MASK == (bits & k_SPECIAL_MASK)) {
+        // Infinities and NaNs are written by 'format'.
+
+        char      buffer[2 * k_MAX_TEXT_LENGTH];
+        const int length = DecimalUtil::format(buffer, sizeof buffer, value);
+
+        BSLS_ASSERT(length <= static_cast<int>(sizeof buffer));
+
+        if (last - first < length) {
+            const bsl::to_chars_result ret = { last,
+                                               bsl::errc::value_too_large };
+            return ret;                                               // RETURN
+        }
+        const bsl::to_chars_result ret = { bsl::copy(buffer,
+                                                     buffer + length,
+                                                     first),
+                                           bsl::ErrcEnum() };
+        return ret;                                                   // RETURN
+    }
+
+    if (coefficient > static_cast<Uint64>(k_MAX_COEFFICIENT)) {
+        // A non-canonical coefficient denotes zero.
+
+        coefficient = 0;
+    }
+
+    char        digits[k_MAX_DIGITS];
+    const int   numDigits   = writeDigits(digits + k_MAX_DIGITS, coefficient);
+    const char *digitsEnd   = digits + k_MAX_DIGITS;
+    const char *digitsBegin = digitsEnd - numDigits;
+    const bool  isNegative  = bits & k_SIGN_MASK;
+    const int   adjusted    = exponent + numDigits - 1;
+
+    if (exponent <= 0 && -6 <= adjusted) {
+        // fixed notation, having '-exponent' fraction digits
+
+        const int numFractionDigits = -exponent;
+        const int numIntegerDigits  = bsl::max(numDigits - numFractionDigits,
+                                               1);
+        const int length = isNegative
+                         + numIntegerDigits
+                         + (numFractionDigits ? 1 + numFractionDigits : 0);
+
+        if (last - first < length) {
+            const bsl::to_chars_result ret = { last,
+                                               bsl::errc::value_too_large };
+            return ret;                                               // RETURN
+        }
+
+        char *p = first;
+        if (isNegative) {
+            *p++ = '-';
+        }
+        if (numDigits > numFractionDigits) {
+            p = bsl::copy(digitsBegin,
+                          digitsBegin + numIntegerDigits,
+                          p);
+            digitsBegin += numIntegerDigits;
+        }
+        else {
+            *p++ = '0';
+        }
+        if (numFractionDigits) {
+            *p++ = '.';
+            const int numZeros = numFractionDigits
+                               - static_cast<int>(digitsEnd - digitsBegin);
+            p = bsl::fill_n(p, numZeros, '0');
+            p = bsl::copy(digitsBegin, digitsEnd, p);
+        }
+
+        const bsl::to_chars_result ret = { p, bsl::ErrcEnum() };
+        return ret;                                                   // RETURN
+    }
+
+    // scientific notation, having at least two exponent digits
+
+    const int absAdjusted       = adjusted < 0 ? -adjusted : adjusted;
+    const int numExponentDigits = absAdjusted < 100 ? 2 : 3;
+    const int length = isNegative
+                     + numDigits + (numDigits > 1)
+                     + 2 + numExponentDigits;
+
+    if (last - first < length) {
+        const bsl::to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    char *p = first;
+    if (isNegative) {
+        *p++ = '-';
+    }
+    *p++ = *digitsBegin++;
+    if (numDigits > 1) {
+        *p++ = '.';
+        p = bsl::copy(digitsBegin, digitsEnd, p);
+    }
+    *p++ = 'e';
+    *p++ = adjusted < 0 ? '-' : '+';
+
+    p += numExponentDigits;
+    writeDigits(p, absAdjusted);
+    if (absAdjusted < 10) {
+        p[-2] = '0';
+    }
+
+    const bsl::to_chars_result ret = { p, bsl::ErrcEnum() };
+    return ret;
+}
+
+bsl::from_chars_result from_chars(const char *first,
+                                  const char *last,
+                                  Decimal64&  value)
+{
+    BSLS_ASSERT(first <= last);
+
+    const char *p          = first;
+    const bool  isNegative = p != last && '-' == *p;
+
+    if (isNegative) {
+        ++p;
+    }
+
+    if (p != last && !isDigit(*p) && '.' != *p) {
+        typedef bsl::numeric_limits<Decimal64> Limits;
+
+        const char *end;
+        Decimal64   special;
+
+        if (0 != (end = matchWord(p, last, "infinity"))
+         || 0 != (end = matchWord(p, last, "inf"))) {
+            special = Limits::infinity();
+        }
+        else if (0 != (end = matchWord(p, last, "nan"))) {
+            special = Limits::quiet_NaN();
+        }
+        else if (0 != (end = matchWord(p, last, "snan"))) {
+            special = Limits::signaling_NaN();
+        }
+        else {
+            const bsl::from_chars_result ret = { first,
+                                                 bsl::errc::invalid_argument };
+            return ret;                                               // RETURN
+        }
+
+        value = isNegative ? -special : special;
+
+        const bsl::from_chars_result ret = { end, bsl::ErrcEnum() };
+        return ret;                                                   // RETURN
+    }
+
+    // Keep the first 17 significant digits, which, with whether any later
+    // digit is not zero, determine the rounding of the number.
+
+    const int k_NUM_KEPT_DIGITS = k_MAX_DIGITS + 1;
+
+    char   kept[k_NUM_KEPT_DIGITS];
+    Uint64 coefficient       = 0;
+    Int64  numDigits         = 0;      // significant digits
+    Int64  numFractionDigits = 0;
+    bool   hasDigit          = false;
+    bool   isSticky          = false;  // a non-zero digit was not kept
+
+    for (int inFraction = 0; inFraction < 2; ++inFraction) {
+        if (inFraction) {
+            if (p == last || '.' != *p) {
+                break;
+            }
+            ++p;
+        }
+        for (; p != last && isDigit(*p); ++p) {
+            hasDigit           = true;
+            numFractionDigits += inFraction;
+
+            if (0 == numDigits && '0' == *p) {
+                continue;
+            }
+            if (numDigits < k_NUM_KEPT_DIGITS) {
+                kept[numDigits] = *p;
+                coefficient     = coefficient * 10 + (*p - '0');
+            }
+            else {
+                isSticky = isSticky || '0' != *p;
+            }
+            ++numDigits;
+        }
+    }
+
+    if (!hasDigit) {
+        const bsl::from_chars_result ret = { first,
+                                             bsl::errc::invalid_argument };
+        return ret;                                                   // RETURN
+    }
+
+    const Int64 k_EXPONENT_LIMIT = 100000000;
+    Int64       exponent         = 0;
+
+    if (p != last && 'e' == (*p | ' ')) {
+        const char *q = p + 1;
+        const bool  isExponentNegative = q != last && '-' == *q;
+
+        if (q != last && ('-' == *q || '+' == *q)) {
+            ++q;
+        }
+        if (q != last && isDigit(*q)) {
+            for (; q != last && isDigit(*q); ++q) {
+                if (exponent < k_EXPONENT_LIMIT) {
+                    exponent = exponent * 10 + (*q - '0');
+                }
+            }
+            if (isExponentNegative) {
+                exponent = -exponent;
+            }
+            p = q;
+        }
+    }
+
+    exponent -= numFractionDigits;  // exponent of the last digit
+
+    if (numDigits <= k_MAX_DIGITS
+     && k_MIN_EXPONENT <= exponent
+     && exponent <= k_MAX_EXPONENT) {
+        value = encode(coefficient, static_cast<int>(exponent), isNegative);
+
+        const bsl::from_chars_result ret = { p, bsl::ErrcEnum() };
+        return ret;                                                   // RETURN
+    }
+
+    // Round by the decimal floating-point library, from the kept digits,
+    // followed by a '1' if a later digit is not zero.
+
+    char  text[k_NUM_KEPT_DIGITS + 16];
+    char *t = text;
+
+    if (isNegative) {
+        *t++ = '-';
+    }
+    if (0 == numDigits) {
+        *t++ = '0';
+    }
+    else {
+        const int numKept = numDigits < k_NUM_KEPT_DIGITS
+                          ? static_cast<int>(numDigits)
+                          : k_NUM_KEPT_DIGITS;
+
+        t = bsl::copy(kept, kept + numKept, t);
+        exponent += numDigits - numKept;
+        if (isSticky) {
+            *t++ = '1';
+            --exponent;
+        }
+    }
+    exponent = bsl::max(bsl::min(exponent, k_EXPONENT_LIMIT),
+                        -k_EXPONENT_LIMIT);
+
+    char      exponentDigits[10];
+    char     *exponentEnd       = exponentDigits + sizeof exponentDigits;
+    const int numExponentDigits = writeDigits(exponentEnd,
+                                              exponent < 0 ? -exponent
+                                                           :  exponent);
+    *t++ = 'e';
+    if (exponent < 0) {
+        *t++ = '-';
+    }
+    t  = bsl::copy(exponentEnd - numExponentDigits, exponentEnd, t);
+    *t = '\0';
+
+    const int       savedErrno = errno;
+    const Decimal64 result     = DecimalImpUtil::parse64(text);
+    errno = savedErrno;
+
+    if (DecimalUtil::isInf(result)
+     || (0 != numDigits && Decimal64() == result)) {
+        const bsl::from_chars_result ret = { p,
+                                             bsl::errc::result_out_of_range };
+        return ret;                                                   // RETURN
+    }
+
+    value = result;
+
+    const bsl::from_chars_result ret = { p, bsl::ErrcEnum() };
+    return ret;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
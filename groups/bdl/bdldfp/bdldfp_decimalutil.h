@@ -10,6 +10,10 @@ BSLS_IDENT("$Id$")
 //@CLASSES:
 //  bdldfp::DecimalUtil: decimal floating point utility functions.
 //
+//@FUNCTIONS:
+//  bdldfp::to_chars: write a 'Decimal64' into a character buffer
+//  bdldfp::from_chars: parse a 'Decimal64' from a range of characters
+//
 //@MACROS:
 //  FP_SUBNORMAL: subnormal floating-point classification identifier constant
 //  FP_NORMAL:    normal floating-point classification identifier constant
@@ -36,10 +40,48 @@ BSLS_IDENT("$Id$")
 //: o 'fma', 'fabs', 'ceil', 'floor', 'trunc', 'round' - math functions
 //:
 //: o 'classify' and the 'isXxxx' floating-point value classification functions
+//:
+//: o 'sum', 'dotProduct', 'scale', 'indexOfMin', and 'indexOfMax' - functions
+//:   aggregating arrays of 'Decimal64' values
+//:
+//: o the free functions 'to_chars' and 'from_chars' converting 'Decimal64'
+//:   values to and from text without streams or memory allocation
 //
 // The 'FP_XXX' C99 floating-point classification macros may also be provided
 // by this header for platforms where C99 support is still not provided.
 //
+///Aggregating Arrays of 'Decimal64'
+///---------------------------------
+// The aggregation functions return, bit for bit, the value of the equivalent
+// loop of 'Decimal64' operations (e.g., 'sum' returns the value of adding the
+// elements of an array, in order, to its first element), but avoid calling the
+// decimal floating-point library for each element whenever they can.  As long
+// as consecutive elements have the same exponent and their coefficients are
+// encoded directly in the low-order bits of the BID representation (i.e., are
+// less than 2 to the 53rd), 'sum' and 'dotProduct' accumulate coefficients in
+// a 64-bit integer, which is exact until the accumulated coefficient reaches
+// 16 digits.  Similarly, 'scale' multiplies coefficients directly whenever the
+// product is exact, and 'indexOfMin' and 'indexOfMax' compare coefficients of
+// elements having the same exponent.  Any other element (e.g., a NaN, or an
+// element having a different exponent) is processed by the library, after
+// which the integer accumulation resumes.  These functions therefore run
+// fastest on arrays of values of the same quantum, such as amounts of a
+// currency.  Note that the results are those of the default rounding mode
+// (round-half-even).
+//
+///Converting To and From Text
+///---------------------------
+// 'bdldfp::to_chars' writes a 'Decimal64' in the notation of
+// 'DecimalUtil::format' having the 'e_NATURAL' style (i.e., showing the
+// quantum of the value, in fixed notation unless its exponent is positive or
+// it is small), and 'bdldfp::from_chars' parses that notation, preserving the
+// quantum of the number parsed, so that a value written by 'to_chars' reads
+// back as the same representation.  Both functions operate on a range of
+// characters that need not be null-terminated, neither allocates memory, and
+// both decode and encode the BID representation directly except for special
+// values and numbers having more than 16 significant digits or an exponent
+// out of range, which are handled by the decimal floating-point library.
+//
 ///Usage
 ///-----
 // This section shows the intended use of this component.
@@ -61,6 +103,41 @@ BSLS_IDENT("$Id$")
 //  assert(BDLDFP_DECIMAL_DD(4.2) == d64);
 //  assert(BDLDFP_DECIMAL_DL(4.2) == d128);
 //..
+//
+///Example 2: Aggregating Positions
+///- - - - - - - - - - - - - - - -
+// Suppose that we hold long positions in two securities and a short position
+// in a third, and want to compute their total market value, and to write it
+// into a buffer.
+//
+// First, we define the quantities and prices of the positions:
+//..
+//  const bdldfp::Decimal64 quantities[] = { bdldfp::Decimal64(100),
+//                                           bdldfp::Decimal64(250),
+//                                           bdldfp::Decimal64(-4) };
+//  const bdldfp::Decimal64 prices[]     = { BDLDFP_DECIMAL_DD(12.25),
+//                                           BDLDFP_DECIMAL_DD(3.10),
+//                                           BDLDFP_DECIMAL_DD(99.99) };
+//..
+// Then, we compute the market value of the portfolio as the dot product of
+// the quantities and prices:
+//..
+//  bdldfp::Decimal64 value = bdldfp::DecimalUtil::dotProduct(quantities,
+//                                                            prices,
+//                                                            3);
+//  assert(BDLDFP_DECIMAL_DD(1600.04) == value);
+//..
+// Finally, we write the value, which has the quantum of the prices, into a
+// buffer:
+//..
+//  char                 buffer[32];
+//  bsl::to_chars_result result = bdldfp::to_chars(buffer,
+//                                                 buffer + sizeof buffer,
+//                                                 value);
+//
+//  assert(bsl::ErrcEnum() == result.ec);
+//  assert("1600.04" == bsl::string(buffer, result.ptr));
+//..
 
 // TODO TBD Priority description:
 //
@@ -81,6 +158,7 @@ BSLS_IDENT("$Id$")
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
+#include <bsl_charconv.h>
 #include <bsl_string.h>
 
 namespace BloombergLP {
@@ -696,8 +774,85 @@ struct DecimalUtil {
         // 'e_NATURAL' then all significand digits of the 'value' are output in
         // the buffer regardless of the value specified in configuration's
         // 'precision' attribute.
+
+                         // Aggregation functions
+
+    static Decimal64 sum(const Decimal64 *values, int numValues);
+        // Return the sum of the specified 'numValues' elements of the
+        // specified 'values' array, i.e., the result of adding, in order, each
+        // element after the first to the first element, or positive zero if
+        // 'numValues' is 0.  The behavior is undefined unless
+        // '0 <= numValues', and 'values' refers to an array having at least
+        // 'numValues' elements.  Note that 'values' may be 0 if 'numValues' is
+        // 0.
+
+    static Decimal64 dotProduct(const Decimal64 *x,
+                                const Decimal64 *y,
+                                int              numValues);
+        // Return the sum of the products of the corresponding elements of the
+        // specified 'x' and 'y' arrays having the specified 'numValues'
+        // elements each, i.e., the result of adding, in order, each product
+        // 'x[i] * y[i]' after the first to 'x[0] * y[0]', or positive zero if
+        // 'numValues' is 0.  The behavior is undefined unless
+        // '0 <= numValues', and 'x' and 'y' refer to arrays having at least
+        // 'numValues' elements.  Note that 'x' and 'y' may be 0 if 'numValues'
+        // is 0.
+
+    static void scale(Decimal64       *result,
+                      const Decimal64 *values,
+                      int              numValues,
+                      Decimal64        factor);
+        // Load, into each of the specified 'numValues' elements of the
+        // specified 'result' array, the product of the corresponding element
+        // of the specified 'values' array and the specified 'factor'.  The
+        // behavior is undefined unless '0 <= numValues', 'result' and 'values'
+        // refer to arrays having at least 'numValues' elements, and 'result'
+        // is either 'values' or an array not overlapping 'values'.  Note that
+        // 'result' and 'values' may be 0 if 'numValues' is 0.
+
+    static int indexOfMin(const Decimal64 *values, int numValues);
+    static int indexOfMax(const Decimal64 *values, int numValues);
+        // Return the index of the first of the specified 'numValues' elements
+        // of the specified 'values' array that no other element compares less
+        // than (for 'indexOfMin') or greater than (for 'indexOfMax'), ignoring
+        // NaN elements, or -1 if 'numValues' is 0 or every element is NaN.
+        // The behavior is undefined unless '0 <= numValues', and 'values'
+        // refers to an array having at least 'numValues' elements.  Note that
+        // 'values' may be 0 if 'numValues' is 0.
 };
 
+// FREE FUNCTIONS
+bsl::to_chars_result to_chars(char *first, char *last, Decimal64 value);
+    // Write the specified 'value' into the character buffer starting at the
+    // specified 'first' and ending at the specified 'last', as
+    // 'DecimalUtil::format' does with a configuration having the 'e_NATURAL'
+    // style and otherwise default attributes.  Return a 'to_chars_result'
+    // 'struct' whose 'ptr' field points at the end of the representation, and
+    // whose 'ec' field is 0, on success.  If the buffer specified by
+    // '[ first .. last )' is not large enough for the result, return a
+    // 'struct' with 'ptr' set to 'last' and 'ec' set to
+    // 'errc::value_too_large'.  An encoding having a non-canonical
+    // coefficient is written as the zero having its sign and exponent.  The
+    // behavior is undefined unless 'first <= last'.  Note that no
+    // representation is longer than 24 characters.
+
+bsl::from_chars_result from_chars(const char *first,
+                                  const char *last,
+                                  Decimal64&  value);
+    // Parse the longest prefix of the range specified by '[ first .. last )'
+    // that is a decimal number, having an optional fraction and an optional
+    // exponent introduced by 'e' or 'E', an infinity ("inf" or "infinity"), a
+    // quiet NaN ("nan"), or a signaling NaN ("snan"), preceded by an optional
+    // '-', and, if that number does not overflow to infinity or, unless it is
+    // zero, underflow to zero, load, into the specified 'value', the
+    // 'Decimal64' closest to it (rounding half to even) that has the quantum
+    // of the number if possible.  Infinities and NaNs are matched without
+    // regard to case.  Return a 'from_chars_result' 'struct' as described by
+    // 'bsl::from_chars'.  'value' is not modified unless the returned 'ec' is
+    // 0.  The behavior is undefined unless 'first <= last'.  Note that a
+    // number, other than a NaN, parsed from the representation of a
+    // 'Decimal64' written by 'to_chars' has the same representation.
+
 // ============================================================================
 //                      INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -14,15 +14,19 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_stopwatch.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_charconv.h>
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
 #include <bsl_cstdint.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_fstream.h>
 #include <bsl_limits.h>
 #include <bsl_iostream.h>
+#include <bsl_sstream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
 #include <bsl_vector.h>
@@ -53,6 +57,17 @@ using bsl::atoi;
 //
 // TRAITS
 // ----------------------------------------------------------------------------
+// CLASS METHODS
+// [16] Decimal64 sum(const Decimal64 *, int);
+// [16] Decimal64 dotProduct(const Decimal64 *, const Decimal64 *, int);
+// [16] void scale(Decimal64 *, const Decimal64 *, int, Decimal64);
+// [16] int indexOfMin(const Decimal64 *, int);
+// [16] int indexOfMax(const Decimal64 *, int);
+//
+// FREE FUNCTIONS
+// [17] to_chars_result to_chars(char *, char *, Decimal64);
+// [17] from_chars_result from_chars(const char *, const char *, Decimal64&);
+// ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [  ] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -406,6 +421,70 @@ struct NulBuf : bsl::streambuf {
     }
 };
 
+                          // Aggregation helpers
+
+bool isSameRepresentation(BDEC::Decimal64 lhs, BDEC::Decimal64 rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same BID
+    // encoding, and 'false' otherwise.
+{
+    return 0 == bsl::memcmp(&lhs, &rhs, sizeof lhs);
+}
+
+BDEC::Decimal64 randomDecimal64(int exponent)
+    // Return a pseudo-random 'Decimal64' that usually has the specified
+    // 'exponent' and a coefficient of at most 7 digits, and otherwise has a
+    // different exponent, a long coefficient, or an extreme exponent, or is
+    // a zero, an infinity, or a NaN.
+{
+    typedef bsl::numeric_limits<BDEC::Decimal64> Limits;
+
+    const int       kind = bsl::rand() % 100;
+    const long long sign = bsl::rand() % 2 ? -1 : 1;
+
+    if (kind < 70) {
+        return Util::makeDecimalRaw64(sign * (bsl::rand() % 10000000),
+                                      exponent);                      // RETURN
+    }
+    if (kind < 76) {
+        return Util::makeDecimalRaw64(sign * (bsl::rand() % 10000),
+                                      exponent + bsl::rand() % 5 - 2);
+                                                                      // RETURN
+    }
+    if (kind < 82) {
+        // a coefficient close to 16 digits
+
+        const long long coefficient = 9999999999999999ll
+                                    - bsl::rand() % 1000000000ll;
+        return Util::makeDecimalRaw64(sign * coefficient, exponent);
+                                                                      // RETURN
+    }
+    if (kind < 88) {
+        // a coefficient between 2 to the 32nd and 2 to the 53rd
+
+        const long long coefficient = (1ll << 32)
+                                    + static_cast<long long>(bsl::rand())
+                                                                 * 1000003ll;
+        return Util::makeDecimalRaw64(sign * coefficient, exponent);
+                                                                      // RETURN
+    }
+    if (kind < 92) {
+        const BDEC::Decimal64 zero = Util::makeDecimalRaw64(0, exponent);
+        return 0 < sign ? zero : -zero;                               // RETURN
+    }
+    if (kind < 95) {
+        return Util::makeDecimalRaw64(sign * (bsl::rand() % 100),
+                                      bsl::rand() % 2 ? 369 : -398);
+                                                                      // RETURN
+    }
+    if (kind < 97) {
+        return 0 < sign ? Limits::infinity() : -Limits::infinity();  // RETURN
+    }
+    if (kind < 99) {
+        return Limits::quiet_NaN();                                   // RETURN
+    }
+    return Limits::signaling_NaN();
+}
+
                           // Concurrency helpers
 
 extern "C" void doQuantize()
@@ -469,6 +548,733 @@ int main(int argc, char* argv[])
 
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING 'to_chars' AND 'from_chars'
+        //
+        // Concerns:
+        //: 1 'to_chars' writes what 'format' writes with a default
+        //:   configuration, for every encoding, including special values and
+        //:   non-canonical coefficients.
+        //:
+        //: 2 'to_chars' fails, setting 'ptr' to 'last', exactly when the
+        //:   buffer is too short.
+        //:
+        //: 3 'from_chars' parses the longest prefix that is a number, an
+        //:   infinity, or a NaN, and reports an invalid argument if there is
+        //:   none.
+        //:
+        //: 4 Numbers having at most 16 significant digits and an exponent in
+        //:   range keep their quantum, and other numbers are rounded as
+        //:   'parseDecimal64' rounds them.
+        //:
+        //: 5 Numbers overflowing to infinity, or non-zero numbers underflowing
+        //:   to zero, are out of range, and leave 'value' and 'errno'
+        //:   unmodified.
+        //:
+        //: 6 A value written by 'to_chars' reads back as the same encoding.
+        //:
+        //: 7 Neither function allocates memory.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, write values having
+        //:   representative exponents and coefficients into buffers of every
+        //:   length up to the length required, and compare with the expected
+        //:   text.  (C-2)
+        //:
+        //: 2 Write pseudo-random values and encodings, and compare with the
+        //:   output of 'format'; read the text back and compare the encoding
+        //:   with the value written.  (C-1, 6)
+        //:
+        //: 3 Using the table-driven technique, parse strings and compare the
+        //:   result, the end of the parsed prefix, and the error code with the
+        //:   expected values, and with the result of 'parseDecimal64'.
+        //:   (C-3..5)
+        //:
+        //: 4 Verify that the default allocator is not used.  (C-7)
+        //
+        // Testing:
+        //   to_chars_result to_chars(char *, char *, Decimal64);
+        //   from_chars_result from_chars(const char *, const char *, Dec64&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'to_chars' AND 'from_chars'" << endl
+                          << "===================================" << endl;
+
+        typedef BDEC::Decimal64                      Obj;
+        typedef bsl::numeric_limits<BDEC::Decimal64> Limits;
+
+        if (verbose) cout << "\nTesting 'to_chars'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                long long   d_coefficient;
+                int         d_exponent;
+                bool        d_isNegative;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  COEFFICIENT          EXP   NEG  EXPECTED
+                //----  -------------------  ----  ---  --------------------
+                { L_,                     0,    0, 0,  "0"                 },
+                { L_,                     0,    0, 1,  "-0"                },
+                { L_,                     0,   -3, 0,  "0.000"             },
+                { L_,                     0,   -7, 0,  "0e-07"             },
+                { L_,                     0,    5, 1,  "-0e+05"            },
+                { L_,                     5,    0, 0,  "5"                 },
+                { L_,                   150,   -2, 0,  "1.50"              },
+                { L_,                   150,   -2, 1,  "-1.50"             },
+                { L_,                     5,   -3, 0,  "0.005"             },
+                { L_,               1234567,   -6, 0,  "1.234567"          },
+                { L_,                     1,   -6, 0,  "0.000001"          },
+                { L_,                     1,   -7, 0,  "1e-07"             },
+                { L_,                    12,   -8, 0,  "1.2e-07"           },
+                { L_,                    12,   -9, 0,  "1.2e-08"           },
+                { L_,                    15,    3, 0,  "1.5e+04"           },
+                { L_,                     1,    1, 0,  "1e+01"             },
+                { L_,                  1500,    0, 0,  "1500"              },
+                { L_,      1234567890123456,  -21, 1,
+                                                "-0.000001234567890123456" },
+                { L_,      9999999999999999,  369, 0,
+                                                "9.999999999999999e+384"   },
+                { L_,      9999999999999999,  369, 1,
+                                               "-9.999999999999999e+384"   },
+                { L_,      9007199254740992,    0, 0,  "9007199254740992"  },
+                { L_,                     1, -398, 0,  "1e-398"            },
+                { L_,                    99,   86, 0,  "9.9e+87"           },
+                { L_,                    99,   -2, 0,  "0.99"              },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const char *EXPECTED = DATA[ti].d_expected;
+                const int   LENGTH   = static_cast<int>(
+                                                      bsl::strlen(EXPECTED));
+
+                const Obj X = Util::makeDecimalRaw64(DATA[ti].d_coefficient,
+                                                     DATA[ti].d_exponent);
+                const Obj VALUE = DATA[ti].d_isNegative ? -X : X;
+
+                if (veryVerbose) { T_ P_(LINE) P(EXPECTED) }
+
+                ASSERTV(LINE, LENGTH <= 24);
+
+                char buffer[32];
+                for (int length = 0; length <= LENGTH; ++length) {
+                    bsl::memset(buffer, 'x', sizeof buffer);
+
+                    const bsl::to_chars_result RESULT =
+                              BDEC::to_chars(buffer, buffer + length, VALUE);
+
+                    if (length < LENGTH) {
+                        ASSERTV(LINE, length, buffer + length == RESULT.ptr);
+                        ASSERTV(LINE, length,
+                                bsl::errc::value_too_large == RESULT.ec);
+                    }
+                    else {
+                        ASSERTV(LINE, buffer + LENGTH == RESULT.ptr);
+                        ASSERTV(LINE, bsl::ErrcEnum() == RESULT.ec);
+                        ASSERTV(LINE, EXPECTED, bsl::string(buffer, LENGTH),
+                                0 == bsl::memcmp(buffer, EXPECTED, LENGTH));
+                    }
+                    ASSERTV(LINE, length, 'x' == buffer[length]);
+                }
+            }
+
+            const struct {
+                int         d_line;
+                Obj         d_value;
+                const char *d_expected;
+            } SPECIALS[] = {
+                { L_,  Limits::infinity(),      "inf"  },
+                { L_, -Limits::infinity(),      "-inf" },
+                { L_,  Limits::quiet_NaN(),     "nan"  },
+                { L_, -Limits::quiet_NaN(),     "-nan" },
+                { L_,  Limits::signaling_NaN(), "snan" },
+            };
+            const int NUM_SPECIALS = static_cast<int>(sizeof SPECIALS
+                                                      / sizeof *SPECIALS);
+
+            for (int ti = 0; ti < NUM_SPECIALS; ++ti) {
+                const int   LINE     = SPECIALS[ti].d_line;
+                const char *EXPECTED = SPECIALS[ti].d_expected;
+                const int   LENGTH   = static_cast<int>(
+                                                      bsl::strlen(EXPECTED));
+
+                char buffer[32];
+
+                bsl::to_chars_result result =
+                                        BDEC::to_chars(buffer,
+                                                       buffer + LENGTH,
+                                                       SPECIALS[ti].d_value);
+
+                ASSERTV(LINE, buffer + LENGTH == result.ptr);
+                ASSERTV(LINE, bsl::ErrcEnum() == result.ec);
+                ASSERTV(LINE, 0 == bsl::memcmp(buffer, EXPECTED, LENGTH));
+
+                result = BDEC::to_chars(buffer,
+                                        buffer + LENGTH - 1,
+                                        SPECIALS[ti].d_value);
+
+                ASSERTV(LINE, buffer + LENGTH - 1 == result.ptr);
+                ASSERTV(LINE, bsl::errc::value_too_large == result.ec);
+            }
+        }
+
+        if (verbose) cout << "\nTesting non-canonical coefficients." << endl;
+        {
+            // 'BITS' encodes, in the long form, the (non-canonical) largest
+            // coefficient having the exponent 0.
+
+            const bsls::Types::Uint64 BITS = 0x6000000000000000ull
+                                           | (398ull << 51)
+                                           | 0x7ffffffffffffull;
+
+            const struct {
+                int                 d_line;
+                bsls::Types::Uint64 d_bits;
+                const char         *d_expected;
+            } DATA[] = {
+                { L_, BITS,                                      "0"     },
+                { L_, BITS | 0x8000000000000000ull,              "-0"    },
+                { L_, BITS - (2ull << 51),                       "0.00"  },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const char *EXPECTED = DATA[ti].d_expected;
+                const int   LENGTH   = static_cast<int>(
+                                                      bsl::strlen(EXPECTED));
+
+                Obj value;
+                bsl::memcpy(static_cast<void *>(&value),
+                            &DATA[ti].d_bits,
+                            sizeof value);
+
+                ASSERTV(LINE, value == Obj());
+
+                char                       buffer[32];
+                const bsl::to_chars_result RESULT =
+                                   BDEC::to_chars(buffer, buffer + 32, value);
+
+                ASSERTV(LINE, buffer + LENGTH == RESULT.ptr);
+                ASSERTV(LINE, EXPECTED, bsl::string(buffer, RESULT.ptr),
+                        0 == bsl::memcmp(buffer, EXPECTED, LENGTH));
+            }
+        }
+
+        if (verbose) cout << "\nTesting against 'format' and round trips."
+                          << endl;
+        {
+            bsl::srand(17);
+
+            for (int i = 0; i < 200000; ++i) {
+                Obj value;
+
+                if (i % 2) {
+                    // a pseudo-random encoding
+
+                    bsls::Types::Uint64 bits = 0;
+                    for (int j = 0; j < 4; ++j) {
+                        bits = (bits << 16) ^ (bsl::rand() & 0xffff);
+                    }
+                    bsl::memcpy(static_cast<void *>(&value),
+                                &bits,
+                                sizeof value);
+                }
+                else {
+                    value = randomDecimal64(bsl::rand() % 40 - 30);
+                }
+
+                // 'format' does not support non-canonical coefficients,
+                // which arithmetic operations treat as zero.
+
+                const Obj CANONICAL = value * Util::makeDecimalRaw64(1, 0);
+
+                if (!isSameRepresentation(value, CANONICAL)
+                 && !Util::isInf(value)
+                 && !Util::isNan(value)) {
+                    continue;
+                }
+
+                char      expected[64];
+                const int LENGTH = Util::format(expected,
+                                                sizeof expected,
+                                                value);
+
+                char                       buffer[32];
+                const bsl::to_chars_result RESULT =
+                                                 BDEC::to_chars(buffer,
+                                                                buffer + 32,
+                                                                value);
+
+                ASSERTV(i, LENGTH, buffer + LENGTH == RESULT.ptr);
+                ASSERTV(i, bsl::string(expected, LENGTH),
+                        bsl::string(buffer, RESULT.ptr),
+                        0 == bsl::memcmp(buffer, expected, LENGTH));
+
+                if (Util::isNan(value)) {
+                    continue;
+                }
+
+                Obj                          parsed;
+                const bsl::from_chars_result PARSE_RESULT =
+                                 BDEC::from_chars(buffer, RESULT.ptr, parsed);
+
+                ASSERTV(i, RESULT.ptr == PARSE_RESULT.ptr);
+                ASSERTV(i, bsl::ErrcEnum() == PARSE_RESULT.ec);
+                // Infinities may have non-zero trailing bits.
+
+                ASSERTV(i, bsl::string(buffer, RESULT.ptr),
+                        Util::isInf(value) ? value == parsed
+                                           : isSameRepresentation(value,
+                                                                  parsed));
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'from_chars'." << endl;
+        {
+            const bsl::ErrcEnum OK  = bsl::ErrcEnum();
+            const bsl::ErrcEnum INV = bsl::errc::invalid_argument;
+            const bsl::ErrcEnum OOR = bsl::errc::result_out_of_range;
+
+            static const struct {
+                int            d_line;
+                const char    *d_input;
+                int            d_parsedLength;
+                bsl::ErrcEnum  d_error;
+                long long      d_coefficient;  // if 'OK' and not special
+                int            d_exponent;
+            } DATA[] = {
+                //LINE INPUT                       LEN  ERROR COEFF     EXP
+                //---- --------------------------  ---  ----- --------  ----
+                { L_,  "",                           0,  INV,        0,    0 },
+                { L_,  "-",                          0,  INV,        0,    0 },
+                { L_,  ".",                          0,  INV,        0,    0 },
+                { L_,  "-.",                         0,  INV,        0,    0 },
+                { L_,  "+1",                         0,  INV,        0,    0 },
+                { L_,  " 1",                         0,  INV,        0,    0 },
+                { L_,  "e5",                         0,  INV,        0,    0 },
+                { L_,  "in",                         0,  INV,        0,    0 },
+                { L_,  "0",                          1,  OK,         0,    0 },
+                { L_,  "-0",                         2,  OK,         0,    0 },
+                { L_,  "000",                        3,  OK,         0,    0 },
+                { L_,  "0.000",                      5,  OK,         0,   -3 },
+                { L_,  "1.50",                       4,  OK,       150,   -2 },
+                { L_,  "-1.50x",                     5,  OK,      -150,   -2 },
+                { L_,  ".5",                         2,  OK,         5,   -1 },
+                { L_,  "5.",                         2,  OK,         5,    0 },
+                { L_,  "5..",                        2,  OK,         5,    0 },
+                { L_,  "007",                        3,  OK,         7,    0 },
+                { L_,  "0.0012",                     6,  OK,        12,   -4 },
+                { L_,  "1e5",                        3,  OK,         1,    5 },
+                { L_,  "1E+05",                      5,  OK,         1,    5 },
+                { L_,  "1.5e-3",                     6,  OK,        15,   -4 },
+                { L_,  "1e",                         1,  OK,         1,    0 },
+                { L_,  "1e+",                        1,  OK,         1,    0 },
+                { L_,  "1e-x",                       1,  OK,         1,    0 },
+                { L_,  "1.5e+04",                    7,  OK,        15,    3 },
+                { L_,  "9999999999999999",          16,  OK,
+                                                 9999999999999999ll,    0 },
+                { L_,  "9.999999999999999e384",     21,  OK,
+                                                 9999999999999999ll,  369 },
+                { L_,  "1e-398",                     6,  OK,         1, -398 },
+                { L_,  "0e-500",                     6,  OK,         0, -398 },
+                { L_,  "0e500",                      5,  OK,         0,  369 },
+                { L_,  "1e370",                      5,  OK,        10,  369 },
+                { L_,  "6e-399",                     6,  OK,         1, -398 },
+                { L_,  "12345678901234567",         17,  OK,
+                                                 1234567890123457ll,    1 },
+                { L_,  "12345678901234565",         17,  OK,
+                                                 1234567890123456ll,    1 },
+                { L_,  "123456789012345650000001",  24,  OK,
+                                                 1234567890123457ll,    8 },
+                { L_,  "1234567890123456000",       19,  OK,
+                                                 1234567890123456ll,    3 },
+                { L_,  "99999999999999995",         17,  OK,
+                                                 1000000000000000ll,    2 },
+                { L_,  "1e385",                      5,  OOR,        0,    0 },
+                { L_,  "-1e999999999999999999",     21,  OOR,        0,    0 },
+                { L_,  "1e-399",                     6,  OOR,        0,    0 },
+                { L_,  "5e-399",                     6,  OOR,        0,    0 },
+                { L_,  "0.1e-9999999999",           15,  OOR,        0,    0 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            const Obj INITIAL = BDLDFP_DECIMAL_DD(42.5);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int            LINE   = DATA[ti].d_line;
+                const char          *INPUT  = DATA[ti].d_input;
+                const int            LEN    = DATA[ti].d_parsedLength;
+                const bsl::ErrcEnum  ERROR  = DATA[ti].d_error;
+                const int            LENGTH = static_cast<int>(
+                                                         bsl::strlen(INPUT));
+
+                if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+                Obj value = INITIAL;
+
+                errno = 0;
+
+                const bsl::from_chars_result RESULT =
+                                BDEC::from_chars(INPUT, INPUT + LENGTH, value);
+
+                ASSERTV(LINE, 0 == errno);
+                ASSERTV(LINE, RESULT.ptr - INPUT, INPUT + LEN == RESULT.ptr);
+                ASSERTV(LINE, ERROR == RESULT.ec);
+
+                if (OK != ERROR) {
+                    ASSERTV(LINE, isSameRepresentation(INITIAL, value));
+                    continue;
+                }
+
+                Obj expected = Util::makeDecimalRaw64(DATA[ti].d_coefficient,
+                                                      DATA[ti].d_exponent);
+                if ('-' == INPUT[0]) {
+                    expected = -Util::fabs(expected);
+                }
+                ASSERTV(LINE, value, expected,
+                        isSameRepresentation(expected, value));
+
+                // Compare with 'parseDecimal64' on the parsed prefix.
+
+                const bsl::string PREFIX(INPUT, LEN, pa);
+                Obj               parsed;
+
+                ASSERTV(LINE, 0 == Util::parseDecimal64(&parsed, PREFIX));
+                ASSERTV(LINE, parsed, value,
+                        isSameRepresentation(parsed, value));
+            }
+
+            // special values
+
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                int         d_parsedLength;
+                int         d_class;
+                bool        d_isNegative;
+            } SPECIALS[] = {
+                { L_,  "inf",        3, FP_INFINITE, false },
+                { L_,  "INF",        3, FP_INFINITE, false },
+                { L_,  "-Inf",       4, FP_INFINITE, true  },
+                { L_,  "infinity",   8, FP_INFINITE, false },
+                { L_,  "InFiNiTy!",  8, FP_INFINITE, false },
+                { L_,  "infinit",    3, FP_INFINITE, false },
+                { L_,  "nan",        3, FP_NAN,      false },
+                { L_,  "-NaN",       4, FP_NAN,      true  },
+                { L_,  "nan(1)",     3, FP_NAN,      false },
+                { L_,  "snan",       4, FP_NAN,      false },
+                { L_,  "sNaN",       4, FP_NAN,      false },
+            };
+            const int NUM_SPECIALS = static_cast<int>(sizeof SPECIALS
+                                                      / sizeof *SPECIALS);
+
+            for (int ti = 0; ti < NUM_SPECIALS; ++ti) {
+                const int   LINE   = SPECIALS[ti].d_line;
+                const char *INPUT  = SPECIALS[ti].d_input;
+                const int   LENGTH = static_cast<int>(bsl::strlen(INPUT));
+
+                Obj value = INITIAL;
+
+                const bsl::from_chars_result RESULT =
+                                BDEC::from_chars(INPUT, INPUT + LENGTH, value);
+
+                ASSERTV(LINE, INPUT + SPECIALS[ti].d_parsedLength
+                                                                == RESULT.ptr);
+                ASSERTV(LINE, bsl::ErrcEnum() == RESULT.ec);
+                ASSERTV(LINE, SPECIALS[ti].d_class == Util::classify(value));
+                const Obj ONE = BDLDFP_DECIMAL_DD(1.0);
+                ASSERTV(LINE, SPECIALS[ti].d_isNegative ==
+                                    (Util::copySign(ONE, value) < Obj()));
+            }
+
+            // a long input
+
+            bsl::string longInput("0.", pa);
+            longInput.append(1000, '0');
+            longInput.append("12345678901234567890");
+            longInput.append(1000, '0');
+            longInput.append("1e1020");
+
+            Obj value;
+
+            const char *const BEGIN = longInput.data();
+            const char *const END   = BEGIN + longInput.size();
+
+            const bsl::from_chars_result RESULT =
+                                         BDEC::from_chars(BEGIN, END, value);
+
+            ASSERT(END == RESULT.ptr);
+            ASSERT(bsl::ErrcEnum() == RESULT.ec);
+            ASSERTV(value, isSameRepresentation(
+                              Util::makeDecimalRaw64(1234567890123457ll, 4),
+                              value));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[32];
+            Obj  value;
+
+            ASSERT_PASS(BDEC::to_chars(buffer, buffer, value));
+            ASSERT_FAIL(BDEC::to_chars(buffer + 1, buffer, value));
+
+            ASSERT_PASS(BDEC::from_chars(buffer, buffer, value));
+            ASSERT_FAIL(BDEC::from_chars(buffer + 1, buffer, value));
+        }
+      } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING AGGREGATION FUNCTIONS
+        //
+        // Concerns:
+        //: 1 Each function returns the encoding computed by the equivalent
+        //:   loop of 'Decimal64' operations, whether or not elements have the
+        //:   same exponent, the accumulated coefficient exceeds 16 digits,
+        //:   products are inexact, or elements are zeros of either sign,
+        //:   infinities, or NaNs.
+        //:
+        //: 2 'sum' and 'dotProduct' of no elements are positive zero, and
+        //:   'indexOfMin' and 'indexOfMax' of no elements, or of NaNs only,
+        //:   are -1.
+        //:
+        //: 3 'scale' may be applied in place.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the results for a few arrays having known sums, products,
+        //:   and extrema.  (C-1..2)
+        //:
+        //: 2 For arrays of pseudo-random lengths, mostly having elements of a
+        //:   common exponent and mixed with every other kind of element,
+        //:   compare the encoding returned by each function with the encoding
+        //:   computed by the equivalent loop.  Scale in place as well.
+        //:   (C-1, 3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-4)
+        //
+        // Testing:
+        //   Decimal64 sum(const Decimal64 *, int);
+        //   Decimal64 dotProduct(const Decimal64 *, const Decimal64 *, int);
+        //   void scale(Decimal64 *, const Decimal64 *, int, Decimal64);
+        //   int indexOfMin(const Decimal64 *, int);
+        //   int indexOfMax(const Decimal64 *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING AGGREGATION FUNCTIONS" << endl
+                          << "=============================" << endl;
+
+        typedef BDEC::Decimal64                      Obj;
+        typedef bsl::numeric_limits<BDEC::Decimal64> Limits;
+
+        if (verbose) cout << "\nTesting known results." << endl;
+        {
+            const Obj POS_ZERO = Util::makeDecimalRaw64(0, -2);
+            const Obj NEG_ZERO = -POS_ZERO;
+            const Obj MAX      =
+                            Util::makeDecimalRaw64(9999999999999999ll, 0);
+
+            ASSERT(isSameRepresentation(Obj(), Util::sum(0, 0)));
+            ASSERT(isSameRepresentation(Obj(), Util::dotProduct(0, 0, 0)));
+            ASSERT(-1 == Util::indexOfMin(0, 0));
+            ASSERT(-1 == Util::indexOfMax(0, 0));
+            Util::scale(0, 0, 0, POS_ZERO);
+
+            {
+                const Obj V[] = { BDLDFP_DECIMAL_DD(1.25),
+                                  BDLDFP_DECIMAL_DD(-3.50),
+                                  BDLDFP_DECIMAL_DD(7.00) };
+
+                ASSERT(isSameRepresentation(BDLDFP_DECIMAL_DD(4.75),
+                                            Util::sum(V, 3)));
+                ASSERT(isSameRepresentation(BDLDFP_DECIMAL_DD(1.25),
+                                            Util::sum(V, 1)));
+                ASSERT(isSameRepresentation(BDLDFP_DECIMAL_DD(62.8125),
+                                            Util::dotProduct(V, V, 3)));
+                ASSERT(1 == Util::indexOfMin(V, 3));
+                ASSERT(2 == Util::indexOfMax(V, 3));
+
+                Obj result[3];
+                Util::scale(result, V, 3, BDLDFP_DECIMAL_DD(-0.5));
+                ASSERT(isSameRepresentation(BDLDFP_DECIMAL_DD(-0.625),
+                                            result[0]));
+                ASSERT(isSameRepresentation(BDLDFP_DECIMAL_DD(1.750),
+                                            result[1]));
+                ASSERT(isSameRepresentation(BDLDFP_DECIMAL_DD(-3.500),
+                                            result[2]));
+            }
+            {
+                // signs of zero sums
+
+                const Obj NN[] = { NEG_ZERO, NEG_ZERO };
+                const Obj NP[] = { NEG_ZERO, POS_ZERO };
+                const Obj C[]  = { BDLDFP_DECIMAL_DD(-1.25),
+                                   BDLDFP_DECIMAL_DD(1.25),
+                                   NEG_ZERO };
+
+                ASSERT(isSameRepresentation(NEG_ZERO, Util::sum(NN, 2)));
+                ASSERT(isSameRepresentation(POS_ZERO,  Util::sum(NP, 2)));
+                ASSERT(isSameRepresentation(POS_ZERO,  Util::sum(C,  3)));
+            }
+            {
+                // accumulated coefficient exceeding 16 digits
+
+                const Obj V[] = { MAX, MAX, -MAX, -MAX };
+
+                Obj expected = V[0];
+                for (int i = 1; i < 4; ++i) {
+                    expected += V[i];
+                }
+                ASSERT(isSameRepresentation(expected, Util::sum(V, 4)));
+                ASSERT(!isSameRepresentation(Obj(), Util::sum(V, 4)));
+            }
+            {
+                // extrema ignore NaNs, and ties resolve to the first element
+
+                const Obj V[] = { Limits::quiet_NaN(),
+                                  BDLDFP_DECIMAL_DD(2.0),
+                                  BDLDFP_DECIMAL_DD(2.00),
+                                  Limits::quiet_NaN(),
+                                  BDLDFP_DECIMAL_DD(-1.0),
+                                  BDLDFP_DECIMAL_DD(-1.00) };
+
+                ASSERT(4 == Util::indexOfMin(V, 6));
+                ASSERT(1 == Util::indexOfMax(V, 6));
+                ASSERT(-1 == Util::indexOfMin(V, 1));
+                ASSERT(-1 == Util::indexOfMax(V, 1));
+
+                const Obj Z[] = { POS_ZERO, NEG_ZERO };
+
+                ASSERT(0 == Util::indexOfMin(Z, 2));
+                ASSERT(0 == Util::indexOfMax(Z, 2));
+            }
+        }
+
+        if (verbose) cout << "\nTesting against per-element loops." << endl;
+        {
+            const int MAX_LENGTH = 64;
+
+            Obj x[MAX_LENGTH];
+            Obj y[MAX_LENGTH];
+            Obj result[MAX_LENGTH];
+            Obj inPlace[MAX_LENGTH];
+
+            bsl::srand(16);
+
+            for (int iteration = 0; iteration < 20000; ++iteration) {
+                const int LENGTH   = bsl::rand() % (MAX_LENGTH + 1);
+                const int EXPONENT = bsl::rand() % 10 - 8;
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    x[i] = randomDecimal64(EXPONENT);
+                    y[i] = randomDecimal64(-2);
+                }
+                const Obj FACTOR = randomDecimal64(bsl::rand() % 5 - 2);
+
+                if (veryVeryVerbose) { T_ P_(iteration) P(LENGTH) }
+
+                // 'sum'
+
+                Obj expected;
+                if (LENGTH) {
+                    expected = x[0];
+                    for (int i = 1; i < LENGTH; ++i) {
+                        expected += x[i];
+                    }
+                }
+                ASSERTV(iteration, expected, Util::sum(x, LENGTH),
+                        isSameRepresentation(expected, Util::sum(x, LENGTH)));
+
+                // 'dotProduct'
+
+                expected = Obj();
+                if (LENGTH) {
+                    expected = x[0] * y[0];
+                    for (int i = 1; i < LENGTH; ++i) {
+                        expected += x[i] * y[i];
+                    }
+                }
+                const Obj DOT = Util::dotProduct(x, y, LENGTH);
+                ASSERTV(iteration, expected, DOT,
+                        isSameRepresentation(expected, DOT));
+
+                // 'scale'
+
+                bsl::copy(x, x + LENGTH, inPlace);
+                Util::scale(result, x, LENGTH, FACTOR);
+                Util::scale(inPlace, inPlace, LENGTH, FACTOR);
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    const Obj EXPECTED = x[i] * FACTOR;
+
+                    ASSERTV(iteration, i, EXPECTED, result[i],
+                            isSameRepresentation(EXPECTED, result[i]));
+                    ASSERTV(iteration, i, EXPECTED, inPlace[i],
+                            isSameRepresentation(EXPECTED, inPlace[i]));
+                }
+
+                // 'indexOfMin' and 'indexOfMax'
+
+                int expectedMin = -1;
+                int expectedMax = -1;
+                for (int i = 0; i < LENGTH; ++i) {
+                    if (Util::isNan(x[i])) {
+                        continue;
+                    }
+                    if (-1 == expectedMin || x[i] < x[expectedMin]) {
+                        expectedMin = i;
+                    }
+                    if (-1 == expectedMax || x[i] > x[expectedMax]) {
+                        expectedMax = i;
+                    }
+                }
+                ASSERTV(iteration, expectedMin, Util::indexOfMin(x, LENGTH),
+                        expectedMin == Util::indexOfMin(x, LENGTH));
+                ASSERTV(iteration, expectedMax, Util::indexOfMax(x, LENGTH),
+                        expectedMax == Util::indexOfMax(x, LENGTH));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj x[2];
+            Obj result[2];
+
+            ASSERT_PASS(Util::sum(x,  2));
+            ASSERT_PASS(Util::sum(0,  0));
+            ASSERT_FAIL(Util::sum(0,  1));
+            ASSERT_FAIL(Util::sum(x, -1));
+
+            ASSERT_PASS(Util::dotProduct(x, x,  2));
+            ASSERT_FAIL(Util::dotProduct(0, x,  1));
+            ASSERT_FAIL(Util::dotProduct(x, 0,  1));
+            ASSERT_FAIL(Util::dotProduct(x, x, -1));
+
+            ASSERT_PASS(Util::scale(result, x,  2, x[0]));
+            ASSERT_FAIL(Util::scale(     0, x,  1, x[0]));
+            ASSERT_FAIL(Util::scale(result, 0,  1, x[0]));
+            ASSERT_FAIL(Util::scale(result, x, -1, x[0]));
+
+            ASSERT_PASS(Util::indexOfMin(x,  2));
+            ASSERT_FAIL(Util::indexOfMin(0,  1));
+            ASSERT_FAIL(Util::indexOfMin(x, -1));
+
+            ASSERT_PASS(Util::indexOfMax(x,  2));
+            ASSERT_FAIL(Util::indexOfMax(0,  1));
+            ASSERT_FAIL(Util::indexOfMax(x, -1));
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING 'format'
@@ -6628,6 +7434,227 @@ int main(int argc, char* argv[])
         bsl::cout << "Total time: " << totalTime << " seconds." << bsl::endl;
 
     } break;
+    case -10: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: AGGREGATION FUNCTIONS
+        //
+        // Compare the time taken by 'sum', 'dotProduct', 'scale', and
+        // 'indexOfMin' on an array of 'Decimal64' values having a common
+        // exponent with the time taken by the equivalent loops of 'Decimal64'
+        // operations.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: AGGREGATION FUNCTIONS" << endl
+                          << "=======================================" << endl;
+
+        // Streaming a 'Decimal64' uses the default allocator.
+
+        bslma::DefaultAllocatorGuard guard(pa);
+
+        typedef BDEC::Decimal64 Obj;
+
+        const int NUM_VALUES     = 1000000;
+        const int NUM_ITERATIONS = 10;
+
+        bsl::vector<Obj> x(NUM_VALUES, pa);
+        bsl::vector<Obj> y(NUM_VALUES, pa);
+        bsl::vector<Obj> result(NUM_VALUES, pa);
+
+        bsl::srand(10);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            x[i] = Util::makeDecimalRaw64(bsl::rand() % 1000000 - 500000, -2);
+            y[i] = Util::makeDecimalRaw64(bsl::rand() % 10000, -4);
+        }
+        const Obj FACTOR = BDLDFP_DECIMAL_DD(1.05);
+
+        Obj             total;
+        int             index = 0;
+        bsls::Stopwatch s;
+
+        s.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            total = x[0];
+            for (int i = 1; i < NUM_VALUES; ++i) {
+                total += x[i];
+            }
+        }
+        s.stop();
+        cout << "sum (loop):               " << s.accumulatedWallTime()
+             << "s (" << total << ")" << endl;
+
+        s.reset();
+        s.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            total = Util::sum(x.data(), NUM_VALUES);
+        }
+        s.stop();
+        cout << "sum (kernel):             " << s.accumulatedWallTime()
+             << "s (" << total << ")" << endl;
+
+        s.reset();
+        s.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            total = x[0] * y[0];
+            for (int i = 1; i < NUM_VALUES; ++i) {
+                total += x[i] * y[i];
+            }
+        }
+        s.stop();
+        cout << "dotProduct (loop):        " << s.accumulatedWallTime()
+             << "s (" << total << ")" << endl;
+
+        s.reset();
+        s.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            total = Util::dotProduct(x.data(), y.data(), NUM_VALUES);
+        }
+        s.stop();
+        cout << "dotProduct (kernel):      " << s.accumulatedWallTime()
+             << "s (" << total << ")" << endl;
+
+        s.reset();
+        s.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                result[i] = x[i] * FACTOR;
+            }
+        }
+        s.stop();
+        cout << "scale (loop):             " << s.accumulatedWallTime()
+             << "s" << endl;
+
+        s.reset();
+        s.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            Util::scale(result.data(), x.data(), NUM_VALUES, FACTOR);
+        }
+        s.stop();
+        cout << "scale (kernel):           " << s.accumulatedWallTime()
+             << "s" << endl;
+
+        s.reset();
+        s.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            index = 0;
+            for (int i = 1; i < NUM_VALUES; ++i) {
+                if (x[i] < x[index]) {
+                    index = i;
+                }
+            }
+        }
+        s.stop();
+        cout << "indexOfMin (loop):        " << s.accumulatedWallTime()
+             << "s (" << index << ")" << endl;
+
+        s.reset();
+        s.start();
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            index = Util::indexOfMin(x.data(), NUM_VALUES);
+        }
+        s.stop();
+        cout << "indexOfMin (kernel):      " << s.accumulatedWallTime()
+             << "s (" << index << ")" << endl;
+    } break;
+    case -11: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'to_chars' AND 'from_chars'
+        //
+        // Compare the time taken by 'to_chars' to write 'Decimal64' values
+        // with the time taken by 'format' and by an output stream, and the
+        // time taken by 'from_chars' to read them back with the time taken by
+        // 'parseDecimal64'.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: 'to_chars' AND 'from_chars'"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        // Streaming a 'Decimal64' uses the default allocator.
+
+        bslma::DefaultAllocatorGuard guard(pa);
+
+        typedef BDEC::Decimal64 Obj;
+
+        const int NUM_VALUES = 1000000;
+        const int WIDTH      = 32;
+
+        bsl::vector<Obj>  values(NUM_VALUES, pa);
+        bsl::vector<char> text(NUM_VALUES * WIDTH, pa);
+        bsl::vector<int>  lengths(NUM_VALUES, pa);
+
+        bsl::srand(11);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            values[i] = Util::makeDecimalRaw64(bsl::rand() % 100000000,
+                                               bsl::rand() % 8 - 6);
+        }
+
+        bsls::Stopwatch s;
+        s.start();
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            char *buffer = &text[i * WIDTH];
+            lengths[i] = Util::format(buffer, WIDTH, values[i]);
+        }
+        s.stop();
+        cout << "format:                   " << s.accumulatedWallTime()
+             << "s" << endl;
+
+        s.reset();
+        s.start();
+        {
+            bsl::ostringstream stream(pa);
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                stream.seekp(0);
+                stream << values[i];
+            }
+        }
+        s.stop();
+        cout << "operator<<:               " << s.accumulatedWallTime()
+             << "s" << endl;
+
+        s.reset();
+        s.start();
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            char *buffer = &text[i * WIDTH];
+            lengths[i] = static_cast<int>(
+                   BDEC::to_chars(buffer, buffer + WIDTH, values[i]).ptr
+                                                                    - buffer);
+        }
+        s.stop();
+        cout << "to_chars:                 " << s.accumulatedWallTime()
+             << "s" << endl;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            text[i * WIDTH + lengths[i]] = '\0';
+        }
+
+        bsl::vector<Obj> parsed(NUM_VALUES, pa);
+
+        s.reset();
+        s.start();
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            Util::parseDecimal64(&parsed[i], &text[i * WIDTH]);
+        }
+        s.stop();
+        cout << "parseDecimal64:           " << s.accumulatedWallTime()
+             << "s" << endl;
+
+        ASSERT(values == parsed);
+
+        s.reset();
+        s.start();
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const char *buffer = &text[i * WIDTH];
+            BDEC::from_chars(buffer, buffer + lengths[i], parsed[i]);
+        }
+        s.stop();
+        cout << "from_chars:               " << s.accumulatedWallTime()
+             << "s" << endl;
+
+        ASSERT(values == parsed);
+    } break;
     default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
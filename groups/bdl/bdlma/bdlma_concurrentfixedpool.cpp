@@ -146,6 +146,77 @@ void *ConcurrentFixedPool::allocate()
     return (char *)node + d_dataOffset;
 }
 
+int ConcurrentFixedPool::allocateBatch(void **blocks, int numBlocks)
+{
+    BSLS_ASSERT(0 <= numBlocks);
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+
+    int contentionCount = 0;
+
+    const int genCount = d_sizeMask + 1;  // generation count increment
+
+    int numAllocated = 0;
+
+    // Take up to 'numBlocks' nodes from the front of the free list.  Nodes
+    // are pushed back on the free list with an advanced generation count, so
+    // that, if the head of the free list is unchanged when it is swapped, none
+    // of the nodes following it has been allocated in the meantime, and the
+    // links read while walking the list are valid.
+
+    while (numBlocks) {
+        const int head = d_freeList.loadRelaxed();
+        if (!head) {
+            break;
+        }
+
+        Node *last  = d_nodes[((unsigned)head & d_sizeMask) - 1];
+        int   count = 1;
+        while (count < numBlocks) {
+            const unsigned next = last->d_next & d_sizeMask;
+            if (!next || !d_nodes[next - 1]) {
+                break;
+            }
+            last = d_nodes[next - 1];
+            ++count;
+        }
+
+        if (head != d_freeList.testAndSwap(head, last->d_next)) {
+            backoff(&contentionCount, d_backoffLevel);
+            continue;
+        }
+
+        unsigned link = head;
+        for (int i = 0; i < count; ++i) {
+            Node           *node = d_nodes[(link & d_sizeMask) - 1];
+            const unsigned  next = node->d_next;
+
+            node->d_next = link + genCount;
+            blocks[numAllocated++] = (char *)node + d_dataOffset;
+            link = next;
+        }
+        break;
+    }
+
+    // Allocate the remaining nodes from 'd_nodePool'.
+
+    if (numAllocated < numBlocks) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_nodePoolMutex);
+
+        const int numNew = bsl::min(numBlocks - numAllocated,
+                                    (int)d_nodes.size() - d_numNodes);
+        for (int i = 0; i < numNew; ++i) {
+            const int  numNodes = d_numNodes++;
+            Node      *node     = (Node *)d_nodePool.allocate();
+
+            node->d_next = (unsigned)numNodes + 1 + genCount;
+            d_nodes[numNodes] = node;
+            blocks[numAllocated++] = (char *)node + d_dataOffset;
+        }
+    }
+
+    return numAllocated;
+}
+
 void ConcurrentFixedPool::deallocate(void *address)
 {
     int contentionCount = 0;
@@ -164,6 +235,40 @@ void ConcurrentFixedPool::deallocate(void *address)
     }
 }
 
+void ConcurrentFixedPool::deallocateBatch(void *const *blocks, int numBlocks)
+{
+    BSLS_ASSERT(0 <= numBlocks);
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+
+    if (0 == numBlocks) {
+        return;                                                       // RETURN
+    }
+
+    int contentionCount = 0;
+
+    // Link the nodes together, and then push the list on the free list.  The
+    // 'd_next' member of each node contains the link index of the node
+    // advanced by one generation.
+
+    Node *last = (Node *)(void *)((char *)blocks[0] - d_dataOffset);
+    const int head = last->d_next;
+    for (int i = 1; i < numBlocks; ++i) {
+        Node *node = (Node *)(void *)((char *)blocks[i] - d_dataOffset);
+        last->d_next = node->d_next;
+        last = node;
+    }
+
+    while (1) {
+        int old = d_freeList.loadRelaxed();
+        last->d_next = old;
+        if (old == d_freeList.testAndSwap(old, head)) {
+            break;
+        }
+
+        backoff(&contentionCount, d_backoffLevel);
+    }
+}
+
 void ConcurrentFixedPool::release()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_nodePoolMutex);
@@ -15,7 +15,7 @@
 //@CLASSES:
 //  bdlma::ConcurrentFixedPool: thread-safe pool of limited number of blocks
 //
-//@SEE_ALSO: bdlma_concurrentpool
+//@SEE_ALSO: bdlma_concurrentpool, bdlma_concurrentfixedpoolcache
 //
 //@DESCRIPTION: This component implements a *fully thread-safe* memory pool
 // that allocates and manages a limited number (specified at construction) of
@@ -35,6 +35,27 @@
 // implement *out-of-place* container classes that hold elements of uniform
 // size.
 //
+///Batch Allocation and Per-Thread Caching
+///---------------------------------------
+// The free list of a 'bdlma::ConcurrentFixedPool' is a single atomic word
+// updated by every call to 'allocate' and 'deallocate', so that threads
+// allocating from the same pool contend on it.  The 'allocateBatch' and
+// 'deallocateBatch' methods allocate and deallocate several blocks with a
+// single update of the free list.  A thread that allocates and deallocates
+// many blocks can use a 'bdlma::ConcurrentFixedPoolCache', which keeps a
+// small number of free blocks local to the thread and exchanges them with the
+// pool in batches (see 'bdlma_concurrentfixedpoolcache').
+//
+///Memory Placement
+///----------------
+// The blocks of a pool are obtained, as needed, from the allocator supplied
+// at construction, in chunks of several blocks, and the header of each block
+// is written by the thread that first allocates it.  On a system having
+// several NUMA nodes, memory placed by first touch is therefore local to the
+// threads first allocating from the pool; to place the blocks on a given
+// node, supply an allocator obtaining memory from that node, and use one pool
+// for each node.
+//
 ///Usage
 ///-----
 // 'bdlma::ConcurrentFixedPool' is intended to implement *out-of-place*
@@ -240,10 +261,30 @@ class ConcurrentFixedPool {
         // exhausted (i.e., 'poolSize()' memory blocks have already been
         // allocated from this pool).
 
+    int allocateBatch(void **blocks, int numBlocks);
+        // Allocate up to the specified 'numBlocks' memory blocks of the
+        // 'objectSize' specified at construction, load their addresses into
+        // the specified 'blocks' array, and return the number of blocks
+        // allocated.  Fewer than 'numBlocks' blocks are allocated only if
+        // this pool is exhausted (i.e., 'poolSize()' memory blocks have
+        // already been allocated from this pool).  The behavior is undefined
+        // unless '0 <= numBlocks' and 'blocks' has at least 'numBlocks'
+        // elements.  Note that this method updates the free list of this pool
+        // once for all the blocks, rather than once for each block.
+
     void deallocate(void *address);
         // Deallocate the memory block at the specified 'address' back to this
         // pool for reuse.
 
+    void deallocateBatch(void *const *blocks, int numBlocks);
+        // Deallocate the specified 'numBlocks' memory blocks whose addresses
+        // are held in the specified 'blocks' array back to this pool for
+        // reuse.  The behavior is undefined unless '0 <= numBlocks', and each
+        // of the first 'numBlocks' elements of 'blocks' is the address of a
+        // distinct block allocated from this pool.  Note that this method
+        // updates the free list of this pool once for all the blocks, rather
+        // than once for each block.
+
     template<class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object' based on its dynamic type and then
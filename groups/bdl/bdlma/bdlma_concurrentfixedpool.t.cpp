@@ -477,6 +477,95 @@ void runtest(int numIterations, int numObjects, int numThreads)
 }
 }  // close namespace fill_and_release
 
+//=============================================================================
+//                  allocate and deallocate in batches concurrently
+//-----------------------------------------------------------------------------
+
+namespace batch {
+
+enum {
+    k_MAX_BATCH_SIZE = 64
+};
+
+struct Control {
+    bslmt::Barrier             *d_barrier;
+    bdlma::ConcurrentFixedPool *d_fixedpool;
+    int                         d_iterations;
+};
+
+void bench(Control *control, int threadId)
+{
+    bdlma::ConcurrentFixedPool *pool = control->d_fixedpool;
+
+    void *blocks[k_MAX_BATCH_SIZE];
+
+    control->d_barrier->wait();
+
+    for (int i = 0; i < control->d_iterations; ++i) {
+        const int numBlocks = 1 + (i * 7 + threadId) % k_MAX_BATCH_SIZE;
+
+        int numAllocated = pool->allocateBatch(blocks, numBlocks);
+        LOOP2_ASSERT(numBlocks, numAllocated, numBlocks == numAllocated);
+
+        for (int j = 0; j < numAllocated; ++j) {
+            *static_cast<int *>(blocks[j]) = threadId;
+        }
+        for (int j = 0; j < numAllocated; ++j) {
+            LOOP2_ASSERT(threadId,
+                         j,
+                         threadId == *static_cast<int *>(blocks[j]));
+        }
+
+        if (i % 3) {
+            pool->deallocateBatch(blocks, numAllocated);
+        }
+        else {
+            for (int j = 0; j < numAllocated; ++j) {
+                pool->deallocate(blocks[j]);
+            }
+        }
+    }
+}
+
+void runtest(int numIterations, int numThreads)
+{
+    bdlma::ConcurrentFixedPool pool(sizeof(int),
+                                    numThreads * k_MAX_BATCH_SIZE);
+
+    bslmt::Barrier barrier(numThreads);
+
+    Control control;
+
+    control.d_barrier = &barrier;
+    control.d_fixedpool = &pool;
+    control.d_iterations = numIterations;
+
+    bslmt::ThreadGroup tg;
+    for (int i = 0; i < numThreads; ++i) {
+        tg.addThread(bdlf::BindUtil::bind(&bench, &control, i));
+    }
+
+    tg.joinAll();
+
+    // All blocks are free: allocating the whole pool must yield distinct
+    // blocks.
+
+    const int   poolSize = pool.poolSize();
+    bsl::vector<void *> blocks(poolSize + 1, (void *)0);
+    ASSERT(poolSize == pool.allocateBatch(&blocks[0], poolSize + 1));
+
+    bsl::vector<int> counts(poolSize, 0);
+    for (int i = 0; i < poolSize; ++i) {
+        const int index = pool.indexFromAddress(blocks[i]);
+        ASSERT(0 <= index && index < poolSize);
+        ++counts[index];
+    }
+    for (int i = 0; i < poolSize; ++i) {
+        LOOP_ASSERT(i, 1 == counts[i]);
+    }
+}
+}  // close namespace batch
+
 //=============================================================================
 //                                MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -494,6 +583,105 @@ int main(int argc, char *argv[]) {
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocateBatch' AND 'deallocateBatch'
+        //
+        // Concerns:
+        //: 1 'allocateBatch' allocates the requested number of distinct
+        //:   blocks, taking them first from the free list, in order, and then
+        //:   from the underlying pool.
+        //:
+        //: 2 'allocateBatch' allocates fewer blocks than requested only when
+        //:   the pool is exhausted, as 'allocate' returns 0.
+        //:
+        //: 3 'deallocateBatch' returns the blocks to the free list, so that
+        //:   they are allocated again in the order of the array.
+        //:
+        //: 4 Batches of 0 blocks are supported.
+        //:
+        //: 5 The batch methods can be used concurrently with each other and
+        //:   with 'allocate' and 'deallocate'.
+        //
+        // Plan:
+        //: 1 Allocate the blocks of a pool in batches, and verify the number
+        //:   and the indices of the blocks allocated.  Deallocate a batch, and
+        //:   verify that it is allocated again, in order.  (C-1..4)
+        //:
+        //: 2 In several threads, allocate batches of various sizes, write to
+        //:   the blocks, and deallocate them, in batches or one at a time.
+        //:   Then verify that all the blocks of the pool are distinct.  (C-5)
+        //
+        // Testing:
+        //   int allocateBatch(void **blocks, int numBlocks);
+        //   void deallocateBatch(void *const *blocks, int numBlocks);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'allocateBatch' AND 'deallocateBatch'"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        if (verbose) cout << "\nSingle-threaded." << endl;
+
+        bslma::TestAllocator a;    const bslma::TestAllocator& A = a;
+        {
+            const int OBJECT_SIZE = 8;
+            const int NUM_OBJECTS = 10;
+
+            void *blocks[NUM_OBJECTS + 5];
+
+            Obj mX(OBJECT_SIZE, NUM_OBJECTS, &a);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocateBatch(blocks, 0));
+            ASSERT(4 == mX.allocateBatch(blocks, 4));
+
+            void *p = mX.allocate();
+            ASSERT(4 == X.indexFromAddress(p));
+            mX.deallocate(p);
+
+            // The block just deallocated is taken from the free list first.
+
+            ASSERT(NUM_OBJECTS - 4 == mX.allocateBatch(blocks + 4, 10));
+            ASSERT(p == blocks[4]);
+            ASSERT(0 == mX.allocate());
+            ASSERT(0 == mX.allocateBatch(blocks, 1));
+
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                LOOP_ASSERT(i, i == X.indexFromAddress(blocks[i]));
+            }
+
+            mX.deallocateBatch(blocks, 0);
+            ASSERT(0 == mX.allocate());
+
+            mX.deallocateBatch(blocks + 2, 5);
+
+            void *again[NUM_OBJECTS];
+            ASSERT(3 == mX.allocateBatch(again, 3));
+            for (int i = 0; i < 3; ++i) {
+                LOOP_ASSERT(i, blocks[2 + i] == again[i]);
+            }
+            ASSERT(2 == mX.allocateBatch(again + 3, 3));
+            for (int i = 3; i < 5; ++i) {
+                LOOP_ASSERT(i, blocks[2 + i] == again[i]);
+            }
+            ASSERT(0 == mX.allocate());
+
+            // Mix with 'reserveCapacity'.
+
+            mX.release();
+            ASSERT(0 == mX.reserveCapacity(3));
+            ASSERT(NUM_OBJECTS == mX.allocateBatch(blocks, NUM_OBJECTS + 5));
+        }
+        ASSERT(0 == A.numBytesInUse());
+
+        if (verbose) cout << "\nConcurrently." << endl;
+
+        for (int numThreads = 1; numThreads <= 4; ++numThreads) {
+            batch::runtest(2000, numThreads);
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // Testing dataOffset and nodeSize calculations
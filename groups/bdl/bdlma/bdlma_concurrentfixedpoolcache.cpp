@@ -0,0 +1,109 @@
+// bdlma_concurrentfixedpoolcache.cpp                                 -*-C++-*-
+#include <bdlma_concurrentfixedpoolcache.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                      // ------------------------------
+                      // class ConcurrentFixedPoolCache
+                      // ------------------------------
+
+// PRIVATE MANIPULATORS
+void *ConcurrentFixedPoolCache::allocateFromPool()
+{
+    BSLS_ASSERT(0 == d_numBlocks);
+
+    d_numBlocks = d_pool_p->allocateBatch(d_blocks_p, d_batchSize);
+    if (0 == d_numBlocks) {
+        return 0;                                                     // RETURN
+    }
+    return d_blocks_p[--d_numBlocks];
+}
+
+void ConcurrentFixedPoolCache::deallocateToPool(void *address)
+{
+    BSLS_ASSERT(2 * d_batchSize == d_numBlocks);
+
+    // Return the blocks deallocated least recently, and keep those more likely
+    // to be in the processor cache.
+
+    d_pool_p->deallocateBatch(d_blocks_p, d_batchSize);
+    bsl::memcpy(d_blocks_p,
+                d_blocks_p + d_batchSize,
+                d_batchSize * sizeof *d_blocks_p);
+
+    d_numBlocks = d_batchSize;
+    d_blocks_p[d_numBlocks++] = address;
+}
+
+// CREATORS
+ConcurrentFixedPoolCache::ConcurrentFixedPoolCache(
+                                          ConcurrentFixedPool *pool,
+                                          bslma::Allocator    *basicAllocator)
+: d_pool_p(pool)
+, d_blocks_p(0)
+, d_numBlocks(0)
+, d_batchSize(k_DEFAULT_BATCH_SIZE)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(pool);
+
+    d_blocks_p = static_cast<void **>(d_allocator_p->allocate(
+                                     2 * d_batchSize * sizeof *d_blocks_p));
+}
+
+ConcurrentFixedPoolCache::ConcurrentFixedPoolCache(
+                                          ConcurrentFixedPool *pool,
+                                          int                  batchSize,
+                                          bslma::Allocator    *basicAllocator)
+: d_pool_p(pool)
+, d_blocks_p(0)
+, d_numBlocks(0)
+, d_batchSize(batchSize)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(pool);
+    BSLS_ASSERT(0 < batchSize);
+
+    d_blocks_p = static_cast<void **>(d_allocator_p->allocate(
+                                     2 * d_batchSize * sizeof *d_blocks_p));
+}
+
+ConcurrentFixedPoolCache::~ConcurrentFixedPoolCache()
+{
+    flush();
+    d_allocator_p->deallocate(d_blocks_p);
+}
+
+// MANIPULATORS
+void ConcurrentFixedPoolCache::flush()
+{
+    d_pool_p->deallocateBatch(d_blocks_p, d_numBlocks);
+    d_numBlocks = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,335 @@
+// bdlma_concurrentfixedpoolcache.h                                   -*-C++-*-
+#ifndef INCLUDED_BDLMA_CONCURRENTFIXEDPOOLCACHE
+#define INCLUDED_BDLMA_CONCURRENTFIXEDPOOLCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a per-thread cache of blocks of a concurrent fixed pool.
+//
+//@CLASSES:
+//  bdlma::ConcurrentFixedPoolCache: per-thread cache of fixed pool blocks
+//
+//@SEE_ALSO: bdlma_concurrentfixedpool
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlma::ConcurrentFixedPoolCache', that allocates memory blocks from a
+// 'bdlma::ConcurrentFixedPool' on behalf of a single thread, keeping a small
+// number of free blocks local to that thread.  Every call to 'allocate' and
+// 'deallocate' on a 'bdlma::ConcurrentFixedPool' updates the free list of the
+// pool, a single atomic word shared by all the threads using the pool; a
+// cache instead exchanges blocks with the pool in batches (using
+// 'ConcurrentFixedPool::allocateBatch' and
+// 'ConcurrentFixedPool::deallocateBatch'), so that the free list of the pool
+// is updated once for every *batch* *size* blocks allocated or deallocated
+// through the cache (32 by default).
+//
+// A cache holds at most twice its batch size of free blocks.  When 'allocate'
+// is called on an empty cache, the cache obtains a batch of blocks from the
+// pool; when 'deallocate' is called on a full cache, the cache returns a batch
+// of blocks to the pool.  The blocks held by a cache are returned to the pool
+// by 'flush', and when the cache is destroyed.
+//
+// The blocks allocated through a cache are blocks of the pool: they can be
+// deallocated directly to the pool, or through another cache of the same
+// pool, and 'ConcurrentFixedPool::indexFromAddress' applies to them.
+//
+///Thread Safety
+///-------------
+// A 'bdlma::ConcurrentFixedPoolCache' is *not* thread-safe: it is intended to
+// be used by a single thread (typically, created on the stack of a thread
+// function, or owned by a per-thread object).  Distinct caches of the same
+// pool can be used concurrently by distinct threads, together with the pool
+// itself.
+//
+///Pool Exhaustion
+///---------------
+// As for the pool, 'allocate' returns 0 when the pool is exhausted (i.e., all
+// 'poolSize()' blocks of the pool are allocated) and the cache holds no free
+// block.  Note that free blocks held by the cache of a thread are not
+// available to other threads: a thread may therefore find the pool exhausted
+// while up to twice the batch size of free blocks are held by each of the
+// caches of the other threads.  Pools whose capacity is tight should either
+// be sized accordingly, or use a small batch size.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Messages from Several Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads create and destroy messages at a high rate,
+// the memory for which is supplied by a 'bdlma::ConcurrentFixedPool' limiting
+// the number of messages existing at any time.
+//
+// First, we define the message type:
+//..
+//  struct Message {
+//      int  d_id;
+//      char d_payload[60];
+//  };
+//..
+// Then, we define the function run by each thread, which allocates its
+// messages through a cache of the shared pool, rather than from the pool
+// directly:
+//..
+//  void processMessages(bdlma::ConcurrentFixedPool *pool, int numMessages)
+//  {
+//      bdlma::ConcurrentFixedPoolCache cache(pool);
+//
+//      Message *messages[8];
+//      for (int i = 0; i < numMessages; i += 8) {
+//          for (int j = 0; j < 8; ++j) {
+//              messages[j] = static_cast<Message *>(cache.allocate());
+//              assert(messages[j]);
+//
+//              messages[j]->d_id = i + j;
+//          }
+//          for (int j = 0; j < 8; ++j) {
+//              assert(i + j == messages[j]->d_id);
+//
+//              cache.deallocate(messages[j]);
+//          }
+//      }
+//  }
+//..
+// Now, we create a pool for up to 1024 messages, which is more than enough for
+// the 8 messages each thread uses at a time, and the blocks its cache holds:
+//..
+//  bdlma::ConcurrentFixedPool pool(sizeof(Message), 1024);
+//..
+// Finally, we run the function in 4 threads:
+//..
+//  bslmt::ThreadGroup threadGroup;
+//  threadGroup.addThreads(bdlf::BindUtil::bind(&processMessages,
+//                                              &pool,
+//                                              10000),
+//                         4);
+//  threadGroup.joinAll();
+//..
+// Each thread allocated its blocks from the pool in batches of 32 blocks (the
+// default batch size), and returned them to the pool when its cache was
+// destroyed.
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentfixedpool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deleterhelper.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                      // ==============================
+                      // class ConcurrentFixedPoolCache
+                      // ==============================
+
+class ConcurrentFixedPoolCache {
+    // This class implements a cache of the memory blocks of a
+    // 'ConcurrentFixedPool', used by a single thread, that exchanges blocks
+    // with the pool in batches.
+
+    // DATA
+    ConcurrentFixedPool  *d_pool_p;       // pool supplying the blocks (held,
+                                          // not owned)
+
+    void                **d_blocks_p;     // free blocks held by this cache
+                                          // (the array is owned)
+
+    int                   d_numBlocks;    // number of free blocks held
+
+    const int             d_batchSize;    // number of blocks exchanged with
+                                          // the pool at a time
+
+    bslma::Allocator     *d_allocator_p;  // allocator of 'd_blocks_p' (held,
+                                          // not owned)
+
+    // NOT IMPLEMENTED
+    ConcurrentFixedPoolCache(const ConcurrentFixedPoolCache&);
+    ConcurrentFixedPoolCache& operator=(const ConcurrentFixedPoolCache&);
+
+    // PRIVATE MANIPULATORS
+    void *allocateFromPool();
+        // Obtain a batch of blocks from the pool of this cache, and return
+        // the address of one of them, or 0 if the pool is exhausted.  The
+        // behavior is undefined unless this cache holds no free block.
+
+    void deallocateToPool(void *address);
+        // Return a batch of blocks to the pool of this cache, and then add the
+        // block at the specified 'address' to the free blocks held by this
+        // cache.  The behavior is undefined unless this cache holds twice
+        // its batch size of free blocks.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_DEFAULT_BATCH_SIZE = 32  // batch size used by the constructor not
+                                   // taking one
+    };
+
+    // CREATORS
+    explicit ConcurrentFixedPoolCache(ConcurrentFixedPool *pool,
+                                      bslma::Allocator    *basicAllocator = 0);
+    ConcurrentFixedPoolCache(ConcurrentFixedPool *pool,
+                             int                  batchSize,
+                             bslma::Allocator    *basicAllocator = 0);
+        // Create a cache of the blocks of the specified 'pool', exchanging
+        // blocks with 'pool' in batches of the optionally specified
+        // 'batchSize' blocks.  If 'batchSize' is not specified,
+        // 'k_DEFAULT_BATCH_SIZE' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < batchSize', and 'pool' outlives this cache.
+        // Note that no block is obtained from 'pool' until the first call to
+        // 'allocate'.
+
+    ~ConcurrentFixedPoolCache();
+        // Return the free blocks held by this cache to its pool, and destroy
+        // this object.
+
+    // MANIPULATORS
+    void *allocate();
+        // Allocate a memory block of the 'objectSize()' of the pool of this
+        // cache.  Return the address of that block, or 0 if the pool is
+        // exhausted and this cache holds no free block.
+
+    void deallocate(void *address);
+        // Deallocate the memory block at the specified 'address' to this
+        // cache for reuse.  The behavior is undefined unless 'address' was
+        // allocated from the pool of this cache (directly, or through any of
+        // its caches), and has not already been deallocated.
+
+    template <class TYPE>
+    void deleteObject(const TYPE *object);
+        // Destroy the specified 'object' based on its dynamic type and then
+        // use this cache to deallocate its memory footprint.  Do nothing if
+        // 'object' is 0.  The behavior is undefined unless 'object', when
+        // cast appropriately to 'void *', was allocated from the pool of this
+        // cache and has not already been deallocated.  Note that
+        // 'dynamic_cast<void *>(object)' is applied if 'TYPE' is polymorphic,
+        // and 'static_cast<void *>(object)' is applied otherwise.
+
+    template <class TYPE>
+    void deleteObjectRaw(const TYPE *object);
+        // Destroy the specified 'object' based on its static type and then use
+        // this cache to deallocate its memory footprint.  Do nothing if
+        // 'object' is 0.  The behavior is undefined if 'object' is a
+        // base-class pointer to a derived type, was not allocated from the
+        // pool of this cache, or has already been deallocated.
+
+    void flush();
+        // Return all the free blocks held by this cache to its pool.
+
+    // ACCESSORS
+    int batchSize() const;
+        // Return the number of blocks this cache exchanges with its pool at a
+        // time.
+
+    int numCachedBlocks() const;
+        // Return the number of free blocks held by this cache.
+
+    ConcurrentFixedPool *pool() const;
+        // Return the address of the pool of this cache.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.  Note
+        // that the blocks allocated by this cache are supplied by its pool.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                      // ------------------------------
+                      // class ConcurrentFixedPoolCache
+                      // ------------------------------
+
+// MANIPULATORS
+inline
+void *ConcurrentFixedPoolCache::allocate()
+{
+    if (0 == d_numBlocks) {
+        return allocateFromPool();                                    // RETURN
+    }
+    return d_blocks_p[--d_numBlocks];
+}
+
+inline
+void ConcurrentFixedPoolCache::deallocate(void *address)
+{
+    BSLS_ASSERT(address);
+
+    if (2 * d_batchSize == d_numBlocks) {
+        deallocateToPool(address);
+        return;                                                       // RETURN
+    }
+    d_blocks_p[d_numBlocks++] = address;
+}
+
+template <class TYPE>
+inline
+void ConcurrentFixedPoolCache::deleteObject(const TYPE *object)
+{
+    bslma::DeleterHelper::deleteObject(object, this);
+}
+
+template <class TYPE>
+inline
+void ConcurrentFixedPoolCache::deleteObjectRaw(const TYPE *object)
+{
+    bslma::DeleterHelper::deleteObjectRaw(object, this);
+}
+
+// ACCESSORS
+inline
+int ConcurrentFixedPoolCache::batchSize() const
+{
+    return d_batchSize;
+}
+
+inline
+int ConcurrentFixedPoolCache::numCachedBlocks() const
+{
+    return d_numBlocks;
+}
+
+inline
+ConcurrentFixedPool *ConcurrentFixedPoolCache::pool() const
+{
+    return d_pool_p;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *ConcurrentFixedPoolCache::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
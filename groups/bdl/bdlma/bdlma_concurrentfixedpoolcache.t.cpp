@@ -0,0 +1,766 @@
+// bdlma_concurrentfixedpoolcache.t.cpp                               -*-C++-*-
+#include <bdlma_concurrentfixedpoolcache.h>
+
+#include <bdlma_concurrentfixedpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism caching the blocks of a
+// 'bdlma::ConcurrentFixedPool'.  The cache is observed through its accessors,
+// and through the state of its pool: the number of blocks the pool can still
+// allocate, and the order in which it allocates them.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ConcurrentFixedPoolCache(ConcurrentFixedPool *, Allocator * = 0);
+// [ 2] ConcurrentFixedPoolCache(ConcurrentFixedPool *, int, Allocator * = 0);
+// [ 3] ~ConcurrentFixedPoolCache();
+//
+// MANIPULATORS
+// [ 3] void *allocate();
+// [ 3] void deallocate(void *address);
+// [ 4] void deleteObject(const TYPE *object);
+// [ 4] void deleteObjectRaw(const TYPE *object);
+// [ 3] void flush();
+//
+// ACCESSORS
+// [ 2] int batchSize() const;
+// [ 3] int numCachedBlocks() const;
+// [ 2] ConcurrentFixedPool *pool() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                     STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ConcurrentFixedPoolCache Obj;
+typedef bdlma::ConcurrentFixedPool      Pool;
+
+static int verbose;
+static int veryVerbose;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int numAvailable(Pool *pool)
+    // Return the number of blocks the specified 'pool' can allocate, leaving
+    // the state of 'pool' unchanged, but for the order of its free list.
+{
+    bsl::vector<void *> blocks(pool->poolSize(), static_cast<void *>(0));
+
+    const int numBlocks = pool->allocateBatch(&blocks[0], pool->poolSize());
+    pool->deallocateBatch(&blocks[0], numBlocks);
+    return numBlocks;
+}
+
+static int numDestroyed = 0;
+
+struct Base {
+    // This 'struct' provides a polymorphic base class for testing
+    // 'deleteObject'.
+
+    int d_base;
+
+    virtual ~Base() { ++numDestroyed; }
+};
+
+struct Derived : Base {
+    // This 'struct' provides a class derived from 'Base' for testing
+    // 'deleteObject'.
+
+    int d_derived;
+
+    ~Derived() { ++numDestroyed; }
+};
+
+namespace concurrency {
+
+enum { k_MAX_HELD = 50 };
+
+void work(Pool *pool, bslmt::Barrier *barrier, int threadId, int batchSize)
+    // Allocate and deallocate, through a cache of the specified 'pool' having
+    // the specified 'batchSize', blocks marked with the specified 'threadId',
+    // and verify the marks, after waiting on the specified 'barrier'.
+{
+    Obj   cache(pool, batchSize);
+    void *held[k_MAX_HELD];
+
+    barrier->wait();
+
+    for (int i = 0; i < 2000; ++i) {
+        const int numHeld = 1 + (i * 13 + threadId) % k_MAX_HELD;
+
+        for (int j = 0; j < numHeld; ++j) {
+            held[j] = cache.allocate();
+            LOOP2_ASSERT(threadId, i, held[j]);
+            if (!held[j]) {
+                return;                                               // RETURN
+            }
+            *static_cast<int *>(held[j]) = threadId;
+        }
+        for (int j = 0; j < numHeld; ++j) {
+            LOOP2_ASSERT(threadId,
+                         j,
+                         threadId == *static_cast<int *>(held[j]));
+
+            // Deallocate some blocks directly to the pool.
+
+            if (j % 5) {
+                cache.deallocate(held[j]);
+            }
+            else {
+                pool->deallocate(held[j]);
+            }
+        }
+    }
+}
+
+}  // close namespace concurrency
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Messages from Several Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads create and destroy messages at a high rate,
+// the memory for which is supplied by a 'bdlma::ConcurrentFixedPool' limiting
+// the number of messages existing at any time.
+//
+// First, we define the message type:
+//..
+    struct Message {
+        int  d_id;
+        char d_payload[60];
+    };
+//..
+// Then, we define the function run by each thread, which allocates its
+// messages through a cache of the shared pool, rather than from the pool
+// directly:
+//..
+    void processMessages(bdlma::ConcurrentFixedPool *pool, int numMessages)
+    {
+        bdlma::ConcurrentFixedPoolCache cache(pool);
+
+        Message *messages[8];
+        for (int i = 0; i < numMessages; i += 8) {
+            for (int j = 0; j < 8; ++j) {
+                messages[j] = static_cast<Message *>(cache.allocate());
+                ASSERT(messages[j]);
+
+                messages[j]->d_id = i + j;
+            }
+            for (int j = 0; j < 8; ++j) {
+                ASSERT(i + j == messages[j]->d_id);
+
+                cache.deallocate(messages[j]);
+            }
+        }
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose     = argc > 2;
+    veryVerbose = argc > 3;
+
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Now, we create a pool for up to 1024 messages, which is more than enough for
+// the 8 messages each thread uses at a time, and the blocks its cache holds:
+//..
+    bdlma::ConcurrentFixedPool pool(sizeof(Message), 1024);
+//..
+// Finally, we run the function in 4 threads:
+//..
+    bslmt::ThreadGroup threadGroup;
+    threadGroup.addThreads(bdlf::BindUtil::bind(&processMessages,
+                                                &pool,
+                                                10000),
+                           4);
+    threadGroup.joinAll();
+//..
+// Each thread allocated its blocks from the pool in batches of 32 blocks (the
+// default batch size), and returned them to the pool when its cache was
+// destroyed.
+
+        ASSERT(1024 == numAvailable(&pool));
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Caches of the same pool can be used concurrently by distinct
+        //:   threads, together with the pool itself.
+        //:
+        //: 2 No block is allocated twice, and no block is lost.
+        //
+        // Plan:
+        //: 1 In several threads, each having its own cache of a shared pool,
+        //:   allocate varying numbers of blocks, mark them with the thread
+        //:   id, verify the marks, and deallocate the blocks to the cache or
+        //:   to the pool.  (C-1)
+        //:
+        //: 2 Size the pool so that the threads cannot exhaust it, and verify
+        //:   that all its blocks are available once the caches are destroyed.
+        //:   (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        const int BATCH_SIZES[]   = { 1, 4, 32 };
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        for (int ti = 0; ti < NUM_BATCH_SIZES; ++ti) {
+            const int BATCH_SIZE = BATCH_SIZES[ti];
+
+            for (int numThreads = 1; numThreads <= 4; ++numThreads) {
+                if (veryVerbose) { T_ P_(BATCH_SIZE) P(numThreads) }
+
+                const int POOL_SIZE =
+                     numThreads * (concurrency::k_MAX_HELD + 2 * BATCH_SIZE);
+
+                Pool               pool(sizeof(int), POOL_SIZE);
+                bslmt::Barrier     barrier(numThreads);
+                bslmt::ThreadGroup threadGroup;
+
+                for (int i = 0; i < numThreads; ++i) {
+                    threadGroup.addThread(
+                                   bdlf::BindUtil::bind(&concurrency::work,
+                                                        &pool,
+                                                        &barrier,
+                                                        i,
+                                                        BATCH_SIZE));
+                }
+                threadGroup.joinAll();
+
+                LOOP2_ASSERT(BATCH_SIZE,
+                             numThreads,
+                             POOL_SIZE == numAvailable(&pool));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'deleteObject' AND 'deleteObjectRaw'
+        //
+        // Concerns:
+        //: 1 'deleteObject' destroys the object based on its dynamic type, and
+        //:   deallocates its memory footprint to the cache.
+        //:
+        //: 2 'deleteObjectRaw' destroys the object based on its static type,
+        //:   and deallocates its memory footprint to the cache.
+        //:
+        //: 3 Both methods do nothing if passed a null pointer.
+        //
+        // Plan:
+        //: 1 Create objects in blocks allocated from a cache, delete them
+        //:   through pointers to a base class and to the most-derived class,
+        //:   and verify that the destructors have run, and that the block is
+        //:   held by the cache again.  (C-1..2)
+        //:
+        //: 2 Call both methods with a null pointer.  (C-3)
+        //
+        // Testing:
+        //   void deleteObject(const TYPE *object);
+        //   void deleteObjectRaw(const TYPE *object);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'deleteObject' AND 'deleteObjectRaw'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        Pool pool(sizeof(Derived), 10);
+        Obj  mX(&pool, 4);  const Obj& X = mX;
+
+        {
+            Derived *p = new (mX.allocate()) Derived();
+            ASSERT(3 == X.numCachedBlocks());
+
+            const Base *base = p;
+            numDestroyed = 0;
+            mX.deleteObject(base);
+            ASSERT(2 == numDestroyed);
+            ASSERT(4 == X.numCachedBlocks());
+        }
+        {
+            Derived *p = new (mX.allocate()) Derived();
+            ASSERT(3 == X.numCachedBlocks());
+
+            numDestroyed = 0;
+            mX.deleteObjectRaw(p);
+            ASSERT(2 == numDestroyed);
+            ASSERT(4 == X.numCachedBlocks());
+        }
+        {
+            numDestroyed = 0;
+            mX.deleteObject(static_cast<Base *>(0));
+            mX.deleteObjectRaw(static_cast<Derived *>(0));
+            ASSERT(0 == numDestroyed);
+            ASSERT(4 == X.numCachedBlocks());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocate', 'deallocate', AND 'flush'
+        //
+        // Concerns:
+        //: 1 'allocate' on an empty cache obtains a batch of blocks from the
+        //:   pool, and returns one of them.
+        //:
+        //: 2 'allocate' on a non-empty cache returns the block deallocated
+        //:   most recently, without using the pool.
+        //:
+        //: 3 'deallocate' on a cache holding twice its batch size of blocks
+        //:   returns a batch of blocks to the pool.
+        //:
+        //: 4 'allocate' returns 0 only if the pool is exhausted and the cache
+        //:   is empty; it returns the remaining blocks of the pool, even if
+        //:   fewer than a batch.
+        //:
+        //: 5 'flush' and the destructor return all the blocks held by the
+        //:   cache to the pool.
+        //:
+        //: 6 Blocks allocated from the pool can be deallocated to the cache,
+        //:   and vice versa.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using caches of various batch sizes, allocate and deallocate
+        //:   blocks, and verify the number of blocks held by the cache and
+        //:   available from the pool after each operation.  (C-1..3, 5..6)
+        //:
+        //: 2 Exhaust a pool through a cache, and verify that 'allocate'
+        //:   returns 0 only once all the blocks of the pool are allocated.
+        //:   (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   void *allocate();
+        //   void deallocate(void *address);
+        //   void flush();
+        //   ~ConcurrentFixedPoolCache();
+        //   int numCachedBlocks() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'allocate', 'deallocate', AND 'flush'"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        const int POOL_SIZE = 100;
+
+        if (verbose) cout << "\nBatches." << endl;
+
+        for (int batchSize = 1; batchSize <= 8; ++batchSize) {
+            if (veryVerbose) { T_ P(batchSize) }
+
+            bslma::TestAllocator pa("pool", veryVeryVerbose);
+
+            Pool pool(sizeof(double), POOL_SIZE, &pa);
+            {
+                Obj mX(&pool, batchSize);  const Obj& X = mX;
+
+                ASSERT(0 == X.numCachedBlocks());
+                ASSERT(POOL_SIZE == numAvailable(&pool));
+
+                // Allocating takes a batch from the pool.
+
+                void *p = mX.allocate();
+                ASSERT(p);
+                ASSERT(batchSize - 1 == X.numCachedBlocks());
+                ASSERT(POOL_SIZE - batchSize == numAvailable(&pool));
+
+                // Allocating the cached blocks does not use the pool.
+
+                bsl::vector<void *> blocks;
+                blocks.push_back(p);
+                for (int i = 1; i < batchSize; ++i) {
+                    blocks.push_back(mX.allocate());
+                    ASSERT(batchSize - 1 - i == X.numCachedBlocks());
+                }
+                ASSERT(POOL_SIZE - batchSize == numAvailable(&pool));
+
+                // Deallocating a block and allocating again returns it.
+
+                mX.deallocate(blocks.back());
+                ASSERT(1 == X.numCachedBlocks());
+                ASSERT(blocks.back() == mX.allocate());
+                ASSERT(0 == X.numCachedBlocks());
+
+                // Allocate three batches, and deallocate them: the cache
+                // holds up to two batches.
+
+                for (int i = batchSize; i < 3 * batchSize; ++i) {
+                    blocks.push_back(mX.allocate());
+                }
+                ASSERT(POOL_SIZE - 3 * batchSize == numAvailable(&pool));
+
+                for (int i = 0; i < 3 * batchSize; ++i) {
+                    mX.deallocate(blocks[i]);
+
+                    const int EXP = i < 2 * batchSize
+                                  ? i + 1
+                                  : i + 1 - batchSize;
+                    LOOP2_ASSERT(i, X.numCachedBlocks(),
+                                 EXP == X.numCachedBlocks());
+                }
+                ASSERT(POOL_SIZE - 2 * batchSize == numAvailable(&pool));
+
+                // Blocks of the pool can be deallocated to the cache, and
+                // vice versa.
+
+                void *q = pool.allocate();
+                ASSERT(q);
+                mX.deallocate(q);
+                pool.deallocate(mX.allocate());
+
+                mX.flush();
+                ASSERT(0 == X.numCachedBlocks());
+                ASSERT(POOL_SIZE == numAvailable(&pool));
+
+                p = mX.allocate();
+                ASSERT(batchSize - 1 == X.numCachedBlocks());
+                mX.deallocate(p);
+            }
+            ASSERT(POOL_SIZE == numAvailable(&pool));
+        }
+
+        if (verbose) cout << "\nExhaustion." << endl;
+
+        for (int batchSize = 1; batchSize <= 8; ++batchSize) {
+            Pool pool(sizeof(double), 10);
+            Obj  mX(&pool, batchSize);  const Obj& X = mX;
+
+            void *other = pool.allocate();
+
+            bsl::vector<void *> blocks;
+            for (int i = 0; i < 9; ++i) {
+                void *p = mX.allocate();
+                LOOP2_ASSERT(batchSize, i, p);
+                blocks.push_back(p);
+            }
+            ASSERT(0 == X.numCachedBlocks());
+            ASSERT(0 == mX.allocate());
+            ASSERT(0 == pool.allocate());
+
+            pool.deallocate(other);
+            ASSERT(other == mX.allocate());
+            ASSERT(0 == mX.allocate());
+
+            mX.deallocate(blocks[0]);
+            ASSERT(blocks[0] == mX.allocate());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Pool pool(sizeof(double), 10);
+            Obj  mX(&pool, 2);
+
+            void *p = mX.allocate();
+            ASSERT_FAIL(mX.deallocate(0));
+            ASSERT_PASS(mX.deallocate(p));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors create an empty cache of the specified pool,
+        //:   having the specified batch size, or 'k_DEFAULT_BATCH_SIZE'.
+        //:
+        //: 2 The cache uses the specified allocator, or the default allocator
+        //:   if none is specified, for its own memory only.
+        //:
+        //: 3 No block is obtained from the pool at construction.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create caches with and without a batch size and an allocator, and
+        //:   verify the accessors, the allocators in use, and the pool.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   ConcurrentFixedPoolCache(ConcurrentFixedPool *, Allocator * = 0);
+        //   ConcurrentFixedPoolCache(ConcurrentFixedPool *, int, Alloc* = 0);
+        //   int batchSize() const;
+        //   ConcurrentFixedPool *pool() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS AND BASIC ACCESSORS" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator pa("pool",     veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        Pool pool(sizeof(double), 100, &pa);
+
+        for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+            if (veryVerbose) { T_ P(cfg) }
+
+            const bsls::Types::Int64 NUM_POOL_BYTES = pa.numBytesInUse();
+
+            bslma::TestAllocator da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj *objPtr = 0;
+            int  EXP_BATCH_SIZE = Obj::k_DEFAULT_BATCH_SIZE;
+
+            bslma::TestAllocator& oa = 'a' == cfg || 'c' == cfg ? da : sa;
+
+            // The object itself is allocated from 'sa'.
+
+            const int NUM_BLOCKS = &sa == &oa ? 2 : 1;
+
+            switch (cfg) {
+              case 'a': {
+                objPtr = new (sa) Obj(&pool);
+              } break;
+              case 'b': {
+                objPtr = new (sa) Obj(&pool, &sa);
+              } break;
+              case 'c': {
+                objPtr = new (sa) Obj(&pool, 5);
+                EXP_BATCH_SIZE = 5;
+              } break;
+              case 'd': {
+                objPtr = new (sa) Obj(&pool, 7, &sa);
+                EXP_BATCH_SIZE = 7;
+              } break;
+            }
+
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            LOOP_ASSERT(cfg, EXP_BATCH_SIZE == X.batchSize());
+            LOOP_ASSERT(cfg, &pool          == X.pool());
+            LOOP_ASSERT(cfg, &oa            == X.allocator());
+            LOOP_ASSERT(cfg, 0              == X.numCachedBlocks());
+            LOOP_ASSERT(cfg, NUM_BLOCKS     == oa.numBlocksInUse());
+            LOOP_ASSERT(cfg, NUM_POOL_BYTES == pa.numBytesInUse());
+
+            void *p = mX.allocate();
+            LOOP_ASSERT(cfg, NUM_BLOCKS == oa.numBlocksInUse());
+            mX.deallocate(p);
+
+            sa.deleteObject(objPtr);
+
+            LOOP_ASSERT(cfg, 0 == da.numBlocksInUse());
+            LOOP_ASSERT(cfg, 0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(0));
+            ASSERT_FAIL(Obj(&pool, 0));
+            ASSERT_PASS(Obj(&pool, 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks through a cache, and verify that
+        //:   the blocks are blocks of the pool.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Pool pool(sizeof(int), 64);
+        {
+            Obj mX(&pool);  const Obj& X = mX;
+
+            int *p = static_cast<int *>(mX.allocate());
+            ASSERT(p);
+            *p = 42;
+            ASSERT(0 <= pool.indexFromAddress(p));
+            ASSERT(X.numCachedBlocks() == X.batchSize() - 1);
+
+            int *q = static_cast<int *>(mX.allocate());
+            ASSERT(q);
+            ASSERT(p != q);
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            ASSERT(X.numCachedBlocks() == X.batchSize());
+        }
+        ASSERT(64 == numAvailable(&pool));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
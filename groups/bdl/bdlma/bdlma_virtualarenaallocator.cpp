@@ -0,0 +1,525 @@
+// bdlma_virtualarenaallocator.cpp                                    -*-C++-*-
+#include <bdlma_virtualarenaallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // 'VirtualAlloc', 'VirtualFree'
+
+#else
+
+#include <sys/mman.h>  // 'madvise', 'mmap', 'mprotect', 'munmap'
+
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each arena starts with a header, 'VirtualArenaAllocator_Arena', linking the
+// arenas together, so that the allocator needs no memory other than that of
+// its arenas.  The first 'k_COMMIT_SIZE' bytes of an arena, holding the
+// header, are therefore committed when the arena is reserved, and remain
+// committed until it is unmapped.
+//
+// On UNIX platforms, an arena is reserved by mapping it inaccessible
+// ('PROT_NONE', and 'MAP_NORESERVE' where available, so that it is not
+// charged against the commit limit of the system), and committed by making it
+// accessible with 'mprotect'.  On Windows, 'VirtualAlloc' reserves
+// ('MEM_RESERVE') and commits ('MEM_COMMIT') the memory.
+
+namespace BloombergLP {
+namespace bdlma {
+
+                     // ==================================
+                     // struct VirtualArenaAllocator_Arena
+                     // ==================================
+
+struct VirtualArenaAllocator_Arena {
+    // This component-private 'struct' provides the header of an arena.
+
+    // DATA
+    VirtualArenaAllocator_Arena *d_next_p;             // next arena, if any
+
+    bsls::Types::size_type       d_size;               // size of this arena
+
+    bsls::Types::size_type       d_numBytesCommitted;  // committed bytes,
+                                                       // starting at the
+                                                       // header
+};
+
+}  // close package namespace
+
+namespace {
+
+typedef bdlma::VirtualArenaAllocator::size_type size_type;
+typedef bdlma::VirtualArenaAllocator            Obj;
+
+const size_type k_MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+const size_type k_HEADER_SIZE =
+                         (sizeof(bdlma::VirtualArenaAllocator_Arena)
+                          + k_MAX_ALIGNMENT - 1) & ~(k_MAX_ALIGNMENT - 1);
+
+// HELPER FUNCTIONS
+inline
+size_type roundUp(size_type size, size_type granularity)
+    // Return the specified 'size' rounded up to a multiple of the specified
+    // 'granularity'.  The behavior is undefined unless 'granularity' is a
+    // power of 2, and the result is representable.
+{
+    return (size + granularity - 1) & ~(granularity - 1);
+}
+
+char *systemReserve(size_type size, Obj::PageMode *pageMode)
+    // Reserve the specified 'size' bytes of inaccessible virtual memory,
+    // aligned on 'Obj::k_COMMIT_SIZE' if possible, backed by pages of the
+    // specified '*pageMode'.  Return the address of the memory, or 0 if it
+    // cannot be reserved.  If '*pageMode' is 'e_EXPLICIT_HUGE_PAGES' and the
+    // memory cannot be reserved with explicit huge pages, set '*pageMode' to
+    // 'e_TRANSPARENT_HUGE_PAGES' and reserve the memory accordingly.  The
+    // behavior is undefined unless 'size' is a multiple of
+    // 'Obj::k_COMMIT_SIZE'.
+{
+    const size_type alignment = Obj::k_COMMIT_SIZE;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    if (Obj::e_EXPLICIT_HUGE_PAGES == *pageMode) {
+        // Large pages on Windows must be committed when reserved, and require
+        // a privilege: fall back to the default pages.
+
+        *pageMode = Obj::e_TRANSPARENT_HUGE_PAGES;
+    }
+
+    // Find an aligned range by reserving a larger one, and then reserve the
+    // aligned range within it (which may fail if another thread reserves it
+    // in the meantime, in which case the alignment is forgone).
+
+    void *address = VirtualAlloc(0,
+                                 size + alignment,
+                                 MEM_RESERVE,
+                                 PAGE_NOACCESS);
+    if (!address) {
+        return 0;                                                     // RETURN
+    }
+
+    char *aligned = reinterpret_cast<char *>(
+               roundUp(reinterpret_cast<bsls::Types::UintPtr>(address),
+                       alignment));
+    VirtualFree(address, 0, MEM_RELEASE);
+
+    address = VirtualAlloc(aligned, size, MEM_RESERVE, PAGE_NOACCESS);
+    if (!address) {
+        address = VirtualAlloc(0, size, MEM_RESERVE, PAGE_NOACCESS);
+    }
+    return static_cast<char *>(address);
+
+#else
+
+    int flags = MAP_PRIVATE | MAP_ANON;
+
+#ifdef MAP_HUGETLB
+    if (Obj::e_EXPLICIT_HUGE_PAGES == *pageMode) {
+        // The huge pages are reserved from the pool of the system when
+        // mapped, so that committing the memory later cannot fail for lack of
+        // huge pages.  The system aligns the mapping on the huge page size.
+
+        void *address = mmap(0,
+                             size,
+                             PROT_NONE,
+                             flags | MAP_HUGETLB,
+                             -1,
+                             0);
+        if (MAP_FAILED != address) {
+            return static_cast<char *>(address);                      // RETURN
+        }
+    }
+#endif
+
+    if (Obj::e_EXPLICIT_HUGE_PAGES == *pageMode) {
+        *pageMode = Obj::e_TRANSPARENT_HUGE_PAGES;
+    }
+
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+
+    // Map a larger range, and unmap its unaligned ends.
+
+    void *address = mmap(0, size + alignment, PROT_NONE, flags, -1, 0);
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+    char *begin   = static_cast<char *>(address);
+    char *end     = begin + size + alignment;
+    char *aligned = reinterpret_cast<char *>(
+                roundUp(reinterpret_cast<bsls::Types::UintPtr>(begin),
+                        alignment));
+
+    if (aligned != begin) {
+        munmap(begin, aligned - begin);
+    }
+    if (aligned + size != end) {
+        munmap(aligned + size, end - (aligned + size));
+    }
+
+#ifdef MADV_HUGEPAGE
+    if (Obj::e_TRANSPARENT_HUGE_PAGES == *pageMode) {
+        // Failure (e.g., if transparent huge pages are disabled) is benign.
+
+        madvise(aligned, size, MADV_HUGEPAGE);
+    }
+#endif
+
+    return aligned;
+
+#endif
+}
+
+bool systemCommit(char *address, size_type size)
+    // Commit the specified 'size' bytes of reserved memory at the specified
+    // 'address'.  Return 'true' on success, and 'false' otherwise.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return 0 != VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE);
+
+#else
+
+    return 0 == mprotect(address, size, PROT_READ | PROT_WRITE);
+
+#endif
+}
+
+void systemDecommit(char *address, size_type size)
+    // Decommit the specified 'size' bytes of committed memory at the
+    // specified 'address', returning its physical memory to the operating
+    // system, and keeping its addresses reserved.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, size, MEM_DECOMMIT);
+
+#else
+
+#ifdef MADV_DONTNEED
+    madvise(address, size, MADV_DONTNEED);
+#endif
+    mprotect(address, size, PROT_NONE);
+
+#endif
+}
+
+void systemRelease(char *address, size_type size)
+    // Release the specified 'size' bytes of reserved memory at the specified
+    // 'address'.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void)size;
+
+#else
+
+    munmap(address, size);
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                        // ---------------------------
+                        // class VirtualArenaAllocator
+                        // ---------------------------
+
+// CONSTANTS
+const VirtualArenaAllocator::size_type
+                       VirtualArenaAllocator::k_DEFAULT_ARENA_SIZE = 1 << 30;
+
+const VirtualArenaAllocator::size_type
+                              VirtualArenaAllocator::k_COMMIT_SIZE = 1 << 21;
+
+// PRIVATE MANIPULATORS
+void *VirtualArenaAllocator::allocateSlow(size_type size)
+{
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(0 == size % k_MAX_ALIGNMENT);
+
+    if (!commit(size)) {
+        if (size > d_arenaSize - k_HEADER_SIZE) {
+            // Satisfy the request from an arena of its own, committed at
+            // once, so that the remainder of the current arena is not lost.
+
+            Arena *arena = reserveArena(size + k_HEADER_SIZE, false);
+            if (!arena) {
+                return 0;                                             // RETURN
+            }
+
+            char *base = reinterpret_cast<char *>(arena);
+            if (!systemCommit(base + k_COMMIT_SIZE,
+                              arena->d_size - k_COMMIT_SIZE)) {
+                unreserveArena(arena);
+                return 0;                                             // RETURN
+            }
+            d_numBytesCommitted      += arena->d_size - k_COMMIT_SIZE;
+            arena->d_numBytesCommitted = arena->d_size;
+
+            if (d_arenas_p == arena) {
+                // This is the only arena: it is full.
+
+                d_cursor_p       = base + arena->d_size;
+                d_committedEnd_p = d_cursor_p;
+                d_arenaEnd_p     = d_cursor_p;
+            }
+            return base + k_HEADER_SIZE;                              // RETURN
+        }
+
+        if (!reserveArena(d_arenaSize, true) || !commit(size)) {
+            return 0;                                                 // RETURN
+        }
+    }
+
+    char *address = d_cursor_p;
+    d_cursor_p += size;
+    return address;
+}
+
+bool VirtualArenaAllocator::commit(size_type size)
+{
+    if (!d_arenas_p
+     || size > static_cast<size_type>(d_arenaEnd_p - d_cursor_p)) {
+        return false;                                                 // RETURN
+    }
+
+    const size_type needed    = (d_cursor_p + size) - d_committedEnd_p;
+    const size_type available = d_arenaEnd_p - d_committedEnd_p;
+    const size_type numBytes  = bsl::min(roundUp(needed, k_COMMIT_SIZE),
+                                         available);
+
+    if (!systemCommit(d_committedEnd_p, numBytes)) {
+        return false;                                                 // RETURN
+    }
+
+    d_committedEnd_p                += numBytes;
+    d_arenas_p->d_numBytesCommitted += numBytes;
+    d_numBytesCommitted             += numBytes;
+    return true;
+}
+
+VirtualArenaAllocator::Arena *
+VirtualArenaAllocator::reserveArena(size_type size, bool makeCurrent)
+{
+    size = roundUp(size, k_COMMIT_SIZE);
+
+    char *base = systemReserve(size, &d_pageMode);
+    if (!base) {
+        return 0;                                                     // RETURN
+    }
+    if (!systemCommit(base, k_COMMIT_SIZE)) {
+        systemRelease(base, size);
+        return 0;                                                     // RETURN
+    }
+
+    Arena *arena = new (base) Arena;
+    arena->d_size              = size;
+    arena->d_numBytesCommitted = k_COMMIT_SIZE;
+
+    d_numBytesReserved  += size;
+    d_numBytesCommitted += k_COMMIT_SIZE;
+    ++d_numArenas;
+
+    if (makeCurrent || !d_arenas_p) {
+        arena->d_next_p  = d_arenas_p;
+        d_arenas_p       = arena;
+        d_cursor_p       = base + k_HEADER_SIZE;
+        d_committedEnd_p = base + k_COMMIT_SIZE;
+        d_arenaEnd_p     = base + size;
+    }
+    else {
+        arena->d_next_p       = d_arenas_p->d_next_p;
+        d_arenas_p->d_next_p = arena;
+    }
+    return arena;
+}
+
+void VirtualArenaAllocator::unreserveArena(Arena *arena)
+{
+    BSLS_ASSERT(arena);
+    BSLS_ASSERT(d_arenas_p);
+
+    if (d_arenas_p == arena) {
+        // This is the only arena.
+
+        BSLS_ASSERT(!arena->d_next_p);
+
+        d_arenas_p       = 0;
+        d_cursor_p       = 0;
+        d_committedEnd_p = 0;
+        d_arenaEnd_p     = 0;
+    }
+    else {
+        BSLS_ASSERT(d_arenas_p->d_next_p == arena);
+
+        d_arenas_p->d_next_p = arena->d_next_p;
+    }
+
+    d_numBytesReserved  -= arena->d_size;
+    d_numBytesCommitted -= arena->d_numBytesCommitted;
+    --d_numArenas;
+
+    systemRelease(reinterpret_cast<char *>(arena), arena->d_size);
+}
+
+// CREATORS
+VirtualArenaAllocator::VirtualArenaAllocator(PageMode pageMode)
+: d_arenas_p(0)
+, d_cursor_p(0)
+, d_committedEnd_p(0)
+, d_arenaEnd_p(0)
+, d_arenaSize(k_DEFAULT_ARENA_SIZE)
+, d_numBytesCommitted(0)
+, d_numBytesReserved(0)
+, d_numArenas(0)
+, d_pageMode(pageMode)
+{
+}
+
+VirtualArenaAllocator::VirtualArenaAllocator(PageMode  pageMode,
+                                             size_type arenaSize)
+: d_arenas_p(0)
+, d_cursor_p(0)
+, d_committedEnd_p(0)
+, d_arenaEnd_p(0)
+, d_arenaSize(roundUp(arenaSize, k_COMMIT_SIZE))
+, d_numBytesCommitted(0)
+, d_numBytesReserved(0)
+, d_numArenas(0)
+, d_pageMode(pageMode)
+{
+    BSLS_ASSERT(0 < arenaSize);
+}
+
+VirtualArenaAllocator::~VirtualArenaAllocator()
+{
+    Arena *arena = d_arenas_p;
+    while (arena) {
+        Arena *next = arena->d_next_p;
+        systemRelease(reinterpret_cast<char *>(arena), arena->d_size);
+        arena = next;
+    }
+}
+
+// MANIPULATORS
+void *VirtualArenaAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                   size > ~size_type() - 2 * k_COMMIT_SIZE)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    size = roundUp(size, k_MAX_ALIGNMENT);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+              size <= static_cast<size_type>(d_committedEnd_p - d_cursor_p))) {
+        char *address = d_cursor_p;
+        d_cursor_p += size;
+        return address;                                               // RETURN
+    }
+
+    void *address = allocateSlow(size);
+    if (!address) {
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+    return address;
+}
+
+void VirtualArenaAllocator::release()
+{
+    // Keep the first arena of the standard size, and unmap the others.
+
+    Arena *kept  = 0;
+    Arena *arena = d_arenas_p;
+    while (arena) {
+        Arena *next = arena->d_next_p;
+        if (!kept && d_arenaSize == arena->d_size) {
+            kept = arena;
+        }
+        else {
+            systemRelease(reinterpret_cast<char *>(arena), arena->d_size);
+        }
+        arena = next;
+    }
+
+    d_arenas_p = kept;
+
+    if (!kept) {
+        d_cursor_p          = 0;
+        d_committedEnd_p    = 0;
+        d_arenaEnd_p        = 0;
+        d_numBytesCommitted = 0;
+        d_numBytesReserved  = 0;
+        d_numArenas         = 0;
+        return;                                                       // RETURN
+    }
+
+    char *base = reinterpret_cast<char *>(kept);
+    if (k_COMMIT_SIZE < kept->d_numBytesCommitted) {
+        systemDecommit(base + k_COMMIT_SIZE,
+                       kept->d_numBytesCommitted - k_COMMIT_SIZE);
+    }
+
+    kept->d_next_p            = 0;
+    kept->d_numBytesCommitted = k_COMMIT_SIZE;
+
+    d_cursor_p          = base + k_HEADER_SIZE;
+    d_committedEnd_p    = base + k_COMMIT_SIZE;
+    d_arenaEnd_p        = base + kept->d_size;
+    d_numBytesCommitted = k_COMMIT_SIZE;
+    d_numBytesReserved  = kept->d_size;
+    d_numArenas         = 1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,364 @@
+// bdlma_virtualarenaallocator.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLMA_VIRTUALARENAALLOCATOR
+#define INCLUDED_BDLMA_VIRTUALARENAALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sequential allocator over reserved virtual memory arenas.
+//
+//@CLASSES:
+//  bdlma::VirtualArenaAllocator: arena allocator using (huge) virtual pages
+//
+//@SEE_ALSO: bdlma_sequentialallocator, bdlma_heapbypassallocator
+//
+//@DESCRIPTION: This component provides a concrete mechanism,
+// 'bdlma::VirtualArenaAllocator', implementing the 'bdlma::ManagedAllocator'
+// protocol by allocating memory sequentially from large *arenas* of virtual
+// memory obtained directly from the operating system (using 'mmap' on UNIX
+// platforms and 'VirtualAlloc' on Windows), rather than from the heap:
+//..
+//   ,----------------------------.
+//  ( bdlma::VirtualArenaAllocator )
+//   `----------------------------'
+//                 |         ctor/dtor
+//                 |         arenaSize
+//                 |         numArenas
+//                 |         numBytesCommitted
+//                 |         numBytesReserved
+//                 |         pageMode
+//                 V
+//     ,-----------------------.
+//    ( bdlma::ManagedAllocator )
+//     `-----------------------'
+//                 |         release
+//                 V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                           allocate
+//                           deallocate
+//..
+// An arena is a range of virtual addresses (by default, 1 GiB) that is
+// *reserved* when the first block is allocated from it, and *committed*
+// (i.e., made accessible, and backed by memory when first written) in steps
+// of 2 MiB as allocation proceeds.  A large data structure allocated from an
+// arena therefore occupies contiguous virtual memory, aligned on 2 MiB, and
+// costs no more physical memory than it uses.  When an arena is full, a new
+// arena is reserved; a request larger than the arena size is satisfied by an
+// arena of its own.
+//
+// As for 'bdlma::SequentialAllocator', 'deallocate' has no effect: the memory
+// is reclaimed by 'release', which unmaps all the arenas but one, and
+// decommits that one, but for its first 2 MiB, returning its physical memory
+// to the operating system while keeping its addresses reserved for reuse
+// (with 'madvise(MADV_DONTNEED)' on UNIX platforms).  All the arenas are
+// unmapped when the allocator is destroyed.
+//
+// A 'bdlma::VirtualArenaAllocator' is typically supplied to a pool
+// ('bdlma::Multipool', 'bdlma::Pool', 'bdlma::SequentialAllocator') as its
+// underlying allocator, so that the blocks the pool manages come from the
+// arenas.
+//
+///Huge Pages
+///----------
+// Data sets of several gigabytes accessed at random spend much of their time
+// in TLB misses when mapped by 4 KiB pages.  The page mode supplied at
+// construction selects the pages backing the arenas:
+//
+//: 'e_REGULAR_PAGES':
+//:   The arenas are mapped by pages of the default size.
+//:
+//: 'e_TRANSPARENT_HUGE_PAGES':
+//:   The arenas are marked as eligible for transparent huge pages (with
+//:   'madvise(MADV_HUGEPAGE)'), so that the operating system maps them with
+//:   2 MiB pages when it can.  This has no effect on platforms without
+//:   transparent huge pages (or where they are disabled).
+//:
+//: 'e_EXPLICIT_HUGE_PAGES':
+//:   The arenas are mapped with explicit huge pages ('MAP_HUGETLB' on Linux),
+//:   taken from the pool of huge pages configured by the system administrator
+//:   (e.g., 'vm.nr_hugepages').  The huge pages of an arena are reserved from
+//:   that pool when the arena is mapped, so that the arena size should be
+//:   chosen accordingly.  If an arena cannot be mapped with explicit huge
+//:   pages, the allocator falls back to 'e_TRANSPARENT_HUGE_PAGES' (for this
+//:   and all subsequent arenas), which is then reported by 'pageMode'.
+//
+// On platforms not supporting a page mode, the allocator behaves as for
+// 'e_REGULAR_PAGES'.
+//
+///Thread Safety
+///-------------
+// 'bdlma::VirtualArenaAllocator' is *not* thread-safe, as for
+// 'bdlma::SequentialAllocator'; it can be made thread-safe by wrapping it in a
+// 'bdlma::ConcurrentAllocatorAdapter'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating a Large Data Set from Huge Pages
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we keep a large, randomly accessed, map in memory, and want its
+// nodes to be allocated from memory mapped by huge pages.
+//
+// First, we create an arena allocator requesting transparent huge pages:
+//..
+//  typedef bdlma::VirtualArenaAllocator Arena;
+//
+//  Arena arena(Arena::e_TRANSPARENT_HUGE_PAGES);
+//..
+// Then, we create a multipool on top of it, so that the nodes of the map are
+// pooled, and recycled when erased:
+//..
+//  bdlma::MultipoolAllocator multipool(&arena);
+//..
+// Next, we fill the map:
+//..
+//  {
+//      bsl::map<int, double> book(&multipool);
+//      for (int i = 0; i < 100000; ++i) {
+//          book[i * 7 % 100000] = i;
+//      }
+//..
+// Now, we observe that the memory was obtained from a single arena, of which
+// only a few megabytes were committed:
+//..
+//      assert(1 == arena.numArenas());
+//      assert(arena.numBytesCommitted() <  64 * 1024 * 1024);
+//      assert(arena.numBytesReserved()  == arena.arenaSize());
+//  }
+//..
+// Finally, once the map is destroyed, we release all its memory at once:
+//..
+//  multipool.release();
+//  arena.release();
+//
+//  assert(1 == arena.numArenas());
+//  assert(Arena::k_COMMIT_SIZE == arena.numBytesCommitted());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_managedallocator.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+struct VirtualArenaAllocator_Arena;
+
+                        // ===========================
+                        // class VirtualArenaAllocator
+                        // ===========================
+
+class VirtualArenaAllocator : public ManagedAllocator {
+    // This class implements the 'ManagedAllocator' protocol by allocating
+    // memory sequentially from arenas of virtual memory that are reserved from
+    // the operating system, and committed as needed.
+
+  public:
+    // TYPES
+    typedef bsls::Types::size_type size_type;
+
+    enum PageMode {
+        e_REGULAR_PAGES,           // pages of the default size
+        e_TRANSPARENT_HUGE_PAGES,  // transparent huge pages, if available
+        e_EXPLICIT_HUGE_PAGES      // explicit huge pages
+    };
+
+    // CONSTANTS
+    static const size_type k_DEFAULT_ARENA_SIZE;
+        // arena size used by the constructor not taking one (1 GiB)
+
+    static const size_type k_COMMIT_SIZE;
+        // granularity of the commitment of memory, and alignment of the arenas
+        // (2 MiB, the size of a huge page)
+
+  private:
+    // PRIVATE TYPES
+    typedef VirtualArenaAllocator_Arena Arena;
+
+    // DATA
+    Arena     *d_arenas_p;           // arenas, the first of which is the
+                                     // current arena
+
+    char      *d_cursor_p;           // next free byte of the current arena
+
+    char      *d_committedEnd_p;     // end of the committed memory of the
+                                     // current arena
+
+    char      *d_arenaEnd_p;         // end of the current arena
+
+    size_type  d_arenaSize;          // size of the arenas reserved
+
+    size_type  d_numBytesCommitted;  // memory committed in all arenas
+
+    size_type  d_numBytesReserved;   // memory reserved by all arenas
+
+    int        d_numArenas;          // number of arenas
+
+    PageMode   d_pageMode;           // page mode in effect
+
+    // NOT IMPLEMENTED
+    VirtualArenaAllocator(const VirtualArenaAllocator&);
+    VirtualArenaAllocator& operator=(const VirtualArenaAllocator&);
+
+    // PRIVATE MANIPULATORS
+    void *allocateSlow(size_type size);
+        // Return the address of a block of the specified 'size' (in bytes),
+        // after committing more memory of the current arena, or reserving a
+        // new arena, as needed to allocate it.  Return 0 if the memory cannot
+        // be obtained from the operating system.  The behavior is undefined
+        // unless 'size' is a non-zero multiple of the maximum alignment, and
+        // the current arena has fewer than 'size' committed bytes available.
+
+    bool commit(size_type size);
+        // Commit enough memory of the current arena for a block of the
+        // specified 'size' (in bytes) to be allocated from it.  Return 'true'
+        // on success, and 'false' if the current arena is too small, or if
+        // the memory cannot be committed.
+
+    Arena *reserveArena(size_type size, bool makeCurrent);
+        // Reserve an arena of at least the specified 'size' (in bytes), and
+        // add it to the arenas of this allocator, making it the current arena
+        // if the specified 'makeCurrent' is 'true' or if this allocator has no
+        // arena.  Return the address of the new arena, or 0 if the memory
+        // cannot be reserved.  Note that the first 'k_COMMIT_SIZE' bytes of
+        // the new arena are committed.
+
+    void unreserveArena(Arena *arena);
+        // Remove the specified 'arena' from the arenas of this allocator, and
+        // unmap it.  The behavior is undefined unless 'arena' was added by
+        // the most recent call to 'reserveArena', with 'makeCurrent' being
+        // 'false', and no memory has been allocated from it.
+
+  public:
+    // CREATORS
+    explicit VirtualArenaAllocator(PageMode pageMode = e_REGULAR_PAGES);
+    VirtualArenaAllocator(PageMode pageMode, size_type arenaSize);
+        // Create an arena allocator using the specified 'pageMode', and
+        // reserving arenas of the optionally specified 'arenaSize' (in bytes),
+        // rounded up to a multiple of 'k_COMMIT_SIZE'.  If 'pageMode' is not
+        // specified, 'e_REGULAR_PAGES' is used.  If 'arenaSize' is not
+        // specified, 'k_DEFAULT_ARENA_SIZE' is used.  No memory is reserved
+        // until the first call to 'allocate'.  The behavior is undefined
+        // unless '0 < arenaSize'.
+
+    ~VirtualArenaAllocator() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this allocator, and unmap all its arenas.
+
+    // MANIPULATORS
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the address of a contiguous block of memory of the specified
+        // 'size' (in bytes), aligned to the maximum alignment of the platform.
+        // If 'size' is 0, no memory is allocated and 0 is returned.  If the
+        // memory cannot be obtained from the operating system,
+        // 'bsl::bad_alloc' is thrown (or 0 is returned, if exceptions are
+        // disabled).
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // This method has no effect on the memory block at the specified
+        // 'address' as all memory allocated by this allocator is managed.
+        // The behavior is undefined unless 'address' is 0, or was allocated by
+        // this allocator and has not already been deallocated.
+
+    void release() BSLS_KEYWORD_OVERRIDE;
+        // Release all memory allocated through this allocator: unmap all the
+        // arenas but one of the arena size, and decommit that one but for its
+        // first 'k_COMMIT_SIZE' bytes, keeping its addresses reserved for
+        // subsequent allocations.  The effect of using a pointer obtained
+        // from this allocator prior to this call is undefined.
+
+    // ACCESSORS
+    size_type arenaSize() const;
+        // Return the size of the arenas reserved by this allocator.
+
+    int numArenas() const;
+        // Return the number of arenas currently reserved by this allocator.
+
+    size_type numBytesCommitted() const;
+        // Return the number of bytes of the arenas of this allocator that are
+        // currently committed.
+
+    size_type numBytesReserved() const;
+        // Return the number of bytes of virtual memory currently reserved by
+        // the arenas of this allocator.
+
+    PageMode pageMode() const;
+        // Return the page mode in effect for the arenas of this allocator,
+        // which is the page mode specified at construction, unless explicit
+        // huge pages could not be obtained (see {Huge Pages}).
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // class VirtualArenaAllocator
+                        // ---------------------------
+
+// MANIPULATORS
+inline
+void VirtualArenaAllocator::deallocate(void *)
+{
+}
+
+// ACCESSORS
+inline
+VirtualArenaAllocator::size_type VirtualArenaAllocator::arenaSize() const
+{
+    return d_arenaSize;
+}
+
+inline
+int VirtualArenaAllocator::numArenas() const
+{
+    return d_numArenas;
+}
+
+inline
+VirtualArenaAllocator::size_type
+VirtualArenaAllocator::numBytesCommitted() const
+{
+    return d_numBytesCommitted;
+}
+
+inline
+VirtualArenaAllocator::size_type
+VirtualArenaAllocator::numBytesReserved() const
+{
+    return d_numBytesReserved;
+}
+
+inline
+VirtualArenaAllocator::PageMode VirtualArenaAllocator::pageMode() const
+{
+    return d_pageMode;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,874 @@
+// bdlma_virtualarenaallocator.t.cpp                                  -*-C++-*-
+#include <bdlma_virtualarenaallocator.h>
+
+#include <bdlma_multipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_new.h>
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/resource.h>
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a managed allocator obtaining its memory from
+// the operating system.  The allocator is observed through its accessors,
+// reporting the memory it reserved and committed, and through the addresses
+// of the blocks it allocates, which must be aligned, distinct, and writable.
+// The page modes are tested only to the extent that the platform supports
+// them: explicit huge pages, in particular, are usually not configured on test
+// machines, in which case the allocator must fall back to transparent huge
+// pages.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit VirtualArenaAllocator(PageMode = e_REGULAR_PAGES);
+// [ 2] VirtualArenaAllocator(PageMode, size_type arenaSize);
+// [ 6] ~VirtualArenaAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 6] void release();
+//
+// ACCESSORS
+// [ 2] size_type arenaSize() const;
+// [ 3] int numArenas() const;
+// [ 3] size_type numBytesCommitted() const;
+// [ 3] size_type numBytesReserved() const;
+// [ 7] PageMode pageMode() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] OVERSIZED ALLOCATIONS
+// [ 5] FULL ARENAS
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                     STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::VirtualArenaAllocator Obj;
+typedef Obj::size_type               size_type;
+
+const size_type k_MIB = 1024 * 1024;
+
+const size_type k_MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+static int verbose;
+static int veryVerbose;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool isAligned(const void *address, size_type alignment)
+    // Return 'true' if the specified 'address' is aligned on the specified
+    // 'alignment', and 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address) % alignment;
+}
+
+static void touch(void *address, size_type size)
+    // Write to every page of the block of the specified 'size' at the
+    // specified 'address', and verify that the writes are visible.
+{
+    char *begin = static_cast<char *>(address);
+    for (size_type i = 0; i < size; i += 4096) {
+        begin[i] = static_cast<char>(i / 4096);
+    }
+    begin[size - 1] = 'z';
+    for (size_type i = 0; i < size; i += 4096) {
+        LOOP_ASSERT(i, static_cast<char>(i / 4096) == begin[i]
+                       || (size - 1 == i && 'z' == begin[i]));
+    }
+    ASSERT('z' == begin[size - 1]);
+}
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating a Large Data Set from Huge Pages
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we keep a large, randomly accessed, map in memory, and want its
+// nodes to be allocated from memory mapped by huge pages.
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose     = argc > 2;
+    veryVerbose = argc > 3;
+
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// First, we create an arena allocator requesting transparent huge pages:
+//..
+    typedef bdlma::VirtualArenaAllocator Arena;
+
+    Arena arena(Arena::e_TRANSPARENT_HUGE_PAGES);
+//..
+// Then, we create a multipool on top of it, so that the nodes of the map are
+// pooled, and recycled when erased:
+//..
+    bdlma::MultipoolAllocator multipool(&arena);
+//..
+// Next, we fill the map:
+//..
+    {
+        bsl::map<int, double> book(&multipool);
+        for (int i = 0; i < 100000; ++i) {
+            book[i * 7 % 100000] = i;
+        }
+//..
+// Now, we observe that the memory was obtained from a single arena, of which
+// only a few megabytes were committed:
+//..
+        ASSERT(1 == arena.numArenas());
+        ASSERT(arena.numBytesCommitted() <  64 * 1024 * 1024);
+        ASSERT(arena.numBytesReserved()  == arena.arenaSize());
+    }
+//..
+// Finally, once the map is destroyed, we release all its memory at once:
+//..
+    multipool.release();
+    arena.release();
+
+    ASSERT(1 == arena.numArenas());
+    ASSERT(Arena::k_COMMIT_SIZE == arena.numBytesCommitted());
+//..
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // PAGE MODES
+        //
+        // Concerns:
+        //: 1 Memory can be allocated in every page mode.
+        //:
+        //: 2 'pageMode' returns the page mode supplied at construction for
+        //:   regular and transparent huge pages.
+        //:
+        //: 3 If explicit huge pages cannot be obtained, the allocator falls
+        //:   back to transparent huge pages, and 'pageMode' reports it.
+        //
+        // Plan:
+        //: 1 For each page mode, create an allocator, verify 'pageMode',
+        //:   allocate and write blocks spanning several commit steps, and
+        //:   verify 'pageMode' again.  (C-1..3)
+        //
+        // Testing:
+        //   PageMode pageMode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PAGE MODES" << endl
+                          << "==========" << endl;
+
+        const Obj::PageMode MODES[] = { Obj::e_REGULAR_PAGES,
+                                        Obj::e_TRANSPARENT_HUGE_PAGES,
+                                        Obj::e_EXPLICIT_HUGE_PAGES };
+        const int NUM_MODES = sizeof MODES / sizeof *MODES;
+
+        for (int ti = 0; ti < NUM_MODES; ++ti) {
+            const Obj::PageMode MODE = MODES[ti];
+
+            Obj mX(MODE, 8 * k_MIB);  const Obj& X = mX;
+
+            ASSERTV(ti, MODE == X.pageMode());
+
+            void *p = mX.allocate(5 * k_MIB);
+            ASSERTV(ti, p);
+            touch(p, 5 * k_MIB);
+
+            if (Obj::e_EXPLICIT_HUGE_PAGES == MODE) {
+                ASSERTV(ti, X.pageMode(),
+                        Obj::e_EXPLICIT_HUGE_PAGES     == X.pageMode()
+                     || Obj::e_TRANSPARENT_HUGE_PAGES  == X.pageMode());
+                if (veryVerbose) { T_ P(X.pageMode()) }
+            }
+            else {
+                ASSERTV(ti, MODE == X.pageMode());
+            }
+            ASSERTV(ti, 1 == X.numArenas());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // RELEASE AND DESTRUCTION
+        //
+        // Concerns:
+        //: 1 'release' keeps one arena of the arena size, decommitted but for
+        //:   its first 'k_COMMIT_SIZE' bytes, and unmaps the others.
+        //:
+        //: 2 'release' unmaps dedicated (oversized) arenas.
+        //:
+        //: 3 Memory allocated after 'release' is writable, and is taken from
+        //:   the arena kept.
+        //:
+        //: 4 'release' on an allocator having no arena has no effect.
+        //:
+        //: 5 The destructor unmaps all the arenas.
+        //
+        // Plan:
+        //: 1 Release an allocator that has not allocated.  (C-4)
+        //:
+        //: 2 Fill several arenas, and allocate an oversized block, release the
+        //:   allocator, and verify the accessors.  (C-1..2)
+        //:
+        //: 3 Allocate and write blocks after 'release'.  (C-3)
+        //:
+        //: 4 Release an allocator having only a dedicated arena.  (C-2)
+        //:
+        //: 5 Destroy allocators having several arenas.  (C-5)
+        //
+        // Testing:
+        //   ~VirtualArenaAllocator();
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RELEASE AND DESTRUCTION" << endl
+                          << "=======================" << endl;
+
+        if (verbose) cout << "\nRelease without allocation." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.release();
+            ASSERT(0 == X.numArenas());
+            ASSERT(0 == X.numBytesCommitted());
+            ASSERT(0 == X.numBytesReserved());
+        }
+
+        if (verbose) cout << "\nRelease of several arenas." << endl;
+        {
+            Obj mX(Obj::e_REGULAR_PAGES, 4 * k_MIB);  const Obj& X = mX;
+
+            for (int i = 0; i < 5; ++i) {
+                void *p = mX.allocate(3 * k_MIB);
+                ASSERTV(i, p);
+                touch(p, 3 * k_MIB);
+            }
+            void *big = mX.allocate(9 * k_MIB);
+            ASSERT(big);
+            touch(big, 9 * k_MIB);
+
+            ASSERTV(X.numArenas(), 6 == X.numArenas());
+
+            mX.release();
+            ASSERTV(X.numArenas(), 1 == X.numArenas());
+            ASSERT(Obj::k_COMMIT_SIZE == X.numBytesCommitted());
+            ASSERT(4 * k_MIB          == X.numBytesReserved());
+
+            void *p = mX.allocate(3 * k_MIB);
+            ASSERT(p);
+            touch(p, 3 * k_MIB);
+            ASSERT(1           == X.numArenas());
+            ASSERT(4 * k_MIB   == X.numBytesCommitted());
+
+            mX.release();
+            ASSERT(1                  == X.numArenas());
+            ASSERT(Obj::k_COMMIT_SIZE == X.numBytesCommitted());
+        }
+
+        if (verbose) cout << "\nRelease of a dedicated arena." << endl;
+        {
+            Obj mX(Obj::e_REGULAR_PAGES, 4 * k_MIB);  const Obj& X = mX;
+
+            void *big = mX.allocate(6 * k_MIB);
+            ASSERT(big);
+            touch(big, 6 * k_MIB);
+            ASSERT(1 == X.numArenas());
+
+            mX.release();
+            ASSERT(0 == X.numArenas());
+            ASSERT(0 == X.numBytesCommitted());
+            ASSERT(0 == X.numBytesReserved());
+
+            void *p = mX.allocate(100);
+            ASSERT(p);
+            touch(p, 100);
+            ASSERT(1         == X.numArenas());
+            ASSERT(4 * k_MIB == X.numBytesReserved());
+        }
+
+        if (verbose) cout << "\nDestruction." << endl;
+        {
+            for (int n = 0; n < 4; ++n) {
+                Obj mX(Obj::e_REGULAR_PAGES, 2 * k_MIB);
+
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, mX.allocate(k_MIB));
+                }
+                ASSERTV(n, mX.allocate(3 * k_MIB));
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // FULL ARENAS
+        //
+        // Concerns:
+        //: 1 When the current arena cannot hold a request no larger than the
+        //:   arena size, a new arena of the arena size is reserved, and the
+        //:   request is allocated from it.
+        //:
+        //: 2 The memory of all the arenas remains writable.
+        //
+        // Plan:
+        //: 1 Using a small arena size, allocate blocks filling several arenas,
+        //:   writing to them, and verify the accessors after each allocation.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   FULL ARENAS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FULL ARENAS" << endl
+                          << "===========" << endl;
+
+        const size_type ARENA_SIZE = 4 * k_MIB;
+        const size_type BLOCK_SIZE = k_MIB + k_MAX_ALIGNMENT;
+
+        Obj mX(Obj::e_REGULAR_PAGES, ARENA_SIZE);  const Obj& X = mX;
+
+        char *blocks[12];
+        for (int i = 0; i < 12; ++i) {
+            blocks[i] = static_cast<char *>(mX.allocate(BLOCK_SIZE));
+            ASSERTV(i, blocks[i]);
+            ASSERTV(i, isAligned(blocks[i], k_MAX_ALIGNMENT));
+            bsl::memset(blocks[i], i, BLOCK_SIZE);
+
+            // Three blocks fit in an arena, with its header.
+
+            const int NUM_ARENAS = 1 + i / 3;
+
+            ASSERTV(i, X.numArenas(), NUM_ARENAS == X.numArenas());
+            ASSERTV(i, NUM_ARENAS * ARENA_SIZE == X.numBytesReserved());
+            ASSERTV(i, X.numBytesCommitted() <= X.numBytesReserved());
+
+            if (i % 3) {
+                ASSERTV(i, blocks[i - 1] + BLOCK_SIZE == blocks[i]);
+            }
+        }
+        for (int i = 0; i < 12; ++i) {
+            ASSERTV(i, i == blocks[i][0]);
+            ASSERTV(i, i == blocks[i][BLOCK_SIZE - 1]);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // OVERSIZED ALLOCATIONS
+        //
+        // Concerns:
+        //: 1 A request larger than the arena size is satisfied by an arena of
+        //:   its own, committed at once.
+        //:
+        //: 2 The current arena remains current after an oversized request, so
+        //:   that its remaining memory is not lost.
+        //:
+        //: 3 An oversized request made before any other allocation is
+        //:   satisfied, and subsequent requests reserve an arena of the arena
+        //:   size.
+        //:
+        //: 4 An oversized request whose memory can be reserved but not
+        //:   committed fails, and leaves no arena behind.
+        //
+        // Plan:
+        //: 1 Allocate small blocks, an oversized block, and small blocks
+        //:   again, and verify the addresses and the accessors.  (C-1..2)
+        //:
+        //: 2 Allocate an oversized block from a new allocator, then a small
+        //:   block.  (C-3)
+        //:
+        //: 3 On Linux, lower the limit on the private writable memory of
+        //:   the process ('RLIMIT_DATA') below the size of an oversized
+        //:   request, so that its arena can be reserved but not committed.
+        //:   If the request fails, verify that the accessors are unchanged,
+        //:   and that the current arena is still used.  Do so both before
+        //:   and after other allocations.  Note that kernels older than 4.7
+        //:   do not apply this limit to 'mprotect', in which case the request
+        //:   succeeds and nothing is verified.  (C-4)
+        //
+        // Testing:
+        //   OVERSIZED ALLOCATIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "OVERSIZED ALLOCATIONS" << endl
+                          << "=====================" << endl;
+
+        const size_type ARENA_SIZE = 4 * k_MIB;
+
+        if (verbose) cout << "\nAfter other allocations." << endl;
+        {
+            Obj mX(Obj::e_REGULAR_PAGES, ARENA_SIZE);  const Obj& X = mX;
+
+            char *p = static_cast<char *>(mX.allocate(64));
+            ASSERT(p);
+
+            char *big = static_cast<char *>(mX.allocate(5 * k_MIB));
+            ASSERT(big);
+            ASSERT(isAligned(big, k_MAX_ALIGNMENT));
+            touch(big, 5 * k_MIB);
+
+            ASSERT(2 == X.numArenas());
+            ASSERT(ARENA_SIZE + 6 * k_MIB == X.numBytesReserved());
+            ASSERT(Obj::k_COMMIT_SIZE + 6 * k_MIB == X.numBytesCommitted());
+
+            char *q = static_cast<char *>(mX.allocate(64));
+            ASSERT(p + 64 == q);
+            ASSERT(2 == X.numArenas());
+        }
+
+        if (verbose) cout << "\nBefore other allocations." << endl;
+        {
+            Obj mX(Obj::e_REGULAR_PAGES, ARENA_SIZE);  const Obj& X = mX;
+
+            char *big = static_cast<char *>(mX.allocate(ARENA_SIZE));
+            ASSERT(big);
+            touch(big, ARENA_SIZE);
+
+            ASSERT(1 == X.numArenas());
+            ASSERT(ARENA_SIZE + Obj::k_COMMIT_SIZE == X.numBytesReserved());
+
+            char *p = static_cast<char *>(mX.allocate(64));
+            ASSERT(p);
+            touch(p, 64);
+
+            ASSERT(2 == X.numArenas());
+            ASSERT(2 * ARENA_SIZE + Obj::k_COMMIT_SIZE
+                                                      == X.numBytesReserved());
+        }
+
+        if (verbose) cout << "\nUncommittable requests." << endl;
+#ifdef BSLS_PLATFORM_OS_LINUX
+        for (int ti = 0; ti < 2; ++ti) {
+            const int       NUM_SMALL = ti;
+            const size_type BIG_SIZE  = 512 * k_MIB;
+
+            Obj mX(Obj::e_REGULAR_PAGES, ARENA_SIZE);  const Obj& X = mX;
+
+            char *p = 0;
+            for (int i = 0; i < NUM_SMALL; ++i) {
+                p = static_cast<char *>(mX.allocate(64));
+                ASSERTV(ti, p);
+            }
+
+            const int       NUM_ARENAS    = X.numArenas();
+            const size_type NUM_RESERVED  = X.numBytesReserved();
+            const size_type NUM_COMMITTED = X.numBytesCommitted();
+
+            struct rlimit limit;
+            ASSERTV(ti, 0 == getrlimit(RLIMIT_DATA, &limit));
+
+            struct rlimit lowered = limit;
+            lowered.rlim_cur = 256 * k_MIB;
+            ASSERTV(ti, 0 == setrlimit(RLIMIT_DATA, &lowered));
+
+            void *big = 0;
+#ifdef BDE_BUILD_TARGET_EXC
+            try {
+                big = mX.allocate(BIG_SIZE);
+            }
+            catch (const bsl::bad_alloc&) {
+            }
+#else
+            big = mX.allocate(BIG_SIZE);
+#endif
+
+            ASSERTV(ti, 0 == setrlimit(RLIMIT_DATA, &limit));
+
+            if (veryVerbose) { T_ P_(ti) P(big) }
+
+            if (big) {
+                continue;
+            }
+
+            ASSERTV(ti, X.numArenas(), NUM_ARENAS == X.numArenas());
+            ASSERTV(ti, X.numBytesReserved(),
+                    NUM_RESERVED == X.numBytesReserved());
+            ASSERTV(ti, X.numBytesCommitted(),
+                    NUM_COMMITTED == X.numBytesCommitted());
+
+            char *q = static_cast<char *>(mX.allocate(64));
+            ASSERTV(ti, q);
+            touch(q, 64);
+
+            if (p) {
+                ASSERTV(ti, p + 64 == q);
+            }
+            ASSERTV(ti, X.numArenas(), 1 == X.numArenas());
+            ASSERTV(ti, X.numBytesReserved(),
+                    ARENA_SIZE == X.numBytesReserved());
+        }
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE
+        //
+        // Concerns:
+        //: 1 'allocate' returns 0 for a request of 0 bytes, without reserving
+        //:   memory.
+        //:
+        //: 2 The blocks are aligned on the maximum alignment, distinct,
+        //:   contiguous, and writable.
+        //:
+        //: 3 The first allocation reserves an arena, aligned on
+        //:   'k_COMMIT_SIZE', and commits its first 'k_COMMIT_SIZE' bytes.
+        //:
+        //: 4 Memory is committed in steps of 'k_COMMIT_SIZE' as allocation
+        //:   proceeds.
+        //:
+        //: 5 'deallocate' has no effect.
+        //
+        // Plan:
+        //: 1 Allocate 0 bytes, and verify the accessors.  (C-1)
+        //:
+        //: 2 Allocate blocks of increasing sizes, write to them, and verify
+        //:   their addresses and the accessors.  (C-2..4)
+        //:
+        //: 3 Deallocate blocks, including a null pointer, and verify that the
+        //:   next block follows the last one allocated.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   int numArenas() const;
+        //   size_type numBytesCommitted() const;
+        //   size_type numBytesReserved() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE" << endl
+                          << "========" << endl;
+
+        Obj mX(Obj::e_REGULAR_PAGES, 16 * k_MIB);  const Obj& X = mX;
+
+        if (verbose) cout << "\nZero-size request." << endl;
+
+        ASSERT(0 == mX.allocate(0));
+        ASSERT(0 == X.numArenas());
+        ASSERT(0 == X.numBytesReserved());
+
+        if (verbose) cout << "\nFirst allocation." << endl;
+
+        char *first = static_cast<char *>(mX.allocate(1));
+        ASSERT(first);
+        *first = 'a';
+        ASSERT(1                  == X.numArenas());
+        ASSERT(16 * k_MIB         == X.numBytesReserved());
+        ASSERT(Obj::k_COMMIT_SIZE == X.numBytesCommitted());
+
+        // The arena is aligned on 'k_COMMIT_SIZE', and starts with its header.
+
+        const bsls::Types::UintPtr base =
+                   reinterpret_cast<bsls::Types::UintPtr>(first)
+                 - reinterpret_cast<bsls::Types::UintPtr>(first)
+                                                        % Obj::k_COMMIT_SIZE;
+        ASSERT(reinterpret_cast<bsls::Types::UintPtr>(first) - base
+                                                                 < 4 * 1024);
+
+        if (verbose) cout << "\nIncreasing sizes." << endl;
+
+        char *prev     = first;
+        size_type prevSize = k_MAX_ALIGNMENT;
+        for (size_type size = 2; size < 3 * k_MIB; size = size * 3 + 1) {
+            char *p = static_cast<char *>(mX.allocate(size));
+            ASSERTV(size, p);
+            ASSERTV(size, isAligned(p, k_MAX_ALIGNMENT));
+            ASSERTV(size, prev + prevSize == p);
+            bsl::memset(p, 0x5a, size);
+
+            const size_type used = p + size
+                                 - reinterpret_cast<char *>(base);
+            const size_type committed = (used + Obj::k_COMMIT_SIZE - 1)
+                                      / Obj::k_COMMIT_SIZE
+                                      * Obj::k_COMMIT_SIZE;
+            ASSERTV(size, committed, X.numBytesCommitted(),
+                    committed == X.numBytesCommitted());
+            ASSERTV(size, 1 == X.numArenas());
+
+            prev     = p;
+            prevSize = (size + k_MAX_ALIGNMENT - 1) & ~(k_MAX_ALIGNMENT - 1);
+        }
+        ASSERT('a' == *first);
+
+        if (verbose) cout << "\nDeallocation." << endl;
+
+        mX.deallocate(0);
+        mX.deallocate(prev);
+        mX.deallocate(first);
+
+        char *p = static_cast<char *>(mX.allocate(8));
+        ASSERT(prev + prevSize == p);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default page mode is 'e_REGULAR_PAGES', and the default arena
+        //:   size is 'k_DEFAULT_ARENA_SIZE'.
+        //:
+        //: 2 The arena size is rounded up to a multiple of 'k_COMMIT_SIZE'.
+        //:
+        //: 3 No memory is reserved at construction.
+        //:
+        //: 4 The allocator uses neither the default nor the global allocator.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create allocators with and without the optional arguments, and
+        //:   verify the accessors.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an arena size of 0 (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   explicit VirtualArenaAllocator(PageMode = e_REGULAR_PAGES);
+        //   VirtualArenaAllocator(PageMode, size_type arenaSize);
+        //   size_type arenaSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        ASSERT(1024 * k_MIB == Obj::k_DEFAULT_ARENA_SIZE);
+        ASSERT(   2 * k_MIB == Obj::k_COMMIT_SIZE);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::e_REGULAR_PAGES     == X.pageMode());
+            ASSERT(Obj::k_DEFAULT_ARENA_SIZE == X.arenaSize());
+            ASSERT(0 == X.numArenas());
+            ASSERT(0 == X.numBytesCommitted());
+            ASSERT(0 == X.numBytesReserved());
+        }
+        {
+            Obj mX(Obj::e_TRANSPARENT_HUGE_PAGES);  const Obj& X = mX;
+
+            ASSERT(Obj::e_TRANSPARENT_HUGE_PAGES == X.pageMode());
+            ASSERT(Obj::k_DEFAULT_ARENA_SIZE     == X.arenaSize());
+        }
+
+        static const struct {
+            int       d_line;
+            size_type d_arenaSize;
+            size_type d_expected;
+        } DATA[] = {
+            { L_,             1,     2 * k_MIB },
+            { L_,     2 * k_MIB,     2 * k_MIB },
+            { L_, 2 * k_MIB + 1,     4 * k_MIB },
+            { L_,    64 * k_MIB,    64 * k_MIB },
+            { L_,  4096 * k_MIB,  4096 * k_MIB },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE     = DATA[ti].d_line;
+            const size_type SIZE     = DATA[ti].d_arenaSize;
+            const size_type EXPECTED = DATA[ti].d_expected;
+
+            Obj mX(Obj::e_EXPLICIT_HUGE_PAGES, SIZE);  const Obj& X = mX;
+
+            ASSERTV(LINE, Obj::e_EXPLICIT_HUGE_PAGES == X.pageMode());
+            ASSERTV(LINE, EXPECTED == X.arenaSize());
+            ASSERTV(LINE, 0 == X.numArenas());
+            ASSERTV(LINE, 0 == X.numBytesReserved());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(Obj::e_REGULAR_PAGES, 1));
+            ASSERT_FAIL(Obj(Obj::e_REGULAR_PAGES, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate blocks, write to them, and release them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        int *p = static_cast<int *>(mX.allocate(sizeof(int)));
+        ASSERT(p);
+        *p = 42;
+
+        int *q = static_cast<int *>(mX.allocate(sizeof(int)));
+        ASSERT(q);
+        ASSERT(p != q);
+        *q = 7;
+        ASSERT(42 == *p);
+
+        ASSERT(1 == X.numArenas());
+        ASSERT(Obj::k_DEFAULT_ARENA_SIZE == X.numBytesReserved());
+
+        mX.release();
+        ASSERT(1 == X.numArenas());
+
+        p = static_cast<int *>(mX.allocate(sizeof(int)));
+        ASSERT(p);
+        *p = 1;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -554,6 +554,76 @@ TimerEventScheduler::TimerEventScheduler(
     BSLS_ASSERT(numClocks < (1 << 24) - 1);
 }
 
+TimerEventScheduler::TimerEventScheduler(
+                                   int                          numEvents,
+                                   int                          numClocks,
+                                   const bsls::TimeInterval&    tickGranularity,
+                                   bsls::SystemClockType::Enum  clockType,
+                                   bslma::Allocator            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_clockDataAllocator(sizeof(TimerEventScheduler::ClockData),
+                       basicAllocator)
+, d_eventTimeQueue(bsl::max(NUM_INDEX_BITS_MIN, numBitsRequired(numEvents)),
+                   tickGranularity,
+                   basicAllocator)
+, d_clockTimeQueue(bsl::max(NUM_INDEX_BITS_MIN, numBitsRequired(numClocks)),
+                   tickGranularity,
+                   basicAllocator)
+, d_clocks(basicAllocator)
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_pendingEventItems(basicAllocator)
+, d_currentEventIndex(-1)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(numEvents < (1 << 24) - 1);
+    BSLS_ASSERT(numClocks < (1 << 24) - 1);
+}
+
+TimerEventScheduler::TimerEventScheduler(
+                     int                                     numEvents,
+                     int                                     numClocks,
+                     const bsls::TimeInterval&               tickGranularity,
+                     const TimerEventScheduler::Dispatcher&  dispatcherFunctor,
+                     bsls::SystemClockType::Enum             clockType,
+                     bslma::Allocator                       *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_clockDataAllocator(sizeof(TimerEventScheduler::ClockData), basicAllocator)
+, d_eventTimeQueue(bsl::max(NUM_INDEX_BITS_MIN, numBitsRequired(numEvents)),
+                   tickGranularity,
+                   basicAllocator)
+, d_clockTimeQueue(bsl::max(NUM_INDEX_BITS_MIN, numBitsRequired(numClocks)),
+                   tickGranularity,
+                   basicAllocator)
+, d_clocks(basicAllocator)
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_pendingEventItems(basicAllocator)
+, d_currentEventIndex(-1)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(numEvents < (1 << 24) - 1);
+    BSLS_ASSERT(numClocks < (1 << 24) - 1);
+}
+
 TimerEventScheduler::~TimerEventScheduler()
 {
     stop();
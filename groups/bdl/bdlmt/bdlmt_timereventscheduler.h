@@ -18,7 +18,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlmt::TimerEventScheduler: thread-safe event scheduler
 //
-//@SEE_ALSO: bdlmt_eventscheduler, bdlcc_timequeue
+//@SEE_ALSO: bdlmt_eventscheduler, bdlcc_timequeue, bdlcc_timingwheel
 //
 //@DESCRIPTION: This component provides a thread-safe event scheduler,
 // 'bdlmt::TimerEventScheduler'.  It provides methods to schedule and cancel
@@ -109,6 +109,21 @@ BSLS_IDENT("$Id: $")
 // instance according to the correct clock is available via the
 // 'bdlmt::TimerEventScheduler::now' accessor.
 //
+///Timing-Wheel Backend
+///--------------------
+// By default, pending events and clocks are held in 'bdlcc::TimeQueue'
+// objects, for which scheduling, rescheduling, and cancelling each cost
+// O(log(n)) in the number of pending items.  Applications managing very large
+// numbers of short-lived timers (e.g., I/O timeouts that are almost always
+// cancelled before they expire) can instead supply a tick granularity at
+// construction, in which case pending items are held in 'bdlcc::TimingWheel'
+// objects, for which these operations take constant time.  The granularity
+// affects only the internal bucketing of times, not the observable behavior:
+// events are still dispatched in time order and never before their scheduled
+// time.  A granularity close to the typical spacing between timer expirations
+// (e.g., one millisecond) usually gives the best performance.  The
+// granularity in use is available from the 'tickGranularity' accessor.
+//
 ///Event Clock Substitution
 ///------------------------
 // For testing purposes, a class 'bdlmt::TimerEventSchedulerTestTimeSource' is
@@ -315,20 +330,25 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlcc_objectcatalog.h>
 #include <bdlcc_timequeue.h>
+#include <bdlcc_timingwheel.h>
 
 #include <bdlma_concurrentpool.h>
 
 #include <bslma_allocator.h>
+#include <bslma_default.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
 
 #include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
 
+#include <bsls_assert.h>
 #include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
 #include <bsls_systemclocktype.h>
 #include <bsls_timeinterval.h>
 
@@ -343,6 +363,120 @@ namespace bdlmt {
 struct TimerEventSchedulerDispatcher;
 class  TimerEventSchedulerTestTimeSource_Data;
 
+                    // ===================================
+                    // class TimerEventScheduler_TimeQueue
+                    // ===================================
+
+template <class DATA>
+class TimerEventScheduler_TimeQueue {
+    // This component-private class provides the subset of the
+    // 'bdlcc::TimeQueue' interface used by 'TimerEventScheduler'.  Items are
+    // held in a 'bdlcc::TimeQueue' unless a non-zero tick granularity is
+    // supplied at construction, in which case they are held in a
+    // 'bdlcc::TimingWheel' having that granularity.  Only the backend in use
+    // is constructed.  This class is fully thread-safe: 'bdlcc::TimeQueue' is
+    // itself fully thread-safe, and calls to the 'bdlcc::TimingWheel', which
+    // is not, are serialized by a mutex held by this object.  Note that
+    // 'TimerEventScheduler' relies on this, since it cancels and re-adds
+    // items without holding its own mutex.
+
+    // PRIVATE TYPES
+    typedef bdlcc::TimeQueue<DATA>     Queue;
+    typedef bdlcc::TimingWheel<DATA>   Wheel;
+    typedef bdlcc::TimeQueueItem<DATA> Item;
+
+    // DATA
+    bsls::ObjectBuffer<Queue>  d_queue;        // ordered-map backend,
+                                               // constructed only if
+                                               // 'd_wheel_p' is 0
+
+    Wheel                     *d_wheel_p;      // timing-wheel backend
+                                               // (owned), or 0
+
+    mutable bslmt::Mutex       d_wheelMutex;   // serializes access to
+                                               // '*d_wheel_p'
+
+    bslma::Allocator          *d_allocator_p;  // memory allocator (held)
+
+    // NOT IMPLEMENTED
+    TimerEventScheduler_TimeQueue(const TimerEventScheduler_TimeQueue&);
+    TimerEventScheduler_TimeQueue& operator=(
+                                         const TimerEventScheduler_TimeQueue&);
+
+  public:
+    // TYPES
+    typedef typename Queue::Handle Handle;
+    typedef typename Queue::Key    Key;
+
+    // CREATORS
+    TimerEventScheduler_TimeQueue(int               numIndexBits,
+                                  bslma::Allocator *basicAllocator);
+    TimerEventScheduler_TimeQueue(
+                             int                        numIndexBits,
+                             const bsls::TimeInterval&  tickGranularity,
+                             bslma::Allocator          *basicAllocator);
+        // Create an empty queue having the capacity implied by the specified
+        // 'numIndexBits' (see 'bdlcc::TimeQueue').  Optionally specify a
+        // 'tickGranularity'; if 'tickGranularity' is specified and non-zero,
+        // use a 'bdlcc::TimingWheel' having that granularity, and use a
+        // 'bdlcc::TimeQueue' otherwise.  Use the specified 'basicAllocator'
+        // to supply memory.  The behavior is undefined unless
+        // 'bsls::TimeInterval() <= tickGranularity'.
+
+    ~TimerEventScheduler_TimeQueue();
+        // Destroy this queue.
+
+    // MANIPULATORS
+    Handle add(const bsls::TimeInterval&  time,
+               const DATA&                data,
+               int                       *isNewTop = 0);
+    Handle add(const bsls::TimeInterval&  time,
+               const DATA&                data,
+               const Key&                 key,
+               int                       *isNewTop = 0);
+        // Add the specified 'data' with the specified associated 'time' and
+        // optionally specified 'key' to this queue, load into the optionally
+        // specified 'isNewTop' whether the item is now the earliest in this
+        // queue, and return a handle to the item.
+
+    void popLE(const bsls::TimeInterval&  time,
+               int                        maxTimers,
+               bsl::vector<Item>         *buffer,
+               int                       *newLength,
+               bsls::TimeInterval        *newMinTime);
+        // Remove up to the specified 'maxTimers' items whose associated times
+        // are less than or equal to the specified 'time', in time order,
+        // appending them to the specified 'buffer', and load the number of
+        // remaining items into the specified 'newLength' and, if items
+        // remain, the earliest remaining time into the specified
+        // 'newMinTime'.
+
+    int remove(Handle handle);
+    int remove(Handle handle, const Key& key);
+        // Remove the item having the specified 'handle' and optionally
+        // specified 'key' from this queue.  Return 0 on success, and a
+        // non-zero value if no such item exists.
+
+    void removeAll(bsl::vector<Item> *buffer);
+        // Remove all items from this queue, appending them to the specified
+        // 'buffer'.
+
+    int update(Handle                     handle,
+               const Key&                 key,
+               const bsls::TimeInterval&  newTime,
+               int                       *isNewTop);
+        // Change the time associated with the item having the specified
+        // 'handle' and 'key' to the specified 'newTime', and load into the
+        // specified 'isNewTop' whether the item is now the earliest in this
+        // queue.  Return 0 on success, and a non-zero value if no such item
+        // exists.
+
+    // ACCESSORS
+    bsls::TimeInterval tickGranularity() const;
+        // Return the tick granularity of the timing wheel used by this queue,
+        // or 'bsls::TimeInterval()' if this queue uses a 'bdlcc::TimeQueue'.
+};
+
                          // =========================
                          // class TimerEventScheduler
                          // =========================
@@ -409,9 +543,10 @@ class TimerEventScheduler {
     };
 
     typedef bsl::shared_ptr<ClockData>                   ClockDataPtr;
-    typedef bdlcc::TimeQueue<ClockDataPtr>               ClockTimeQueue;
+    typedef TimerEventScheduler_TimeQueue<ClockDataPtr>  ClockTimeQueue;
     typedef bdlcc::TimeQueueItem<bsl::function<void()> > EventItem;
-    typedef bdlcc::TimeQueue<bsl::function<void()> >     EventTimeQueue;
+    typedef TimerEventScheduler_TimeQueue<bsl::function<void()> >
+                                                         EventTimeQueue;
     typedef bsl::function<bsls::TimeInterval()>          CurrentTimeFunctor;
 
   public:
@@ -627,6 +762,49 @@ class TimerEventScheduler {
         // installed default allocator is used.  The behavior is undefined
         // unless '0 <= numEvents < 2**24' and '0 <= numClocks < 2**24'.
 
+    TimerEventScheduler(int                          numEvents,
+                        int                          numClocks,
+                        const bsls::TimeInterval&    tickGranularity,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+        // Construct a timer event scheduler using the default dispatcher
+        // functor (see the "The dispatcher thread and the dispatcher functor"
+        // section in component level doc) that has the capability to
+        // concurrently schedule *at* *least* the specified 'numEvents' and
+        // 'numClocks', keeps pending events and clocks in timing wheels having
+        // the specified 'tickGranularity' (see {Timing-Wheel Backend} in the
+        // component documentation), and uses the specified 'clockType' to
+        // indicate the epoch used for all time intervals (see {Supported
+        // Clock-Types} in the component documentation).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 <= numEvents < 2**24', '0 <= numClocks < 2**24',
+        // and 'bsls::TimeInterval() <= tickGranularity'.  Note that if
+        // 'tickGranularity' is zero, the default (ordered-map) backend is
+        // used.
+
+    TimerEventScheduler(int                          numEvents,
+                        int                          numClocks,
+                        const bsls::TimeInterval&    tickGranularity,
+                        const Dispatcher&            dispatcherFunctor,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+        // Construct a timer event scheduler using the specified
+        // 'dispatcherFunctor' (see "The dispatcher thread and the dispatcher
+        // functor" section in component level doc) that has the capability to
+        // concurrently schedule *at* *least* the specified 'numEvents' and
+        // 'numClocks', keeps pending events and clocks in timing wheels having
+        // the specified 'tickGranularity' (see {Timing-Wheel Backend} in the
+        // component documentation), and uses the specified 'clockType' to
+        // indicate the epoch used for all time intervals (see {Supported
+        // Clock-Types} in the component documentation).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 <= numEvents < 2**24', '0 <= numClocks < 2**24',
+        // and 'bsls::TimeInterval() <= tickGranularity'.  Note that if
+        // 'tickGranularity' is zero, the default (ordered-map) backend is
+        // used.
+
     ~TimerEventScheduler();
         // Stop this scheduler, discard all the unprocessed events and destroy
         // this object.
@@ -769,6 +947,12 @@ class TimerEventScheduler {
     int numEvents() const;
         // Return a *snapshot* of the number of pending events and events being
         // dispatched in this scheduler.
+
+    bsls::TimeInterval tickGranularity() const;
+        // Return the tick granularity of the timing wheels used by this
+        // scheduler, or 'bsls::TimeInterval()' if this scheduler uses the
+        // default (ordered-map) backend (see {Timing-Wheel Backend} in the
+        // component documentation).
 };
 
                   // =======================================
@@ -827,6 +1011,171 @@ class TimerEventSchedulerTestTimeSource {
 //                            INLINE DEFINITIONS
 // ============================================================================
 
+                    // -----------------------------------
+                    // class TimerEventScheduler_TimeQueue
+                    // -----------------------------------
+
+// CREATORS
+template <class DATA>
+inline
+TimerEventScheduler_TimeQueue<DATA>::TimerEventScheduler_TimeQueue(
+                                             int               numIndexBits,
+                                             bslma::Allocator *basicAllocator)
+: d_wheel_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    new (d_queue.buffer()) Queue(numIndexBits, d_allocator_p);
+}
+
+template <class DATA>
+TimerEventScheduler_TimeQueue<DATA>::TimerEventScheduler_TimeQueue(
+                                 int                        numIndexBits,
+                                 const bsls::TimeInterval&  tickGranularity,
+                                 bslma::Allocator          *basicAllocator)
+: d_wheel_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(bsls::TimeInterval() <= tickGranularity);
+
+    if (bsls::TimeInterval() != tickGranularity) {
+        d_wheel_p = new (*d_allocator_p) Wheel(tickGranularity,
+                                               numIndexBits,
+                                               d_allocator_p);
+    }
+    else {
+        new (d_queue.buffer()) Queue(numIndexBits, d_allocator_p);
+    }
+}
+
+template <class DATA>
+inline
+TimerEventScheduler_TimeQueue<DATA>::~TimerEventScheduler_TimeQueue()
+{
+    if (d_wheel_p) {
+        d_allocator_p->deleteObject(d_wheel_p);
+    }
+    else {
+        d_queue.object().~Queue();
+    }
+}
+
+// MANIPULATORS
+template <class DATA>
+inline
+typename TimerEventScheduler_TimeQueue<DATA>::Handle
+TimerEventScheduler_TimeQueue<DATA>::add(const bsls::TimeInterval&  time,
+                                         const DATA&                data,
+                                         int                       *isNewTop)
+{
+    if (d_wheel_p) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        return d_wheel_p->add(time, data, isNewTop);                  // RETURN
+    }
+    return d_queue.object().add(time, data, isNewTop);
+}
+
+template <class DATA>
+inline
+typename TimerEventScheduler_TimeQueue<DATA>::Handle
+TimerEventScheduler_TimeQueue<DATA>::add(const bsls::TimeInterval&  time,
+                                         const DATA&                data,
+                                         const Key&                 key,
+                                         int                       *isNewTop)
+{
+    if (d_wheel_p) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        return d_wheel_p->add(time, data, key, isNewTop);             // RETURN
+    }
+    return d_queue.object().add(time, data, key, isNewTop);
+}
+
+template <class DATA>
+inline
+void TimerEventScheduler_TimeQueue<DATA>::popLE(
+                                 const bsls::TimeInterval&  time,
+                                 int                        maxTimers,
+                                 bsl::vector<Item>         *buffer,
+                                 int                       *newLength,
+                                 bsls::TimeInterval        *newMinTime)
+{
+    if (d_wheel_p) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        d_wheel_p->popLE(time, maxTimers, buffer, newLength, newMinTime);
+    }
+    else {
+        d_queue.object().popLE(time,
+                               maxTimers,
+                               buffer,
+                               newLength,
+                               newMinTime);
+    }
+}
+
+template <class DATA>
+inline
+int TimerEventScheduler_TimeQueue<DATA>::remove(Handle handle)
+{
+    if (d_wheel_p) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        return d_wheel_p->remove(handle);                             // RETURN
+    }
+    return d_queue.object().remove(handle);
+}
+
+template <class DATA>
+inline
+int TimerEventScheduler_TimeQueue<DATA>::remove(Handle handle, const Key& key)
+{
+    if (d_wheel_p) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        return d_wheel_p->remove(handle, key);                        // RETURN
+    }
+    return d_queue.object().remove(handle, key);
+}
+
+template <class DATA>
+inline
+void TimerEventScheduler_TimeQueue<DATA>::removeAll(bsl::vector<Item> *buffer)
+{
+    if (d_wheel_p) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        d_wheel_p->removeAll(buffer);
+    }
+    else {
+        d_queue.object().removeAll(buffer);
+    }
+}
+
+template <class DATA>
+inline
+int TimerEventScheduler_TimeQueue<DATA>::update(
+                                       Handle                     handle,
+                                       const Key&                 key,
+                                       const bsls::TimeInterval&  newTime,
+                                       int                       *isNewTop)
+{
+    if (d_wheel_p) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_wheelMutex);
+
+        return d_wheel_p->update(handle, key, newTime, isNewTop);     // RETURN
+    }
+    return d_queue.object().update(handle, key, newTime, isNewTop);
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+bsls::TimeInterval TimerEventScheduler_TimeQueue<DATA>::tickGranularity() const
+{
+    return d_wheel_p ? d_wheel_p->tickGranularity() : bsls::TimeInterval();
+}
+
                             // -------------------
                             // TimerEventScheduler
                             // -------------------
@@ -872,6 +1221,12 @@ int TimerEventScheduler::numEvents() const
     return d_numEvents;
 }
 
+inline
+bsls::TimeInterval TimerEventScheduler::tickGranularity() const
+{
+    return d_eventTimeQueue.tickGranularity();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -43,6 +43,7 @@
 #include <bsl_iostream.h>
 #include <bsl_list.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 
 
 using namespace BloombergLP;
@@ -104,6 +105,9 @@ using bsl::flush;
 // [23] bdlmt::TimerEventScheduler(nE, nC, disp, bA = 0);
 // [24] bdlmt::TimerEventScheduler(nE, nC, disp, cT, bA = 0);
 //
+// [29] bdlmt::TimerEventScheduler(nE, nC, tick, cT, bA = 0);
+// [29] bdlmt::TimerEventScheduler(nE, nC, tick, disp, cT, bA = 0);
+//
 //
 // [01] ~bdlmt::TimerEventScheduler();
 //
@@ -134,6 +138,7 @@ using bsl::flush;
 // ACCESSORS
 // [25] bsls::SystemClockType::Enum clockType();
 // [27] bsls::TimeInterval now();
+// [29] bsls::TimeInterval tickGranularity();
 // ----------------------------------------------------------------------------
 // [01] BREATHING TEST
 // [28] DRQS 150475152: AFTER TEST TIME SOURCE DESTRUCTION
@@ -141,7 +146,8 @@ using bsl::flush;
 // [10] TESTING CONCURRENT SCHEDULING AND CANCELLING
 // [11] TESTING CONCURRENT SCHEDULING AND CANCELLING-ALL
 // [26] CLOCK-REPLACEMENT BREATHING TEST
-// [29] USAGE EXAMPLE
+// [29] TESTING TIMING-WHEEL BACKEND
+// [30] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -782,6 +788,63 @@ void my_Server::dataAvailable(my_Server::Connection *connection,
 
 }  // close namespace TIMER_EVENT_SCHEDULER_TEST_CASE_USAGE
 
+// ============================================================================
+//                         CASE 29 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+namespace TIMER_EVENT_SCHEDULER_TEST_CASE_29
+{
+
+void recordId(bsl::vector<int> *ids, int id)
+    // Append the specified 'id' to the specified 'ids'.  Note that this
+    // function is invoked only from the dispatcher thread.
+{
+    ids->push_back(id);
+}
+
+void incrementCount(bsls::AtomicInt *count)
+    // Increment the specified 'count'.
+{
+    ++*count;
+}
+
+void scheduleAndCancel(bdlmt::TimerEventScheduler *scheduler,
+                       int                         numEvents,
+                       bsls::AtomicInt            *numDispatched,
+                       bsls::AtomicInt            *numCancelled)
+    // Schedule the specified 'numEvents' events on the specified 'scheduler',
+    // each incrementing the specified 'numDispatched' and due within a few
+    // milliseconds, cancelling every other event immediately and rescheduling
+    // the others, and increment the specified 'numCancelled' for each
+    // successful cancellation.  Note that the events race with the dispatcher
+    // thread, so cancellations and reschedulings may fail.
+{
+    for (int i = 0; i < numEvents; ++i) {
+        const bsls::TimeInterval time = bsls::SystemTime::nowMonotonicClock()
+                   + bsls::TimeInterval(0, 0).addMicroseconds(i % 7 * 500);
+
+        const bdlmt::TimerEventScheduler::Handle h =
+                                scheduler->scheduleEvent(
+                                    time,
+                                    bdlf::BindUtil::bind(&incrementCount,
+                                                         numDispatched));
+        if (bdlmt::TimerEventScheduler::e_INVALID_HANDLE == h) {
+            continue;
+        }
+        if (0 == i % 2) {
+            if (0 == scheduler->cancelEvent(h)) {
+                ++*numCancelled;
+            }
+        }
+        else {
+            scheduler->rescheduleEvent(
+                          h,
+                          time + bsls::TimeInterval(0, 0).addMicroseconds(1));
+        }
+    }
+}
+
+}  // close namespace TIMER_EVENT_SCHEDULER_TEST_CASE_29
+
 // ============================================================================
 //                         CASE 20 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2755,7 +2818,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 30: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE:
         //
@@ -2780,6 +2843,219 @@ int main(int argc, char *argv[])
         my_Server server(bsls::TimeInterval(10), &ta);
 
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING TIMING-WHEEL BACKEND
+        //
+        // Concerns:
+        //: 1 A scheduler constructed with a non-zero tick granularity reports
+        //:   that granularity, and one constructed without a granularity (or
+        //:   with a zero granularity) reports a zero granularity.
+        //:
+        //: 2 Events scheduled on a timing-wheel scheduler are dispatched in
+        //:   time order, including events whose times are not multiples of
+        //:   the tick granularity.
+        //:
+        //: 3 Cancelled events are not dispatched, and rescheduled events are
+        //:   dispatched at their new time.
+        //:
+        //: 4 Clocks on a timing-wheel scheduler fire at each interval.
+        //:
+        //: 5 No memory is leaked.
+        //:
+        //: 6 Events may be scheduled, rescheduled, and cancelled on a
+        //:   timing-wheel scheduler concurrently from several threads while
+        //:   the dispatcher thread is running.
+        //
+        // Plan:
+        //: 1 Construct schedulers with and without a granularity and verify
+        //:   the value returned by 'tickGranularity'.  (C-1)
+        //:
+        //: 2 Using a test time source, schedule events at distinct times that
+        //:   are not aligned to the granularity, cancel every third event,
+        //:   reschedule every fifth remaining event, and start a clock.
+        //:   Advance the time past all events, wait for the dispatcher to
+        //:   drain the queue, and verify the dispatch order against the
+        //:   expected order and the number of times the clock fired.
+        //:   (C-2..4)
+        //:
+        //: 3 Use a test allocator throughout.  (C-5)
+        //:
+        //: 4 Start a timing-wheel scheduler and, from several threads,
+        //:   schedule events due within a few milliseconds, cancelling or
+        //:   rescheduling each one immediately.  Once the events are due,
+        //:   verify that every event was either cancelled or dispatched
+        //:   exactly once.  (C-6)
+        //
+        // Testing:
+        //   TimerEventScheduler(nE, nC, tick, cT, bA = 0);
+        //   TimerEventScheduler(nE, nC, tick, disp, cT, bA = 0);
+        //   bsls::TimeInterval tickGranularity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TIMING-WHEEL BACKEND" << endl
+                          << "============================" << endl;
+
+        using namespace TIMER_EVENT_SCHEDULER_TEST_CASE_29;
+
+        const bsls::TimeInterval TICK(0, 1000000);  // 1ms
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            bdlmt::TimerEventScheduler x(&ta);
+            ASSERT(bsls::TimeInterval() == x.tickGranularity());
+
+            bdlmt::TimerEventScheduler y(8,
+                                         8,
+                                         bsls::TimeInterval(),
+                                         bsls::SystemClockType::e_MONOTONIC,
+                                         &ta);
+            ASSERT(bsls::TimeInterval() == y.tickGranularity());
+
+            bdlmt::TimerEventScheduler z(8,
+                                         8,
+                                         TICK,
+                                         &TIMER_EVENT_SCHEDULER_TEST_CASE_24::
+                                                            dispatcherFunction,
+                                         bsls::SystemClockType::e_MONOTONIC,
+                                         &ta);
+            ASSERT(TICK == z.tickGranularity());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            enum { k_NUM_EVENTS = 1000 };
+
+            bdlmt::TimerEventScheduler x(k_NUM_EVENTS,
+                                         4,
+                                         TICK,
+                                         bsls::SystemClockType::e_MONOTONIC,
+                                         &ta);
+            ASSERT(TICK == x.tickGranularity());
+
+            bdlmt::TimerEventSchedulerTestTimeSource timeSource(&x);
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            bsl::vector<int> dispatched(&ta);
+            dispatched.reserve(k_NUM_EVENTS);
+
+            bsl::vector<bsl::pair<bsls::TimeInterval, int> > expected(&ta);
+            bsls::AtomicInt                                  clockFired(0);
+
+            // Distinct offsets, in microseconds, spread over about 8 seconds
+            // and not aligned to 'TICK'.
+
+            for (int i = 0; i < k_NUM_EVENTS; ++i) {
+                const bsls::Types::Int64 offset =
+                                      (i * 7919LL) % 10007 * 797 + 1 + i % 3;
+                const bsls::TimeInterval time = T0 +
+                         bsls::TimeInterval(0, 0).addMicroseconds(offset);
+
+                const bdlmt::TimerEventScheduler::Handle h =
+                    x.scheduleEvent(time,
+                                    bdlf::BindUtil::bind(&recordId,
+                                                         &dispatched,
+                                                         i));
+                ASSERTV(i, bdlmt::TimerEventScheduler::e_INVALID_HANDLE != h);
+
+                if (0 == i % 3) {
+                    ASSERTV(i, 0 == x.cancelEvent(h));
+                }
+                else if (0 == i % 5) {
+                    const bsls::TimeInterval newTime =
+                                time + bsls::TimeInterval(0, 0).
+                                             addMicroseconds(10007 * 797 / 2);
+                    ASSERTV(i, 0 == x.rescheduleEvent(h, newTime));
+                    expected.push_back(bsl::make_pair(newTime, i));
+                }
+                else {
+                    expected.push_back(bsl::make_pair(time, i));
+                }
+            }
+            bsl::sort(expected.begin(), expected.end());
+
+            x.startClock(bsls::TimeInterval(1),
+                         bdlf::BindUtil::bind(&incrementCount, &clockFired));
+
+            ASSERT(0 == x.start());
+
+            timeSource.advanceTime(bsls::TimeInterval(20));
+
+            for (int i = 0; i < 1000; ++i) {
+                if (0 == x.numEvents()) {
+                    break;
+                }
+                bslmt::ThreadUtil::microSleep(10000);
+            }
+            for (int i = 0; i < 1000; ++i) {
+                if (20 <= clockFired) {
+                    break;
+                }
+                bslmt::ThreadUtil::microSleep(10000);
+            }
+
+            x.stop();
+
+            ASSERTV(x.numEvents(), 0 == x.numEvents());
+            ASSERTV(expected.size(), dispatched.size(),
+                    expected.size() == dispatched.size());
+            for (bsl::size_t i = 0;
+                 i < expected.size() && i < dispatched.size();
+                 ++i) {
+                ASSERTV(i,
+                        expected[i].second,
+                        dispatched[i],
+                        expected[i].second == dispatched[i]);
+            }
+            ASSERTV(clockFired, 20 == clockFired);
+
+            x.cancelAllClocks();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tConcurrent scheduling and cancellation."
+                          << endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_EVENTS = 2000 };
+
+            bdlmt::TimerEventScheduler x(k_NUM_THREADS * k_NUM_EVENTS,
+                                         4,
+                                         TICK,
+                                         bsls::SystemClockType::e_MONOTONIC,
+                                         &ta);
+
+            bsls::AtomicInt numDispatched(0);
+            bsls::AtomicInt numCancelled(0);
+
+            ASSERT(0 == x.start());
+
+            bslmt::ThreadGroup threads(&ta);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(&scheduleAndCancel,
+                                                       &x,
+                                                       k_NUM_EVENTS,
+                                                       &numDispatched,
+                                                       &numCancelled));
+            }
+            threads.joinAll();
+
+            for (int i = 0; i < 1000; ++i) {
+                if (0 == x.numEvents()) {
+                    break;
+                }
+                bslmt::ThreadUtil::microSleep(10000);
+            }
+            x.stop();
+
+            ASSERTV(x.numEvents(), 0 == x.numEvents());
+            ASSERTV(numDispatched,
+                    numCancelled,
+                    k_NUM_THREADS * k_NUM_EVENTS ==
+                                                numDispatched + numCancelled);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 28: {
         // --------------------------------------------------------------------
         // DRQS 150475152: AFTER TEST TIME SOURCE DESTRUCTION
@@ -4,6 +4,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id$ $CSID$")
 
+#include <bdlsta_summationutil.h>
+
 namespace BloombergLP {
 namespace bdlsta {
 // BDE_VERIFY pragma: -LL01 // Link is just too long
@@ -60,6 +62,53 @@ namespace bdlsta {
 // BDE_VERIFY pragma: +LL01
 //..
 //
+// 'addRange' computes the statistics of chunks of points, merged as by
+// 'merge': the sums using compensated summation, and the 2nd moment by the
+// corrected two-pass algorithm (see the implementation notes of
+// 'bdlsta_moment').
+
+                        // ---------------------
+                        // class bdlsta::LineFit
+                        // ---------------------
+
+// MANIPULATORS
+void LineFit::addRange(const double *xValues,
+                       const double *yValues,
+                       bsl::size_t   numValues)
+{
+    BSLS_ASSERT(xValues || 0 == numValues);
+    BSLS_ASSERT(yValues || 0 == numValues);
+    BSLS_ASSERT(numValues <= static_cast<bsl::size_t>(INT_MAX - d_count));
+
+    // The chunks are small enough for the second pass over a chunk to find
+    // it in the cache.
+
+    const bsl::size_t k_CHUNK_SIZE = 1024;
+
+    while (0 < numValues) {
+        const bsl::size_t size = numValues < k_CHUNK_SIZE ? numValues
+                                                          : k_CHUNK_SIZE;
+        const double      n    = static_cast<double>(size);
+
+        LineFit chunk;
+        chunk.d_count = static_cast<int>(size);
+        chunk.d_xSum  = SummationUtil::sum(xValues, size);
+        chunk.d_ySum  = SummationUtil::sum(yValues, size);
+        chunk.d_xMean = chunk.d_xSum / n;
+        chunk.d_xySum = SummationUtil::sumOfProducts(xValues, yValues, size);
+
+        double sums[2];
+        SummationUtil::sumPowers(sums, 2, xValues, size, chunk.d_xMean);
+        chunk.d_M2 = sums[1] - sums[0] * sums[0] / n;
+
+        merge(chunk);
+
+        xValues   += size;
+        yValues   += size;
+        numValues -= size;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
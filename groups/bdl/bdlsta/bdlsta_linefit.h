@@ -23,6 +23,12 @@ BSLS_IDENT("$Id: $")
 // Note that the behavior is undefined if there are less than 2 data points, or
 // if all the X's (dependent variable) are the same.
 //
+// Points stored in arrays can be added in a batch using 'addRange', which
+// uses compensated summation, so that the result is at least as accurate as
+// that of calling 'add' for each point (see
+// {'bdlsta_moment'|Batch Accumulation}), and which can be run by several
+// threads using 'bdlsta::ParallelUtil'.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -61,7 +67,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bsl_climits.h>
 #include <bsl_cmath.h>
+#include <bsl_cstddef.h>
 
 #include <bsls_assert.h>
 #include <bsls_review.h>
@@ -102,6 +110,24 @@ class LineFit {
     void add(double xValue, double yValue);
         // Add the specified '(xValue, yValue)' point to the data set.
 
+    void addRange(const double *xValues,
+                  const double *yValues,
+                  bsl::size_t   numValues);
+        // Add to the data set the specified 'numValues' points whose X's are
+        // the elements of the specified 'xValues' array and whose Y's are the
+        // corresponding elements of the specified 'yValues' array.  The
+        // result agrees with that of calling 'add' for each point to within
+        // the error bound of the latter.  The behavior is undefined unless
+        // 'xValues' and 'yValues' each refer to at least 'numValues'
+        // elements, or '0 == numValues', and
+        // 'numValues <= INT_MAX - count()'.
+
+    void merge(const LineFit& other);
+        // Add the data set of the specified 'other' object to the data set of
+        // this object, as if each point added to 'other' had been added to
+        // this object.  This allows data sets accumulated separately (e.g.,
+        // by several threads) to be reduced to a single result.
+
     // ACCESSORS
     int count() const;
         // Returns the number of elements in the data set.
@@ -154,6 +180,7 @@ class LineFit {
                         // ---------------------
 
 // CREATORS
+inline
 LineFit::LineFit()
 : d_count(0)
 , d_xMean(0.0)
@@ -178,6 +205,33 @@ void LineFit::add(double xValue, double yValue)
     d_xySum += xValue * yValue;
 }
 
+inline
+void LineFit::merge(const LineFit& other)
+{
+    if (0 == other.d_count) {
+        return;                                                       // RETURN
+    }
+    if (0 == d_count) {
+        *this = other;
+        return;                                                       // RETURN
+    }
+
+    // The 2nd moments of the X's are combined as in the pairwise algorithm of
+    // Chan, Golub, and LeVeque; the sums are simply added.
+
+    const double na    = static_cast<double>(d_count);
+    const double nb    = static_cast<double>(other.d_count);
+    const double n     = na + nb;
+    const double delta = other.d_xMean - d_xMean;
+
+    d_count += other.d_count;
+    d_xSum  += other.d_xSum;
+    d_ySum  += other.d_ySum;
+    d_xMean  = d_xSum / n;
+    d_M2    += other.d_M2 + delta * delta * na * nb / n;
+    d_xySum += other.d_xySum;
+}
+
 // ACCESSORS
 inline
 int LineFit::count() const
@@ -42,10 +42,12 @@ using namespace bsl;
 // [ 3] int yMeanIfValid(double *)
 // [ 2] double variance()
 // [ 3] int varianceIfValid(double *)
+// [ 5] void merge(const LineFit& other)
+// [ 6] void addRange(const double *, const double *, bsl::size_t)
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 4] EDGE CASES
-// [ 5] USAGE EXAMPLE
+// [ 7] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -115,6 +117,43 @@ void aSsErT(bool condition, const char *message, int line)
 
 typedef bdlsta::LineFit Obj;
 
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+double relativeError(double value, double expected)
+    // Return the error of the specified 'value' relative to the specified
+    // 'expected' value, or the absolute error if 'expected' is 0.
+{
+    return 0.0 == expected ? fabs(value)
+                           : fabs(value - expected) / fabs(expected);
+}
+
+static
+void loadRandomPoints(bsl::vector<double> *xValues,
+                      bsl::vector<double> *yValues,
+                      int                  numValues,
+                      double               offset,
+                      unsigned int         seed)
+    // Load into the specified 'xValues' and 'yValues' the coordinates of the
+    // specified 'numValues' pseudo-random points, whose X's are uniformly
+    // distributed in '[offset, offset + 1)', and whose Y's are about
+    // '2 - 3 * X', generated from the specified 'seed'.
+{
+    xValues->resize(numValues);
+    yValues->resize(numValues);
+    for (int i = 0; i < numValues; ++i) {
+        seed = seed * 1103515245 + 12345;
+        const double x = offset + static_cast<double>(seed >> 8) / (1 << 24);
+        seed = seed * 1103515245 + 12345;
+        const double noise = static_cast<double>(seed >> 8) / (1 << 24) - 0.5;
+
+        (*xValues)[i] = x;
+        (*yValues)[i] = 2.0 - 3.0 * x + noise;
+    }
+}
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -131,7 +170,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 5: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -186,6 +225,193 @@ int main(int argc, char *argv[])
   ASSERT(1e-3 >  fabs(0.9   - beta ));
 //..
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'addRange'
+        //
+        // Concerns:
+        //: 1 'addRange' adds each point of the arrays to the data set.
+        //:
+        //: 2 The results agree with those of calling 'add' for each point to
+        //:   within the documented error bound, including for arrays spanning
+        //:   several chunks.
+        //:
+        //: 3 'addRange' can be mixed with 'add', and adding empty arrays is a
+        //:   no-op.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arrays of pseudo-random points of various sizes and offsets,
+        //:   compare the results of 'addRange' with those of 'add', after
+        //:   adding a few points with 'add'.  (C-1..3)
+        //:
+        //: 2 Verify that null arrays are detected, unless they are empty.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void addRange(const double *, const double *, bsl::size_t)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'addRange'" << endl
+                          << "==================" << endl;
+
+        const int    SIZES[]     = { 0, 1, 2, 3, 4, 5, 7, 255, 256, 257,
+                                     4095, 4096, 4097, 10000, 100003 };
+        const int    NUM_SIZES   = static_cast<int>(sizeof SIZES
+                                                             / sizeof *SIZES);
+        const double OFFSETS[]   = { 0.0, -0.5, 10.0, 1e3 };
+        const int    NUM_OFFSETS = static_cast<int>(sizeof OFFSETS
+                                                           / sizeof *OFFSETS);
+        const double EPS         = 2.220446049250313e-16;
+
+        const double PREFIX_X[] = { 0.5, 0.0, 1.0 };
+        const double PREFIX_Y[] = { 1.5, 2.0, -1.0 };
+
+        bsl::vector<double> xValues;
+        bsl::vector<double> yValues;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            for (int tj = 0; tj < NUM_OFFSETS; ++tj) {
+                const int    SIZE   = SIZES[ti];
+                const double OFFSET = OFFSETS[tj];
+
+                loadRandomPoints(&xValues, &yValues, SIZE, OFFSET, ti + tj);
+
+                Obj scalar;
+                Obj batch;
+
+                for (int i = 0; i < 3; ++i) {
+                    scalar.add(OFFSET + PREFIX_X[i], PREFIX_Y[i]);
+                    batch.add(OFFSET + PREFIX_X[i], PREFIX_Y[i]);
+                }
+                for (int i = 0; i < SIZE; ++i) {
+                    scalar.add(xValues[i], yValues[i]);
+                }
+                batch.addRange(xValues.data(), yValues.data(), SIZE);
+
+                const int N = SIZE + 3;
+
+                ASSERTV(SIZE, OFFSET, N == batch.count());
+
+                // The fit computed by 'add' loses about as many digits as the
+                // square of the ratio of the mean of the X's to their standard
+                // deviation.
+
+                const double TOLERANCE = 4 * N * EPS;
+                const double RATIO     = 1.0 + fabs(OFFSET) / 0.3;
+                const double TOL2      = TOLERANCE * RATIO * RATIO;
+
+                double scalarAlpha, scalarBeta, batchAlpha, batchBeta;
+                scalar.fit(&scalarAlpha, &scalarBeta);
+                batch.fit(&batchAlpha, &batchBeta);
+
+                if (veryVerbose) {
+                    P_(SIZE) P_(OFFSET) P_(batchAlpha - scalarAlpha)
+                    P(batchBeta - scalarBeta)
+                }
+
+                ASSERTV(SIZE, OFFSET, batch.xMean(), scalar.xMean(),
+                        relativeError(batch.xMean(), scalar.xMean())
+                                                                 < TOLERANCE);
+                ASSERTV(SIZE, OFFSET, batch.yMean(), scalar.yMean(),
+                        relativeError(batch.yMean(), scalar.yMean())
+                                                           < TOLERANCE * 10);
+                ASSERTV(SIZE, OFFSET, batch.variance(), scalar.variance(),
+                        relativeError(batch.variance(), scalar.variance())
+                                                          < TOLERANCE * RATIO);
+                ASSERTV(SIZE, OFFSET, batchBeta, scalarBeta,
+                        relativeError(batchBeta, scalarBeta) < TOL2);
+                ASSERTV(SIZE, OFFSET, batchAlpha, scalarAlpha,
+                        relativeError(batchAlpha, scalarAlpha) < TOL2 * RATIO);
+            }
+        }
+
+        if (verbose) cout << "\tAdding empty arrays." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.addRange(0, 0, 0);
+            ASSERT(0 == X.count());
+
+            mX.add(2.0, 3.0);
+            mX.addRange(PREFIX_X, PREFIX_Y, 0);
+            ASSERT(1   == X.count());
+            ASSERT(2.0 == X.xMean());
+            ASSERT(3.0 == X.yMean());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            ASSERT_PASS(mX.addRange(0,        0,        0));
+            ASSERT_FAIL(mX.addRange(0,        PREFIX_Y, 1));
+            ASSERT_FAIL(mX.addRange(PREFIX_X, 0,        1));
+            ASSERT_PASS(mX.addRange(PREFIX_X, PREFIX_Y, 3));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'merge'
+        //
+        // Concerns:
+        //: 1 Merging two objects yields the count, means, variance, and fit
+        //:   of the union of their data sets.
+        //:
+        //: 2 Merging an empty object is a no-op, and merging into an empty
+        //:   object copies the other object.
+        //
+        // Plan:
+        //: 1 For every split point of a data set (including 0 and the size of
+        //:   the data set), accumulate the two parts into separate objects,
+        //:   merge them, and compare the results with those of an object to
+        //:   which the whole data set was added.  (C-1, 2)
+        //
+        // Testing:
+        //   void merge(const LineFit& other)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'merge'" << endl
+                          << "===============" << endl;
+
+        const double X[] = { 1.0, 2.0, 4.0, 5.0, -3.0, 10.5, 7.25, 0.0 };
+        const double Y[] = { 1.0, 2.0, 4.0, 4.5, -2.0,  9.0, 8.00, 0.5 };
+        const int    NUM_DATA = static_cast<int>(sizeof X / sizeof *X);
+
+        Obj whole;
+        for (int i = 0; i < NUM_DATA; ++i) {
+            whole.add(X[i], Y[i]);
+        }
+        double wholeAlpha, wholeBeta;
+        whole.fit(&wholeAlpha, &wholeBeta);
+
+        for (int split = 0; split <= NUM_DATA; ++split) {
+            Obj a, b;
+            for (int i = 0; i < NUM_DATA; ++i) {
+                (i < split ? a : b).add(X[i], Y[i]);
+            }
+            a.merge(b);
+
+            double alpha, beta;
+            a.fit(&alpha, &beta);
+
+            if (veryVerbose) {
+                P_(split) P_(alpha) P(beta);
+            }
+
+            ASSERTV(split, NUM_DATA == a.count());
+            ASSERTV(split, fabs(whole.xMean()    - a.xMean())    < 1e-10);
+            ASSERTV(split, fabs(whole.yMean()    - a.yMean())    < 1e-10);
+            ASSERTV(split, fabs(whole.variance() - a.variance()) < 1e-10);
+            ASSERTV(split, fabs(wholeAlpha       - alpha)        < 1e-10);
+            ASSERTV(split, fabs(wholeBeta        - beta)         < 1e-10);
+        }
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // TESTING EDGE CASES
@@ -4,12 +4,100 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id$ $CSID$")
 
+#include <bdlsta_summationutil.h>
+
 namespace BloombergLP {
 namespace bdlsta {
 //@IMPLEMENTATION NOTES:
 //
 // Note that all functions are inlined, and each value added does not take
 // more than one division.
+//
+// The exception is 'loadRange', used by 'addRange', which computes the
+// statistics of a chunk of values by the corrected two-pass algorithm.  The
+// first pass computes the mean 'm' of the values; the second computes the
+// sums 'Sk' of the powers 'k' of the deviations of the values from 'm'.  Since
+// 'm' is rounded, 'S1' is not exactly zero, and the sums are corrected to be
+// about the exact mean 'm + d', where 'd = S1 / n':
+//..
+//  M2 = S2 - n * d^2
+//  M3 = S3 - 3 * d * S2 + 2 * n * d^3
+//  M4 = S4 - 4 * d * S3 + 6 * d^2 * S2 - 3 * n * d^4
+//..
+
+                        // --------------------
+                        // class bdlsta::Moment
+                        // --------------------
+
+// PRIVATE MANIPULATORS
+template <>
+void Moment<MomentLevel::e_M1>::loadRange(const double *values, int numValues)
+{
+    BSLS_ASSERT(1 <= numValues);
+
+    d_data.d_count = numValues;
+    d_data.d_sum   = SummationUtil::sum(values, numValues);
+}
+
+template <>
+void Moment<MomentLevel::e_M2>::loadRange(const double *values, int numValues)
+{
+    BSLS_ASSERT(1 <= numValues);
+
+    const double n = numValues;
+
+    d_data.d_count = numValues;
+    d_data.d_sum   = SummationUtil::sum(values, numValues);
+    d_data.d_mean  = d_data.d_sum / n;
+
+    double sums[2];
+    SummationUtil::sumPowers(sums, 2, values, numValues, d_data.d_mean);
+
+    const double d = sums[0] / n;
+    d_data.d_M2 = sums[1] - n * d * d;
+}
+
+template <>
+void Moment<MomentLevel::e_M3>::loadRange(const double *values, int numValues)
+{
+    BSLS_ASSERT(1 <= numValues);
+
+    const double n = numValues;
+
+    d_data.d_count = numValues;
+    d_data.d_sum   = SummationUtil::sum(values, numValues);
+    d_data.d_mean  = d_data.d_sum / n;
+
+    double sums[3];
+    SummationUtil::sumPowers(sums, 3, values, numValues, d_data.d_mean);
+
+    const double d = sums[0] / n;
+    d_data.d_M2 = sums[1] - n * d * d;
+    d_data.d_M3 = sums[2] - 3.0 * d * sums[1] + 2.0 * n * d * d * d;
+}
+
+template <>
+void Moment<MomentLevel::e_M4>::loadRange(const double *values, int numValues)
+{
+    BSLS_ASSERT(1 <= numValues);
+
+    const double n = numValues;
+
+    d_data.d_count = numValues;
+    d_data.d_sum   = SummationUtil::sum(values, numValues);
+    d_data.d_mean  = d_data.d_sum / n;
+
+    double sums[4];
+    SummationUtil::sumPowers(sums, 4, values, numValues, d_data.d_mean);
+
+    const double d  = sums[0] / n;
+    const double d2 = d * d;
+    d_data.d_M2 = sums[1] - n * d2;
+    d_data.d_M3 = sums[2] - 3.0 * d * sums[1] + 2.0 * n * d2 * d;
+    d_data.d_M4 = sums[3] - 4.0 * d * sums[2] + 6.0 * d2 * sums[1]
+                - 3.0 * n * d2 * d2;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
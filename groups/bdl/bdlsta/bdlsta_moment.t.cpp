@@ -40,10 +40,12 @@ using namespace bsl;
 // [ 2] skewIfValid()
 // [ 2] variance()
 // [ 2] varianceIfValid()
+// [ 4] merge(const Moment& other)
+// [ 5] addRange(const double *values, bsl::size_t numValues)
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 3] EDGE CASES
-// [ 4] USAGE EXAMPLE
+// [ 6] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -116,6 +118,39 @@ typedef bdlsta::Moment<bdlsta::MomentLevel::e_M2> ObjV;
 typedef bdlsta::Moment<bdlsta::MomentLevel::e_M3> ObjS;
 typedef bdlsta::Moment<bdlsta::MomentLevel::e_M4> ObjK;
 
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+double relativeError(double value, double expected)
+    // Return the error of the specified 'value' relative to the specified
+    // 'expected' value, or the absolute error if 'expected' is 0.
+{
+    return 0.0 == expected ? fabs(value)
+                           : fabs(value - expected) / fabs(expected);
+}
+
+static
+void loadRandomValues(bsl::vector<double> *values,
+                      int                  numValues,
+                      double               offset,
+                      unsigned int         seed)
+    // Load into the specified 'values' the specified 'numValues' pseudo-random
+    // values, uniformly distributed in '[offset, offset + 1)' but for a few
+    // outliers, generated from the specified 'seed'.
+{
+    values->resize(numValues);
+    for (int i = 0; i < numValues; ++i) {
+        seed = seed * 1103515245 + 12345;
+        double value = static_cast<double>(seed >> 8) / (1 << 24);
+        if (0 == i % 97) {
+            value *= 10.0;
+        }
+        (*values)[i] = offset + value;
+    }
+}
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -132,7 +167,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 4: {
+      case 6: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -182,6 +217,243 @@ int main(int argc, char *argv[])
     ASSERT(1e-5 > fabs(0.0     - m3.skew()));
 //..
       } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'addRange'
+        //
+        // Concerns:
+        //: 1 'addRange' adds each value of the array to the data set, for
+        //:   every moment level.
+        //:
+        //: 2 The results agree with those of calling 'add' for each value to
+        //:   within the documented error bound, including for arrays spanning
+        //:   several chunks, and for values having a large mean compared to
+        //:   their standard deviation.
+        //:
+        //: 3 'addRange' can be mixed with 'add', and adding an empty array is
+        //:   a no-op.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arrays of pseudo-random values of various sizes and offsets,
+        //:   compare the results of 'addRange' with those of 'add', after
+        //:   adding a few values with 'add'.  (C-1..3)
+        //:
+        //: 2 Verify that a null array is detected, unless it is empty.  (C-4)
+        //
+        // Testing:
+        //   addRange(const double *values, bsl::size_t numValues)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'addRange'" << endl
+                          << "==================" << endl;
+
+        const int    SIZES[]   = { 0, 1, 2, 3, 4, 5, 7, 255, 256, 257, 4095,
+                                   4096, 4097, 10000, 100003 };
+        const int    NUM_SIZES = static_cast<int>(sizeof SIZES
+                                                           / sizeof *SIZES);
+        const double OFFSETS[] = { 0.0, -0.5, 1e3, 1e6 };
+        const int    NUM_OFFSETS = static_cast<int>(sizeof OFFSETS
+                                                         / sizeof *OFFSETS);
+        const double EPS       = 2.220446049250313e-16;
+
+        const double PREFIX[] = { 1.5, 0.25, 3.0 };
+
+        bsl::vector<double> values;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            for (int tj = 0; tj < NUM_OFFSETS; ++tj) {
+                const int    SIZE   = SIZES[ti];
+                const double OFFSET = OFFSETS[tj];
+
+                loadRandomValues(&values, SIZE, OFFSET, ti * 31 + tj);
+
+                ObjM scalarM;  ObjV scalarV;  ObjS scalarS;  ObjK scalarK;
+                ObjM batchM;   ObjV batchV;   ObjS batchS;   ObjK batchK;
+
+                for (int i = 0; i < 3; ++i) {
+                    const double VALUE = OFFSET + PREFIX[i];
+
+                    scalarM.add(VALUE);  scalarV.add(VALUE);
+                    scalarS.add(VALUE);  scalarK.add(VALUE);
+                    batchM.add(VALUE);   batchV.add(VALUE);
+                    batchS.add(VALUE);   batchK.add(VALUE);
+                }
+                for (int i = 0; i < SIZE; ++i) {
+                    scalarM.add(values[i]);  scalarV.add(values[i]);
+                    scalarS.add(values[i]);  scalarK.add(values[i]);
+                }
+                batchM.addRange(values.data(), SIZE);
+                batchV.addRange(values.data(), SIZE);
+                batchS.addRange(values.data(), SIZE);
+                batchK.addRange(values.data(), SIZE);
+
+                const int N = SIZE + 3;
+
+                ASSERTV(SIZE, OFFSET, N == batchM.count());
+                ASSERTV(SIZE, OFFSET, N == batchV.count());
+                ASSERTV(SIZE, OFFSET, N == batchS.count());
+                ASSERTV(SIZE, OFFSET, N == batchK.count());
+
+                // The error bound of the mean, and that of the higher
+                // moments for data whose mean is comparable to its standard
+                // deviation, is about 'N * EPS' (see the component
+                // documentation).  For data whose mean is large compared to
+                // its standard deviation, the higher moments computed by
+                // 'add' lose about as many digits as the ratio has.
+
+                const double TOLERANCE = 4 * N * EPS;
+                const double RATIO     = 1.0 + fabs(OFFSET) / 0.3;
+                const double TOL2      = TOLERANCE * RATIO;
+                const double TOL3      = TOLERANCE * RATIO * RATIO;
+
+                if (veryVerbose) {
+                    P_(SIZE) P_(OFFSET) P_(batchK.mean() - scalarK.mean())
+                    P(batchK.variance() / scalarK.variance() - 1.0)
+                }
+
+                ASSERTV(SIZE, OFFSET, batchM.mean(), scalarM.mean(),
+                        relativeError(batchM.mean(), scalarM.mean())
+                                                                 < TOLERANCE);
+                ASSERTV(SIZE, OFFSET, batchK.mean(), scalarK.mean(),
+                        relativeError(batchK.mean(), scalarK.mean())
+                                                                 < TOLERANCE);
+                ASSERTV(SIZE, OFFSET, batchV.variance(), scalarV.variance(),
+                        relativeError(batchV.variance(), scalarV.variance())
+                                                                      < TOL2);
+                ASSERTV(SIZE, OFFSET, batchS.variance(), scalarS.variance(),
+                        relativeError(batchS.variance(), scalarS.variance())
+                                                                      < TOL2);
+                ASSERTV(SIZE, OFFSET, batchK.variance(), scalarK.variance(),
+                        relativeError(batchK.variance(), scalarK.variance())
+                                                                      < TOL2);
+                if (3 <= N) {
+                    ASSERTV(SIZE, OFFSET, batchS.skew(), scalarS.skew(),
+                            relativeError(batchS.skew(), scalarS.skew())
+                                                                      < TOL3);
+                    ASSERTV(SIZE, OFFSET, batchK.skew(), scalarK.skew(),
+                            relativeError(batchK.skew(), scalarK.skew())
+                                                                      < TOL3);
+                }
+                if (4 <= N) {
+                    ASSERTV(SIZE, OFFSET, batchK.kurtosis(),
+                            scalarK.kurtosis(),
+                            relativeError(batchK.kurtosis(),
+                                          scalarK.kurtosis()) < TOL3);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tAdding an empty array." << endl;
+        {
+            ObjK mX;  const ObjK& X = mX;
+
+            mX.addRange(0, 0);
+            ASSERT(0 == X.count());
+
+            mX.add(2.0);
+            mX.addRange(PREFIX, 0);
+            ASSERT(1   == X.count());
+            ASSERT(2.0 == X.mean());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ObjV mX;
+
+            ASSERT_PASS(mX.addRange(0,      0));
+            ASSERT_FAIL(mX.addRange(0,      1));
+            ASSERT_PASS(mX.addRange(PREFIX, 3));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'merge'
+        //
+        // Concerns:
+        //: 1 Merging two objects yields the count and moments of the union of
+        //:   their data sets, for every moment level.
+        //:
+        //: 2 Merging an empty object is a no-op, and merging into an empty
+        //:   object copies the other object.
+        //:
+        //: 3 The result does not depend (beyond rounding) on where the data
+        //:   set is split.
+        //
+        // Plan:
+        //: 1 For every split point of a data set, accumulate the two parts
+        //:   into separate objects of each level, merge them, and compare
+        //:   the results with those of an object to which the whole data set
+        //:   was added.  (C-1, 3)
+        //:
+        //: 2 The split points include 0 and the size of the data set, so that
+        //:   one of the merged objects is empty.  (C-2)
+        //
+        // Testing:
+        //   merge(const Moment& other)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'merge'" << endl
+                          << "===============" << endl;
+
+        const double DATA[] = { 3.0, -1.5, 100.25, 7.0, 7.0, 0.125, -42.0,
+                                1e3, 2.5, 6.75, -0.5, 11.0 };
+        const int    NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        ObjM wholeM;  ObjV wholeV;  ObjS wholeS;  ObjK wholeK;
+        for (int i = 0; i < NUM_DATA; ++i) {
+            wholeM.add(DATA[i]);
+            wholeV.add(DATA[i]);
+            wholeS.add(DATA[i]);
+            wholeK.add(DATA[i]);
+        }
+
+        for (int split = 0; split <= NUM_DATA; ++split) {
+            ObjM aM, bM;  ObjV aV, bV;  ObjS aS, bS;  ObjK aK, bK;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                if (i < split) {
+                    aM.add(DATA[i]);  aV.add(DATA[i]);
+                    aS.add(DATA[i]);  aK.add(DATA[i]);
+                }
+                else {
+                    bM.add(DATA[i]);  bV.add(DATA[i]);
+                    bS.add(DATA[i]);  bK.add(DATA[i]);
+                }
+            }
+
+            aM.merge(bM);  aV.merge(bV);  aS.merge(bS);  aK.merge(bK);
+
+            if (veryVerbose) {
+                P_(split) P_(aK.mean()) P_(aK.variance()) P_(aK.skew())
+                                                              P(aK.kurtosis());
+            }
+
+            ASSERTV(split, NUM_DATA == aM.count());
+            ASSERTV(split, NUM_DATA == aV.count());
+            ASSERTV(split, NUM_DATA == aS.count());
+            ASSERTV(split, NUM_DATA == aK.count());
+
+            ASSERTV(split, fabs(wholeM.mean() - aM.mean()) < 1e-10);
+            ASSERTV(split, fabs(wholeV.mean() - aV.mean()) < 1e-10);
+
+            ASSERTV(split, wholeV.variance(), aV.variance(),
+                    fabs(wholeV.variance() / aV.variance() - 1.0) < 1e-10);
+            ASSERTV(split, wholeS.variance(), aS.variance(),
+                    fabs(wholeS.variance() / aS.variance() - 1.0) < 1e-10);
+            ASSERTV(split, wholeS.skew(), aS.skew(),
+                    fabs(wholeS.skew() / aS.skew() - 1.0) < 1e-10);
+            ASSERTV(split, wholeK.skew(), aK.skew(),
+                    fabs(wholeK.skew() / aK.skew() - 1.0) < 1e-10);
+            ASSERTV(split, wholeK.kurtosis(), aK.kurtosis(),
+                    fabs(wholeK.kurtosis() / aK.kurtosis() - 1.0) < 1e-10);
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING EDGE CASES
@@ -0,0 +1,355 @@
+// bdlsta_parallelutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLSTA_PARALLELUTIL
+#define INCLUDED_BDLSTA_PARALLELUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide functions accumulating statistics using a thread pool.
+//
+//@CLASSES:
+//  bdlsta::ParallelUtil: namespace for parallel statistics accumulation
+//
+//@SEE_ALSO: bdlsta_moment, bdlsta_linefit, bdlmt_threadpool,
+//           bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component provides a namespace, 'bdlsta::ParallelUtil',
+// for functions adding the values of large arrays (e.g., millions of values)
+// to a 'bdlsta::Moment' or a 'bdlsta::LineFit' object using the threads of a
+// thread pool, such as a 'bdlmt::ThreadPool' or a 'bdlmt::FixedThreadPool'.
+//
+// The array is split into (at most) the specified number of parts, each of at
+// least 'k_MIN_VALUES_PER_JOB' values, whose statistics are computed by jobs
+// enqueued to the pool using 'addRange', and then merged, in order, into the
+// statistics of the data set using 'merge'.  The calling thread processes the
+// first part itself, and waits for the other parts to be processed; a part
+// whose job cannot be enqueued is processed by the calling thread too.  Since
+// the parts, and the order in which they are merged, do not depend on the
+// scheduling of the jobs, the result is deterministic for a given number of
+// parts, and agrees with that of 'addRange' to within the error bound of the
+// latter (see {'bdlsta_moment'|Batch Accumulation}).
+//
+// Note that the calling thread must not be a thread of the pool, if the pool
+// might not have an idle thread for each job: the pool may then deadlock.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Computing the Variance of a Large Array
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to compute the mean and the variance of a large
+// array of values using the threads of a thread pool.
+//
+// First, we create a thread pool having 4 threads, and start it:
+//..
+//  bdlmt::FixedThreadPool pool(4, 100);
+//  pool.start();
+//..
+// Then, we create an array of 1 million values:
+//..
+//  bsl::vector<double> values(1000000);
+//  for (bsl::size_t i = 0; i < values.size(); ++i) {
+//      values[i] = static_cast<double>(i % 1000);
+//  }
+//..
+// Next, we accumulate the statistics of the values, in at most 4 jobs:
+//..
+//  bdlsta::Moment<bdlsta::MomentLevel::e_M2> m2;
+//  bdlsta::ParallelUtil::addRange(&m2,
+//                                 values.data(),
+//                                 values.size(),
+//                                 &pool,
+//                                 4);
+//..
+// Finally, we verify the mean and the variance:
+//..
+//  assert(1000000 == m2.count());
+//  assert(499.5   == m2.mean());
+//  assert(1e-9 > fabs(m2.variance() - 83333.25 * 1000000 / 999999));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlsta_linefit.h>
+#include <bdlsta_moment.h>
+
+#include <bslmt_latch.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlsta {
+
+                        // ===========================
+                        // class ParallelUtil_RangeJob
+                        // ===========================
+
+template <class STATISTICS>
+class ParallelUtil_RangeJob {
+    // This component-private class provides a job adding a range of values,
+    // or of points, to a 'STATISTICS' object ('Moment' or 'LineFit'), and
+    // then signaling a latch, if any.
+
+    // DATA
+    STATISTICS   *d_statistics_p;  // statistics to update (held, not owned)
+    const double *d_xValues_p;     // values, or X's (held, not owned)
+    const double *d_yValues_p;     // Y's (held, not owned), or 0
+    bsl::size_t   d_numValues;     // number of values, or points
+    bslmt::Latch *d_latch_p;       // latch to signal, if any (held, not
+                                   // owned)
+
+  public:
+    // CREATORS
+    ParallelUtil_RangeJob(STATISTICS   *statistics,
+                          const double *xValues,
+                          const double *yValues,
+                          bsl::size_t   numValues,
+                          bslmt::Latch *latch);
+        // Create a job adding to the specified 'statistics' the specified
+        // 'numValues' elements of the specified 'xValues' array if the
+        // specified 'yValues' is 0, and the points having the elements of
+        // 'xValues' and 'yValues' as coordinates otherwise, and then
+        // signaling the specified 'latch', unless it is 0.
+
+    // ACCESSORS
+    void operator()() const;
+        // Run this job.
+};
+
+                            // ===================
+                            // struct ParallelUtil
+                            // ===================
+
+struct ParallelUtil {
+    // This 'struct' provides a namespace for functions accumulating the
+    // statistics of large arrays using the threads of a thread pool.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class STATISTICS, class THREAD_POOL>
+    static void addRangeImp(STATISTICS   *statistics,
+                            const double *xValues,
+                            const double *yValues,
+                            bsl::size_t   numValues,
+                            THREAD_POOL  *threadPool,
+                            int           maxNumJobs);
+        // Add to the specified 'statistics' the specified 'numValues'
+        // elements of the specified 'xValues' array if the specified
+        // 'yValues' is 0, and the points having the elements of 'xValues' and
+        // 'yValues' as coordinates otherwise, using at most the specified
+        // 'maxNumJobs' jobs enqueued to the specified 'threadPool'.
+
+  public:
+    // PUBLIC CLASS CONSTANTS
+    enum {
+        k_MIN_VALUES_PER_JOB = 32 * 1024  // smallest part of an array
+                                          // processed by a job
+    };
+
+    // CLASS METHODS
+    template <MomentLevel::Enum ML, class THREAD_POOL>
+    static void addRange(Moment<ML>   *moment,
+                         const double *values,
+                         bsl::size_t   numValues,
+                         THREAD_POOL  *threadPool,
+                         int           maxNumJobs);
+        // Add to the specified 'moment' the specified 'numValues' elements of
+        // the specified 'values' array, using at most the specified
+        // 'maxNumJobs' jobs enqueued to the specified 'threadPool' (typically,
+        // the number of threads of 'threadPool').  'THREAD_POOL' must provide
+        // an 'enqueueJob' method taking a 'bsl::function<void()>' and
+        // returning 0 on success (e.g., 'bdlmt::ThreadPool').  The behavior is
+        // undefined unless 'values' refers to at least 'numValues' elements,
+        // or '0 == numValues', 'numValues <= INT_MAX - moment->count()', and
+        // '1 <= maxNumJobs'.
+
+    template <class THREAD_POOL>
+    static void addRange(LineFit      *lineFit,
+                         const double *xValues,
+                         const double *yValues,
+                         bsl::size_t   numValues,
+                         THREAD_POOL  *threadPool,
+                         int           maxNumJobs);
+        // Add to the specified 'lineFit' the specified 'numValues' points
+        // whose X's are the elements of the specified 'xValues' array and
+        // whose Y's are the corresponding elements of the specified 'yValues'
+        // array, using at most the specified 'maxNumJobs' jobs enqueued to
+        // the specified 'threadPool' (typically, the number of threads of
+        // 'threadPool').  'THREAD_POOL' must provide an 'enqueueJob' method
+        // taking a 'bsl::function<void()>' and returning 0 on success (e.g.,
+        // 'bdlmt::ThreadPool').  The behavior is undefined unless 'xValues'
+        // and 'yValues' each refer to at least 'numValues' elements, or
+        // '0 == numValues', 'numValues <= INT_MAX - lineFit->count()', and
+        // '1 <= maxNumJobs'.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // class ParallelUtil_RangeJob
+                        // ---------------------------
+
+// CREATORS
+template <class STATISTICS>
+inline
+ParallelUtil_RangeJob<STATISTICS>::ParallelUtil_RangeJob(
+                                                  STATISTICS   *statistics,
+                                                  const double *xValues,
+                                                  const double *yValues,
+                                                  bsl::size_t   numValues,
+                                                  bslmt::Latch *latch)
+: d_statistics_p(statistics)
+, d_xValues_p(xValues)
+, d_yValues_p(yValues)
+, d_numValues(numValues)
+, d_latch_p(latch)
+{
+}
+
+// ACCESSORS
+template <>
+inline
+void ParallelUtil_RangeJob<LineFit>::operator()() const
+{
+    d_statistics_p->addRange(d_xValues_p, d_yValues_p, d_numValues);
+    if (d_latch_p) {
+        d_latch_p->arrive();
+    }
+}
+
+template <class STATISTICS>
+inline
+void ParallelUtil_RangeJob<STATISTICS>::operator()() const
+{
+    d_statistics_p->addRange(d_xValues_p, d_numValues);
+    if (d_latch_p) {
+        d_latch_p->arrive();
+    }
+}
+
+                            // -------------------
+                            // struct ParallelUtil
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class STATISTICS, class THREAD_POOL>
+void ParallelUtil::addRangeImp(STATISTICS   *statistics,
+                               const double *xValues,
+                               const double *yValues,
+                               bsl::size_t   numValues,
+                               THREAD_POOL  *threadPool,
+                               int           maxNumJobs)
+{
+    BSLS_ASSERT(statistics);
+    BSLS_ASSERT(threadPool);
+    BSLS_ASSERT(1 <= maxNumJobs);
+
+    bsl::size_t numJobs = numValues / k_MIN_VALUES_PER_JOB;
+    if (numJobs > static_cast<bsl::size_t>(maxNumJobs)) {
+        numJobs = maxNumJobs;
+    }
+
+    if (numJobs <= 1) {
+        ParallelUtil_RangeJob<STATISTICS>(statistics,
+                                          xValues,
+                                          yValues,
+                                          numValues,
+                                          0)();
+        return;                                                       // RETURN
+    }
+
+    // Split the values into 'numJobs' parts, the first 'numLarger' of which
+    // have one more value than the others.
+
+    const bsl::size_t partSize  = numValues / numJobs;
+    const bsl::size_t numLarger = numValues % numJobs;
+
+    bsl::vector<STATISTICS> parts(numJobs);
+    bslmt::Latch            latch(static_cast<int>(numJobs));
+
+    bsl::size_t begin = partSize + (0 < numLarger);
+    for (bsl::size_t i = 1; i < numJobs; ++i) {
+        const bsl::size_t size = partSize + (i < numLarger);
+
+        ParallelUtil_RangeJob<STATISTICS> job(&parts[i],
+                                              xValues + begin,
+                                              yValues ? yValues + begin : 0,
+                                              size,
+                                              &latch);
+        if (0 != threadPool->enqueueJob(bsl::function<void()>(job))) {
+            job();
+        }
+        begin += size;
+    }
+
+    ParallelUtil_RangeJob<STATISTICS>(&parts[0],
+                                      xValues,
+                                      yValues,
+                                      partSize + (0 < numLarger),
+                                      &latch)();
+    latch.wait();
+
+    for (bsl::size_t i = 0; i < numJobs; ++i) {
+        statistics->merge(parts[i]);
+    }
+}
+
+// CLASS METHODS
+template <MomentLevel::Enum ML, class THREAD_POOL>
+inline
+void ParallelUtil::addRange(Moment<ML>   *moment,
+                            const double *values,
+                            bsl::size_t   numValues,
+                            THREAD_POOL  *threadPool,
+                            int           maxNumJobs)
+{
+    BSLS_ASSERT(moment);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    addRangeImp(moment, values, 0, numValues, threadPool, maxNumJobs);
+}
+
+template <class THREAD_POOL>
+inline
+void ParallelUtil::addRange(LineFit      *lineFit,
+                            const double *xValues,
+                            const double *yValues,
+                            bsl::size_t   numValues,
+                            THREAD_POOL  *threadPool,
+                            int           maxNumJobs)
+{
+    BSLS_ASSERT(lineFit);
+    BSLS_ASSERT(xValues || 0 == numValues);
+    BSLS_ASSERT(yValues || 0 == numValues);
+
+    addRangeImp(lineFit, xValues, yValues, numValues, threadPool, maxNumJobs);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,767 @@
+// bdlsta_parallelutil.t.cpp                                          -*-C++-*-
+#include <bdlsta_parallelutil.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_threadattributes.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cmath.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides functions splitting the accumulation of
+// statistics over an array into jobs run by a thread pool.  The results are
+// verified to be the same, bit for bit, whether the jobs are run by a
+// 'bdlmt::FixedThreadPool', by a 'bdlmt::ThreadPool', by a pool running them
+// synchronously, or by the calling thread (when enqueuing fails), and to
+// agree with those of the single-threaded 'addRange' to within its error
+// bound.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void addRange(Moment<ML> *, const double *, size_t, POOL *, int)
+// [ 3] void addRange(LineFit *, const double *, const double *, ...)
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] JOB ENQUEUE FAILURE
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+// NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                      GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlsta::ParallelUtil                      Util;
+typedef bdlsta::Moment<bdlsta::MomentLevel::e_M1> ObjM;
+typedef bdlsta::Moment<bdlsta::MomentLevel::e_M4> ObjK;
+typedef bdlsta::LineFit                           ObjL;
+
+const int k_MIN = Util::k_MIN_VALUES_PER_JOB;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void loadRandomValues(bsl::vector<double> *values,
+                      int                  numValues,
+                      unsigned int         seed)
+    // Load into the specified 'values' the specified 'numValues' pseudo-random
+    // values in '[10, 11)' generated from the specified 'seed'.
+{
+    values->resize(numValues);
+    for (int i = 0; i < numValues; ++i) {
+        seed = seed * 1103515245 + 12345;
+        (*values)[i] = 10.0 + static_cast<double>(seed >> 8) / (1 << 24);
+    }
+}
+
+double relativeError(double value, double expected)
+    // Return the error of the specified 'value' relative to the specified
+    // 'expected' value, or the absolute error if 'expected' is 0.
+{
+    return 0.0 == expected ? fabs(value)
+                           : fabs(value - expected) / fabs(expected);
+}
+
+bool isSame(const ObjK& lhs, const ObjK& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same count and
+    // the same statistics, and 'false' otherwise.
+{
+    if (lhs.count() != rhs.count()) {
+        return false;                                                 // RETURN
+    }
+    if (0 == lhs.count()) {
+        return true;                                                  // RETURN
+    }
+    if (lhs.count() < 4) {
+        return lhs.mean() == rhs.mean();                              // RETURN
+    }
+    return lhs.mean()     == rhs.mean()
+        && lhs.variance() == rhs.variance()
+        && lhs.skew()     == rhs.skew()
+        && lhs.kurtosis() == rhs.kurtosis();
+}
+
+bool isSame(const ObjL& lhs, const ObjL& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same count and
+    // the same statistics, and 'false' otherwise.
+{
+    if (lhs.count() != rhs.count()) {
+        return false;                                                 // RETURN
+    }
+    if (lhs.count() < 2) {
+        return 0 == lhs.count() || (lhs.xMean() == rhs.xMean()
+                                 && lhs.yMean() == rhs.yMean());      // RETURN
+    }
+
+    double lhsAlpha, lhsBeta, rhsAlpha, rhsBeta;
+    lhs.fit(&lhsAlpha, &lhsBeta);
+    rhs.fit(&rhsAlpha, &rhsBeta);
+
+    return lhs.xMean()    == rhs.xMean()
+        && lhs.yMean()    == rhs.yMean()
+        && lhs.variance() == rhs.variance()
+        && lhsAlpha       == rhsAlpha
+        && lhsBeta        == rhsBeta;
+}
+
+                            // ================
+                            // class InlinePool
+                            // ================
+
+class InlinePool {
+    // This class provides a "thread pool" running each job synchronously in
+    // the thread enqueuing it, or failing to enqueue it if so configured.
+
+    // DATA
+    int  d_numJobs;  // number of jobs enqueued
+    bool d_fail;     // whether to fail to enqueue jobs
+
+  public:
+    // CREATORS
+    explicit InlinePool(bool fail = false)
+    : d_numJobs(0)
+    , d_fail(fail)
+        // Create a pool running the jobs enqueued to it, unless the
+        // optionally specified 'fail' is 'true'.
+    {
+    }
+
+    // MANIPULATORS
+    int enqueueJob(const bsl::function<void()>& job)
+        // Run the specified 'job' and return 0, or return a non-zero value
+        // if this pool fails to enqueue jobs.
+    {
+        ++d_numJobs;
+        if (d_fail) {
+            return -1;                                                // RETURN
+        }
+        job();
+        return 0;
+    }
+
+    // ACCESSORS
+    int numJobs() const
+        // Return the number of jobs enqueued to this pool, successfully or
+        // not.
+    {
+        return d_numJobs;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Computing the Variance of a Large Array
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to compute the mean and the variance of a large
+// array of values using the threads of a thread pool.
+//
+// First, we create a thread pool having 4 threads, and start it:
+//..
+    bdlmt::FixedThreadPool pool(4, 100);
+    pool.start();
+//..
+// Then, we create an array of 1 million values:
+//..
+    bsl::vector<double> values(1000000);
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<double>(i % 1000);
+    }
+//..
+// Next, we accumulate the statistics of the values, in at most 4 jobs:
+//..
+    bdlsta::Moment<bdlsta::MomentLevel::e_M2> m2;
+    bdlsta::ParallelUtil::addRange(&m2,
+                                   values.data(),
+                                   values.size(),
+                                   &pool,
+                                   4);
+//..
+// Finally, we verify the mean and the variance:
+//..
+    ASSERT(1000000 == m2.count());
+    ASSERT(499.5   == m2.mean());
+    ASSERT(1e-9 > fabs(m2.variance() - 83333.25 * 1000000 / 999999));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // JOB ENQUEUE FAILURE
+        //
+        // Concerns:
+        //: 1 A part whose job cannot be enqueued is processed by the calling
+        //:   thread, with the same result.
+        //:
+        //: 2 The number of jobs enqueued is one less than the number of
+        //:   parts, which is limited by 'maxNumJobs' and by
+        //:   'k_MIN_VALUES_PER_JOB'.
+        //
+        // Plan:
+        //: 1 Using a pool failing to enqueue jobs, and a pool running jobs
+        //:   synchronously, accumulate arrays of various sizes, and verify
+        //:   that the results are the same, and that the number of jobs
+        //:   enqueued is as expected.  (C-1..2)
+        //
+        // Testing:
+        //   JOB ENQUEUE FAILURE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "JOB ENQUEUE FAILURE" << endl
+                          << "===================" << endl;
+
+        static const struct {
+            int d_line;        // source line number
+            int d_numValues;   // number of values
+            int d_maxNumJobs;  // maximum number of jobs
+            int d_expJobs;     // expected number of enqueued jobs
+        } DATA[] = {
+            //LINE  NUM VALUES       MAX JOBS  EXP JOBS
+            //----  ---------------  --------  --------
+            { L_,   0,               4,        0       },
+            { L_,   k_MIN - 1,       4,        0       },
+            { L_,   k_MIN,           4,        0       },
+            { L_,   2 * k_MIN - 1,   4,        0       },
+            { L_,   2 * k_MIN,       4,        1       },
+            { L_,   2 * k_MIN,       1,        0       },
+            { L_,   7 * k_MIN + 5,   4,        3       },
+            { L_,   7 * k_MIN + 5,   8,        6       },
+            { L_,   7 * k_MIN + 5,   100,      6       },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bsl::vector<double> xValues;
+        bsl::vector<double> yValues;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE       = DATA[ti].d_line;
+            const int NUM_VALUES = DATA[ti].d_numValues;
+            const int MAX_JOBS   = DATA[ti].d_maxNumJobs;
+            const int EXP_JOBS   = DATA[ti].d_expJobs;
+
+            loadRandomValues(&xValues, NUM_VALUES, ti);
+            loadRandomValues(&yValues, NUM_VALUES, ti + 100);
+
+            InlinePool inlinePool;
+            InlinePool failingPool(true);
+
+            ObjK mK1;  ObjK mK2;
+            ObjL mL1;  ObjL mL2;
+
+            Util::addRange(&mK1,
+                           xValues.data(),
+                           NUM_VALUES,
+                           &inlinePool,
+                           MAX_JOBS);
+            Util::addRange(&mK2,
+                           xValues.data(),
+                           NUM_VALUES,
+                           &failingPool,
+                           MAX_JOBS);
+            Util::addRange(&mL1,
+                           xValues.data(),
+                           yValues.data(),
+                           NUM_VALUES,
+                           &inlinePool,
+                           MAX_JOBS);
+            Util::addRange(&mL2,
+                           xValues.data(),
+                           yValues.data(),
+                           NUM_VALUES,
+                           &failingPool,
+                           MAX_JOBS);
+
+            ASSERTV(LINE, NUM_VALUES == mK1.count());
+            ASSERTV(LINE, NUM_VALUES == mL1.count());
+            ASSERTV(LINE, isSame(mK1, mK2));
+            ASSERTV(LINE, isSame(mL1, mL2));
+
+            ASSERTV(LINE, inlinePool.numJobs(),  2 * EXP_JOBS ==
+                                                        inlinePool.numJobs());
+            ASSERTV(LINE, failingPool.numJobs(), 2 * EXP_JOBS ==
+                                                       failingPool.numJobs());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'addRange' FOR 'LineFit'
+        //
+        // Concerns:
+        //: 1 The points are added to the statistics, which may be non-empty.
+        //:
+        //: 2 The result does not depend on the pool, or on the scheduling of
+        //:   the jobs, and agrees with that of 'LineFit::addRange' to within
+        //:   its error bound.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arrays of various sizes, and various maximum numbers of
+        //:   jobs, accumulate the points using a 'bdlmt::FixedThreadPool', a
+        //:   'bdlmt::ThreadPool', and a pool running the jobs synchronously,
+        //:   into objects holding a point already, and verify that the
+        //:   results are the same, and are close to those of
+        //:   'LineFit::addRange'.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   void addRange(LineFit *, const double *, const double *, ...)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'addRange' FOR 'LineFit'" << endl
+                          << "================================" << endl;
+
+        bdlmt::FixedThreadPool fixedPool(4, 100);
+        ASSERT(0 == fixedPool.start());
+
+        bdlmt::ThreadPool dynamicPool(bslmt::ThreadAttributes(), 1, 4, 100);
+        ASSERT(0 == dynamicPool.start());
+
+        const int SIZES[]   = { 0, 1, 2, k_MIN, 2 * k_MIN + 1,
+                                10 * k_MIN + 7, 1000003 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+        const int JOBS[]    = { 1, 2, 3, 8 };
+        const int NUM_JOBS  = static_cast<int>(sizeof JOBS / sizeof *JOBS);
+
+        bsl::vector<double> xValues;
+        bsl::vector<double> yValues;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            loadRandomValues(&xValues, SIZE, ti);
+            loadRandomValues(&yValues, SIZE, ti + 100);
+
+            ObjL expected;
+            expected.add(0.5, 1.5);
+            expected.addRange(xValues.data(), yValues.data(), SIZE);
+
+            for (int tj = 0; tj < NUM_JOBS; ++tj) {
+                const int MAX_JOBS = JOBS[tj];
+
+                InlinePool inlinePool;
+
+                ObjL mX1;  mX1.add(0.5, 1.5);
+                ObjL mX2;  mX2.add(0.5, 1.5);
+                ObjL mX3;  mX3.add(0.5, 1.5);
+
+                Util::addRange(&mX1,
+                               xValues.data(),
+                               yValues.data(),
+                               SIZE,
+                               &fixedPool,
+                               MAX_JOBS);
+                Util::addRange(&mX2,
+                               xValues.data(),
+                               yValues.data(),
+                               SIZE,
+                               &dynamicPool,
+                               MAX_JOBS);
+                Util::addRange(&mX3,
+                               xValues.data(),
+                               yValues.data(),
+                               SIZE,
+                               &inlinePool,
+                               MAX_JOBS);
+
+                ASSERTV(SIZE, MAX_JOBS, SIZE + 1 == mX1.count());
+                ASSERTV(SIZE, MAX_JOBS, isSame(mX1, mX2));
+                ASSERTV(SIZE, MAX_JOBS, isSame(mX1, mX3));
+
+                const double TOLERANCE = 64.0 * (SIZE + 1) * DBL_EPSILON;
+
+                ASSERTV(SIZE, MAX_JOBS, relativeError(mX1.xMean(),
+                                                      expected.xMean())
+                                                                 < TOLERANCE);
+                ASSERTV(SIZE, MAX_JOBS, relativeError(mX1.yMean(),
+                                                      expected.yMean())
+                                                                 < TOLERANCE);
+                if (2 <= SIZE) {
+                    double alpha, beta, expAlpha, expBeta;
+                    mX1.fit(&alpha, &beta);
+                    expected.fit(&expAlpha, &expBeta);
+
+                    if (veryVerbose) {
+                        P_(SIZE) P_(MAX_JOBS) P_(alpha - expAlpha)
+                        P(beta - expBeta)
+                    }
+
+                    ASSERTV(SIZE, MAX_JOBS, relativeError(mX1.variance(),
+                                                          expected.variance())
+                                                                 < TOLERANCE);
+                    ASSERTV(SIZE, MAX_JOBS, beta, expBeta,
+                            relativeError(beta, expBeta) < TOLERANCE);
+                    ASSERTV(SIZE, MAX_JOBS, alpha, expAlpha,
+                            relativeError(alpha, expAlpha) < TOLERANCE);
+                }
+            }
+        }
+
+        fixedPool.stop();
+        dynamicPool.stop();
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const double VALUES[] = { 1.0, 2.0 };
+
+            InlinePool pool;
+            ObjL       mX;
+
+            ASSERT_PASS(Util::addRange(&mX, VALUES, VALUES, 2, &pool, 1));
+            ASSERT_FAIL(Util::addRange(&mX, VALUES, VALUES, 2, &pool, 0));
+            ASSERT_FAIL(Util::addRange(  0, VALUES, VALUES, 2, &pool, 1));
+            ASSERT_FAIL(Util::addRange(&mX,      0, VALUES, 2, &pool, 1));
+            ASSERT_FAIL(Util::addRange(&mX, VALUES,      0, 2, &pool, 1));
+            ASSERT_PASS(Util::addRange(&mX,      0,      0, 0, &pool, 1));
+            ASSERT_FAIL(Util::addRange(&mX, VALUES, VALUES, 2,
+                                       static_cast<InlinePool *>(0), 1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'addRange' FOR 'Moment'
+        //
+        // Concerns:
+        //: 1 The values are added to the statistics, which may be non-empty,
+        //:   for every moment level.
+        //:
+        //: 2 The result does not depend on the pool, or on the scheduling of
+        //:   the jobs, and agrees with that of 'Moment::addRange' to within
+        //:   its error bound.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arrays of various sizes, and various maximum numbers of
+        //:   jobs, accumulate the values using a 'bdlmt::FixedThreadPool', a
+        //:   'bdlmt::ThreadPool', and a pool running the jobs synchronously,
+        //:   into objects holding a value already, and verify that the
+        //:   results are the same, and are close to those of
+        //:   'Moment::addRange'.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   void addRange(Moment<ML> *, const double *, size_t, POOL *, int)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'addRange' FOR 'Moment'" << endl
+                          << "===============================" << endl;
+
+        bdlmt::FixedThreadPool fixedPool(4, 100);
+        ASSERT(0 == fixedPool.start());
+
+        bdlmt::ThreadPool dynamicPool(bslmt::ThreadAttributes(), 1, 4, 100);
+        ASSERT(0 == dynamicPool.start());
+
+        const int SIZES[]   = { 0, 1, 2, 3, 4, k_MIN, 2 * k_MIN + 1,
+                                10 * k_MIN + 7, 1000003 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+        const int JOBS[]    = { 1, 2, 3, 8 };
+        const int NUM_JOBS  = static_cast<int>(sizeof JOBS / sizeof *JOBS);
+
+        bsl::vector<double> values;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            loadRandomValues(&values, SIZE, ti);
+
+            ObjM expectedM;
+            ObjK expectedK;
+            expectedM.add(10.5);
+            expectedK.add(10.5);
+            expectedM.addRange(values.data(), SIZE);
+            expectedK.addRange(values.data(), SIZE);
+
+            for (int tj = 0; tj < NUM_JOBS; ++tj) {
+                const int MAX_JOBS = JOBS[tj];
+
+                InlinePool inlinePool;
+
+                ObjM mM;   mM.add(10.5);
+                ObjK mK1;  mK1.add(10.5);
+                ObjK mK2;  mK2.add(10.5);
+                ObjK mK3;  mK3.add(10.5);
+
+                Util::addRange(&mM,
+                               values.data(),
+                               SIZE,
+                               &fixedPool,
+                               MAX_JOBS);
+                Util::addRange(&mK1,
+                               values.data(),
+                               SIZE,
+                               &fixedPool,
+                               MAX_JOBS);
+                Util::addRange(&mK2,
+                               values.data(),
+                               SIZE,
+                               &dynamicPool,
+                               MAX_JOBS);
+                Util::addRange(&mK3,
+                               values.data(),
+                               SIZE,
+                               &inlinePool,
+                               MAX_JOBS);
+
+                ASSERTV(SIZE, MAX_JOBS, SIZE + 1 == mM.count());
+                ASSERTV(SIZE, MAX_JOBS, SIZE + 1 == mK1.count());
+                ASSERTV(SIZE, MAX_JOBS, isSame(mK1, mK2));
+                ASSERTV(SIZE, MAX_JOBS, isSame(mK1, mK3));
+
+                const double TOLERANCE = 64.0 * (SIZE + 1) * DBL_EPSILON;
+
+                ASSERTV(SIZE, MAX_JOBS, relativeError(mM.mean(),
+                                                      expectedM.mean())
+                                                                 < TOLERANCE);
+                ASSERTV(SIZE, MAX_JOBS, relativeError(mK1.mean(),
+                                                      expectedK.mean())
+                                                                 < TOLERANCE);
+                if (4 <= SIZE) {
+                    if (veryVerbose) {
+                        P_(SIZE) P_(MAX_JOBS)
+                        P_(mK1.variance() / expectedK.variance() - 1.0)
+                        P(mK1.kurtosis() / expectedK.kurtosis() - 1.0)
+                    }
+
+                    ASSERTV(SIZE, MAX_JOBS, relativeError(mK1.variance(),
+                                                         expectedK.variance())
+                                                                 < TOLERANCE);
+                    ASSERTV(SIZE, MAX_JOBS, relativeError(mK1.skew(),
+                                                          expectedK.skew())
+                                                                 < TOLERANCE);
+                    ASSERTV(SIZE, MAX_JOBS, relativeError(mK1.kurtosis(),
+                                                         expectedK.kurtosis())
+                                                                 < TOLERANCE);
+                }
+            }
+        }
+
+        fixedPool.stop();
+        dynamicPool.stop();
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const double VALUES[] = { 1.0, 2.0 };
+
+            InlinePool pool;
+            ObjK       mX;
+
+            ASSERT_PASS(Util::addRange(&mX, VALUES, 2, &pool, 1));
+            ASSERT_FAIL(Util::addRange(&mX, VALUES, 2, &pool, 0));
+            ASSERT_FAIL(Util::addRange(static_cast<ObjK *>(0),
+                                       VALUES,
+                                       2,
+                                       &pool,
+                                       1));
+            ASSERT_FAIL(Util::addRange(&mX,      0, 2, &pool, 1));
+            ASSERT_PASS(Util::addRange(&mX,      0, 0, &pool, 1));
+            ASSERT_FAIL(Util::addRange(&mX, VALUES, 2,
+                                       static_cast<InlinePool *>(0), 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Accumulate an array of values, and an array of points, using a
+        //:   thread pool, and verify the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bdlmt::FixedThreadPool pool(2, 10);
+        ASSERT(0 == pool.start());
+
+        const int           N = 4 * k_MIN;
+        bsl::vector<double> xValues(N);
+        bsl::vector<double> yValues(N);
+        for (int i = 0; i < N; ++i) {
+            xValues[i] = i % 2;
+            yValues[i] = 1.0 + 2.0 * xValues[i];
+        }
+
+        ObjK mK;
+        Util::addRange(&mK, xValues.data(), N, &pool, 4);
+        ASSERT(N   == mK.count());
+        ASSERT(0.5 == mK.mean());
+        ASSERT(1e-12 > fabs(mK.variance() - 0.25 * N / (N - 1)));
+
+        ObjL mL;
+        Util::addRange(&mL, xValues.data(), yValues.data(), N, &pool, 4);
+
+        double alpha, beta;
+        mL.fit(&alpha, &beta);
+        ASSERT(N == mL.count());
+        ASSERT(1e-12 > fabs(alpha - 1.0));
+        ASSERT(1e-12 > fabs(beta  - 2.0));
+
+        pool.stop();
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
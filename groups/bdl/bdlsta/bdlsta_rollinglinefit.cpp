@@ -0,0 +1,232 @@
+// bdlsta_rollinglinefit.cpp                                          -*-C++-*-
+#include <bdlsta_rollinglinefit.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace bdlsta {
+//@IMPLEMENTATION NOTES:
+//
+// The fit 'Y = A + B*X' of the points in the window is:
+//..
+//  B = SUM((Xi-Xm)*(Yi-Ym)) / SUM((Xi-Xm)^2) = C / S
+//  A = Ym - B*Xm
+//..
+// Adding the 'n'th point '(x, y)' updates the means 'Xm' and 'Ym', the 2nd
+// moment 'S', and the co-moment 'C' as in the Welford algorithm:
+//..
+//  Xm' = Xm + (x - Xm) / n
+//  Ym' = Ym + (y - Ym) / n
+//  S'  = S  + (x - Xm) * (x - Xm')
+//  C'  = C  + (x - Xm) * (y - Ym')
+//..
+// Removing a point '(x, y)' from a window of 'n' points inverts the update:
+//..
+//  Xm' = Xm - (x - Xm) / (n - 1)
+//  Ym' = Ym - (y - Ym) / (n - 1)
+//  S'  = S  - (x - Xm') * (x - Xm)
+//  C'  = C  - (x - Xm') * (y - Ym)
+//..
+// The recalculation policy is that of 'bdlsta_rollingmoment' (see its
+// implementation notes), driven by the 2nd moment of the X's: the slope is a
+// ratio of 'C' to 'S', so it loses accuracy when 'S' falls a long way.
+
+namespace {
+
+const double k_CANCELLATION_LIMIT = 1.0 / (1 << 20);
+    // fraction of the peak 2nd moment below which the statistics are
+    // recalculated
+
+}  // close unnamed namespace
+
+                          // ----------------------------
+                          // class bdlsta::RollingLineFit
+                          // ----------------------------
+
+// PRIVATE MANIPULATORS
+void RollingLineFit::evictOldest()
+{
+    BSLS_ASSERT(!d_samples.empty());
+
+    const double xValue = d_samples.front().d_x;
+    const double yValue = d_samples.front().d_y;
+    d_samples.pop_front();
+
+    if (d_samples.empty()) {
+        reset();
+        return;                                                       // RETURN
+    }
+
+    const double n       = static_cast<double>(d_samples.size());
+    const double xDelta1 = xValue - d_xMean;
+    const double yDelta1 = yValue - d_yMean;
+    d_xMean -= xDelta1 / n;
+    d_yMean -= yDelta1 / n;
+
+    const double xDelta2 = xValue - d_xMean;
+    d_M2 -= xDelta2 * xDelta1;
+    d_C2 -= xDelta2 * yDelta1;
+
+    if (++d_numRemovals >= static_cast<int>(d_samples.size())
+     || d_M2 < d_M2Peak * k_CANCELLATION_LIMIT) {
+        recalculate();
+    }
+}
+
+void RollingLineFit::recalculate()
+{
+    typedef bsl::deque<Sample>::const_iterator Iterator;
+
+    d_numRemovals = 0;
+
+    const double n = static_cast<double>(d_samples.size());
+
+    double xSum = 0.0;
+    double ySum = 0.0;
+    for (Iterator it = d_samples.begin(); it != d_samples.end(); ++it) {
+        xSum += it->d_x;
+        ySum += it->d_y;
+    }
+    const double xMean = xSum / n;
+    const double yMean = ySum / n;
+
+    double M2 = 0.0;
+    double C2 = 0.0;
+    for (Iterator it = d_samples.begin(); it != d_samples.end(); ++it) {
+        const double xDelta = it->d_x - xMean;
+        M2 += xDelta * xDelta;
+        C2 += xDelta * (it->d_y - yMean);
+    }
+
+    d_xMean  = xMean;
+    d_yMean  = yMean;
+    d_M2     = M2;
+    d_M2Peak = M2;
+    d_C2     = C2;
+}
+
+// CREATORS
+RollingLineFit::RollingLineFit(int maxCount, bslma::Allocator *basicAllocator)
+: d_samples(basicAllocator)
+, d_maxCount(maxCount)
+, d_maxAge()
+, d_xMean(0.0)
+, d_yMean(0.0)
+, d_M2(0.0)
+, d_M2Peak(0.0)
+, d_C2(0.0)
+, d_numRemovals(0)
+{
+    BSLS_ASSERT(0 < maxCount);
+}
+
+RollingLineFit::RollingLineFit(const bsls::TimeInterval&  maxAge,
+                               bslma::Allocator          *basicAllocator)
+: d_samples(basicAllocator)
+, d_maxCount(0)
+, d_maxAge(maxAge)
+, d_xMean(0.0)
+, d_yMean(0.0)
+, d_M2(0.0)
+, d_M2Peak(0.0)
+, d_C2(0.0)
+, d_numRemovals(0)
+{
+    BSLS_ASSERT(bsls::TimeInterval() < maxAge);
+}
+
+RollingLineFit::RollingLineFit(int                        maxCount,
+                               const bsls::TimeInterval&  maxAge,
+                               bslma::Allocator          *basicAllocator)
+: d_samples(basicAllocator)
+, d_maxCount(maxCount)
+, d_maxAge(maxAge)
+, d_xMean(0.0)
+, d_yMean(0.0)
+, d_M2(0.0)
+, d_M2Peak(0.0)
+, d_C2(0.0)
+, d_numRemovals(0)
+{
+    BSLS_ASSERT(0 <= maxCount);
+    BSLS_ASSERT(bsls::TimeInterval() <= maxAge);
+}
+
+RollingLineFit::RollingLineFit(const RollingLineFit&  original,
+                               bslma::Allocator      *basicAllocator)
+: d_samples(original.d_samples, basicAllocator)
+, d_maxCount(original.d_maxCount)
+, d_maxAge(original.d_maxAge)
+, d_xMean(original.d_xMean)
+, d_yMean(original.d_yMean)
+, d_M2(original.d_M2)
+, d_M2Peak(original.d_M2Peak)
+, d_C2(original.d_C2)
+, d_numRemovals(original.d_numRemovals)
+{
+}
+
+// MANIPULATORS
+void RollingLineFit::add(double                    xValue,
+                         double                    yValue,
+                         const bsls::TimeInterval& timestamp)
+{
+    BSLS_ASSERT(d_samples.empty()
+             || d_samples.back().d_timestamp <= timestamp);
+
+    expire(timestamp);
+
+    if (d_maxCount && static_cast<int>(d_samples.size()) >= d_maxCount) {
+        evictOldest();
+    }
+
+    Sample sample;
+    sample.d_x         = xValue;
+    sample.d_y         = yValue;
+    sample.d_timestamp = timestamp;
+    d_samples.push_back(sample);
+    insert(xValue, yValue);
+}
+
+void RollingLineFit::expire(const bsls::TimeInterval& now)
+{
+    if (bsls::TimeInterval() == d_maxAge) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::TimeInterval limit = now - d_maxAge;
+    while (!d_samples.empty() && d_samples.front().d_timestamp <= limit) {
+        evictOldest();
+    }
+}
+
+void RollingLineFit::reset()
+{
+    d_samples.clear();
+    d_xMean       = 0.0;
+    d_yMean       = 0.0;
+    d_M2          = 0.0;
+    d_M2Peak      = 0.0;
+    d_C2          = 0.0;
+    d_numRemovals = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
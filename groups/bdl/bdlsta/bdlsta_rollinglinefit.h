@@ -0,0 +1,427 @@
+// bdlsta_rollinglinefit.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLSTA_ROLLINGLINEFIT
+#define INCLUDED_BDLSTA_ROLLINGLINEFIT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Online least squares regression line over a rolling window.
+//
+//@CLASSES:
+//  bdlsta::RollingLineFit: least squares line fit of the most recent points
+//
+//@SEE_ALSO: bdlsta_linefit, bdlsta_rollingmoment
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlsta::RollingLineFit',
+// that provides online calculation of the least squares line fit (and of the
+// means of the X's and Y's, and the variance of the X's) of the data points in
+// a rolling window: the most recent 'maxCount' points, the points added during
+// the most recent 'maxAge' time interval, or both.  The window is specified,
+// and points enter and leave it, exactly as values do for
+// 'bdlsta::RollingMoment' (see {'bdlsta_rollingmoment'|Windows}).  Each point
+// added (and each point leaving the window) updates the fit in constant time.
+//
+// The means, the 2nd moment of the X's, and the co-moment of the X's and Y's
+// are updated using the Welford update and its inverse, so that, unlike
+// 'bdlsta::LineFit', the fit does not rely on the difference of large sums.
+// As for 'bdlsta::RollingMoment', these are recalculated exactly from the
+// points in the window each time as many points have been removed as are in
+// the window, and when the 2nd moment of the X's falls below '2^-20' times its
+// largest value since the last recalculation.
+//
+// Note that the fit is undefined if there are less than 2 points in the
+// window, or if all the X's in the window are the same.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Moving Regression of the Last N Points
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to fit a line to the last 4 points of a series.
+//
+// First, we create example input and a rolling line fit of 4 points:
+//..
+//  const double inputX[] = { 0.0, 1.0, 2.0, 4.0, 5.0 };
+//  const double inputY[] = { 9.0, 1.0, 2.0, 4.0, 4.5 };
+//
+//  bdlsta::RollingLineFit lineFit(4);
+//..
+// Then, we invoke the 'add' routine to accumulate the data; the fifth point
+// evicts the (outlying) first one:
+//..
+//  for (int i = 0; i < 5; ++i) {
+//      lineFit.add(inputX[i], inputY[i]);
+//  }
+//..
+// Finally, we assert that the fit and means are those of the last 4 points:
+//..
+//  double alpha, beta;
+//  assert(4    == lineFit.count());
+//  assert(3.0  == lineFit.xMean());
+//  assert(1e-3 >  fabs(2.875 - lineFit.yMean()));
+//  assert(0    == lineFit.fitIfValid(&alpha, &beta));
+//  assert(1e-3 >  fabs(0.175 - alpha));
+//  assert(1e-3 >  fabs(0.9   - beta));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_deque.h>
+
+namespace BloombergLP {
+namespace bdlsta {
+
+                           // ====================
+                           // class RollingLineFit
+                           // ====================
+
+class RollingLineFit {
+    // This class provides an online calculation of the least squares line fit
+    // of the data points in a rolling window bounded by count, by age, or
+    // both.  The points in the window are retained, so that they can be
+    // removed when they leave the window.
+
+    // PRIVATE TYPES
+    struct Sample {
+        // This 'struct' holds one point of the window.
+
+        double             d_x;          // X of the point
+        double             d_y;          // Y of the point
+        bsls::TimeInterval d_timestamp;  // time of addition, if supplied
+    };
+
+    // DATA
+    bsl::deque<Sample> d_samples;      // points in the window, oldest first
+    int                d_maxCount;     // maximum number of points, or 0
+    bsls::TimeInterval d_maxAge;       // maximum age of points, or zero
+    double             d_xMean;        // mean of X's
+    double             d_yMean;        // mean of Y's
+    double             d_M2;           // 2nd moment of X's
+    double             d_M2Peak;       // largest 'd_M2' since last
+                                       // recalculation
+    double             d_C2;           // co-moment of X's and Y's
+    int                d_numRemovals;  // removals since last recalculation
+
+    // PRIVATE MANIPULATORS
+    void evictOldest();
+        // Remove the oldest point from the window.  The behavior is undefined
+        // if the window is empty.
+
+    void insert(double xValue, double yValue);
+        // Add the specified '(xValue, yValue)' point, already appended to
+        // 'd_samples', to the statistics.
+
+    void recalculate();
+        // Recalculate the statistics exactly from the points in the window.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RollingLineFit, bslma::UsesBslmaAllocator);
+
+    // CONSTANTS
+    enum {
+        e_SUCCESS         = 0,
+        e_INADEQUATE_DATA = -1
+    };
+
+    // CREATORS
+    explicit RollingLineFit(int               maxCount,
+                            bslma::Allocator *basicAllocator = 0);
+        // Create an empty object whose window holds the most recent specified
+        // 'maxCount' points.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 < maxCount'.
+
+    explicit RollingLineFit(const bsls::TimeInterval&  maxAge,
+                            bslma::Allocator          *basicAllocator = 0);
+        // Create an empty object whose window holds the points added during
+        // the most recent specified 'maxAge' time interval.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // 'bsls::TimeInterval() < maxAge'.
+
+    RollingLineFit(int                        maxCount,
+                   const bsls::TimeInterval&  maxAge,
+                   bslma::Allocator          *basicAllocator = 0);
+        // Create an empty object whose window holds at most the specified
+        // 'maxCount' points, added during the most recent specified 'maxAge'
+        // time interval.  A 'maxCount' of 0 or a 'maxAge' of zero leaves the
+        // window unbounded in that dimension.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 <= maxCount' and
+        // 'bsls::TimeInterval() <= maxAge'.
+
+    RollingLineFit(const RollingLineFit&  original,
+                   bslma::Allocator      *basicAllocator = 0);
+        // Create an object having the same window and points as the specified
+        // 'original' object.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~RollingLineFit() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! RollingLineFit& operator=(const RollingLineFit& rhs) = default;
+        // Assign to this object the window and points of the specified 'rhs'
+        // object, and return a reference providing modifiable access to this
+        // object.
+
+    void add(double xValue, double yValue);
+        // Add the specified '(xValue, yValue)' point to the window, evicting
+        // the oldest point if the window already holds 'maxCount()' points.
+        // Note that no point is evicted because of its age.
+
+    void add(double                    xValue,
+             double                    yValue,
+             const bsls::TimeInterval& timestamp);
+        // Add the specified '(xValue, yValue)' point, having the specified
+        // 'timestamp', to the window, first evicting the points that are
+        // older than 'maxAge()' relative to 'timestamp' and, if the window
+        // still holds 'maxCount()' points, the oldest point.  The behavior is
+        // undefined if 'timestamp' is before the timestamp of a point in the
+        // window.
+
+    void expire(const bsls::TimeInterval& now);
+        // Evict from the window the points whose timestamp is not after
+        // 'now - maxAge()'.  This method has no effect if 'maxAge()' is zero.
+
+    void reset();
+        // Remove all points from the window.
+
+    // ACCESSORS
+    int count() const;
+        // Return the number of points in the window.
+
+    void fit(double *alpha, double *beta) const;
+        // Calculate line fit coefficients 'Y = Alpha + Beta * X' of the points
+        // in the window, and populate the specified 'alpha' (intercept) and
+        // 'beta' (slope).  The behavior is undefined if '2 > count()' or all
+        // X's in the window are identical.
+
+    int fitIfValid(double *alpha, double *beta) const;
+        // Calculate line fit coefficients 'Y = Alpha + Beta * X' of the points
+        // in the window, and populate the specified 'alpha' (intercept) and
+        // 'beta' (slope).  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, 'e_INADEQUATE_DATA' is returned if
+        // '2 > count()' or all X's in the window are identical.
+
+    bsls::TimeInterval maxAge() const;
+        // Return the maximum age of the points in the window, or zero if the
+        // window is not bounded by age.
+
+    int maxCount() const;
+        // Return the maximum number of points in the window, or 0 if the
+        // window is not bounded by count.
+
+    double variance() const;
+        // Return the variance of the X's in the window.  The behavior is
+        // undefined unless '2 <= count()'.
+
+    int varianceIfValid(double *result) const;
+        // Load into the specified 'result' the variance of the X's in the
+        // window.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, 'e_INADEQUATE_DATA' is returned if '2 > count()'.
+
+    double xMean() const;
+        // Return the mean of the X's in the window.  The behavior is undefined
+        // unless '1 <= count()'.
+
+    int xMeanIfValid(double *result) const;
+        // Load into the specified 'result' the mean of the X's in the window.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // 'e_INADEQUATE_DATA' is returned if '1 > count()'.
+
+    double yMean() const;
+        // Return the mean of the Y's in the window.  The behavior is undefined
+        // unless '1 <= count()'.
+
+    int yMeanIfValid(double *result) const;
+        // Load into the specified 'result' the mean of the Y's in the window.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // 'e_INADEQUATE_DATA' is returned if '1 > count()'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                               INLINE DEFINITIONS
+// ============================================================================
+
+                          // ----------------------------
+                          // class bdlsta::RollingLineFit
+                          // ----------------------------
+
+// PRIVATE MANIPULATORS
+inline
+void RollingLineFit::insert(double xValue, double yValue)
+{
+    // Welford algorithm for the 2nd moment and co-moment.
+
+    const double n      = static_cast<double>(d_samples.size());
+    const double xDelta = xValue - d_xMean;
+    d_xMean += xDelta / n;
+    d_yMean += (yValue - d_yMean) / n;
+    d_M2    += xDelta * (xValue - d_xMean);
+    d_C2    += xDelta * (yValue - d_yMean);
+
+    if (d_M2 > d_M2Peak) {
+        d_M2Peak = d_M2;
+    }
+}
+
+// MANIPULATORS
+inline
+void RollingLineFit::add(double xValue, double yValue)
+{
+    if (d_maxCount && static_cast<int>(d_samples.size()) >= d_maxCount) {
+        evictOldest();
+    }
+
+    Sample sample;
+    sample.d_x = xValue;
+    sample.d_y = yValue;
+    if (!d_samples.empty()) {
+        sample.d_timestamp = d_samples.back().d_timestamp;
+    }
+    d_samples.push_back(sample);
+    insert(xValue, yValue);
+}
+
+// ACCESSORS
+inline
+int RollingLineFit::count() const
+{
+    return static_cast<int>(d_samples.size());
+}
+
+inline
+void RollingLineFit::fit(double *alpha, double *beta) const
+{
+    BSLS_ASSERT(2 <= count() && 0.0 != d_M2);
+
+    const double tmpBeta = d_C2 / d_M2;
+    *beta  = tmpBeta;
+    *alpha = d_yMean - tmpBeta * d_xMean;
+}
+
+inline
+int RollingLineFit::fitIfValid(double *alpha, double *beta) const
+{
+    if (2 > count() || 0.0 == d_M2) {
+        return e_INADEQUATE_DATA;                                     // RETURN
+    }
+    fit(alpha, beta);
+    return 0;
+}
+
+inline
+bsls::TimeInterval RollingLineFit::maxAge() const
+{
+    return d_maxAge;
+}
+
+inline
+int RollingLineFit::maxCount() const
+{
+    return d_maxCount;
+}
+
+inline
+double RollingLineFit::variance() const
+{
+    BSLS_ASSERT(2 <= count());
+
+    return d_M2 / (count() - 1);
+}
+
+inline
+int RollingLineFit::varianceIfValid(double *result) const
+{
+    if (2 > count()) {
+        return e_INADEQUATE_DATA;                                     // RETURN
+    }
+    *result = variance();
+    return 0;
+}
+
+inline
+double RollingLineFit::xMean() const
+{
+    BSLS_ASSERT(1 <= count());
+
+    return d_xMean;
+}
+
+inline
+int RollingLineFit::xMeanIfValid(double *result) const
+{
+    if (1 > count()) {
+        return e_INADEQUATE_DATA;                                     // RETURN
+    }
+    *result = xMean();
+    return 0;
+}
+
+inline
+double RollingLineFit::yMean() const
+{
+    BSLS_ASSERT(1 <= count());
+
+    return d_yMean;
+}
+
+inline
+int RollingLineFit::yMeanIfValid(double *result) const
+{
+    if (1 > count()) {
+        return e_INADEQUATE_DATA;                                     // RETURN
+    }
+    *result = yMean();
+    return 0;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *RollingLineFit::allocator() const
+{
+    return d_samples.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
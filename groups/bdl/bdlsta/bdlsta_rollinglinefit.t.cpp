@@ -0,0 +1,713 @@
+// bdlsta_rollinglinefit.t.cpp                                        -*-C++-*-
+#include <bdlsta_rollinglinefit.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cmath.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a mechanism calculating the least squares line
+// fit of the data points in a rolling window.  The fit, means, and variance
+// are verified against those calculated directly (with two passes) from the
+// points that should be in the window, for windows bounded by count, by age,
+// and by both, and for points far from the origin.  Negative tests are
+// conducted for the preconditions.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] RollingLineFit(int maxCount, Allocator *ba = 0)
+// [ 3] RollingLineFit(const TimeInterval& maxAge, Allocator *ba = 0)
+// [ 3] RollingLineFit(int, const TimeInterval&, Allocator *ba = 0)
+// [ 4] RollingLineFit(const RollingLineFit& original, Allocator *ba = 0)
+//
+// MANIPULATORS
+// [ 2] void add(double xValue, double yValue)
+// [ 3] void add(double xValue, double yValue, const TimeInterval& timestamp)
+// [ 3] void expire(const TimeInterval& now)
+// [ 4] void reset()
+//
+// ACCESSORS
+// [ 2] int count() const
+// [ 2] void fit(double *alpha, double *beta) const
+// [ 4] int fitIfValid(double *alpha, double *beta) const
+// [ 3] TimeInterval maxAge() const
+// [ 2] int maxCount() const
+// [ 2] double variance() const
+// [ 4] int varianceIfValid(double *result) const
+// [ 2] double xMean() const
+// [ 4] int xMeanIfValid(double *result) const
+// [ 2] double yMean() const
+// [ 4] int yMeanIfValid(double *result) const
+// [ 4] bslma::Allocator *allocator() const
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+// NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                      GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlsta::RollingLineFit Obj;
+typedef bsls::TimeInterval     TI;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct Expected {
+    // This 'struct' holds the statistics of a set of points.
+
+    double d_xMean;
+    double d_yMean;
+    double d_variance;
+    double d_alpha;
+    double d_beta;
+};
+
+void directFit(Expected     *result,
+               const double *xValues,
+               const double *yValues,
+               int           count)
+    // Load into the specified 'result' the statistics of the specified
+    // 'count' points '(xValues[i], yValues[i])', calculated with two passes.
+    // The behavior is undefined unless '2 <= count' and the X's are not all
+    // identical.
+{
+    double xSum = 0.0, ySum = 0.0;
+    for (int i = 0; i < count; ++i) {
+        xSum += xValues[i];
+        ySum += yValues[i];
+    }
+    const double xMean = xSum / count;
+    const double yMean = ySum / count;
+
+    double M2 = 0.0, C2 = 0.0;
+    for (int i = 0; i < count; ++i) {
+        M2 += (xValues[i] - xMean) * (xValues[i] - xMean);
+        C2 += (xValues[i] - xMean) * (yValues[i] - yMean);
+    }
+
+    result->d_xMean    = xMean;
+    result->d_yMean    = yMean;
+    result->d_variance = M2 / (count - 1);
+    result->d_beta     = C2 / M2;
+    result->d_alpha    = yMean - result->d_beta * xMean;
+}
+
+bool isClose(double expected, double actual, double tolerance)
+    // Return 'true' if the specified 'actual' value is within the specified
+    // relative 'tolerance' of the specified 'expected' value (or within
+    // 'tolerance' of it if 'expected' is smaller than 1 in magnitude).
+{
+    const double scale = fabs(expected) > 1.0 ? fabs(expected) : 1.0;
+    return fabs(expected - actual) <= tolerance * scale;
+}
+
+double nextRandom(unsigned int *state)
+    // Return the next pseudo-random value in '[0, 1)' of the sequence having
+    // the specified 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return static_cast<double>((*state >> 8) & 0xFFFFFF) / 16777216.0;
+}
+
+void verify(const Obj&    object,
+            const double *xValues,
+            const double *yValues,
+            int           count,
+            double        tolerance,
+            int           line,
+            int           index)
+    // Verify that the specified 'object' has the statistics of the specified
+    // 'count' points '(xValues[i], yValues[i])' within the specified relative
+    // 'tolerance', reporting failures with the specified 'line' and 'index'.
+{
+    ASSERTV(line, index, count, object.count(), count == object.count());
+
+    if (2 > count) {
+        return;                                                       // RETURN
+    }
+
+    Expected e;
+    directFit(&e, xValues, yValues, count);
+
+    double alpha = 0.0, beta = 0.0;
+    ASSERTV(line, index, 0 == object.fitIfValid(&alpha, &beta));
+
+    ASSERTV(line, index, e.d_xMean, object.xMean(),
+            isClose(e.d_xMean, object.xMean(), tolerance));
+    ASSERTV(line, index, e.d_yMean, object.yMean(),
+            isClose(e.d_yMean, object.yMean(), tolerance));
+    ASSERTV(line, index, e.d_variance, object.variance(),
+            isClose(e.d_variance, object.variance(), tolerance));
+    ASSERTV(line, index, e.d_alpha, alpha,
+            isClose(e.d_alpha, alpha, tolerance));
+    ASSERTV(line, index, e.d_beta, beta, isClose(e.d_beta, beta, tolerance));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Moving Regression of the Last N Points
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to fit a line to the last 4 points of a series.
+//
+// First, we create example input and a rolling line fit of 4 points:
+//..
+    const double inputX[] = { 0.0, 1.0, 2.0, 4.0, 5.0 };
+    const double inputY[] = { 9.0, 1.0, 2.0, 4.0, 4.5 };
+
+    bdlsta::RollingLineFit lineFit(4);
+//..
+// Then, we invoke the 'add' routine to accumulate the data; the fifth point
+// evicts the (outlying) first one:
+//..
+    for (int i = 0; i < 5; ++i) {
+        lineFit.add(inputX[i], inputY[i]);
+    }
+//..
+// Finally, we assert that the fit and means are those of the last 4 points:
+//..
+    double alpha, beta;
+    ASSERT(4    == lineFit.count());
+    ASSERT(3.0  == lineFit.xMean());
+    ASSERT(1e-3 >  fabs(2.875 - lineFit.yMean()));
+    ASSERT(0    == lineFit.fitIfValid(&alpha, &beta));
+    ASSERT(1e-3 >  fabs(0.175 - alpha));
+    ASSERT(1e-3 >  fabs(0.9   - beta));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, RESET, ALLOCATOR, AND EDGE CASES
+        //
+        // Concerns:
+        //: 1 The copy constructor copies the window and points, and uses the
+        //:   supplied allocator (or the default allocator if none is
+        //:   supplied).
+        //:
+        //: 2 Memory is allocated only from the object allocator.
+        //:
+        //: 3 'reset' empties the window, and the object is usable afterwards.
+        //:
+        //: 4 The 'IfValid' accessors fail with too few points, and
+        //:   'fitIfValid' fails if all X's in the window are identical.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with test allocators, add points, copy them, and
+        //:   verify the statistics of the copies and the allocators used.
+        //:   (C-1, 2)
+        //:
+        //: 2 Reset an object and verify that it behaves as a new one.  (C-3)
+        //:
+        //: 3 Verify the results of the 'IfValid' accessors for 0, 1, and 2
+        //:   points, and for a window whose X's are identical only after the
+        //:   eviction of a point.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   RollingLineFit(const RollingLineFit& original, Allocator *ba = 0)
+        //   void reset()
+        //   int fitIfValid(double *alpha, double *beta) const
+        //   int varianceIfValid(double *result) const
+        //   int xMeanIfValid(double *result) const
+        //   int yMeanIfValid(double *result) const
+        //   bslma::Allocator *allocator() const
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, RESET, ALLOCATOR, AND EDGE CASES" << endl
+                          << "======================================" << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::TestAllocator         oa("object",  veryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tCopy and allocator." << endl;
+        {
+            Obj mX(4, &oa);  const Obj& X = mX;
+            ASSERT(&oa == X.allocator());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.add(i, i * i);
+            }
+            ASSERT(0 <  oa.numBlocksInUse());
+            ASSERT(0 == da.numBlocksTotal());
+
+            Obj mY(X, &sa);  const Obj& Y = mY;
+            ASSERT(&sa == Y.allocator());
+            ASSERT(0 <  sa.numBlocksInUse());
+            ASSERT(X.count() == Y.count());
+            ASSERT(X.xMean() == Y.xMean());
+            ASSERT(X.yMean() == Y.yMean());
+
+            Obj mZ(X);  const Obj& Z = mZ;
+            ASSERT(&da == Z.allocator());
+
+            mX.add(100.0, 1.0);
+            mY.add(100.0, 1.0);
+
+            double xAlpha, xBeta, yAlpha, yBeta;
+            X.fit(&xAlpha, &xBeta);
+            Y.fit(&yAlpha, &yBeta);
+            ASSERT(xAlpha == yAlpha);
+            ASSERT(xBeta  == yBeta);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tReset and 'IfValid' accessors." << endl;
+        {
+            Obj mX(2, &oa);  const Obj& X = mX;
+
+            double result = -1.0, alpha = -1.0, beta = -1.0;
+            ASSERT(Obj::e_INADEQUATE_DATA == X.xMeanIfValid(&result));
+            ASSERT(Obj::e_INADEQUATE_DATA == X.yMeanIfValid(&result));
+            ASSERT(Obj::e_INADEQUATE_DATA == X.varianceIfValid(&result));
+            ASSERT(Obj::e_INADEQUATE_DATA == X.fitIfValid(&alpha, &beta));
+            ASSERT(-1.0 == result);
+            ASSERT(-1.0 == alpha);
+
+            mX.add(1.0, 2.0);
+            ASSERT(0                      == X.xMeanIfValid(&result));
+            ASSERT(1.0                    == result);
+            ASSERT(0                      == X.yMeanIfValid(&result));
+            ASSERT(2.0                    == result);
+            ASSERT(Obj::e_INADEQUATE_DATA == X.varianceIfValid(&result));
+            ASSERT(Obj::e_INADEQUATE_DATA == X.fitIfValid(&alpha, &beta));
+
+            mX.add(2.0, 4.0);
+            ASSERT(0   == X.fitIfValid(&alpha, &beta));
+            ASSERT(0.0 == alpha);
+            ASSERT(2.0 == beta);
+
+            // The window becomes '{ (2, 4), (2, 5) }'.
+
+            mX.add(2.0, 5.0);
+            ASSERT(0                      == X.varianceIfValid(&result));
+            ASSERT(0.0                    == result);
+            ASSERT(Obj::e_INADEQUATE_DATA == X.fitIfValid(&alpha, &beta));
+
+            mX.reset();
+            ASSERT(0 == X.count());
+            ASSERT(2 == X.maxCount());
+            ASSERT(Obj::e_INADEQUATE_DATA == X.xMeanIfValid(&result));
+
+            mX.add(0.0, 1.0);
+            mX.add(1.0, 3.0);
+            X.fit(&alpha, &beta);
+            ASSERT(1.0 == alpha);
+            ASSERT(2.0 == beta);
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1));
+            ASSERT_FAIL(Obj(0));
+            ASSERT_PASS(Obj(TI(0, 1)));
+            ASSERT_FAIL(Obj(TI(0, 0)));
+            ASSERT_PASS(Obj(0, TI(0, 0)));
+            ASSERT_FAIL(Obj(-1, TI(0, 0)));
+            ASSERT_FAIL(Obj(0, TI(-1, 0)));
+
+            Obj mX(TI(10, 0));  const Obj& X = mX;
+            double alpha, beta;
+            ASSERT_SAFE_FAIL(X.xMean());
+            ASSERT_SAFE_FAIL(X.yMean());
+            mX.add(1.0, 1.0, TI(5, 0));
+            ASSERT_SAFE_PASS(X.xMean());
+            ASSERT_SAFE_FAIL(X.variance());
+            ASSERT_SAFE_FAIL(X.fit(&alpha, &beta));
+            mX.add(1.0, 2.0, TI(5, 0));
+            ASSERT_SAFE_FAIL(X.fit(&alpha, &beta));
+            mX.add(2.0, 2.0, TI(6, 0));
+            ASSERT_SAFE_PASS(X.fit(&alpha, &beta));
+            ASSERT_FAIL(mX.add(1.0, 1.0, TI(4, 0)));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // WINDOWS BOUNDED BY AGE
+        //
+        // Concerns:
+        //: 1 'add(xValue, yValue, timestamp)' evicts the points whose
+        //:   timestamp is not after 'timestamp - maxAge'.
+        //:
+        //: 2 'expire' evicts the same points without adding a point, and has
+        //:   no effect if the window is not bounded by age.
+        //:
+        //: 3 When the window is bounded by both count and age, both bounds
+        //:   are respected.
+        //:
+        //: 4 'maxAge' and 'maxCount' return the bounds supplied at
+        //:   construction.
+        //
+        // Plan:
+        //: 1 Add points at irregular timestamps to objects bounded by age,
+        //:   and by age and count, and verify after each addition the
+        //:   statistics against those calculated directly from the points
+        //:   that should be in the window.  (C-1, 3)
+        //:
+        //: 2 Call 'expire' at several times and verify the count.  (C-2)
+        //:
+        //: 3 Verify the bounds of the objects.  (C-4)
+        //
+        // Testing:
+        //   RollingLineFit(const TimeInterval& maxAge, Allocator *ba = 0)
+        //   RollingLineFit(int, const TimeInterval&, Allocator *ba = 0)
+        //   void add(double xValue, double yValue, const TimeInterval& ts)
+        //   void expire(const TimeInterval& now)
+        //   TimeInterval maxAge() const
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WINDOWS BOUNDED BY AGE" << endl
+                          << "======================" << endl;
+
+        const TI     MAX_AGE(2, 500000000);  // 2.5 seconds
+        const int    MAX_COUNTS[] = { 0, 3 };
+        unsigned int state        = 7;
+
+        for (int c = 0; c < 2; ++c) {
+            const int MAX_COUNT = MAX_COUNTS[c];
+
+            Obj mX(MAX_COUNT, MAX_AGE);  const Obj& X = mX;
+            ASSERT(MAX_AGE   == X.maxAge());
+            ASSERT(MAX_COUNT == X.maxCount());
+
+            bsl::vector<double> xValues;
+            bsl::vector<double> yValues;
+            bsl::vector<TI>     timestamps;
+            TI                  now;
+
+            for (int i = 0; i < 200; ++i) {
+                now.addMilliseconds(
+                               static_cast<int>(nextRandom(&state) * 1000.0));
+                const double x = 10.0 * nextRandom(&state);
+                const double y = 3.0 * x - 2.0 + nextRandom(&state);
+
+                mX.add(x, y, now);
+                xValues.push_back(x);
+                yValues.push_back(y);
+                timestamps.push_back(now);
+
+                // Find the first point that should be in the window.
+
+                const int size  = static_cast<int>(xValues.size());
+                int       first = size - 1;
+                while (0 < first && timestamps[first - 1] > now - MAX_AGE) {
+                    --first;
+                }
+                if (MAX_COUNT && size - first > MAX_COUNT) {
+                    first = size - MAX_COUNT;
+                }
+
+                verify(X,
+                       &xValues[first],
+                       &yValues[first],
+                       size - first,
+                       1e-10,
+                       c,
+                       i);
+            }
+
+            mX.expire(now + MAX_AGE - TI(0, 1));
+            ASSERT(1 == X.count());
+            ASSERT(xValues.back() == X.xMean());
+            ASSERT(yValues.back() == X.yMean());
+
+            mX.expire(now + MAX_AGE);
+            ASSERT(0 == X.count());
+        }
+
+        if (verbose) cout << "\tExpiry of windows bounded by count." << endl;
+        {
+            Obj mX(2);  const Obj& X = mX;
+            mX.add(1.0, 1.0, TI(1, 0));
+            mX.add(2.0, 2.0, TI(100, 0));
+            mX.expire(TI(1000, 0));
+            ASSERT(2 == X.count());
+            ASSERT(TI() == X.maxAge());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // WINDOWS BOUNDED BY COUNT
+        //
+        // Concerns:
+        //: 1 The window holds the most recent 'maxCount' points, and the fit,
+        //:   means, and variance are those of the points in the window.
+        //:
+        //: 2 The fit stays accurate for points far from the origin, and when
+        //:   the spread of the X's falls abruptly.
+        //
+        // Plan:
+        //: 1 For several window sizes, add pseudo-random points near a line
+        //:   and verify after each addition the statistics against those
+        //:   calculated directly from the most recent points.  (C-1)
+        //:
+        //: 2 Repeat P-1 with X's offset by 1e6, and with X's whose spread
+        //:   alternates between 1e6 and 1 every 500 points.  (C-2)
+        //
+        // Testing:
+        //   RollingLineFit(int maxCount, Allocator *ba = 0)
+        //   void add(double xValue, double yValue)
+        //   int count() const
+        //   void fit(double *alpha, double *beta) const
+        //   int maxCount() const
+        //   double variance() const
+        //   double xMean() const
+        //   double yMean() const
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WINDOWS BOUNDED BY COUNT" << endl
+                          << "========================" << endl;
+
+        const int    WINDOWS[]   = { 2, 3, 7, 64, 1000 };
+        const int    NUM_WINDOWS = sizeof WINDOWS / sizeof *WINDOWS;
+        unsigned int state       = 12345;
+
+        enum { e_PLAIN, e_OFFSET, e_SPREAD, k_NUM_MODES };
+
+        for (int mode = 0; mode < k_NUM_MODES; ++mode) {
+            for (int w = 0; w < NUM_WINDOWS; ++w) {
+                const int WINDOW = WINDOWS[w];
+
+                Obj mX(WINDOW);  const Obj& X = mX;
+                ASSERT(WINDOW == X.maxCount());
+                ASSERT(0      == X.count());
+
+                bsl::vector<double> xValues;
+                bsl::vector<double> yValues;
+
+                for (int i = 0; i < 3 * WINDOW + 1000; ++i) {
+                    double x = nextRandom(&state);
+                    switch (mode) {
+                      case e_OFFSET: {
+                        x += 1e6;
+                      } break;
+                      case e_SPREAD: {
+                        x *= (i / 500) % 2 ? 1.0 : 1e6;
+                      } break;
+                    }
+                    const double y = -0.5 * x + 7.0 + nextRandom(&state);
+
+                    mX.add(x, y);
+                    xValues.push_back(x);
+                    yValues.push_back(y);
+
+                    const int size  = static_cast<int>(xValues.size());
+                    const int count = size < WINDOW ? size : WINDOW;
+
+                    // With X's offset by 1e6, the direct calculation itself
+                    // loses about 12 digits of the slope.
+
+                    verify(X,
+                           &xValues[size - count],
+                           &yValues[size - count],
+                           count,
+                           e_OFFSET == mode ? 1e-3 : 1e-8,
+                           mode * 10000 + WINDOW,
+                           i);
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Developer test sandbox. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(3);  const Obj& X = mX;
+
+        double alpha, beta;
+
+        mX.add(0.0, 1.0);
+        mX.add(1.0, 3.0);
+        mX.add(2.0, 5.0);
+        ASSERT(3   == X.count());
+        ASSERT(1.0 == X.xMean());
+        ASSERT(3.0 == X.yMean());
+        ASSERT(1.0 == X.variance());
+        X.fit(&alpha, &beta);
+        ASSERT(1.0 == alpha);
+        ASSERT(2.0 == beta);
+
+        mX.add(3.0, 4.0);
+        ASSERT(3   == X.count());
+        ASSERT(2.0 == X.xMean());
+        ASSERT(4.0 == X.yMean());
+        X.fit(&alpha, &beta);
+        ASSERT(1e-12 > fabs(3.0 - alpha));
+        ASSERT(1e-12 > fabs(0.5 - beta));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
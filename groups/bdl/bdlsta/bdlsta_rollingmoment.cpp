@@ -0,0 +1,206 @@
+// bdlsta_rollingmoment.cpp                                           -*-C++-*-
+#include <bdlsta_rollingmoment.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace bdlsta {
+//@IMPLEMENTATION NOTES:
+//
+// Adding the 'n'th value 'x' to a window having mean 'M' and 2nd moment 'S'
+// is the Welford update:
+//..
+//  M' = M + (x - M) / n
+//  S' = S + (x - M) * (x - M')
+//..
+// Removing a value 'x' from a window of 'n' values inverts it:
+//..
+//  M' = M - (x - M) / (n - 1)
+//  S' = S - (x - M) * (x - M')
+//..
+// Each removal adds a rounding error of the order of 'DBL_EPSILON' times the
+// largest 2nd moment the window has had, so the error is large relative to
+// 'S' when 'S' has fallen a long way (and 'S' can even become slightly
+// negative).  The mean and 2nd moment are therefore recalculated from the
+// values in the window (with two passes) when 'S' falls below
+// 'k_CANCELLATION_LIMIT' times its peak since the last recalculation, and
+// otherwise once as many values have been removed as the window holds.  The
+// latter recalculation costs as much as the removals it follows, so the
+// amortized cost of an update stays constant; the former needs the spread of
+// the values to fall by a factor of about 1000 each time, which can only
+// happen a few times in a row.
+
+namespace {
+
+const double k_CANCELLATION_LIMIT = 1.0 / (1 << 20);
+    // fraction of the peak 2nd moment below which the 2nd moment is
+    // recalculated
+
+}  // close unnamed namespace
+
+                          // ---------------------------
+                          // class bdlsta::RollingMoment
+                          // ---------------------------
+
+// PRIVATE MANIPULATORS
+void RollingMoment::evictOldest()
+{
+    BSLS_ASSERT(!d_samples.empty());
+
+    const double value = d_samples.front().d_value;
+    d_samples.pop_front();
+
+    if (d_samples.empty()) {
+        d_mean        = 0.0;
+        d_M2          = 0.0;
+        d_M2Peak      = 0.0;
+        d_numRemovals = 0;
+        return;                                                       // RETURN
+    }
+
+    const double n     = static_cast<double>(d_samples.size());
+    const double delta = value - d_mean;
+    d_mean -= delta / n;
+    d_M2   -= delta * (value - d_mean);
+
+    if (++d_numRemovals >= static_cast<int>(d_samples.size())
+     || d_M2 < d_M2Peak * k_CANCELLATION_LIMIT) {
+        recalculate();
+    }
+}
+
+void RollingMoment::recalculate()
+{
+    typedef bsl::deque<Sample>::const_iterator Iterator;
+
+    d_numRemovals = 0;
+
+    double sum = 0.0;
+    for (Iterator it = d_samples.begin(); it != d_samples.end(); ++it) {
+        sum += it->d_value;
+    }
+    const double mean = sum / static_cast<double>(d_samples.size());
+
+    double M2 = 0.0;
+    for (Iterator it = d_samples.begin(); it != d_samples.end(); ++it) {
+        const double delta = it->d_value - mean;
+        M2 += delta * delta;
+    }
+
+    d_mean   = mean;
+    d_M2     = M2;
+    d_M2Peak = M2;
+}
+
+// CREATORS
+RollingMoment::RollingMoment(int maxCount, bslma::Allocator *basicAllocator)
+: d_samples(basicAllocator)
+, d_maxCount(maxCount)
+, d_maxAge()
+, d_mean(0.0)
+, d_M2(0.0)
+, d_M2Peak(0.0)
+, d_numRemovals(0)
+{
+    BSLS_ASSERT(0 < maxCount);
+}
+
+RollingMoment::RollingMoment(const bsls::TimeInterval&  maxAge,
+                             bslma::Allocator          *basicAllocator)
+: d_samples(basicAllocator)
+, d_maxCount(0)
+, d_maxAge(maxAge)
+, d_mean(0.0)
+, d_M2(0.0)
+, d_M2Peak(0.0)
+, d_numRemovals(0)
+{
+    BSLS_ASSERT(bsls::TimeInterval() < maxAge);
+}
+
+RollingMoment::RollingMoment(int                        maxCount,
+                             const bsls::TimeInterval&  maxAge,
+                             bslma::Allocator          *basicAllocator)
+: d_samples(basicAllocator)
+, d_maxCount(maxCount)
+, d_maxAge(maxAge)
+, d_mean(0.0)
+, d_M2(0.0)
+, d_M2Peak(0.0)
+, d_numRemovals(0)
+{
+    BSLS_ASSERT(0 <= maxCount);
+    BSLS_ASSERT(bsls::TimeInterval() <= maxAge);
+}
+
+RollingMoment::RollingMoment(const RollingMoment&  original,
+                             bslma::Allocator     *basicAllocator)
+: d_samples(original.d_samples, basicAllocator)
+, d_maxCount(original.d_maxCount)
+, d_maxAge(original.d_maxAge)
+, d_mean(original.d_mean)
+, d_M2(original.d_M2)
+, d_M2Peak(original.d_M2Peak)
+, d_numRemovals(original.d_numRemovals)
+{
+}
+
+// MANIPULATORS
+void RollingMoment::add(double value, const bsls::TimeInterval& timestamp)
+{
+    BSLS_ASSERT(d_samples.empty()
+             || d_samples.back().d_timestamp <= timestamp);
+
+    expire(timestamp);
+
+    if (d_maxCount && static_cast<int>(d_samples.size()) >= d_maxCount) {
+        evictOldest();
+    }
+
+    Sample sample;
+    sample.d_value     = value;
+    sample.d_timestamp = timestamp;
+    d_samples.push_back(sample);
+    insert(value);
+}
+
+void RollingMoment::expire(const bsls::TimeInterval& now)
+{
+    if (bsls::TimeInterval() == d_maxAge) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::TimeInterval limit = now - d_maxAge;
+    while (!d_samples.empty() && d_samples.front().d_timestamp <= limit) {
+        evictOldest();
+    }
+}
+
+void RollingMoment::reset()
+{
+    d_samples.clear();
+    d_mean        = 0.0;
+    d_M2          = 0.0;
+    d_M2Peak      = 0.0;
+    d_numRemovals = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,396 @@
+// bdlsta_rollingmoment.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLSTA_ROLLINGMOMENT
+#define INCLUDED_BDLSTA_ROLLINGMOMENT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Online mean and variance over a rolling window of values.
+//
+//@CLASSES:
+//  bdlsta::RollingMoment: mean and variance of the most recent values
+//
+//@SEE_ALSO: bdlsta_moment, bdlsta_rollinglinefit
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlsta::RollingMoment',
+// that provides online calculation of the mean and variance of the values in a
+// rolling window: the most recent 'maxCount' values, the values added during
+// the most recent 'maxAge' time interval, or both.  Each value added (and each
+// value leaving the window) updates the statistics in constant time, so the
+// statistics can be recalculated on every addition.
+//
+// Values enter the window using the Welford update of 'bdlsta::Moment', and
+// leave it using the inverse of that update.  Since removal accumulates
+// rounding error, the statistics are recalculated exactly from the values in
+// the window each time as many values have been removed as are in the window,
+// which keeps the amortized cost of each update constant.  Removal also loses
+// accuracy abruptly when the window slides from widely spread values to
+// closely spread ones (e.g., from values around 1e9 to values around 1), so
+// the statistics are also recalculated when the 2nd moment falls below a
+// small fraction ('2^-20') of its largest value since the last recalculation.
+// The relative error of the variance therefore stays within about
+// '2^20 * count() * DBL_EPSILON'.
+//
+///Windows
+///-------
+// The window is specified at construction by a maximum count, a maximum age,
+// or both; a maximum count of 0, or a maximum age of zero, means that the
+// window is not bounded in that dimension.  Values are added by 'add(value)',
+// which evicts values only to respect the maximum count, or by
+// 'add(value, timestamp)', which also evicts the values whose timestamp is not
+// after 'timestamp - maxAge'.  Timestamps are arbitrary time intervals (e.g.,
+// from 'bsls::SystemTime::nowMonotonicClock()'), and must not decrease from
+// one value to the next.  'expire(now)' evicts the values that are too old
+// without adding a new one.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Moving Mean and Variance of the Last N Values
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to calculate the mean and variance of the last 3
+// values of a series.
+//
+// First, we create example input and a rolling moment of 3 values:
+//..
+//  const double input[] = { 1.0, 2.0, 4.0, 5.0, 9.0 };
+//
+//  bdlsta::RollingMoment rm(3);
+//..
+// Then, we invoke the 'add' routine to accumulate the data; once 3 values
+// have been added, each new value evicts the oldest one:
+//..
+//  for (int i = 0; i < 5; ++i) {
+//      rm.add(input[i]);
+//  }
+//..
+// Finally, we assert that the mean and variance are those of '{ 4, 5, 9 }':
+//..
+//  assert(3 == rm.count());
+//  assert(1e-10 > fabs(6.0 - rm.mean()));
+//  assert(1e-10 > fabs(7.0 - rm.variance()));
+//..
+//
+///Example 2: Moving Mean over a Time Interval
+///- - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to calculate the mean of the prices seen in the last
+// 10 seconds.
+//
+// First, we create a rolling moment having a maximum age of 10 seconds and no
+// maximum count:
+//..
+//  bdlsta::RollingMoment prices(bsls::TimeInterval(10, 0));
+//..
+// Then, we add prices with their timestamps:
+//..
+//  prices.add(100.0, bsls::TimeInterval(1, 0));
+//  prices.add(102.0, bsls::TimeInterval(5, 0));
+//  prices.add(104.0, bsls::TimeInterval(9, 0));
+//  assert(3 == prices.count());
+//  assert(1e-10 > fabs(102.0 - prices.mean()));
+//..
+// Next, we add a price at 12 seconds, which evicts the price of 1 second:
+//..
+//  prices.add(106.0, bsls::TimeInterval(12, 0));
+//  assert(3 == prices.count());
+//  assert(1e-10 > fabs(104.0 - prices.mean()));
+//..
+// Finally, when no price arrives for a while, 'expire' evicts the stale ones:
+//..
+//  prices.expire(bsls::TimeInterval(20, 0));
+//  assert(1 == prices.count());
+//  assert(106.0 == prices.mean());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_deque.h>
+
+namespace BloombergLP {
+namespace bdlsta {
+
+                            // ===================
+                            // class RollingMoment
+                            // ===================
+
+class RollingMoment {
+    // This class provides an online calculation of the mean and variance of
+    // the values in a rolling window bounded by count, by age, or both.  The
+    // values in the window are retained, so that they can be removed when
+    // they leave the window.
+
+    // PRIVATE TYPES
+    struct Sample {
+        // This 'struct' holds one value of the window.
+
+        double             d_value;      // value
+        bsls::TimeInterval d_timestamp;  // time of addition, if supplied
+    };
+
+    // DATA
+    bsl::deque<Sample> d_samples;      // values in the window, oldest first
+    int                d_maxCount;     // maximum number of values, or 0
+    bsls::TimeInterval d_maxAge;       // maximum age of values, or zero
+    double             d_mean;         // mean of the values in the window
+    double             d_M2;           // 2nd moment, for variance
+    double             d_M2Peak;       // largest 'd_M2' since last
+                                       // recalculation
+    int                d_numRemovals;  // removals since last recalculation
+
+    // PRIVATE MANIPULATORS
+    void evictOldest();
+        // Remove the oldest value from the window.  The behavior is undefined
+        // if the window is empty.
+
+    void insert(double value);
+        // Add the specified 'value', already appended to 'd_samples', to the
+        // statistics.
+
+    void recalculate();
+        // Recalculate the statistics exactly from the values in the window.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RollingMoment, bslma::UsesBslmaAllocator);
+
+    // CONSTANTS
+    enum {
+        e_SUCCESS         = 0,
+        e_INADEQUATE_DATA = -1
+    };
+
+    // CREATORS
+    explicit RollingMoment(int               maxCount,
+                           bslma::Allocator *basicAllocator = 0);
+        // Create an empty object whose window holds the most recent specified
+        // 'maxCount' values.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 < maxCount'.
+
+    explicit RollingMoment(const bsls::TimeInterval&  maxAge,
+                           bslma::Allocator          *basicAllocator = 0);
+        // Create an empty object whose window holds the values added during
+        // the most recent specified 'maxAge' time interval.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // 'bsls::TimeInterval() < maxAge'.
+
+    RollingMoment(int                        maxCount,
+                  const bsls::TimeInterval&  maxAge,
+                  bslma::Allocator          *basicAllocator = 0);
+        // Create an empty object whose window holds at most the specified
+        // 'maxCount' values, added during the most recent specified 'maxAge'
+        // time interval.  A 'maxCount' of 0 or a 'maxAge' of zero leaves the
+        // window unbounded in that dimension.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 <= maxCount' and
+        // 'bsls::TimeInterval() <= maxAge'.
+
+    RollingMoment(const RollingMoment&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create an object having the same window and values as the specified
+        // 'original' object.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~RollingMoment() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! RollingMoment& operator=(const RollingMoment& rhs) = default;
+        // Assign to this object the window and values of the specified 'rhs'
+        // object, and return a reference providing modifiable access to this
+        // object.
+
+    void add(double value);
+        // Add the specified 'value' to the window, evicting the oldest value
+        // if the window already holds 'maxCount()' values.  Note that no value
+        // is evicted because of its age.
+
+    void add(double value, const bsls::TimeInterval& timestamp);
+        // Add the specified 'value', having the specified 'timestamp', to the
+        // window, first evicting the values that are older than 'maxAge()'
+        // relative to 'timestamp' and, if the window still holds 'maxCount()'
+        // values, the oldest value.  The behavior is undefined if 'timestamp'
+        // is before the timestamp of a value in the window.
+
+    void expire(const bsls::TimeInterval& now);
+        // Evict from the window the values whose timestamp is not after
+        // 'now - maxAge()'.  This method has no effect if 'maxAge()' is zero.
+
+    void reset();
+        // Remove all values from the window.
+
+    // ACCESSORS
+    int count() const;
+        // Return the number of values in the window.
+
+    bsls::TimeInterval maxAge() const;
+        // Return the maximum age of the values in the window, or zero if the
+        // window is not bounded by age.
+
+    int maxCount() const;
+        // Return the maximum number of values in the window, or 0 if the
+        // window is not bounded by count.
+
+    double mean() const;
+        // Return the mean of the values in the window.  The behavior is
+        // undefined unless '1 <= count()'.
+
+    int meanIfValid(double *result) const;
+        // Load into the specified 'result' the mean of the values in the
+        // window.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, 'e_INADEQUATE_DATA' is returned if '1 > count()'.
+
+    double variance() const;
+        // Return the (sample) variance of the values in the window.  The
+        // behavior is undefined unless '2 <= count()'.
+
+    int varianceIfValid(double *result) const;
+        // Load into the specified 'result' the variance of the values in the
+        // window.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, 'e_INADEQUATE_DATA' is returned if '2 > count()'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                               INLINE DEFINITIONS
+// ============================================================================
+
+                          // ---------------------------
+                          // class bdlsta::RollingMoment
+                          // ---------------------------
+
+// PRIVATE MANIPULATORS
+inline
+void RollingMoment::insert(double value)
+{
+    // Welford algorithm for variance.
+
+    const double n     = static_cast<double>(d_samples.size());
+    const double delta = value - d_mean;
+    d_mean += delta / n;
+    d_M2   += delta * (value - d_mean);
+
+    if (d_M2 > d_M2Peak) {
+        d_M2Peak = d_M2;
+    }
+}
+
+// MANIPULATORS
+inline
+void RollingMoment::add(double value)
+{
+    if (d_maxCount && static_cast<int>(d_samples.size()) >= d_maxCount) {
+        evictOldest();
+    }
+
+    Sample sample;
+    sample.d_value = value;
+    if (!d_samples.empty()) {
+        sample.d_timestamp = d_samples.back().d_timestamp;
+    }
+    d_samples.push_back(sample);
+    insert(value);
+}
+
+// ACCESSORS
+inline
+int RollingMoment::count() const
+{
+    return static_cast<int>(d_samples.size());
+}
+
+inline
+bsls::TimeInterval RollingMoment::maxAge() const
+{
+    return d_maxAge;
+}
+
+inline
+int RollingMoment::maxCount() const
+{
+    return d_maxCount;
+}
+
+inline
+double RollingMoment::mean() const
+{
+    BSLS_ASSERT(1 <= count());
+
+    return d_mean;
+}
+
+inline
+int RollingMoment::meanIfValid(double *result) const
+{
+    if (1 > count()) {
+        return e_INADEQUATE_DATA;                                     // RETURN
+    }
+    *result = mean();
+    return 0;
+}
+
+inline
+double RollingMoment::variance() const
+{
+    BSLS_ASSERT(2 <= count());
+
+    return d_M2 / (count() - 1);
+}
+
+inline
+int RollingMoment::varianceIfValid(double *result) const
+{
+    if (2 > count()) {
+        return e_INADEQUATE_DATA;                                     // RETURN
+    }
+    *result = variance();
+    return 0;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *RollingMoment::allocator() const
+{
+    return d_samples.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
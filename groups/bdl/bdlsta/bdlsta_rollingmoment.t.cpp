@@ -0,0 +1,700 @@
+// bdlsta_rollingmoment.t.cpp                                         -*-C++-*-
+#include <bdlsta_rollingmoment.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cmath.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a mechanism calculating the mean and variance
+// of the values in a rolling window.  The statistics are verified against
+// those calculated directly (with two passes) from the values that should be
+// in the window, for windows bounded by count, by age, and by both.  The
+// accuracy of the statistics after many removals is verified with data whose
+// magnitude changes abruptly.  Negative tests are conducted for the
+// preconditions.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] RollingMoment(int maxCount, Allocator *ba = 0)
+// [ 3] RollingMoment(const TimeInterval& maxAge, Allocator *ba = 0)
+// [ 3] RollingMoment(int, const TimeInterval&, Allocator *ba = 0)
+// [ 5] RollingMoment(const RollingMoment& original, Allocator *ba = 0)
+//
+// MANIPULATORS
+// [ 2] void add(double value)
+// [ 3] void add(double value, const TimeInterval& timestamp)
+// [ 3] void expire(const TimeInterval& now)
+// [ 5] void reset()
+//
+// ACCESSORS
+// [ 2] int count() const
+// [ 3] TimeInterval maxAge() const
+// [ 2] int maxCount() const
+// [ 2] double mean() const
+// [ 5] int meanIfValid(double *result) const
+// [ 2] double variance() const
+// [ 5] int varianceIfValid(double *result) const
+// [ 5] bslma::Allocator *allocator() const
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] ACCURACY AFTER MANY REMOVALS
+// [ 6] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+// NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                      GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlsta::RollingMoment Obj;
+typedef bsls::TimeInterval    TI;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void directMoments(double       *mean,
+                   double       *variance,
+                   const double *values,
+                   int           count)
+    // Load into the specified 'mean' and 'variance' the mean and sample
+    // variance of the specified 'count' 'values', calculated with two passes.
+    // The behavior is undefined unless '2 <= count'.
+{
+    double sum = 0.0;
+    for (int i = 0; i < count; ++i) {
+        sum += values[i];
+    }
+    *mean = sum / count;
+
+    double M2 = 0.0;
+    for (int i = 0; i < count; ++i) {
+        M2 += (values[i] - *mean) * (values[i] - *mean);
+    }
+    *variance = M2 / (count - 1);
+}
+
+bool isClose(double expected, double actual, double tolerance)
+    // Return 'true' if the specified 'actual' value is within the specified
+    // relative 'tolerance' of the specified 'expected' value (or within
+    // 'tolerance' of it if 'expected' is smaller than 1 in magnitude).
+{
+    const double scale = fabs(expected) > 1.0 ? fabs(expected) : 1.0;
+    return fabs(expected - actual) <= tolerance * scale;
+}
+
+double nextRandom(unsigned int *state)
+    // Return the next pseudo-random value in '[0, 1)' of the sequence having
+    // the specified 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return static_cast<double>((*state >> 8) & 0xFFFFFF) / 16777216.0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Moving Mean and Variance of the Last N Values
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to calculate the mean and variance of the last 3
+// values of a series.
+//
+// First, we create example input and a rolling moment of 3 values:
+//..
+    const double input[] = { 1.0, 2.0, 4.0, 5.0, 9.0 };
+
+    bdlsta::RollingMoment rm(3);
+//..
+// Then, we invoke the 'add' routine to accumulate the data; once 3 values
+// have been added, each new value evicts the oldest one:
+//..
+    for (int i = 0; i < 5; ++i) {
+        rm.add(input[i]);
+    }
+//..
+// Finally, we assert that the mean and variance are those of '{ 4, 5, 9 }':
+//..
+    ASSERT(3 == rm.count());
+    ASSERT(1e-10 > fabs(6.0 - rm.mean()));
+    ASSERT(1e-10 > fabs(7.0 - rm.variance()));
+//..
+//
+///Example 2: Moving Mean over a Time Interval
+///- - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to calculate the mean of the prices seen in the last
+// 10 seconds.
+//
+// First, we create a rolling moment having a maximum age of 10 seconds and no
+// maximum count:
+//..
+    bdlsta::RollingMoment prices(bsls::TimeInterval(10, 0));
+//..
+// Then, we add prices with their timestamps:
+//..
+    prices.add(100.0, bsls::TimeInterval(1, 0));
+    prices.add(102.0, bsls::TimeInterval(5, 0));
+    prices.add(104.0, bsls::TimeInterval(9, 0));
+    ASSERT(3 == prices.count());
+    ASSERT(1e-10 > fabs(102.0 - prices.mean()));
+//..
+// Next, we add a price at 12 seconds, which evicts the price of 1 second:
+//..
+    prices.add(106.0, bsls::TimeInterval(12, 0));
+    ASSERT(3 == prices.count());
+    ASSERT(1e-10 > fabs(104.0 - prices.mean()));
+//..
+// Finally, when no price arrives for a while, 'expire' evicts the stale ones:
+//..
+    prices.expire(bsls::TimeInterval(20, 0));
+    ASSERT(1 == prices.count());
+    ASSERT(106.0 == prices.mean());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, RESET, ALLOCATOR, AND EDGE CASES
+        //
+        // Concerns:
+        //: 1 The copy constructor copies the window and values, and uses the
+        //:   supplied allocator (or the default allocator if none is
+        //:   supplied).
+        //:
+        //: 2 Memory is allocated only from the object allocator.
+        //:
+        //: 3 'reset' empties the window, and the object is usable afterwards.
+        //:
+        //: 4 'meanIfValid' and 'varianceIfValid' fail with too few values.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with test allocators, add values, copy them, and
+        //:   verify the statistics of the copies and the allocators used.
+        //:   (C-1, 2)
+        //:
+        //: 2 Reset an object and verify that it behaves as a new one.  (C-3)
+        //:
+        //: 3 Verify the results of the 'IfValid' accessors for 0, 1, and 2
+        //:   values.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   RollingMoment(const RollingMoment& original, Allocator *ba = 0)
+        //   void reset()
+        //   int meanIfValid(double *result) const
+        //   int varianceIfValid(double *result) const
+        //   bslma::Allocator *allocator() const
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, RESET, ALLOCATOR, AND EDGE CASES" << endl
+                          << "======================================" << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::TestAllocator         oa("object",  veryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tCopy and allocator." << endl;
+        {
+            Obj mX(4, &oa);  const Obj& X = mX;
+            ASSERT(&oa == X.allocator());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.add(i * 1.5);
+            }
+            ASSERT(0 <  oa.numBlocksInUse());
+            ASSERT(0 == da.numBlocksTotal());
+
+            Obj mY(X, &sa);  const Obj& Y = mY;
+            ASSERT(&sa == Y.allocator());
+            ASSERT(0 <  sa.numBlocksInUse());
+            ASSERT(X.count()    == Y.count());
+            ASSERT(X.maxCount() == Y.maxCount());
+            ASSERT(X.mean()     == Y.mean());
+            ASSERT(X.variance() == Y.variance());
+
+            Obj mZ(X);  const Obj& Z = mZ;
+            ASSERT(&da == Z.allocator());
+            ASSERT(X.mean() == Z.mean());
+
+            mX.add(100.0);
+            mY.add(100.0);
+            ASSERT(X.mean()     == Y.mean());
+            ASSERT(X.variance() == Y.variance());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tReset and 'IfValid' accessors." << endl;
+        {
+            Obj mX(3, &oa);  const Obj& X = mX;
+
+            double result = -1.0;
+            ASSERT(Obj::e_INADEQUATE_DATA == X.meanIfValid(&result));
+            ASSERT(Obj::e_INADEQUATE_DATA == X.varianceIfValid(&result));
+            ASSERT(-1.0 == result);
+
+            mX.add(2.0);
+            ASSERT(0                      == X.meanIfValid(&result));
+            ASSERT(2.0                    == result);
+            ASSERT(Obj::e_INADEQUATE_DATA == X.varianceIfValid(&result));
+
+            mX.add(4.0);
+            ASSERT(0   == X.varianceIfValid(&result));
+            ASSERT(2.0 == result);
+
+            mX.reset();
+            ASSERT(0 == X.count());
+            ASSERT(3 == X.maxCount());
+            ASSERT(Obj::e_INADEQUATE_DATA == X.meanIfValid(&result));
+
+            mX.add(5.0);
+            mX.add(7.0);
+            ASSERT(2   == X.count());
+            ASSERT(6.0 == X.mean());
+            ASSERT(2.0 == X.variance());
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1));
+            ASSERT_FAIL(Obj(0));
+            ASSERT_PASS(Obj(TI(0, 1)));
+            ASSERT_FAIL(Obj(TI(0, 0)));
+            ASSERT_PASS(Obj(0, TI(0, 0)));
+            ASSERT_FAIL(Obj(-1, TI(0, 0)));
+            ASSERT_FAIL(Obj(0, TI(-1, 0)));
+
+            Obj mX(TI(10, 0));  const Obj& X = mX;
+            ASSERT_SAFE_FAIL(X.mean());
+            mX.add(1.0, TI(5, 0));
+            ASSERT_SAFE_PASS(X.mean());
+            ASSERT_SAFE_FAIL(X.variance());
+            ASSERT_PASS(mX.add(1.0, TI(5, 0)));
+            ASSERT_FAIL(mX.add(1.0, TI(4, 0)));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ACCURACY AFTER MANY REMOVALS
+        //
+        // Concerns:
+        //: 1 The statistics stay accurate when the window slides from values
+        //:   of large magnitude to values of small magnitude, and over many
+        //:   windows' worth of values.
+        //
+        // Plan:
+        //: 1 Add alternately 1000 values of magnitude 1e9 and 1000 values
+        //:   of magnitude 1, and verify after each addition that the mean and
+        //:   variance are within the documented relative error of those
+        //:   calculated directly.  (C-1)
+        //
+        // Testing:
+        //   ACCURACY AFTER MANY REMOVALS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ACCURACY AFTER MANY REMOVALS" << endl
+                          << "============================" << endl;
+
+        const int    WINDOW = 16;
+        unsigned int state  = 1;
+
+        Obj                 mX(WINDOW);  const Obj& X = mX;
+        bsl::vector<double> values;
+
+        for (int i = 0; i < 100000; ++i) {
+            const double magnitude = (i / 1000) % 2 ? 1.0 : 1e9;
+            const double value     = magnitude * (1.0 + nextRandom(&state));
+
+            mX.add(value);
+            values.push_back(value);
+
+            if (WINDOW > X.count()) {
+                continue;                                           // CONTINUE
+            }
+
+            double mean, variance;
+            directMoments(&mean,
+                          &variance,
+                          &values[values.size() - WINDOW],
+                          WINDOW);
+
+            const double tolerance = 1e-8;
+
+            ASSERTV(i, mean, X.mean(), isClose(mean, X.mean(), tolerance));
+            ASSERTV(i, variance, X.variance(),
+                    isClose(variance, X.variance(), tolerance));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // WINDOWS BOUNDED BY AGE
+        //
+        // Concerns:
+        //: 1 'add(value, timestamp)' evicts the values whose timestamp is not
+        //:   after 'timestamp - maxAge'.
+        //:
+        //: 2 'expire' evicts the same values without adding a value, and has
+        //:   no effect if the window is not bounded by age.
+        //:
+        //: 3 When the window is bounded by both count and age, both bounds
+        //:   are respected.
+        //:
+        //: 4 'maxAge' and 'maxCount' return the bounds supplied at
+        //:   construction.
+        //
+        // Plan:
+        //: 1 Add values at irregular timestamps to objects bounded by age, and
+        //:   by age and count, and verify after each addition the count,
+        //:   mean, and variance against those calculated directly from the
+        //:   values that should be in the window.  (C-1, 3)
+        //:
+        //: 2 Call 'expire' at several times and verify the count.  (C-2)
+        //:
+        //: 3 Verify the bounds of the objects.  (C-4)
+        //
+        // Testing:
+        //   RollingMoment(const TimeInterval& maxAge, Allocator *ba = 0)
+        //   RollingMoment(int, const TimeInterval&, Allocator *ba = 0)
+        //   void add(double value, const TimeInterval& timestamp)
+        //   void expire(const TimeInterval& now)
+        //   TimeInterval maxAge() const
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WINDOWS BOUNDED BY AGE" << endl
+                          << "======================" << endl;
+
+        const TI     MAX_AGE(2, 500000000);  // 2.5 seconds
+        const int    MAX_COUNTS[] = { 0, 3 };
+        unsigned int state        = 7;
+
+        for (int c = 0; c < 2; ++c) {
+            const int MAX_COUNT = MAX_COUNTS[c];
+
+            Obj mX(MAX_COUNT, MAX_AGE);  const Obj& X = mX;
+            ASSERT(MAX_AGE   == X.maxAge());
+            ASSERT(MAX_COUNT == X.maxCount());
+
+            bsl::vector<double> values;
+            bsl::vector<TI>     timestamps;
+            TI                  now;
+
+            for (int i = 0; i < 200; ++i) {
+                now.addMilliseconds(
+                               static_cast<int>(nextRandom(&state) * 1000.0));
+                const double value = 10.0 * nextRandom(&state) - 5.0;
+
+                mX.add(value, now);
+                values.push_back(value);
+                timestamps.push_back(now);
+
+                // Find the first value that should be in the window.
+
+                int first = static_cast<int>(values.size()) - 1;
+                while (0 < first && timestamps[first - 1] > now - MAX_AGE) {
+                    --first;
+                }
+                if (MAX_COUNT && static_cast<int>(values.size()) - first >
+                                                                   MAX_COUNT) {
+                    first = static_cast<int>(values.size()) - MAX_COUNT;
+                }
+                const int expectedCount = static_cast<int>(values.size())
+                                        - first;
+
+                ASSERTV(c, i, expectedCount, X.count(),
+                        expectedCount == X.count());
+
+                if (2 <= expectedCount) {
+                    double mean, variance;
+                    directMoments(&mean,
+                                  &variance,
+                                  &values[first],
+                                  expectedCount);
+
+                    ASSERTV(c, i, mean, X.mean(),
+                            isClose(mean, X.mean(), 1e-12));
+                    ASSERTV(c, i, variance, X.variance(),
+                            isClose(variance, X.variance(), 1e-12));
+                }
+            }
+
+            mX.expire(now);
+            ASSERT(1 <= X.count());
+
+            mX.expire(now + MAX_AGE - TI(0, 1));
+            ASSERT(1 == X.count());
+            ASSERT(values.back() == X.mean());
+
+            mX.expire(now + MAX_AGE);
+            ASSERT(0 == X.count());
+        }
+
+        if (verbose) cout << "\tExpiry of windows bounded by count." << endl;
+        {
+            Obj mX(2);  const Obj& X = mX;
+            mX.add(1.0, TI(1, 0));
+            mX.add(2.0, TI(100, 0));
+            mX.expire(TI(1000, 0));
+            ASSERT(2 == X.count());
+            ASSERT(TI() == X.maxAge());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // WINDOWS BOUNDED BY COUNT
+        //
+        // Concerns:
+        //: 1 The window holds the most recent 'maxCount' values, and the mean
+        //:   and variance are those of the values in the window.
+        //:
+        //: 2 The statistics are correct for windows of 1 value.
+        //
+        // Plan:
+        //: 1 For several window sizes, add pseudo-random values and verify
+        //:   after each addition the count, mean, and variance against those
+        //:   calculated directly from the most recent values.  (C-1, 2)
+        //
+        // Testing:
+        //   RollingMoment(int maxCount, Allocator *ba = 0)
+        //   void add(double value)
+        //   int count() const
+        //   int maxCount() const
+        //   double mean() const
+        //   double variance() const
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WINDOWS BOUNDED BY COUNT" << endl
+                          << "========================" << endl;
+
+        const int    WINDOWS[]   = { 1, 2, 3, 7, 64, 1000 };
+        const int    NUM_WINDOWS = sizeof WINDOWS / sizeof *WINDOWS;
+        unsigned int state       = 12345;
+
+        for (int w = 0; w < NUM_WINDOWS; ++w) {
+            const int WINDOW = WINDOWS[w];
+
+            Obj mX(WINDOW);  const Obj& X = mX;
+            ASSERT(WINDOW == X.maxCount());
+            ASSERT(0      == X.count());
+
+            bsl::vector<double> values;
+
+            for (int i = 0; i < 3 * WINDOW + 50; ++i) {
+                const double value = 1000.0 * nextRandom(&state) - 300.0;
+                mX.add(value);
+                values.push_back(value);
+
+                const int size     = static_cast<int>(values.size());
+                const int expected = size < WINDOW ? size : WINDOW;
+                ASSERTV(WINDOW, i, expected == X.count());
+
+                if (1 == expected) {
+                    ASSERTV(WINDOW, i, value == X.mean());
+                    continue;                                       // CONTINUE
+                }
+
+                double mean, variance;
+                directMoments(&mean, &variance, &values[size - expected],
+                              expected);
+
+                if (veryVerbose) {
+                    P_(WINDOW) P_(i) P_(mean) P(X.mean());
+                }
+
+                ASSERTV(WINDOW, i, mean, X.mean(),
+                        isClose(mean, X.mean(), 1e-12));
+                ASSERTV(WINDOW, i, variance, X.variance(),
+                        isClose(variance, X.variance(), 1e-10));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Developer test sandbox. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(2);  const Obj& X = mX;
+
+        mX.add(1.0);
+        ASSERT(1   == X.count());
+        ASSERT(1.0 == X.mean());
+
+        mX.add(3.0);
+        ASSERT(2   == X.count());
+        ASSERT(2.0 == X.mean());
+        ASSERT(2.0 == X.variance());
+
+        mX.add(7.0);
+        ASSERT(2   == X.count());
+        ASSERT(5.0 == X.mean());
+        ASSERT(8.0 == X.variance());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,381 @@
+// bdlsta_summationutil.cpp                                           -*-C++-*-
+#include <bdlsta_summationutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlsta {
+//@IMPLEMENTATION NOTES:
+//
+// The kernels process the values in groups, each value of a group being added
+// to a different accumulator (a "lane"), so that the additions of a group are
+// independent and can be issued together; where SSE2 is available, two lanes
+// are held in each register, and added by a single instruction.  Within each
+// lane, the values are added in order, so that the result does not depend on
+// the instructions used.
+//
+// The compensated sums use the 'Sum2' algorithm of Ogita, Rump, and Oishi
+// ("Accurate Sum and Dot Product", 2005), in which each lane adds each term
+// 'x' to its sum 's' using Knuth's error-free 'TwoSum' transformation, and
+// accumulates the rounding errors in a compensation 'c':
+//..
+//  t = s + x
+//  z = t - s
+//  c = c + ((s - (t - z)) + (x - z))
+//  s = t
+//..
+// Unlike in Kahan's algorithm, the compensation is not fed back into the sum
+// until the end, so that the only dependency between successive additions of
+// a lane is that of 's', and the additions proceed at the rate of an
+// uncompensated sum.  The error of the result is at most about
+// 'eps * |sum| + (n * eps)^2 * S' (where 'S' is the sum of the absolute
+// values of the terms), which is below the documented bound.  Note that the
+// lanes are combined the same way.
+//
+// 'sumPowers' sums the terms pairwise: blocks of 'k_BLOCK_SIZE' terms are
+// summed directly (each of 'k_NUM_POWER_LANES' lanes adding
+// 'k_BLOCK_SIZE / k_NUM_POWER_LANES' terms), and the sums of the two halves of
+// a larger array are computed recursively.
+
+namespace {
+
+enum {
+    k_NUM_SUM_LANES   = 8,    // number of lanes of compensated sums
+    k_NUM_POWER_LANES = 4,    // number of lanes of 'sumPowers'
+    k_BLOCK_SIZE      = 256   // number of values summed directly by
+                              // 'sumPowers'
+};
+
+inline
+void twoSum(double *sum, double *compensation, double term)
+    // Add the specified 'term' to the specified 'sum', and the rounding error
+    // of the addition to the specified 'compensation'.
+{
+    const double t = *sum + term;
+    const double z = t - *sum;
+    *compensation += (*sum - (t - z)) + (term - z);
+    *sum           = t;
+}
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+inline
+void twoSum(__m128d *sum, __m128d *compensation, __m128d term)
+    // Add the specified 'term' to the specified 'sum', and the rounding error
+    // of the addition to the specified 'compensation', in each of two lanes.
+{
+    const __m128d t = _mm_add_pd(*sum, term);
+    const __m128d z = _mm_sub_pd(t, *sum);
+    *compensation = _mm_add_pd(*compensation,
+                               _mm_add_pd(_mm_sub_pd(*sum, _mm_sub_pd(t, z)),
+                                          _mm_sub_pd(term, z)));
+    *sum          = t;
+}
+#endif
+
+class Values {
+    // This class provides access to the terms of a sum of values.
+
+    // DATA
+    const double *d_values_p;  // values (held, not owned)
+
+  public:
+    // CREATORS
+    explicit Values(const double *values)
+    : d_values_p(values)
+        // Create an object providing access to the specified 'values'.
+    {
+    }
+
+    // ACCESSORS
+    double operator[](bsl::size_t index) const
+        // Return the term at the specified 'index'.
+    {
+        return d_values_p[index];
+    }
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    __m128d load(bsl::size_t index) const
+        // Return the terms at the specified 'index' and 'index + 1'.
+    {
+        return _mm_loadu_pd(d_values_p + index);
+    }
+#endif
+};
+
+class Products {
+    // This class provides access to the terms of a sum of products.
+
+    // DATA
+    const double *d_xValues_p;  // first factors (held, not owned)
+    const double *d_yValues_p;  // second factors (held, not owned)
+
+  public:
+    // CREATORS
+    Products(const double *xValues, const double *yValues)
+    : d_xValues_p(xValues)
+    , d_yValues_p(yValues)
+        // Create an object providing access to the products of the
+        // corresponding elements of the specified 'xValues' and 'yValues'.
+    {
+    }
+
+    // ACCESSORS
+    double operator[](bsl::size_t index) const
+        // Return the term at the specified 'index'.
+    {
+        return d_xValues_p[index] * d_yValues_p[index];
+    }
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    __m128d load(bsl::size_t index) const
+        // Return the terms at the specified 'index' and 'index + 1'.
+    {
+        return _mm_mul_pd(_mm_loadu_pd(d_xValues_p + index),
+                          _mm_loadu_pd(d_yValues_p + index));
+    }
+#endif
+};
+
+template <class TERMS>
+double compensatedSum(const TERMS& terms, bsl::size_t numTerms)
+    // Return the sum of the specified 'numTerms' 'terms', using compensated
+    // summation.
+{
+    double sums[k_NUM_SUM_LANES];
+    double compensations[k_NUM_SUM_LANES];
+
+    bsl::size_t i = 0;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    __m128d s0 = _mm_setzero_pd(), c0 = _mm_setzero_pd();
+    __m128d s1 = _mm_setzero_pd(), c1 = _mm_setzero_pd();
+    __m128d s2 = _mm_setzero_pd(), c2 = _mm_setzero_pd();
+    __m128d s3 = _mm_setzero_pd(), c3 = _mm_setzero_pd();
+
+    for (; i + k_NUM_SUM_LANES <= numTerms; i += k_NUM_SUM_LANES) {
+        twoSum(&s0, &c0, terms.load(i));
+        twoSum(&s1, &c1, terms.load(i + 2));
+        twoSum(&s2, &c2, terms.load(i + 4));
+        twoSum(&s3, &c3, terms.load(i + 6));
+    }
+
+    _mm_storeu_pd(sums,     s0);  _mm_storeu_pd(compensations,     c0);
+    _mm_storeu_pd(sums + 2, s1);  _mm_storeu_pd(compensations + 2, c1);
+    _mm_storeu_pd(sums + 4, s2);  _mm_storeu_pd(compensations + 4, c2);
+    _mm_storeu_pd(sums + 6, s3);  _mm_storeu_pd(compensations + 6, c3);
+#else
+    for (int lane = 0; lane < k_NUM_SUM_LANES; ++lane) {
+        sums[lane]          = 0.0;
+        compensations[lane] = 0.0;
+    }
+
+    for (; i + k_NUM_SUM_LANES <= numTerms; i += k_NUM_SUM_LANES) {
+        for (int lane = 0; lane < k_NUM_SUM_LANES; ++lane) {
+            twoSum(&sums[lane], &compensations[lane], terms[i + lane]);
+        }
+    }
+#endif
+
+    for (; i < numTerms; ++i) {
+        twoSum(&sums[0], &compensations[0], terms[i]);
+    }
+
+    double sum          = sums[0];
+    double compensation = compensations[0];
+    for (int lane = 1; lane < k_NUM_SUM_LANES; ++lane) {
+        twoSum(&sum, &compensation, sums[lane]);
+        compensation += compensations[lane];
+    }
+    return sum + compensation;
+}
+
+template <int NUM_POWERS>
+void sumPowersBlock(double       *sums,
+                    const double *values,
+                    bsl::size_t   numValues,
+                    double        origin)
+    // Load into the specified 'sums' array, having 'NUM_POWERS' elements, the
+    // sums of the powers, from 1 to 'NUM_POWERS', of the deviations of the
+    // specified 'numValues' elements of the specified 'values' array from the
+    // specified 'origin', summing each lane directly.
+{
+    double lanes[NUM_POWERS][k_NUM_POWER_LANES];
+
+    bsl::size_t i = 0;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    __m128d       low[NUM_POWERS];   // lanes 0 and 1
+    __m128d       high[NUM_POWERS];  // lanes 2 and 3
+    const __m128d o = _mm_set1_pd(origin);
+
+    for (int k = 0; k < NUM_POWERS; ++k) {
+        low[k]  = _mm_setzero_pd();
+        high[k] = _mm_setzero_pd();
+    }
+
+    for (; i + k_NUM_POWER_LANES <= numValues; i += k_NUM_POWER_LANES) {
+        const __m128d lowDelta  = _mm_sub_pd(_mm_loadu_pd(values + i),     o);
+        const __m128d highDelta = _mm_sub_pd(_mm_loadu_pd(values + i + 2), o);
+
+        __m128d lowPower  = lowDelta;
+        __m128d highPower = highDelta;
+        low[0]  = _mm_add_pd(low[0],  lowPower);
+        high[0] = _mm_add_pd(high[0], highPower);
+        for (int k = 1; k < NUM_POWERS; ++k) {
+            lowPower  = _mm_mul_pd(lowPower,  lowDelta);
+            highPower = _mm_mul_pd(highPower, highDelta);
+            low[k]    = _mm_add_pd(low[k],  lowPower);
+            high[k]   = _mm_add_pd(high[k], highPower);
+        }
+    }
+
+    for (int k = 0; k < NUM_POWERS; ++k) {
+        _mm_storeu_pd(lanes[k],     low[k]);
+        _mm_storeu_pd(lanes[k] + 2, high[k]);
+    }
+#else
+    for (int k = 0; k < NUM_POWERS; ++k) {
+        for (int lane = 0; lane < k_NUM_POWER_LANES; ++lane) {
+            lanes[k][lane] = 0.0;
+        }
+    }
+
+    for (; i + k_NUM_POWER_LANES <= numValues; i += k_NUM_POWER_LANES) {
+        for (int lane = 0; lane < k_NUM_POWER_LANES; ++lane) {
+            const double delta = values[i + lane] - origin;
+            double       power = delta;
+            lanes[0][lane] += power;
+            for (int k = 1; k < NUM_POWERS; ++k) {
+                power          *= delta;
+                lanes[k][lane] += power;
+            }
+        }
+    }
+#endif
+
+    for (; i < numValues; ++i) {
+        const double delta = values[i] - origin;
+        double       power = delta;
+        lanes[0][0] += power;
+        for (int k = 1; k < NUM_POWERS; ++k) {
+            power       *= delta;
+            lanes[k][0] += power;
+        }
+    }
+
+    for (int k = 0; k < NUM_POWERS; ++k) {
+        sums[k] = (lanes[k][0] + lanes[k][1]) + (lanes[k][2] + lanes[k][3]);
+    }
+}
+
+template <int NUM_POWERS>
+void sumPowersPairwise(double       *sums,
+                       const double *values,
+                       bsl::size_t   numValues,
+                       double        origin)
+    // Load into the specified 'sums' array, having 'NUM_POWERS' elements, the
+    // sums of the powers, from 1 to 'NUM_POWERS', of the deviations of the
+    // specified 'numValues' elements of the specified 'values' array from the
+    // specified 'origin', summing the halves of the array separately if it
+    // has more than 'k_BLOCK_SIZE' elements.
+{
+    if (numValues <= k_BLOCK_SIZE) {
+        sumPowersBlock<NUM_POWERS>(sums, values, numValues, origin);
+        return;                                                       // RETURN
+    }
+
+    // Split on a multiple of the block size, so that all the blocks but the
+    // last are full.
+
+    const bsl::size_t numBlocks = (numValues + k_BLOCK_SIZE - 1)
+                                                                / k_BLOCK_SIZE;
+    const bsl::size_t half      = numBlocks / 2 * k_BLOCK_SIZE;
+
+    double upper[NUM_POWERS];
+    sumPowersPairwise<NUM_POWERS>(sums, values, half, origin);
+    sumPowersPairwise<NUM_POWERS>(upper,
+                                  values + half,
+                                  numValues - half,
+                                  origin);
+    for (int k = 0; k < NUM_POWERS; ++k) {
+        sums[k] += upper[k];
+    }
+}
+
+}  // close unnamed namespace
+
+                          // ----------------------------
+                          // struct bdlsta::SummationUtil
+                          // ----------------------------
+
+// CLASS METHODS
+double SummationUtil::sum(const double *values, bsl::size_t numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    return compensatedSum(Values(values), numValues);
+}
+
+double SummationUtil::sumOfProducts(const double *xValues,
+                                    const double *yValues,
+                                    bsl::size_t   numValues)
+{
+    BSLS_ASSERT(xValues || 0 == numValues);
+    BSLS_ASSERT(yValues || 0 == numValues);
+
+    return compensatedSum(Products(xValues, yValues), numValues);
+}
+
+void SummationUtil::sumPowers(double       *sums,
+                              int           numPowers,
+                              const double *values,
+                              bsl::size_t   numValues,
+                              double        origin)
+{
+    BSLS_ASSERT(sums);
+    BSLS_ASSERT(1 <= numPowers && numPowers <= 4);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    switch (numPowers) {
+      case 1: {
+        sumPowersPairwise<1>(sums, values, numValues, origin);
+      } break;
+      case 2: {
+        sumPowersPairwise<2>(sums, values, numValues, origin);
+      } break;
+      case 3: {
+        sumPowersPairwise<3>(sums, values, numValues, origin);
+      } break;
+      default: {
+        sumPowersPairwise<4>(sums, values, numValues, origin);
+      } break;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
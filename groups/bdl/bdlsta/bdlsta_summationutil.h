@@ -0,0 +1,141 @@
+// bdlsta_summationutil.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLSTA_SUMMATIONUTIL
+#define INCLUDED_BDLSTA_SUMMATIONUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide accurate and fast summation kernels over arrays.
+//
+//@CLASSES:
+//  bdlsta::SummationUtil: namespace for array summation kernels
+//
+//@SEE_ALSO: bdlsta_moment, bdlsta_linefit
+//
+//@DESCRIPTION: This component provides a namespace, 'bdlsta::SummationUtil',
+// for functions summing arrays of 'double' values, and the powers of their
+// deviations from a given origin, used to accumulate statistics over arrays
+// of values (see 'bdlsta::Moment::addRange' and 'bdlsta::LineFit::addRange').
+//
+// Adding the values of an array one by one to a single accumulator is both
+// slow (each addition must wait for the previous one to complete) and
+// inaccurate (the rounding error grows with the number of values).  The
+// functions of this component keep several independent accumulators (one per
+// "lane"), so that several additions proceed at once, using SIMD instructions
+// where available (SSE2), and bound the rounding error as follows, where
+// 'eps' is 'DBL_EPSILON', 'n' the number of values, and 'S' the sum of the
+// absolute values of the terms:
+//
+//: 'sum', 'sumOfProducts':
+//:   The terms are summed using compensated summation (the "Sum2" algorithm
+//:   of Ogita, Rump, and Oishi, which improves on Kahan's), so that the error
+//:   of the result is at most about '2 * eps * S', independently of 'n'.
+//:   The compensation comes at little cost: a compensated sum is about as
+//:   fast as a naive one.
+//:
+//: 'sumPowers':
+//:   The terms are summed pairwise, in blocks of 256 terms, so that the error
+//:   of each sum is at most about '(32 + log2(n) / 2) * eps * S'.
+//
+// Within each lane the terms are added in order, so that the results are
+// the same on every platform.
+//
+// Note that compensated summation relies on the strict evaluation of
+// floating-point expressions: the bounds above do not hold if this component
+// is compiled with value-unsafe optimizations (e.g., '-ffast-math').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Computing the Variance of an Array
+///- - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to compute the sample variance of an array of values
+// using the corrected two-pass algorithm.
+//
+// First, we compute the mean of the values:
+//..
+//  const double values[] = { 1e9 + 1.0, 1e9 + 2.0, 1e9 + 4.0, 1e9 + 5.0 };
+//  const int    n        = 4;
+//
+//  const double mean = bdlsta::SummationUtil::sum(values, n) / n;
+//..
+// Then, we compute the sum of the deviations from the mean, which is zero
+// but for the rounding error of 'mean', and the sum of their squares:
+//..
+//  double sums[2];
+//  bdlsta::SummationUtil::sumPowers(sums, 2, values, n, mean);
+//..
+// Finally, we compute the variance, correcting for the rounding error of the
+// mean:
+//..
+//  const double variance = (sums[1] - sums[0] * sums[0] / n) / (n - 1);
+//  assert(10.0 / 3.0 == variance);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlsta {
+
+                            // ====================
+                            // struct SummationUtil
+                            // ====================
+
+struct SummationUtil {
+    // This 'struct' provides a namespace for functions summing arrays of
+    // 'double' values accurately, in a manner allowing vectorization.
+
+    // CLASS METHODS
+    static double sum(const double *values, bsl::size_t numValues);
+        // Return the sum of the specified 'numValues' elements of the
+        // specified 'values' array, using compensated summation.  The
+        // behavior is undefined unless 'values' refers to at least
+        // 'numValues' elements, or '0 == numValues'.
+
+    static double sumOfProducts(const double *xValues,
+                                const double *yValues,
+                                bsl::size_t   numValues);
+        // Return the sum of the products of the corresponding elements of the
+        // specified 'xValues' and 'yValues' arrays, each having the specified
+        // 'numValues' elements, using compensated summation.  The behavior is
+        // undefined unless 'xValues' and 'yValues' each refer to at least
+        // 'numValues' elements, or '0 == numValues'.
+
+    static void sumPowers(double       *sums,
+                          int           numPowers,
+                          const double *values,
+                          bsl::size_t   numValues,
+                          double        origin);
+        // Load into the specified 'sums' array, having the specified
+        // 'numPowers' elements, the sums of the powers, from 1 to
+        // 'numPowers', of the deviations of the specified 'numValues'
+        // elements of the specified 'values' array from the specified
+        // 'origin': 'sums[k]' is the sum of '(values[i] - origin)^(k + 1)',
+        // using pairwise summation.  The behavior is undefined unless
+        // '1 <= numPowers <= 4', and 'values' refers to at least 'numValues'
+        // elements, or '0 == numValues'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,642 @@
+// bdlsta_summationutil.t.cpp                                         -*-C++-*-
+#include <bdlsta_summationutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cmath.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides summation kernels.  The kernels are
+// verified against tabulated sums that are exact, against sums computed
+// naively where that is exact, and against reference sums computed in
+// 'long double' precision, for arrays of every length up to several blocks,
+// so that every combination of full groups of lanes and remaining values is
+// exercised.  The errors are verified to be within the documented bounds.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] double sum(const double *values, bsl::size_t numValues)
+// [ 3] double sumOfProducts(const double *, const double *, bsl::size_t)
+// [ 4] void sumPowers(double *, int, const double *, bsl::size_t, double)
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+// NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                      GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlsta::SummationUtil Util;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void loadRandomValues(bsl::vector<double> *values,
+                      int                  numValues,
+                      unsigned int         seed)
+    // Load into the specified 'values' the specified 'numValues' pseudo-random
+    // values, of both signs and magnitudes spanning several orders, generated
+    // from the specified 'seed'.
+{
+    values->resize(numValues);
+    for (int i = 0; i < numValues; ++i) {
+        seed = seed * 1103515245 + 12345;
+        const double mantissa = static_cast<double>(seed >> 8) / (1 << 24);
+        seed = seed * 1103515245 + 12345;
+        const int    exponent = static_cast<int>(seed >> 16) % 7 - 3;
+
+        (*values)[i] = (mantissa - 0.4) * bsl::pow(10.0, exponent);
+    }
+}
+
+class ReferenceSum {
+    // This class computes a reference sum, using compensated summation in
+    // 'long double' precision, so that its error is negligible compared to
+    // that of the sums under test.
+
+    // DATA
+    long double d_sum;           // sum so far
+    long double d_compensation;  // (negated) low-order bits lost so far
+    long double d_absSum;        // sum of the absolute values of the terms
+
+  public:
+    // CREATORS
+    ReferenceSum()
+    : d_sum(0.0)
+    , d_compensation(0.0)
+    , d_absSum(0.0)
+        // Create a sum of 0.
+    {
+    }
+
+    // MANIPULATORS
+    void add(long double term)
+        // Add the specified 'term' to this sum.
+    {
+        const long double y = term - d_compensation;
+        const long double t = d_sum + y;
+        d_compensation = (t - d_sum) - y;
+        d_sum          = t;
+        d_absSum      += fabs(term);
+    }
+
+    // ACCESSORS
+    double absSum() const
+        // Return the sum of the absolute values of the terms.
+    {
+        return static_cast<double>(d_absSum);
+    }
+
+    long double sum() const
+        // Return the sum of the terms.
+    {
+        return d_sum;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Computing the Variance of an Array
+///- - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to compute the sample variance of an array of values
+// using the corrected two-pass algorithm.
+//
+// First, we compute the mean of the values:
+//..
+    const double values[] = { 1e9 + 1.0, 1e9 + 2.0, 1e9 + 4.0, 1e9 + 5.0 };
+    const int    n        = 4;
+
+    const double mean = bdlsta::SummationUtil::sum(values, n) / n;
+//..
+// Then, we compute the sum of the deviations from the mean, which is zero
+// but for the rounding error of 'mean', and the sum of their squares:
+//..
+    double sums[2];
+    bdlsta::SummationUtil::sumPowers(sums, 2, values, n, mean);
+//..
+// Finally, we compute the variance, correcting for the rounding error of the
+// mean:
+//..
+    const double variance = (sums[1] - sums[0] * sums[0] / n) / (n - 1);
+    ASSERT(10.0 / 3.0 == variance);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'sumPowers'
+        //
+        // Concerns:
+        //: 1 'sums[k]' is the sum of the powers 'k + 1' of the deviations of
+        //:   the values from the origin, for every number of powers.
+        //:
+        //: 2 The error of each sum is within the documented bound, for every
+        //:   length of the array, including lengths spanning several blocks.
+        //:
+        //: 3 The sums of the lower powers do not depend on the number of
+        //:   powers requested.
+        //:
+        //: 4 Only the first 'numPowers' elements of 'sums' are modified.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the sums of a small table of values, whose powers are
+        //:   exact, against their expected values.  (C-1)
+        //:
+        //: 2 For arrays of pseudo-random values of various lengths, compare
+        //:   the sums with reference sums computed in 'long double'
+        //:   precision, for every number of powers, and verify that the sums
+        //:   are the same for every number of powers, and that the elements
+        //:   past the last power are unchanged.  (C-1..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void sumPowers(double *, int, const double *, bsl::size_t, double)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'sumPowers'" << endl
+                          << "===================" << endl;
+
+        if (verbose) cout << "\tSmall table." << endl;
+        {
+            const double VALUES[] = { 3.0, -1.0, 4.0, 1.0, -5.0 };
+
+            double sums[4];
+            Util::sumPowers(sums, 4, VALUES, 5, 1.0);
+
+            // The deviations are '{ 2, -2, 3, 0, -6 }'.
+
+            ASSERTV(sums[0],   -3.0 == sums[0]);
+            ASSERTV(sums[1],   53.0 == sums[1]);
+            ASSERTV(sums[2], -189.0 == sums[2]);
+            ASSERTV(sums[3], 1409.0 == sums[3]);
+
+            Util::sumPowers(sums, 2, VALUES, 0, 1.0);
+            ASSERTV(sums[0],    0.0 == sums[0]);
+            ASSERTV(sums[1],    0.0 == sums[1]);
+            ASSERTV(sums[2], -189.0 == sums[2]);
+        }
+
+        if (verbose) cout << "\tRandom arrays." << endl;
+
+        bsl::vector<double> values;
+
+        for (int numValues = 0; numValues <= 3000;
+                               numValues += numValues < 300 ? 1 : 127) {
+            loadRandomValues(&values, numValues, numValues);
+
+            const double ORIGIN = 0.01;
+
+            ReferenceSum reference[4];
+            for (int i = 0; i < numValues; ++i) {
+                const long double delta = values[i] - ORIGIN;
+                long double       power = delta;
+                for (int k = 0; k < 4; ++k) {
+                    reference[k].add(power);
+                    power *= delta;
+                }
+            }
+
+            // The documented bound, allowing for the rounding of the
+            // deviations and of the powers.
+
+            const double FACTOR = (40.0 + log(numValues + 1.0) / log(2.0)
+                                                                       / 2.0)
+                                                                 * DBL_EPSILON;
+
+            double allSums[4];
+            Util::sumPowers(allSums, 4, values.data(), numValues, ORIGIN);
+
+            for (int numPowers = 1; numPowers <= 4; ++numPowers) {
+                double sums[5] = { -1.0, -1.0, -1.0, -1.0, -1.0 };
+                Util::sumPowers(sums,
+                                numPowers,
+                                values.data(),
+                                numValues,
+                                ORIGIN);
+
+                for (int k = 0; k < numPowers; ++k) {
+                    const double ERROR = static_cast<double>(
+                                          fabs(sums[k] - reference[k].sum()));
+                    const double BOUND = FACTOR * reference[k].absSum();
+
+                    if (veryVerbose && 4 == numPowers) {
+                        P_(numValues) P_(k) P_(ERROR) P(BOUND)
+                    }
+
+                    ASSERTV(numValues, numPowers, k, ERROR, BOUND,
+                            ERROR <= BOUND);
+                    ASSERTV(numValues, numPowers, k, sums[k], allSums[k],
+                            allSums[k] == sums[k]);
+                }
+                for (int k = numPowers; k < 5; ++k) {
+                    ASSERTV(numValues, numPowers, k, -1.0 == sums[k]);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const double VALUES[] = { 1.0, 2.0 };
+            double       sums[4];
+
+            ASSERT_PASS(Util::sumPowers(sums, 1, VALUES, 2, 0.0));
+            ASSERT_PASS(Util::sumPowers(sums, 4, VALUES, 2, 0.0));
+            ASSERT_FAIL(Util::sumPowers(sums, 0, VALUES, 2, 0.0));
+            ASSERT_FAIL(Util::sumPowers(sums, 5, VALUES, 2, 0.0));
+            ASSERT_FAIL(Util::sumPowers(   0, 2, VALUES, 2, 0.0));
+            ASSERT_PASS(Util::sumPowers(sums, 2,      0, 0, 0.0));
+            ASSERT_FAIL(Util::sumPowers(sums, 2,      0, 1, 0.0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'sumOfProducts'
+        //
+        // Concerns:
+        //: 1 'sumOfProducts' returns the sum of the products of the
+        //:   corresponding elements of the arrays.
+        //:
+        //: 2 The error is within the documented bound, independently of the
+        //:   length of the arrays.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the sums of the products of arrays of small integers, for
+        //:   every length up to several groups of lanes.  (C-1)
+        //:
+        //: 2 For arrays of pseudo-random values of various lengths, compare
+        //:   the sums with reference sums computed in 'long double'
+        //:   precision.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   double sumOfProducts(const double *, const double *, bsl::size_t)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'sumOfProducts'" << endl
+                          << "=======================" << endl;
+
+        if (verbose) cout << "\tSmall integers." << endl;
+        {
+            double xValues[20];
+            double yValues[20];
+            double expected = 0.0;
+
+            ASSERT(0.0 == Util::sumOfProducts(xValues, yValues, 0));
+
+            for (int i = 0; i < 20; ++i) {
+                xValues[i] = i + 1;
+                yValues[i] = i % 3 - 1;
+                expected  += xValues[i] * yValues[i];
+
+                const double SUM = Util::sumOfProducts(xValues,
+                                                       yValues,
+                                                       i + 1);
+                ASSERTV(i, SUM, expected, expected == SUM);
+            }
+        }
+
+        if (verbose) cout << "\tRandom arrays." << endl;
+        {
+            bsl::vector<double> xValues;
+            bsl::vector<double> yValues;
+
+            for (int numValues = 1; numValues <= 100000; numValues *= 3) {
+                loadRandomValues(&xValues, numValues, numValues);
+                loadRandomValues(&yValues, numValues, numValues + 1);
+
+                ReferenceSum reference;
+                for (int i = 0; i < numValues; ++i) {
+                    reference.add(static_cast<long double>(xValues[i])
+                                                                 * yValues[i]);
+                }
+
+                // The bound allows for the rounding of the products.
+
+                const double SUM   = Util::sumOfProducts(xValues.data(),
+                                                         yValues.data(),
+                                                         numValues);
+                const double ERROR = static_cast<double>(
+                                                 fabs(SUM - reference.sum()));
+                const double BOUND = 3.0 * DBL_EPSILON * reference.absSum();
+
+                if (veryVerbose) {
+                    P_(numValues) P_(ERROR) P(BOUND)
+                }
+
+                ASSERTV(numValues, ERROR, BOUND, ERROR <= BOUND);
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const double VALUES[] = { 1.0, 2.0 };
+
+            ASSERT_PASS(Util::sumOfProducts(VALUES, VALUES, 2));
+            ASSERT_PASS(Util::sumOfProducts(     0,      0, 0));
+            ASSERT_FAIL(Util::sumOfProducts(     0, VALUES, 1));
+            ASSERT_FAIL(Util::sumOfProducts(VALUES,      0, 1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'sum'
+        //
+        // Concerns:
+        //: 1 'sum' returns the sum of the elements of the array, for every
+        //:   length of the array.
+        //:
+        //: 2 The error is within the documented bound, independently of the
+        //:   length of the array.
+        //:
+        //: 3 The low-order bits lost by naive summation are recovered.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the sums of arrays of small integers, for every length up
+        //:   to several groups of lanes.  (C-1)
+        //:
+        //: 2 For arrays of pseudo-random values of various lengths, compare
+        //:   the sums with reference sums computed in 'long double'
+        //:   precision.  (C-2)
+        //:
+        //: 3 Verify that the sum of 10000 copies of 0.1, which naive
+        //:   summation gets wrong in the 10th digit, is 1000, and that adding
+        //:   many values too small to change a large value one at a time
+        //:   changes the sum.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   double sum(const double *values, bsl::size_t numValues)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'sum'" << endl
+                          << "=============" << endl;
+
+        if (verbose) cout << "\tSmall integers." << endl;
+        {
+            double values[20];
+            double expected = 0.0;
+
+            ASSERT(0.0 == Util::sum(values, 0));
+
+            for (int i = 0; i < 20; ++i) {
+                values[i] = (i % 2 ? -1 : 1) * i * i;
+                expected += values[i];
+
+                const double SUM = Util::sum(values, i + 1);
+                ASSERTV(i, SUM, expected, expected == SUM);
+            }
+        }
+
+        if (verbose) cout << "\tRandom arrays." << endl;
+        {
+            bsl::vector<double> values;
+
+            for (int numValues = 1; numValues <= 1000000; numValues *= 3) {
+                loadRandomValues(&values, numValues, numValues);
+
+                ReferenceSum reference;
+                for (int i = 0; i < numValues; ++i) {
+                    reference.add(values[i]);
+                }
+
+                const double SUM   = Util::sum(values.data(), numValues);
+                const double ERROR = static_cast<double>(
+                                                 fabs(SUM - reference.sum()));
+                const double BOUND = 2.0 * DBL_EPSILON * reference.absSum();
+
+                if (veryVerbose) {
+                    P_(numValues) P_(ERROR) P(BOUND)
+                }
+
+                ASSERTV(numValues, ERROR, BOUND, ERROR <= BOUND);
+            }
+        }
+
+        if (verbose) cout << "\tCompensation." << endl;
+        {
+            bsl::vector<double> values(10000, 0.1);
+
+            double naive = 0.0;
+            for (bsl::size_t i = 0; i < values.size(); ++i) {
+                naive += values[i];
+            }
+            ASSERTV(naive, 1000.0 != naive);
+
+            const double SUM = Util::sum(values.data(), values.size());
+            ASSERTV(SUM, 1000.0 == SUM);
+
+            // Each lane starts with 1, and then adds 1000 values of
+            // 'DBL_EPSILON / 4', each of which is lost by a naive addition.
+
+            values.assign(4004, DBL_EPSILON / 4.0);
+            values[0] = values[1] = values[2] = values[3] = 1.0;
+
+            const double SMALL = Util::sum(values.data(), values.size());
+            ASSERTV(SMALL, 4.0 + 1000.0 * DBL_EPSILON == SMALL);
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const double VALUES[] = { 1.0, 2.0 };
+
+            ASSERT_PASS(Util::sum(VALUES, 2));
+            ASSERT_PASS(Util::sum(     0, 0));
+            ASSERT_FAIL(Util::sum(     0, 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Sum a few arrays, and verify the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const double X[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0 };
+        const double Y[] = { 2.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 };
+
+        ASSERT(28.0 == Util::sum(X, 7));
+        ASSERT(12.0 == Util::sumOfProducts(X, Y, 7));
+
+        double sums[2];
+        Util::sumPowers(sums, 2, X, 7, 4.0);
+        ASSERT( 0.0 == sums[0]);
+        ASSERT(28.0 == sums[1]);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,343 @@
+// bdlsta_tdigest.cpp                                                 -*-C++-*-
+#include <bdlsta_tdigest.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlsta {
+//@IMPLEMENTATION NOTES:
+//
+// The scale function is 'k1' of Dunning and Ertl, mapping a quantile 'q' to
+// an index 'k':
+//..
+//  k(q) = d / (2 * pi) * asin(2 * q - 1)
+//..
+// where 'd' is the compression.  A centroid spanning the quantiles '[q0, q1]'
+// is allowed if 'k(q1) - k(q0) <= 1', so that the centroids are small where
+// the slope of 'k' is large, near 'q' of 0 and 1.  To merge, all centroids
+// (including the buffered values, each a centroid) are sorted by mean and
+// swept once: each centroid is absorbed by the current one while the weight
+// so far stays within 'W * kInverse(k(q0) + 1)', 'q0' being the quantile at
+// which the current centroid starts and 'W' the total weight.  The sweep
+// retains at most about 'd' centroids, and '2 * d' in the worst case.
+//
+// The estimates interpolate linearly between the points '(0, min)',
+// '(w(i), mean(i))', and '(W, max)', where 'w(i)' is the weight of the
+// centroids before centroid 'i' plus half the weight of centroid 'i'.  For
+// values added one at a time, with no merging of centroids, this makes
+// 'quantile' the usual interpolated sample quantile.
+
+namespace {
+
+const double k_PI            = 3.14159265358979323846;
+const int    k_BUFFER_FACTOR = 5;  // buffer capacity, in units of the
+                                   // compression
+
+bool lessMean(const TDigest::Centroid& lhs, const TDigest::Centroid& rhs)
+    // Return 'true' if the mean of the specified 'lhs' centroid is less than
+    // that of the specified 'rhs' centroid, and 'false' otherwise.
+{
+    return lhs.d_mean < rhs.d_mean;
+}
+
+double quantileLimit(double q, double compression)
+    // Return the largest quantile at which a centroid starting at the
+    // specified quantile 'q' may end, for the specified 'compression'.
+{
+    const double scale = compression / (2.0 * k_PI);
+    const double k     = scale * bsl::asin(2.0 * q - 1.0) + 1.0;
+
+    if (k >= compression / 4.0) {
+        return 1.0;                                                   // RETURN
+    }
+    return (bsl::sin(k / scale) + 1.0) / 2.0;
+}
+
+}  // close unnamed namespace
+
+                            // ---------------------
+                            // class bdlsta::TDigest
+                            // ---------------------
+
+// CLASS DATA
+const double TDigest::k_DEFAULT_COMPRESSION = 100.0;
+
+// PRIVATE CLASS METHODS
+void TDigest::compress(bsl::vector<Centroid> *result,
+                       bsl::vector<Centroid> *input,
+                       double                 compression)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(input);
+    BSLS_ASSERT(result != input);
+
+    result->clear();
+    if (input->empty()) {
+        return;                                                       // RETURN
+    }
+
+    bsl::sort(input->begin(), input->end(), &lessMean);
+
+    double totalWeight = 0.0;
+    for (bsl::size_t i = 0; i < input->size(); ++i) {
+        totalWeight += (*input)[i].d_weight;
+    }
+
+    Centroid current     = (*input)[0];
+    double   weightSoFar = 0.0;
+    double   weightLimit = totalWeight * quantileLimit(0.0, compression);
+
+    for (bsl::size_t i = 1; i < input->size(); ++i) {
+        const Centroid& next = (*input)[i];
+
+        if (weightSoFar + current.d_weight + next.d_weight <= weightLimit) {
+            current.d_weight += next.d_weight;
+            current.d_mean   += (next.d_mean - current.d_mean)
+                              * next.d_weight / current.d_weight;
+        }
+        else {
+            weightSoFar += current.d_weight;
+            result->push_back(current);
+            current     = next;
+            weightLimit = totalWeight * quantileLimit(weightSoFar
+                                                                / totalWeight,
+                                                      compression);
+        }
+    }
+    result->push_back(current);
+}
+
+// PRIVATE ACCESSORS
+const bsl::vector<TDigest::Centroid>& TDigest::mergedCentroids(
+                                          bsl::vector<Centroid> *scratch) const
+{
+    if (d_buffer.empty()) {
+        return d_centroids;                                           // RETURN
+    }
+
+    bsl::vector<Centroid> input(d_buffer, scratch->get_allocator());
+    input.insert(input.end(), d_centroids.begin(), d_centroids.end());
+    compress(scratch, &input, d_compression);
+    return *scratch;
+}
+
+// CREATORS
+TDigest::TDigest(bslma::Allocator *basicAllocator)
+: d_centroids(basicAllocator)
+, d_buffer(basicAllocator)
+, d_compression(k_DEFAULT_COMPRESSION)
+, d_totalWeight(0.0)
+, d_min(0.0)
+, d_max(0.0)
+{
+    d_buffer.reserve(static_cast<bsl::size_t>(k_BUFFER_FACTOR
+                                                            * d_compression));
+}
+
+TDigest::TDigest(double compression, bslma::Allocator *basicAllocator)
+: d_centroids(basicAllocator)
+, d_buffer(basicAllocator)
+, d_compression(compression)
+, d_totalWeight(0.0)
+, d_min(0.0)
+, d_max(0.0)
+{
+    BSLS_ASSERT(10.0 <= compression);
+
+    d_buffer.reserve(static_cast<bsl::size_t>(k_BUFFER_FACTOR
+                                                            * d_compression));
+}
+
+TDigest::TDigest(const TDigest& original, bslma::Allocator *basicAllocator)
+: d_centroids(original.d_centroids, basicAllocator)
+, d_buffer(original.d_buffer, basicAllocator)
+, d_compression(original.d_compression)
+, d_totalWeight(original.d_totalWeight)
+, d_min(original.d_min)
+, d_max(original.d_max)
+{
+    d_buffer.reserve(static_cast<bsl::size_t>(k_BUFFER_FACTOR
+                                                            * d_compression));
+}
+
+// MANIPULATORS
+void TDigest::add(double value, double weight)
+{
+    BSLS_ASSERT(0.0 < weight);
+    BSLS_ASSERT(value == value);  // not a NaN
+
+    if (isEmpty()) {
+        d_min = value;
+        d_max = value;
+    }
+    else if (value < d_min) {
+        d_min = value;
+    }
+    else if (value > d_max) {
+        d_max = value;
+    }
+    d_totalWeight += weight;
+
+    Centroid centroid = { value, weight };
+    d_buffer.push_back(centroid);
+
+    if (d_buffer.size() >= static_cast<bsl::size_t>(k_BUFFER_FACTOR
+                                                            * d_compression)) {
+        flush();
+    }
+}
+
+void TDigest::flush()
+{
+    if (d_buffer.empty()) {
+        return;                                                       // RETURN
+    }
+
+    d_buffer.insert(d_buffer.end(), d_centroids.begin(), d_centroids.end());
+    compress(&d_centroids, &d_buffer, d_compression);
+    d_buffer.clear();
+}
+
+void TDigest::merge(const TDigest& other)
+{
+    if (other.isEmpty()) {
+        return;                                                       // RETURN
+    }
+
+    if (this == &other) {
+        const TDigest copy(other);
+        merge(copy);
+        return;                                                       // RETURN
+    }
+
+    if (isEmpty()) {
+        d_min = other.d_min;
+        d_max = other.d_max;
+    }
+    else {
+        d_min = bsl::min(d_min, other.d_min);
+        d_max = bsl::max(d_max, other.d_max);
+    }
+    d_totalWeight += other.d_totalWeight;
+
+    d_buffer.insert(d_buffer.end(),
+                    other.d_centroids.begin(),
+                    other.d_centroids.end());
+    d_buffer.insert(d_buffer.end(),
+                    other.d_buffer.begin(),
+                    other.d_buffer.end());
+    flush();
+}
+
+void TDigest::reset()
+{
+    d_centroids.clear();
+    d_buffer.clear();
+    d_totalWeight = 0.0;
+    d_min         = 0.0;
+    d_max         = 0.0;
+}
+
+// ACCESSORS
+double TDigest::cdf(double value) const
+{
+    BSLS_ASSERT(!isEmpty());
+
+    if (value < d_min) {
+        return 0.0;                                                   // RETURN
+    }
+    if (value >= d_max) {
+        return 1.0;                                                   // RETURN
+    }
+
+    bsl::vector<Centroid>        scratch(allocator());
+    const bsl::vector<Centroid>& centroids = mergedCentroids(&scratch);
+
+    // Find the segment of the interpolation (see the implementation notes)
+    // containing 'value'.
+
+    double prevValue  = d_min;
+    double prevWeight = 0.0;
+    double weightSoFar = 0.0;
+
+    for (bsl::size_t i = 0; i < centroids.size(); ++i) {
+        const double position = weightSoFar + centroids[i].d_weight / 2.0;
+
+        if (value < centroids[i].d_mean) {
+            return (prevWeight + (position - prevWeight)
+                                 * (value - prevValue)
+                                 / (centroids[i].d_mean - prevValue))
+                 / d_totalWeight;                                     // RETURN
+        }
+
+        prevValue    = centroids[i].d_mean;
+        prevWeight   = position;
+        weightSoFar += centroids[i].d_weight;
+    }
+
+    return (prevWeight + (d_totalWeight - prevWeight)
+                         * (value - prevValue) / (d_max - prevValue))
+         / d_totalWeight;
+}
+
+double TDigest::quantile(double q) const
+{
+    BSLS_ASSERT(0.0 <= q && q <= 1.0);
+    BSLS_ASSERT(!isEmpty());
+
+    bsl::vector<Centroid>        scratch(allocator());
+    const bsl::vector<Centroid>& centroids = mergedCentroids(&scratch);
+
+    // Find the segment of the interpolation (see the implementation notes)
+    // containing the rank 'q * totalWeight()'.
+
+    const double rank = q * d_totalWeight;
+
+    double prevValue   = d_min;
+    double prevWeight  = 0.0;
+    double weightSoFar = 0.0;
+
+    for (bsl::size_t i = 0; i < centroids.size(); ++i) {
+        const double position = weightSoFar + centroids[i].d_weight / 2.0;
+
+        if (rank < position) {
+            return prevValue + (centroids[i].d_mean - prevValue)
+                               * (rank - prevWeight)
+                               / (position - prevWeight);             // RETURN
+        }
+
+        prevValue    = centroids[i].d_mean;
+        prevWeight   = position;
+        weightSoFar += centroids[i].d_weight;
+    }
+
+    if (d_totalWeight <= prevWeight) {
+        return d_max;                                                 // RETURN
+    }
+    return prevValue + (d_max - prevValue) * (rank - prevWeight)
+                                           / (d_totalWeight - prevWeight);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,373 @@
+// bdlsta_tdigest.h                                                   -*-C++-*-
+#ifndef INCLUDED_BDLSTA_TDIGEST
+#define INCLUDED_BDLSTA_TDIGEST
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mergeable sketch for streaming quantiles (t-digest).
+//
+//@CLASSES:
+//  bdlsta::TDigest: t-digest approximating the distribution of a stream
+//
+//@SEE_ALSO: bdlsta_moment
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlsta::TDigest', that
+// approximates the distribution of a stream of values in bounded memory, so
+// that quantiles (e.g., the median, or the 99th percentile) and the
+// cumulative distribution can be estimated online.  The algorithm is the
+// "merging" t-digest of Dunning and Ertl ("Computing Extremely Accurate
+// Quantiles Using t-Digests", 2019): the values are summarized by *centroids*
+// (a mean and a weight), and the number of values a centroid may summarize is
+// bounded by a scale function that keeps the centroids near the extremes of
+// the distribution small.  The estimates are therefore most accurate in the
+// tails, which are usually of most interest (e.g., for a value at risk).
+//
+// The size of the sketch, and its accuracy, are controlled by the
+// *compression* supplied at construction (100 by default): a digest retains
+// at most about 'compression' centroids, and the rank error of an estimated
+// quantile 'q' (the difference between 'q' and the fraction of the values
+// below the estimate) is bounded by about
+// 'pi * sqrt(q * (1 - q)) / compression', half the largest span of a
+// centroid at 'q'.  In practice the error is much smaller: for the default
+// compression, it is typically below 0.05% at the median, and below 0.01% at
+// the 99.99th percentile.  Note that the values themselves are not retained.
+//
+// Values are added to a buffer, which is merged into the centroids when it is
+// full (the buffer holds '5 * compression' values), so that adding a value
+// takes amortized constant time.  The accessors take the buffered values into
+// account, but are faster once the buffer has been merged by 'flush'.
+//
+///Merging
+///-------
+// Two digests can be merged, so that a stream can be summarized by several
+// digests (e.g., one per thread), which are then combined into a single one
+// (see {Example 2}).  Merging digests loses a little accuracy compared to
+// summarizing the stream with a single digest.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Estimating Percentiles of a Stream
+///- - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to estimate the median and the 99th percentile of a
+// stream of latencies.
+//
+// First, we create a digest having the default compression:
+//..
+//  bdlsta::TDigest latencies;
+//..
+// Then, we add the latencies, here the values from 1 to 10000 (in a shuffled
+// order):
+//..
+//  for (int i = 0; i < 10000; ++i) {
+//      latencies.add((i * 7919) % 10000 + 1);
+//  }
+//..
+// Finally, we estimate the quantiles, and verify that the estimates are close
+// to the exact values:
+//..
+//  assert(10000 == latencies.totalWeight());
+//  assert(    1 == latencies.min());
+//  assert(10000 == latencies.max());
+//  assert(fabs(latencies.quantile(0.50) - 5000.5) < 20.0);
+//  assert(fabs(latencies.quantile(0.99) - 9900.5) <  5.0);
+//..
+//
+///Example 2: Reducing Digests Computed in Parallel
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how digests of parts of a data set, for example computed
+// by several threads, are reduced to a digest of the whole data set.
+//
+// First, we summarize each of 4 parts of a data set in its own digest:
+//..
+//  bdlsta::TDigest parts[4];
+//  for (int i = 0; i < 100000; ++i) {
+//      parts[i % 4].add(i);
+//  }
+//..
+// Then, we merge the parts into a single digest:
+//..
+//  bdlsta::TDigest whole;
+//  for (int i = 0; i < 4; ++i) {
+//      whole.merge(parts[i]);
+//  }
+//..
+// Finally, we verify that the digest summarizes the whole data set:
+//..
+//  assert(100000 == whole.totalWeight());
+//  assert(fabs(whole.quantile(0.5) - 50000.0) < 100.0);
+//  assert(fabs(whole.cdf(25000.0)  - 0.25)    < 0.001);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlsta {
+
+                               // =============
+                               // class TDigest
+                               // =============
+
+class TDigest {
+    // This class provides a t-digest approximating the distribution of the
+    // values added to it, from which quantiles and the cumulative
+    // distribution can be estimated.  Digests can be merged.
+
+  public:
+    // PUBLIC TYPES
+    struct Centroid {
+        // This 'struct' summarizes a set of values by their mean and their
+        // total weight.
+
+        double d_mean;    // mean of the values
+        double d_weight;  // total weight of the values
+    };
+
+  private:
+    // DATA
+    bsl::vector<Centroid> d_centroids;    // merged centroids, sorted by mean
+    bsl::vector<Centroid> d_buffer;       // values not yet merged
+    double                d_compression;  // compression parameter
+    double                d_totalWeight;  // weight of all values, including
+                                          // those in 'd_buffer'
+    double                d_min;          // smallest value
+    double                d_max;          // largest value
+
+    // PRIVATE CLASS METHODS
+    static void compress(bsl::vector<Centroid> *result,
+                         bsl::vector<Centroid> *input,
+                         double                 compression);
+        // Load into the specified 'result' the centroids obtained by sorting
+        // the specified 'input' centroids and merging adjacent ones as
+        // allowed by the scale function for the specified 'compression'.
+        // 'input' is left in an unspecified state.
+
+    // PRIVATE ACCESSORS
+    const bsl::vector<Centroid>& mergedCentroids(
+                                         bsl::vector<Centroid> *scratch) const;
+        // Return a reference to the centroids of this digest, including the
+        // buffered values.  If values are buffered, the centroids are
+        // calculated into the specified 'scratch' vector.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TDigest, bslma::UsesBslmaAllocator);
+
+    // CONSTANTS
+    enum {
+        e_SUCCESS         = 0,
+        e_INADEQUATE_DATA = -1
+    };
+
+    static const double k_DEFAULT_COMPRESSION;
+        // compression used by the constructors not taking one
+
+    // CREATORS
+    explicit TDigest(bslma::Allocator *basicAllocator = 0);
+        // Create an empty digest having the default compression
+        // ('k_DEFAULT_COMPRESSION').  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    explicit TDigest(double            compression,
+                     bslma::Allocator *basicAllocator = 0);
+        // Create an empty digest having the specified 'compression'.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '10 <= compression'.
+
+    TDigest(const TDigest& original, bslma::Allocator *basicAllocator = 0);
+        // Create a digest having the same compression and summarizing the same
+        // values as the specified 'original' digest.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~TDigest() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! TDigest& operator=(const TDigest& rhs) = default;
+        // Assign to this object the compression and the summary of the
+        // specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    void add(double value);
+        // Add the specified 'value' to the values summarized by this digest.
+        // The behavior is undefined if 'value' is a NaN.
+
+    void add(double value, double weight);
+        // Add the specified 'value', having the specified 'weight', to the
+        // values summarized by this digest.  The behavior is undefined unless
+        // '0 < weight', and 'value' is not a NaN.
+
+    void flush();
+        // Merge the buffered values into the centroids of this digest.  Note
+        // that this method does not change the estimates of this digest, but
+        // makes the accessors faster until the next value is added.
+
+    void merge(const TDigest& other);
+        // Add the values summarized by the specified 'other' digest to the
+        // values summarized by this digest.  The compression of this digest
+        // is unchanged.
+
+    void reset();
+        // Remove all values from this digest.
+
+    // ACCESSORS
+    double cdf(double value) const;
+        // Return an estimate of the fraction of the values summarized by this
+        // digest (by weight) that are less than or equal to the specified
+        // 'value'.  The behavior is undefined if 'isEmpty()'.
+
+    double compression() const;
+        // Return the compression of this digest.
+
+    bool isEmpty() const;
+        // Return 'true' if no values have been added to this digest, and
+        // 'false' otherwise.
+
+    double max() const;
+        // Return the largest value added to this digest.  The behavior is
+        // undefined if 'isEmpty()'.
+
+    double min() const;
+        // Return the smallest value added to this digest.  The behavior is
+        // undefined if 'isEmpty()'.
+
+    int numCentroids() const;
+        // Return the number of centroids of this digest, excluding the
+        // buffered values.
+
+    double quantile(double q) const;
+        // Return an estimate of the specified 'q' quantile of the values
+        // summarized by this digest (e.g., the median for 'q' of 0.5), that
+        // is, the value below which the fraction 'q' of the values (by
+        // weight) lie.  The estimate is 'min()' for 'q' of 0, and 'max()'
+        // for 'q' of 1.  The behavior is undefined unless '0 <= q <= 1' and
+        // '!isEmpty()'.
+
+    int quantileIfValid(double *result, double q) const;
+        // Load into the specified 'result' an estimate of the specified 'q'
+        // quantile of the values summarized by this digest.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically,
+        // 'e_INADEQUATE_DATA' is returned if 'isEmpty()'.  The behavior is
+        // undefined unless '0 <= q <= 1'.
+
+    double totalWeight() const;
+        // Return the total weight of the values added to this digest (that
+        // is, the number of values, if all have a weight of 1).
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                               INLINE DEFINITIONS
+// ============================================================================
+
+                            // ---------------------
+                            // class bdlsta::TDigest
+                            // ---------------------
+
+// MANIPULATORS
+inline
+void TDigest::add(double value)
+{
+    add(value, 1.0);
+}
+
+// ACCESSORS
+inline
+double TDigest::compression() const
+{
+    return d_compression;
+}
+
+inline
+bool TDigest::isEmpty() const
+{
+    return 0.0 == d_totalWeight;
+}
+
+inline
+double TDigest::max() const
+{
+    BSLS_ASSERT(!isEmpty());
+
+    return d_max;
+}
+
+inline
+double TDigest::min() const
+{
+    BSLS_ASSERT(!isEmpty());
+
+    return d_min;
+}
+
+inline
+int TDigest::numCentroids() const
+{
+    return static_cast<int>(d_centroids.size());
+}
+
+inline
+int TDigest::quantileIfValid(double *result, double q) const
+{
+    BSLS_ASSERT(0.0 <= q && q <= 1.0);
+
+    if (isEmpty()) {
+        return e_INADEQUATE_DATA;                                     // RETURN
+    }
+    *result = quantile(q);
+    return 0;
+}
+
+inline
+double TDigest::totalWeight() const
+{
+    return d_totalWeight;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *TDigest::allocator() const
+{
+    return d_centroids.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,883 @@
+// bdlsta_tdigest.t.cpp                                               -*-C++-*-
+#include <bdlsta_tdigest.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a mechanism summarizing a stream of values by a
+// t-digest.  For small data sets, which the digest holds exactly, the
+// estimates are verified against the interpolated sample quantiles.  For large
+// data sets, the estimates are verified to be within the documented rank
+// error, both for a single digest and for digests merged from parts of the
+// data set.  Negative tests are conducted for the preconditions.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] TDigest(Allocator *ba = 0)
+// [ 4] TDigest(double compression, Allocator *ba = 0)
+// [ 6] TDigest(const TDigest& original, Allocator *ba = 0)
+//
+// MANIPULATORS
+// [ 2] void add(double value)
+// [ 3] void add(double value, double weight)
+// [ 3] void flush()
+// [ 5] void merge(const TDigest& other)
+// [ 6] void reset()
+//
+// ACCESSORS
+// [ 2] double cdf(double value) const
+// [ 4] double compression() const
+// [ 2] bool isEmpty() const
+// [ 2] double max() const
+// [ 2] double min() const
+// [ 4] int numCentroids() const
+// [ 2] double quantile(double q) const
+// [ 6] int quantileIfValid(double *result, double q) const
+// [ 2] double totalWeight() const
+// [ 6] bslma::Allocator *allocator() const
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] ACCURACY
+// [ 7] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+// NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                      GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlsta::TDigest Obj;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+double nextRandom(unsigned int *state)
+    // Return the next pseudo-random value in '[0, 1)' of the sequence having
+    // the specified 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return static_cast<double>((*state >> 8) & 0xFFFFFF) / 16777216.0;
+}
+
+double exactRank(const bsl::vector<double>& sorted, double value)
+    // Return the fraction of the values of the specified 'sorted' vector that
+    // are less than the specified 'value', plus half the fraction of those
+    // equal to it.
+{
+    const bsl::size_t below = bsl::lower_bound(sorted.begin(),
+                                               sorted.end(),
+                                               value) - sorted.begin();
+    const bsl::size_t upTo  = bsl::upper_bound(sorted.begin(),
+                                               sorted.end(),
+                                               value) - sorted.begin();
+    return (static_cast<double>(below) + static_cast<double>(upTo)) / 2.0
+         / static_cast<double>(sorted.size());
+}
+
+double rankTolerance(double q, double compression)
+    // Return the rank error tolerated for an estimate of the specified 'q'
+    // quantile by a digest having the specified 'compression'.
+{
+    const double k_PI = 3.14159265358979323846;
+
+    return k_PI * bsl::sqrt(q * (1.0 - q)) / compression + 2e-5;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int         test = argc > 1 ? atoi(argv[1]) : 0;
+    bool     verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Estimating Percentiles of a Stream
+///- - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how to estimate the median and the 99th percentile of a
+// stream of latencies.
+//
+// First, we create a digest having the default compression:
+//..
+    bdlsta::TDigest latencies;
+//..
+// Then, we add the latencies, here the values from 1 to 10000 (in a shuffled
+// order):
+//..
+    for (int i = 0; i < 10000; ++i) {
+        latencies.add((i * 7919) % 10000 + 1);
+    }
+//..
+// Finally, we estimate the quantiles, and verify that the estimates are close
+// to the exact values:
+//..
+    ASSERT(10000 == latencies.totalWeight());
+    ASSERT(    1 == latencies.min());
+    ASSERT(10000 == latencies.max());
+    ASSERT(fabs(latencies.quantile(0.50) - 5000.5) < 20.0);
+    ASSERT(fabs(latencies.quantile(0.99) - 9900.5) <  5.0);
+//..
+//
+///Example 2: Reducing Digests Computed in Parallel
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// This example shows how digests of parts of a data set, for example computed
+// by several threads, are reduced to a digest of the whole data set.
+//
+// First, we summarize each of 4 parts of a data set in its own digest:
+//..
+    bdlsta::TDigest parts[4];
+    for (int i = 0; i < 100000; ++i) {
+        parts[i % 4].add(i);
+    }
+//..
+// Then, we merge the parts into a single digest:
+//..
+    bdlsta::TDigest whole;
+    for (int i = 0; i < 4; ++i) {
+        whole.merge(parts[i]);
+    }
+//..
+// Finally, we verify that the digest summarizes the whole data set:
+//..
+    ASSERT(100000 == whole.totalWeight());
+    ASSERT(fabs(whole.quantile(0.5) - 50000.0) < 100.0);
+    ASSERT(fabs(whole.cdf(25000.0)  - 0.25)    < 0.001);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, RESET, ALLOCATOR, AND EDGE CASES
+        //
+        // Concerns:
+        //: 1 The copy constructor copies the compression and the summary, and
+        //:   uses the supplied allocator (or the default allocator if none is
+        //:   supplied).
+        //:
+        //: 2 Memory is allocated only from the object allocator (the
+        //:   accessors use it for temporary memory).
+        //:
+        //: 3 'reset' empties the digest, which is usable afterwards.
+        //:
+        //: 4 'quantileIfValid' fails for an empty digest.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create digests with test allocators, add values, copy them, and
+        //:   verify the estimates of the copies and the allocators used.
+        //:   (C-1, 2)
+        //:
+        //: 2 Reset a digest and verify that it behaves as a new one.  (C-3)
+        //:
+        //: 3 Verify 'quantileIfValid' on empty and non-empty digests.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   TDigest(const TDigest& original, Allocator *ba = 0)
+        //   void reset()
+        //   int quantileIfValid(double *result, double q) const
+        //   bslma::Allocator *allocator() const
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, RESET, ALLOCATOR, AND EDGE CASES" << endl
+                          << "======================================" << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::TestAllocator         oa("object",  veryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tCopy and allocator." << endl;
+        {
+            Obj mX(50.0, &oa);  const Obj& X = mX;
+            ASSERT(&oa == X.allocator());
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.add(i);
+            }
+            ASSERT(0 < oa.numBlocksInUse());
+
+            Obj mY(X, &sa);  const Obj& Y = mY;
+            ASSERT(&sa         == Y.allocator());
+            ASSERT(0           <  sa.numBlocksInUse());
+            ASSERT(50.0        == Y.compression());
+            ASSERT(X.totalWeight() == Y.totalWeight());
+            ASSERT(X.quantile(0.3) == Y.quantile(0.3));
+            ASSERT(X.cdf(123.0)    == Y.cdf(123.0));
+
+            Obj mZ(X);  const Obj& Z = mZ;
+            ASSERT(&da == Z.allocator());
+            ASSERT(X.quantile(0.7) == Z.quantile(0.7));
+
+            mX.add(5000.0);
+            mY.add(5000.0);
+            ASSERT(X.quantile(0.99) == Y.quantile(0.99));
+            ASSERT(5000.0           == Y.max());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tReset and 'quantileIfValid'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            double result = -1.0;
+            ASSERT(Obj::e_INADEQUATE_DATA == X.quantileIfValid(&result, 0.5));
+            ASSERT(-1.0 == result);
+
+            mX.add(3.0);
+            ASSERT(0   == X.quantileIfValid(&result, 0.5));
+            ASSERT(3.0 == result);
+
+            mX.reset();
+            ASSERT(X.isEmpty());
+            ASSERT(0   == X.totalWeight());
+            ASSERT(0   == X.numCentroids());
+            ASSERT(Obj::e_INADEQUATE_DATA == X.quantileIfValid(&result, 0.5));
+
+            mX.add(-2.0);
+            mX.add(-4.0);
+            ASSERT(-4.0 == X.min());
+            ASSERT(-2.0 == X.max());
+            ASSERT(-3.0 == X.quantile(0.5));
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(10.0));
+            ASSERT_FAIL(Obj(9.0));
+
+            Obj mX;  const Obj& X = mX;
+            double result;
+            ASSERT_SAFE_FAIL(X.min());
+            ASSERT_SAFE_FAIL(X.max());
+            ASSERT_SAFE_FAIL(X.quantile(0.5));
+            ASSERT_SAFE_FAIL(X.cdf(0.0));
+
+            ASSERT_FAIL(mX.add(1.0, 0.0));
+            ASSERT_FAIL(mX.add(1.0, -1.0));
+            ASSERT_FAIL(mX.add(bsl::sqrt(-1.0)));
+            ASSERT_PASS(mX.add(1.0, 0.5));
+
+            ASSERT_SAFE_PASS(X.min());
+            ASSERT_SAFE_PASS(X.quantile(0.0));
+            ASSERT_SAFE_PASS(X.quantile(1.0));
+            ASSERT_SAFE_FAIL(X.quantile(-0.1));
+            ASSERT_SAFE_FAIL(X.quantile(1.1));
+            ASSERT_SAFE_FAIL(X.quantileIfValid(&result, 1.1));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'merge'
+        //
+        // Concerns:
+        //: 1 A digest merged from digests of the parts of a data set
+        //:   summarizes the whole data set, within the documented accuracy,
+        //:   however the data set is split.
+        //:
+        //: 2 Merging an empty digest is a no-op, and merging into an empty
+        //:   digest yields the estimates of the other digest.
+        //:
+        //: 3 Merging a digest with itself doubles the weight of its values.
+        //
+        // Plan:
+        //: 1 Split a data set into 2, 8, and 64 parts, both in contiguous and
+        //:   interleaved blocks, summarize the parts, merge the digests, and
+        //:   verify the count, extremes, and the rank error of the estimates
+        //:   of several quantiles.  (C-1)
+        //:
+        //: 2 Merge empty digests into, and non-empty digests into empty,
+        //:   digests, and compare the estimates.  (C-2)
+        //:
+        //: 3 Merge a digest with itself and verify its weight and estimates.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void merge(const TDigest& other)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'merge'" << endl
+                          << "===============" << endl;
+
+        const int    NUM_VALUES = 200000;
+        unsigned int state      = 99;
+
+        bsl::vector<double> values;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const double u = nextRandom(&state);
+            values.push_back(u * u * 1000.0);  // skewed towards 0
+        }
+        bsl::vector<double> sorted(values);
+        bsl::sort(sorted.begin(), sorted.end());
+
+        const int    PARTS[]   = { 2, 8, 64 };
+        const double PROBS[]   = { 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9,
+                                   0.99, 0.999 };
+        const int    NUM_PROBS = sizeof PROBS / sizeof *PROBS;
+
+        for (int p = 0; p < 3; ++p) {
+            for (int interleave = 0; interleave < 2; ++interleave) {
+                const int NUM_PARTS = PARTS[p];
+
+                bsl::vector<Obj> parts(NUM_PARTS);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    const int part = interleave
+                                   ? i % NUM_PARTS
+                                   : i / (NUM_VALUES / NUM_PARTS);
+                    parts[part].add(values[i]);
+                }
+
+                Obj mX;  const Obj& X = mX;
+                for (int i = 0; i < NUM_PARTS; ++i) {
+                    mX.merge(parts[i]);
+                }
+
+                ASSERTV(NUM_PARTS, NUM_VALUES == X.totalWeight());
+                ASSERTV(NUM_PARTS, sorted.front() == X.min());
+                ASSERTV(NUM_PARTS, sorted.back()  == X.max());
+                ASSERTV(NUM_PARTS, X.numCentroids(),
+                        X.numCentroids() <= 2 * X.compression());
+
+                for (int j = 0; j < NUM_PROBS; ++j) {
+                    const double PROB  = PROBS[j];
+                    const double error = fabs(exactRank(sorted,
+                                                        X.quantile(PROB))
+                                              - PROB);
+
+                    if (veryVerbose) {
+                        P_(NUM_PARTS) P_(interleave) P_(PROB) P(error);
+                    }
+
+                    // Merging is allowed twice the error of a single digest.
+
+                    ASSERTV(NUM_PARTS, interleave, PROB, error,
+                            error <= 2.0 * rankTolerance(PROB, 100.0));
+                }
+            }
+        }
+
+        if (verbose) cout << "\tMerging empty digests." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            Obj mY;  const Obj& Y = mY;
+            mX.merge(Y);
+            ASSERT(X.isEmpty());
+
+            for (int i = 0; i < 100; ++i) {
+                mY.add(i * 0.5);
+            }
+            mX.merge(Y);
+            ASSERT(100 == X.totalWeight());
+            ASSERT(0.0 == X.min());
+            ASSERT(49.5 == X.max());
+            ASSERT(fabs(Y.quantile(0.42) - X.quantile(0.42)) < 1e-10);
+
+            const Obj Z;
+            mX.merge(Z);
+            ASSERT(100 == X.totalWeight());
+            ASSERT(fabs(Y.quantile(0.42) - X.quantile(0.42)) < 1e-10);
+        }
+
+        if (verbose) cout << "\tMerging a digest with itself." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            for (int i = 1; i <= 1000; ++i) {
+                mX.add(i);
+            }
+            const double median = X.quantile(0.5);
+
+            mX.merge(X);
+            ASSERT(2000 == X.totalWeight());
+            ASSERT(1    == X.min());
+            ASSERT(1000 == X.max());
+            ASSERTV(median, X.quantile(0.5),
+                    fabs(median - X.quantile(0.5)) < 5.0);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ACCURACY
+        //
+        // Concerns:
+        //: 1 The rank error of the estimated quantiles is within the
+        //:   documented bounds, for uniform and skewed distributions, and for
+        //:   values added in sorted, reverse sorted, and random orders.
+        //:
+        //: 2 'cdf' is consistent with 'quantile'.
+        //:
+        //: 3 The number of centroids is bounded by about 'compression'.
+        //:
+        //: 4 'compression' returns the compression supplied at construction.
+        //
+        // Plan:
+        //: 1 For compressions of 50, 100, and 500, add 10^5 values of each
+        //:   distribution and order, and verify the rank error of several
+        //:   quantiles against the sorted data.  (C-1)
+        //:
+        //: 2 Verify that 'cdf(quantile(q))' is close to 'q'.  (C-2)
+        //:
+        //: 3 After 'flush', verify 'numCentroids'.  (C-3)
+        //:
+        //: 4 Verify 'compression'.  (C-4)
+        //
+        // Testing:
+        //   TDigest(double compression, Allocator *ba = 0)
+        //   double compression() const
+        //   int numCentroids() const
+        //   ACCURACY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ACCURACY" << endl
+                          << "========" << endl;
+
+        const int    NUM_VALUES     = 100000;
+        const double COMPRESSIONS[] = { 50.0, 100.0, 500.0 };
+        const double PROBS[]        = { 0.0001, 0.001, 0.01, 0.05, 0.25,
+                                        0.5, 0.75, 0.95, 0.99, 0.999,
+                                        0.9999 };
+        const int    NUM_PROBS      = sizeof PROBS / sizeof *PROBS;
+
+        enum { e_UNIFORM, e_EXPONENTIAL, k_NUM_DISTRIBUTIONS };
+        enum { e_RANDOM, e_SORTED, e_REVERSED, k_NUM_ORDERS };
+
+        for (int c = 0; c < 3; ++c) {
+        for (int d = 0; d < k_NUM_DISTRIBUTIONS; ++d) {
+        for (int o = 0; o < k_NUM_ORDERS; ++o) {
+            const double COMPRESSION = COMPRESSIONS[c];
+            unsigned int state       = 17;
+
+            bsl::vector<double> values;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const double u = nextRandom(&state);
+                values.push_back(e_UNIFORM == d ? u : -bsl::log(1.0 - u));
+            }
+            bsl::vector<double> sorted(values);
+            bsl::sort(sorted.begin(), sorted.end());
+
+            if (e_SORTED == o) {
+                values = sorted;
+            }
+            else if (e_REVERSED == o) {
+                values.assign(sorted.rbegin(), sorted.rend());
+            }
+
+            Obj mX(COMPRESSION);  const Obj& X = mX;
+            ASSERT(COMPRESSION == X.compression());
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                mX.add(values[i]);
+            }
+
+            for (int j = 0; j < NUM_PROBS; ++j) {
+                const double PROB     = PROBS[j];
+                const double estimate = X.quantile(PROB);
+                const double error    = fabs(exactRank(sorted, estimate)
+                                             - PROB);
+
+                if (veryVerbose) {
+                    P_(COMPRESSION) P_(d) P_(o) P_(PROB) P(error);
+                }
+
+                ASSERTV(COMPRESSION, d, o, PROB, error,
+                        error <= rankTolerance(PROB, COMPRESSION));
+                ASSERTV(COMPRESSION, d, o, PROB,
+                        fabs(X.cdf(estimate) - PROB) < 1e-6);
+            }
+
+            mX.flush();
+            ASSERTV(COMPRESSION, X.numCentroids(),
+                    X.numCentroids() <= COMPRESSION);
+        }
+        }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // WEIGHTS AND 'flush'
+        //
+        // Concerns:
+        //: 1 A value of weight 'w' counts as 'w' values of weight 1 in the
+        //:   total weight and the ranks.
+        //:
+        //: 2 'flush' does not change the estimates.
+        //:
+        //: 3 'flush' on a digest without buffered values is a no-op.
+        //
+        // Plan:
+        //: 1 Add values with integral weights to a digest, and each value as
+        //:   many times to another digest, and compare the total weights and
+        //:   the estimates, which are exact for few values.  (C-1)
+        //:
+        //: 2 Compare the estimates of a digest before and after 'flush',
+        //:   with and without buffered values.  (C-2, 3)
+        //
+        // Testing:
+        //   void add(double value, double weight)
+        //   void flush()
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WEIGHTS AND 'flush'" << endl
+                          << "===================" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+            Obj mY;  const Obj& Y = mY;
+
+            mX.add(1.0, 1.0);
+            mX.add(2.0, 3.0);
+            mX.add(5.0, 2.0);
+
+            mY.add(1.0);
+            mY.add(2.0);  mY.add(2.0);  mY.add(2.0);
+            mY.add(5.0);  mY.add(5.0);
+
+            ASSERT(6.0 == X.totalWeight());
+            ASSERT(X.totalWeight() == Y.totalWeight());
+
+            // Both digests have the ranks of { 1, 2, 2, 2, 5, 5 }, but the
+            // interpolation differs: 'X' has one centroid of 2 at rank 2.5
+            // (the middle of its weight), and 'Y' has three, at ranks 1.5,
+            // 2.5, and 3.5.  The median (rank 3) of 'X' is interpolated
+            // between the centroid of 2 and the centroid of 5 at rank 5.
+
+            ASSERTV(X.quantile(0.5), fabs(2.6 - X.quantile(0.5)) < 1e-10);
+            ASSERTV(Y.quantile(0.5), fabs(2.0 - Y.quantile(0.5)) < 1e-10);
+            ASSERTV(X.cdf(2.0), fabs(2.5 / 6.0 - X.cdf(2.0)) < 1e-10);
+            ASSERTV(Y.cdf(2.0), fabs(3.5 / 6.0 - Y.cdf(2.0)) < 1e-10);
+            ASSERT(1.0 == X.quantile(0.0));
+            ASSERT(5.0 == X.quantile(1.0));
+            ASSERT(0.0 == X.cdf(0.5));
+            ASSERT(1.0 == X.cdf(5.0));
+        }
+
+        {
+            unsigned int state = 3;
+
+            Obj mX;  const Obj& X = mX;
+            for (int i = 0; i < 1234; ++i) {
+                mX.add(nextRandom(&state), 1.0 + nextRandom(&state));
+            }
+
+            double before[11], cdfBefore[11];
+            for (int j = 0; j <= 10; ++j) {
+                before[j]    = X.quantile(j / 10.0);
+                cdfBefore[j] = X.cdf(j / 10.0);
+            }
+
+            mX.flush();
+            ASSERT(0 < X.numCentroids());
+
+            for (int j = 0; j <= 10; ++j) {
+                ASSERTV(j, before[j], X.quantile(j / 10.0),
+                        before[j] == X.quantile(j / 10.0));
+                ASSERTV(j, cdfBefore[j] == X.cdf(j / 10.0));
+            }
+
+            const int numCentroids = X.numCentroids();
+            mX.flush();
+            ASSERT(numCentroids == X.numCentroids());
+            ASSERT(before[5]    == X.quantile(0.5));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SMALL DATA SETS
+        //
+        // Concerns:
+        //: 1 A digest of few values estimates the interpolated sample
+        //:   quantiles exactly, whatever the order of the values.
+        //:
+        //: 2 'min', 'max', 'totalWeight', and 'isEmpty' reflect the values
+        //:   added.
+        //:
+        //: 3 'cdf' is 0 below the smallest value, 1 from the largest value,
+        //:   and interpolates between the values.
+        //
+        // Plan:
+        //: 1 Add the values 1 to 10 in several orders, and verify the
+        //:   estimates of a table of quantiles and of the cumulative
+        //:   distribution.  (C-1..3)
+        //
+        // Testing:
+        //   TDigest(Allocator *ba = 0)
+        //   void add(double value)
+        //   double cdf(double value) const
+        //   bool isEmpty() const
+        //   double max() const
+        //   double min() const
+        //   double quantile(double q) const
+        //   double totalWeight() const
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SMALL DATA SETS" << endl
+                          << "===============" << endl;
+
+        static const struct {
+            int    d_line;
+            double d_q;
+            double d_quantile;
+        } DATA[] = {
+            //LINE   PROB   QUANTILE
+            //----  -----   --------
+            { L_,   0.00,     1.00 },
+            { L_,   0.05,     1.00 },
+            { L_,   0.10,     1.50 },
+            { L_,   0.25,     3.00 },
+            { L_,   0.50,     5.50 },
+            { L_,   0.90,     9.50 },
+            { L_,   0.95,    10.00 },
+            { L_,   1.00,    10.00 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        static const struct {
+            int    d_line;
+            double d_value;
+            double d_cdf;
+        } CDF_DATA[] = {
+            //LINE   VALUE     CDF
+            //----   -----   -----
+            { L_,     0.00,   0.00 },
+            { L_,     1.00,   0.05 },
+            { L_,     1.50,   0.10 },
+            { L_,     5.00,   0.45 },
+            { L_,     5.25,   0.475 },
+            { L_,     9.99,   0.949 },
+            { L_,    10.00,   1.00 },
+            { L_,    11.00,   1.00 },
+        };
+        const int NUM_CDF_DATA = sizeof CDF_DATA / sizeof *CDF_DATA;
+
+        const int ORDERS[][10] = {
+            { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 },
+            { 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 },
+            { 4, 9, 1, 7, 10, 2, 6, 3, 8, 5 },
+        };
+
+        for (int o = 0; o < 3; ++o) {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.totalWeight());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.add(ORDERS[o][i]);
+            }
+            ASSERT(!X.isEmpty());
+            ASSERT(10   == X.totalWeight());
+            ASSERT(1.0  == X.min());
+            ASSERT(10.0 == X.max());
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int    LINE     = DATA[i].d_line;
+                const double PROB     = DATA[i].d_q;
+                const double QUANTILE = DATA[i].d_quantile;
+
+                if (veryVerbose) {
+                    P_(o) P_(LINE) P_(PROB) P(X.quantile(PROB));
+                }
+                ASSERTV(o, LINE, QUANTILE, X.quantile(PROB),
+                        fabs(QUANTILE - X.quantile(PROB)) < 1e-10);
+            }
+
+            for (int i = 0; i < NUM_CDF_DATA; ++i) {
+                const int    LINE  = CDF_DATA[i].d_line;
+                const double VALUE = CDF_DATA[i].d_value;
+                const double CDF   = CDF_DATA[i].d_cdf;
+
+                ASSERTV(o, LINE, CDF, X.cdf(VALUE),
+                        fabs(CDF - X.cdf(VALUE)) < 1e-10);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Developer test sandbox. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(X.isEmpty());
+        ASSERT(Obj::k_DEFAULT_COMPRESSION == X.compression());
+
+        mX.add(1.0);
+        ASSERT(1.0 == X.quantile(0.5));
+
+        mX.add(3.0);
+        ASSERT(2.0 == X.quantile(0.5));
+        ASSERT(0.5 == X.cdf(2.0));
+
+        for (int i = 0; i < 100000; ++i) {
+            mX.add(i % 1000);
+        }
+        ASSERT(100002 == X.totalWeight());
+        ASSERT(fabs(X.quantile(0.5) - 500.0) < 5.0);
+        if (verbose) {
+            P_(X.quantile(0.5)) P(X.numCentroids());
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,326 @@
+// bdlt_cacheimp.cpp                                                  -*-C++-*-
+#include <bdlt_cacheimp.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlt_cacheimp_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadlocalvariable.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>      // 'INT_MAX'
+#include <bsl_new.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Threads are assigned reader slots in round-robin order, through a
+// thread-local variable, on their first 'acquire', so that up to the number of
+// reader slots threads reading concurrently count themselves on distinct cache
+// lines.  Where thread-local storage is unavailable, a multiplicative hash of
+// the thread id is used instead.  The token returned by 'acquire' encodes the
+// index of the reader slot and the epoch in which the reader was counted.
+
+namespace BloombergLP {
+namespace {
+
+bsls::AtomicOperations::AtomicTypes::Int g_nextReaderSlotIndex = { 0 };
+    // index to be assigned to the next thread calling 'readerSlotIndex'
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(int, g_threadReaderSlotIndex, -1);
+    // reader slot index of the current thread, or -1 if not yet assigned
+#endif
+
+int numReaderSlots(int maxNumReaderSlots)
+    // Return the number of reader slots: the smallest power of 2 that is at
+    // least twice the number of hardware threads, but no more than the
+    // specified 'maxNumReaderSlots'.  The behavior is undefined unless
+    // 'maxNumReaderSlots' is a positive power of 2.
+{
+    const unsigned int numThreads = bslmt::ThreadUtil::hardwareConcurrency();
+
+    int result = 1;
+    while (result < maxNumReaderSlots
+        && static_cast<unsigned int>(result) < 2 * numThreads) {
+        result *= 2;
+    }
+    return result;
+}
+
+int readerSlotIndex()
+    // Return a non-negative index identifying the reader slot to be used by
+    // the calling thread, to be reduced modulo the number of reader slots.
+    // Note that the returned value is the same for all calls made by a given
+    // thread.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    int index = g_threadReaderSlotIndex;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 > index)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        index = bsls::AtomicOperations::addIntNvRelaxed(&g_nextReaderSlotIndex,
+                                                        1)
+              & INT_MAX;
+        g_threadReaderSlotIndex = index;
+    }
+    return index;
+#else
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                   * 0x9E3779B97F4A7C15ULL;
+    return static_cast<int>(hash >> 33);
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlt {
+
+                  // ========================================
+                  // struct CacheImp_ReaderEpochs::ReaderSlot
+                  // ========================================
+
+struct CacheImp_ReaderEpochs::ReaderSlot {
+    // This 'struct' holds the number of threads, sharing this slot, that are
+    // reading a snapshot, in each epoch, padded to a cache line.
+
+    // DATA
+    bsls::AtomicInt d_numReaders[2];  // number of readers in each epoch
+
+    char            d_pad[k_READER_SLOT_SIZE - 2 * sizeof(bsls::AtomicInt)];
+                                      // padding to a cache line
+};
+
+                       // ==============================
+                       // struct CacheImp_ReloaderThread
+                       // ==============================
+
+struct CacheImp_ReloaderThread {
+    // This 'struct' provides the functor that is the entry point of the
+    // thread of a reloader.
+
+    // DATA
+    CacheImp_Reloader *d_reloader_p;  // reloader whose thread this is (held,
+                                      // not owned)
+
+    // ACCESSORS
+    void operator()() const
+        // Run the thread of the reloader held by this object.
+    {
+        d_reloader_p->run();
+    }
+};
+
+                        // ---------------------------
+                        // class CacheImp_ReaderEpochs
+                        // ---------------------------
+
+// CREATORS
+CacheImp_ReaderEpochs::CacheImp_ReaderEpochs()
+: d_epoch(0)
+, d_readerSlots_p(0)
+, d_numReaderSlots(0)
+{
+    BSLMF_ASSERT(k_READER_SLOT_SIZE == sizeof(ReaderSlot));
+
+    const bsls::Types::UintPtr address =
+                      reinterpret_cast<bsls::Types::UintPtr>(d_readerBuffer);
+    const bsls::Types::UintPtr offset  =
+              (k_READER_SLOT_SIZE - address % k_READER_SLOT_SIZE)
+                                                        % k_READER_SLOT_SIZE;
+
+    d_readerSlots_p  = reinterpret_cast<ReaderSlot *>(d_readerBuffer + offset);
+    d_numReaderSlots = numReaderSlots(k_MAX_NUM_READER_SLOTS);
+
+    for (int i = 0; i < d_numReaderSlots; ++i) {
+        new (d_readerSlots_p + i) ReaderSlot();
+    }
+}
+
+CacheImp_ReaderEpochs::~CacheImp_ReaderEpochs()
+{
+#ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
+    for (int i = 0; i < d_numReaderSlots; ++i) {
+        BSLS_ASSERT_SAFE(0 == d_readerSlots_p[i].d_numReaders[0]);
+        BSLS_ASSERT_SAFE(0 == d_readerSlots_p[i].d_numReaders[1]);
+    }
+#endif
+}
+
+// MANIPULATORS
+int CacheImp_ReaderEpochs::acquire()
+{
+    const int slotIndex = readerSlotIndex() & (d_numReaderSlots - 1);
+
+    ReaderSlot& slot = d_readerSlots_p[slotIndex];
+
+    // A reader that incremented the count of an epoch that has since been
+    // switched might not be waited for, so it must not read a snapshot.
+
+    int epoch = d_epoch;
+
+    ++slot.d_numReaders[epoch];
+
+    while (epoch != d_epoch) {
+        --slot.d_numReaders[epoch];
+
+        epoch = d_epoch;
+
+        ++slot.d_numReaders[epoch];
+    }
+
+    return 2 * slotIndex + epoch;
+}
+
+void CacheImp_ReaderEpochs::release(int token)
+{
+    BSLS_ASSERT(0 <= token);
+    BSLS_ASSERT(token < 2 * d_numReaderSlots);
+
+    --d_readerSlots_p[token / 2].d_numReaders[token % 2];
+}
+
+void CacheImp_ReaderEpochs::synchronize()
+{
+    // Readers that may be reading a replaced snapshot were counted in the
+    // current epoch.  Switch the epoch, so that new readers are counted in the
+    // other one, and wait for the readers of the current epoch, in every
+    // reader slot, to finish.
+
+    const int epoch = d_epoch.loadRelaxed();
+
+    d_epoch = 1 - epoch;
+
+    for (int i = 0; i < d_numReaderSlots; ++i) {
+        while (0 != d_readerSlots_p[i].d_numReaders[epoch]) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+                          // -----------------------
+                          // class CacheImp_Reloader
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+void CacheImp_Reloader::run()
+{
+    bsl::string name(d_allocator_p);
+
+    d_lock.lock();
+
+    while (true) {
+        while (d_queue.empty() && !d_isStopping) {
+            d_condition.wait(&d_lock);
+        }
+
+        if (d_isStopping) {
+            break;
+        }
+
+        name.swap(d_queue.back());
+        d_queue.pop_back();
+
+        d_lock.unlock();
+
+        d_reloadFunction(name.c_str());
+
+        d_lock.lock();
+    }
+
+    d_lock.unlock();
+}
+
+// CREATORS
+CacheImp_Reloader::CacheImp_Reloader(const ReloadFunction&  reloadFunction,
+                                     bslma::Allocator      *basicAllocator)
+: d_reloadFunction(bsl::allocator_arg, basicAllocator, reloadFunction)
+, d_lock()
+, d_condition()
+, d_queue(basicAllocator)
+, d_isStopping(false)
+, d_hasThread(false)
+, d_thread()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(reloadFunction);
+}
+
+CacheImp_Reloader::~CacheImp_Reloader()
+{
+    stop();
+}
+
+// MANIPULATORS
+void CacheImp_Reloader::requestReload(const char *name)
+{
+    BSLS_ASSERT(name);
+
+    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+
+    if (d_isStopping) {
+        return;                                                       // RETURN
+    }
+
+    if (!d_hasThread) {
+        CacheImp_ReloaderThread function = { this };
+
+        if (0 != bslmt::ThreadUtil::createWithAllocator(&d_thread,
+                                                        function,
+                                                        d_allocator_p)) {
+            return;                                                   // RETURN
+        }
+
+        d_hasThread = true;
+    }
+
+    d_queue.push_back(bsl::string(name, d_allocator_p));
+
+    d_condition.signal();
+}
+
+void CacheImp_Reloader::stop()
+{
+    bool hasThread;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+
+        d_isStopping = true;
+        hasThread    = d_hasThread;
+        d_hasThread  = false;
+
+        d_queue.clear();
+
+        d_condition.signal();
+    }
+
+    if (hasThread) {
+        bslmt::ThreadUtil::join(d_thread);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
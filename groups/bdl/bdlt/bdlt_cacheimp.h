@@ -0,0 +1,301 @@
+// bdlt_cacheimp.h                                                    -*-C++-*-
+#ifndef INCLUDED_BDLT_CACHEIMP
+#define INCLUDED_BDLT_CACHEIMP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide the reader tracking and reloading shared by 'bdlt' caches.
+//
+//@CLASSES:
+//  bdlt::CacheImp_ReaderEpochs: striped counts of readers of a snapshot
+//  bdlt::CacheImp_Reloader: thread reloading cache entries by name
+//
+//@SEE_ALSO: bdlt_calendarcache, bdlt_timetablecache
+//
+//@DESCRIPTION: This component provides two mechanisms that implement the
+// lock-free retrieval and the background reloading of 'bdlt::CalendarCache'
+// and 'bdlt::TimetableCache'.  This component is intended for use only by
+// those components.
+//
+///'bdlt::CacheImp_ReaderEpochs'
+///- - - - - - - - - - - - - - -
+// A cache publishes an immutable snapshot of its entries through an atomic
+// pointer, and readers search the snapshot without taking a lock.  A writer
+// that replaces the snapshot must not destroy the replaced one while a reader
+// may still be searching it.  'bdlt::CacheImp_ReaderEpochs' counts the
+// readers: a reader calls 'acquire' before loading the snapshot pointer, and
+// 'release', with the token returned by 'acquire', once it no longer uses the
+// snapshot.  A writer, having replaced the snapshot pointer, calls
+// 'synchronize', which returns once every reader that might have loaded the
+// replaced pointer has called 'release'.
+//
+// Readers are counted in one of two *epochs*, in a cache-line-sized *reader*
+// *slot* assigned to the calling thread; there is one such slot for each of up
+// to twice as many threads as there are hardware threads, so that readers on
+// different threads do not write to the same cache line.  'synchronize'
+// switches the epoch, and waits, scanning every slot, only for the readers of
+// the previous epoch.  Writers must be serialized by the caller.
+//
+///'bdlt::CacheImp_Reloader'
+///- - - - - - - - - - - - -
+// 'bdlt::CacheImp_Reloader' owns a thread that invokes, for each name passed
+// to 'requestReload', a reload function supplied at construction.  The thread
+// is created by the first call to 'requestReload', and is joined by 'stop' or
+// by the destructor.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Published Snapshot
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that a cache publishes the current value of an integer through an
+// atomic pointer.  First, we define the published pointer, and the object
+// counting its readers:
+//..
+//  bsls::AtomicPointer<int>    current(new int(1));
+//  bdlt::CacheImp_ReaderEpochs readers;
+//..
+// Next, a reader acquires the snapshot, reads it, and releases it:
+//..
+//  int        token = readers.acquire();
+//  const int *value = current;
+//
+//  assert(1 == *value);
+//
+//  readers.release(token);
+//..
+// Then, a writer replaces the snapshot, and waits until no reader can still be
+// reading the replaced one:
+//..
+//  int *previous = current.swap(new int(2));
+//
+//  readers.synchronize();
+//..
+// Finally, the writer destroys the replaced snapshot, and the cache destroys
+// the current one:
+//..
+//  delete previous;
+//  delete current.load();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_functional.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlt {
+
+struct CacheImp_ReloaderThread;
+
+                        // ===========================
+                        // class CacheImp_ReaderEpochs
+                        // ===========================
+
+class CacheImp_ReaderEpochs {
+    // This mechanism counts, in two epochs and in cache-line-sized slots
+    // assigned to threads, the readers of a snapshot published by a cache, so
+    // that a writer can wait for the readers of a snapshot it has replaced.
+    // 'acquire' and 'release' may be called concurrently from any number of
+    // threads, and concurrently with 'synchronize'; calls to 'synchronize'
+    // must be serialized.
+
+    // PRIVATE TYPES
+    struct ReaderSlot;
+        // A cache-line-sized pair of reader counts, one for each epoch
+        // (defined in the implementation file).
+
+    enum {
+        k_MAX_NUM_READER_SLOTS = 64,  // maximum number of reader slots (a
+                                      // power of 2)
+
+        k_READER_SLOT_SIZE     = 64   // size, in bytes, to which each reader
+                                      // slot is padded and aligned (the
+                                      // cache-line size)
+    };
+
+    // DATA
+    bsls::AtomicInt  d_epoch;           // epoch (0 or 1) in which readers are
+                                        // counted
+
+    char             d_readerBuffer[(k_MAX_NUM_READER_SLOTS + 1)
+                                                        * k_READER_SLOT_SIZE];
+                                        // storage for the reader slots,
+                                        // over-sized so that they can be
+                                        // aligned on a cache-line boundary
+
+    ReaderSlot      *d_readerSlots_p;   // cache-line aligned array of
+                                        // 'd_numReaderSlots' reader slots
+                                        // within 'd_readerBuffer'
+
+    int              d_numReaderSlots;  // number of reader slots (a power of
+                                        // 2)
+
+  private:
+    // NOT IMPLEMENTED
+    CacheImp_ReaderEpochs(const CacheImp_ReaderEpochs&);
+    CacheImp_ReaderEpochs& operator=(const CacheImp_ReaderEpochs&);
+
+  public:
+    // CREATORS
+    CacheImp_ReaderEpochs();
+        // Create an object counting no readers.
+
+    ~CacheImp_ReaderEpochs();
+        // Destroy this object.  The behavior is undefined unless every call
+        // to 'acquire' has been matched by a call to 'release'.
+
+    // MANIPULATORS
+    int acquire();
+        // Count the calling thread as a reader in the current epoch, and
+        // return a token to be passed to 'release'.  A snapshot pointer
+        // loaded by the calling thread after this call remains valid until
+        // 'release' is called with the returned token.
+
+    void release(int token);
+        // Stop counting the reader counted by the call to 'acquire' that
+        // returned the specified 'token'.  The behavior is undefined unless
+        // 'token' was returned by a call to 'acquire' on this object that has
+        // not yet been matched by a call to 'release'.
+
+    void synchronize();
+        // Switch the epoch in which readers are counted, and wait until every
+        // reader counted in the previous epoch has been released.  Note that
+        // any snapshot pointer replaced before this call is no longer used by
+        // any reader once this call returns.  The behavior is undefined if
+        // this method is called concurrently from more than one thread.
+};
+
+                          // =======================
+                          // class CacheImp_Reloader
+                          // =======================
+
+class CacheImp_Reloader {
+    // This mechanism owns a thread that reloads cache entries by name,
+    // invoking a reload function supplied at construction for each name
+    // passed to 'requestReload'.  The thread is created on the first request.
+    // This class is fully thread-safe (see 'bsldoc_glossary').
+
+  public:
+    // TYPES
+    typedef bsl::function<void(const char *)> ReloadFunction;
+        // Function invoked, on the reload thread, with the name of each entry
+        // to reload.
+
+  private:
+    // DATA
+    ReloadFunction             d_reloadFunction;  // reloads one entry
+
+    bslmt::Mutex               d_lock;            // guards 'd_queue',
+                                                  // 'd_isStopping', and
+                                                  // 'd_hasThread'
+
+    bslmt::Condition           d_condition;       // signaled when a reload is
+                                                  // requested, or when
+                                                  // 'd_isStopping' is set
+
+    bsl::vector<bsl::string>   d_queue;           // names of the entries to
+                                                  // reload
+
+    bool                       d_isStopping;      // 'true' if the thread must
+                                                  // exit, and no thread may be
+                                                  // created
+
+    bool                       d_hasThread;       // 'true' if the thread has
+                                                  // been created and not
+                                                  // joined
+
+    bslmt::ThreadUtil::Handle  d_thread;          // reload thread; valid only
+                                                  // if 'd_hasThread'
+
+    bslma::Allocator          *d_allocator_p;     // memory allocator (held,
+                                                  // not owned)
+
+    // FRIENDS
+    friend struct CacheImp_ReloaderThread;
+
+  private:
+    // PRIVATE MANIPULATORS
+    void run();
+        // Reload the entries whose names are appended to 'd_queue' until
+        // 'd_isStopping' is set.  This method is the body of the reload
+        // thread.
+
+  private:
+    // NOT IMPLEMENTED
+    CacheImp_Reloader(const CacheImp_Reloader&);
+    CacheImp_Reloader& operator=(const CacheImp_Reloader&);
+
+  public:
+    // CREATORS
+    explicit
+    CacheImp_Reloader(const ReloadFunction&  reloadFunction,
+                      bslma::Allocator      *basicAllocator = 0);
+        // Create a reloader that invokes the specified 'reloadFunction' on
+        // its thread with the name of each entry whose reload is requested.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~CacheImp_Reloader();
+        // Destroy this object, after calling 'stop'.
+
+    // MANIPULATORS
+    void requestReload(const char *name);
+        // Request that the entry having the specified 'name' be reloaded on
+        // the thread of this reloader, creating that thread if it does not
+        // exist.  If 'stop' has been called, or the thread cannot be created,
+        // this method has no effect.
+
+    void stop();
+        // Discard the pending requests, wait for any reload in progress to
+        // complete, and join the thread of this reloader, if any.  After this
+        // call, 'requestReload' has no effect.  Note that a cache must call
+        // this method before destroying state used by its reload function.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// TRAITS
+
+namespace BloombergLP {
+namespace bslma {
+
+template <>
+struct UsesBslmaAllocator<bdlt::CacheImp_Reloader> : bsl::true_type {};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
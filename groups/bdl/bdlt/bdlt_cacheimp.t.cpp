@@ -0,0 +1,866 @@
+// bdlt_cacheimp.t.cpp                                                -*-C++-*-
+#include <bdlt_cacheimp.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>  // 'sort'
+#include <bsl_cstdlib.h>    // 'atoi'
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// This component provides two mechanisms used by the 'bdlt' caches.
+// 'bdlt::CacheImp_ReaderEpochs' counts the readers of a published snapshot;
+// we verify that 'synchronize' returns immediately when there are no readers,
+// that it waits for the readers counted before it was called, and that it
+// does not wait for readers counted after it was called.  Threads are used to
+// verify the waiting behavior, and a stress test verifies that a snapshot is
+// never destroyed while a reader uses it.  'bdlt::CacheImp_Reloader' invokes
+// a function on its own thread for each requested name; we verify that every
+// request is honored, that 'stop' joins the thread, and that requests made
+// after 'stop' are ignored.
+// ----------------------------------------------------------------------------
+// 'CacheImp_ReaderEpochs' class:
+// [ 2] CacheImp_ReaderEpochs();
+// [ 2] ~CacheImp_ReaderEpochs();
+// [ 2] int acquire();
+// [ 2] void release(int token);
+// [ 3] void synchronize();
+//
+// 'CacheImp_Reloader' class:
+// [ 4] CacheImp_Reloader(const ReloadFunction& f, Allocator *ba = 0);
+// [ 4] ~CacheImp_Reloader();
+// [ 4] void requestReload(const char *name);
+// [ 4] void stop();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 3] CONCERN: A replaced snapshot is unused once 'synchronize' returns.
+// [ 4] CONCERN: Reloads are not performed on the requesting thread.
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlt::CacheImp_ReaderEpochs ReaderEpochs;
+typedef bdlt::CacheImp_Reloader     Reloader;
+
+// ============================================================================
+//                                 TYPE TRAITS
+// ----------------------------------------------------------------------------
+
+BSLMF_ASSERT(!(bslma::UsesBslmaAllocator<ReaderEpochs>::VALUE));
+BSLMF_ASSERT( (bslma::UsesBslmaAllocator<Reloader>::VALUE));
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                            // ===============
+                            // struct Released
+                            // ===============
+
+struct Released {
+    // This 'struct' provides a functor that, on its own thread, acquires a
+    // token, signals that it holds it, waits to be told to release it, and
+    // releases it.
+
+    // DATA
+    ReaderEpochs    *d_readers_p;   // readers to count in (held, not owned)
+    bsls::AtomicInt *d_state_p;     // 0: not yet acquired; 1: acquired; 2:
+                                    // release requested; 3: released (held,
+                                    // not owned)
+
+    // ACCESSORS
+    void operator()() const
+        // Acquire a token, and release it once '*d_state_p' is 2.
+    {
+        const int token = d_readers_p->acquire();
+
+        *d_state_p = 1;
+
+        while (2 != *d_state_p) {
+            bslmt::ThreadUtil::yield();
+        }
+
+        d_readers_p->release(token);
+
+        *d_state_p = 3;
+    }
+};
+
+                          // ====================
+                          // struct Synchronizing
+                          // ====================
+
+struct Synchronizing {
+    // This 'struct' provides a functor that calls 'synchronize' on its own
+    // thread, and records its return.
+
+    // DATA
+    ReaderEpochs    *d_readers_p;   // readers to wait for (held, not owned)
+    bsls::AtomicInt *d_isDone_p;    // set to 1 once 'synchronize' returns
+                                    // (held, not owned)
+
+    // ACCESSORS
+    void operator()() const
+        // Call 'synchronize', and then set '*d_isDone_p' to 1.
+    {
+        d_readers_p->synchronize();
+
+        *d_isDone_p = 1;
+    }
+};
+
+                             // ================
+                             // struct StressArg
+                             // ================
+
+struct StressArg {
+    // This 'struct' holds the state shared by the threads of the stress test.
+
+    // DATA
+    ReaderEpochs              d_readers;     // readers of 'd_current'
+    bsls::AtomicPointer<int>  d_current;     // published snapshot, holding
+                                             // 'k_LIVE' until destroyed
+    bsls::AtomicInt           d_isDone;      // set to 1 to stop the readers
+    bsls::AtomicInt           d_numErrors;   // number of destroyed snapshots
+                                             // read
+};
+
+enum { k_LIVE = 12345, k_DEAD = -1 };
+
+struct StressReader {
+    // This 'struct' provides a functor that reads the snapshot of a
+    // 'StressArg' until told to stop.
+
+    // DATA
+    StressArg *d_arg_p;  // shared state (held, not owned)
+
+    // ACCESSORS
+    void operator()() const
+        // Repeatedly read the current snapshot, counting destroyed ones.
+    {
+        while (!d_arg_p->d_isDone) {
+            const int  token = d_arg_p->d_readers.acquire();
+            const int *value = d_arg_p->d_current;
+
+            for (int i = 0; i < 10; ++i) {
+                if (k_LIVE != *static_cast<const volatile int *>(value)) {
+                    ++d_arg_p->d_numErrors;
+                }
+            }
+
+            d_arg_p->d_readers.release(token);
+        }
+    }
+};
+
+                            // ==================
+                            // class RecordReload
+                            // ==================
+
+class RecordReload {
+    // This class provides a reload function that records the names it is
+    // invoked with, and the thread on which it is invoked.
+
+    // DATA
+    bslmt::Mutex             *d_lock_p;       // guards '*d_names_p' (held,
+                                              // not owned)
+
+    bsl::vector<bsl::string> *d_names_p;      // reloaded names (held, not
+                                              // owned)
+
+    bsls::AtomicInt          *d_numOnCaller_p;
+                                              // number of reloads made on the
+                                              // thread that created this
+                                              // object (held, not owned)
+
+    bsls::Types::Uint64       d_callerId;     // id of the creating thread
+
+  public:
+    // CREATORS
+    RecordReload(bslmt::Mutex             *lock,
+                 bsl::vector<bsl::string> *names,
+                 bsls::AtomicInt          *numOnCaller)
+        // Create a reload function recording, under the specified 'lock', the
+        // reloaded names in the specified 'names', and counting in the
+        // specified 'numOnCaller' the reloads made on the calling thread.
+    : d_lock_p(lock)
+    , d_names_p(names)
+    , d_numOnCaller_p(numOnCaller)
+    , d_callerId(bslmt::ThreadUtil::selfIdAsUint64())
+    {
+    }
+
+    // ACCESSORS
+    void operator()(const char *name) const
+        // Record the specified 'name'.
+    {
+        if (bslmt::ThreadUtil::selfIdAsUint64() == d_callerId) {
+            ++*d_numOnCaller_p;
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> lockGuard(d_lock_p);
+
+        d_names_p->push_back(name);
+    }
+};
+
+int numRecorded(bslmt::Mutex *lock, const bsl::vector<bsl::string>& names)
+    // Return, under the specified 'lock', the number of elements of the
+    // specified 'names'.
+{
+    bslmt::LockGuard<bslmt::Mutex> lockGuard(lock);
+
+    return static_cast<int>(names.size());
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Reading a Published Snapshot
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that a cache publishes the current value of an integer through an
+// atomic pointer.  First, we define the published pointer, and the object
+// counting its readers:
+//..
+    bsls::AtomicPointer<int>    current(new int(1));
+    bdlt::CacheImp_ReaderEpochs readers;
+//..
+// Next, a reader acquires the snapshot, reads it, and releases it:
+//..
+    int        token = readers.acquire();
+    const int *value = current;
+
+    ASSERT(1 == *value);
+
+    readers.release(token);
+//..
+// Then, a writer replaces the snapshot, and waits until no reader can still be
+// reading the replaced one:
+//..
+    int *previous = current.swap(new int(2));
+
+    readers.synchronize();
+//..
+// Finally, the writer destroys the replaced snapshot, and the cache destroys
+// the current one:
+//..
+    delete previous;
+    delete current.load();
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RELOADER
+        //   Ensure that a reloader invokes its function, on its own thread,
+        //   for each requested name until it is stopped.
+        //
+        // Concerns:
+        //: 1 The reload function is invoked once for each requested name, on
+        //:   a thread other than the requesting one.
+        //:
+        //: 2 No thread is created, and no memory is allocated, if no reload is
+        //:   requested.
+        //:
+        //: 3 'stop' joins the thread, and may be called more than once.
+        //:
+        //: 4 Requests made after 'stop' are ignored.
+        //:
+        //: 5 The destructor stops the reloader.
+        //:
+        //: 6 Memory is supplied by the specified allocator.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a reloader whose function records the names it is invoked
+        //:   with, and verify that no memory is allocated.  (C-2)
+        //:
+        //: 2 Request the reload of several names, wait until they have all
+        //:   been recorded, and verify that none was reloaded on the main
+        //:   thread, and that memory came from the specified allocator.
+        //:   (C-1, 6)
+        //:
+        //: 3 Call 'stop' twice, request more reloads, and verify that none is
+        //:   performed.  (C-3..4)
+        //:
+        //: 4 Destroy a reloader having pending requests without calling
+        //:   'stop'.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null arguments.  (C-7)
+        //
+        // Testing:
+        //   CacheImp_Reloader(const ReloadFunction& f, Allocator *ba = 0);
+        //   ~CacheImp_Reloader();
+        //   void requestReload(const char *name);
+        //   void stop();
+        //   CONCERN: Reloads are not performed on the requesting thread.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RELOADER" << endl
+                          << "========" << endl;
+
+        bslma::TestAllocator         da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const char *NAMES[]   = { "CAL-1", "CAL-2", "CAL-3", "CAL-4" };
+        const int   NUM_NAMES = static_cast<int>(sizeof NAMES / sizeof *NAMES);
+
+        {
+            bslmt::Mutex             lock;
+            bsl::vector<bsl::string> names(&da);
+            bsls::AtomicInt          numOnCaller(0);
+
+            Reloader mX(RecordReload(&lock, &names, &numOnCaller), &sa);
+
+            const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksInUse();
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                mX.requestReload(NAMES[i]);
+            }
+
+            ASSERTV(NUM_BLOCKS, sa.numBlocksInUse(),
+                    NUM_BLOCKS < sa.numBlocksInUse());
+
+            while (numRecorded(&lock, names) < NUM_NAMES) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            ASSERTV(numOnCaller, 0 == numOnCaller);
+
+            mX.stop();
+            mX.stop();
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                mX.requestReload(NAMES[i]);
+            }
+
+            ASSERTV(names.size(), NUM_NAMES == static_cast<int>(names.size()));
+
+            bsl::sort(names.begin(), names.end());
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                ASSERTV(i, names[i], NAMES[i] == names[i]);
+            }
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\nNo thread without requests." << endl;
+        {
+            bslmt::Mutex             lock;
+            bsl::vector<bsl::string> names(&da);
+            bsls::AtomicInt          numOnCaller(0);
+
+            const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksInUse();
+
+            Reloader mX(RecordReload(&lock, &names, &numOnCaller), &sa);
+
+            ASSERTV(sa.numBlocksInUse(), NUM_BLOCKS == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nDestruction with pending requests." << endl;
+        {
+            bslmt::Mutex             lock;
+            bsl::vector<bsl::string> names(&da);
+            bsls::AtomicInt          numOnCaller(0);
+
+            Reloader mX(RecordReload(&lock, &names, &numOnCaller), &sa);
+
+            for (int i = 0; i < 100; ++i) {
+                mX.requestReload(NAMES[i % NUM_NAMES]);
+            }
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslmt::Mutex             lock;
+            bsl::vector<bsl::string> names(&da);
+            bsls::AtomicInt          numOnCaller(0);
+
+            Reloader mX(RecordReload(&lock, &names, &numOnCaller), &sa);
+
+            ASSERT_FAIL(mX.requestReload(0));
+            ASSERT_FAIL(Reloader(Reloader::ReloadFunction(), &sa));
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'synchronize'
+        //   Ensure that 'synchronize' waits exactly for the readers counted
+        //   before it is called.
+        //
+        // Concerns:
+        //: 1 'synchronize' returns immediately if there are no readers.
+        //:
+        //: 2 'synchronize' does not return while a reader counted before the
+        //:   call has not been released, and returns once it is.
+        //:
+        //: 3 'synchronize' does not wait for readers counted after the call.
+        //:
+        //: 4 A snapshot destroyed after 'synchronize' returns is never read,
+        //:   whatever the number of concurrent readers.
+        //
+        // Plan:
+        //: 1 Call 'synchronize' repeatedly on an object having no readers.
+        //:   (C-1)
+        //:
+        //: 2 Acquire a token on a thread, call 'synchronize' on another, and
+        //:   verify that it has not returned until the token is released.
+        //:   (C-2)
+        //:
+        //: 3 Call 'synchronize', and then acquire a token, and call
+        //:   'synchronize' again while that token is held; since the token
+        //:   was acquired in the current epoch, the second call must wait,
+        //:   but a token acquired after the first call returned does not
+        //:   prevent the first call from returning.  (C-3)
+        //:
+        //: 4 Run several reader threads that repeatedly read a published
+        //:   integer, while the main thread repeatedly replaces it, calls
+        //:   'synchronize', and overwrites and destroys the replaced integer;
+        //:   verify that readers never observe an overwritten integer.  (C-4)
+        //
+        // Testing:
+        //   void synchronize();
+        //   CONCERN: A replaced snapshot is unused once 'synchronize' returns.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'synchronize'" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("thread", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nNo readers." << endl;
+        {
+            ReaderEpochs mX;
+
+            for (int i = 0; i < 4; ++i) {
+                mX.synchronize();
+            }
+        }
+
+        if (verbose) cout << "\nWaiting for a reader." << endl;
+        {
+            ReaderEpochs    mX;
+            bsls::AtomicInt state(0);
+            bsls::AtomicInt isDone(0);
+
+            bslmt::ThreadUtil::Handle reader;
+            bslmt::ThreadUtil::Handle writer;
+
+            Released      readerFunction = { &mX, &state  };
+            Synchronizing writerFunction = { &mX, &isDone };
+
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                                               &reader,
+                                                               readerFunction,
+                                                               &ta));
+
+            while (1 != state) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                                               &writer,
+                                                               writerFunction,
+                                                               &ta));
+
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+
+            ASSERTV(isDone, 0 == isDone);
+
+            state = 2;
+
+            ASSERT(0 == bslmt::ThreadUtil::join(writer));
+            ASSERT(0 == bslmt::ThreadUtil::join(reader));
+
+            ASSERTV(isDone, 1 == isDone);
+            ASSERTV(state,  3 == state);
+        }
+
+        if (verbose) cout << "\nNot waiting for later readers." << endl;
+        {
+            ReaderEpochs mX;
+
+            for (int i = 0; i < 4; ++i) {
+                const int token = mX.acquire();
+
+                // The reader was counted after the previous 'synchronize', so
+                // a reader in the other epoch does not delay this one.
+
+                mX.release(token);
+                mX.synchronize();
+            }
+
+            const int token1 = mX.acquire();
+
+            bsls::AtomicInt           isDone(0);
+            bslmt::ThreadUtil::Handle writer;
+            Synchronizing             writerFunction = { &mX, &isDone };
+
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                                               &writer,
+                                                               writerFunction,
+                                                               &ta));
+
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+
+            ASSERTV(isDone, 0 == isDone);
+
+            // A reader counted after the epoch switch does not delay the
+            // writer.
+
+            const int token2 = mX.acquire();
+
+            mX.release(token1);
+
+            ASSERT(0 == bslmt::ThreadUtil::join(writer));
+            ASSERTV(isDone, 1 == isDone);
+
+            mX.release(token2);
+        }
+
+        if (verbose) cout << "\nStress test." << endl;
+        {
+            enum { k_NUM_READERS = 8, k_NUM_ITERATIONS = 20000 };
+
+            StressArg arg;
+
+            arg.d_current   = new int(k_LIVE);
+            arg.d_isDone    = 0;
+            arg.d_numErrors = 0;
+
+            bslmt::ThreadUtil::Handle readers[k_NUM_READERS];
+            StressReader              readerFunction = { &arg };
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::createWithAllocator(
+                                                               &readers[i],
+                                                               readerFunction,
+                                                               &ta));
+            }
+
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                int *previous = arg.d_current.swap(new int(k_LIVE));
+
+                arg.d_readers.synchronize();
+
+                *previous = k_DEAD;
+                delete previous;
+            }
+
+            arg.d_isDone = 1;
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ASSERTV(i, 0 == bslmt::ThreadUtil::join(readers[i]));
+            }
+
+            ASSERTV(arg.d_numErrors, 0 == arg.d_numErrors);
+
+            delete arg.d_current.load();
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'acquire' AND 'release'
+        //   Ensure that readers can be counted and released.
+        //
+        // Concerns:
+        //: 1 'acquire' returns the same token for repeated calls on a thread
+        //:   within an epoch, and a different one after 'synchronize'.
+        //:
+        //: 2 Any number of nested acquisitions may be made by a thread.
+        //:
+        //: 3 The object allocates no memory.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Acquire and release tokens, with and without intervening calls
+        //:   to 'synchronize', and compare them.  (C-1)
+        //:
+        //: 2 Acquire several tokens before releasing any.  (C-2)
+        //:
+        //: 3 Install a test allocator as the default, and verify that it is
+        //:   not used.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid tokens.  (C-4)
+        //
+        // Testing:
+        //   CacheImp_ReaderEpochs();
+        //   ~CacheImp_ReaderEpochs();
+        //   int acquire();
+        //   void release(int token);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'acquire' AND 'release'" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            ReaderEpochs mX;
+
+            const int token1 = mX.acquire();
+            mX.release(token1);
+
+            const int token2 = mX.acquire();
+            mX.release(token2);
+
+            ASSERTV(token1, token2, token1 == token2);
+
+            mX.synchronize();
+
+            const int token3 = mX.acquire();
+            mX.release(token3);
+
+            ASSERTV(token1, token3, token1 != token3);
+            ASSERTV(token1, token3, token1 / 2 == token3 / 2);
+
+            enum { k_NUM_NESTED = 10 };
+
+            int tokens[k_NUM_NESTED];
+
+            for (int i = 0; i < k_NUM_NESTED; ++i) {
+                tokens[i] = mX.acquire();
+
+                ASSERTV(i, tokens[i], token3, token3 == tokens[i]);
+            }
+
+            for (int i = 0; i < k_NUM_NESTED; ++i) {
+                mX.release(tokens[i]);
+            }
+
+            mX.synchronize();
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ReaderEpochs mX;
+
+            ASSERT_FAIL(mX.release(-1));
+            ASSERT_FAIL(mX.release(2 * 64));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The classes are sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Acquire, release, and synchronize readers, and reload a name.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        {
+            ReaderEpochs mX;
+
+            const int token = mX.acquire();
+            mX.release(token);
+            mX.synchronize();
+        }
+
+        {
+            bslma::TestAllocator     sa("supplied", veryVeryVeryVerbose);
+            bslmt::Mutex             lock;
+            bsl::vector<bsl::string> names(&sa);
+            bsls::AtomicInt          numOnCaller(0);
+
+            Reloader mX(RecordReload(&lock, &names, &numOnCaller), &sa);
+
+            mX.requestReload("CAL-1");
+
+            while (0 == numRecorded(&lock, names)) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            mX.stop();
+
+            ASSERTV(names.size(), 1 == names.size());
+            ASSERTV(names[0], "CAL-1" == names[0]);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -10,16 +10,60 @@ BSLS_IDENT_RCSID(bdlt_calendarcache_cpp,"$Id$ $CSID$")
 #include <bdlt_packedcalendar.h>
 
 #include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
 
 #include <bslmt_lockguard.h>
 
 #include <bsls_assert.h>
 
 #include <bsl_climits.h>      // 'INT_MAX'
+#include <bsl_cstddef.h>
+#include <bsl_new.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Retrievals search the current snapshot without taking a lock, counting
+// themselves in 'd_readers' (see 'bdlt_cacheimp'), and 'publish' waits for
+// the readers of a replaced snapshot before destroying it.
+//
+// A background reload is requested at most once per entry: the first
+// 'getCalendar' to find an entry past its reload age sets the entry's
+// 'd_isReloadRequested' flag, and later ones only load that flag.  'reload'
+// replaces the entry only if the flag is still set on the entry in the current
+// snapshot, since an entry that was invalidated, or replaced by 'getCalendar',
+// in the meantime no longer has it.
 
 namespace BloombergLP {
 namespace bdlt {
 
+                          // ===========================
+                          // struct CalendarCache_Reload
+                          // ===========================
+
+struct CalendarCache_Reload {
+    // This 'struct' provides the reload function of the reloader of a
+    // calendar cache.
+
+    // DATA
+    CalendarCache *d_cache_p;  // cache whose calendars are reloaded
+                               // (held, not owned)
+
+    // CREATORS
+    explicit CalendarCache_Reload(CalendarCache *cache)
+        // Create a reload function for the specified 'cache'.
+    : d_cache_p(cache)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(const char *calendarName) const
+        // Reload, into the cache held by this object, the calendar having
+        // the specified 'calendarName'.
+    {
+        d_cache_p->reload(calendarName);
+    }
+};
+
                         // -------------------------
                         // class CalendarCache_Entry
                         // -------------------------
@@ -28,6 +72,7 @@ namespace bdlt {
 CalendarCache_Entry::CalendarCache_Entry()
 : d_ptr()
 , d_loadTime()
+, d_isReloadRequested(false)
 {
 }
 
@@ -36,6 +81,7 @@ CalendarCache_Entry::CalendarCache_Entry(Calendar         *calendar,
                                          bslma::Allocator *allocator)
 : d_ptr(calendar, allocator)
 , d_loadTime(loadTime)
+, d_isReloadRequested(false)
 {
     BSLS_ASSERT(calendar);
     BSLS_ASSERT(allocator);
@@ -44,6 +90,7 @@ CalendarCache_Entry::CalendarCache_Entry(Calendar         *calendar,
 CalendarCache_Entry::CalendarCache_Entry(const CalendarCache_Entry& original)
 : d_ptr(original.d_ptr)
 , d_loadTime(original.d_loadTime)
+, d_isReloadRequested(original.d_isReloadRequested.load())
 {
 }
 
@@ -55,8 +102,9 @@ CalendarCache_Entry::~CalendarCache_Entry()
 CalendarCache_Entry& CalendarCache_Entry::operator=(
                                                 const CalendarCache_Entry& rhs)
 {
-    d_ptr      = rhs.d_ptr;
-    d_loadTime = rhs.d_loadTime;
+    d_ptr               = rhs.d_ptr;
+    d_loadTime          = rhs.d_loadTime;
+    d_isReloadRequested = rhs.d_isReloadRequested.load();
 
     return *this;
 }
@@ -67,23 +115,164 @@ bsl::shared_ptr<const Calendar> CalendarCache_Entry::get() const
     return d_ptr;
 }
 
+bool CalendarCache_Entry::isReloadRequested() const
+{
+    return d_isReloadRequested;
+}
+
 Datetime CalendarCache_Entry::loadTime() const
 {
     return d_loadTime;
 }
 
+bool CalendarCache_Entry::requestReload() const
+{
+    return !d_isReloadRequested && !d_isReloadRequested.swap(true);
+}
+
                            // -------------------
                            // class CalendarCache
                            // -------------------
 
+// PRIVATE CLASS METHODS
+const CalendarCache_Entry *CalendarCache::findEntry(const Cache *cache,
+                                                    const char  *calendarName)
+{
+    BSLS_ASSERT(calendarName);
+
+    if (0 == cache) {
+        return 0;                                                     // RETURN
+    }
+
+    // Binary search, comparing names without creating a temporary string.
+
+    Cache::const_iterator first = cache->begin();
+    bsl::size_t           count = cache->size();
+
+    while (0 < count) {
+        const bsl::size_t           half = count / 2;
+        const Cache::const_iterator mid  = first + half;
+
+        if (mid->first < calendarName) {
+            first  = mid + 1;
+            count -= half + 1;
+        }
+        else {
+            count  = half;
+        }
+    }
+
+    return first != cache->end() && first->first == calendarName
+           ? &first->second
+           : 0;
+}
+
+// PRIVATE MANIPULATORS
+void CalendarCache::insertEntry(const char                 *calendarName,
+                                const CalendarCache_Entry&  entry,
+                                const CalendarCache_Entry  *cached)
+{
+    BSLS_ASSERT(calendarName);
+
+    const Cache *cache = d_cache_p.loadRelaxed();
+
+    Cache *newCache = new (*d_allocator_p) Cache(d_allocator_p);
+
+    bslma::RawDeleterProctor<Cache, bslma::Allocator> proctor(newCache,
+                                                              d_allocator_p);
+
+    if (cache) {
+        newCache->reserve(cache->size() + 1);
+        *newCache = *cache;
+    }
+
+    Cache::iterator iter = newCache->begin();
+    while (iter != newCache->end() && iter->first < calendarName) {
+        ++iter;
+    }
+
+    if (cached) {
+        iter->second = entry;
+    }
+    else {
+        newCache->insert(iter,
+                         CacheEntry(bsl::string(calendarName, d_allocator_p),
+                                    entry));
+    }
+
+    proctor.release();
+
+    publish(newCache);
+}
+
+void CalendarCache::publish(Cache *cache)
+{
+    Cache *previous = d_cache_p.swap(cache);
+
+    d_readers.synchronize();
+
+    if (previous) {
+        d_allocator_p->deleteObject(previous);
+    }
+}
+
+void CalendarCache::reload(const char *calendarName)
+{
+    BSLS_ASSERT(calendarName);
+
+    PackedCalendar packedCalendar;  // temporary, so use default allocator
+
+    const Datetime timestamp = CurrentTime::utc();
+
+    if (d_loader_p->load(&packedCalendar, calendarName)) {
+        return;                                                       // RETURN
+    }
+
+    Calendar *calendarPtr = new (*d_allocator_p) Calendar(packedCalendar,
+                                                          d_allocator_p);
+
+    CalendarCache_Entry entry(calendarPtr, timestamp, d_allocator_p);
+
+    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+
+    const CalendarCache_Entry *cached = findEntry(d_cache_p.loadRelaxed(),
+                                                  calendarName);
+
+    if (cached && cached->isReloadRequested()) {
+        insertEntry(calendarName, entry, cached);
+    }
+}
+
+// PRIVATE ACCESSORS
+int CalendarCache::acquireSnapshot(const Cache **cache) const
+{
+    BSLS_ASSERT(cache);
+
+    const int token = d_readers.acquire();
+
+    *cache = d_cache_p;
+
+    return token;
+}
+
+bool CalendarCache::hasExpired(const CalendarCache_Entry& entry) const
+{
+    return d_hasTimeOutFlag
+        && d_timeOut <= CurrentTime::utc() - entry.loadTime();
+}
+
 // CREATORS
 CalendarCache::CalendarCache(CalendarLoader   *loader,
                              bslma::Allocator *basicAllocator)
-: d_cache(basicAllocator)
+: d_cache_p(0)
+, d_readers()
 , d_loader_p(loader)
 , d_timeOut(0)
+, d_reloadAge(0)
 , d_hasTimeOutFlag(false)
+, d_reloadMode(e_RELOAD_ON_DEMAND)
 , d_lock()
+, d_reloader(CalendarCache_Reload(this), basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT(loader);
@@ -92,11 +281,35 @@ CalendarCache::CalendarCache(CalendarLoader   *loader,
 CalendarCache::CalendarCache(CalendarLoader            *loader,
                              const bsls::TimeInterval&  timeout,
                              bslma::Allocator          *basicAllocator)
-: d_cache(basicAllocator)
+: d_cache_p(0)
+, d_readers()
 , d_loader_p(loader)
 , d_timeOut(0, 0, 0, 0, timeout.totalMilliseconds())
+, d_reloadAge(0)
 , d_hasTimeOutFlag(true)
+, d_reloadMode(e_RELOAD_ON_DEMAND)
 , d_lock()
+, d_reloader(CalendarCache_Reload(this), basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(loader);
+    BSLS_ASSERT(bsls::TimeInterval() <= timeout);
+    BSLS_ASSERT(timeout <= bsls::TimeInterval(INT_MAX, 0));
+}
+
+CalendarCache::CalendarCache(CalendarLoader            *loader,
+                             const bsls::TimeInterval&  timeout,
+                             ReloadMode                 reloadMode,
+                             bslma::Allocator          *basicAllocator)
+: d_cache_p(0)
+, d_readers()
+, d_loader_p(loader)
+, d_timeOut(0, 0, 0, 0, timeout.totalMilliseconds())
+, d_reloadAge(0, 0, 0, 0, timeout.totalMilliseconds() / 2)
+, d_hasTimeOutFlag(true)
+, d_reloadMode(reloadMode)
+, d_lock()
+, d_reloader(CalendarCache_Reload(this), basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT(loader);
@@ -106,6 +319,15 @@ CalendarCache::CalendarCache(CalendarLoader            *loader,
 
 CalendarCache::~CalendarCache()
 {
+    // Join the reload thread before destroying what it uses.
+
+    d_reloader.stop();
+
+    Cache *cache = d_cache_p;
+
+    if (cache) {
+        d_allocator_p->deleteObject(cache);
+    }
 }
 
 // MANIPULATORS
@@ -115,19 +337,29 @@ CalendarCache::getCalendar(const char *calendarName)
     BSLS_ASSERT(calendarName);
 
     {
-        bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+        const Cache *cache;
+        const int    token = acquireSnapshot(&cache);
 
-        CacheIterator iter = d_cache.find(calendarName);
+        const CalendarCache_Entry *entry = findEntry(cache, calendarName);
 
-        if (iter != d_cache.end()) {
-            if (   !d_hasTimeOutFlag
-                || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-                return iter->second.get();                            // RETURN
-            }
-            else {
-                d_cache.erase(iter);
+        if (entry && !hasExpired(*entry)) {
+            bsl::shared_ptr<const Calendar> calendar = entry->get();
+
+            const bool isReloadNeeded =
+                      e_RELOAD_IN_BACKGROUND == d_reloadMode
+                   && d_reloadAge <= CurrentTime::utc() - entry->loadTime()
+                   && entry->requestReload();
+
+            d_readers.release(token);
+
+            if (isReloadNeeded) {
+                d_reloader.requestReload(calendarName);
             }
+
+            return calendar;                                          // RETURN
         }
+
+        d_readers.release(token);
     }
 
     // Load calendar identified by 'calendarName'.
@@ -152,18 +384,19 @@ CalendarCache::getCalendar(const char *calendarName)
 
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    ConstCacheIterator iter = d_cache.find(calendarName);
-
     // Here, we assume that the time elapsed between the last check and the
     // loading of the calendar is insignificant compared to the timeout, so we
-    // will simply return the entry in the cache if it has been inserted by
-    // another thread.
+    // will simply return the entry in the cache if it has been (re)loaded by
+    // another thread and has not expired.
+
+    const CalendarCache_Entry *cached = findEntry(d_cache_p.loadRelaxed(),
+                                                  calendarName);
 
-    if (iter != d_cache.end()) {
-        return iter->second.get();                                    // RETURN
+    if (cached && !hasExpired(*cached)) {
+        return cached->get();                                         // RETURN
     }
 
-    d_cache[calendarName] = entry;
+    insertEntry(calendarName, entry, cached);
 
     return entry.get();
 }
@@ -174,24 +407,52 @@ int CalendarCache::invalidate(const char *calendarName)
 
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    CacheIterator iter = d_cache.find(calendarName);
+    const Cache *cache = d_cache_p.loadRelaxed();
 
-    if (iter != d_cache.end()) {
-        d_cache.erase(iter);
+    if (!findEntry(cache, calendarName)) {
+        return 0;                                                     // RETURN
+    }
+
+    Cache *newCache = 0;
+
+    if (1 < cache->size()) {
+        newCache = new (*d_allocator_p) Cache(d_allocator_p);
+
+        bslma::RawDeleterProctor<Cache, bslma::Allocator> proctor(
+                                                                newCache,
+                                                                d_allocator_p);
+
+        newCache->reserve(cache->size() - 1);
+
+        for (Cache::const_iterator iter = cache->begin();
+             iter != cache->end();
+             ++iter) {
+            if (iter->first != calendarName) {
+                newCache->push_back(*iter);
+            }
+        }
 
-        return 1;                                                     // RETURN
+        proctor.release();
     }
 
-    return 0;
+    publish(newCache);
+
+    return 1;
 }
 
 int CalendarCache::invalidateAll()
 {
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    const int numInvalidated = static_cast<int>(d_cache.size());
+    const Cache *cache = d_cache_p.loadRelaxed();
+
+    if (0 == cache) {
+        return 0;                                                     // RETURN
+    }
+
+    const int numInvalidated = static_cast<int>(cache->size());
 
-    d_cache.clear();
+    publish(0);
 
     return numInvalidated;
 }
@@ -202,42 +463,40 @@ CalendarCache::lookupCalendar(const char *calendarName) const
 {
     BSLS_ASSERT(calendarName);
 
-    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+    bsl::shared_ptr<const Calendar> calendar;
 
-    CacheIterator iter = d_cache.find(calendarName);
+    const Cache *cache;
+    const int    token = acquireSnapshot(&cache);
 
-    if (iter != d_cache.end()) {
-        if (   !d_hasTimeOutFlag
-            || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-            return iter->second.get();                                // RETURN
-        }
-        else {
-            d_cache.erase(iter);
-        }
+    const CalendarCache_Entry *entry = findEntry(cache, calendarName);
+
+    if (entry && !hasExpired(*entry)) {
+        calendar = entry->get();
     }
 
-    return bsl::shared_ptr<const Calendar>();
+    d_readers.release(token);
+
+    return calendar;
 }
 
 Datetime CalendarCache::lookupLoadTime(const char *calendarName) const
 {
     BSLS_ASSERT(calendarName);
 
-    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+    Datetime loadTime;
 
-    CacheIterator iter = d_cache.find(calendarName);
+    const Cache *cache;
+    const int    token = acquireSnapshot(&cache);
 
-    if (iter != d_cache.end()) {
-        if (   !d_hasTimeOutFlag
-            || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-            return iter->second.loadTime();                           // RETURN
-        }
-        else {
-            d_cache.erase(iter);
-        }
+    const CalendarCache_Entry *entry = findEntry(cache, calendarName);
+
+    if (entry && !hasExpired(*entry)) {
+        loadTime = entry->loadTime();
     }
 
-    return Datetime();
+    d_readers.release(token);
+
+    return loadTime;
 }
 
 }  // close package namespace
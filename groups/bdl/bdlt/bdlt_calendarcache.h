@@ -54,6 +54,46 @@ BSLS_IDENT("$Id: $")
 // 'bsl::shared_ptr<const bdlt::Calendar>' is returned if the requested
 // calendar is found to have expired.
 //
+///Lock-Free Retrieval
+///-------------------
+// Calendars are loaded and invalidated rarely, and retrieved very frequently,
+// often from many threads at once.  Retrieving a calendar that is present in
+// the cache, and has not expired, therefore takes no lock: the cache
+// publishes, through an atomic pointer, an immutable snapshot of its
+// calendars, sorted by name, that 'getCalendar', 'lookupCalendar', and
+// 'lookupLoadTime' search without modifying it.
+//
+// Loading, reloading, and invalidating calendars are serialized by a mutex
+// that retrievals never acquire.  A calendar is loaded without holding that
+// mutex; the snapshot is then copied, modified, and published in place of the
+// current one.  The thread that publishes a snapshot waits until no thread can
+// still be searching the snapshot it replaced before destroying it, which
+// releases the references it holds to invalidated and expired calendars.
+// Each retrieval announces itself by incrementing the reader count of the
+// current "epoch" in a cache-line-sized *reader* *slot* assigned to the
+// calling thread; the cache has one such slot for each of up to twice as many
+// threads as there are hardware threads, so that retrievals on different
+// threads do not write to the same cache line.  Publishing a snapshot
+// switches the epoch, and waits, scanning every slot, only for the readers of
+// the previous epoch, whose searches take a few comparisons.  Note that, since
+// calendars are returned by shared pointer, a retrieval also modifies the
+// reference count of the calendar it returns.
+//
+///Background Reloading
+///--------------------
+// A cache having a timeout can be constructed to reload its calendars in the
+// background ('e_RELOAD_IN_BACKGROUND').  In that mode, a 'getCalendar' call
+// that finds its calendar in the cache, loaded at least half the timeout ago,
+// returns that calendar at once and requests that it be reloaded by a thread
+// owned by the cache, which is created on the first such request.  Once
+// loaded, the new calendar replaces the old one in the cache, so that a
+// calendar that is retrieved regularly is reloaded before it expires, and
+// 'getCalendar' rarely has to load it.  A calendar is reloaded at most once
+// per load, and a calendar that is invalidated, or reloaded by 'getCalendar',
+// while its background reload is in progress is left as is.  If the loader
+// fails, the calendar is left in the cache until it expires.  Note that
+// 'lookupCalendar' and 'lookupLoadTime' never request a reload.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlt::CalendarCache' class is fully thread-safe (see 'bsldoc_glossary')
@@ -246,6 +286,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlt_cacheimp.h>
 #include <bdlt_calendar.h>
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
@@ -257,11 +298,13 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_mutex.h>
 
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 
-#include <bsl_map.h>
 #include <bsl_memory.h>  // 'bsl::shared_ptr'
 #include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -273,18 +316,19 @@ namespace bdlt {
 
 class CalendarLoader;
 class CalendarCache_Entry;
+struct CalendarCache_Reload;
 
                         // =========================
                         // class CalendarCache_Entry
                         // =========================
 
-// IMPLEMENTATION NOTE: The Sun Studio 12.3 compiler does not support 'map's
-// holding types that are incomplete at the point of declaration of a data
-// member.  Other compilers allow us to complete 'CalendarCache_Entry' at a
-// later point in the code, but before any operation (such as 'insert') that
-// would require the type to be complete.  If we did not have to support this
-// compiler, this whole class could be defined in the .cpp file; as it stands,
-// it *must* be defined before class 'CalendarCache'.
+// IMPLEMENTATION NOTE: The Sun Studio 12.3 compiler does not support
+// containers holding types that are incomplete at the point of declaration of
+// a data member.  Other compilers allow us to complete 'CalendarCache_Entry'
+// at a later point in the code, but before any operation (such as 'insert')
+// that would require the type to be complete.  If we did not have to support
+// this compiler, this whole class could be defined in the .cpp file; as it
+// stands, it *must* be defined before class 'CalendarCache'.
 
 class CalendarCache_Entry {
     // This class defines the type of objects that are inserted into the
@@ -299,6 +343,11 @@ class CalendarCache_Entry {
     Datetime                        d_loadTime;  // time when calendar was
                                                  // loaded
 
+    mutable bsls::AtomicBool        d_isReloadRequested;
+                                                 // 'true' if a background
+                                                 // reload of the calendar has
+                                                 // been requested
+
   public:
     // CREATORS
     CalendarCache_Entry();
@@ -331,9 +380,20 @@ class CalendarCache_Entry {
         // Return a shared pointer providing non-modifiable access to the
         // calendar referred to by this cache entry object.
 
+    bool isReloadRequested() const;
+        // Return 'true' if a background reload of the calendar referred to by
+        // this cache entry object has been requested, and 'false' otherwise.
+
     Datetime loadTime() const;
         // Return the time at which the calendar referred to by this cache
         // entry object was loaded.
+
+    bool requestReload() const;
+        // Record that a background reload of the calendar referred to by this
+        // cache entry object has been requested.  Return 'true' if no such
+        // reload had been requested before this call, and 'false' otherwise.
+        // Note that this method may be called on an entry of a published
+        // snapshot.
 };
 
                            // ===================
@@ -360,31 +420,115 @@ class CalendarCache {
     //
     // This class is fully thread-safe (see 'bsldoc_glossary').
 
+  public:
+    // TYPES
+    enum ReloadMode {
+        // Enumerate the ways in which expiring calendars are reloaded.
+
+        e_RELOAD_ON_DEMAND,     // an expired calendar is reloaded by the
+                                // 'getCalendar' call that finds it expired
+
+        e_RELOAD_IN_BACKGROUND  // in addition, a calendar retrieved by
+                                // 'getCalendar' in the second half of its
+                                // lifetime is reloaded by a background thread
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::pair<bsl::string, CalendarCache_Entry> CacheEntry;
+
+    typedef bsl::vector<CacheEntry>                     Cache;
+        // A snapshot of the cache: (name, handle) pairs sorted by name, that
+        // are not modified once the snapshot is published.
+
     // DATA
-    mutable bsl::map<bsl::string, CalendarCache_Entry>
-                            d_cache;           // cache of (name, handle) pairs
+    bsls::AtomicPointer<Cache>     d_cache_p;         // current snapshot, or
+                                                      // 0 if the cache is
+                                                      // empty (owned)
 
-    CalendarLoader         *d_loader_p;        // calendar loader (held, not
-                                               // owned)
+    mutable CacheImp_ReaderEpochs  d_readers;         // counts the threads
+                                                      // searching a snapshot
 
-    DatetimeInterval        d_timeOut;         // timeout value; ignored unless
-                                               // 'd_hasTimeOutFlag' is 'true'
+    CalendarLoader                *d_loader_p;        // calendar loader
+                                                      // (held, not owned)
 
-    bool                    d_hasTimeOutFlag;  // 'true' if this cache has a
-                                               // timeout value and 'false'
-                                               // otherwise
+    DatetimeInterval               d_timeOut;         // timeout value;
+                                                      // ignored unless
+                                                      // 'd_hasTimeOutFlag' is
+                                                      // 'true'
 
-    mutable bslmt::Mutex    d_lock;            // guard access to cache
+    DatetimeInterval               d_reloadAge;       // age at which
+                                                      // 'getCalendar'
+                                                      // requests a
+                                                      // background reload;
+                                                      // ignored unless
+                                                      // reloading in the
+                                                      // background
 
-    bslma::Allocator       *d_allocator_p;     // memory allocator (held, not
-                                               // owned)
+    bool                           d_hasTimeOutFlag;  // 'true' if this cache
+                                                      // has a timeout value
+                                                      // and 'false' otherwise
 
-  private:
-    // PRIVATE TYPES
-    typedef bsl::map<bsl::string, CalendarCache_Entry>::iterator CacheIterator;
+    ReloadMode                     d_reloadMode;      // how expiring
+                                                      // calendars are
+                                                      // reloaded
 
-    typedef bsl::map<bsl::string, CalendarCache_Entry>::const_iterator
-                                                            ConstCacheIterator;
+    bslmt::Mutex                   d_lock;            // serializes
+                                                      // modifications of the
+                                                      // cache
+
+    CacheImp_Reloader              d_reloader;        // reloads calendars in
+                                                      // the background
+
+    bslma::Allocator              *d_allocator_p;     // memory allocator
+                                                      // (held, not owned)
+
+    // FRIENDS
+    friend struct CalendarCache_Reload;
+
+  private:
+    // PRIVATE CLASS METHODS
+    static const CalendarCache_Entry *findEntry(const Cache *cache,
+                                                const char  *calendarName);
+        // Return the address of the entry having the specified 'calendarName'
+        // in the specified 'cache', and 0 if 'cache' is 0 or has no such
+        // entry.
+
+    // PRIVATE MANIPULATORS
+    void insertEntry(const char                 *calendarName,
+                     const CalendarCache_Entry&  entry,
+                     const CalendarCache_Entry  *cached);
+        // Publish a copy of the current snapshot of this object in which the
+        // specified 'entry' is associated with the specified 'calendarName',
+        // replacing the specified 'cached' entry unless 'cached' is 0.  The
+        // behavior is undefined unless 'd_lock' is held by the calling thread,
+        // and 'cached' is the address of the entry having 'calendarName' in
+        // the current snapshot, or 0 if there is no such entry.
+
+    void publish(Cache *cache);
+        // Make the specified 'cache' the current snapshot of this object, and
+        // destroy the snapshot it replaces once no thread can be searching
+        // that snapshot.  The behavior is undefined unless 'd_lock' is held by
+        // the calling thread, and 'cache' is 0 or was allocated using the
+        // allocator of this object.
+
+    void reload(const char *calendarName);
+        // Load the calendar having the specified 'calendarName', and replace
+        // the entry having 'calendarName' in this cache with the loaded
+        // calendar if a background reload of that entry has been requested.
+        // If the loader fails, or if that entry has been invalidated or
+        // replaced since the request, this method has no effect.
+
+    // PRIVATE ACCESSORS
+    int acquireSnapshot(const Cache **cache) const;
+        // Load into the specified 'cache' the current snapshot of this object,
+        // which remains valid until 'd_readers.release' is called with the
+        // returned token.
+
+    bool hasExpired(const CalendarCache_Entry& entry) const;
+        // Return 'true' if this cache has a timeout, and the calendar
+        // referred to by the specified 'entry' was loaded at least that
+        // timeout ago, and 'false' otherwise.
 
   private:
     // NOT IMPLEMENTED
@@ -422,8 +566,25 @@ class CalendarCache {
         // loaded into the cache by *each* (successful) call to the
         // 'getCalendar' method.
 
+    CalendarCache(CalendarLoader            *loader,
+                  const bsls::TimeInterval&  timeout,
+                  ReloadMode                 reloadMode,
+                  bslma::Allocator          *basicAllocator = 0);
+        // Create an empty calendar cache that uses the specified 'loader' to
+        // load calendars on demand, has the specified 'timeout' interval
+        // indicating the length of time that calendars remain valid for
+        // subsequent retrieval from the cache after they have been loaded,
+        // and reloads expiring calendars as indicated by the specified
+        // 'reloadMode' (see {Background Reloading}).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless
+        // 'bsls::TimeInterval() <= timeout <= bsls::TimeInterval(INT_MAX, 0)',
+        // and 'loader' remains valid throughout the lifetime of this cache.
+
     ~CalendarCache();
-        // Destroy this object.
+        // Destroy this object, after waiting for any background reload in
+        // progress to complete.
 
     // MANIPULATORS
     bsl::shared_ptr<const Calendar> getCalendar(const char *calendarName);
@@ -434,7 +595,10 @@ class CalendarCache {
         // the cache or if the calendar has expired (i.e., per a timeout
         // optionally supplied at construction).  If the loader fails, whether
         // in loading a calendar for the first time or in reloading a calendar
-        // that has expired, return an empty shared pointer.
+        // that has expired, return an empty shared pointer.  If this cache
+        // reloads calendars in the background, and the calendar in the cache
+        // was loaded at least half the timeout ago, also request that it be
+        // reloaded in the background (see {Background Reloading}).
 
     int invalidate(const char *calendarName);
         // Invalidate the calendar having the specified 'calendarName' in this
@@ -28,50 +28,43 @@ int CalendarUtil::addBusinessDaysIfValid(
         return e_OUT_OF_RANGE;                                        // RETURN
     }
 
-    unsigned int absNumBusDays = numBusinessDays >= 0
-                               ? numBusinessDays
-                               : -numBusinessDays;
-
-    // declare forward and reverse iterators
-
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
+    if (0 == numBusinessDays && calendar.isBusinessDay(original)) {
+        *result = original;
+        return e_SUCCESS;                                             // RETURN
+    }
 
-    if (numBusinessDays < 0) {
-        // an iterator to the business day on or before original
+    // The result is the 'abs(numBusinessDays)'th business day after (or
+    // before) 'original', or, if 'numBusinessDays' is 0 (and 'original' is
+    // not a business day), the first business day after 'original'.
 
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
+    const unsigned int absNumBusDays = numBusinessDays >= 0
+                                     ? numBusinessDays
+                                     : 0u - numBusinessDays;
+    const unsigned int nth           = absNumBusDays ? absNumBusDays : 1;
 
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
+    if (nth > static_cast<unsigned int>(calendar.length())) {
+        return e_OUT_OF_RANGE;                                        // RETURN
+    }
 
-        if (rit == calendar.rendBusinessDays()) {
+    int rc;
+    if (numBusinessDays < 0) {
+        if (original == calendar.firstDate()) {
             return e_OUT_OF_RANGE;                                    // RETURN
         }
-
-        *result = *rit;
+        rc = calendar.getPreviousBusinessDay(result,
+                                             original,
+                                             static_cast<int>(nth));
     }
     else {
-        // an iterator to the business day on or after 'original'
-
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
-
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
-
-        if (fit == calendar.endBusinessDays()) {
+        if (original == calendar.lastDate()) {
             return e_OUT_OF_RANGE;                                    // RETURN
         }
-
-        *result = *fit;
+        rc = calendar.getNextBusinessDay(result,
+                                         original,
+                                         static_cast<int>(nth));
     }
 
-    return e_SUCCESS;
+    return rc ? e_OUT_OF_RANGE : e_SUCCESS;
 }
 
 int CalendarUtil::nthBusinessDayOfMonthOrMaxIfValid(
@@ -98,66 +91,44 @@ int CalendarUtil::nthBusinessDayOfMonthOrMaxIfValid(
         return e_OUT_OF_RANGE;                                        // RETURN
     }
 
-    bdlt::Date countStart = (n > 0 ? monthStart : monthEnd);
-
-    if (n < 0) {
-        // Create an iterator to the business day on or before 'countStart'.
-
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                       calendar.rbeginBusinessDays(countStart);
-        ++n;
-
-        // The 'calendar' must have at least one business day in the specified
-        // month and the whole month must be in the valid range if the
-        // 'calendar'.
-
-        if (rit == calendar.rendBusinessDays() || *rit < monthStart) {
-            return e_NOT_FOUND;                                       // RETURN
-        }
-
-        while (n < 0) {
-            ++rit;
-
-            if (rit == calendar.rendBusinessDays() || *rit < monthStart ) {
-                --rit;
-                break;
-            }
-
-            ++n;
-        }
+    // The 'calendar' must have at least one business day in the specified
+    // month.  If the month has fewer than 'abs(n)' business days, the
+    // business day furthest from 'countStart' is chosen.
 
-        *result = *rit;
+    const int numMonthBusinessDays = calendar.numBusinessDays(monthStart,
+                                                              monthEnd);
+    if (0 == numMonthBusinessDays) {
+        return e_NOT_FOUND;                                           // RETURN
     }
-    else {
-        // Create an iterator to the business day on or after 'countStart'.
 
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                        calendar.beginBusinessDays(countStart);
-        --n;
-
-        // The 'calendar' must have at least one business day in the specified
-        // month and the whole month must be in the valid range if the
-        // 'calendar'.
-
-        if (fit == calendar.endBusinessDays() || *fit > monthEnd) {
-            return e_NOT_FOUND;                                       // RETURN
-        }
+    int nth = numMonthBusinessDays;
+    if (-numMonthBusinessDays < n && n < numMonthBusinessDays) {
+        nth = n > 0 ? n : -n;
+    }
 
-        while (n > 0) {
-            ++fit;
+    const bdlt::Date countStart = (n > 0 ? monthStart : monthEnd);
 
-            if (fit == calendar.endBusinessDays() || *fit > monthEnd) {
-                --fit;
-                break;
-            }
+    // 'countStart' is counted if it is a business day.  Since the month has
+    // at least 'nth' business days, the search does not leave the month.
 
-            --n;
-        }
+    const int numAfterStart = calendar.isBusinessDay(countStart)
+                            ? nth - 1
+                            : nth;
 
-        *result = *fit;
+    if (0 == numAfterStart) {
+        *result = countStart;
+        return e_SUCCESS;                                             // RETURN
     }
 
-    return e_SUCCESS;
+    const int rc = n > 0
+                 ? calendar.getNextBusinessDay(result,
+                                               countStart,
+                                               numAfterStart)
+                 : calendar.getPreviousBusinessDay(result,
+                                                   countStart,
+                                                   numAfterStart);
+
+    return rc ? e_NOT_FOUND : e_SUCCESS;
 }
 
 int CalendarUtil::shiftIfValid(bdlt::Date            *result,
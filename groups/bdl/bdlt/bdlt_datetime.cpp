@@ -4,13 +4,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlt_datetime_cpp,"$Id$ $CSID$")
 
+#include <bdlt_datetimeformatimputil.h>
+
 #include <bslim_printer.h>
 #include <bslmf_assert.h>
 #include <bsls_assert.h>
-#include <bsls_libraryfeatures.h>
-#include <bsls_platform.h>
 
-#include <bsl_cstdio.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
 
@@ -26,96 +25,6 @@ BSLS_IDENT_RCSID(bdlt_datetime_cpp,"$Id$ $CSID$")
 
 namespace BloombergLP {
 namespace bdlt {
-namespace {
-
-int printToBufferFormatted(char       *result,
-                           int         numBytes,
-                           const char *spec,
-                           int         day,
-                           const char *asciiMonth,
-                           int         year,
-                           int         hour,
-                           int         minute,
-                           int         second,
-                           int         microsecond,
-                           int         fractionalSecondPrecision)
-{
-
-#if defined(BSLS_LIBRARYFEATURES_HAS_C99_SNPRINTF)
-
-    return 0 == fractionalSecondPrecision
-           ? bsl::snprintf(result,
-                           numBytes,
-                           spec,
-                           day,
-                           asciiMonth,
-                           year,
-                           hour,
-                           minute,
-                           second)
-           : bsl::snprintf(result,
-                           numBytes,
-                           spec,
-                           day,
-                           asciiMonth,
-                           year,
-                           hour,
-                           minute,
-                           second,
-                           microsecond);
-#elif defined(BSLS_PLATFORM_CMP_MSVC)
-    // Windows uses a different variant of snprintf that does not necessarily
-    // null-terminate and returns -1 on overflow.
-
-    int numCharsWritten;
-    int rc;
-
-    if (0 == fractionalSecondPrecision) {
-        rc = _snprintf(result,
-                       numBytes,
-                       spec,
-                       day,
-                       asciiMonth,
-                       year,
-                       hour,
-                       minute,
-                       second);
-
-        // Format of 'bdlt::Datetime' has 18 characters if there are no
-        // fractional seconds.
-
-        numCharsWritten = 18;
-    }
-    else {
-        rc = _snprintf(result,
-                       numBytes,
-                       spec,
-                       day,
-                       asciiMonth,
-                       year,
-                       hour,
-                       minute,
-                       second,
-                       microsecond);
-
-        // Format of 'bdlt::Datetime' has 19 characters + fractional seconds.
-
-        numCharsWritten = 19 + fractionalSecondPrecision;
-    }
-
-    if ((0 > rc || rc == numBytes) && numBytes > 0) {
-        result[numBytes - 1] = '\0';  // Make sure to null-terminate on
-                                      // overflow.
-    }
-
-    return numCharsWritten;
-
-#else
-# error THIS CONFIGURATION DOES NOT SUPPORT 'snprintf'
-#endif
-}
-
-}  // close unnamed namespace
 
 // 'Datetime' is trivially copyable only if 'Date' and 'Time' are also
 // trivially copyable.  In the header we have stated unconditionally that
@@ -206,61 +115,33 @@ int Datetime::printToBuffer(char *result,
 
     getTime(&hour, &minute, &second, &millisecond, &microsecond);
 
-    int value;
-
-    switch (fractionalSecondPrecision) {
-      case 0: {
-        char spec[] = "%02d%s%04d_%02d:%02d:%02d";
-
-        return printToBufferFormatted(result,
-                                      numBytes,
-                                      spec,
-                                      day,
-                                      asciiMonth,
-                                      year,
-                                      hour,
-                                      minute,
-                                      second,
-                                      0,
-                                      0);                             // RETURN
-      } break;
-      case 1: {
-        value = millisecond / 100;
-      } break;
-      case 2: {
-        value = millisecond / 10 ;
-      } break;
-      case 3: {
-        value = millisecond;
-      } break;
-      case 4: {
-        value = millisecond * 10 + microsecond / 100;
-      } break;
-      case 5: {
-        value = millisecond * 100 + microsecond / 10;
-      } break;
-      default: {
-        value = millisecond * 1000 + microsecond;
-      } break;
-    }
-
-    char spec[] = "%02d%s%04d_%02d:%02d:%02d.%0Xd";
-
-    const int PRECISION_INDEX = sizeof spec - 3;
-
-    spec[PRECISION_INDEX] = static_cast<char>('0' + fractionalSecondPrecision);
-
-    return printToBufferFormatted(result,
-                                  numBytes,
-                                  spec,
-                                  day,
-                                  asciiMonth,
-                                  year,
-                                  hour,
-                                  minute,
-                                  second,
-                                  value,
-                                  fractionalSecondPrecision);
+    // Format into a local buffer, then copy (possibly truncating) into
+    // 'result'.
+
+    enum { k_BUFFER_LENGTH = sizeof "DDMONYYYY_hh:mm:ss.ffffff" - 1 };
+
+    char  buffer[k_BUFFER_LENGTH];
+    char *p = buffer;
+
+    p    = DatetimeFormatImpUtil::generateDigits(p, day, 2);
+    *p++ = asciiMonth[0];
+    *p++ = asciiMonth[1];
+    *p++ = asciiMonth[2];
+    p    = DatetimeFormatImpUtil::generateDigits(p, year, 4);
+    *p++ = '_';
+    p = DatetimeFormatImpUtil::generateTime(p,
+                                            hour,
+                                            minute,
+                                            second,
+                                            millisecond,
+                                            microsecond,
+                                            fractionalSecondPrecision);
+
+    return DatetimeFormatImpUtil::copyToBuffer(
+                                         result,
+                                         numBytes,
+                                         buffer,
+                                         static_cast<int>(p - buffer));
 }
 
 }  // close package namespace
@@ -0,0 +1,277 @@
+// bdlt_datetimeformatimputil.cpp                                     -*-C++-*-
+#include <bdlt_datetimeformatimputil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlt_datetimeformatimputil_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace bdlt {
+namespace {
+
+// Separator masks and separators of the groups of eight characters of the
+// layout "hh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}", the first character of a
+// group being in the least-significant byte.
+
+const bsls::Types::Uint64 k_TIME_MASK  = 0x0000ff0000ff0000ULL;
+const bsls::Types::Uint64 k_TIME_SEPS  = 0x00003a00003a0000ULL;
+                                                             // "hh:mm:ss"
+const bsls::Types::Uint64 k_MILLI_MASK = 0x000000ff0000ff00ULL;
+const bsls::Types::Uint64 k_MILLI_SEPS = 0x0000002e00003a00ULL;
+                                                             // "m:ss.sss"
+const bsls::Types::Uint64 k_MICRO_MASK = 0x000000000000ff00ULL;
+const bsls::Types::Uint64 k_MICRO_SEPS = 0x0000000000002e00ULL;
+                                                             // "s.ssssss"
+const bsls::Types::Uint64 k_ZONE_MASK  = 0x0000ff0000ff0000ULL;
+const bsls::Types::Uint64 k_ZONE_SEPS  = 0x00003a0000000000ULL;
+                                                             // "ss?hh:mm"
+
+}  // close unnamed namespace
+
+                        // ----------------------------
+                        // struct DatetimeFormatImpUtil
+                        // ----------------------------
+
+// PRIVATE CLASS DATA
+const char DatetimeFormatImpUtil::s_digitPairs[] = "00010203040506070809"
+                                                   "10111213141516171819"
+                                                   "20212223242526272829"
+                                                   "30313233343536373839"
+                                                   "40414243444546474849"
+                                                   "50515253545556575859"
+                                                   "60616263646566676869"
+                                                   "70717273747576777879"
+                                                   "80818283848586878889"
+                                                   "90919293949596979899";
+
+// CLASS METHODS
+int DatetimeFormatImpUtil::copyToBuffer(char       *result,
+                                        int         numBytes,
+                                        const char *string,
+                                        int         length)
+{
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(0 <= length);
+
+    if (0 < numBytes) {
+        const int numCopied = length < numBytes ? length : numBytes - 1;
+
+        bsl::memcpy(result, string, numCopied);
+        result[numCopied] = '\0';
+    }
+
+    return length;
+}
+
+char *DatetimeFormatImpUtil::generateTime(char *buffer,
+                                          int   hour,
+                                          int   minute,
+                                          int   second,
+                                          int   millisecond,
+                                          int   microsecond,
+                                          int   fractionalSecondPrecision)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= fractionalSecondPrecision     );
+    BSLS_ASSERT(     fractionalSecondPrecision <= 6);
+
+    char *p = buffer;
+
+    p    = generateDigits(p, hour, 2);
+    *p++ = ':';
+    p    = generateDigits(p, minute, 2);
+    *p++ = ':';
+    p    = generateDigits(p, second, 2);
+
+    if (0 < fractionalSecondPrecision) {
+        int value = millisecond * 1000 + microsecond;
+
+        for (int i = fractionalSecondPrecision; i < 6; ++i) {
+            value /= 10;
+        }
+
+        *p++ = '.';
+        p    = generateDigits(p, value, fractionalSecondPrecision);
+    }
+
+    return p;
+}
+
+bool DatetimeFormatImpUtil::parseTimeAndZone(int        *hour,
+                                             int        *minute,
+                                             int        *second,
+                                             int        *millisecond,
+                                             int        *microsecond,
+                                             int        *tzOffset,
+                                             const char *string,
+                                             int         length)
+{
+    BSLS_ASSERT(hour);
+    BSLS_ASSERT(minute);
+    BSLS_ASSERT(second);
+    BSLS_ASSERT(millisecond);
+    BSLS_ASSERT(microsecond);
+    BSLS_ASSERT(tzOffset);
+    BSLS_ASSERT(string);
+
+    enum { k_BASE_LENGTH = sizeof "hh:mm:ss" - 1 };
+
+    int numFractionDigits;
+    int zoneLength;
+
+    switch (length) {
+      case k_BASE_LENGTH: {
+        numFractionDigits = 0;
+        zoneLength        = 0;
+      } break;
+      case k_BASE_LENGTH + 1: {
+        numFractionDigits = 0;
+        zoneLength        = 1;
+      } break;
+      case k_BASE_LENGTH + 6: {
+        numFractionDigits = 0;
+        zoneLength        = 6;
+      } break;
+      case k_BASE_LENGTH + 4: {
+        numFractionDigits = 3;
+        zoneLength        = 0;
+      } break;
+      case k_BASE_LENGTH + 5: {
+        numFractionDigits = 3;
+        zoneLength        = 1;
+      } break;
+      case k_BASE_LENGTH + 10: {
+        numFractionDigits = 3;
+        zoneLength        = 6;
+      } break;
+      case k_BASE_LENGTH + 7: {
+        numFractionDigits = 6;
+        zoneLength        = 0;
+      } break;
+      case k_BASE_LENGTH + 8: {
+        numFractionDigits = 6;
+        zoneLength        = 1;
+      } break;
+      case k_BASE_LENGTH + 13: {
+        numFractionDigits = 6;
+        zoneLength        = 6;
+      } break;
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+
+    bsls::Types::Uint64 time;
+
+    if (!loadDigits(&time, string, k_TIME_MASK, k_TIME_SEPS)) {
+        return false;                                                 // RETURN
+    }
+
+    time = pairDigits(time);
+
+    const int hourValue   = byteAt(time, 0);
+    const int minuteValue = byteAt(time, 3);
+    const int secondValue = byteAt(time, 6);
+
+    // The hour 24 and leap seconds are left to the caller.
+
+    if (hourValue > 23 || secondValue > 59) {
+        return false;                                                 // RETURN
+    }
+
+    int millisecondValue = 0;
+    int microsecondValue = 0;
+
+    if (3 == numFractionDigits) {
+        bsls::Types::Uint64 fraction;
+
+        if (!loadDigits(&fraction,
+                        string + k_BASE_LENGTH - 4,
+                        k_MILLI_MASK,
+                        k_MILLI_SEPS)) {
+            return false;                                             // RETURN
+        }
+        millisecondValue = byteAt(pairDigits(fraction), 5) * 10
+                         + byteAt(fraction, 7);
+    }
+    else if (6 == numFractionDigits) {
+        bsls::Types::Uint64 fraction;
+
+        if (!loadDigits(&fraction,
+                        string + k_BASE_LENGTH - 1,
+                        k_MICRO_MASK,
+                        k_MICRO_SEPS)) {
+            return false;                                             // RETURN
+        }
+        fraction = pairDigits(fraction);
+
+        const int value = byteAt(fraction, 2) * 10000
+                        + byteAt(fraction, 4) * 100
+                        + byteAt(fraction, 6);
+
+        millisecondValue = value / 1000;
+        microsecondValue = value % 1000;
+    }
+
+    int tzOffsetValue = 0;
+
+    if (1 == zoneLength) {
+        if ('Z' != string[length - 1]) {
+            return false;                                             // RETURN
+        }
+    }
+    else if (6 == zoneLength) {
+        const char sign = string[length - 6];
+
+        bsls::Types::Uint64 zone;
+
+        if (('+' != sign && '-' != sign)
+         || !loadDigits(&zone,
+                        string + length - 8,
+                        k_ZONE_MASK,
+                        k_ZONE_SEPS | static_cast<bsls::Types::Uint64>(sign)
+                                                                     << 16)) {
+            return false;                                             // RETURN
+        }
+        zone = pairDigits(zone);
+
+        const int zoneHour   = byteAt(zone, 3);
+        const int zoneMinute = byteAt(zone, 6);
+
+        if (zoneHour > 23 || zoneMinute > 59) {
+            return false;                                             // RETURN
+        }
+        tzOffsetValue = zoneHour * 60 + zoneMinute;
+
+        if ('-' == sign) {
+            tzOffsetValue = -tzOffsetValue;
+        }
+    }
+
+    *hour        = hourValue;
+    *minute      = minuteValue;
+    *second      = secondValue;
+    *millisecond = millisecondValue;
+    *microsecond = microsecondValue;
+    *tzOffset    = tzOffsetValue;
+
+    return true;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,290 @@
+// bdlt_datetimeformatimputil.h                                       -*-C++-*-
+#ifndef INCLUDED_BDLT_DATETIMEFORMATIMPUTIL
+#define INCLUDED_BDLT_DATETIMEFORMATIMPUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide low-level functions for formatting and parsing datetimes.
+//
+//@CLASSES:
+//  bdlt::DatetimeFormatImpUtil: namespace for datetime text primitives
+//
+//@SEE_ALSO: bdlt_iso8601util, bdlt_fixutil
+//
+//@DESCRIPTION: This component implements a utility 'struct',
+// 'bdlt::DatetimeFormatImpUtil', that provides a namespace for the low-level
+// functions shared by the components that convert 'bdlt' date and time values
+// to and from text (e.g., 'bdlt_iso8601util', 'bdlt_fixutil', and the
+// 'printToBuffer' methods of 'bdlt::Datetime' and 'bdlt::Time').  This
+// component is intended for use only by those components.
+//
+///Parsing Eight Characters at a Time
+///----------------------------------
+// The most common textual layouts of a datetime consist of fixed-width fields
+// of digits separated by fixed characters.  Such text can be parsed eight
+// characters at a time: 'loadDigits' loads eight characters into a 64-bit
+// word, the first character being in the least-significant byte, compares
+// the bytes selected by a mask with the separators of the layout, and
+// verifies, with a few arithmetic operations, that the other bytes are
+// decimal digits.  'pairDigits' then converts every pair of adjacent digits to
+// its two-digit value in one multiplication, and 'byteAt' extracts the value
+// of a field.  'parseTimeAndZone' applies this technique to the
+// "hh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}" suffix common to the ISO 8601 and
+// FIX datetime layouts.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing and Generating a Date
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to parse a date in the layout "YYYY-MM-DD".  First, we
+// load the first eight characters, verifying that those at indices 4 and 7
+// are '-' and that the others are digits:
+//..
+//  const char *string = "2024-07-15";
+//
+//  bsls::Types::Uint64 word;
+//  bool                isValid = bdlt::DatetimeFormatImpUtil::loadDigits(
+//                                                      &word,
+//                                                      string,
+//                                                      0xff0000ff00000000ULL,
+//                                                      0x2d00002d00000000ULL);
+//  assert(isValid);
+//..
+// Next, we pair the digits, and extract the year and the month:
+//..
+//  word = bdlt::DatetimeFormatImpUtil::pairDigits(word);
+//
+//  const int year  = bdlt::DatetimeFormatImpUtil::byteAt(word, 0) * 100
+//                  + bdlt::DatetimeFormatImpUtil::byteAt(word, 2);
+//  const int month = bdlt::DatetimeFormatImpUtil::byteAt(word, 5);
+//
+//  assert(2024 == year);
+//  assert(   7 == month);
+//..
+// Finally, we generate the year, padded to four digits, into a buffer:
+//..
+//  char  buffer[4];
+//  char *end = bdlt::DatetimeFormatImpUtil::generateDigits(buffer, year, 4);
+//
+//  assert(buffer + 4 == end);
+//  assert(0 == bsl::memcmp(buffer, "2024", 4));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdlt {
+
+                        // ============================
+                        // struct DatetimeFormatImpUtil
+                        // ============================
+
+struct DatetimeFormatImpUtil {
+    // This 'struct' provides a namespace for a suite of functions used to
+    // format and parse the textual representations of date and time values.
+
+  private:
+    // PRIVATE CLASS DATA
+    static const char s_digitPairs[];  // "00", "01", ..., "99", concatenated
+
+  public:
+    // CLASS METHODS
+    static int byteAt(bsls::Types::Uint64 word, int index);
+        // Return the value of the byte at the specified 'index' of the
+        // specified 'word', where the byte at index 0 is the least-significant
+        // byte.  The behavior is undefined unless '0 <= index < 8'.
+
+    static int copyToBuffer(char       *result,
+                            int         numBytes,
+                            const char *string,
+                            int         length);
+        // Copy, to the specified 'result' buffer of the specified 'numBytes'
+        // size, as many of the characters of the specified 'string' having
+        // the specified 'length' as fit along with a null terminator,
+        // null-terminate 'result' if '0 < numBytes', and return 'length'.
+        // The behavior is undefined unless '0 <= numBytes' and
+        // '0 <= length'.
+
+    static char *generateDigits(char *buffer, int value, int numDigits);
+        // Write, to the specified 'buffer', the decimal representation of the
+        // specified 'value' padded with leading zeros to the specified
+        // 'numDigits', and return the address one past the last character
+        // written.  'buffer' is NOT null-terminated.  The behavior is
+        // undefined unless '0 <= value', '0 <= numDigits', and 'buffer' has
+        // sufficient capacity to hold 'numDigits' characters.  Note that if
+        // the decimal representation of 'value' has more than 'numDigits'
+        // digits, only the low-order 'numDigits' digits are written.
+
+    static char *generateTime(char *buffer,
+                              int   hour,
+                              int   minute,
+                              int   second,
+                              int   millisecond,
+                              int   microsecond,
+                              int   fractionalSecondPrecision);
+        // Write, to the specified 'buffer', the time having the specified
+        // 'hour', 'minute', 'second', 'millisecond', and 'microsecond' in the
+        // layout "hh:mm:ss", followed, if the specified
+        // 'fractionalSecondPrecision' is positive, by '.' and the
+        // 'fractionalSecondPrecision' most-significant digits of the
+        // fractional second, and return the address one past the last
+        // character written.  'buffer' is NOT null-terminated.  The behavior
+        // is undefined unless each value is valid for a 'bdlt::Time',
+        // '0 <= fractionalSecondPrecision <= 6', and 'buffer' has sufficient
+        // capacity to hold 'sizeof "hh:mm:ss.ffffff" - 1' characters.
+
+    static bool loadDigits(bsls::Types::Uint64 *digits,
+                           const char          *begin,
+                           bsls::Types::Uint64  separatorMask,
+                           bsls::Types::Uint64  separators);
+        // Load, into the specified 'digits', the word whose byte 'i' is the
+        // value of the digit at 'begin[i]', or 0 if 'begin[i]' is a
+        // separator, and return 'true' if the bytes of the 8 characters
+        // starting at the specified 'begin' that are selected by the
+        // specified 'separatorMask' are those of the specified 'separators',
+        // and the other characters are decimal digits; otherwise, return
+        // 'false' with no effect on 'digits'.  The behavior is undefined
+        // unless 'begin' refers to at least 8 characters.
+
+    static bsls::Types::Uint64 pairDigits(bsls::Types::Uint64 digits);
+        // Return the word whose byte 'i' is the value of the two-digit number
+        // whose digits are the bytes 'i' and 'i + 1' of the specified
+        // 'digits'.  The behavior is undefined unless each byte of 'digits'
+        // is less than 10.
+
+    static bool parseTimeAndZone(int        *hour,
+                                 int        *minute,
+                                 int        *second,
+                                 int        *millisecond,
+                                 int        *microsecond,
+                                 int        *tzOffset,
+                                 const char *string,
+                                 int         length);
+        // If the specified 'string' having the specified 'length' has the
+        // layout "hh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}", its hour is in the
+        // range '[0 .. 23]', its second is in the range '[0 .. 59]', and its
+        // zone designator (if any) is in the range '[-23:59 .. +23:59]', load
+        // the represented values into the specified 'hour', 'minute',
+        // 'second', 'millisecond', 'microsecond', and 'tzOffset' (in minutes,
+        // 0 if there is no zone designator) and return 'true'; otherwise,
+        // return 'false' with no effect.  Note that the validity of 'minute'
+        // is not verified.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // struct DatetimeFormatImpUtil
+                        // ----------------------------
+
+// CLASS METHODS
+inline
+int DatetimeFormatImpUtil::byteAt(bsls::Types::Uint64 word, int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(     index < 8);
+
+    return static_cast<int>((word >> (8 * index)) & 0xff);
+}
+
+inline
+char *DatetimeFormatImpUtil::generateDigits(char *buffer,
+                                            int   value,
+                                            int   numDigits)
+{
+    BSLS_ASSERT_SAFE(buffer);
+    BSLS_ASSERT_SAFE(0 <= value);
+    BSLS_ASSERT_SAFE(0 <= numDigits);
+
+    char *p = buffer + numDigits;
+
+    // Write two digits at a time.
+
+    while (p - buffer >= 2) {
+        const char *pair = s_digitPairs + 2 * (value % 100);
+
+        *--p   = pair[1];
+        *--p   = pair[0];
+        value /= 100;
+    }
+
+    if (p > buffer) {
+        *--p = static_cast<char>('0' + value % 10);
+    }
+
+    return buffer + numDigits;
+}
+
+inline
+bool DatetimeFormatImpUtil::loadDigits(bsls::Types::Uint64 *digits,
+                                       const char          *begin,
+                                       bsls::Types::Uint64  separatorMask,
+                                       bsls::Types::Uint64  separators)
+{
+    BSLS_ASSERT_SAFE(digits);
+    BSLS_ASSERT_SAFE(begin);
+
+    const bsls::Types::Uint64 k_ZEROS = 0x3030303030303030ULL;  // "00000000"
+
+    bsls::Types::Uint64 word;
+    bsl::memcpy(&word, begin, sizeof word);
+    word = BSLS_BYTEORDER_LE_U64_TO_HOST(word);
+
+    if ((word & separatorMask) != separators) {
+        return false;                                                 // RETURN
+    }
+
+    word = (word & ~separatorMask) | (k_ZEROS & separatorMask);
+
+    // Every byte is a digit if and only if its high-order nibble is 3 both
+    // before and after adding 6.
+
+    if (((word & 0xf0f0f0f0f0f0f0f0ULL)
+       | (((word + 0x0606060606060606ULL) & 0xf0f0f0f0f0f0f0f0ULL) >> 4))
+                                                   != 0x3333333333333333ULL) {
+        return false;                                                 // RETURN
+    }
+
+    *digits = word - k_ZEROS;
+
+    return true;
+}
+
+inline
+bsls::Types::Uint64
+DatetimeFormatImpUtil::pairDigits(bsls::Types::Uint64 digits)
+{
+    return digits * 10 + (digits >> 8);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,937 @@
+// bdlt_datetimeformatimputil.t.cpp                                   -*-C++-*-
+#include <bdlt_datetimeformatimputil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a utility 'struct' of stateless
+// functions.  The word-level primitives ('byteAt', 'pairDigits', and
+// 'loadDigits') are verified against straightforward per-character
+// computations over every byte value at every position.  The generation
+// functions are verified against 'sprintf', and 'parseTimeAndZone' is verified
+// on a table of valid and invalid strings, and on every single-character
+// mutation of valid strings of each supported length.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] int byteAt(bsls::Types::Uint64 word, int index);
+// [ 1] bsls::Types::Uint64 pairDigits(bsls::Types::Uint64 digits);
+// [ 2] bool loadDigits(Uint64 *, const char *, Uint64, Uint64);
+// [ 3] char *generateDigits(char *buffer, int value, int numDigits);
+// [ 3] char *generateTime(char *, int, int, int, int, int, int);
+// [ 3] int copyToBuffer(char *, int, const char *, int);
+// [ 4] bool parseTimeAndZone(int *, ..., int *, const char *, int);
+// ----------------------------------------------------------------------------
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlt::DatetimeFormatImpUtil Util;
+typedef bsls::Types::Uint64         Uint64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+Uint64 loadWord(const char *begin)
+    // Return the word whose byte 'i' is the value of the specified 'begin[i]'
+    // for 'i' in '[0 .. 7]', the byte at index 0 being the least-significant
+    // byte.
+{
+    Uint64 word = 0;
+
+    for (int i = 7; 0 <= i; --i) {
+        word = (word << 8) | static_cast<unsigned char>(begin[i]);
+    }
+
+    return word;
+}
+
+bool isDigit(char c)
+    // Return 'true' if the specified 'c' is a decimal digit, and 'false'
+    // otherwise.
+{
+    return '0' <= c && c <= '9';
+}
+
+bool parseOracle(int         *hour,
+                 int         *minute,
+                 int         *second,
+                 int         *millisecond,
+                 int         *microsecond,
+                 int         *tzOffset,
+                 const char  *input,
+                 int          length)
+    // Parse, character by character, the specified 'input' having the
+    // specified 'length' as specified by 'Util::parseTimeAndZone', loading
+    // the specified 'hour', 'minute', 'second', 'millisecond', 'microsecond',
+    // and 'tzOffset' and returning 'true' on success, and returning 'false'
+    // (with unspecified effect on the outputs) otherwise.
+{
+    const bsl::string s(input, length);
+
+    if (length < 8
+     || !isDigit(s[0]) || !isDigit(s[1]) || ':' != s[2]
+     || !isDigit(s[3]) || !isDigit(s[4]) || ':' != s[5]
+     || !isDigit(s[6]) || !isDigit(s[7])) {
+        return false;                                                 // RETURN
+    }
+
+    *hour   = (s[0] - '0') * 10 + (s[1] - '0');
+    *minute = (s[3] - '0') * 10 + (s[4] - '0');
+    *second = (s[6] - '0') * 10 + (s[7] - '0');
+
+    if (*hour > 23 || *second > 59) {
+        return false;                                                 // RETURN
+    }
+
+    int pos = 8;
+
+    *millisecond = 0;
+    *microsecond = 0;
+
+    if (pos < length && '.' == s[pos]) {
+        int numDigits = 0;
+        int value     = 0;
+
+        ++pos;
+        while (pos < length && isDigit(s[pos])) {
+            value = value * 10 + (s[pos] - '0');
+            ++numDigits;
+            ++pos;
+        }
+
+        if (3 == numDigits) {
+            *millisecond = value;
+        }
+        else if (6 == numDigits) {
+            *millisecond = value / 1000;
+            *microsecond = value % 1000;
+        }
+        else {
+            return false;                                             // RETURN
+        }
+    }
+
+    *tzOffset = 0;
+
+    if (pos == length) {
+        return true;                                                  // RETURN
+    }
+
+    if ('Z' == s[pos]) {
+        return pos + 1 == length;                                     // RETURN
+    }
+
+    if (pos + 6 != length
+     || ('+' != s[pos] && '-' != s[pos])
+     || !isDigit(s[pos + 1]) || !isDigit(s[pos + 2]) || ':' != s[pos + 3]
+     || !isDigit(s[pos + 4]) || !isDigit(s[pos + 5])) {
+        return false;                                                 // RETURN
+    }
+
+    const int zoneHour   = (s[pos + 1] - '0') * 10 + (s[pos + 2] - '0');
+    const int zoneMinute = (s[pos + 4] - '0') * 10 + (s[pos + 5] - '0');
+
+    if (zoneHour > 23 || zoneMinute > 59) {
+        return false;                                                 // RETURN
+    }
+
+    *tzOffset = zoneHour * 60 + zoneMinute;
+    if ('-' == s[pos]) {
+        *tzOffset = -*tzOffset;
+    }
+
+    return true;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing and Generating a Date
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to parse a date in the layout "YYYY-MM-DD".  First, we
+// load the first eight characters, verifying that those at indices 4 and 7
+// are '-' and that the others are digits:
+//..
+    const char *string = "2024-07-15";
+
+    bsls::Types::Uint64 word;
+    bool                isValid = bdlt::DatetimeFormatImpUtil::loadDigits(
+                                                        &word,
+                                                        string,
+                                                        0xff0000ff00000000ULL,
+                                                        0x2d00002d00000000ULL);
+    ASSERT(isValid);
+//..
+// Next, we pair the digits, and extract the year and the month:
+//..
+    word = bdlt::DatetimeFormatImpUtil::pairDigits(word);
+
+    const int year  = bdlt::DatetimeFormatImpUtil::byteAt(word, 0) * 100
+                    + bdlt::DatetimeFormatImpUtil::byteAt(word, 2);
+    const int month = bdlt::DatetimeFormatImpUtil::byteAt(word, 5);
+
+    ASSERT(2024 == year);
+    ASSERT(   7 == month);
+//..
+// Finally, we generate the year, padded to four digits, into a buffer:
+//..
+    char  buffer[4];
+    char *end = bdlt::DatetimeFormatImpUtil::generateDigits(buffer, year, 4);
+
+    ASSERT(buffer + 4 == end);
+    ASSERT(0 == bsl::memcmp(buffer, "2024", 4));
+//..
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'parseTimeAndZone'
+        //
+        // Concerns:
+        //: 1 Every string of each supported layout having valid fields is
+        //:   parsed, and the parsed values are correct.
+        //:
+        //: 2 A string is rejected if its length is not that of a supported
+        //:   layout, if a separator is wrong, if a digit is not a digit, if
+        //:   the hour exceeds 23, if the second exceeds 59, or if the zone
+        //:   designator is out of range.
+        //:
+        //: 3 A rejected string has no effect on the outputs.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of valid and
+        //:   invalid strings, and verify the result and the outputs.  (C-1..3)
+        //:
+        //: 2 For a valid string of each supported length, and for each
+        //:   single-character mutation of it into every printable character,
+        //:   compare the result and the outputs with those of a
+        //:   character-by-character oracle.  (C-1..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointer arguments.  (C-4)
+        //
+        // Testing:
+        //   bool parseTimeAndZone(int *, ..., int *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'parseTimeAndZone'" << endl
+                          << "==================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input_p;
+            bool        d_isValid;
+            int         d_hour;
+            int         d_minute;
+            int         d_second;
+            int         d_millisecond;
+            int         d_microsecond;
+            int         d_tzOffset;
+        } DATA[] = {
+            //LN  INPUT                   VALID  HR  MN  SC   MS   US    TZ
+            //--  ----------------------  -----  --  --  --  ---  ---  ----
+            { L_, "00:00:00",              true,  0,  0,  0,   0,   0,    0 },
+            { L_, "23:59:59",              true, 23, 59, 59,   0,   0,    0 },
+            { L_, "12:34:56Z",             true, 12, 34, 56,   0,   0,    0 },
+            { L_, "12:34:56+01:30",        true, 12, 34, 56,   0,   0,   90 },
+            { L_, "12:34:56-23:59",        true, 12, 34, 56,   0,   0,-1439 },
+            { L_, "12:34:56.789",          true, 12, 34, 56, 789,   0,    0 },
+            { L_, "12:34:56.789Z",         true, 12, 34, 56, 789,   0,    0 },
+            { L_, "12:34:56.789-00:01",    true, 12, 34, 56, 789,   0,   -1 },
+            { L_, "12:34:56.123456",       true, 12, 34, 56, 123, 456,    0 },
+            { L_, "12:34:56.123456Z",      true, 12, 34, 56, 123, 456,    0 },
+            { L_, "12:34:56.000001+23:59", true, 12, 34, 56,   0,   1, 1439 },
+
+            // Minutes are not validated.
+
+            { L_, "12:99:56",              true, 12, 99, 56,   0,   0,    0 },
+
+            { L_, "24:00:00",             false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:60",             false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:56+24:00",       false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:56+01:60",       false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:5",              false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:56.7",           false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:56.78",          false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:56.7890",        false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:56,789",         false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:56z",            false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:56+0130",        false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:56*01:30",       false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12-34:56",             false,  0,  0,  0,   0,   0,    0 },
+            { L_, "1a:34:56",             false,  0,  0,  0,   0,   0,    0 },
+            { L_, "12:34:56.78a",         false,  0,  0,  0,   0,   0,    0 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        if (verbose) cout << "\nTable-driven test." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *INPUT  = DATA[ti].d_input_p;
+            const int   LENGTH = static_cast<int>(bsl::strlen(INPUT));
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            int hour = -1, minute = -1, second = -1;
+            int millisecond = -1, microsecond = -1, tzOffset = -1;
+
+            const bool rc = Util::parseTimeAndZone(&hour,
+                                                   &minute,
+                                                   &second,
+                                                   &millisecond,
+                                                   &microsecond,
+                                                   &tzOffset,
+                                                   INPUT,
+                                                   LENGTH);
+
+            ASSERTV(LINE, DATA[ti].d_isValid == rc);
+
+            if (rc) {
+                ASSERTV(LINE, DATA[ti].d_hour        == hour);
+                ASSERTV(LINE, DATA[ti].d_minute      == minute);
+                ASSERTV(LINE, DATA[ti].d_second      == second);
+                ASSERTV(LINE, DATA[ti].d_millisecond == millisecond);
+                ASSERTV(LINE, DATA[ti].d_microsecond == microsecond);
+                ASSERTV(LINE, DATA[ti].d_tzOffset    == tzOffset);
+            }
+            else {
+                ASSERTV(LINE, -1 == hour);
+                ASSERTV(LINE, -1 == minute);
+                ASSERTV(LINE, -1 == second);
+                ASSERTV(LINE, -1 == millisecond);
+                ASSERTV(LINE, -1 == microsecond);
+                ASSERTV(LINE, -1 == tzOffset);
+            }
+        }
+
+        if (verbose) cout << "\nSingle-character mutations." << endl;
+        {
+            static const char *const BASES[] = {
+                "12:34:56",
+                "12:34:56Z",
+                "12:34:56+01:30",
+                "12:34:56.789",
+                "12:34:56.789Z",
+                "12:34:56.789-01:30",
+                "12:34:56.123456",
+                "12:34:56.123456Z",
+                "12:34:56.123456+01:30",
+            };
+            const int NUM_BASES =
+                               static_cast<int>(sizeof BASES / sizeof *BASES);
+
+            for (int bi = 0; bi < NUM_BASES; ++bi) {
+                const int LENGTH = static_cast<int>(bsl::strlen(BASES[bi]));
+
+                for (int pos = 0; pos < LENGTH; ++pos) {
+                    for (int c = ' '; c <= '~'; ++c) {
+                        char input[32];
+
+                        bsl::strcpy(input, BASES[bi]);
+                        input[pos] = static_cast<char>(c);
+
+                        int hour, minute, second, millisecond, microsecond;
+                        int tzOffset;
+
+                        int eHour, eMinute, eSecond, eMillisecond;
+                        int eMicrosecond, eTzOffset;
+
+                        const bool rc = Util::parseTimeAndZone(&hour,
+                                                               &minute,
+                                                               &second,
+                                                               &millisecond,
+                                                               &microsecond,
+                                                               &tzOffset,
+                                                               input,
+                                                               LENGTH);
+
+                        const bool expected = u::parseOracle(&eHour,
+                                                             &eMinute,
+                                                             &eSecond,
+                                                             &eMillisecond,
+                                                             &eMicrosecond,
+                                                             &eTzOffset,
+                                                             input,
+                                                             LENGTH);
+
+                        ASSERTV(input, expected == rc);
+
+                        if (rc && expected) {
+                            ASSERTV(input, eHour        == hour);
+                            ASSERTV(input, eMinute      == minute);
+                            ASSERTV(input, eSecond      == second);
+                            ASSERTV(input, eMillisecond == millisecond);
+                            ASSERTV(input, eMicrosecond == microsecond);
+                            ASSERTV(input, eTzOffset    == tzOffset);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            int v;
+
+            ASSERT_PASS(Util::parseTimeAndZone(&v, &v, &v, &v, &v, &v,
+                                               "12:34:56", 8));
+            ASSERT_FAIL(Util::parseTimeAndZone( 0, &v, &v, &v, &v, &v,
+                                               "12:34:56", 8));
+            ASSERT_FAIL(Util::parseTimeAndZone(&v, &v, &v, &v, &v,  0,
+                                               "12:34:56", 8));
+            ASSERT_FAIL(Util::parseTimeAndZone(&v, &v, &v, &v, &v, &v,
+                                               0, 8));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // GENERATION FUNCTIONS
+        //
+        // Concerns:
+        //: 1 'generateDigits' writes exactly 'numDigits' characters, padding
+        //:   with leading zeros, keeps only the low-order digits of a value
+        //:   that is too wide, and returns the address one past the last
+        //:   character written.
+        //:
+        //: 2 'generateTime' writes "hh:mm:ss" followed by the requested
+        //:   number of most-significant digits of the fractional second.
+        //:
+        //: 3 'copyToBuffer' copies as many characters as fit along with a
+        //:   null terminator, writes nothing if the buffer is empty, and
+        //:   returns the length of the string.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For values spanning every number of digits and for every padded
+        //:   width up to 9, compare the output of 'generateDigits' with that
+        //:   of 'sprintf', and verify that the byte past the output is
+        //:   unchanged.  (C-1)
+        //:
+        //: 2 For a set of times and every precision, compare the output of
+        //:   'generateTime' with that of 'sprintf'.  (C-2)
+        //:
+        //: 3 For every buffer size from 0 to one more than the length of a
+        //:   string, verify the contents of the buffer and the returned
+        //:   value of 'copyToBuffer'.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   char *generateDigits(char *buffer, int value, int numDigits);
+        //   char *generateTime(char *, int, int, int, int, int, int);
+        //   int copyToBuffer(char *, int, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GENERATION FUNCTIONS" << endl
+                          << "====================" << endl;
+
+        if (verbose) cout << "\nTesting 'generateDigits'." << endl;
+        {
+            static const int VALUES[] = {
+                0, 1, 9, 10, 42, 99, 100, 999, 1000, 2024, 9999, 10000,
+                123456, 999999, 1000000, 12345678, 123456789
+            };
+            const int NUM_VALUES =
+                             static_cast<int>(sizeof VALUES / sizeof *VALUES);
+
+            for (int vi = 0; vi < NUM_VALUES; ++vi) {
+                const int VALUE = VALUES[vi];
+
+                for (int numDigits = 0; numDigits <= 9; ++numDigits) {
+                    char expected[32];
+                    char buffer[32];
+
+                    bsl::sprintf(expected, "%09d", VALUE);
+
+                    bsl::memset(buffer, '#', sizeof buffer);
+
+                    char *end = Util::generateDigits(buffer,
+                                                     VALUE,
+                                                     numDigits);
+
+                    ASSERTV(VALUE, numDigits, buffer + numDigits == end);
+                    ASSERTV(VALUE, numDigits, '#' == buffer[numDigits]);
+                    ASSERTV(VALUE,
+                            numDigits,
+                            0 == bsl::memcmp(buffer,
+                                             expected + 9 - numDigits,
+                                             numDigits));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'generateTime'." << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_hour;
+                int d_minute;
+                int d_second;
+                int d_millisecond;
+                int d_microsecond;
+            } DATA[] = {
+                //LN  HR  MN  SC   MS   US
+                //--  --  --  --  ---  ---
+                { L_,  0,  0,  0,   0,   0 },
+                { L_,  1,  2,  3,   4,   5 },
+                { L_, 12, 34, 56, 789, 123 },
+                { L_, 23, 59, 59, 999, 999 },
+                { L_, 24,  0,  0,   0,   0 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+                const int HR   = DATA[ti].d_hour;
+                const int MN   = DATA[ti].d_minute;
+                const int SC   = DATA[ti].d_second;
+                const int MS   = DATA[ti].d_millisecond;
+                const int US   = DATA[ti].d_microsecond;
+
+                for (int precision = 0; precision <= 6; ++precision) {
+                    char expected[32];
+                    char buffer[32];
+
+                    int length = bsl::sprintf(expected,
+                                              "%02d:%02d:%02d.%06d",
+                                              HR,
+                                              MN,
+                                              SC,
+                                              MS * 1000 + US);
+
+                    length -= 0 == precision ? 7 : 6 - precision;
+
+                    char *end = Util::generateTime(buffer,
+                                                   HR,
+                                                   MN,
+                                                   SC,
+                                                   MS,
+                                                   US,
+                                                   precision);
+
+                    ASSERTV(LINE, precision, buffer + length == end);
+                    ASSERTV(LINE,
+                            precision,
+                            0 == bsl::memcmp(buffer, expected, length));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'copyToBuffer'." << endl;
+        {
+            const char *STRING = "12:34:56.789";
+            const int   LENGTH = static_cast<int>(bsl::strlen(STRING));
+
+            for (int numBytes = 0; numBytes <= LENGTH + 1; ++numBytes) {
+                char buffer[32];
+
+                bsl::memset(buffer, '#', sizeof buffer);
+
+                ASSERTV(numBytes,
+                        LENGTH == Util::copyToBuffer(buffer,
+                                                     numBytes,
+                                                     STRING,
+                                                     LENGTH));
+
+                if (0 == numBytes) {
+                    ASSERTV('#' == buffer[0]);
+                    continue;
+                }
+
+                const int numCopied = numBytes <= LENGTH
+                                    ? numBytes - 1
+                                    : LENGTH;
+
+                ASSERTV(numBytes, 0 == bsl::memcmp(buffer, STRING, numCopied));
+                ASSERTV(numBytes, '\0' == buffer[numCopied]);
+                ASSERTV(numBytes, '#'  == buffer[numCopied + 1]);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[32];
+
+            ASSERT_SAFE_PASS(Util::generateDigits(buffer,  0, 2));
+            ASSERT_SAFE_FAIL(Util::generateDigits(     0,  0, 2));
+            ASSERT_SAFE_FAIL(Util::generateDigits(buffer, -1, 2));
+            ASSERT_SAFE_FAIL(Util::generateDigits(buffer,  0, -1));
+
+            ASSERT_PASS(Util::generateTime(buffer, 0, 0, 0, 0, 0,  6));
+            ASSERT_FAIL(Util::generateTime(     0, 0, 0, 0, 0, 0,  6));
+            ASSERT_FAIL(Util::generateTime(buffer, 0, 0, 0, 0, 0, -1));
+            ASSERT_FAIL(Util::generateTime(buffer, 0, 0, 0, 0, 0,  7));
+
+            ASSERT_PASS(Util::copyToBuffer(buffer,  1, "a",  1));
+            ASSERT_FAIL(Util::copyToBuffer(buffer, -1, "a",  1));
+            ASSERT_FAIL(Util::copyToBuffer(buffer,  1, "a", -1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'loadDigits'
+        //
+        // Concerns:
+        //: 1 'loadDigits' returns 'true' if and only if every byte selected by
+        //:   the mask equals the corresponding separator and every other byte
+        //:   is a decimal digit.
+        //:
+        //: 2 On success, each digit byte is loaded as its value, and each
+        //:   separator byte as 0.
+        //:
+        //: 3 On failure, 'digits' is unchanged.
+        //:
+        //: 4 The characters are read in order, the first being in the
+        //:   least-significant byte, regardless of the byte order of the
+        //:   platform.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each of a set of layouts, and for each position and each byte
+        //:   value, replace the character of a valid string of the layout at
+        //:   that position with that byte value, and compare the result and
+        //:   the loaded word with those computed character by character.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointer arguments.  (C-5)
+        //
+        // Testing:
+        //   bool loadDigits(Uint64 *, const char *, Uint64, Uint64);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'loadDigits'" << endl
+                          << "============" << endl;
+
+        static const char *const LAYOUTS[] = {
+            "20240715",
+            "2024-07-",
+            "15T12:34",
+            "12:34:56",
+            "4:56.789",
+            "6.123456",
+            "56+01:30",
+        };
+        const int NUM_LAYOUTS =
+                           static_cast<int>(sizeof LAYOUTS / sizeof *LAYOUTS);
+
+        for (int li = 0; li < NUM_LAYOUTS; ++li) {
+            const char *LAYOUT = LAYOUTS[li];
+
+            Uint64 mask       = 0;
+            Uint64 separators = 0;
+
+            for (int i = 0; i < 8; ++i) {
+                if (!u::isDigit(LAYOUT[i])) {
+                    mask       |= 0xffULL << (8 * i);
+                    separators |=
+                            static_cast<Uint64>(LAYOUT[i]) << (8 * i);
+                }
+            }
+
+            if (veryVerbose) { T_ P(LAYOUT) }
+
+            for (int pos = 0; pos < 8; ++pos) {
+                for (int c = 0; c < 256; ++c) {
+                    char input[8];
+
+                    bsl::memcpy(input, LAYOUT, 8);
+                    input[pos] = static_cast<char>(c);
+
+                    bool   expected       = true;
+                    Uint64 expectedDigits = 0;
+
+                    for (int i = 0; i < 8; ++i) {
+                        if (u::isDigit(LAYOUT[i])) {
+                            if (!u::isDigit(input[i])) {
+                                expected = false;
+                            }
+                            expectedDigits |= static_cast<Uint64>(
+                                          (input[i] - '0') & 0xff) << (8 * i);
+                        }
+                        else if (input[i] != LAYOUT[i]) {
+                            expected = false;
+                        }
+                    }
+
+                    const Uint64 INITIAL = 0xdeadbeefdeadbeefULL;
+
+                    Uint64 digits = INITIAL;
+
+                    const bool rc = Util::loadDigits(&digits,
+                                                     input,
+                                                     mask,
+                                                     separators);
+
+                    ASSERTV(LAYOUT, pos, c, expected == rc);
+                    ASSERTV(LAYOUT,
+                            pos,
+                            c,
+                            (rc ? expectedDigits : INITIAL) == digits);
+                }
+            }
+
+            // The word is independent of the byte order of the platform.
+
+            Uint64 digits;
+
+            ASSERTV(LAYOUT,
+                    Util::loadDigits(&digits, LAYOUT, mask, separators));
+            ASSERTV(LAYOUT,
+                    (u::loadWord(LAYOUT) & ~mask)
+                                 - (0x3030303030303030ULL & ~mask) == digits);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Uint64 digits;
+
+            ASSERT_SAFE_PASS(Util::loadDigits(&digits, "12345678", 0, 0));
+            ASSERT_SAFE_FAIL(Util::loadDigits(      0, "12345678", 0, 0));
+            ASSERT_SAFE_FAIL(Util::loadDigits(&digits,          0, 0, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // 'byteAt' AND 'pairDigits'
+        //
+        // Concerns:
+        //: 1 'byteAt' returns the byte at the specified index, counting from
+        //:   the least-significant byte.
+        //:
+        //: 2 'pairDigits' computes, in byte 'i', the two-digit value whose
+        //:   digits are bytes 'i' and 'i + 1', for every pair of digits at
+        //:   every position.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify 'byteAt' for each index of a word having distinct bytes.
+        //:   (C-1)
+        //:
+        //: 2 For every position and every pair of digits, place the pair in a
+        //:   word of otherwise arbitrary digits, and verify the bytes of the
+        //:   result of 'pairDigits' against a per-byte computation.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid indices.  (C-3)
+        //
+        // Testing:
+        //   int byteAt(bsls::Types::Uint64 word, int index);
+        //   bsls::Types::Uint64 pairDigits(bsls::Types::Uint64 digits);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'byteAt' AND 'pairDigits'" << endl
+                          << "=========================" << endl;
+
+        if (verbose) cout << "\nTesting 'byteAt'." << endl;
+        {
+            const Uint64 WORD = 0xf7e6d5c4b3a29180ULL;
+
+            for (int i = 0; i < 8; ++i) {
+                const int EXP = static_cast<int>((WORD >> (8 * i)) & 0xff);
+
+                ASSERTV(i, EXP == Util::byteAt(WORD, i));
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'pairDigits'." << endl;
+        {
+            const char *FILLER = "31415926";
+
+            for (int pos = 0; pos < 7; ++pos) {
+                for (int d = 0; d < 100; ++d) {
+                    int digits[8];
+
+                    for (int i = 0; i < 8; ++i) {
+                        digits[i] = FILLER[i] - '0';
+                    }
+                    digits[pos]     = d / 10;
+                    digits[pos + 1] = d % 10;
+
+                    Uint64 word = 0;
+
+                    for (int i = 7; 0 <= i; --i) {
+                        word = (word << 8) | static_cast<Uint64>(digits[i]);
+                    }
+
+                    const Uint64 paired = Util::pairDigits(word);
+
+                    for (int i = 0; i < 7; ++i) {
+                        ASSERTV(pos,
+                                d,
+                                i,
+                                digits[i] * 10 + digits[i + 1]
+                                                 == Util::byteAt(paired, i));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_SAFE_PASS(Util::byteAt(0, 0));
+            ASSERT_SAFE_PASS(Util::byteAt(0, 7));
+            ASSERT_SAFE_FAIL(Util::byteAt(0, -1));
+            ASSERT_SAFE_FAIL(Util::byteAt(0, 8));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
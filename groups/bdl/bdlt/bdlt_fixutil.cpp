@@ -6,12 +6,15 @@ BSLS_IDENT_RCSID(bdlt_fixutil_cpp,"$Id$ $CSID$")
 
 #include <bdlt_date.h>
 #include <bdlt_datetime.h>
+#include <bdlt_datetimeformatimputil.h>
 #include <bdlt_datetimeinterval.h>
 #include <bdlt_datetimetz.h>
 #include <bdlt_datetz.h>
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 
+#include <bsls_types.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstring.h>
@@ -374,6 +377,74 @@ int parseTime(const char **nextPos,
     return 0;
 }
 
+// The most common layouts of a FIX datetime,
+// "YYYYMMDD-hh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}", are parsed eight characters
+// at a time (see 'bdlt_datetimeformatimputil').  Any other string is parsed by
+// the general parser (above).
+
+static
+bool parseFixedLayout(DatetimeTz *result, const char *string, int length)
+    // If the specified 'string' having the specified 'length' has the layout
+    // "YYYYMMDD-hh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}" and represents a valid
+    // 'DatetimeTz' value having no leap second, load that value into the
+    // specified 'result' and return 'true'; otherwise, return 'false' with no
+    // effect.  Note that a string for which 'false' is returned may
+    // nevertheless be valid.
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(string);
+
+    typedef DatetimeFormatImpUtil Imp;
+
+    enum { k_DATE_LENGTH = sizeof "YYYYMMDD-" - 1 };
+
+    if (length < static_cast<int>(sizeof "YYYYMMDD-hh:mm:ss") - 1) {
+        return false;                                                 // RETURN
+    }
+
+    bsls::Types::Uint64 date;
+
+    if (!Imp::loadDigits(&date, string, 0, 0) || '-' != string[8]) {
+        return false;                                                 // RETURN
+    }
+
+    int hour, minute, second, millisecond, microsecond, tzOffset;
+
+    if (!Imp::parseTimeAndZone(&hour,
+                               &minute,
+                               &second,
+                               &millisecond,
+                               &microsecond,
+                               &tzOffset,
+                               string + k_DATE_LENGTH,
+                               length - k_DATE_LENGTH)) {
+        return false;                                                 // RETURN
+    }
+
+    date = Imp::pairDigits(date);
+
+    const int year  = Imp::byteAt(date, 0) * 100 + Imp::byteAt(date, 2);
+    const int month = Imp::byteAt(date, 4);
+    const int day   = Imp::byteAt(date, 6);
+
+    Datetime localDatetime;
+
+    if (0 != localDatetime.setDatetimeIfValid(year,
+                                              month,
+                                              day,
+                                              hour,
+                                              minute,
+                                              second,
+                                              millisecond,
+                                              microsecond)) {
+        return false;                                                 // RETURN
+    }
+
+    result->setDatetimeTz(localDatetime, tzOffset);
+
+    return true;
+}
+
 static
 int generateInt(char *buffer, int value, int paddedLen)
     // Write, to the specified 'buffer', the decimal string representation of
@@ -389,12 +460,7 @@ int generateInt(char *buffer, int value, int paddedLen)
     BSLS_ASSERT(0 <= value);
     BSLS_ASSERT(0 <= paddedLen);
 
-    char *p = buffer + paddedLen;
-
-    while (p > buffer) {
-        *--p = static_cast<char>('0' + value % 10);
-        value /= 10;
-    }
+    DatetimeFormatImpUtil::generateDigits(buffer, value, paddedLen);
 
     return paddedLen;
 }
@@ -1225,6 +1291,12 @@ int FixUtil::parse(DatetimeTz *result, const char *string, int length)
     //
     // The fractional second and timezone offset are independently optional.
 
+    // Try the most common layouts.
+
+    if (parseFixedLayout(result, string, length)) {
+        return 0;                                                     // RETURN
+    }
+
     enum { k_MINIMUM_LENGTH = sizeof "YYYYMMDD-hh:mm" - 1 };
 
     if (length < k_MINIMUM_LENGTH) {
@@ -251,6 +251,19 @@ BSLS_IDENT("$Id: $")
 // Finally, a string representing 24:00 is rejected by the 'bdlt::FixUtil'
 // parse methods.
 //
+///Parsing Performance
+///- - - - - - - - - -
+// The most common layouts of a FIX datetime, namely:
+//..
+//  YYYYMMDD-hh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}
+//..
+// are recognized by their length and parsed into 'Datetime' and 'DatetimeTz'
+// objects eight characters at a time, without examining them character by
+// character.  All other strings (e.g., those lacking seconds, having a
+// fractional second of other than 3 or 6 digits, a timezone offset of the
+// form "(+|-)hh", or a leap second) are parsed by the general parser, to the
+// same result.
+//
 ///Summary of Supported FIX Representations
 ///- - - - - - - - - - - - - - - - - - - -
 // The syntax description below summarizes the FIX string representations
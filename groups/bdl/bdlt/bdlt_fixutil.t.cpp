@@ -12,10 +12,13 @@
 
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
 
 #include <bslx_testinstream.h>
 
 #include <bsl_cctype.h>      // 'isdigit'
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
@@ -109,7 +112,8 @@ using namespace bsl;
 // [ 8] int parse(TimeTz *result, const StringRef& string);
 // [ 9] int parse(DatetimeTz *result, const StringRef& string);
 //-----------------------------------------------------------------------------
-// [10] USAGE EXAMPLE
+// [10] CONCERN: FIXED-LAYOUT STRINGS PARSE AS OTHER STRINGS
+// [11] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1095,6 +1099,48 @@ int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
     return 0;
 }
 
+static
+bool makeGeneralEquivalent(bsl::string *result, const bsl::string& input)
+    // Load, into the specified 'result', a string that is parsed as a FIX
+    // datetime to the same value as the specified 'input', or is rejected if
+    // 'input' is, and whose fractional second has a number of digits (1, 4,
+    // or 7) for which the fixed-layout fast path is never taken, and return
+    // 'true'; return 'false', with no effect on 'result', if 'input' cannot
+    // be a valid FIX datetime.  The behavior is undefined unless 'input' has
+    // at least 17 characters.
+{
+    ASSERT(result);
+    ASSERT(17 <= input.length());
+
+    enum { k_FRACTION_INDEX = 17 };  // index of '.' in "YYYYMMDD-hh:mm:ss."
+
+    const char ch = input.c_str()[k_FRACTION_INDEX];
+
+    if ('.' == ch) {
+        bsl::string::size_type end = k_FRACTION_INDEX + 1;
+
+        while (end < input.length() && isdigit(input[end])) {
+            ++end;
+        }
+
+        if (k_FRACTION_INDEX + 1 == end) {
+            return false;                                             // RETURN
+        }
+
+        *result = input;
+        result->insert(end, 1, '0');
+    }
+    else if (isdigit(ch)) {
+        return false;                                                 // RETURN
+    }
+    else {
+        *result = input;
+        result->insert(k_FRACTION_INDEX, ".0");
+    }
+
+    return true;
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1116,7 +1162,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1291,6 +1337,220 @@ if (veryVerbose)
     ASSERT(         0 == bsl::strcmp(buffer, "20050131-08:59:59+04:00"));
 //..
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // PARSE: FIXED-LAYOUT DATETIMETZ
+        //
+        // Concerns:
+        //: 1 Strings having one of the layouts parsed by the fixed-layout
+        //:   fast path ("YYYYMMDD-hh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}") are
+        //:   parsed to the same value as by the general parser.
+        //:
+        //: 2 Strings differing from those layouts in any one character are
+        //:   parsed (or rejected) exactly as by the general parser.
+        //:
+        //: 3 Leap seconds, the hour 24, and invalid field values in strings
+        //:   having those layouts are handled as by the general parser.
+        //
+        // Plan:
+        //: 1 Note that appending a '0' to the fractional second of a string
+        //:   (or appending a fractional second of ".0" to a string having
+        //:   none) does not change the value it represents, but yields a
+        //:   string that is parsed by the general parser.
+        //:
+        //: 2 For a set of strings having each of the fixed layouts, and for
+        //:   each string obtained by replacing one character of those strings
+        //:   with one of a set of characters (including the characters
+        //:   adjacent to '0' and '9' in ASCII, the separators, and characters
+        //:   having their high-order bit set), verify that 'parse' returns
+        //:   the same status, and loads the same 'Datetime' and 'DatetimeTz'
+        //:   values, as for the string obtained per P-1.  (C-1..2)
+        //:
+        //: 3 Using the table-driven technique, specify a set of strings,
+        //:   including strings having the fixed layouts, along with whether
+        //:   they are valid, and verify that 'parse' accepts exactly the
+        //:   valid strings.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: FIXED-LAYOUT STRINGS PARSE AS OTHER STRINGS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARSE: FIXED-LAYOUT DATETIMETZ" << endl
+                          << "==============================" << endl;
+
+        const bdlt::Datetime   XX(246, 8, 10, 9, 11, 12, 13, 14);
+        const bdlt::DatetimeTz ZZ(XX, -7);
+
+        if (verbose) cout << "\nReplacing each character." << endl;
+        {
+            static const char *const BASE_DATA[] = {
+                "20050131-08:59:59",
+                "20050131-08:59:59Z",
+                "20050131-08:59:59+04:30",
+                "20050131-08:59:59.123",
+                "20050131-08:59:59.123Z",
+                "20050131-08:59:59.123-04:30",
+                "20050131-08:59:59.123456",
+                "20050131-08:59:59.123456Z",
+                "20050131-08:59:59.123456-23:59",
+                "00010101-00:00:00.000000+00:00",
+                "99991231-23:59:59.999999-00:00",
+                "20000229-12:00:00.500+12:00",
+            };
+            const int NUM_BASE_DATA = static_cast<int>(sizeof  BASE_DATA
+                                                     / sizeof *BASE_DATA);
+
+            static const char CHARS[] = {
+                '0', '1', '5', '8', '9', '/', ':', '+', '-', '.', ',', 'T',
+                'Z', 'z', ' ', '\x7f', '\xb0', '\xb9', '\xf9', '\xff'
+            };
+            const int NUM_CHARS = static_cast<int>(sizeof CHARS);
+
+            for (int ti = 0; ti < NUM_BASE_DATA; ++ti) {
+                const char *const BASE   = BASE_DATA[ti];
+                const int         LENGTH = static_cast<int>(strlen(BASE));
+
+                if (veryVerbose) { T_ P(BASE) }
+
+                {
+                    bdlt::DatetimeTz mX(ZZ);  const bdlt::DatetimeTz& X = mX;
+
+                    ASSERTV(BASE, 0 == Util::parse(&mX, BASE, LENGTH));
+                    ASSERTV(BASE, X, ZZ != X);
+                }
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    for (int ci = 0; ci < NUM_CHARS; ++ci) {
+                        bsl::string input(BASE);
+                        input[i] = CHARS[ci];
+
+                        bsl::string oracle;
+
+                        const bool CAN_BE_VALID =
+                                         makeGeneralEquivalent(&oracle, input);
+
+                        bdlt::DatetimeTz        mX(ZZ);
+                        const bdlt::DatetimeTz& X = mX;
+                        bdlt::DatetimeTz        mY(ZZ);
+                        const bdlt::DatetimeTz& Y = mY;
+
+                        bdlt::Datetime mA(XX);  const bdlt::Datetime& A = mA;
+                        bdlt::Datetime mB(XX);  const bdlt::Datetime& B = mB;
+
+                        const char *const INPUT = input.c_str();
+
+                        const int rc  = Util::parse(&mX, INPUT, LENGTH);
+                        const int rcA = Util::parse(&mA, INPUT, LENGTH);
+
+                        if (!CAN_BE_VALID) {
+                            ASSERTV(input, rc,  0 != rc);
+                            ASSERTV(input, rcA, 0 != rcA);
+                            ASSERTV(input, X, ZZ == X);
+                            ASSERTV(input, A, XX == A);
+
+                            continue;
+                        }
+
+                        const int ORACLE_LENGTH =
+                                            static_cast<int>(oracle.length());
+
+                        const int expRc  = Util::parse(&mY,
+                                                       oracle.c_str(),
+                                                       ORACLE_LENGTH);
+                        const int expRcA = Util::parse(&mB,
+                                                       oracle.c_str(),
+                                                       ORACLE_LENGTH);
+
+                        ASSERTV(input, rc, expRc, (0 == rc) == (0 == expRc));
+                        ASSERTV(input, X, Y, Y == X);
+
+                        ASSERTV(input, rcA, expRcA,
+                                (0 == rcA) == (0 == expRcA));
+                        ASSERTV(input, A, B, B == A);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nSpecial values." << endl;
+        {
+            static const struct {
+                int         d_line;     // source line number
+
+                const char *d_input_p;  // input
+
+                bool        d_isValid;  // is valid FIX datetime
+            } DATA[] = {
+                //LINE  INPUT                             VALID
+                //----  --------------------------------  -----
+                { L_,   "20050131-08:59:60",              true  },
+                { L_,   "20050131-23:59:60.999999Z",      true  },
+                { L_,   "20051231-23:59:60.999-01:00",    true  },
+                { L_,   "99991231-23:59:60",              false },
+                { L_,   "99991231-23:59:60.000+01:00",    false },
+                { L_,   "20050131-08:59:61",              false },
+
+                { L_,   "00010101-24:00:00",              false },
+                { L_,   "20050131-24:00:00.000000+00:00", false },
+                { L_,   "20050131-25:00:00",              false },
+
+                { L_,   "00000101-00:00:00",              false },
+                { L_,   "20050031-08:59:59",              false },
+                { L_,   "20051331-08:59:59",              false },
+                { L_,   "20050100-08:59:59",              false },
+                { L_,   "20050132-08:59:59",              false },
+                { L_,   "20050229-08:59:59",              false },
+                { L_,   "20040229-08:59:59",              true  },
+                { L_,   "20050131-08:60:59",              false },
+
+                { L_,   "20050131-08:59:59+23:59",        true  },
+                { L_,   "20050131-08:59:59-23:59",        true  },
+                { L_,   "20050131-08:59:59+24:00",        false },
+                { L_,   "20050131-08:59:59+00:60",        false },
+                { L_,   "20050131-08:59:59.999Z",         true  },
+                { L_,   "20050131-08:59:59,999Z",         false },
+                { L_,   "20050131-08:59:59.999z",         false },
+                { L_,   "20050131-08:59:59.999+01",       true  },
+                { L_,   "20050131-08:59:59.999+0100",     false },
+                { L_,   "20050131-08:59:59.1Z",           true  },
+                { L_,   "20050131-08:59:59.12Z",          true  },
+                { L_,   "20050131-08:59:59.1234Z",        true  },
+                { L_,   "20050131-08:59:59.12345Z",       true  },
+                { L_,   "20050131-08:59:59.1234567Z",     true  },
+                { L_,   "20050131-08:59:59.Z",            false },
+                { L_,   "20050131-08:59Z",                true  },
+                { L_,   "20050131-08:59:59.123Z0",        false },
+                { L_,   "20050131-08:59:59.123+04:300",   false },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const char *const INPUT  = DATA[ti].d_input_p;
+                const bool        VALID  = DATA[ti].d_isValid;
+                const int         LENGTH = static_cast<int>(strlen(INPUT));
+
+                if (veryVerbose) { T_ P_(LINE) P_(INPUT) P(VALID) }
+
+                bdlt::DatetimeTz mX(ZZ);  const bdlt::DatetimeTz& X = mX;
+
+                const int rc = Util::parse(&mX, INPUT, LENGTH);
+
+                ASSERTV(LINE, INPUT, rc, VALID == (0 == rc));
+                ASSERTV(LINE, INPUT, X, VALID == (ZZ != X));
+            }
+        }
+
+        if (verbose) cout << "\nLeap second." << endl;
+        {
+            bdlt::DatetimeTz mX(ZZ);  const bdlt::DatetimeTz& X = mX;
+
+            ASSERT(0 == Util::parse(&mX, "20051231-23:59:60.500Z", 22));
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2006, 1, 1, 0, 0, 0, 500),
+                                    0) == X);
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // PARSE: DATETIME & DATETIMETZ
@@ -5227,6 +5487,127 @@ if (veryVerbose)
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'parse' AND 'generate' DATETIMETZ
+        //   Manually compare the throughput of the fixed-layout fast path with
+        //   that of the general parser, and of 'generateRaw' with that of
+        //   'snprintf'.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'parse' AND 'generate' DATETIMETZ
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "PERFORMANCE TEST: 'parse' AND 'generate' DATETIMETZ"
+                   << endl
+                   << "==================================================="
+                   << endl;
+
+        const int NUM_ITERATIONS = 1000000;
+
+        // A fractional second of 7 digits is not accepted by the fast path,
+        // and so directs the (otherwise equivalent) string to the general
+        // parser.
+
+        const char FAST[]    = "20050131-08:59:59.123456-04:00";
+        const char GENERAL[] = "20050131-08:59:59.1234560-04:00";
+        const int  LENGTH    = static_cast<int>(sizeof FAST - 1);
+
+        bsls::Types::Int64 checksum = 0;
+
+        if (verbose) cout << "\nTesting 'parse' (fixed layout)." << endl;
+        {
+            bdlt::DatetimeTz mX;  const bdlt::DatetimeTz& X = mX;
+
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                checksum += Util::parse(&mX, FAST, LENGTH);
+                checksum += X.offset();
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
+        if (verbose) cout << "\nTesting 'parse' (general)." << endl;
+        {
+            bdlt::DatetimeTz mX;  const bdlt::DatetimeTz& X = mX;
+
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                checksum += Util::parse(&mX, GENERAL, LENGTH + 1);
+                checksum += X.offset();
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
+        const bdlt::DatetimeTz X(bdlt::Datetime(2005, 1, 31, 8, 59, 59, 123,
+                                                456),
+                                 -240);
+
+        if (verbose) cout << "\nTesting 'generateRaw'." << endl;
+        {
+            Config mC;  const Config& C = mC;
+            mC.setFractionalSecondPrecision(6);
+
+            char buffer[Util::k_DATETIMETZ_STRLEN];
+
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                checksum += Util::generateRaw(buffer, X, C);
+                checksum += buffer[i % LENGTH];
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
+        if (verbose) cout << "\nTesting 'snprintf'." << endl;
+        {
+            const bdlt::Datetime& D = X.localDatetime();
+
+            char buffer[Util::k_DATETIMETZ_STRLEN + 1];
+
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                checksum += snprintf(buffer,
+                                     sizeof buffer,
+                                     "%04d%02d%02d-%02d:%02d:%02d.%06d"
+                                     "%c%02d:%02d",
+                                     D.year(),
+                                     D.month(),
+                                     D.day(),
+                                     D.hour(),
+                                     D.minute(),
+                                     D.second(),
+                                     D.millisecond() * 1000 + D.microsecond(),
+                                     X.offset() < 0 ? '-' : '+',
+                                     abs(X.offset()) / 60,
+                                     abs(X.offset()) % 60);
+                checksum += buffer[i % LENGTH];
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
+        if (veryVerbose) { P(checksum) }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -6,12 +6,15 @@ BSLS_IDENT_RCSID(bdlt_iso8601util_cpp,"$Id$ $CSID$")
 
 #include <bdlt_date.h>
 #include <bdlt_datetime.h>
+#include <bdlt_datetimeformatimputil.h>
 #include <bdlt_datetimeinterval.h>
 #include <bdlt_datetimetz.h>
 #include <bdlt_datetz.h>
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 
+#include <bsls_types.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstring.h>
@@ -401,6 +404,87 @@ int parseZoneDesignator(const char **nextPos,
     return 0;
 }
 
+// The most common layouts of an ISO 8601 datetime,
+// "YYYY-MM-DDThh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}", are parsed eight
+// characters at a time (see 'bdlt_datetimeformatimputil').  Any other string
+// is parsed by the general parser (above).
+
+// Separator masks and separators of the groups of eight characters of the
+// date part of the layout, the first character of a group being in the
+// least-significant byte.
+
+const bsls::Types::Uint64 k_DATE_MASK     = 0xff0000ff00000000ULL;
+const bsls::Types::Uint64 k_DATE_SEPS     = 0x2d00002d00000000ULL;
+                                                             // "YYYY-MM-"
+const bsls::Types::Uint64 k_DAY_TIME_MASK = 0x0000ff0000ff0000ULL;
+const bsls::Types::Uint64 k_DAY_TIME_SEPS = 0x00003a0000540000ULL;
+                                                             // "DDThh:mm"
+
+static
+bool parseFixedLayout(DatetimeTz *result, const char *string, int length)
+    // If the specified 'string' having the specified 'length' has the layout
+    // "YYYY-MM-DDThh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}" and represents a valid
+    // 'DatetimeTz' value having neither a leap second nor the hour 24, load
+    // that value into the specified 'result' and return 'true'; otherwise,
+    // return 'false' with no effect.  Note that a string for which 'false' is
+    // returned may nevertheless be valid.
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(string);
+
+    typedef DatetimeFormatImpUtil Imp;
+
+    enum { k_DATE_LENGTH = sizeof "YYYY-MM-DDT" - 1 };
+
+    if (length < static_cast<int>(sizeof "YYYY-MM-DDThh:mm:ss") - 1) {
+        return false;                                                 // RETURN
+    }
+
+    bsls::Types::Uint64 date, dayTime;
+
+    if (!Imp::loadDigits(&date,    string,     k_DATE_MASK,     k_DATE_SEPS)
+     || !Imp::loadDigits(&dayTime, string + 8, k_DAY_TIME_MASK,
+                                                            k_DAY_TIME_SEPS)) {
+        return false;                                                 // RETURN
+    }
+
+    int hour, minute, second, millisecond, microsecond, tzOffset;
+
+    if (!Imp::parseTimeAndZone(&hour,
+                               &minute,
+                               &second,
+                               &millisecond,
+                               &microsecond,
+                               &tzOffset,
+                               string + k_DATE_LENGTH,
+                               length - k_DATE_LENGTH)) {
+        return false;                                                 // RETURN
+    }
+
+    date = Imp::pairDigits(date);
+
+    const int year  = Imp::byteAt(date, 0) * 100 + Imp::byteAt(date, 2);
+    const int month = Imp::byteAt(date, 5);
+    const int day   = Imp::byteAt(Imp::pairDigits(dayTime), 0);
+
+    Datetime localDatetime;
+
+    if (0 != localDatetime.setDatetimeIfValid(year,
+                                              month,
+                                              day,
+                                              hour,
+                                              minute,
+                                              second,
+                                              millisecond,
+                                              microsecond)) {
+        return false;                                                 // RETURN
+    }
+
+    result->setDatetimeTz(localDatetime, tzOffset);
+
+    return true;
+}
+
 static
 int generateUnpaddedInt(char *buffer, bsls::Types::Int64 value)
     // Write, to the specified 'buffer', the decimal string representation of
@@ -459,12 +543,7 @@ int generateInt(char *buffer, int value, int paddedLen)
     BSLS_ASSERT(0 <= value);
     BSLS_ASSERT(0 <= paddedLen);
 
-    char *p = buffer + paddedLen;
-
-    while (p > buffer) {
-        *--p = static_cast<char>('0' + value % 10);
-        value /= 10;
-    }
+    DatetimeFormatImpUtil::generateDigits(buffer, value, paddedLen);
 
     return paddedLen;
 }
@@ -1719,6 +1798,12 @@ int Iso8601Util::parse(DatetimeTz *result, const char *string, int length)
     //
     // The fractional second and zone designator are independently optional.
 
+    // 0. Try the most common layouts.
+
+    if (parseFixedLayout(result, string, length)) {
+        return 0;                                                     // RETURN
+    }
+
     enum { k_MINIMUM_LENGTH = sizeof "YYYY-MM-DDThh:mm:ss" - 1 };
 
     if (length < k_MINIMUM_LENGTH) {
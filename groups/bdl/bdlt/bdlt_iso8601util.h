@@ -295,6 +295,19 @@ BSLS_IDENT("$Id: $")
 //  +------------------------------------+-----------------------------------+
 //..
 //
+///Parsing Performance
+///- - - - - - - - - -
+// The most common layouts of an ISO 8601 datetime, namely:
+//..
+//  YYYY-MM-DDThh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}
+//..
+// are recognized by their length and parsed into 'Datetime' and 'DatetimeTz'
+// objects eight characters at a time, without examining them character by
+// character.  All other strings (e.g., those having a lowercase 't' or 'z', a
+// comma as the decimal sign, a fractional second of other than 3 or 6 digits,
+// a leap second, or the time 24:00) are parsed by the general parser, to the
+// same result.
+//
 ///Summary of Supported ISO 8601 Representations
 ///- - - - - - - - - - - - - - - - - - - - - - -
 // The syntax description below summarizes the ISO 8601 string representations
@@ -12,8 +12,11 @@
 
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
 
 #include <bsl_cctype.h>      // 'isdigit'
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
@@ -134,7 +137,8 @@ using namespace bsl;
 // [ 7] int generateRaw(char *, const DatetimeTz&, bool useZ);
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 //-----------------------------------------------------------------------------
-// [12] USAGE EXAMPLE
+// [12] CONCERN: FIXED-LAYOUT STRINGS PARSE AS OTHER STRINGS
+// [13] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -794,7 +798,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -990,6 +994,194 @@ if (veryVerbose)
     ASSERT(         0 == bsl::strcmp(buffer, "08:59:59+0400"));
 //..
 
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // PARSE: FIXED-LAYOUT DATETIMETZ
+        //
+        // Concerns:
+        //: 1 Strings having one of the layouts parsed by the fixed-layout
+        //:   fast path ("YYYY-MM-DDThh:mm:ss{.sss|.ssssss}{Z|(+|-)hh:mm}")
+        //:   are parsed to the same value as by the general parser.
+        //:
+        //: 2 Strings differing from those layouts in any one character are
+        //:   parsed (or rejected) exactly as by the general parser.
+        //:
+        //: 3 Leap seconds, the hour 24, and invalid field values in strings
+        //:   having those layouts are handled as by the general parser.
+        //
+        // Plan:
+        //: 1 Note that the fast path does not accept a lowercase 't'; hence,
+        //:   the general parser is the oracle for a string having an
+        //:   uppercase 'T' once that 'T' is replaced by a 't'.
+        //:
+        //: 2 For a set of strings having each of the fixed layouts, and for
+        //:   each string obtained by replacing one character of those strings
+        //:   with one of a set of characters (including the characters
+        //:   adjacent to '0' and '9' in ASCII, the separators, and characters
+        //:   having their high-order bit set), verify that 'parse' returns
+        //:   the same status, and loads the same 'Datetime' and 'DatetimeTz'
+        //:   values, as for the corresponding string from P-1.  (C-1..2)
+        //:
+        //: 3 Using the table-driven technique, specify a set of strings
+        //:   having the fixed layouts along with whether they are valid, and
+        //:   verify that 'parse' accepts exactly the valid strings, and loads
+        //:   the same values as for the corresponding strings from P-1.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: FIXED-LAYOUT STRINGS PARSE AS OTHER STRINGS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARSE: FIXED-LAYOUT DATETIMETZ" << endl
+                          << "==============================" << endl;
+
+        const bdlt::Datetime   XX(246, 8, 10, 9, 11, 12, 13, 14);
+        const bdlt::DatetimeTz ZZ(XX, -7);
+
+        if (verbose) cout << "\nReplacing each character." << endl;
+        {
+            static const char *const BASE_DATA[] = {
+                "2005-01-31T08:59:59",
+                "2005-01-31T08:59:59Z",
+                "2005-01-31T08:59:59+04:30",
+                "2005-01-31T08:59:59.123",
+                "2005-01-31T08:59:59.123Z",
+                "2005-01-31T08:59:59.123-04:30",
+                "2005-01-31T08:59:59.123456",
+                "2005-01-31T08:59:59.123456Z",
+                "2005-01-31T08:59:59.123456-23:59",
+                "0001-01-01T00:00:00.000000+00:00",
+                "9999-12-31T23:59:59.999999-00:00",
+                "2000-02-29T12:00:00.500+12:00",
+            };
+            const int NUM_BASE_DATA = static_cast<int>(sizeof  BASE_DATA
+                                                     / sizeof *BASE_DATA);
+
+            static const char CHARS[] = {
+                '0', '1', '5', '8', '9', '/', ':', '+', '-', '.', ',', 'T',
+                't', 'Z', 'z', ' ', '\x7f', '\xb0', '\xb9', '\xf9', '\xff'
+            };
+            const int NUM_CHARS = static_cast<int>(sizeof CHARS);
+
+            for (int ti = 0; ti < NUM_BASE_DATA; ++ti) {
+                const char *const BASE   = BASE_DATA[ti];
+                const int         LENGTH = static_cast<int>(strlen(BASE));
+
+                if (veryVerbose) { T_ P(BASE) }
+
+                {
+                    bdlt::DatetimeTz mX(ZZ);  const bdlt::DatetimeTz& X = mX;
+
+                    ASSERTV(BASE, 0 == Util::parse(&mX, BASE, LENGTH));
+                    ASSERTV(BASE, X, ZZ != X);
+                }
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    for (int ci = 0; ci < NUM_CHARS; ++ci) {
+                        bsl::string input(BASE);
+                        input[i] = CHARS[ci];
+
+                        bsl::string oracle(input);
+                        if ('T' == oracle[10]) {
+                            oracle[10] = 't';
+                        }
+
+                        bdlt::DatetimeTz        mX(ZZ);
+                        const bdlt::DatetimeTz& X = mX;
+                        bdlt::DatetimeTz        mY(ZZ);
+                        const bdlt::DatetimeTz& Y = mY;
+
+                        int rc    = Util::parse(&mX, input.c_str(), LENGTH);
+                        int expRc = Util::parse(&mY, oracle.c_str(), LENGTH);
+
+                        ASSERTV(input, rc, expRc, (0 == rc) == (0 == expRc));
+                        ASSERTV(input, X, Y, Y == X);
+
+                        bdlt::Datetime mA(XX);  const bdlt::Datetime& A = mA;
+                        bdlt::Datetime mB(XX);  const bdlt::Datetime& B = mB;
+
+                        rc    = Util::parse(&mA, input.c_str(), LENGTH);
+                        expRc = Util::parse(&mB, oracle.c_str(), LENGTH);
+
+                        ASSERTV(input, rc, expRc, (0 == rc) == (0 == expRc));
+                        ASSERTV(input, A, B, B == A);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nSpecial values." << endl;
+        {
+            static const struct {
+                int         d_line;     // source line number
+
+                const char *d_input_p;  // input
+
+                bool        d_isValid;  // is valid ISO 8601 datetime
+            } DATA[] = {
+                //LINE  INPUT                               VALID
+                //----  ----------------------------------  -----
+                { L_,   "2005-01-31T08:59:60",              true  },
+                { L_,   "2005-01-31T23:59:60.999999Z",      true  },
+                { L_,   "2005-12-31T23:59:60.999-01:00",    true  },
+                { L_,   "9999-12-31T23:59:60",              false },
+                { L_,   "9999-12-31T23:59:60.000+01:00",    false },
+                { L_,   "2005-01-31T08:59:61",              false },
+
+                { L_,   "0001-01-01T24:00:00",              true  },
+                { L_,   "0001-01-01T24:00:00Z",             true  },
+                { L_,   "2005-01-31T24:00:00.000000+00:00", true  },
+                { L_,   "2005-01-31T24:00:00.000001",       false },
+                { L_,   "2005-01-31T24:00:01",              false },
+                { L_,   "2005-01-31T24:01:00",              false },
+                { L_,   "2005-01-31T24:00:00+01:00",        false },
+                { L_,   "2005-01-31T25:00:00",              false },
+
+                { L_,   "0000-01-01T00:00:00",              false },
+                { L_,   "2005-00-31T08:59:59",              false },
+                { L_,   "2005-13-31T08:59:59",              false },
+                { L_,   "2005-01-00T08:59:59",              false },
+                { L_,   "2005-01-32T08:59:59",              false },
+                { L_,   "2005-02-29T08:59:59",              false },
+                { L_,   "2004-02-29T08:59:59",              true  },
+                { L_,   "2005-01-31T08:60:59",              false },
+
+                { L_,   "2005-01-31T08:59:59+23:59",        true  },
+                { L_,   "2005-01-31T08:59:59-23:59",        true  },
+                { L_,   "2005-01-31T08:59:59+24:00",        false },
+                { L_,   "2005-01-31T08:59:59+00:60",        false },
+                { L_,   "2005-01-31T08:59:59.999Z",         true  },
+                { L_,   "2005-01-31T08:59:59,999Z",         true  },
+                { L_,   "2005-01-31T08:59:59.999z",         true  },
+                { L_,   "2005-01-31T08:59:59.999+0100",     true  },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const char *const INPUT  = DATA[ti].d_input_p;
+                const bool        VALID  = DATA[ti].d_isValid;
+                const int         LENGTH = static_cast<int>(strlen(INPUT));
+
+                if (veryVerbose) { T_ P_(LINE) P_(INPUT) P(VALID) }
+
+                bsl::string oracle(INPUT);
+                oracle[10] = 't';
+
+                bdlt::DatetimeTz mX(ZZ);  const bdlt::DatetimeTz& X = mX;
+                bdlt::DatetimeTz mY(ZZ);  const bdlt::DatetimeTz& Y = mY;
+
+                const int rc    = Util::parse(&mX, INPUT, LENGTH);
+                const int expRc = Util::parse(&mY, oracle.c_str(), LENGTH);
+
+                ASSERTV(LINE, INPUT, rc,    VALID == (0 == rc));
+                ASSERTV(LINE, INPUT, expRc, VALID == (0 == expRc));
+                ASSERTV(LINE, INPUT, X, Y, Y == X);
+            }
+        }
+
       } break;
       case 11: {
         // --------------------------------------------------------------------
@@ -5698,6 +5890,126 @@ if (veryVerbose)
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'parse' AND 'generate' DATETIMETZ
+        //   Manually compare the throughput of the fixed-layout fast path with
+        //   that of the general parser, and of 'generateRaw' with that of
+        //   'snprintf'.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'parse' AND 'generate' DATETIMETZ
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "PERFORMANCE TEST: 'parse' AND 'generate' DATETIMETZ"
+                   << endl
+                   << "==================================================="
+                   << endl;
+
+        const int NUM_ITERATIONS = 1000000;
+
+        // A lowercase 't' is not accepted by the fast path, and so directs
+        // the (otherwise identical) string to the general parser.
+
+        const char FAST[]    = "2005-01-31T08:59:59.123456-04:00";
+        const char GENERAL[] = "2005-01-31t08:59:59.123456-04:00";
+        const int  LENGTH    = static_cast<int>(sizeof FAST - 1);
+
+        bsls::Types::Int64 checksum = 0;
+
+        if (verbose) cout << "\nTesting 'parse' (fixed layout)." << endl;
+        {
+            bdlt::DatetimeTz mX;  const bdlt::DatetimeTz& X = mX;
+
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                checksum += Util::parse(&mX, FAST, LENGTH);
+                checksum += X.offset();
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
+        if (verbose) cout << "\nTesting 'parse' (general)." << endl;
+        {
+            bdlt::DatetimeTz mX;  const bdlt::DatetimeTz& X = mX;
+
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                checksum += Util::parse(&mX, GENERAL, LENGTH);
+                checksum += X.offset();
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
+        const bdlt::DatetimeTz X(bdlt::Datetime(2005, 1, 31, 8, 59, 59, 123,
+                                                456),
+                                 -240);
+
+        if (verbose) cout << "\nTesting 'generateRaw'." << endl;
+        {
+            Config mC;  const Config& C = mC;
+            mC.setFractionalSecondPrecision(6);
+
+            char buffer[Util::k_DATETIMETZ_STRLEN];
+
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                checksum += Util::generateRaw(buffer, X, C);
+                checksum += buffer[i % LENGTH];
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
+        if (verbose) cout << "\nTesting 'snprintf'." << endl;
+        {
+            const bdlt::Datetime& D = X.localDatetime();
+
+            char buffer[Util::k_DATETIMETZ_STRLEN + 1];
+
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                checksum += snprintf(buffer,
+                                     sizeof buffer,
+                                     "%04d-%02d-%02dT%02d:%02d:%02d.%06d"
+                                     "%c%02d:%02d",
+                                     D.year(),
+                                     D.month(),
+                                     D.day(),
+                                     D.hour(),
+                                     D.minute(),
+                                     D.second(),
+                                     D.millisecond() * 1000 + D.microsecond(),
+                                     X.offset() < 0 ? '-' : '+',
+                                     abs(X.offset()) / 60,
+                                     abs(X.offset()) % 60);
+                checksum += buffer[i % LENGTH];
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
+        if (veryVerbose) { P(checksum) }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -4,13 +4,13 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlt_time_cpp,"$Id$ $CSID$")
 
+#include <bdlt_datetimeformatimputil.h>
+
 #include <bslim_printer.h>
 
 #include <bsls_assert.h>
-#include <bsls_libraryfeatures.h>
 #include <bsls_platform.h>
 
-#include <bsl_cstdio.h>
 #include <bsl_limits.h>
 #include <bsl_ostream.h>
 
@@ -115,79 +115,6 @@ bsls::Types::Int64 modulo(bsls::Types::Int64 *number, bsls::Types::Int64 base)
     return result;
 }
 
-static
-int printToBufferFormatted(char       *result,
-                           int         numBytes,
-                           const char *spec,
-                           int         hour,
-                           int         minute,
-                           int         second,
-                           int         microsecond,
-                           int         fractionalSecondPrecision)
-{
-#if defined(BSLS_LIBRARYFEATURES_HAS_C99_SNPRINTF)
-
-    return 0 == fractionalSecondPrecision
-           ? bsl::snprintf(result,
-                           numBytes,
-                           spec,
-                           hour,
-                           minute,
-                           second)
-           : bsl::snprintf(result,
-                           numBytes,
-                           spec,
-                           hour,
-                           minute,
-                           second,
-                           microsecond);
-
-#elif defined(BSLS_PLATFORM_CMP_MSVC)
-    // Windows uses a different variant of snprintf that does not necessarily
-    // null-terminate and returns -1 on overflow.
-
-    int numCharsWritten;
-    int rc;
-
-    if (0 == fractionalSecondPrecision) {
-        rc = _snprintf(result,
-                       numBytes,
-                       spec,
-                       hour,
-                       minute,
-                       second);
-
-        // Format of 'bdlt::Time' has 8 characters if there are no fractional
-        // seconds.
-
-        numCharsWritten = 8;
-    }
-    else {
-        rc = _snprintf(result,
-                       numBytes,
-                       spec,
-                       hour,
-                       minute,
-                       second,
-                       microsecond);
-
-        // Format of 'bdlt::Time' has 9 characters + fractional seconds.
-
-        numCharsWritten = 9 + fractionalSecondPrecision;
-    }
-
-    if ((0 > rc || rc == numBytes) && numBytes > 0) {
-        result[numBytes - 1] = '\0';  // Make sure to null-terminate on
-                                      // overflow.
-    }
-
-    return numCharsWritten;
-
-#else
-# error THIS CONFIGURATION DOES NOT SUPPORT 'snprintf'
-#endif
-}
-
                                  // ----------
                                  // class Time
                                  // ----------
@@ -526,55 +453,27 @@ int Time::printToBuffer(char *result,
 
     getTime(&hour, &minute, &second, &millisecond, &microsecond);
 
-    int value;
-
-    switch (fractionalSecondPrecision) {
-      case 0: {
-        char spec[] = "%02d:%02d:%02d";
-
-        return printToBufferFormatted(result,
-                                      numBytes,
-                                      spec,
-                                      hour,
-                                      minute,
-                                      second,
-                                      0,
-                                      0);                             // RETURN
-      } break;
-      case 1: {
-        value = millisecond / 100;
-      } break;
-      case 2: {
-        value = millisecond / 10 ;
-      } break;
-      case 3: {
-        value = millisecond;
-      } break;
-      case 4: {
-        value = millisecond * 10 + microsecond / 100;
-      } break;
-      case 5: {
-        value = millisecond * 100 + microsecond / 10;
-      } break;
-      default: {
-        value = millisecond * 1000 + microsecond;
-      } break;
-    }
+    // Format into a local buffer, then copy (possibly truncating) into
+    // 'result'.
 
-    char spec[] = "%02d:%02d:%02d.%0Xd";
+    enum { k_BUFFER_LENGTH = sizeof "hh:mm:ss.ffffff" - 1 };
 
-    const int k_PRECISION_IDX = sizeof spec - 3;
+    char  buffer[k_BUFFER_LENGTH];
+    char *p = buffer;
 
-    spec[k_PRECISION_IDX] = static_cast<char>('0' + fractionalSecondPrecision);
+    p = DatetimeFormatImpUtil::generateTime(p,
+                                            hour,
+                                            minute,
+                                            second,
+                                            millisecond,
+                                            microsecond,
+                                            fractionalSecondPrecision);
 
-    return printToBufferFormatted(result,
-                                  numBytes,
-                                  spec,
-                                  hour,
-                                  minute,
-                                  second,
-                                  value,
-                                  fractionalSecondPrecision);
+    return DatetimeFormatImpUtil::copyToBuffer(
+                                         result,
+                                         numBytes,
+                                         buffer,
+                                         static_cast<int>(p - buffer));
 }
 
                                   // Aspects
@@ -10,16 +10,60 @@ BSLS_IDENT_RCSID(bdlt_timetablecache_cpp,"$Id$ $CSID$")
 #include <bdlt_timetable.h>
 
 #include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
 
 #include <bslmt_lockguard.h>
 
 #include <bsls_assert.h>
 
 #include <bsl_climits.h>      // 'INT_MAX'
+#include <bsl_cstddef.h>
+#include <bsl_new.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Retrievals search the current snapshot without taking a lock, counting
+// themselves in 'd_readers' (see 'bdlt_cacheimp'), and 'publish' waits for
+// the readers of a replaced snapshot before destroying it.
+//
+// A background reload is requested at most once per entry: the first
+// 'getTimetable' to find an entry past its reload age sets the entry's
+// 'd_isReloadRequested' flag, and later ones only load that flag.  'reload'
+// replaces the entry only if the flag is still set on the entry in the current
+// snapshot, since an entry that was invalidated, or replaced by
+// 'getTimetable', in the meantime no longer has it.
 
 namespace BloombergLP {
 namespace bdlt {
 
+                         // ============================
+                         // struct TimetableCache_Reload
+                         // ============================
+
+struct TimetableCache_Reload {
+    // This 'struct' provides the reload function of the reloader of a
+    // timetable cache.
+
+    // DATA
+    TimetableCache *d_cache_p;  // cache whose timetables are reloaded
+                                // (held, not owned)
+
+    // CREATORS
+    explicit TimetableCache_Reload(TimetableCache *cache)
+        // Create a reload function for the specified 'cache'.
+    : d_cache_p(cache)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(const char *timetableName) const
+        // Reload, into the cache held by this object, the timetable having
+        // the specified 'timetableName'.
+    {
+        d_cache_p->reload(timetableName);
+    }
+};
+
                         // --------------------------
                         // class TimetableCache_Entry
                         // --------------------------
@@ -28,6 +72,7 @@ namespace bdlt {
 TimetableCache_Entry::TimetableCache_Entry()
 : d_ptr()
 , d_loadTime()
+, d_isReloadRequested(false)
 {
 }
 
@@ -36,6 +81,7 @@ TimetableCache_Entry::TimetableCache_Entry(Timetable        *timetable,
                                            bslma::Allocator *allocator)
 : d_ptr(timetable, allocator)
 , d_loadTime(loadTime)
+, d_isReloadRequested(false)
 {
     BSLS_ASSERT(timetable);
     BSLS_ASSERT(allocator);
@@ -45,6 +91,7 @@ TimetableCache_Entry::TimetableCache_Entry(
                                           const TimetableCache_Entry& original)
 : d_ptr(original.d_ptr)
 , d_loadTime(original.d_loadTime)
+, d_isReloadRequested(original.d_isReloadRequested.load())
 {
 }
 
@@ -56,8 +103,9 @@ TimetableCache_Entry::~TimetableCache_Entry()
 TimetableCache_Entry& TimetableCache_Entry::operator=(
                                                const TimetableCache_Entry& rhs)
 {
-    d_ptr      = rhs.d_ptr;
-    d_loadTime = rhs.d_loadTime;
+    d_ptr               = rhs.d_ptr;
+    d_loadTime          = rhs.d_loadTime;
+    d_isReloadRequested = rhs.d_isReloadRequested.load();
 
     return *this;
 }
@@ -68,23 +116,162 @@ bsl::shared_ptr<const Timetable> TimetableCache_Entry::get() const
     return d_ptr;
 }
 
+bool TimetableCache_Entry::isReloadRequested() const
+{
+    return d_isReloadRequested;
+}
+
 Datetime TimetableCache_Entry::loadTime() const
 {
     return d_loadTime;
 }
 
+bool TimetableCache_Entry::requestReload() const
+{
+    return !d_isReloadRequested && !d_isReloadRequested.swap(true);
+}
+
                            // --------------------
                            // class TimetableCache
                            // --------------------
 
+// PRIVATE CLASS METHODS
+const TimetableCache_Entry *TimetableCache::findEntry(
+                                                    const Cache *cache,
+                                                    const char  *timetableName)
+{
+    BSLS_ASSERT(timetableName);
+
+    if (0 == cache) {
+        return 0;                                                     // RETURN
+    }
+
+    // Binary search, comparing names without creating a temporary string.
+
+    Cache::const_iterator first = cache->begin();
+    bsl::size_t           count = cache->size();
+
+    while (0 < count) {
+        const bsl::size_t           half = count / 2;
+        const Cache::const_iterator mid  = first + half;
+
+        if (mid->first < timetableName) {
+            first  = mid + 1;
+            count -= half + 1;
+        }
+        else {
+            count  = half;
+        }
+    }
+
+    return first != cache->end() && first->first == timetableName
+           ? &first->second
+           : 0;
+}
+
+// PRIVATE MANIPULATORS
+void TimetableCache::insertEntry(const char                  *timetableName,
+                                 const TimetableCache_Entry&  entry,
+                                 const TimetableCache_Entry  *cached)
+{
+    BSLS_ASSERT(timetableName);
+
+    const Cache *cache = d_cache_p.loadRelaxed();
+
+    Cache *newCache = new (*d_allocator_p) Cache(d_allocator_p);
+
+    bslma::RawDeleterProctor<Cache, bslma::Allocator> proctor(newCache,
+                                                              d_allocator_p);
+
+    if (cache) {
+        newCache->reserve(cache->size() + 1);
+        *newCache = *cache;
+    }
+
+    Cache::iterator iter = newCache->begin();
+    while (iter != newCache->end() && iter->first < timetableName) {
+        ++iter;
+    }
+
+    if (cached) {
+        iter->second = entry;
+    }
+    else {
+        newCache->insert(iter,
+                         CacheEntry(bsl::string(timetableName, d_allocator_p),
+                                    entry));
+    }
+
+    proctor.release();
+
+    publish(newCache);
+}
+
+void TimetableCache::publish(Cache *cache)
+{
+    Cache *previous = d_cache_p.swap(cache);
+
+    d_readers.synchronize();
+
+    if (previous) {
+        d_allocator_p->deleteObject(previous);
+    }
+}
+
+void TimetableCache::reload(const char *timetableName)
+{
+    BSLS_ASSERT(timetableName);
+
+    Timetable *timetablePtr = new (*d_allocator_p) Timetable(d_allocator_p);
+
+    const Datetime timestamp = CurrentTime::utc();
+
+    TimetableCache_Entry entry(timetablePtr, timestamp, d_allocator_p);
+
+    if (d_loader_p->load(timetablePtr, timetableName)) {
+        return;                                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+
+    const TimetableCache_Entry *cached = findEntry(d_cache_p.loadRelaxed(),
+                                                   timetableName);
+
+    if (cached && cached->isReloadRequested()) {
+        insertEntry(timetableName, entry, cached);
+    }
+}
+
+// PRIVATE ACCESSORS
+int TimetableCache::acquireSnapshot(const Cache **cache) const
+{
+    BSLS_ASSERT(cache);
+
+    const int token = d_readers.acquire();
+
+    *cache = d_cache_p;
+
+    return token;
+}
+
+bool TimetableCache::hasExpired(const TimetableCache_Entry& entry) const
+{
+    return d_hasTimeOutFlag
+        && d_timeOut <= CurrentTime::utc() - entry.loadTime();
+}
+
 // CREATORS
 TimetableCache::TimetableCache(TimetableLoader  *loader,
                                bslma::Allocator *basicAllocator)
-: d_cache(basicAllocator)
+: d_cache_p(0)
+, d_readers()
 , d_loader_p(loader)
 , d_timeOut(0)
+, d_reloadAge(0)
 , d_hasTimeOutFlag(false)
+, d_reloadMode(e_RELOAD_ON_DEMAND)
 , d_lock()
+, d_reloader(TimetableCache_Reload(this), basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT(loader);
@@ -93,11 +280,35 @@ TimetableCache::TimetableCache(TimetableLoader  *loader,
 TimetableCache::TimetableCache(TimetableLoader           *loader,
                                const bsls::TimeInterval&  timeout,
                                bslma::Allocator          *basicAllocator)
-: d_cache(basicAllocator)
+: d_cache_p(0)
+, d_readers()
 , d_loader_p(loader)
 , d_timeOut(0, 0, 0, 0, timeout.totalMilliseconds())
+, d_reloadAge(0)
 , d_hasTimeOutFlag(true)
+, d_reloadMode(e_RELOAD_ON_DEMAND)
 , d_lock()
+, d_reloader(TimetableCache_Reload(this), basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(loader);
+    BSLS_ASSERT(bsls::TimeInterval() <= timeout);
+    BSLS_ASSERT(timeout <= bsls::TimeInterval(INT_MAX, 0));
+}
+
+TimetableCache::TimetableCache(TimetableLoader           *loader,
+                               const bsls::TimeInterval&  timeout,
+                               ReloadMode                 reloadMode,
+                               bslma::Allocator          *basicAllocator)
+: d_cache_p(0)
+, d_readers()
+, d_loader_p(loader)
+, d_timeOut(0, 0, 0, 0, timeout.totalMilliseconds())
+, d_reloadAge(0, 0, 0, 0, timeout.totalMilliseconds() / 2)
+, d_hasTimeOutFlag(true)
+, d_reloadMode(reloadMode)
+, d_lock()
+, d_reloader(TimetableCache_Reload(this), basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT(loader);
@@ -107,6 +318,15 @@ TimetableCache::TimetableCache(TimetableLoader           *loader,
 
 TimetableCache::~TimetableCache()
 {
+    // Join the reload thread before destroying what it uses.
+
+    d_reloader.stop();
+
+    Cache *cache = d_cache_p;
+
+    if (cache) {
+        d_allocator_p->deleteObject(cache);
+    }
 }
 
 // MANIPULATORS
@@ -116,19 +336,29 @@ TimetableCache::getTimetable(const char *timetableName)
     BSLS_ASSERT(timetableName);
 
     {
-        bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+        const Cache *cache;
+        const int    token = acquireSnapshot(&cache);
 
-        CacheIterator iter = d_cache.find(timetableName);
+        const TimetableCache_Entry *entry = findEntry(cache, timetableName);
 
-        if (iter != d_cache.end()) {
-            if (   !d_hasTimeOutFlag
-                || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-                return iter->second.get();                            // RETURN
-            }
-            else {
-                d_cache.erase(iter);
+        if (entry && !hasExpired(*entry)) {
+            bsl::shared_ptr<const Timetable> timetable = entry->get();
+
+            const bool isReloadNeeded =
+                      e_RELOAD_IN_BACKGROUND == d_reloadMode
+                   && d_reloadAge <= CurrentTime::utc() - entry->loadTime()
+                   && entry->requestReload();
+
+            d_readers.release(token);
+
+            if (isReloadNeeded) {
+                d_reloader.requestReload(timetableName);
             }
+
+            return timetable;                                         // RETURN
         }
+
+        d_readers.release(token);
     }
 
     // Create out-of-place timetable that will be managed by 'bsl::shared_ptr'.
@@ -150,18 +380,19 @@ TimetableCache::getTimetable(const char *timetableName)
 
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    ConstCacheIterator iter = d_cache.find(timetableName);
-
     // Here, we assume that the time elapsed between the last check and the
     // loading of the timetable is insignificant compared to the timeout, so we
-    // will simply return the entry in the cache if it has been inserted by
-    // another thread.
+    // will simply return the entry in the cache if it has been (re)loaded by
+    // another thread and has not expired.
+
+    const TimetableCache_Entry *cached = findEntry(d_cache_p.loadRelaxed(),
+                                                   timetableName);
 
-    if (iter != d_cache.end()) {
-        return iter->second.get();                                    // RETURN
+    if (cached && !hasExpired(*cached)) {
+        return cached->get();                                         // RETURN
     }
 
-    d_cache[timetableName] = entry;
+    insertEntry(timetableName, entry, cached);
 
     return entry.get();
 }
@@ -172,24 +403,52 @@ int TimetableCache::invalidate(const char *timetableName)
 
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    CacheIterator iter = d_cache.find(timetableName);
+    const Cache *cache = d_cache_p.loadRelaxed();
 
-    if (iter != d_cache.end()) {
-        d_cache.erase(iter);
+    if (!findEntry(cache, timetableName)) {
+        return 0;                                                     // RETURN
+    }
+
+    Cache *newCache = 0;
+
+    if (1 < cache->size()) {
+        newCache = new (*d_allocator_p) Cache(d_allocator_p);
+
+        bslma::RawDeleterProctor<Cache, bslma::Allocator> proctor(
+                                                                newCache,
+                                                                d_allocator_p);
+
+        newCache->reserve(cache->size() - 1);
+
+        for (Cache::const_iterator iter = cache->begin();
+             iter != cache->end();
+             ++iter) {
+            if (iter->first != timetableName) {
+                newCache->push_back(*iter);
+            }
+        }
 
-        return 1;                                                     // RETURN
+        proctor.release();
     }
 
-    return 0;
+    publish(newCache);
+
+    return 1;
 }
 
 int TimetableCache::invalidateAll()
 {
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    const int numInvalidated = static_cast<int>(d_cache.size());
+    const Cache *cache = d_cache_p.loadRelaxed();
+
+    if (0 == cache) {
+        return 0;                                                     // RETURN
+    }
+
+    const int numInvalidated = static_cast<int>(cache->size());
 
-    d_cache.clear();
+    publish(0);
 
     return numInvalidated;
 }
@@ -200,42 +459,40 @@ TimetableCache::lookupTimetable(const char *timetableName) const
 {
     BSLS_ASSERT(timetableName);
 
-    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+    bsl::shared_ptr<const Timetable> timetable;
 
-    CacheIterator iter = d_cache.find(timetableName);
+    const Cache *cache;
+    const int    token = acquireSnapshot(&cache);
 
-    if (iter != d_cache.end()) {
-        if (   !d_hasTimeOutFlag
-            || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-            return iter->second.get();                                // RETURN
-        }
-        else {
-            d_cache.erase(iter);
-        }
+    const TimetableCache_Entry *entry = findEntry(cache, timetableName);
+
+    if (entry && !hasExpired(*entry)) {
+        timetable = entry->get();
     }
 
-    return bsl::shared_ptr<const Timetable>();
+    d_readers.release(token);
+
+    return timetable;
 }
 
 Datetime TimetableCache::lookupLoadTime(const char *timetableName) const
 {
     BSLS_ASSERT(timetableName);
 
-    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+    Datetime loadTime;
 
-    CacheIterator iter = d_cache.find(timetableName);
+    const Cache *cache;
+    const int    token = acquireSnapshot(&cache);
 
-    if (iter != d_cache.end()) {
-        if (   !d_hasTimeOutFlag
-            || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-            return iter->second.loadTime();                           // RETURN
-        }
-        else {
-            d_cache.erase(iter);
-        }
+    const TimetableCache_Entry *entry = findEntry(cache, timetableName);
+
+    if (entry && !hasExpired(*entry)) {
+        loadTime = entry->loadTime();
     }
 
-    return Datetime();
+    d_readers.release(token);
+
+    return loadTime;
 }
 
 }  // close package namespace
@@ -54,6 +54,46 @@ BSLS_IDENT("$Id: $")
 // an empty 'bsl::shared_ptr<const bdlt::Timetable>' is returned if the
 // requested timetable is found to have expired.
 //
+///Lock-Free Retrieval
+///-------------------
+// Timetables are loaded and invalidated rarely, and retrieved very frequently,
+// often from many threads at once.  Retrieving a timetable that is present in
+// the cache, and has not expired, therefore takes no lock: the cache
+// publishes, through an atomic pointer, an immutable snapshot of its
+// timetables, sorted by name, that 'getTimetable', 'lookupTimetable', and
+// 'lookupLoadTime' search without modifying it.
+//
+// Loading, reloading, and invalidating timetables are serialized by a mutex
+// that retrievals never acquire.  A timetable is loaded without holding that
+// mutex; the snapshot is then copied, modified, and published in place of the
+// current one.  The thread that publishes a snapshot waits until no thread can
+// still be searching the snapshot it replaced before destroying it, which
+// releases the references it holds to invalidated and expired timetables.
+// Each retrieval announces itself by incrementing the reader count of the
+// current "epoch" in a cache-line-sized *reader* *slot* assigned to the
+// calling thread; the cache has one such slot for each of up to twice as many
+// threads as there are hardware threads, so that retrievals on different
+// threads do not write to the same cache line.  Publishing a snapshot
+// switches the epoch, and waits, scanning every slot, only for the readers of
+// the previous epoch, whose searches take a few comparisons.  Note that, since
+// timetables are returned by shared pointer, a retrieval also modifies the
+// reference count of the timetable it returns.
+//
+///Background Reloading
+///--------------------
+// A cache having a timeout can be constructed to reload its timetables in the
+// background ('e_RELOAD_IN_BACKGROUND').  In that mode, a 'getTimetable' call
+// that finds its timetable in the cache, loaded at least half the timeout ago,
+// returns that timetable at once and requests that it be reloaded by a thread
+// owned by the cache, which is created on the first such request.  Once
+// loaded, the new timetable replaces the old one in the cache, so that a
+// timetable that is retrieved regularly is reloaded before it expires, and
+// 'getTimetable' rarely has to load it.  A timetable is reloaded at most once
+// per load, and a timetable that is invalidated, or reloaded by
+// 'getTimetable', while its background reload is in progress is left as is.
+// If the loader fails, the timetable is left in the cache until it expires.
+// Note that 'lookupTimetable' and 'lookupLoadTime' never request a reload.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlt::TimetableCache' class is fully thread-safe (see
@@ -232,6 +272,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlt_cacheimp.h>
 #include <bdlt_timetable.h>
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
@@ -243,29 +284,32 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_mutex.h>
 
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 
-#include <bsl_map.h>
 #include <bsl_memory.h>  // 'bsl::shared_ptr'
 #include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlt {
 
 class TimetableLoader;
 class TimetableCache_Entry;
+struct TimetableCache_Reload;
 
                         // ==========================
                         // class TimetableCache_Entry
                         // ==========================
 
-// IMPLEMENTATION NOTE: The Sun Studio 12.3 compiler does not support 'map's
-// holding types that are incomplete at the point of declaration of a data
-// member.  Other compilers allow us to complete 'TimetableCache_Entry' at a
-// later point in the code, but before any operation (such as 'insert') that
-// would require the type to be complete.  If we did not have to support this
-// compiler, this whole class could be defined in the .cpp file; as it stands,
-// it *must* be defined before class 'TimetableCache'.
+// IMPLEMENTATION NOTE: The Sun Studio 12.3 compiler does not support
+// containers holding types that are incomplete at the point of declaration of
+// a data member.  Other compilers allow us to complete 'TimetableCache_Entry'
+// at a later point in the code, but before any operation (such as 'insert')
+// that would require the type to be complete.  If we did not have to support
+// this compiler, this whole class could be defined in the .cpp file; as it
+// stands, it *must* be defined before class 'TimetableCache'.
 
 class TimetableCache_Entry {
     // This class defines the type of objects that are inserted into the
@@ -280,6 +324,11 @@ class TimetableCache_Entry {
     Datetime                         d_loadTime;  // time when timetable was
                                                   // loaded
 
+    mutable bsls::AtomicBool         d_isReloadRequested;
+                                                  // 'true' if a background
+                                                  // reload of the timetable
+                                                  // has been requested
+
   public:
     // CREATORS
     TimetableCache_Entry();
@@ -312,9 +361,20 @@ class TimetableCache_Entry {
         // Return a shared pointer providing non-modifiable access to the
         // timetable referred to by this cache entry object.
 
+    bool isReloadRequested() const;
+        // Return 'true' if a background reload of the timetable referred to by
+        // this cache entry object has been requested, and 'false' otherwise.
+
     Datetime loadTime() const;
         // Return the time at which the timetable referred to by this cache
         // entry object was loaded.
+
+    bool requestReload() const;
+        // Record that a background reload of the timetable referred to by this
+        // cache entry object has been requested.  Return 'true' if no such
+        // reload had been requested before this call, and 'false' otherwise.
+        // Note that this method may be called on an entry of a published
+        // snapshot.
 };
 
                            // ====================
@@ -341,32 +401,116 @@ class TimetableCache {
     //
     // This class is fully thread-safe (see 'bsldoc_glossary').
 
+  public:
+    // TYPES
+    enum ReloadMode {
+        // Enumerate the ways in which expiring timetables are reloaded.
+
+        e_RELOAD_ON_DEMAND,     // an expired timetable is reloaded by the
+                                // 'getTimetable' call that finds it expired
+
+        e_RELOAD_IN_BACKGROUND  // in addition, a timetable retrieved by
+                                // 'getTimetable' in the second half of its
+                                // lifetime is reloaded by a background thread
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::pair<bsl::string, TimetableCache_Entry> CacheEntry;
+
+    typedef bsl::vector<CacheEntry>                      Cache;
+        // A snapshot of the cache: (name, handle) pairs sorted by name, that
+        // are not modified once the snapshot is published.
+
     // DATA
-    mutable bsl::map<bsl::string, TimetableCache_Entry>
-                           d_cache;           // cache of (name, handle) pairs
+    bsls::AtomicPointer<Cache>     d_cache_p;         // current snapshot, or
+                                                      // 0 if the cache is
+                                                      // empty (owned)
 
-    TimetableLoader       *d_loader_p;        // timetable loader (held, not
-                                              // owned)
+    mutable CacheImp_ReaderEpochs  d_readers;         // counts the threads
+                                                      // searching a snapshot
 
-    DatetimeInterval       d_timeOut;         // timeout value; ignored unless
-                                              // 'd_hasTimeOutFlag' is 'true'
+    TimetableLoader               *d_loader_p;        // timetable loader
+                                                      // (held, not owned)
 
-    bool                   d_hasTimeOutFlag;  // 'true' if this cache has a
-                                              // timeout value and 'false'
-                                              // otherwise
+    DatetimeInterval               d_timeOut;         // timeout value;
+                                                      // ignored unless
+                                                      // 'd_hasTimeOutFlag' is
+                                                      // 'true'
 
-    mutable bslmt::Mutex   d_lock;            // guard access to cache
+    DatetimeInterval               d_reloadAge;       // age at which
+                                                      // 'getTimetable'
+                                                      // requests a
+                                                      // background reload;
+                                                      // ignored unless
+                                                      // reloading in the
+                                                      // background
 
-    bslma::Allocator      *d_allocator_p;     // memory allocator (held, not
-                                              // owned)
+    bool                           d_hasTimeOutFlag;  // 'true' if this cache
+                                                      // has a timeout value
+                                                      // and 'false' otherwise
 
-  private:
-    // PRIVATE TYPES
-    typedef bsl::map<bsl::string, TimetableCache_Entry>::iterator
-                                                                 CacheIterator;
+    ReloadMode                     d_reloadMode;      // how expiring
+                                                      // timetables are
+                                                      // reloaded
 
-    typedef bsl::map<bsl::string, TimetableCache_Entry>::const_iterator
-                                                            ConstCacheIterator;
+    bslmt::Mutex                   d_lock;            // serializes
+                                                      // modifications of the
+                                                      // cache
+
+    CacheImp_Reloader              d_reloader;        // reloads timetables in
+                                                      // the background
+
+    bslma::Allocator              *d_allocator_p;     // memory allocator
+                                                      // (held, not owned)
+
+    // FRIENDS
+    friend struct TimetableCache_Reload;
+
+  private:
+    // PRIVATE CLASS METHODS
+    static const TimetableCache_Entry *findEntry(
+                                                   const Cache *cache,
+                                                   const char  *timetableName);
+        // Return the address of the entry having the specified 'timetableName'
+        // in the specified 'cache', and 0 if 'cache' is 0 or has no such
+        // entry.
+
+    // PRIVATE MANIPULATORS
+    void insertEntry(const char                  *timetableName,
+                     const TimetableCache_Entry&  entry,
+                     const TimetableCache_Entry  *cached);
+        // Publish a copy of the current snapshot of this object in which the
+        // specified 'entry' is associated with the specified 'timetableName',
+        // replacing the specified 'cached' entry unless 'cached' is 0.  The
+        // behavior is undefined unless 'd_lock' is held by the calling thread,
+        // and 'cached' is the address of the entry having 'timetableName' in
+        // the current snapshot, or 0 if there is no such entry.
+
+    void publish(Cache *cache);
+        // Make the specified 'cache' the current snapshot of this object, and
+        // destroy the snapshot it replaces once no thread can be searching
+        // that snapshot.  The behavior is undefined unless 'd_lock' is held by
+        // the calling thread, and 'cache' is 0 or was allocated using the
+        // allocator of this object.
+
+    void reload(const char *timetableName);
+        // Load the timetable having the specified 'timetableName', and replace
+        // the entry having 'timetableName' in this cache with the loaded
+        // timetable if a background reload of that entry has been requested.
+        // If the loader fails, or if that entry has been invalidated or
+        // replaced since the request, this method has no effect.
+
+    // PRIVATE ACCESSORS
+    int acquireSnapshot(const Cache **cache) const;
+        // Load into the specified 'cache' the current snapshot of this object,
+        // which remains valid until 'd_readers.release' is called with the
+        // returned token.
+
+    bool hasExpired(const TimetableCache_Entry& entry) const;
+        // Return 'true' if this cache has a timeout, and the timetable
+        // referred to by the specified 'entry' was loaded at least that
+        // timeout ago, and 'false' otherwise.
 
   private:
     // NOT IMPLEMENTED
@@ -404,8 +548,25 @@ class TimetableCache {
         // loaded into the cache by *each* (successful) call to the
         // 'getTimetable' method.
 
+    TimetableCache(TimetableLoader           *loader,
+                   const bsls::TimeInterval&  timeout,
+                   ReloadMode                 reloadMode,
+                   bslma::Allocator          *basicAllocator = 0);
+        // Create an empty timetable cache that uses the specified 'loader' to
+        // load timetables on demand, has the specified 'timeout' interval
+        // indicating the length of time that timetables remain valid for
+        // subsequent retrieval from the cache after they have been loaded,
+        // and reloads expiring timetables as indicated by the specified
+        // 'reloadMode' (see {Background Reloading}).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless
+        // 'bsls::TimeInterval() <= timeout <= bsls::TimeInterval(INT_MAX, 0)',
+        // and 'loader' remains valid throughout the lifetime of this cache.
+
     ~TimetableCache();
-        // Destroy this object.
+        // Destroy this object, after waiting for any background reload in
+        // progress to complete.
 
     // MANIPULATORS
     bsl::shared_ptr<const Timetable> getTimetable(const char *timetableName);
@@ -416,7 +577,10 @@ class TimetableCache {
         // in the cache or if the timetable has expired (i.e., per a timeout
         // optionally supplied at construction).  If the loader fails, whether
         // in loading a timetable for the first time or in reloading a
-        // timetable that has expired, return an empty shared pointer.
+        // timetable that has expired, return an empty shared pointer.  If this
+        // cache reloads timetables in the background, and the timetable in the
+        // cache was loaded at least half the timeout ago, also request that it
+        // be reloaded in the background (see {Background Reloading}).
 
     int invalidate(const char *timetableName);
         // Invalidate the timetable having the specified 'timetableName' in
@@ -19,6 +19,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -72,6 +73,7 @@ using namespace bsl;
 // 'TimetableCache' class:
 // [ 2] TimetableCache(Loader *loader,          Allocator *ba = 0);
 // [ 2] TimetableCache(Loader *loader, timeout, Allocator *ba = 0);
+// [ 8] TimetableCache(Loader *loader, timeout, mode, Allocator *ba = 0);
 // [ 2] ~TimetableCache();
 // [ 3] shared_ptr<const Timetable> getTimetable(const char *name);
 // [ 4] int invalidate(const char *name);
@@ -80,11 +82,13 @@ using namespace bsl;
 // [ 3] Datetime lookupLoadTime(const char *name) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [ *] CONCERN: Precondition violations are detected when enabled.
 // [ 5] CONCERN: All memory allocation is exception neutral.
 // [ 6] CONCERN: All manipulators and accessors are thread-safe.
+// [ 7] CONCERN: Retrieval is safe while the cache is modified.
+// [ 8] CONCERN: Timetables are reloaded in the background if requested.
 // [-1] CONCERN: A non-trivial timeout is processed correctly.
 
 // ============================================================================
@@ -320,6 +324,17 @@ void sleepSeconds(int seconds)
 #endif
 }
 
+static
+void sleepMilliseconds(int milliseconds)
+    // Sleep for the specified number of 'milliseconds'.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    Sleep(milliseconds);
+#else
+    usleep(milliseconds * 1000);
+#endif
+}
+
 namespace TestCase6 {
 
 struct ThreadInfo {
@@ -650,6 +665,88 @@ extern "C" void *threadFunction3(void *arg)
 
 }  // close namespace TestCase6
 
+namespace TestCase7 {
+
+struct ThreadInfo {
+    int              d_numIterations;
+    Obj             *d_cache_p;
+    bsls::AtomicInt *d_numReadersDone_p;
+};
+
+extern "C" void *readerFunction(void *arg)
+    // Repeatedly retrieve the timetables of the cache referred to by the
+    // specified 'arg', which is the address of a 'ThreadInfo', and verify
+    // their values.
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    Obj& mX = *info->d_cache_p;  const Obj& X = mX;
+
+    static const char *const NAMES[] = { "CAL-1", "CAL-2", "CAL-3" };
+
+    static const bdlt::Date *const FIRST_DATES[] = {
+        &gFirstDate1, &gFirstDate2, &gFirstDate3
+    };
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        const int k = i % 3;
+
+        Entry e = X.lookupTimetable(NAMES[k]);
+        if (e.get()) {
+            ASSERTV(k, *FIRST_DATES[k] == e->firstDate());
+            ASSERTV(k, 1 == e->transitionCodeInEffect(
+                                                Datetime(*FIRST_DATES[k])));
+        }
+
+        Datetime d = X.lookupLoadTime(NAMES[k]);
+        ASSERTV(k, d <= bdlt::CurrentTime::utc());
+
+        if (0 == i % 5) {
+            e = mX.getTimetable(NAMES[k]);
+            ASSERTV(k, e.get());
+            if (e.get()) {
+                ASSERTV(k, *FIRST_DATES[k] == e->firstDate());
+            }
+        }
+    }
+
+    ++*info->d_numReadersDone_p;
+
+    return arg;
+}
+
+extern "C" void *writerFunction(void *arg)
+    // Repeatedly invalidate and reload the timetables of the cache referred to
+    // by the specified 'arg', which is the address of a 'ThreadInfo', until
+    // the readers are done.
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    Obj& mX = *info->d_cache_p;
+
+    for (int i = 0; 0 == *info->d_numReadersDone_p; ++i) {
+        switch (i % 4) {
+          case 0: {
+            mX.invalidate("CAL-1");
+          } break;
+          case 1: {
+            mX.getTimetable("CAL-1");
+            mX.invalidate("CAL-2");
+          } break;
+          case 2: {
+            mX.getTimetable("CAL-2");
+          } break;
+          default: {
+            mX.invalidateAll();
+          } break;
+        }
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase7
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -736,7 +833,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -936,6 +1033,251 @@ int main(int argc, char *argv[])
 //..
         }
 
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // BACKGROUND RELOADING
+        //   Ensure that a cache constructed to reload its timetables in the
+        //   background does so.
+        //
+        // Concerns:
+        //: 1 'getTimetable' on a timetable loaded less than half the timeout
+        //:   ago returns the cached timetable and does not request a reload.
+        //:
+        //: 2 'getTimetable' on a timetable loaded at least half the timeout
+        //:   ago returns the cached timetable, and the timetable is then
+        //:   replaced in the cache by a newly-loaded one.
+        //:
+        //: 3 'lookupTimetable' and 'lookupLoadTime' never request a reload.
+        //:
+        //: 4 A cache constructed with 'e_RELOAD_ON_DEMAND' never reloads a
+        //:   timetable in the background.
+        //:
+        //: 5 A cache can be destroyed while a reload is pending, and no memory
+        //:   is leaked.
+        //
+        // Plan:
+        //: 1 Create a cache having a 1-second timeout that reloads timetables
+        //:   in the background, load a timetable, and retrieve it again at
+        //:   once; verify that its load time is unchanged.  (C-1)
+        //:
+        //: 2 Sleep for more than half the timeout, retrieve the timetable
+        //:   using 'lookupTimetable', sleep briefly, and verify that its load
+        //:   time is unchanged.  (C-3)
+        //:
+        //: 3 Retrieve the timetable using 'getTimetable', and verify that the
+        //:   cached timetable is returned.  Wait for the load time of the
+        //:   timetable to change, and verify that the timetable now in the
+        //:   cache is a different object having the same value.  (C-2)
+        //:
+        //: 4 Repeat P-1..3 using a cache constructed with
+        //:   'e_RELOAD_ON_DEMAND', and verify that the load time does not
+        //:   change.  (C-4)
+        //:
+        //: 5 Request a reload and destroy the cache at once.  Verify that
+        //:   all memory allocated by the caches, and by the loads, has been
+        //:   released.  (C-5)
+        //
+        // Testing:
+        //   TimetableCache(Loader *loader, timeout, mode, Allocator *ba = 0);
+        //   CONCERN: Timetables are reloaded in the background if requested.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BACKGROUND RELOADING" << endl
+                          << "====================" << endl;
+
+        TestLoader loader;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const Interval TIMEOUT(1, 0);
+
+        if (verbose) cout << "\nReloading in the background." << endl;
+        {
+            Obj mX(&loader, TIMEOUT, Obj::e_RELOAD_IN_BACKGROUND, &sa);
+            const Obj& X = mX;
+
+            Entry e1 = mX.getTimetable("CAL-1");  ASSERT(e1.get());
+
+            const Datetime loadTime = X.lookupLoadTime("CAL-1");
+
+            ASSERT(Datetime() != loadTime);
+
+            Entry e2 = mX.getTimetable("CAL-1");  ASSERT(e2.get() == e1.get());
+
+            sleepMilliseconds(600);
+
+            Entry e3 = X.lookupTimetable("CAL-1");
+                                                 ASSERT(e3.get() == e1.get());
+
+            sleepMilliseconds(100);
+
+            ASSERT(loadTime == X.lookupLoadTime("CAL-1"));
+
+            Entry e4 = mX.getTimetable("CAL-1");  ASSERT(e4.get() == e1.get());
+
+            // Wait for the reload; the old timetable expires after 1 second.
+
+            int numWaits = 0;
+            while (loadTime == X.lookupLoadTime("CAL-1") && 100 > numWaits) {
+                sleepMilliseconds(10);
+                ++numWaits;
+            }
+
+            const Datetime reloadTime = X.lookupLoadTime("CAL-1");
+
+            ASSERTV(numWaits, reloadTime, loadTime,  reloadTime > loadTime);
+
+            Entry e5 = X.lookupTimetable("CAL-1");
+
+            ASSERT(e5.get());
+            ASSERT(e5.get() != e1.get());
+            if (e5.get()) {
+                ASSERT(*e1 == *e5);
+            }
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\nReloading on demand." << endl;
+        {
+            Obj mX(&loader, TIMEOUT, Obj::e_RELOAD_ON_DEMAND, &sa);
+            const Obj& X = mX;
+
+            Entry e1 = mX.getTimetable("CAL-2");  ASSERT(e1.get());
+
+            const Datetime loadTime = X.lookupLoadTime("CAL-2");
+
+            sleepMilliseconds(600);
+
+            Entry e2 = mX.getTimetable("CAL-2");  ASSERT(e2.get() == e1.get());
+
+            sleepMilliseconds(100);
+
+            ASSERT(loadTime == X.lookupLoadTime("CAL-2"));
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\nDestroying with a pending reload." << endl;
+        {
+            Obj mX(&loader, TIMEOUT, Obj::e_RELOAD_IN_BACKGROUND, &sa);
+
+            Entry e1 = mX.getTimetable("CAL-3");  ASSERT(e1.get());
+
+            sleepMilliseconds(600);
+
+            Entry e2 = mX.getTimetable("CAL-3");  ASSERT(e2.get() == e1.get());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // LOCK-FREE RETRIEVAL
+        //   Ensure that timetables can be retrieved safely while the cache is
+        //   being modified, and that replaced snapshots are released.
+        //
+        // Concerns:
+        //: 1 Retrieving a timetable while other threads invalidate and reload
+        //:   timetables yields either no timetable or a timetable having the
+        //:   expected value.
+        //:
+        //: 2 The snapshot replaced by a modification of the cache, and the
+        //:   timetables that are no longer referred to, are released before
+        //:   the modification returns.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Create several threads that repeatedly retrieve timetables from a
+        //:   cache, and verify their values, while another thread repeatedly
+        //:   invalidates and reloads timetables.  (C-1)
+        //:
+        //: 2 In a single thread, load timetables, invalidate them, and verify
+        //:   that the memory in use by the cache's allocator decreases to
+        //:   none once no timetable is referred to.  (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: Retrieval is safe while the cache is modified.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOCK-FREE RETRIEVAL" << endl
+                          << "===================" << endl;
+
+        using namespace TestCase7;
+
+        TestLoader loader;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nRetrieving while modifying." << endl;
+        {
+            enum { k_NUM_READERS = 4 };
+
+            Obj mX(&loader, &sa);
+
+            bsls::AtomicInt numReadersDone(0);
+
+            ThreadInfo info = { 20000, &mX, &numReadersDone };
+
+            ThreadId readers[k_NUM_READERS];
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                readers[i] = createThread(&readerFunction, &info);
+            }
+            ThreadId writer = createThread(&writerFunction, &info);
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                joinThread(readers[i]);
+            }
+            joinThread(writer);
+
+            ASSERTV(numReadersDone, k_NUM_READERS == numReadersDone);
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\nReleasing replaced snapshots." << endl;
+        {
+            Obj mX(&loader, &sa);  const Obj& X = mX;
+
+            {
+                Entry e1 = mX.getTimetable("CAL-1");
+                Entry e2 = mX.getTimetable("CAL-2");
+                Entry e3 = mX.getTimetable("CAL-3");
+
+                ASSERT(e1.get() && e2.get() && e3.get());
+            }
+
+            const bsls::Types::Int64 numBlocksInUse = sa.numBlocksInUse();
+
+            ASSERT(1 == mX.invalidate("CAL-2"));
+            ASSERT(!X.lookupTimetable("CAL-2").get());
+            ASSERT( X.lookupTimetable("CAL-3").get());
+
+            ASSERTV(numBlocksInUse, sa.numBlocksInUse(),
+                    numBlocksInUse > sa.numBlocksInUse());
+
+            {
+                Entry e1 = X.lookupTimetable("CAL-1");
+
+                ASSERT(2 == mX.invalidateAll());
+                ASSERTV(sa.numBlocksInUse(), 0 < sa.numBlocksInUse());
+
+                ASSERT(e1.get());
+                ASSERT(gFirstDate1 == e1->firstDate());
+            }
+            ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        }
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -13,7 +13,45 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component, 'bslalg_numericformatterutil' provides a
 // namespace 'struct', 'bslalg::NumericFormatterUtil', containing the template
 // function 'toChars', that translates integral fundamental types into ASCII
-// strings.
+// strings, and overloads of 'toChars' that translate 'double' and 'float'
+// values into ASCII strings.
+//
+///Floating Point Formatting
+///-------------------------
+// The 'toChars' overloads for 'double' and 'float' implement those of
+// 'std::to_chars' in C++17: they are locale-independent, do not allocate
+// memory, and produce the same output as 'printf' in the "C" locale.  Three
+// families of overloads are provided:
+//
+//: o 'toChars(first, last, value)' writes the *shortest* representation of
+//:   'value' that reads back ('strtod', 'bsl::from_chars') as 'value', in
+//:   fixed notation ("123.45") or scientific notation ("1.2345e+22"),
+//:   whichever is shorter, preferring fixed notation in case of a tie.
+//:
+//: o 'toChars(first, last, value, format)' writes the shortest representation
+//:   of 'value' in the specified 'format': 'e_FIXED', 'e_SCIENTIFIC', or
+//:   'e_GENERAL' (which selects fixed notation if the decimal exponent of
+//:   'value' is in '[ -4 .. 6 )', as does the '%g' conversion of 'printf'
+//:   with its default precision, and scientific notation otherwise).
+//:
+//: o 'toChars(first, last, value, format, precision)' writes 'value' as does
+//:   'printf' with the conversion '%.*f', '%.*e', or '%.*g', respectively,
+//:   rounding the exact value of 'value' to 'precision' digits (to nearest,
+//:   ties to even).
+//
+// Infinite values are written as "inf" and "-inf", and NaN values as "nan"
+// (or "-nan", if the sign bit of the value is set).
+//
+// The shortest representation is computed with the Schubfach algorithm
+// (Raffaello Giulietti, "The Schubfach way to render doubles", 2020), which,
+// as the Ryu algorithm, needs neither arbitrary-precision arithmetic nor
+// iteration, and is several times faster than 'sprintf' with "%.17g".  A
+// value written with a precision is first converted exactly to decimal with
+// arbitrary-precision arithmetic on the stack, which is slower, but is still
+// free of allocation and locale.  Note that a value written in fixed notation
+// without a precision is written exactly if it is an integer too large to be
+// written exactly by its shortest representation (e.g., 1e23 is written as
+// "99999999999999991611392", as by 'printf' with "%.0f").
 //
 ///Usage
 ///-----
@@ -59,6 +97,42 @@ BSLS_IDENT("$Id: $")
 //      result->sputn(buffer, ret - buffer);
 //  }
 //..
+//
+///Example 2: Writing a 'double' to a 'streambuf'
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write a 'double' to a 'streambuf', in as few characters
+// as possible, such that reading it back yields the same 'double'.
+//
+// First, we declare our function:
+//..
+//  void writeJsonNumber(std::streambuf *result, double value)
+//      // Write the specified 'value', in its shortest representation, to the
+//      // specified 'result'.
+//  {
+//..
+// Then, we declare a buffer long enough to store any 'double' value in its
+// shortest representation, which has at most 17 significant digits, a sign, a
+// decimal point, and an exponent of at most 3 digits (e.g.,
+// "-2.2250738585072014e-308"):
+//..
+//      char buffer[24];
+//..
+// Next, we call the function, and check that the buffer was long enough:
+//..
+//      char *ret = bslalg::NumericFormatterUtil::toChars(buffer,
+//                                                        buffer + 24,
+//                                                        value);
+//      assert(0 != ret);
+//..
+// Finally, we write our buffer to the 'streambuf':
+//..
+//      result->sputn(buffer, ret - buffer);
+//  }
+//..
+// Note that, unlike "%.17g", which 'printf' would need to write every
+// 'double' exactly, the shortest representation writes 0.1 as "0.1" rather
+// than "0.10000000000000001", and that 'toChars' neither depends on the locale
+// nor allocates memory.
 
 #include <bslscm_version.h>
 
@@ -81,6 +155,19 @@ namespace bslalg {
 class NumericFormatterUtil {
     // Namespace 'class' for free functions supporting 'to_chars'.
 
+  public:
+    // TYPES
+    enum Format {
+        // This enumeration provides the notations in which floating point
+        // values can be written, the values of which match those of the
+        // corresponding enumerators of 'std::chars_format'.
+
+        e_SCIENTIFIC = 1,  // "d.ddde+dd", as 'printf' "%e"
+        e_FIXED      = 2,  // "ddd.ddd", as 'printf' "%f"
+        e_GENERAL    = 3   // fixed or scientific, as 'printf' "%g"
+    };
+
+  private:
     // PRIVATE CLASS METHODS
     static char *toCharsImpl(char     *first,
                              char     *last,
@@ -127,6 +214,59 @@ class NumericFormatterUtil {
         // 'first' with leftover room following the return value.  The behavior
         // is undefined unless 'first < last' and 'base' is in the range
         // '[ 2 .. 36 ]'.
+
+    static char *toChars(char   *first,
+                         char   *last,
+                         double  value) BSLS_KEYWORD_NOEXCEPT;
+    static char *toChars(char   *first,
+                         char   *last,
+                         float   value) BSLS_KEYWORD_NOEXCEPT;
+        // Write the shortest representation of the specified 'value' that
+        // reads back as 'value' into the character buffer starting at the
+        // specified 'first' and ending at the specified 'last', in fixed or
+        // scientific notation, whichever is shorter (fixed notation in case
+        // of a tie).  Return the address one past the last character written
+        // on success, or 0 if the range '[ first, last )' is not large enough
+        // to contain the result.  The behavior is undefined unless
+        // 'first <= last'.  See {Floating Point Formatting}.
+
+    static char *toChars(char   *first,
+                         char   *last,
+                         double  value,
+                         Format  format) BSLS_KEYWORD_NOEXCEPT;
+    static char *toChars(char   *first,
+                         char   *last,
+                         float   value,
+                         Format  format) BSLS_KEYWORD_NOEXCEPT;
+        // Write the shortest representation of the specified 'value' that
+        // reads back as 'value' into the character buffer starting at the
+        // specified 'first' and ending at the specified 'last', in the
+        // notation of the specified 'format'.  Return the address one past
+        // the last character written on success, or 0 if the range
+        // '[ first, last )' is not large enough to contain the result.  The
+        // behavior is undefined unless 'first <= last'.  See {Floating Point
+        // Formatting}.
+
+    static char *toChars(char   *first,
+                         char   *last,
+                         double  value,
+                         Format  format,
+                         int     precision) BSLS_KEYWORD_NOEXCEPT;
+    static char *toChars(char   *first,
+                         char   *last,
+                         float   value,
+                         Format  format,
+                         int     precision) BSLS_KEYWORD_NOEXCEPT;
+        // Write the specified 'value' into the character buffer starting at
+        // the specified 'first' and ending at the specified 'last', in the
+        // notation of the specified 'format' with the specified 'precision',
+        // as does 'printf' with the "C" locale and the conversion "%.*f",
+        // "%.*e", or "%.*g" for 'e_FIXED', 'e_SCIENTIFIC', and 'e_GENERAL',
+        // respectively.  If 'precision' is negative, 6 is used.  Return the
+        // address one past the last character written on success, or 0 if the
+        // range '[ first, last )' is not large enough to contain the result.
+        // The behavior is undefined unless 'first <= last'.  See {Floating
+        // Point Formatting}.
 };
 
 // ============================================================================
@@ -16,7 +16,9 @@
 #include <sstream>
 #include <streambuf>
 
+#include <cfloat>
 #include <climits>
+#include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -37,14 +39,21 @@ using std::numeric_limits;
 //
 // In the following cases, 'TYPE' means every integral fundamental type, signed
 // or unsigned, up to 64 bits long.
+//
+// In the following cases, 'FLOAT' means 'double' or 'float'.
 // ----------------------------------------------------------------------------
+// [ 7] char *toChars(char *, char *, FLOAT);     // Random Values
+// [ 7] char *toChars(char *, char *, FLOAT, Format, int);
+// [ 6] char *toChars(char *, char *, FLOAT);     // Table-Driven
+// [ 6] char *toChars(char *, char *, FLOAT, Format);
+// [ 6] char *toChars(char *, char *, FLOAT, Format, int);
 // [ 5] char *toChars(char *, char *, TYPE, int); // Random Unsigned
 // [ 4] char *toChars(char *, char *, TYPE, int); // Random Signed
 // [ 3] char *toChars(char *, char *, TYPE, int); // Corner Cases
 // [ 2] char *toChars(char *, char *, TYPE, int); // Table-Driven
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -599,6 +608,116 @@ void testValueMeta(Uint64 num, unsigned base)
 
 const Uint64 uint64Max = ~0ULL;    // max value a 'Uint64' can represent
 
+template <class FLOAT>
+FLOAT randomFloat();
+    // Return a (template parameter) 'FLOAT' having a pseudo-random bit
+    // pattern, other than an infinity or a NaN, generated by 'mmixRand64'.
+
+template <>
+double randomFloat<double>()
+{
+    double result;
+    do {
+        const Uint64 bits = mmixRand64();
+        std::memcpy(&result, &bits, sizeof result);
+    } while (result != result || result - result != 0);
+    return result;
+}
+
+template <>
+float randomFloat<float>()
+{
+    float result;
+    do {
+        const unsigned bits = static_cast<unsigned>(mmixRand64() >> 32);
+        std::memcpy(&result, &bits, sizeof result);
+    } while (result != result || result - result != 0);
+    return result;
+}
+
+double readBack(const char *first, const char *last, double)
+    // Return the 'double' represented by the string '[ first, last )'.
+{
+    const std::string str(first, last);
+    return std::strtod(str.c_str(), 0);
+}
+
+float readBack(const char *first, const char *last, float)
+    // Return the 'float' represented by the string '[ first, last )'.
+{
+    const std::string str(first, last);
+    return std::strtof(str.c_str(), 0);
+}
+
+template <class FLOAT>
+void testFloatValue(FLOAT value)
+    // Verify that 'Util::toChars' writes the specified 'value' in its
+    // shortest round-trip form, writes it with a precision in each format as
+    // 'sprintf' does, and fails, without writing past the end, when given a
+    // buffer one character too short.
+{
+    static const Util::Format formats[] = { Util::e_SCIENTIFIC,
+                                            Util::e_FIXED,
+                                            Util::e_GENERAL };
+    static const char *const  fmts[]    = { "%.*e", "%.*f", "%.*g" };
+
+    char buffer[400];
+    char tail[400];
+    char expected[400];
+
+    // shortest, plain
+
+    char *end = Util::toChars(buffer, buffer + sizeof buffer, value);
+    ASSERTV(value, end);
+    if (!end) {
+        return;                                                   // RETURN
+    }
+    ASSERTV(value, readBack(buffer, end, value) == value);
+
+    const IntPtr len = end - buffer;
+    std::memcpy(tail, buffer, len);
+    ASSERTV(value, !Util::toChars(tail, tail + len - 1, value));
+
+    int maxDigits = std::numeric_limits<FLOAT>::max_digits10;
+    std::sprintf(expected, "%.*g", maxDigits, static_cast<double>(value));
+    ASSERTV(value, len <= static_cast<IntPtr>(std::strlen(expected)));
+
+    for (int f = 0; f < 3; ++f) {
+        // shortest, with format
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, value, formats[f]);
+        ASSERTV(value, f, end);
+        if (end && Util::e_FIXED != formats[f]) {
+            ASSERTV(value, f, readBack(buffer, end, value) == value);
+        }
+
+        // with precision
+
+        const int precision = static_cast<int>(mmixRand64() % 20);
+        if (Util::e_FIXED == formats[f] &&
+                                        !(std::fabs(value) < FLOAT(1e100))) {
+            continue;
+        }
+
+        end = Util::toChars(buffer,
+                            buffer + sizeof buffer,
+                            value,
+                            formats[f],
+                            precision);
+        std::sprintf(expected,
+                     fmts[f],
+                     precision,
+                     static_cast<double>(value));
+        ASSERTV(value, f, precision, end);
+        if (end) {
+            *end = 0;
+            ASSERTV(value, f, precision, buffer, expected,
+                                           0 == std::strcmp(buffer, expected));
+        }
+    }
+}
+
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -647,6 +766,42 @@ const Uint64 uint64Max = ~0ULL;    // max value a 'Uint64' can represent
         result->sputn(buffer, ret - buffer);
     }
 //..
+//
+///Example 2: Writing a 'double' to a 'streambuf'
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write a 'double' to a 'streambuf', in as few characters
+// as possible, such that reading it back yields the same 'double'.
+//
+// First, we declare our function:
+//..
+    void writeJsonNumber(std::streambuf *result, double value)
+        // Write the specified 'value', in its shortest representation, to the
+        // specified 'result'.
+    {
+//..
+// Then, we declare a buffer long enough to store any 'double' value in its
+// shortest representation, which has at most 17 significant digits, a sign, a
+// decimal point, and an exponent of at most 3 digits (e.g.,
+// "-2.2250738585072014e-308"):
+//..
+        char buffer[24];
+//..
+// Next, we call the function, and check that the buffer was long enough:
+//..
+        char *ret = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                          buffer + 24,
+                                                          value);
+        ASSERT(0 != ret);
+//..
+// Finally, we write our buffer to the 'streambuf':
+//..
+        result->sputn(buffer, ret - buffer);
+    }
+//..
+// Note that, unlike "%.17g", which 'printf' would need to write every
+// 'double' exactly, the shortest representation writes 0.1 as "0.1" rather
+// than "0.10000000000000001", and that 'toChars' neither depends on the locale
+// nor allocates memory.
 
 //=============================================================================
 //                              MAIN PROGRAM
@@ -665,7 +820,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 6: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -702,6 +857,302 @@ int main(int argc, char *argv[])
 
         writeJsonScalar(sb, -1234567890);    // worst case int, max string len
         ASSERT("-1234567890" == oss.str());
+
+        oss.str("");
+
+        writeJsonNumber(sb, 0.1);
+        ASSERT("0.1" == oss.str());
+
+        oss.str("");
+
+        writeJsonNumber(sb, -DBL_MIN);       // max string len
+        ASSERT("-2.2250738585072014e-308" == oss.str());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // FLOATING POINT: RANDOM VALUES TEST
+        //
+        // Concerns:
+        //: 1 That the shortest representation written for any finite value
+        //:   reads back as that value, and is no longer than the
+        //:   'max_digits10' representation.
+        //:
+        //: 2 That the representations written with a precision are those
+        //:   'sprintf' writes with the corresponding conversion.
+        //:
+        //: 3 That, when the buffer is too short, 0 is returned.
+        //:
+        //: 4 That, when the standard library provides 'std::to_chars' for
+        //:   floating point types, the same characters are written.
+        //
+        // Plan:
+        //: 1 Generate random bit patterns with 'u::mmixRand64', and verify,
+        //:   with 'u::testFloatValue', the representations of the 'double'
+        //:   and 'float' values having those bit patterns.  (C-1..3)
+        //:
+        //: 2 Compare the results with those of 'std::to_chars' when available.
+        //:   (C-4)
+        //
+        // Testing:
+        //   char *toChars(char *, char *, FLOAT);     // Random Values
+        //   char *toChars(char *, char *, FLOAT, Format, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING POINT: RANDOM VALUES TEST\n"
+                            "==================================\n");
+
+        int iterations = 20000;
+        if (verbose) {
+            int it = std::atoi(argv[2]);
+            if (it) {
+                iterations = it;
+                P(iterations);
+            }
+        }
+
+        u::mmixRand64(true);
+
+        for (int i = 0; i < iterations; ++i) {
+            u::testFloatValue(u::randomFloat<double>());
+            u::testFloatValue(u::randomFloat<float>());
+
+            // values with few significant digits, as humans write them
+
+            const double human = static_cast<double>(u::mmixRand64() % 100000)
+                       / std::pow(10.0, static_cast<int>(u::mmixRand64() % 9));
+            u::testFloatValue(human);
+            u::testFloatValue(static_cast<float>(human));
+        }
+
+#if defined(__cpp_lib_to_chars)
+        if (verbose) printf("Compare with 'std::to_chars'.\n");
+
+        for (int i = 0; i < iterations; ++i) {
+            const double value = u::randomFloat<double>();
+
+            char buffer[400], expected[400];
+
+            char *end = Util::toChars(buffer, buffer + sizeof buffer, value);
+            std::to_chars_result res = std::to_chars(
+                                                    expected,
+                                                    expected + sizeof expected,
+                                                    value);
+            ASSERTV(value, std::string(buffer, end) ==
+                                            std::string(expected, res.ptr));
+
+            end = Util::toChars(buffer,
+                                buffer + sizeof buffer,
+                                value,
+                                Util::e_GENERAL);
+            res = std::to_chars(expected,
+                                expected + sizeof expected,
+                                value,
+                                std::chars_format::general);
+            ASSERTV(value, std::string(buffer, end) ==
+                                            std::string(expected, res.ptr));
+
+            end = Util::toChars(buffer,
+                                buffer + sizeof buffer,
+                                value,
+                                Util::e_SCIENTIFIC);
+            res = std::to_chars(expected,
+                                expected + sizeof expected,
+                                value,
+                                std::chars_format::scientific);
+            ASSERTV(value, std::string(buffer, end) ==
+                                            std::string(expected, res.ptr));
+        }
+#endif
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // FLOATING POINT: TABLE-DRIVEN TEST
+        //
+        // Concerns:
+        //: 1 That zeros, infinities, and NaNs are written as "0", "inf", and
+        //:   "nan", with a '-' if negative.
+        //:
+        //: 2 That the shortest representation is chosen, in plain, fixed,
+        //:   scientific, and general formats, as 'std::to_chars' would.
+        //:
+        //: 3 That values written with a precision are exactly rounded, ties
+        //:   being broken to even, as 'printf' would.
+        //:
+        //: 4 That a negative precision means 6.
+        //:
+        //: 5 That, when the buffer is too short, 0 is returned.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, write values with each overload
+        //:   and compare the result with the expected string.  Then repeat
+        //:   with a buffer one character too short.  (C-1..5)
+        //
+        // Testing:
+        //   char *toChars(char *, char *, FLOAT);     // Table-Driven
+        //   char *toChars(char *, char *, FLOAT, Format);
+        //   char *toChars(char *, char *, FLOAT, Format, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING POINT: TABLE-DRIVEN TEST\n"
+                            "=================================\n");
+
+        const double INF = std::numeric_limits<double>::infinity();
+        const double NAN_ = std::numeric_limits<double>::quiet_NaN();
+
+        enum { PLAIN = 0,
+               SCI   = Util::e_SCIENTIFIC,
+               FIX   = Util::e_FIXED,
+               GEN   = Util::e_GENERAL };
+
+        enum { SHORTEST = INT_MIN };
+
+        static const struct {
+            int         d_line;
+            double      d_value;
+            bool        d_isFloat;    // write 'static_cast<float>(d_value)'
+            int         d_format;
+            int         d_precision;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  VALUE        FLT  FMT    PREC      EXPECTED
+            //----  -----------  ---  -----  --------  ---------------
+            { L_,   0.0,         0,   PLAIN, SHORTEST, "0"                   },
+            { L_,   -0.0,        0,   PLAIN, SHORTEST, "-0"                  },
+            { L_,   0.0,         0,   SCI,   SHORTEST, "0e+00"               },
+            { L_,   0.0,         0,   FIX,   SHORTEST, "0"                   },
+            { L_,   0.0,         0,   GEN,   SHORTEST, "0"                   },
+            { L_,   0.0,         0,   SCI,   2,        "0.00e+00"            },
+            { L_,   0.0,         0,   FIX,   2,        "0.00"                },
+            { L_,   0.0,         0,   GEN,   2,        "0"                   },
+            { L_,   INF,         0,   PLAIN, SHORTEST, "inf"                 },
+            { L_,   -INF,        0,   PLAIN, SHORTEST, "-inf"                },
+            { L_,   INF,         0,   FIX,   3,        "inf"                 },
+            { L_,   NAN_,        0,   PLAIN, SHORTEST, "nan"                 },
+            { L_,   NAN_,        0,   GEN,   3,        "nan"                 },
+            { L_,   INF,         1,   SCI,   SHORTEST, "inf"                 },
+
+            { L_,   1.0,         0,   PLAIN, SHORTEST, "1"                   },
+            { L_,   -1.5,        0,   PLAIN, SHORTEST, "-1.5"                },
+            { L_,   0.1,         0,   PLAIN, SHORTEST, "0.1"                 },
+            { L_,   0.1,         1,   PLAIN, SHORTEST, "0.1"                 },
+            { L_,   0.3,         0,   PLAIN, SHORTEST, "0.3"                 },
+            { L_,   100.0,       0,   PLAIN, SHORTEST, "100"                 },
+            { L_,   100.12,      0,   PLAIN, SHORTEST, "100.12"              },
+            { L_,   123456.0,    0,   PLAIN, SHORTEST, "123456"              },
+            { L_,   1e22,        0,   PLAIN, SHORTEST, "1e+22"               },
+            { L_,   1e-7,        0,   PLAIN, SHORTEST, "1e-07"               },
+            { L_,   0.0001,      0,   PLAIN, SHORTEST, "1e-04"               },
+            { L_,   1.5e300,     0,   PLAIN, SHORTEST, "1.5e+300"            },
+            { L_,   5e-324,      0,   PLAIN, SHORTEST, "5e-324"              },
+            { L_,   DBL_MAX,     0,   PLAIN, SHORTEST,
+                                                 "1.7976931348623157e+308" },
+            { L_,   DBL_MIN,     0,   PLAIN, SHORTEST,
+                                                 "2.2250738585072014e-308" },
+            { L_,   FLT_MAX,     1,   PLAIN, SHORTEST, "3.4028235e+38"       },
+            { L_,   FLT_MIN,     1,   PLAIN, SHORTEST, "1.1754944e-38"       },
+            { L_,   16777216.0,  1,   PLAIN, SHORTEST, "16777216"            },
+            { L_,   1.0 / 3,     0,   PLAIN, SHORTEST, "0.3333333333333333"  },
+            { L_,   1.0 / 3,     1,   PLAIN, SHORTEST, "0.33333334"          },
+
+            { L_,   100.0,       0,   SCI,   SHORTEST, "1e+02"               },
+            { L_,   123.456,     0,   SCI,   SHORTEST, "1.23456e+02"         },
+            { L_,   2.5e7,       0,   FIX,   SHORTEST, "25000000"            },
+            { L_,   1e23,        0,   FIX,   SHORTEST,
+                                                 "99999999999999991611392" },
+            { L_,   1e-5,        0,   FIX,   SHORTEST, "0.00001"             },
+            { L_,   100.0,       0,   GEN,   SHORTEST, "100"                 },
+            { L_,   123456.0,    0,   GEN,   SHORTEST, "123456"              },
+            { L_,   1234567.0,   0,   GEN,   SHORTEST, "1.234567e+06"        },
+            { L_,   0.0001,      0,   GEN,   SHORTEST, "0.0001"              },
+            { L_,   0.00001,     0,   GEN,   SHORTEST, "1e-05"               },
+
+            { L_,   2.675,       0,   FIX,   2,        "2.67"                },
+            { L_,   0.125,       0,   FIX,   2,        "0.12"                },
+            { L_,   0.375,       0,   FIX,   2,        "0.38"                },
+            { L_,   0.5,         0,   FIX,   0,        "0"                   },
+            { L_,   1.5,         0,   FIX,   0,        "2"                   },
+            { L_,   9.995,       0,   FIX,   2,        "9.99"                },
+            { L_,   9.9951,      0,   FIX,   2,        "10.00"               },
+            { L_,   0.1,         0,   FIX,   20,
+                                                  "0.10000000000000000555" },
+            { L_,   1e23,        0,   FIX,   1,
+                                               "99999999999999991611392.0" },
+            { L_,   1.0,         0,   FIX,   -1,       "1.000000"            },
+            { L_,   0.1,         0,   SCI,   20,
+                                              "1.00000000000000005551e-01" },
+            { L_,   9.5,         0,   SCI,   0,        "1e+01"               },
+            { L_,   123.456,     0,   SCI,   2,        "1.23e+02"            },
+            { L_,   5e-324,      0,   SCI,   3,        "4.941e-324"          },
+            { L_,   1.0,         0,   SCI,   -1,       "1.000000e+00"        },
+            { L_,   0.1,         0,   GEN,   17,       "0.10000000000000001" },
+            { L_,   0.1,         1,   GEN,   9,        "0.100000001"         },
+            { L_,   100.0,       0,   GEN,   15,       "100"                 },
+            { L_,   123456.0,    0,   GEN,   0,        "1e+05"               },
+            { L_,   123456.0,    0,   GEN,   -1,       "123456"              },
+            { L_,   1234567.0,   0,   GEN,   -1,       "1.23457e+06"         },
+            { L_,   0.0001,      0,   GEN,   3,        "0.0001"              },
+            { L_,   0.00001234,  0,   GEN,   3,        "1.23e-05"            },
+            { L_,   DBL_MAX,     0,   GEN,   17,
+                                                 "1.7976931348623157e+308" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE      = DATA[ti].d_line;
+            const double       VALUE     = DATA[ti].d_value;
+            const bool         IS_FLOAT  = DATA[ti].d_isFloat;
+            const int          FORMAT    = DATA[ti].d_format;
+            const int          PRECISION = DATA[ti].d_precision;
+            const std::string  EXPECTED  = DATA[ti].d_expected;
+            const IntPtr       LEN       = EXPECTED.length();
+            const Util::Format FMT       = static_cast<Util::Format>(FORMAT);
+            const float        FVALUE    = static_cast<float>(VALUE);
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(VALUE) P_(IS_FLOAT) P_(FORMAT) P(PRECISION)
+            }
+
+            for (IntPtr size = LEN; LEN - 1 <= size; --size) {
+                char  buffer[400];
+                char *end;
+
+                if (PLAIN == FORMAT) {
+                    end = IS_FLOAT
+                        ? Util::toChars(buffer, buffer + size, FVALUE)
+                        : Util::toChars(buffer, buffer + size, VALUE);
+                }
+                else if (SHORTEST == PRECISION) {
+                    end = IS_FLOAT
+                        ? Util::toChars(buffer, buffer + size, FVALUE, FMT)
+                        : Util::toChars(buffer, buffer + size, VALUE, FMT);
+                }
+                else {
+                    end = IS_FLOAT
+                        ? Util::toChars(buffer,
+                                        buffer + size,
+                                        FVALUE,
+                                        FMT,
+                                        PRECISION)
+                        : Util::toChars(buffer,
+                                        buffer + size,
+                                        VALUE,
+                                        FMT,
+                                        PRECISION);
+                }
+
+                if (LEN == size) {
+                    ASSERTV(LINE, end);
+                    if (end) {
+                        const std::string result(buffer, end);
+                        ASSERTV(LINE, EXPECTED.c_str(), result.c_str(),
+                                EXPECTED == result);
+                    }
+                }
+                else {
+                    ASSERTV(LINE, !end);
+                }
+            }
+        }
       } break;
       case 5: {
         // --------------------------------------------------------------------
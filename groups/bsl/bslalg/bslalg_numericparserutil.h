@@ -0,0 +1,309 @@
+// bslalg_numericparserutil.h                                         -*-C++-*-
+#ifndef INCLUDED_BSLALG_NUMERICPARSERUTIL
+#define INCLUDED_BSLALG_NUMERICPARSERUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a utility for parsing numbers from strings.
+//
+//@CLASSES:
+//  bslalg::NumericParserUtil: namespace for 'fromChars' and support functions
+//
+//@SEE_ALSO: bslalg_numericformatterutil, bslstl_charconv
+//
+//@DESCRIPTION: This component provides a namespace 'class',
+// 'bslalg::NumericParserUtil', containing the template function 'fromChars',
+// that parses integral fundamental types from ASCII strings, and overloads of
+// 'fromChars' that parse 'double' and 'float' values from ASCII strings.
+// These functions implement 'std::from_chars' of C++17 (and
+// 'bsl::from_chars'): they parse a range of characters that need not be
+// null-terminated, without copying it, allocating memory, or depending on the
+// locale, do not skip leading whitespace, and do not accept a leading '+'.
+//
+///Integral Parsing
+///----------------
+// 'fromChars' for an integral type parses the longest sequence of digits in
+// the specified base (from 2 to 36, the letters 'a' to 'z', in either case,
+// denoting the digits from 10 to 35), preceded by an optional '-' if the type
+// is signed.  A base prefix ("0x", "0") is not recognized.  If the parsed
+// value is not representable by the type, all of the digits are consumed, but
+// the result is not modified.
+//
+///Floating Point Parsing
+///----------------------
+// 'fromChars' for 'double' and 'float' parses, after an optional '-', either
+// an infinity ("inf" or "infinity"), a NaN ("nan" or "nan(" followed by a
+// possibly empty sequence of letters, digits, and '_', and ")"), all ignoring
+// case, or a decimal number, as does 'strtod' in the "C" locale, of the
+// specified format:
+//
+//: 'e_FIXED':
+//:   a non-empty sequence of decimal digits, optionally containing a '.',
+//:   without exponent (e.g., "1.5", ".5", "15.")
+//:
+//: 'e_SCIENTIFIC':
+//:   as for 'e_FIXED', followed by a mandatory exponent, an 'e' or 'E'
+//:   followed by an optional sign and a non-empty sequence of decimal digits
+//:   (e.g., "1.5e3", "15E-1")
+//:
+//: 'e_GENERAL':
+//:   as for 'e_FIXED', followed by an optional exponent (the default)
+//
+// Hexadecimal floating point numbers are not recognized.  The result is the
+// value closest to the parsed decimal number, ties rounded to the even value,
+// as for 'strtod', regardless of the number of digits.  The parsed number may
+// be out of the range of the type, in which case 'result' is loaded with the
+// infinity or the zero of its sign, as 'strtod' would return, and the status
+// 'e_OUT_OF_RANGE' is returned (unlike 'std::from_chars', which does not
+// modify its result in this case).  Note that a subnormal result is not out of
+// range.
+//
+// The conversion follows the algorithm of Daniel Lemire ("Number Parsing at a
+// Gigabyte per Second", 2021), after Michael Eisel: the first 19 significant
+// digits are multiplied by a 128-bit approximation of the power of 10, which
+// determines the correctly rounded result of every decimal number of at most
+// 19 significant digits.  Longer decimal numbers whose 19-digit prefixes do
+// not determine the rounding are compared, with arbitrary-precision integer
+// arithmetic on the stack, with the half-way point between the two candidate
+// values.
+//
+///Usage
+///-----
+// In this section we show the intended use of this component.
+//
+///Example 1: Parsing Numbers from a Comma-Separated Record
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive records of an integral quantity and a 'double' price,
+// separated by a comma, in a buffer that is not null-terminated, and want to
+// parse them without copying the buffer.
+//
+// First, we define a function that parses a record:
+//..
+//  int parseRecord(int         *quantity,
+//                  double      *price,
+//                  const char  *first,
+//                  const char  *last)
+//      // Load into the specified 'quantity' and 'price' the fields of the
+//      // record in the specified range '[ first, last )'.  Return 0 on
+//      // success, and a non-zero value otherwise.
+//  {
+//      typedef bslalg::NumericParserUtil Util;
+//
+//      const char *end;
+//      if (Util::e_SUCCESS != Util::fromChars(quantity, &end, first, last)
+//       || end == last
+//       || ',' != *end) {
+//          return -1;                                                // RETURN
+//      }
+//
+//      if (Util::e_SUCCESS != Util::fromChars(price, &end, end + 1, last)
+//       || end != last) {
+//          return -2;                                                // RETURN
+//      }
+//
+//      return 0;
+//  }
+//..
+// Then, we parse a valid record, which is followed in the buffer by other
+// characters:
+//..
+//  const char buffer[] = "250,101.25;...";
+//
+//  int    quantity;
+//  double price;
+//  int    rc = parseRecord(&quantity, &price, buffer, buffer + 10);
+//
+//  assert(0      == rc);
+//  assert(250    == quantity);
+//  assert(101.25 == price);
+//..
+// Finally, we check that a record whose price is missing is rejected:
+//..
+//  rc = parseRecord(&quantity, &price, buffer, buffer + 4);
+//  assert(-2 == rc);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isintegral.h>
+#include <bslmf_issame.h>
+#include <bslmf_removecv.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bslalg {
+
+                           // =======================
+                           // class NumericParserUtil
+                           // =======================
+
+class NumericParserUtil {
+    // Namespace 'class' for free functions supporting 'from_chars'.
+
+  public:
+    // TYPES
+    typedef NumericFormatterUtil::Format Format;
+        // The notations in which floating point values can be parsed, the
+        // values of which match those of the corresponding enumerators of
+        // 'std::chars_format'.
+
+    enum Status {
+        // This enumeration provides the results of parsing, corresponding to
+        // the 'std::errc' values returned by 'std::from_chars'.
+
+        e_SUCCESS      = 0,  // a number was parsed, and is representable
+        e_INVALID      = 1,  // no number was found ('invalid_argument')
+        e_OUT_OF_RANGE = 2   // a number was parsed, but is not representable
+                             // ('result_out_of_range')
+    };
+
+  private:
+    // PRIVATE CLASS METHODS
+    static Status fromCharsImpl(bsls::Types::Uint64  *result,
+                                const char          **end,
+                                const char           *first,
+                                const char           *last,
+                                int                   base,
+                                bsls::Types::Uint64   maxValue)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Parse the longest sequence of digits in the specified 'base' at the
+        // beginning of the range '[ first, last )', and load into the
+        // specified 'end' the address one past that sequence.  If the value
+        // of the sequence does not exceed the specified 'maxValue', load it
+        // into the specified 'result' and return 'e_SUCCESS'; otherwise,
+        // return 'e_OUT_OF_RANGE'.  If 'first' is not a digit, load 'first'
+        // into 'end' and return 'e_INVALID'.  The behavior is undefined
+        // unless 'first <= last' and 'base' is in the range '[ 2 .. 36 ]'.
+
+  public:
+    // CLASS METHODS
+    template <class TYPE>
+    static Status fromChars(TYPE        *result,
+                            const char **end,
+                            const char  *first,
+                            const char  *last,
+                            int          base = 10) BSLS_KEYWORD_NOEXCEPT;
+        // Parse the longest prefix of the specified range '[ first, last )'
+        // that is the representation, in the optionally specified 'base', of
+        // an integer preceded, if 'TYPE' is signed, by an optional '-', and
+        // load into the specified 'end' the address one past that prefix.  If
+        // the integer is representable by 'TYPE', load it into the specified
+        // 'result' and return 'e_SUCCESS'; otherwise, return
+        // 'e_OUT_OF_RANGE'.  If no prefix is such a representation, load
+        // 'first' into 'end' and return 'e_INVALID'.  'result' is not
+        // modified unless 'e_SUCCESS' is returned.  If 'base' is not
+        // specified, base 10 is used.  The behavior is undefined unless
+        // 'first <= last' and 'base' is in the range '[ 2 .. 36 ]'.  See
+        // {Integral Parsing}.
+
+    static Status fromChars(double      *result,
+                            const char **end,
+                            const char  *first,
+                            const char  *last,
+                            Format       format
+                                             = NumericFormatterUtil::e_GENERAL)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+    static Status fromChars(float       *result,
+                            const char **end,
+                            const char  *first,
+                            const char  *last,
+                            Format       format
+                                             = NumericFormatterUtil::e_GENERAL)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Parse the longest prefix of the specified range '[ first, last )'
+        // that is the representation of a floating point value in the
+        // optionally specified 'format', and load into the specified 'end'
+        // the address one past that prefix.  Load into the specified 'result'
+        // the value closest to that representation and return 'e_SUCCESS' if
+        // it is finite or if the representation is of an infinity; otherwise
+        // (the representation overflowing to an infinity, or underflowing to
+        // zero although it is not of zero), load into 'result' that infinity
+        // or zero, and return 'e_OUT_OF_RANGE'.  If no prefix is such a
+        // representation, load 'first' into 'end', return 'e_INVALID', and
+        // do not modify 'result'.  If 'format' is not specified, 'e_GENERAL'
+        // is used.  The behavior is undefined unless 'first <= last'.  See
+        // {Floating Point Parsing}.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                           // -----------------------
+                           // class NumericParserUtil
+                           // -----------------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+NumericParserUtil::Status
+NumericParserUtil::fromChars(TYPE        *result,
+                             const char **end,
+                             const char  *first,
+                             const char  *last,
+                             int          base) BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(end);
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(2 <= base);
+    BSLS_ASSERT_SAFE(base <= 36);
+
+    BSLMF_ASSERT(bsl::is_integral<TYPE>::value);
+    BSLMF_ASSERT(!(bsl::is_same<typename bsl::remove_cv<TYPE>::type,
+                                bool>::value));
+    BSLMF_ASSERT(sizeof(TYPE) <= sizeof(bsls::Types::Uint64));
+
+    typedef bsls::Types::Uint64 Uint64;
+
+    const bool   isSigned   = static_cast<TYPE>(-1) < static_cast<TYPE>(0);
+    const bool   isNegative = isSigned && first < last && '-' == *first;
+    const Uint64 maxValue   = isSigned
+                            ? (Uint64(1) << (sizeof(TYPE) * 8 - 1)) - 1
+                            : ~Uint64(0) >> (64 - sizeof(TYPE) * 8);
+
+    // The magnitude of the most negative value exceeds 'maxValue' by one.
+
+    Uint64       magnitude;
+    const Status status = fromCharsImpl(&magnitude,
+                                        end,
+                                        first + isNegative,
+                                        last,
+                                        base,
+                                        maxValue + isNegative);
+    if (e_INVALID == status) {
+        *end = first;
+        return status;                                                // RETURN
+    }
+    if (e_SUCCESS == status) {
+        *result = static_cast<TYPE>(isNegative ? 0 - magnitude : magnitude);
+    }
+    return status;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
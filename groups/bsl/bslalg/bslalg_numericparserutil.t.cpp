@@ -0,0 +1,926 @@
+// bslalg_numericparserutil.t.cpp                                     -*-C++-*-
+#include <bslalg_numericparserutil.h>
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <cfloat>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a namespace of pure functions, which are
+// tested with tables of inputs and expected results, and, for floating point
+// types, with random values written by 'bslalg::NumericFormatterUtil' and
+// 'sprintf' and read back, and with random strings of digits compared with
+// the results of 'strtod' and 'strtof' (which are correctly rounded on the
+// test platforms).
+//
+// In the following cases, 'TYPE' means every integral fundamental type, signed
+// or unsigned, up to 64 bits long, and 'FLOAT' means 'double' or 'float'.
+// ----------------------------------------------------------------------------
+// [ 2] Status fromChars(TYPE *, const char **, const char *, ...);
+// [ 3] Status fromChars(FLOAT *, const char **, const char *, ...);
+// [ 4] Status fromChars(FLOAT *, ...);   // Random Values
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TYPEDEFS AND FUNCTIONS
+// ----------------------------------------------------------------------------
+
+typedef bslalg::NumericParserUtil    Util;
+typedef bslalg::NumericFormatterUtil FormatterUtil;
+typedef bsls::Types::Uint64          Uint64;
+typedef bsls::Types::Int64           Int64;
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+namespace {
+namespace u {
+
+Uint64 mmixRand64(bool reset = false)
+    // MMIX Linear Congruential Generator algorithm by Donald Knuth (modified).
+    // Optionally specified 'reset' which, if 'true', indicates that the
+    // accumulator is to be reset to zero.
+{
+    static Uint64 randAccum = 0;
+    if (reset) {
+        randAccum = 0;
+    }
+
+    static const Uint64 a = 6364136223846793005ULL;
+    static const Uint64 c = 1442695040888963407ULL;
+
+    randAccum = randAccum * a + c;
+    const Uint64 hi = randAccum >> 32 << 32;
+    randAccum = randAccum * a + c;
+
+    return hi | (randAccum >> 32);
+}
+
+template <class FLOAT>
+FLOAT randomFloat();
+    // Return a (template parameter) 'FLOAT' having a pseudo-random bit
+    // pattern, other than an infinity or a NaN, generated by 'mmixRand64'.
+
+template <>
+double randomFloat<double>()
+{
+    double result;
+    do {
+        const Uint64 bits = mmixRand64();
+        std::memcpy(&result, &bits, sizeof result);
+    } while (result != result || result - result != 0);
+    return result;
+}
+
+template <>
+float randomFloat<float>()
+{
+    float result;
+    do {
+        const unsigned bits = static_cast<unsigned>(mmixRand64() >> 32);
+        std::memcpy(&result, &bits, sizeof result);
+    } while (result != result || result - result != 0);
+    return result;
+}
+
+template <class FLOAT>
+bool isSameBits(FLOAT lhs, FLOAT rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same bit
+    // pattern, and 'false' otherwise.
+{
+    return 0 == std::memcmp(&lhs, &rhs, sizeof lhs);
+}
+
+bool isSignBitSet(double value)
+    // Return 'true' if the sign bit of the specified 'value' is set, and
+    // 'false' otherwise.
+{
+    Uint64 bits;
+    std::memcpy(&bits, &value, sizeof value);
+    return 0 != bits >> 63;
+}
+
+bool isSignBitSet(float value)
+    // Return 'true' if the sign bit of the specified 'value' is set, and
+    // 'false' otherwise.
+{
+    unsigned bits;
+    std::memcpy(&bits, &value, sizeof value);
+    return 0 != bits >> 31;
+}
+
+template <class TYPE>
+void testIntegral(int         line,
+                  const char *input,
+                  int         base,
+                  int         expectedStatus,
+                  int         expectedLength,
+                  Int64       expectedValue)
+    // Parse the specified 'input' in the specified 'base' as a (template
+    // parameter) 'TYPE', and verify that the specified 'expectedStatus',
+    // 'expectedLength', and, on success, 'expectedValue' result, the
+    // specified 'line' identifying the test.
+{
+    const char *first  = input;
+    const char *last   = input + std::strlen(input);
+    const char *end    = 0;
+    TYPE        result = static_cast<TYPE>(42);
+
+    const Util::Status status = Util::fromChars(&result,
+                                                &end,
+                                                first,
+                                                last,
+                                                base);
+
+    ASSERTV(line, status, expectedStatus == status);
+    ASSERTV(line, end - first, expectedLength == end - first);
+    if (Util::e_SUCCESS == status) {
+        ASSERTV(line, static_cast<TYPE>(expectedValue) == result);
+    }
+    else {
+        ASSERTV(line, static_cast<TYPE>(42) == result);
+    }
+}
+
+template <class FLOAT>
+void testRoundTrip(FLOAT value)
+    // Verify that the specified 'value', written in its shortest
+    // representation and with a precision of 'max_digits10' and of 40 in
+    // scientific notation, is parsed back as 'value'.
+{
+    char buffer[128];
+
+    char *end = FormatterUtil::toChars(buffer, buffer + sizeof buffer, value);
+    ASSERT(end);
+
+    const char  *parsedEnd;
+    FLOAT        result;
+    Util::Status status = Util::fromChars(&result, &parsedEnd, buffer, end);
+    ASSERTV(buffer, Util::e_SUCCESS == status);
+    ASSERTV(buffer, end == parsedEnd);
+    ASSERTV(buffer, isSameBits(value, result));
+
+    static const struct {
+        FormatterUtil::Format d_format;
+        int                   d_precision;
+    } FORMATS[] = {
+        { FormatterUtil::e_GENERAL,    std::numeric_limits<FLOAT>::digits10
+                                                                         + 3 },
+        { FormatterUtil::e_SCIENTIFIC, 40 },
+    };
+
+    for (unsigned i = 0; i < sizeof FORMATS / sizeof *FORMATS; ++i) {
+        end = FormatterUtil::toChars(buffer,
+                                     buffer + sizeof buffer,
+                                     value,
+                                     FORMATS[i].d_format,
+                                     FORMATS[i].d_precision);
+        ASSERT(end);
+
+        result = 0;
+        status = Util::fromChars(&result, &parsedEnd, buffer, end);
+        ASSERTV(buffer, Util::e_SUCCESS == status);
+        ASSERTV(buffer, end == parsedEnd);
+        ASSERTV(buffer, isSameBits(value, result));
+    }
+}
+
+void testDigits(const std::string& input)
+    // Verify that the specified 'input' is parsed, as 'double' and 'float',
+    // as by 'strtod' and 'strtof'.
+{
+    const char *first = input.data();
+    const char *last  = first + input.size();
+    const char *end;
+    char       *expectedEnd;
+
+    double       d;
+    Util::Status status         = Util::fromChars(&d, &end, first, last);
+    const double expectedDouble = std::strtod(input.c_str(), &expectedEnd);
+    ASSERTV(input.c_str(), Util::e_INVALID != status);
+    ASSERTV(input.c_str(), expectedEnd - first == end - first);
+    ASSERTV(input.c_str(), d, expectedDouble, isSameBits(expectedDouble, d));
+
+    float       f;
+    status                    = Util::fromChars(&f, &end, first, last);
+    const float expectedFloat = std::strtof(input.c_str(), &expectedEnd);
+    ASSERTV(input.c_str(), Util::e_INVALID != status);
+    ASSERTV(input.c_str(), expectedEnd - first == end - first);
+    ASSERTV(input.c_str(), f, expectedFloat, isSameBits(expectedFloat, f));
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show the intended use of this component.
+//
+///Example 1: Parsing Numbers from a Comma-Separated Record
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive records of an integral quantity and a 'double' price,
+// separated by a comma, in a buffer that is not null-terminated, and want to
+// parse them without copying the buffer.
+//
+// First, we define a function that parses a record:
+//..
+    int parseRecord(int         *quantity,
+                    double      *price,
+                    const char  *first,
+                    const char  *last)
+        // Load into the specified 'quantity' and 'price' the fields of the
+        // record in the specified range '[ first, last )'.  Return 0 on
+        // success, and a non-zero value otherwise.
+    {
+        typedef bslalg::NumericParserUtil Util;
+
+        const char *end;
+        if (Util::e_SUCCESS != Util::fromChars(quantity, &end, first, last)
+         || end == last
+         || ',' != *end) {
+            return -1;                                                // RETURN
+        }
+
+        if (Util::e_SUCCESS != Util::fromChars(price, &end, end + 1, last)
+         || end != last) {
+            return -2;                                                // RETURN
+        }
+
+        return 0;
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? std::atoi(argv[1]) : 0;
+                verbose = argc > 2;    (void) verbose;
+            veryVerbose = argc > 3;    (void) veryVerbose;
+        veryVeryVerbose = argc > 4;    (void) veryVeryVerbose;
+    veryVeryVeryVerbose = argc > 5;    (void) veryVeryVeryVerbose;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concern:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("USAGE EXAMPLE\n"
+                            "=============\n");
+
+// Then, we parse a valid record, which is followed in the buffer by other
+// characters:
+//..
+    const char buffer[] = "250,101.25;...";
+
+    int    quantity;
+    double price;
+    int    rc = parseRecord(&quantity, &price, buffer, buffer + 10);
+
+    ASSERT(0      == rc);
+    ASSERT(250    == quantity);
+    ASSERT(101.25 == price);
+//..
+// Finally, we check that a record whose price is missing is rejected:
+//..
+    rc = parseRecord(&quantity, &price, buffer, buffer + 4);
+    ASSERT(-2 == rc);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FLOATING POINT: RANDOM VALUES TEST
+        //
+        // Concerns:
+        //: 1 That any finite value, written in its shortest representation
+        //:   or with enough digits, is parsed back as that value.
+        //:
+        //: 2 That random decimal numbers, of up to hundreds of digits, are
+        //:   parsed as 'strtod' and 'strtof' parse them, including those
+        //:   whose first 19 digits do not determine the rounding.
+        //
+        // Plan:
+        //: 1 Generate random bit patterns with 'u::mmixRand64', write the
+        //:   'double' and 'float' values having them with
+        //:   'bslalg::NumericFormatterUtil', and parse them back.  (C-1)
+        //:
+        //: 2 Generate random strings of digits, with a '.' and an exponent,
+        //:   and compare the results of parsing them with those of 'strtod'
+        //:   and 'strtof'.  (C-2)
+        //
+        // Testing:
+        //   Status fromChars(FLOAT *, ...);   // Random Values
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING POINT: RANDOM VALUES TEST\n"
+                            "==================================\n");
+
+        int iterations = 20000;
+        if (verbose) {
+            int it = std::atoi(argv[2]);
+            if (it) {
+                iterations = it;
+                P(iterations);
+            }
+        }
+
+        u::mmixRand64(true);
+
+        if (verbose) printf("Round trip of random values.\n");
+
+        for (int i = 0; i < iterations; ++i) {
+            u::testRoundTrip(u::randomFloat<double>());
+            u::testRoundTrip(u::randomFloat<float>());
+        }
+
+        if (verbose) printf("Random decimal numbers.\n");
+
+        for (int i = 0; i < iterations; ++i) {
+            const int numDigits = 1 + static_cast<int>(
+                               u::mmixRand64() % (0 == i % 100 ? 900 : 30));
+            const int dot       = static_cast<int>(u::mmixRand64()
+                                                           % (numDigits + 1));
+
+            std::string input;
+            if (u::mmixRand64() % 2) {
+                input += '-';
+            }
+            for (int j = 0; j < numDigits; ++j) {
+                if (j == dot) {
+                    input += '.';
+                }
+                input += static_cast<char>('0' + u::mmixRand64() % 10);
+            }
+            if (u::mmixRand64() % 2) {
+                char exponent[16];
+                std::sprintf(exponent,
+                             "e%d",
+                             static_cast<int>(u::mmixRand64() % 800) - 400);
+                input += exponent;
+            }
+            u::testDigits(input);
+        }
+
+        if (verbose) printf("Decimal numbers with 17 significant digits.\n");
+
+        for (int i = 0; i < iterations; ++i) {
+            char input[32];
+            std::sprintf(input, "%.16e", u::randomFloat<double>());
+            u::testDigits(input);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FLOATING POINT: TABLE-DRIVEN TEST
+        //
+        // Concerns:
+        //: 1 That decimal numbers are parsed, in each format, as
+        //:   'std::from_chars' parses them: without leading '+' or
+        //:   whitespace, with an exponent only if allowed, and stopping at the
+        //:   first character that cannot continue the number.
+        //:
+        //: 2 That the value closest to the number is loaded, ties being broken
+        //:   to even, including for numbers of more than 19 digits whose
+        //:   prefixes are ties.
+        //:
+        //: 3 That infinities and NaNs are parsed, in any case, with their
+        //:   sign.
+        //:
+        //: 4 That numbers overflowing or underflowing are reported out of
+        //:   range, and load the infinity or zero of their sign, but that
+        //:   subnormal values are not out of range.
+        //:
+        //: 5 That, if no number is found, 'e_INVALID' is returned, 'first' is
+        //:   loaded into 'end', and the result is not modified.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse inputs as 'double' and
+        //:   'float', and verify the status, the length of the parsed prefix,
+        //:   and the bits of the result.  (C-1..5)
+        //
+        // Testing:
+        //   Status fromChars(FLOAT *, const char **, const char *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING POINT: TABLE-DRIVEN TEST\n"
+                            "=================================\n");
+
+        const double INF = std::numeric_limits<double>::infinity();
+
+        enum {
+            G = FormatterUtil::e_GENERAL,
+            F = FormatterUtil::e_FIXED,
+            S = FormatterUtil::e_SCIENTIFIC,
+
+            OK  = Util::e_SUCCESS,
+            BAD = Util::e_INVALID,
+            OOR = Util::e_OUT_OF_RANGE
+        };
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_format;
+            int         d_status;
+            int         d_length;
+            double      d_double;  // ignored unless 'OK' or 'OOR'
+            float       d_float;   // ignored unless 'd_isFloatSame' is false
+            bool        d_isFloatSame;
+        } DATA[] = {
+            //LN  INPUT                    FMT  STATUS  LEN  DOUBLE
+            //--  -----------------------  ---  ------  ---  ------
+            { L_, "",                        G,   BAD,    0,   0,
+                                                           0,         true },
+            { L_, "-",                       G,   BAD,    0,   0,
+                                                           0,         true },
+            { L_, "+1",                      G,   BAD,    0,   0,
+                                                           0,         true },
+            { L_, " 1",                      G,   BAD,    0,   0,
+                                                           0,         true },
+            { L_, ".",                       G,   BAD,    0,   0,
+                                                           0,         true },
+            { L_, "-.e1",                    G,   BAD,    0,   0,
+                                                           0,         true },
+            { L_, "e1",                      G,   BAD,    0,   0,
+                                                           0,         true },
+            { L_, "--1",                     G,   BAD,    0,   0,
+                                                           0,         true },
+            { L_, "0",                       G,    OK,    1,   0,
+                                                           0,         true },
+            { L_, "-0",                      G,    OK,    2,  -0.0,
+                                                           0,         true },
+            { L_, "000.000e99999",           G,    OK,   13,   0,
+                                                           0,         true },
+            { L_, "1",                       G,    OK,    1,   1,
+                                                           0,         true },
+            { L_, "-1.5",                    G,    OK,    4,  -1.5,
+                                                           0,         true },
+            { L_, ".5",                      G,    OK,    2,   0.5,
+                                                           0,         true },
+            { L_, "5.",                      G,    OK,    2,   5,
+                                                           0,         true },
+            { L_, "0x10",                    G,    OK,    1,   0,
+                                                           0,         true },
+            { L_, "1.5.5",                   G,    OK,    3,   1.5,
+                                                           0,         true },
+            { L_, "12e",                     G,    OK,    2,  12,
+                                                           0,         true },
+            { L_, "12e+",                    G,    OK,    2,  12,
+                                                           0,         true },
+            { L_, "12e-x",                   G,    OK,    2,  12,
+                                                           0,         true },
+            { L_, "12E2",                    G,    OK,    4,  1200,
+                                                           0,         true },
+            { L_, "12e+2",                   G,    OK,    5,  1200,
+                                                           0,         true },
+            { L_, "125e-2",                  G,    OK,    6,  1.25,
+                                                           0,         true },
+            { L_, "12e2",                    F,    OK,    2,  12,
+                                                           0,         true },
+            { L_, "12e2",                    S,    OK,    4,  1200,
+                                                           0,         true },
+            { L_, "12",                      S,   BAD,    0,   0,
+                                                           0,         true },
+            { L_, "12e",                     S,   BAD,    0,   0,
+                                                           0,         true },
+            { L_, "0.1",                     G,    OK,    3,   0.1,
+                                                        0.1f,        false },
+            { L_, "3.14159",                 G,    OK,    7,   3.14159,
+                                                        3.14159f,    false },
+
+            // Ties, broken to even, and numbers of more than 19 digits.
+
+            { L_, "9007199254740993",        G,    OK,   16,
+                                               9007199254740992.0,
+                                                        9007199254740992.0f,
+                                                                      false },
+            { L_, "9007199254740995",        G,    OK,   16,
+                                               9007199254740996.0,
+                                                        9007199254740996.0f,
+                                                                      false },
+            { L_, "9007199254740993.0000000000000000001",
+                                             G,    OK,   36,
+                                               9007199254740994.0,
+                                                        9007199254740992.0f,
+                                                                      false },
+            { L_, "9007199254740992.9999999999999999999",
+                                             G,    OK,   36,
+                                               9007199254740992.0,
+                                                        9007199254740992.0f,
+                                                                      false },
+            { L_, "16777217",                G,    OK,    8,  16777217,
+                                                        16777216.0f, false },
+            { L_, "123456789012345678901234567890",
+                                             G,    OK,   30,
+                                               1.2345678901234568e29,
+                                                        1.2345679e29f,
+                                                                      false },
+
+            // Limits of the range.
+
+            { L_, "1.7976931348623157e308",  G,    OK,   22,  DBL_MAX,
+                                                        0,           false },
+            { L_, "1.7976931348623158e308",  G,    OK,   22,  DBL_MAX,
+                                                        0,           false },
+            { L_, "1.7976931348623159e308",  G,   OOR,   22,  INF,
+                                                        0,           false },
+            { L_, "-1e309",                  G,   OOR,    6, -INF,
+                                                        0,           false },
+            { L_, "1e99999999999999999999",  G,   OOR,   22,  INF,
+                                                        0,           false },
+            { L_, "2.2250738585072014e-308", G,    OK,   23,  DBL_MIN,
+                                                        0,           false },
+            { L_, "4.9406564584124654e-324", G,    OK,   23,
+                                               4.9406564584124654e-324,
+                                                        0,           false },
+            { L_, "2.4703282292062328e-324", G,    OK,   23,
+                                               4.9406564584124654e-324,
+                                                        0,           false },
+            { L_, "2.4703282292062327e-324", G,   OOR,   23,  0,
+                                                        0,           false },
+            { L_, "-1e-999",                 G,   OOR,    7,  -0.0,
+                                                        0,           false },
+            { L_, "3.4028235e38",            G,    OK,   12,
+                                               3.4028235e38,
+                                                        FLT_MAX,     false },
+            { L_, "1.4e-45",                 G,    OK,    7,   1.4e-45,
+                                                        1.4e-45f,    false },
+
+            // Infinities and NaNs (bits compared with those of 'INF' and
+            // 'NAN' in the loop below).
+
+            { L_, "inf",                     G,    OK,    3,  INF,
+                                                        0,           false },
+            { L_, "-INF",                    F,    OK,    4, -INF,
+                                                        0,           false },
+            { L_, "InFiNiTy",                S,    OK,    8,  INF,
+                                                        0,           false },
+            { L_, "infinit",                 G,    OK,    3,  INF,
+                                                        0,           false },
+            { L_, "in",                      G,   BAD,    0,  0,
+                                                        0,           true },
+            { L_, "-n",                      G,   BAD,    0,  0,
+                                                        0,           true },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const INPUT  = DATA[ti].d_input;
+            const Util::Format FORMAT =
+                                 static_cast<Util::Format>(DATA[ti].d_format);
+            const int         STATUS = DATA[ti].d_status;
+            const int         LENGTH = DATA[ti].d_length;
+            const double      EXP_D  = DATA[ti].d_double;
+            const float       EXP_F  = DATA[ti].d_isFloatSame
+                                     ? static_cast<float>(EXP_D)
+                                     : DATA[ti].d_float;
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            const char *first = INPUT;
+            const char *last  = INPUT + std::strlen(INPUT);
+            const char *end   = 0;
+
+            double d = 42;
+            Util::Status status = Util::fromChars(&d,
+                                                  &end,
+                                                  first,
+                                                  last,
+                                                  FORMAT);
+            ASSERTV(LINE, status, STATUS == status);
+            ASSERTV(LINE, end - first, LENGTH == end - first);
+            ASSERTV(LINE, d, EXP_D, BAD == STATUS ? 42 == d
+                                                  : u::isSameBits(EXP_D, d));
+
+            // Only the status and the length are checked for 'float' in the
+            // rows giving no 'float' value for a 'double' limit.
+
+            if (!DATA[ti].d_isFloatSame && 0 == DATA[ti].d_float
+             && EXP_D - EXP_D == 0) {
+                continue;
+            }
+
+            float f = 42;
+            status = Util::fromChars(&f, &end, first, last, FORMAT);
+            ASSERTV(LINE, status, BAD != STATUS || Util::e_INVALID == status);
+            ASSERTV(LINE, end - first, LENGTH == end - first);
+            if (BAD == STATUS) {
+                ASSERTV(LINE, f, 42 == f);
+            }
+            else if (EXP_D - EXP_D != 0) {
+                ASSERTV(LINE, f, u::isSameBits(static_cast<float>(EXP_D), f));
+            }
+            else {
+                ASSERTV(LINE, f, EXP_F, u::isSameBits(EXP_F, f));
+            }
+        }
+
+        if (verbose) printf("NaNs.\n");
+        {
+            static const char *const NANS[] = {
+                "nan", "NaN", "-nan", "nan()", "-NAN(0x1F_ab)", "nan(",
+                "nan(a", "nan(a-)"
+            };
+            static const int LENGTHS[] = { 3, 3, 4, 5, 13, 3, 3, 3 };
+
+            for (unsigned i = 0; i < sizeof NANS / sizeof *NANS; ++i) {
+                const char *first = NANS[i];
+                const char *last  = first + std::strlen(first);
+                const char *end;
+
+                double d;
+                ASSERTV(i, Util::e_SUCCESS == Util::fromChars(&d,
+                                                              &end,
+                                                              first,
+                                                              last));
+                ASSERTV(i, LENGTHS[i] == end - first);
+                ASSERTV(i, d != d);
+                ASSERTV(i, ('-' == *first) == u::isSignBitSet(d));
+
+                float f;
+                ASSERTV(i, Util::e_SUCCESS == Util::fromChars(&f,
+                                                              &end,
+                                                              first,
+                                                              last));
+                ASSERTV(i, LENGTHS[i] == end - first);
+                ASSERTV(i, f != f);
+                ASSERTV(i, ('-' == *first) == u::isSignBitSet(f));
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // INTEGRAL: TABLE-DRIVEN TEST
+        //
+        // Concerns:
+        //: 1 That the longest sequence of digits in the base is parsed, with
+        //:   a leading '-' for signed types only, and no leading '+',
+        //:   whitespace, or base prefix.
+        //:
+        //: 2 That the letters are digits in either case.
+        //:
+        //: 3 That the limits of each type are parsed, and that values beyond
+        //:   them are reported out of range after all of their digits, the
+        //:   result not being modified.
+        //:
+        //: 4 That, if no number is found, 'e_INVALID' is returned, 'first' is
+        //:   loaded into 'end', and the result is not modified.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse inputs as each type, and
+        //:   verify the status, the length of the parsed prefix, and the
+        //:   result.  (C-1..4)
+        //
+        // Testing:
+        //   Status fromChars(TYPE *, const char **, const char *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("INTEGRAL: TABLE-DRIVEN TEST\n"
+                            "===========================\n");
+
+        enum {
+            OK  = Util::e_SUCCESS,
+            BAD = Util::e_INVALID,
+            OOR = Util::e_OUT_OF_RANGE
+        };
+
+        if (verbose) printf("'int'.\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                int         d_base;
+                int         d_status;
+                int         d_length;
+                Int64       d_value;
+            } DATA[] = {
+                //LN  INPUT            BASE  STATUS  LEN  VALUE
+                //--  ---------------  ----  ------  ---  -----------
+                { L_, "",                10,   BAD,    0,           0 },
+                { L_, "-",               10,   BAD,    0,           0 },
+                { L_, "+1",              10,   BAD,    0,           0 },
+                { L_, " 1",              10,   BAD,    0,           0 },
+                { L_, "x",               10,   BAD,    0,           0 },
+                { L_, "--1",             10,   BAD,    0,           0 },
+                { L_, "0",               10,    OK,    1,           0 },
+                { L_, "-0",              10,    OK,    2,           0 },
+                { L_, "007",             10,    OK,    3,           7 },
+                { L_, "123abc",          10,    OK,    3,         123 },
+                { L_, "-123 ",           10,    OK,    4,        -123 },
+                { L_, "0x1F",            16,    OK,    1,           0 },
+                { L_, "1F",              16,    OK,    2,          31 },
+                { L_, "1fG",             16,    OK,    2,          31 },
+                { L_, "102",              2,    OK,    2,           2 },
+                { L_, "zZ",              36,    OK,    2,        1295 },
+                { L_, "2147483647",      10,    OK,   10,  2147483647 },
+                { L_, "-2147483648",     10,    OK,   11, -2147483647 - 1 },
+                { L_, "2147483648",      10,   OOR,   10,           0 },
+                { L_, "-2147483649",     10,   OOR,   11,           0 },
+                { L_, "99999999999999999999999x",
+                                         10,   OOR,   23,           0 },
+                { L_, "7fffffff",        16,    OK,    8,  2147483647 },
+                { L_, "80000000",        16,   OOR,    8,           0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                u::testIntegral<int>(DATA[ti].d_line,
+                                     DATA[ti].d_input,
+                                     DATA[ti].d_base,
+                                     DATA[ti].d_status,
+                                     DATA[ti].d_length,
+                                     DATA[ti].d_value);
+            }
+        }
+
+        if (verbose) printf("Other types.\n");
+        {
+            u::testIntegral<signed char>(L_, "127",  10,  OK, 3,  127);
+            u::testIntegral<signed char>(L_, "-128", 10,  OK, 4, -128);
+            u::testIntegral<signed char>(L_, "128",  10, OOR, 3,    0);
+            u::testIntegral<unsigned char>(L_, "255", 10,  OK, 3, 255);
+            u::testIntegral<unsigned char>(L_, "256", 10, OOR, 3,   0);
+            u::testIntegral<unsigned char>(L_, "-1",  10, BAD, 0,   0);
+            u::testIntegral<unsigned char>(L_, "-0",  10, BAD, 0,   0);
+            u::testIntegral<short>(L_, "-32768",   10,  OK, 6, -32768);
+            u::testIntegral<short>(L_, "32768",    10, OOR, 5,      0);
+            u::testIntegral<unsigned short>(L_, "ffff", 16,  OK, 4, 65535);
+            u::testIntegral<unsigned short>(L_, "10000", 16, OOR, 5,    0);
+            u::testIntegral<unsigned>(L_, "4294967295", 10,  OK, 10,
+                                                                 4294967295LL);
+            u::testIntegral<unsigned>(L_, "4294967296", 10, OOR, 10, 0);
+            u::testIntegral<Int64>(L_, "9223372036854775807", 10, OK, 19,
+                                                  9223372036854775807LL);
+            u::testIntegral<Int64>(L_, "-9223372036854775808", 10, OK, 20,
+                                                   -9223372036854775807LL - 1);
+            u::testIntegral<Int64>(L_, "9223372036854775808", 10, OOR, 19,
+                                                                            0);
+            u::testIntegral<Uint64>(L_, "18446744073709551615", 10, OK, 20,
+                                                                           -1);
+            u::testIntegral<Uint64>(L_, "18446744073709551616", 10, OOR, 20,
+                                                                            0);
+            u::testIntegral<Uint64>(L_, "ffffffffffffffff", 16, OK, 16, -1);
+            u::testIntegral<Uint64>(L_,
+                                    "11111111111111111111111111111111"
+                                    "11111111111111111111111111111111",
+                                    2, OK, 64, -1);
+            u::testIntegral<char>(L_, "65", 10, OK, 2, 65);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Parse a few integral and floating point values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("BREATHING TEST\n"
+                            "==============\n");
+
+        const char  input[] = "-12.5e1,x";
+        const char *end;
+
+        int i = 0;
+        ASSERT(Util::e_SUCCESS == Util::fromChars(&i,
+                                                  &end,
+                                                  input,
+                                                  input + 9));
+        ASSERT(-12        == i);
+        ASSERT(input + 3  == end);
+
+        double d = 0;
+        ASSERT(Util::e_SUCCESS == Util::fromChars(&d,
+                                                  &end,
+                                                  input,
+                                                  input + 9));
+        ASSERT(-125       == d);
+        ASSERT(input + 7  == end);
+
+        float f = 0;
+        ASSERT(Util::e_SUCCESS == Util::fromChars(&f,
+                                                  &end,
+                                                  input,
+                                                  input + 9,
+                                                  FormatterUtil::e_FIXED));
+        ASSERT(-12.5f     == f);
+        ASSERT(input + 5  == end);
+
+        ASSERT(Util::e_INVALID == Util::fromChars(&d,
+                                                  &end,
+                                                  input + 8,
+                                                  input + 9));
+        ASSERT(input + 8  == end);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,191 @@
+// bslmt_adaptivemutex.cpp                                            -*-C++-*-
+#include <bslmt_adaptivemutex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_adaptivemutex_cpp,"$Id$ $CSID$")
+
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#include <immintrin.h>
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The state of the mutex is a single 'int' holding a lock bit, a "waking" bit,
+// and the number of threads that have given up spinning and registered to
+// block (the waiter count).  A thread registers as a waiter *before* its final
+// check of the lock bit, so an 'unlock' that clears the lock bit after that
+// check necessarily observes the waiter and signals the semaphore; hence no
+// wake-up is lost.
+//
+// To avoid waking several threads for a single release, 'unlock' signals only
+// when the waking bit is clear, and sets it when it does so.  The signaled
+// thread clears the waking bit once it has returned from 'wait', before it
+// re-examines the lock bit.  Since a signal is sent only when the waking bit
+// transitions from clear to set, and the bit is cleared only after a signal is
+// consumed, at most one signal is ever outstanding.  An outstanding signal may
+// outlive the thread it was meant for (if that thread acquired the mutex
+// between registering and waiting); the next thread to block then returns
+// immediately and re-examines the state, which is harmless.
+//
+// The spin bound is tuned as in the GNU C library's
+// 'PTHREAD_MUTEX_ADAPTIVE_NP' mutex: a contended acquisition re-checks the
+// lock at most 'min(k_MAX_SPIN_LIMIT, 2 * spinLimit + 10)' times, and the
+// limit is then moved one eighth of the way toward the number of checks used.
+
+namespace BloombergLP {
+namespace {
+
+enum {
+    k_MAX_SPIN_LIMIT = 64,  // maximum number of re-checks before blocking
+
+    k_MAX_BACKOFF    = 16   // maximum number of pauses between re-checks
+};
+
+inline
+void pause()
+    // If available, execute a spin-wait hint instruction; otherwise do
+    // nothing.
+{
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    _mm_pause();
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bslmt {
+
+                            // -------------------
+                            // class AdaptiveMutex
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+void AdaptiveMutex::lockContended()
+{
+    const bsls::Types::Int64 start = d_collectStatistics
+                                   ? bsls::TimeUtil::getTimer()
+                                   : 0;
+
+    // Spin, re-checking the lock with exponentially increasing pauses.
+
+    int       limit       = d_spinLimit.loadRelaxed();
+    const int maxAttempts = k_MAX_SPIN_LIMIT < 2 * limit + 10
+                          ? k_MAX_SPIN_LIMIT
+                          : 2 * limit + 10;
+
+    bool acquired = false;
+    int  backoff  = 1;
+    int  attempt  = 0;
+
+    while (attempt < maxAttempts) {
+        ++attempt;
+        for (int i = 0; i < backoff; ++i) {
+            pause();
+        }
+        if (backoff < k_MAX_BACKOFF) {
+            backoff *= 2;
+        }
+
+        const int state = d_state.loadRelaxed();
+        if (0 == (state & k_LOCKED)
+         && state == d_state.testAndSwapAcqRel(state, state | k_LOCKED)) {
+            acquired = true;
+            break;
+        }
+    }
+
+    d_spinLimit.storeRelaxed(limit + (attempt - limit) / 8);
+
+    bool blocked = false;
+
+    if (!acquired) {
+        // Register as a waiter, then block until the lock is acquired.
+
+        int state = d_state.addAcqRel(k_WAITER_INC);
+        for (;;) {
+            if (0 == (state & k_LOCKED)) {
+                const int prev = d_state.testAndSwapAcqRel(
+                                          state,
+                                          (state - k_WAITER_INC) | k_LOCKED);
+                if (prev == state) {
+                    break;
+                }
+                state = prev;
+                continue;
+            }
+
+            d_semaphore.wait();
+            blocked = true;
+            if (d_collectStatistics) {
+                d_numBlocks.addRelaxed(1);
+            }
+
+            state = d_state.subtractAcqRel(k_WAKING);
+        }
+    }
+
+    if (d_collectStatistics) {
+        d_numContentions.addRelaxed(1);
+        if (!blocked) {
+            d_numSpinAcquisitions.addRelaxed(1);
+        }
+        d_waitTime.addRelaxed(bsls::TimeUtil::getTimer() - start);
+    }
+}
+
+void AdaptiveMutex::wakeWaiter()
+{
+    int state = d_state.loadRelaxed();
+    while (k_WAITER_INC <= state && 0 == (state & (k_WAKING | k_LOCKED))) {
+        const int prev = d_state.testAndSwapAcqRel(state, state | k_WAKING);
+        if (prev == state) {
+            d_semaphore.post();
+            return;                                                   // RETURN
+        }
+        state = prev;
+    }
+}
+
+// CREATORS
+AdaptiveMutex::AdaptiveMutex(StatisticsMode mode)
+: d_state(0)
+, d_spinLimit(0)
+, d_semaphore(0)
+, d_collectStatistics(e_COLLECT_STATISTICS == mode)
+, d_numContentions(0)
+, d_numSpinAcquisitions(0)
+, d_numBlocks(0)
+, d_waitTime(0)
+{
+}
+
+// MANIPULATORS
+void AdaptiveMutex::resetStatistics()
+{
+    d_numContentions.storeRelaxed(0);
+    d_numSpinAcquisitions.storeRelaxed(0);
+    d_numBlocks.storeRelaxed(0);
+    d_waitTime.storeRelaxed(0);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,367 @@
+// bslmt_adaptivemutex.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLMT_ADAPTIVEMUTEX
+#define INCLUDED_BSLMT_ADAPTIVEMUTEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mutex that spins briefly before blocking.
+//
+//@CLASSES:
+//  bslmt::AdaptiveMutex: spin-then-block mutex with contention statistics
+//
+//@SEE_ALSO: bslmt_mutex, bsls_spinlock, bslmt_meteredmutex
+//
+//@DESCRIPTION: This component provides a mutually exclusive lock,
+// 'bslmt::AdaptiveMutex', intended to protect very short critical sections
+// (e.g., tens of nanoseconds) under contention.  An uncontended 'lock' or
+// 'unlock' is a single atomic operation.  A thread that finds the mutex locked
+// first spins, re-checking the mutex with exponentially increasing pauses
+// between checks, and blocks on a semaphore only if the mutex does not become
+// available within a bounded number of checks.  Compared to 'bslmt::Mutex',
+// this avoids the cost of blocking and waking threads when the mutex is held
+// only briefly; compared to 'bsls::SpinLock', this does not consume a CPU
+// indefinitely when the mutex is held for a long time.
+//
+///Spin Limit Self-Tuning
+///----------------------
+// The maximum number of checks made before blocking is adjusted on each
+// contended acquisition, following the approach of the adaptive mutex of the
+// GNU C library: the limit moves one eighth of the way toward the number of
+// checks the acquisition actually needed (or, if the thread blocked, toward
+// twice the current limit plus a constant), and is bounded by an
+// implementation-defined maximum.  Mutexes protecting short critical sections
+// therefore settle on short spins, and mutexes whose owners routinely hold
+// them for longer spin up to the maximum before blocking.  The current limit
+// is available from the 'spinLimit' accessor.
+//
+///Contention Statistics
+///---------------------
+// If 'bslmt::AdaptiveMutex::e_COLLECT_STATISTICS' is supplied at construction,
+// the mutex counts the acquisitions that found the mutex locked
+// ('numContentions'), how many of those were satisfied without blocking
+// ('numSpinAcquisitions'), the number of times a thread blocked
+// ('numBlocks'), and the total time (in nanoseconds) spent acquiring the mutex
+// after finding it locked ('waitTime').  Statistics are updated only on the
+// contended path, so collecting them does not slow down uncontended use.
+// Statistics are reset by 'resetStatistics'.
+//
+///Fairness
+///--------
+// 'bslmt::AdaptiveMutex' is not fair: a spinning or newly arriving thread can
+// acquire the mutex ahead of threads that are blocked waiting for it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Protecting a Short Critical Section
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we protect a counter shared by several threads, where the
+// critical section is only a few instructions long and contention is
+// expected.
+//
+// First, we define the shared state, protected by an 'AdaptiveMutex' that
+// collects contention statistics:
+//..
+//  struct SharedCounter {
+//      bslmt::AdaptiveMutex d_mutex;
+//      bsls::Types::Int64   d_value;
+//
+//      SharedCounter()
+//      : d_mutex(bslmt::AdaptiveMutex::e_COLLECT_STATISTICS)
+//      , d_value(0)
+//      {
+//      }
+//  };
+//..
+// Then, we define a thread function that increments the counter many times,
+// using 'bslmt::LockGuard' to lock the mutex:
+//..
+//  extern "C" void *incrementCounter(void *arg)
+//  {
+//      SharedCounter *counter = static_cast<SharedCounter *>(arg);
+//
+//      for (int i = 0; i < 100000; ++i) {
+//          bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&counter->d_mutex);
+//          ++counter->d_value;
+//      }
+//      return 0;
+//  }
+//..
+// Next, we run four threads concurrently:
+//..
+//  SharedCounter counter;
+//
+//  bslmt::ThreadUtil::Handle handles[4];
+//  for (int i = 0; i < 4; ++i) {
+//      bslmt::ThreadUtil::create(&handles[i], &incrementCounter, &counter);
+//  }
+//  for (int i = 0; i < 4; ++i) {
+//      bslmt::ThreadUtil::join(handles[i]);
+//  }
+//..
+// Finally, we verify the result and inspect the contention statistics.  Every
+// contended acquisition either completed without blocking or blocked at least
+// once:
+//..
+//  assert(400000 == counter.d_value);
+//
+//  const bslmt::AdaptiveMutex& mutex = counter.d_mutex;
+//  assert(mutex.numSpinAcquisitions() <= mutex.numContentions());
+//  assert(mutex.numContentions() - mutex.numSpinAcquisitions()
+//                                                      <= mutex.numBlocks());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmt_semaphore.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bslmt {
+
+                            // ===================
+                            // class AdaptiveMutex
+                            // ===================
+
+class AdaptiveMutex {
+    // This class implements a mutex that spins, with exponential backoff and
+    // a self-tuned bound, before blocking a thread that attempts to lock it
+    // while it is locked.  Optionally, contention statistics are collected.
+
+    // PRIVATE TYPES
+    enum {
+        k_LOCKED     = 1,  // state bit: the mutex is locked
+
+        k_WAKING     = 2,  // state bit: a blocked thread has been signaled
+                           // and has not yet re-examined the state
+
+        k_WAITER_INC = 4   // state increment for each blocked (or blocking)
+                           // thread
+    };
+
+    // DATA
+    bsls::AtomicInt    d_state;                // lock bit, waking bit, and
+                                               // waiter count
+
+    bsls::AtomicInt    d_spinLimit;            // self-tuned spin bound
+
+    Semaphore          d_semaphore;            // blocks waiting threads
+
+    const bool         d_collectStatistics;    // 'true' if statistics are
+                                               // collected
+
+    bsls::AtomicInt64  d_numContentions;       // contended acquisitions
+
+    bsls::AtomicInt64  d_numSpinAcquisitions;  // contended acquisitions
+                                               // satisfied without blocking
+
+    bsls::AtomicInt64  d_numBlocks;            // waits on 'd_semaphore'
+
+    bsls::AtomicInt64  d_waitTime;             // nanoseconds spent in
+                                               // contended acquisitions
+
+    // NOT IMPLEMENTED
+    AdaptiveMutex(const AdaptiveMutex&) BSLS_KEYWORD_DELETED;
+    AdaptiveMutex& operator=(const AdaptiveMutex&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+    void lockContended();
+        // Acquire the lock on this mutex, which has been observed to be
+        // locked, by spinning and then, if necessary, blocking.
+
+    void wakeWaiter();
+        // Signal one blocked thread, unless a previously signaled thread has
+        // not yet re-examined the state of this mutex, or this mutex has been
+        // locked again (in which case the new owner signals on 'unlock').
+
+  public:
+    // TYPES
+    enum StatisticsMode {
+        e_NO_STATISTICS,      // do not collect contention statistics
+        e_COLLECT_STATISTICS  // collect contention statistics
+    };
+
+    // CREATORS
+    explicit AdaptiveMutex(StatisticsMode mode = e_NO_STATISTICS);
+        // Create an adaptive mutex in the unlocked state.  Optionally specify
+        // a statistics 'mode'; if 'mode' is 'e_COLLECT_STATISTICS', collect
+        // contention statistics (see {Contention Statistics}), and do not
+        // collect them otherwise.
+
+    ~AdaptiveMutex();
+        // Destroy this adaptive mutex.  The behavior is undefined unless this
+        // mutex is unlocked.
+
+    // MANIPULATORS
+    void lock();
+        // Acquire the lock on this mutex.  If this mutex is currently locked,
+        // spin for a bounded time and then, if it is still locked, suspend
+        // the execution of the current thread until the lock is acquired.
+        // The behavior is undefined if the calling thread already owns the
+        // lock on this mutex.
+
+    void resetStatistics();
+        // Reset the contention statistics of this mutex to zero.  Note that
+        // this method has no effect on the self-tuned spin limit.
+
+    int tryLock();
+        // Attempt to acquire the lock on this mutex.  Return 0 on success, and
+        // a non-zero value if this mutex is already locked.  The behavior is
+        // undefined if the calling thread already owns the lock on this
+        // mutex.  Note that this method neither spins nor blocks.
+
+    void unlock();
+        // Release the lock on this mutex that was previously acquired through
+        // a call to 'lock' or a successful call to 'tryLock', and wake a
+        // thread blocked in 'lock', if any.  The behavior is undefined unless
+        // the calling thread currently owns the lock on this mutex.
+
+    // ACCESSORS
+    bool isCollectingStatistics() const;
+        // Return 'true' if this mutex collects contention statistics, and
+        // 'false' otherwise.
+
+    bsls::Types::Int64 numBlocks() const;
+        // Return the number of times a thread blocked while acquiring this
+        // mutex, or 0 if statistics are not collected.  Note that a single
+        // acquisition may block more than once.
+
+    bsls::Types::Int64 numContentions() const;
+        // Return the number of calls to 'lock' that found this mutex locked,
+        // or 0 if statistics are not collected.
+
+    bsls::Types::Int64 numSpinAcquisitions() const;
+        // Return the number of calls to 'lock' that found this mutex locked
+        // and acquired it without blocking, or 0 if statistics are not
+        // collected.
+
+    int spinLimit() const;
+        // Return the current self-tuned bound on the number of times a thread
+        // that finds this mutex locked re-checks it before blocking (see
+        // {Spin Limit Self-Tuning}).
+
+    bsls::Types::Int64 waitTime() const;
+        // Return the total time, in nanoseconds, spent by calls to 'lock' that
+        // found this mutex locked, or 0 if statistics are not collected.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class AdaptiveMutex
+                            // -------------------
+
+// CREATORS
+inline
+AdaptiveMutex::~AdaptiveMutex()
+{
+    BSLS_ASSERT(0 == (d_state.loadRelaxed() & k_LOCKED));
+}
+
+// MANIPULATORS
+inline
+void AdaptiveMutex::lock()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                           0 == d_state.testAndSwapAcqRel(0, k_LOCKED))) {
+        return;                                                       // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    lockContended();
+}
+
+inline
+int AdaptiveMutex::tryLock()
+{
+    int state = d_state.loadRelaxed();
+    while (0 == (state & k_LOCKED)) {
+        const int prev = d_state.testAndSwapAcqRel(state, state | k_LOCKED);
+        if (prev == state) {
+            return 0;                                                 // RETURN
+        }
+        state = prev;
+    }
+    return 1;
+}
+
+inline
+void AdaptiveMutex::unlock()
+{
+    const int state = d_state.subtractAcqRel(k_LOCKED);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                          k_WAITER_INC <= state && 0 == (state & k_WAKING))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        wakeWaiter();
+    }
+}
+
+// ACCESSORS
+inline
+bool AdaptiveMutex::isCollectingStatistics() const
+{
+    return d_collectStatistics;
+}
+
+inline
+bsls::Types::Int64 AdaptiveMutex::numBlocks() const
+{
+    return d_numBlocks.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 AdaptiveMutex::numContentions() const
+{
+    return d_numContentions.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 AdaptiveMutex::numSpinAcquisitions() const
+{
+    return d_numSpinAcquisitions.loadRelaxed();
+}
+
+inline
+int AdaptiveMutex::spinLimit() const
+{
+    return d_spinLimit.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 AdaptiveMutex::waitTime() const
+{
+    return d_waitTime.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
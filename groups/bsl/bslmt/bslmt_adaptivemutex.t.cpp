@@ -0,0 +1,724 @@
+// bslmt_adaptivemutex.t.cpp                                          -*-C++-*-
+#include <bslmt_adaptivemutex.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// 'bslmt::AdaptiveMutex' is a mutex whose contended path spins and then
+// blocks.  Mutual exclusion is tested by having several threads increment a
+// non-atomic counter under the mutex, with both short critical sections
+// (exercising the spinning path) and long critical sections (exercising the
+// blocking path).  The statistics are tested by arranging a deterministic
+// contended acquisition, and by checking their invariants after the
+// concurrency test.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] AdaptiveMutex(StatisticsMode mode = e_NO_STATISTICS);
+// [ 1] ~AdaptiveMutex();
+//
+// MANIPULATORS
+// [ 1] void lock();
+// [ 1] int tryLock();
+// [ 1] void unlock();
+// [ 2] void resetStatistics();
+//
+// ACCESSORS
+// [ 2] bool isCollectingStatistics() const;
+// [ 2] bsls::Types::Int64 numBlocks() const;
+// [ 2] bsls::Types::Int64 numContentions() const;
+// [ 2] bsls::Types::Int64 numSpinAcquisitions() const;
+// [ 2] int spinLimit() const;
+// [ 2] bsls::Types::Int64 waitTime() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCURRENT MUTUAL EXCLUSION
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE: AdaptiveMutex vs Mutex vs SpinLock
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmt::AdaptiveMutex Obj;
+
+// ============================================================================
+//                          HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct TryLockArgs {
+    Obj             *d_mutex_p;
+    bsls::AtomicInt  d_result;
+};
+
+extern "C" void *tryLockThread(void *arg)
+    // Attempt to lock the mutex referred to by the specified 'arg' (a
+    // 'TryLockArgs'), unlocking it on success, and store the result of
+    // 'tryLock' in 'arg'.
+{
+    TryLockArgs *args = static_cast<TryLockArgs *>(arg);
+
+    const int rc = args->d_mutex_p->tryLock();
+    if (0 == rc) {
+        args->d_mutex_p->unlock();
+    }
+    args->d_result = rc;
+    return 0;
+}
+
+int tryLockFromOtherThread(Obj *mutex)
+    // Return the result of calling 'tryLock' on the specified 'mutex' from
+    // another thread.
+{
+    TryLockArgs args;
+    args.d_mutex_p = mutex;
+    args.d_result  = -1;
+
+    bslmt::ThreadUtil::Handle handle;
+    int rc = bslmt::ThreadUtil::create(&handle, &tryLockThread, &args);
+    ASSERT(0 == rc);
+    rc = bslmt::ThreadUtil::join(handle);
+    ASSERT(0 == rc);
+
+    return args.d_result;
+}
+
+extern "C" void *lockThread(void *arg)
+    // Lock and then unlock the mutex referred to by the specified 'arg'.
+{
+    Obj *mutex = static_cast<Obj *>(arg);
+
+    mutex->lock();
+    mutex->unlock();
+    return 0;
+}
+
+struct CounterArgs {
+    Obj                *d_mutex_p;
+    bsls::Types::Int64  d_counter;         // protected by '*d_mutex_p'
+    int                 d_numIterations;
+    int                 d_holdMicroseconds;
+};
+
+extern "C" void *incrementThread(void *arg)
+    // Increment, under the mutex, the counter referred to by the specified
+    // 'arg' (a 'CounterArgs') the number of times indicated by 'arg',
+    // holding the lock for the duration indicated by 'arg'.
+{
+    CounterArgs *args = static_cast<CounterArgs *>(arg);
+
+    for (int i = 0; i < args->d_numIterations; ++i) {
+        args->d_mutex_p->lock();
+
+        const bsls::Types::Int64 value = args->d_counter;
+        if (args->d_holdMicroseconds) {
+            bslmt::ThreadUtil::microSleep(args->d_holdMicroseconds);
+        }
+        else {
+            bslmt::ThreadUtil::yield();
+        }
+        args->d_counter = value + 1;
+
+        args->d_mutex_p->unlock();
+    }
+    return 0;
+}
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Protecting a Short Critical Section
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we protect a counter shared by several threads, where the
+// critical section is only a few instructions long and contention is
+// expected.
+//
+// First, we define the shared state, protected by an 'AdaptiveMutex' that
+// collects contention statistics:
+//..
+    struct SharedCounter {
+        bslmt::AdaptiveMutex d_mutex;
+        bsls::Types::Int64   d_value;
+
+        SharedCounter()
+        : d_mutex(bslmt::AdaptiveMutex::e_COLLECT_STATISTICS)
+        , d_value(0)
+        {
+        }
+    };
+//..
+// Then, we define a thread function that increments the counter many times,
+// using 'bslmt::LockGuard' to lock the mutex:
+//..
+    extern "C" void *incrementCounter(void *arg)
+    {
+        SharedCounter *counter = static_cast<SharedCounter *>(arg);
+
+        for (int i = 0; i < 100000; ++i) {
+            bslmt::LockGuard<bslmt::AdaptiveMutex> guard(&counter->d_mutex);
+            ++counter->d_value;
+        }
+        return 0;
+    }
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                              BENCHMARK SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace perf {
+
+template <class MUTEX>
+class Benchmark {
+    // This class provides the run function used to measure the throughput of
+    // a short critical section protected by a mutex of type 'MUTEX'.
+
+    // DATA
+    MUTEX              d_mutex;
+    bsls::Types::Int64 d_counter;    // protected by 'd_mutex'
+
+  public:
+    // CREATORS
+    Benchmark()
+        // Create a benchmark having an unlocked mutex.  Note that
+        // value-initializing a 'bsls::SpinLock' leaves it unlocked.
+    : d_mutex()
+    , d_counter(0)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()(int)
+        // Lock the mutex, increment the counter, and unlock the mutex.
+    {
+        d_mutex.lock();
+        ++d_counter;
+        d_mutex.unlock();
+    }
+};
+
+template <class MUTEX>
+class BenchmarkRunner {
+    // This class provides a copyable function object invoking a 'Benchmark'.
+
+    // DATA
+    Benchmark<MUTEX> *d_benchmark_p;  // benchmark to invoke (held)
+
+  public:
+    // CREATORS
+    explicit BenchmarkRunner(Benchmark<MUTEX> *benchmark)
+        // Create a runner invoking the specified 'benchmark'.
+    : d_benchmark_p(benchmark)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(int threadIndex) const
+        // Invoke the benchmark with the specified 'threadIndex'.
+    {
+        (*d_benchmark_p)(threadIndex);
+    }
+};
+
+template <class MUTEX>
+void runBenchmark(const char         *name,
+                  int                 numThreads,
+                  bsls::Types::Int64  busyWork,
+                  int                 numMillis,
+                  int                 numSamples)
+    // Print, tagged with the specified 'name', the median throughput of the
+    // specified 'numThreads' threads incrementing a counter protected by a
+    // mutex of type 'MUTEX', each performing the specified 'busyWork' between
+    // increments, running the specified 'numSamples' samples of 'numMillis'
+    // milliseconds.
+{
+    bslma::NewDeleteAllocator        nalloc;
+    Benchmark<MUTEX>                 bench;
+    bslmt::ThroughputBenchmark       tb(&nalloc);
+    bslmt::ThroughputBenchmarkResult result(&nalloc);
+
+    const int group = tb.addThreadGroup(BenchmarkRunner<MUTEX>(&bench),
+                                        numThreads,
+                                        busyWork);
+
+    tb.execute(&result, numMillis, numSamples);
+
+    double median = 0;
+    result.getMedian(&median, group);
+
+    bsl::cout << name << "," << numThreads << "," << busyWork << ","
+              << bsl::fixed << bsl::setprecision(0) << median << "\n";
+}
+
+}  // close namespace perf
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Next, we run four threads concurrently:
+//..
+    SharedCounter counter;
+
+    bslmt::ThreadUtil::Handle handles[4];
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], &incrementCounter, &counter);
+    }
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+//..
+// Finally, we verify the result and inspect the contention statistics.  Every
+// contended acquisition either completed without blocking or blocked at least
+// once:
+//..
+    ASSERT(400000 == counter.d_value);
+
+    const bslmt::AdaptiveMutex& mutex = counter.d_mutex;
+    ASSERT(mutex.numSpinAcquisitions() <= mutex.numContentions());
+    ASSERT(mutex.numContentions() - mutex.numSpinAcquisitions()
+                                                        <= mutex.numBlocks());
+//..
+        if (veryVerbose) {
+            P_(mutex.numContentions()) P_(mutex.numSpinAcquisitions())
+            P_(mutex.numBlocks())      P(mutex.spinLimit())
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENT MUTUAL EXCLUSION
+        //
+        // Concerns:
+        //: 1 At most one thread holds the mutex at a time, whether waiting
+        //:   threads acquire it by spinning or by blocking.
+        //:
+        //: 2 No wake-up is lost: all threads eventually acquire the mutex.
+        //:
+        //: 3 The statistics are consistent with each other, and the spin
+        //:   limit stays within its bounds.
+        //
+        // Plan:
+        //: 1 For several numbers of threads, have each thread increment a
+        //:   non-atomic counter under the mutex a fixed number of times,
+        //:   yielding inside the critical section, and verify the final
+        //:   count.  (C-1..2)
+        //:
+        //: 2 Repeat with the lock held for a millisecond, so that waiting
+        //:   threads exhaust their spins and block.  (C-1..2)
+        //:
+        //: 3 After each run verify the relations between the statistics and
+        //:   the bounds of 'spinLimit'.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENT MUTUAL EXCLUSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT MUTUAL EXCLUSION" << endl
+                          << "===========================" << endl;
+
+        enum { k_MAX_THREADS = 8 };
+
+        static const struct {
+            int d_line;
+            int d_numThreads;
+            int d_numIterations;
+            int d_holdMicroseconds;
+        } DATA[] = {
+            //LINE  THREADS  ITERATIONS  HOLD
+            //----  -------  ----------  ----
+            { L_,         2,      20000,    0 },
+            { L_,         4,      20000,    0 },
+            { L_,         8,      10000,    0 },
+            { L_,         2,         50, 1000 },
+            { L_,         8,         25, 1000 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE        = DATA[ti].d_line;
+            const int NUM_THREADS = DATA[ti].d_numThreads;
+            const int NUM_ITER    = DATA[ti].d_numIterations;
+            const int HOLD        = DATA[ti].d_holdMicroseconds;
+
+            Obj mX(Obj::e_COLLECT_STATISTICS);  const Obj& X = mX;
+
+            CounterArgs args;
+            args.d_mutex_p          = &mX;
+            args.d_counter          = 0;
+            args.d_numIterations    = NUM_ITER;
+            args.d_holdMicroseconds = HOLD;
+
+            bslmt::ThreadUtil::Handle handles[k_MAX_THREADS];
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                const int rc = bslmt::ThreadUtil::create(&handles[i],
+                                                         &incrementThread,
+                                                         &args);
+                ASSERTV(LINE, i, 0 == rc);
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                const int rc = bslmt::ThreadUtil::join(handles[i]);
+                ASSERTV(LINE, i, 0 == rc);
+            }
+
+            ASSERTV(LINE, args.d_counter,
+                    NUM_THREADS * NUM_ITER == args.d_counter);
+            ASSERTV(LINE, 0 == mX.tryLock());
+            mX.unlock();
+
+            ASSERTV(LINE, X.numSpinAcquisitions() <= X.numContentions());
+            ASSERTV(LINE, X.numContentions() - X.numSpinAcquisitions()
+                                                          <= X.numBlocks());
+            ASSERTV(LINE, 0 <= X.waitTime());
+            ASSERTV(LINE, X.spinLimit(), 0 <= X.spinLimit());
+            ASSERTV(LINE, X.spinLimit(), 64 >= X.spinLimit());
+
+            if (HOLD) {
+                // Waiting threads cannot outlast a one millisecond hold by
+                // spinning.
+
+                ASSERTV(LINE, 0 < X.numBlocks());
+            }
+
+            if (veryVerbose) {
+                P_(LINE) P_(X.numContentions()) P_(X.numSpinAcquisitions())
+                P_(X.numBlocks()) P(X.spinLimit())
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // STATISTICS
+        //
+        // Concerns:
+        //: 1 Statistics are collected only if requested at construction, and
+        //:   'isCollectingStatistics' reports the mode.
+        //:
+        //: 2 Uncontended operations do not update the statistics.
+        //:
+        //: 3 A contended acquisition that blocks is counted as a contention
+        //:   and a block, but not as a spin acquisition, and its duration is
+        //:   added to the wait time.
+        //:
+        //: 4 The spin limit is updated by a contended acquisition.
+        //:
+        //: 5 'resetStatistics' resets all statistics to zero.
+        //
+        // Plan:
+        //: 1 Create objects with each mode and verify the accessors.  (C-1)
+        //:
+        //: 2 Lock and unlock, and 'tryLock' and unlock, an object, and verify
+        //:   that the statistics are unchanged.  (C-2)
+        //:
+        //: 3 Lock an object, start a thread that locks it, hold the lock for
+        //:   100 milliseconds (far longer than the maximum spin), unlock, and
+        //:   join the thread.  Verify the statistics and the spin limit.  Do
+        //:   the same with an object not collecting statistics.  (C-1,3..4)
+        //:
+        //: 4 Call 'resetStatistics' and verify the statistics.  (C-5)
+        //
+        // Testing:
+        //   void resetStatistics();
+        //   bool isCollectingStatistics() const;
+        //   bsls::Types::Int64 numBlocks() const;
+        //   bsls::Types::Int64 numContentions() const;
+        //   bsls::Types::Int64 numSpinAcquisitions() const;
+        //   int spinLimit() const;
+        //   bsls::Types::Int64 waitTime() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STATISTICS" << endl
+                          << "==========" << endl;
+
+        for (int mode = 0; mode < 2; ++mode) {
+            const bool COLLECT = 1 == mode;
+
+            Obj mX(COLLECT ? Obj::e_COLLECT_STATISTICS
+                           : Obj::e_NO_STATISTICS);
+            const Obj& X = mX;
+
+            ASSERTV(mode, COLLECT == X.isCollectingStatistics());
+            ASSERTV(mode, 0 == X.numContentions());
+            ASSERTV(mode, 0 == X.numSpinAcquisitions());
+            ASSERTV(mode, 0 == X.numBlocks());
+            ASSERTV(mode, 0 == X.waitTime());
+            ASSERTV(mode, 0 == X.spinLimit());
+
+            mX.lock();
+            mX.unlock();
+            ASSERTV(mode, 0 == mX.tryLock());
+            mX.unlock();
+
+            ASSERTV(mode, 0 == X.numContentions());
+            ASSERTV(mode, 0 == X.numBlocks());
+
+            mX.lock();
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERTV(mode,
+                    0 == bslmt::ThreadUtil::create(&handle, &lockThread, &mX));
+
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+
+            mX.unlock();
+            ASSERTV(mode, 0 == bslmt::ThreadUtil::join(handle));
+
+            // The first contended acquisition re-checks the lock 10 times
+            // before blocking, moving the limit from 0 to 10 / 8.
+
+            ASSERTV(mode, X.spinLimit(), 1 == X.spinLimit());
+
+            if (COLLECT) {
+                ASSERTV(X.numContentions(),      1 == X.numContentions());
+                ASSERTV(X.numSpinAcquisitions(),
+                        0 == X.numSpinAcquisitions());
+                ASSERTV(X.numBlocks(),           1 <= X.numBlocks());
+                ASSERTV(X.waitTime(), 0 < X.waitTime());
+            }
+            else {
+                ASSERTV(X.numContentions(),      0 == X.numContentions());
+                ASSERTV(X.numSpinAcquisitions(),
+                        0 == X.numSpinAcquisitions());
+                ASSERTV(X.numBlocks(),           0 == X.numBlocks());
+                ASSERTV(X.waitTime(),            0 == X.waitTime());
+            }
+
+            mX.resetStatistics();
+
+            ASSERTV(mode, 0 == X.numContentions());
+            ASSERTV(mode, 0 == X.numSpinAcquisitions());
+            ASSERTV(mode, 0 == X.numBlocks());
+            ASSERTV(mode, 0 == X.waitTime());
+            ASSERTV(mode, 1 == X.spinLimit());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, lock it, and verify that 'tryLock' from another
+        //:   thread fails; unlock it and verify that 'tryLock' from another
+        //:   thread succeeds.  (C-1)
+        //:
+        //: 2 Verify that 'tryLock' succeeds on an unlocked object, and that
+        //:   'lock' succeeds after 'unlock'.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;
+
+        mX.lock();
+        ASSERT(0 != tryLockFromOtherThread(&mX));
+        mX.unlock();
+        ASSERT(0 == tryLockFromOtherThread(&mX));
+
+        ASSERT(0 == mX.tryLock());
+        ASSERT(0 != tryLockFromOtherThread(&mX));
+        mX.unlock();
+
+        mX.lock();
+        mX.unlock();
+        ASSERT(0 == tryLockFromOtherThread(&mX));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: AdaptiveMutex vs Mutex vs SpinLock
+        //   Compare the median throughput of a short critical section
+        //   protected by 'bslmt::AdaptiveMutex', 'bslmt::Mutex', and
+        //   'bsls::SpinLock' for an increasing number of threads.  Command
+        //   line parameters:
+        //   2nd parameter: maximum number of threads (defaults to 8).
+        //   3rd parameter: busy work between acquisitions (defaults to 100).
+        //   4th parameter: milliseconds per sample (defaults to 1000).
+        //   5th parameter: number of samples (defaults to 5).
+        //
+        // Concerns:
+        //: 1 Under contention on a short critical section, 'AdaptiveMutex'
+        //:   outperforms 'bslmt::Mutex'.
+        //
+        // Plan:
+        //: 1 Run 'bslmt::ThroughputBenchmark' on each mutex type, doubling
+        //:   the number of threads, and print the results as CSV.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: AdaptiveMutex vs Mutex vs SpinLock
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: ADAPTIVEMUTEX VS MUTEX VS SPINLOCK"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        const int maxThreads = argc > 2 ? atoi(argv[2]) :    8;
+        const int busyWork   = argc > 3 ? atoi(argv[3]) :  100;
+        const int numMillis  = argc > 4 ? atoi(argv[4]) : 1000;
+        const int numSamples = argc > 5 ? atoi(argv[5]) :    5;
+
+        bsl::cout << "Mutex,Threads,BusyWork,Ops/s\n";
+        for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+            perf::runBenchmark<bslmt::AdaptiveMutex>("AdaptiveMutex",
+                                                     numThreads,
+                                                     busyWork,
+                                                     numMillis,
+                                                     numSamples);
+            perf::runBenchmark<bslmt::Mutex>("Mutex",
+                                             numThreads,
+                                             busyWork,
+                                             numMillis,
+                                             numSamples);
+            perf::runBenchmark<bsls::SpinLock>("SpinLock",
+                                               numThreads,
+                                               busyWork,
+                                               numMillis,
+                                               numSamples);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
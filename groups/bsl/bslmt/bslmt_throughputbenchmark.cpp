@@ -12,6 +12,9 @@ BSLS_IDENT_RCSID(bslmt_bslmt_throughputbenchmark_cpp,"$Id$ $CSID$")
 
 #include <bslmf_assert.h>
 
+#include <bsls_assert.h>
+#include <bsls_cyclecounter.h>
+#include <bsls_platform.h>
 #include <bsls_systemtime.h>
 #include <bsls_types.h>
 
@@ -20,6 +23,13 @@ BSLS_IDENT_RCSID(bslmt_bslmt_throughputbenchmark_cpp,"$Id$ $CSID$")
 
 #include <bslstl_sharedptr.h>
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <windows.h>
+#endif
+
 namespace BloombergLP {
 namespace bslmt {
 
@@ -77,9 +87,39 @@ bsls::Types::Int64 ThroughputBenchmark::estimateBusyWorkAmount(
     return ret;
 }
 
+int ThroughputBenchmark::setCurrentThreadAffinity(int cpu)
+{
+    BSLS_ASSERT(0 <= cpu);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (CPU_SETSIZE <= cpu) {
+        return -1;                                                    // RETURN
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    return pthread_setaffinity_np(pthread_self(), sizeof cpuSet, &cpuSet);
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+    if (static_cast<int>(sizeof(DWORD_PTR) * 8) <= cpu) {
+        return -1;                                                    // RETURN
+    }
+
+    return 0 != SetThreadAffinityMask(GetCurrentThread(),
+                                      static_cast<DWORD_PTR>(1) << cpu)
+           ? 0
+           : -1;
+#else
+    return -1;
+#endif
+}
+
 // CREATORS
 ThroughputBenchmark::ThroughputBenchmark(bslma::Allocator *basicAllocator)
 : d_threadGroups(basicAllocator)
+, d_numWarmUpSamples(0)
+, d_latencySamplingInterval(0)
+, d_maxLatencySamplesPerThread(1)
 {
     d_state.storeRelease(0);
 }
@@ -119,6 +159,37 @@ int ThroughputBenchmark::addThreadGroup(
     return threadGroupIndex;
 }
 
+void ThroughputBenchmark::setLatencySampling(int samplingInterval,
+                                             int maxSamplesPerThread)
+{
+    BSLS_ASSERT(0 <= samplingInterval);
+    BSLS_ASSERT(0 <  maxSamplesPerThread);
+
+    d_latencySamplingInterval    = samplingInterval;
+    d_maxLatencySamplesPerThread = maxSamplesPerThread;
+}
+
+void ThroughputBenchmark::setNumWarmUpSamples(int numWarmUpSamples)
+{
+    BSLS_ASSERT(0 <= numWarmUpSamples);
+
+    d_numWarmUpSamples = numWarmUpSamples;
+}
+
+void ThroughputBenchmark::setThreadGroupAffinity(
+                                      int                     threadGroupIndex,
+                                      const bsl::vector<int>& cpus)
+{
+    BSLS_ASSERT(0                 <= threadGroupIndex);
+    BSLS_ASSERT(numThreadGroups() >  threadGroupIndex);
+
+    for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+        BSLS_ASSERT(0 <= cpus[i]);
+    }
+
+    d_threadGroups[threadGroupIndex].d_cpus = cpus;
+}
+
 void ThroughputBenchmark::execute(
                               ThroughputBenchmarkResult *result,
                               int                        millisecondsPerSample,
@@ -156,9 +227,20 @@ void ThroughputBenchmark::execute(
     }
     result->initialize(numSamples, threadGroupSizes);
 
-    for (int sampleIndex = 0; sampleIndex < numSamples; ++sampleIndex) {
-        bool isFirst = sampleIndex == 0;
-        bool isLast  = sampleIndex == numSamples - 1;
+    // Warm-up samples have negative indices, and their results are
+    // discarded.
+
+    const double nanosecondsPerTick =
+                                 d_latencySamplingInterval
+                                 ? bsls::CycleCounter::nanosecondsPerTick()
+                                 : 0.0;
+
+    for (int sampleIndex = -d_numWarmUpSamples;
+         sampleIndex < numSamples;
+         ++sampleIndex) {
+        bool isFirst  = sampleIndex == -d_numWarmUpSamples;
+        bool isLast   = sampleIndex == numSamples - 1;
+        bool isWarmUp = sampleIndex < 0;
         if (initializeFunctor) {
             initializeFunctor(isFirst);
         }
@@ -186,6 +268,20 @@ void ThroughputBenchmark::execute(
                 functionArgs[threadIndex].d_threadIndex = j;
                 functionArgs[threadIndex].d_barrier_p = &barrier;
 
+                const bsl::vector<int>& cpus = d_threadGroups[i].d_cpus;
+                functionArgs[threadIndex].d_cpu =
+                               cpus.empty() ? -1 : cpus[j % cpus.size()];
+
+                // Allocate storage for latencies before the sample starts.
+
+                functionArgs[threadIndex].d_latencySamplingInterval =
+                                                     d_latencySamplingInterval;
+                functionArgs[threadIndex].d_numLatencies = 0;
+                if (d_latencySamplingInterval && !isWarmUp) {
+                    functionArgs[threadIndex].d_latencies.resize(
+                                                 d_maxLatencySamplesPerThread);
+                }
+
                 workFunctions[threadIndex].reset(new
                   ThroughputBenchmark_WorkFunction(functionArgs[threadIndex]));
                 bslmt::ThreadUtil::create(&handles[threadIndex],
@@ -211,15 +307,27 @@ void ThroughputBenchmark::execute(
             int numThreadsInGroup = d_threadGroups[tgIdx].d_numThreads;
             for (int tIdx = 0; tIdx < numThreadsInGroup; ++tIdx) {
                 bslmt::ThreadUtil::join(handles[curOffset + tIdx]);
-                bsls::Types::Int64 actualNanos =
-                                              functionArgs[tIdx].d_actualNanos;
-                bsls::Types::Int64 count = functionArgs[tIdx].d_count;
+                if (isWarmUp) {
+                    continue;                                       // CONTINUE
+                }
+
+                const ThroughputBenchmark_WorkData& data =
+                                              functionArgs[curOffset + tIdx];
+
+                bsls::Types::Int64 actualNanos = data.d_actualNanos;
+                bsls::Types::Int64 count       = data.d_count;
 
                 static const double k_NANOS_IN_SECOND = 1e9;
 
                 double throughput = static_cast<double>(count) *
                           k_NANOS_IN_SECOND / static_cast<double>(actualNanos);
                 result->setThroughput(tgIdx, tIdx, sampleIndex, throughput);
+
+                for (int k = 0; k < data.d_numLatencies; ++k) {
+                    result->addLatency(tgIdx,
+                                       static_cast<double>(data.d_latencies[k])
+                                                         * nanosecondsPerTick);
+                }
             }
             curOffset += numThreadsInGroup;
         }
@@ -237,6 +345,9 @@ void ThroughputBenchmark::execute(
 // MANIPULATORS
 void ThroughputBenchmark_WorkFunction::operator()()
 {
+    if (0 <= d_data.d_cpu) {
+        ThroughputBenchmark::setCurrentThreadAffinity(d_data.d_cpu);
+    }
     if (d_data.d_initialize) {
         (d_data.d_initialize)();
     }
@@ -246,9 +357,40 @@ void ThroughputBenchmark_WorkFunction::operator()()
     bsls::TimeInterval startTime = bsls::SystemTime::nowMonotonicClock();
     // Loop interspersing running the function to benchmark and wasting time.
     bsls::Types::Int64 count = 0;
-    for (; d_data.d_bench_p->isRunState(); ++count) {
-        d_data.d_func(d_data.d_threadIndex);
-        d_data.d_bench_p->busyWork(d_data.d_amount);
+    if (d_data.d_latencies.empty()) {
+        for (; d_data.d_bench_p->isRunState(); ++count) {
+            d_data.d_func(d_data.d_threadIndex);
+            d_data.d_bench_p->busyWork(d_data.d_amount);
+        }
+    }
+    else {
+        // Time every 'd_latencySamplingInterval'th call until the storage
+        // for latencies is exhausted, then continue untimed.
+
+        const int maxLatencies = static_cast<int>(d_data.d_latencies.size());
+        int       numLatencies = 0;
+        int       untilTimed   = 0;
+        for (; numLatencies < maxLatencies && d_data.d_bench_p->isRunState();
+               ++count) {
+            if (0 == untilTimed) {
+                const bsls::Types::Int64 start = bsls::CycleCounter::now();
+                d_data.d_func(d_data.d_threadIndex);
+                d_data.d_latencies[numLatencies++] =
+                                             bsls::CycleCounter::now() - start;
+                untilTimed = d_data.d_latencySamplingInterval;
+            }
+            else {
+                d_data.d_func(d_data.d_threadIndex);
+            }
+            --untilTimed;
+            d_data.d_bench_p->busyWork(d_data.d_amount);
+        }
+        d_data.d_numLatencies = numLatencies;
+
+        for (; d_data.d_bench_p->isRunState(); ++count) {
+            d_data.d_func(d_data.d_threadIndex);
+            d_data.d_bench_p->busyWork(d_data.d_amount);
+        }
     }
     bsls::TimeInterval endTime = bsls::SystemTime::nowMonotonicClock();
     bsls::TimeInterval duration = endTime - startTime;
@@ -29,6 +29,39 @@ BSLS_IDENT("$Id: $")
 // possible to provide initialize and cleanup functions for a sample and / or a
 // thread.
 //
+///Warm-Up Samples
+///---------------
+// The first samples of a benchmark are often unrepresentative, as caches,
+// allocators, and branch predictors are cold, and the processor may not yet
+// have reached its steady clock frequency.  'setNumWarmUpSamples' configures
+// a number of additional samples executed (in the same way as other samples,
+// including the invocation of the initialize, shutdown, and cleanup functions)
+// before the samples whose results are loaded into the result object.
+//
+///Thread Affinity
+///---------------
+// Results are more reproducible if the threads of a benchmark do not migrate
+// between processors.  'setThreadGroupAffinity' specifies a list of
+// processors for a thread group: the thread having index 'i' in the group is
+// pinned to processor 'cpus[i % cpus.size()]' at its start.  Affinity is
+// supported on Linux and Windows; on other platforms, or if pinning fails
+// (for example, because the processor does not exist), the thread runs
+// unpinned.  'setCurrentThreadAffinity' can be used to check whether pinning
+// to a processor is supported.
+//
+///Latency Sampling
+///----------------
+// By default, only the throughput of each thread is measured.  If latency
+// sampling is enabled by 'setLatencySampling', every 'samplingInterval'th
+// call to the run function of each thread is individually timed, using
+// 'bsls::CycleCounter', and the latencies (at most 'maxSamplesPerThread' per
+// thread in each sample) are added to the result object (see
+// 'bslmt::ThroughputBenchmarkResult::getLatencyPercentile').  Storage for the
+// latencies is allocated before a sample starts, so that sampling adds only
+// two reads of the cycle counter to a sampled call.  Note that timing is
+// excluded from the throughput only approximately, so small sampling
+// intervals reduce the measured throughput of very short run functions.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -108,6 +141,53 @@ BSLS_IDENT("$Id: $")
 //  myResult.getMedian(&median, consumerGroupIdx);
 //  bsl::cout << "Throughput:" << median << "\n";
 //..
+//
+///Example 2: Warm-Up, Affinity, Latency, and JSON Output
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we extend the previous benchmark to discard warm-up
+// samples, pin the producers and consumers to distinct processors, sample
+// the latency of the push operation, and write the result as JSON.
+//
+// First, we create the benchmark and thread groups as before:
+//..
+//  bslmt::ThroughputBenchmark bench;
+//  const int pushIdx = bench.addThreadGroup(
+//                      myPush,
+//                      2,
+//                      100,
+//                      bslmt::ThroughputBenchmark::InitializeThreadFunction(),
+//                      myCleanup);
+//  const int popIdx  = bench.addThreadGroup(myPop, 2, 100);
+//..
+// Then, we pin the producers to processors 0 and 1, and the consumers to
+// processors 2 and 3:
+//..
+//  bsl::vector<int> cpus(2);
+//  cpus[0] = 0;
+//  cpus[1] = 1;
+//  bench.setThreadGroupAffinity(pushIdx, cpus);
+//  cpus[0] = 2;
+//  cpus[1] = 3;
+//  bench.setThreadGroupAffinity(popIdx, cpus);
+//..
+// Next, we discard two warm-up samples, and time every 16th call of each run
+// function:
+//..
+//  bench.setNumWarmUpSamples(2);
+//  bench.setLatencySampling(16, 10000);
+//..
+// Now, we execute the benchmark for 5 samples of 100 milliseconds:
+//..
+//  bslmt::ThroughputBenchmarkResult result;
+//  bench.execute(&result, 100, 5);
+//  assert(5 == result.numSamples());
+//  assert(0 <  result.numLatencies(pushIdx));
+//..
+// Finally, we remove outlying samples and write the result as JSON:
+//..
+//  result.removeOutliers();
+//  result.printJson(bsl::cout, "queue") << "\n";
+//..
 
 #include <bslscm_version.h>
 
@@ -214,6 +294,10 @@ class ThroughputBenchmark {
 
         CleanupThreadFunction     d_cleanup;      // cleanup function per
                                                   // thread
+
+        bsl::vector<int>          d_cpus;         // processors to which the
+                                                  // threads are pinned, or
+                                                  // empty if unpinned
     };
 
   private:
@@ -230,6 +314,20 @@ class ThroughputBenchmark {
                                                   // starts as 0, and exits
                                                   // when is set to 1.
 
+    int                       d_numWarmUpSamples; // number of samples run and
+                                                  // discarded before the
+                                                  // measured samples
+
+    int                       d_latencySamplingInterval;
+                                                  // number of calls per timed
+                                                  // call, or 0 if latency
+                                                  // sampling is disabled
+
+    int                       d_maxLatencySamplesPerThread;
+                                                  // maximum number of timed
+                                                  // calls per thread per
+                                                  // sample
+
     // FRIENDS
     friend class ThroughputBenchmark_WorkFunction;
     friend class ThroughputBenchmark_TestUtil;
@@ -264,6 +362,12 @@ class ThroughputBenchmark {
         // with the returned work amount executes, approximately, for the
         // specified 'duration'.
 
+    static int setCurrentThreadAffinity(int cpu);
+        // Pin the calling thread to the specified 'cpu' processor.  Return 0
+        // on success, and a non-zero value if pinning is not supported on
+        // this platform or failed.  The behavior is undefined unless
+        // '0 <= cpu'.
+
     // CREATORS
     explicit ThroughputBenchmark(bslma::Allocator *basicAllocator = 0);
         // Create an empty 'ThroughputBenchmark' object.  Optionally specify a
@@ -292,6 +396,31 @@ class ThroughputBenchmark {
         // otherwise.  Return an id for the added thread group.  The behavior
         // is undefined unless '0 < numThreads' and '0 <= busyWorkAmount'.
 
+    void setLatencySampling(int samplingInterval, int maxSamplesPerThread);
+        // Time every call to the run function having an index (among the
+        // calls made by the same thread in a sample) divisible by the
+        // specified 'samplingInterval', up to the specified
+        // 'maxSamplesPerThread' calls per thread in each sample, and add the
+        // latencies to the result of 'execute'.  If 'samplingInterval' is 0,
+        // latency sampling is disabled (the default).  The behavior is
+        // undefined unless '0 <= samplingInterval' and
+        // '0 < maxSamplesPerThread'.  See {Latency Sampling}.
+
+    void setNumWarmUpSamples(int numWarmUpSamples);
+        // Set the number of samples executed, and discarded, before the
+        // samples whose results are loaded by 'execute' to the specified
+        // 'numWarmUpSamples'.  The behavior is undefined unless
+        // '0 <= numWarmUpSamples'.  See {Warm-Up Samples}.
+
+    void setThreadGroupAffinity(int                     threadGroupIndex,
+                                const bsl::vector<int>& cpus);
+        // Pin the thread having index 'i' in the specified 'threadGroupIndex'
+        // to the processor 'cpus[i % cpus.size()]' of the specified 'cpus' in
+        // subsequent calls to 'execute', or do not pin the threads if 'cpus'
+        // is empty.  The behavior is undefined unless
+        // '0 <= threadGroupIndex < numThreadGroups()' and each element of
+        // 'cpus' is non-negative.  See {Thread Affinity}.
+
     void execute(ThroughputBenchmarkResult       *result,
                  int                              millisecondsPerSample,
                  int                              numSamples);
@@ -316,9 +445,30 @@ class ThroughputBenchmark {
         // boolean flag 'isLast', that is set to 'true' on the last sample, and
         // 'false' otherwise.  The behavior is undefined unless
         // '0 < millisecondsPerSample', '0 < numSamples', and
-        // '0 < numThreadGroups()'.  Also see {Structure of a Test}.
+        // '0 < numThreadGroups()'.  Note that 'numWarmUpSamples()' additional
+        // samples are executed before those whose results are stored, and
+        // that 'isFirst' and 'isLast' refer to the first and last sample
+        // executed, including warm-up samples.  Also see
+        // {Structure of a Test}.
 
     // ACCESSORS
+    int latencySamplingInterval() const;
+        // Return the number of calls to a run function per timed call, or 0
+        // if latency sampling is disabled.
+
+    int maxLatencySamplesPerThread() const;
+        // Return the maximum number of timed calls per thread in each sample.
+
+    int numWarmUpSamples() const;
+        // Return the number of samples executed, and discarded, before the
+        // measured samples.
+
+    const bsl::vector<int>& threadGroupAffinity(int threadGroupIndex) const;
+        // Return a reference providing non-modifiable access to the
+        // processors to which the threads in the specified 'threadGroupIndex'
+        // are pinned (empty if the threads are not pinned).  The behavior is
+        // undefined unless '0 <= threadGroupIndex < numThreadGroups()'.
+
     int numThreads() const;
         // Return the total number of threads.
 
@@ -385,6 +535,25 @@ struct ThroughputBenchmark_WorkData {
     bsls::Types::Int64                            d_count;
                                                     // number of items
                                                     // processed by this thread
+
+    int                                           d_cpu;
+                                                    // processor to which the
+                                                    // thread is pinned, or -1
+
+    int                                           d_latencySamplingInterval;
+                                                    // number of calls per
+                                                    // timed call, or 0
+
+    bsl::vector<bsls::Types::Int64>               d_latencies;
+                                                    // durations, in cycle
+                                                    // counter ticks, of timed
+                                                    // calls; sized to the
+                                                    // maximum number of timed
+                                                    // calls
+
+    int                                           d_numLatencies;
+                                                    // number of elements of
+                                                    // 'd_latencies' in use
 };
 
                   // ======================================
@@ -460,6 +629,34 @@ bool ThroughputBenchmark::isRunState() const
 }
 
 // ACCESSORS
+inline
+int ThroughputBenchmark::latencySamplingInterval() const
+{
+    return d_latencySamplingInterval;
+}
+
+inline
+int ThroughputBenchmark::maxLatencySamplesPerThread() const
+{
+    return d_maxLatencySamplesPerThread;
+}
+
+inline
+int ThroughputBenchmark::numWarmUpSamples() const
+{
+    return d_numWarmUpSamples;
+}
+
+inline
+const bsl::vector<int>& ThroughputBenchmark::threadGroupAffinity(
+                                                    int threadGroupIndex) const
+{
+    BSLS_ASSERT(0                 <= threadGroupIndex);
+    BSLS_ASSERT(numThreadGroups() >  threadGroupIndex);
+
+    return d_threadGroups[threadGroupIndex].d_cpus;
+}
+
 inline
 int ThroughputBenchmark::numThreads() const
 {
@@ -21,6 +21,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
+#include <bsls_platform.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -34,6 +35,10 @@
 
 #include <stddef.h>
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sched.h>
+#endif
+
 using namespace BloombergLP;
 using namespace bsl;
 
@@ -78,13 +83,21 @@ using namespace bsl;
 // [ 2] int addThreadGroup(runF, numThreads, workAmount);
 // [ 2] int addThreadGroup(runF, numThreads, workAmount, initF, cleanupF);
 // [ 4] void execute(result, millis, numSamples);
+// [ 6] int setCurrentThreadAffinity(int cpu);
+// [ 6] void setLatencySampling(int samplingInterval, int maxPerThread);
+// [ 6] void setNumWarmUpSamples(int numWarmUpSamples);
+// [ 6] void setThreadGroupAffinity(int threadGroupIndex, cpus);
 // [ 4] void execute(result, millis, numSamples, initF, shutF, cleanupF);
+// [ 6] int latencySamplingInterval() const;
+// [ 6] int maxLatencySamplesPerThread() const;
+// [ 6] int numWarmUpSamples() const;
+// [ 6] const bsl::vector<int>& threadGroupAffinity(int tgIndex) const;
 // [ 3] int numThreads() const;
 // [ 3] int numThreadGroups() const;
 // [ 3] int numThreadsInGroup(int threadGroupIndex) const;
 // [ 3] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
-// [ 6] USAGE EXAMPLE
+// [ 7] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -463,6 +476,68 @@ void CountBoolParFunctor::operator()(bool parameter)
     }
 }
 
+                             // ===============
+                             // SpinRunFunctor
+                             // ===============
+
+class SpinRunFunctor {
+    // This class provides a run function that busy-waits for a fixed duration
+    // and, on Linux, records whether it was ever called on a processor other
+    // than an expected one.
+
+    // DATA
+    bsls::Types::Int64  d_nanoseconds;   // duration of each call
+    int                 d_expectedCpu;   // expected processor, or -1
+    bsls::AtomicInt    *d_numMisplaced_p;
+                                         // number of calls on an unexpected
+                                         // processor (held, not owned)
+
+  public:
+    // CREATORS
+    SpinRunFunctor(bsls::Types::Int64  nanoseconds,
+                   int                 expectedCpu,
+                   bsls::AtomicInt    *numMisplaced);
+        // Create a 'SpinRunFunctor' object that busy-waits for the specified
+        // 'nanoseconds' on each call, and increments the specified
+        // 'numMisplaced' for each call made on a processor other than the
+        // specified 'expectedCpu' (if not -1, and on Linux only).
+
+    // MANIPULATORS
+    void operator()(int);
+        // Busy-wait for the duration supplied at construction.  The parameter
+        // is ignored.
+};
+
+                             // ---------------
+                             // SpinRunFunctor
+                             // ---------------
+
+// CREATORS
+SpinRunFunctor::SpinRunFunctor(bsls::Types::Int64  nanoseconds,
+                               int                 expectedCpu,
+                               bsls::AtomicInt    *numMisplaced)
+: d_nanoseconds(nanoseconds)
+, d_expectedCpu(expectedCpu)
+, d_numMisplaced_p(numMisplaced)
+{
+}
+
+// MANIPULATORS
+void SpinRunFunctor::operator()(int)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (0 <= d_expectedCpu && d_expectedCpu != sched_getcpu()) {
+        ++(*d_numMisplaced_p);
+    }
+#endif
+
+    const bsls::Types::Int64 start =
+                     bsls::SystemTime::nowMonotonicClock().totalNanoseconds();
+    while (bsls::SystemTime::nowMonotonicClock().totalNanoseconds() - start <
+                                                               d_nanoseconds) {
+    }
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -488,7 +563,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -536,7 +611,325 @@ int main(int argc, char *argv[])
     myResult.getMedian(&median, consumerGroupIdx);
     bsl::cout << "Throughput:" << median << "\n";
 //..
+//
+///Example 2: Warm-Up, Affinity, Latency, and JSON Output
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we extend the previous benchmark to discard warm-up
+// samples, pin the producers and consumers to distinct processors, sample
+// the latency of the push operation, and write the result as JSON.
+//
+// First, we create the benchmark and thread groups as before:
+//..
+    bslmt::ThroughputBenchmark bench;
+    const int pushIdx = bench.addThreadGroup(
+                        myPush,
+                        2,
+                        100,
+                        bslmt::ThroughputBenchmark::InitializeThreadFunction(),
+                        myCleanup);
+    const int popIdx  = bench.addThreadGroup(myPop, 2, 100);
+//..
+// Then, we pin the producers to processors 0 and 1, and the consumers to
+// processors 2 and 3:
+//..
+    bsl::vector<int> cpus(2);
+    cpus[0] = 0;
+    cpus[1] = 1;
+    bench.setThreadGroupAffinity(pushIdx, cpus);
+    cpus[0] = 2;
+    cpus[1] = 3;
+    bench.setThreadGroupAffinity(popIdx, cpus);
+//..
+// Next, we discard two warm-up samples, and time every 16th call of each run
+// function:
+//..
+    bench.setNumWarmUpSamples(2);
+    bench.setLatencySampling(16, 10000);
+//..
+// Now, we execute the benchmark for 5 samples of 100 milliseconds:
+//..
+    bslmt::ThroughputBenchmarkResult result;
+    bench.execute(&result, 100, 5);
+    ASSERT(5 == result.numSamples());
+    ASSERT(0 <  result.numLatencies(pushIdx));
+//..
+// Finally, we remove outlying samples and write the result as JSON:
+//..
+    result.removeOutliers();
+    result.printJson(bsl::cout, "queue") << "\n";
+//..
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TEST WARM-UP, AFFINITY, AND LATENCY SAMPLING
+        //
+        // Concerns:
+        //: 1 The configuration has the expected default values, and the
+        //:   manipulators set the values reported by the accessors.
+        //:
+        //: 2 'numWarmUpSamples' additional samples are executed (including the
+        //:   sample functions and thread functions) and are not stored in the
+        //:   result.
+        //:
+        //: 3 Threads of a thread group having an affinity run on the
+        //:   specified processor (where supported).
+        //:
+        //: 4 If latency sampling is enabled, every 'samplingInterval'th call
+        //:   is timed, up to 'maxSamplesPerThread' per thread in each measured
+        //:   sample, and the latencies reflect the duration of the calls.
+        //:
+        //: 5 The throughput of each thread is stored for the thread that
+        //:   measured it, for every thread group.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the default configuration, set each attribute, and verify
+        //:   the accessors.  (C-1)
+        //:
+        //: 2 Execute a benchmark with warm-up samples and counting functors,
+        //:   and verify the counts and the dimensions of the result.  (C-2)
+        //:
+        //: 3 Pin a thread group to processor 0, and verify on Linux that all
+        //:   calls run there.  (C-3)
+        //:
+        //: 4 Execute benchmarks with latency sampling, using a run function of
+        //:   known duration, and verify the number and values of the
+        //:   latencies.  (C-4)
+        //:
+        //: 5 Execute a benchmark having a slow and a fast thread group, and
+        //:   verify that the fast group has the higher throughput for each
+        //:   thread.  (C-5)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int setCurrentThreadAffinity(int cpu);
+        //   void setLatencySampling(int samplingInterval, int maxPerThread);
+        //   void setNumWarmUpSamples(int numWarmUpSamples);
+        //   void setThreadGroupAffinity(int threadGroupIndex, cpus);
+        //   int latencySamplingInterval() const;
+        //   int maxLatencySamplesPerThread() const;
+        //   int numWarmUpSamples() const;
+        //   const bsl::vector<int>& threadGroupAffinity(int tgIndex) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TEST WARM-UP, AFFINITY, AND LATENCY SAMPLING"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        typedef bslmt::ThroughputBenchmark Obj;
 
+        bslma::TestAllocator supplied("supplied", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting configuration." << endl;
+        {
+            Obj mX(&supplied); const Obj& X = mX;
+            SetValueFunctor setValueFunctor(1);
+
+            mX.addThreadGroup(setValueFunctor, 1, 0);
+            mX.addThreadGroup(setValueFunctor, 2, 0);
+
+            ASSERT(0 == X.numWarmUpSamples());
+            ASSERT(0 == X.latencySamplingInterval());
+            ASSERT(1 == X.maxLatencySamplesPerThread());
+            ASSERT(X.threadGroupAffinity(0).empty());
+            ASSERT(X.threadGroupAffinity(1).empty());
+
+            mX.setNumWarmUpSamples(3);
+            ASSERT(3 == X.numWarmUpSamples());
+
+            mX.setLatencySampling(7, 100);
+            ASSERT(7   == X.latencySamplingInterval());
+            ASSERT(100 == X.maxLatencySamplesPerThread());
+
+            mX.setLatencySampling(0, 5);
+            ASSERT(0   == X.latencySamplingInterval());
+            ASSERT(5   == X.maxLatencySamplesPerThread());
+
+            bsl::vector<int> cpus(&supplied);
+            cpus.push_back(3);
+            cpus.push_back(1);
+            mX.setThreadGroupAffinity(1, cpus);
+            ASSERT(X.threadGroupAffinity(0).empty());
+            ASSERT(cpus == X.threadGroupAffinity(1));
+
+            mX.setThreadGroupAffinity(1, bsl::vector<int>(&supplied));
+            ASSERT(X.threadGroupAffinity(1).empty());
+        }
+
+        if (verbose) cout << "\nTesting warm-up samples." << endl;
+        {
+            bsls::AtomicInt          cntThreads;
+            ThreadCountIntParFunctor cntFunctor(&cntThreads);
+
+            bsls::AtomicInt     cntTrueInit, cntFalseInit;
+            bsls::AtomicInt     cntTrueClean, cntFalseClean;
+            CountBoolParFunctor initFunctor(&cntTrueInit, &cntFalseInit);
+            CountBoolParFunctor cleanFunctor(&cntTrueClean, &cntFalseClean);
+            bsls::AtomicInt     cntThreadInit;
+            CountNoParFunctor   initThreadFunctor(&cntThreadInit);
+
+            Obj mX(&supplied);
+            mX.addThreadGroup(cntFunctor,
+                              3,
+                              10,
+                              initThreadFunctor,
+                              Obj::CleanupThreadFunction());
+            mX.setNumWarmUpSamples(2);
+
+            bslmt::ThroughputBenchmarkResult result(&supplied);
+            mX.execute(&result,
+                       10,
+                       4,
+                       initFunctor,
+                       Obj::ShutdownSampleFunction(),
+                       cleanFunctor);
+
+            ASSERT(4     == result.numSamples());
+            ASSERT(1     == result.numThreadGroups());
+            ASSERT(0     == result.numLatencies(0));
+            ASSERTV(cntThreads.load(),    3 * 6 == cntThreads);
+            ASSERTV(cntThreadInit.load(), 3 * 6 == cntThreadInit);
+            ASSERT(1     == cntTrueInit);
+            ASSERT(5     == cntFalseInit);
+            ASSERT(1     == cntTrueClean);
+            ASSERT(5     == cntFalseClean);
+
+            for (int sId = 0; sId < 4; ++sId) {
+                for (int tId = 0; tId < 3; ++tId) {
+                    ASSERTV(sId, tId, 0 < result.getValue(0, tId, sId));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting affinity." << endl;
+        {
+            ASSERT(0 != Obj::setCurrentThreadAffinity(1 << 24));
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            bsls::AtomicInt numMisplaced(0);
+            SpinRunFunctor  runFunctor(1000, 0, &numMisplaced);
+
+            Obj mX(&supplied);
+            mX.addThreadGroup(runFunctor, 2, 0);
+
+            bsl::vector<int> cpus(1, 0, &supplied);
+            mX.setThreadGroupAffinity(0, cpus);
+
+            bslmt::ThroughputBenchmarkResult result(&supplied);
+            mX.execute(&result, 20, 2);
+
+            ASSERTV(numMisplaced.load(), 0 == numMisplaced);
+#endif
+        }
+
+        if (verbose) cout << "\nTesting latency sampling." << endl;
+        {
+            const bsls::Types::Int64 k_SPIN = 20 * 1000;  // nanoseconds
+
+            bsls::AtomicInt numMisplaced(0);
+            SpinRunFunctor  runFunctor(k_SPIN, -1, &numMisplaced);
+
+            Obj mX(&supplied);
+            mX.addThreadGroup(runFunctor, 2, 0);
+            mX.setNumWarmUpSamples(1);
+            mX.setLatencySampling(1, 50);
+
+            bslmt::ThroughputBenchmarkResult result(&supplied);
+            mX.execute(&result, 50, 3);
+
+            ASSERTV(result.numLatencies(0), 2 * 3 * 50 ==
+                                                      result.numLatencies(0));
+
+            double minimum, median;
+            result.getLatencyPercentile(&minimum, 0.0, 0);
+            result.getLatencyPercentile(&median,  0.5, 0);
+            if (veryVerbose) { P_(minimum) P(median) }
+            ASSERTV(minimum, k_SPIN * 0.95 <= minimum);
+            ASSERTV(median,  k_SPIN * 100  >= median);
+
+            // Sparse sampling with ample storage times a fraction of calls.
+
+            mX.setNumWarmUpSamples(0);
+            mX.setLatencySampling(10, 1000000);
+            mX.execute(&result, 50, 2);
+
+            double totalCalls = 0;
+            for (int sId = 0; sId < 2; ++sId) {
+                for (int tId = 0; tId < 2; ++tId) {
+                    totalCalls += result.getValue(0, tId, sId) * 0.05;
+                }
+            }
+            const double numLatencies = result.numLatencies(0);
+            if (veryVerbose) { P_(totalCalls) P(numLatencies) }
+            ASSERTV(numLatencies, totalCalls,
+                    totalCalls / 10 * 0.8 <= numLatencies);
+            ASSERTV(numLatencies, totalCalls,
+                    totalCalls / 10 * 1.2 + 4 >= numLatencies);
+
+            mX.setLatencySampling(0, 1);
+            mX.execute(&result, 10, 1);
+            ASSERT(0 == result.numLatencies(0));
+        }
+
+        if (verbose) cout << "\nTesting per-thread results." << endl;
+        {
+            bsls::AtomicInt numMisplaced(0);
+            SpinRunFunctor  slowFunctor(1000 * 1000, -1, &numMisplaced);
+            SpinRunFunctor  fastFunctor(1000,        -1, &numMisplaced);
+
+            Obj mX(&supplied);
+            mX.addThreadGroup(slowFunctor, 2, 0);
+            mX.addThreadGroup(fastFunctor, 2, 0);
+
+            bslmt::ThroughputBenchmarkResult result(&supplied);
+            mX.execute(&result, 50, 2);
+
+            for (int sId = 0; sId < 2; ++sId) {
+                for (int tId = 0; tId < 2; ++tId) {
+                    const double SLOW = result.getValue(0, tId, sId);
+                    const double FAST = result.getValue(1, tId, sId);
+                    if (veryVerbose) { P_(SLOW) P(FAST) }
+                    ASSERTV(sId, tId, SLOW, FAST, SLOW * 5 < FAST);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            SetValueFunctor setValueFunctor(1);
+
+            Obj mX(&supplied); const Obj& X = mX;
+            mX.addThreadGroup(setValueFunctor, 1, 0);
+
+            bsl::vector<int> cpus(1, 0, &supplied);
+
+            ASSERT_FAIL(mX.setNumWarmUpSamples(-1));
+            ASSERT_PASS(mX.setNumWarmUpSamples( 0));
+
+            ASSERT_FAIL(mX.setLatencySampling(-1, 1));
+            ASSERT_FAIL(mX.setLatencySampling( 1, 0));
+            ASSERT_PASS(mX.setLatencySampling( 0, 1));
+
+            ASSERT_FAIL(mX.setThreadGroupAffinity(-1, cpus));
+            ASSERT_FAIL(mX.setThreadGroupAffinity( 1, cpus));
+            ASSERT_PASS(mX.setThreadGroupAffinity( 0, cpus));
+            cpus[0] = -1;
+            ASSERT_FAIL(mX.setThreadGroupAffinity( 0, cpus));
+
+            ASSERT_FAIL(X.threadGroupAffinity(-1));
+            ASSERT_FAIL(X.threadGroupAffinity( 1));
+            ASSERT_PASS(X.threadGroupAffinity( 0));
+
+            ASSERT_FAIL(Obj::setCurrentThreadAffinity(-1));
+        }
       } break;
       case 5: {
         // --------------------------------------------------------------------
@@ -1422,7 +1815,7 @@ int main(int argc, char *argv[])
 
     // CONCERN: In no case does memory come from the global allocator.
 
-    if (test != 4 && test != 6) {
+    if (test != 4 && test != 6 && test != 7) {
         LOOP_ASSERT(globalAllocator.numBlocksTotal(),
                     0 == globalAllocator.numBlocksTotal());
     }
@@ -6,17 +6,120 @@
 BSLS_IDENT_RCSID(bslmt_bslmt_throughputbenchmarkresult_cpp,"$Id$ $CSID$")
 
 #include <bslma_allocator.h>
+#include <bslma_default.h>
 
 #include <bslmf_assert.h>
 
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
-#include <bsl_vector.h>
+#include <bsl_cmath.h>
 #include <bsl_cstddef.h>
+#include <bsl_cstdio.h>
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bslmt {
+namespace {
+
+const double k_STUDENT_T_95[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+     2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+     2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+};
+    // two-sided 95% critical values of Student's t-distribution, indexed by
+    // the number of degrees of freedom minus one
+
+double studentT95(int degreesOfFreedom)
+    // Return the two-sided 95% critical value of Student's t-distribution
+    // having the specified 'degreesOfFreedom'.  The behavior is undefined
+    // unless '0 < degreesOfFreedom'.
+{
+    const int k_TABLE_SIZE = static_cast<int>(sizeof  k_STUDENT_T_95
+                                            / sizeof *k_STUDENT_T_95);
+
+    if (degreesOfFreedom <= k_TABLE_SIZE) {
+        return k_STUDENT_T_95[degreesOfFreedom - 1];                  // RETURN
+    }
+
+    // Beyond the table, use the first-order Cornish-Fisher expansion around
+    // the normal critical value, which is accurate to 0.003 at 31 degrees of
+    // freedom.
+
+    const double z = 1.959964;
+    return z + (z * z * z + z) / (4.0 * degreesOfFreedom);
+}
+
+double percentileOfSorted(const bsl::vector<double>& sorted,
+                          double                     percentage)
+    // Return the specified 'percentage' percentile of the specified 'sorted'
+    // values, using the same (nearest-rank) convention as
+    // 'ThroughputBenchmarkResult::getPercentile'.  The behavior is undefined
+    // unless '0 < sorted.size()' and '0.0 <= percentage <= 1.0'.
+{
+    const int size    = static_cast<int>(sorted.size());
+    int       statIdx = static_cast<int>(size * percentage);
+    if (statIdx == size) --statIdx;
+    return sorted[statIdx];
+}
+
+void printNumber(bsl::ostream& stream, double value)
+    // Write the specified 'value' to the specified 'stream' with 10
+    // significant digits, in a format valid in both JSON and CSV.
+{
+    char buffer[32];
+    bsl::snprintf(buffer, sizeof buffer, "%.10g", value);
+    stream << buffer;
+}
+
+void printJsonString(bsl::ostream& stream, const char *value)
+    // Write the specified 'value' to the specified 'stream' as a quoted and
+    // escaped JSON string.
+{
+    stream << '"';
+    for (; *value; ++value) {
+        const unsigned char c = static_cast<unsigned char>(*value);
+        if ('"' == c || '\\' == c) {
+            stream << '\\' << *value;
+        }
+        else if (c < 0x20) {
+            char buffer[8];
+            bsl::snprintf(buffer, sizeof buffer, "\\u%04x", c);
+            stream << buffer;
+        }
+        else {
+            stream << *value;
+        }
+    }
+    stream << '"';
+}
+
+void printCsvString(bsl::ostream& stream, const char *value)
+    // Write the specified 'value' to the specified 'stream' as a quoted CSV
+    // field.
+{
+    stream << '"';
+    for (; *value; ++value) {
+        if ('"' == *value) {
+            stream << '"';
+        }
+        stream << *value;
+    }
+    stream << '"';
+}
+
+const double k_LATENCY_PERCENTAGES[] = { 0.5, 0.9, 0.99, 0.999, 1.0 };
+    // latency percentiles written by 'printCsv' and 'printJson'
+
+const char *const k_LATENCY_NAMES[] = { "p50", "p90", "p99", "p999", "max" };
+    // names of the latency percentiles in 'k_LATENCY_PERCENTAGES'
+
+const int k_NUM_LATENCY_PERCENTAGES =
+                            static_cast<int>(sizeof  k_LATENCY_PERCENTAGES
+                                           / sizeof *k_LATENCY_PERCENTAGES);
+
+}  // close unnamed namespace
 
                      // -------------------------------
                      // class ThroughputBenchmarkResult
@@ -53,6 +156,7 @@ ThroughputBenchmarkResult::ThroughputBenchmarkResult(
                                      const bsl::vector<int>&  threadGroupSizes,
                                      bslma::Allocator        *basicAllocator)
 : d_vecThroughputs(basicAllocator)
+, d_latencies(basicAllocator)
 {
     BSLS_ASSERT(0 < numSamples);
     BSLS_ASSERT(0 < threadGroupSizes.size());
@@ -63,6 +167,7 @@ ThroughputBenchmarkResult::ThroughputBenchmarkResult(
 ThroughputBenchmarkResult::ThroughputBenchmarkResult(
                                               bslma::Allocator *basicAllocator)
 : d_vecThroughputs(basicAllocator)
+, d_latencies(basicAllocator)
 {
 }
 
@@ -70,6 +175,7 @@ ThroughputBenchmarkResult::ThroughputBenchmarkResult(
                               const ThroughputBenchmarkResult&  original,
                               bslma::Allocator                 *basicAllocator)
 : d_vecThroughputs(original.d_vecThroughputs, basicAllocator)
+, d_latencies(original.d_latencies, basicAllocator)
 {
 }
 
@@ -78,6 +184,8 @@ ThroughputBenchmarkResult::ThroughputBenchmarkResult(
                                                           BSLS_KEYWORD_NOEXCEPT
 : d_vecThroughputs(bslmf::MovableRefUtil::move(
                      bslmf::MovableRefUtil::access(original).d_vecThroughputs))
+, d_latencies(bslmf::MovableRefUtil::move(
+                          bslmf::MovableRefUtil::access(original).d_latencies))
 {
 }
 
@@ -86,6 +194,8 @@ ThroughputBenchmarkResult::ThroughputBenchmarkResult(
                   bslma::Allocator                             *basicAllocator)
 : d_vecThroughputs(bslmf::MovableRefUtil::move(
      bslmf::MovableRefUtil::access(original).d_vecThroughputs), basicAllocator)
+, d_latencies(bslmf::MovableRefUtil::move(
+          bslmf::MovableRefUtil::access(original).d_latencies), basicAllocator)
 {
 }
 
@@ -94,6 +204,7 @@ ThroughputBenchmarkResult& ThroughputBenchmarkResult::operator=(
                                           const ThroughputBenchmarkResult& rhs)
 {
     d_vecThroughputs = rhs.d_vecThroughputs;
+    d_latencies      = rhs.d_latencies;
     return *this;
 }
 
@@ -102,6 +213,8 @@ ThroughputBenchmarkResult& ThroughputBenchmarkResult::operator=(
 {
     d_vecThroughputs = bslmf::MovableRefUtil::move(
         bslmf::MovableRefUtil::access(rhs).d_vecThroughputs);
+    d_latencies      = bslmf::MovableRefUtil::move(
+        bslmf::MovableRefUtil::access(rhs).d_latencies);
 
     return *this;
 }
@@ -125,6 +238,65 @@ void ThroughputBenchmarkResult::initialize(
             d_vecThroughputs[i][j].resize(threadGroupSizes[j], 0.0);
         }
     }
+
+    d_latencies.clear();  // Sized on the first call to 'addLatency'.
+}
+
+int ThroughputBenchmarkResult::removeOutliers(double iqrMultiplier)
+{
+    BSLS_ASSERT(0.0 <= iqrMultiplier);
+
+    const int nSamples = numSamples();
+    if (nSamples < 4) {
+        return 0;                                                     // RETURN
+    }
+
+    // Mark each sample in which any thread group is outside its fences.
+
+    bsl::vector<char> isOutlier(nSamples,
+                                0,
+                                bslma::Default::defaultAllocator());
+    DoubleVector      sortedThroughputs(nSamples,
+                                        0.0,
+                                        bslma::Default::defaultAllocator());
+    for (int tgIdx = 0; tgIdx < numThreadGroups(); ++tgIdx) {
+        getSortedSumThroughputs(&sortedThroughputs, tgIdx);
+
+        const double q1    = percentileOfSorted(sortedThroughputs, 0.25);
+        const double q3    = percentileOfSorted(sortedThroughputs, 0.75);
+        const double lower = q1 - iqrMultiplier * (q3 - q1);
+        const double upper = q3 + iqrMultiplier * (q3 - q1);
+
+        const int numThreadsInTG = numThreads(tgIdx);
+        for (int sampleIndex = 0; sampleIndex < nSamples; ++sampleIndex) {
+            double sum = 0.0;
+            for (int tIdx = 0; tIdx < numThreadsInTG; ++tIdx) {
+                sum += d_vecThroughputs[sampleIndex][tgIdx][tIdx];
+            }
+            if (sum < lower || upper < sum) {
+                isOutlier[sampleIndex] = 1;
+            }
+        }
+    }
+
+    if (nSamples == bsl::count(isOutlier.begin(), isOutlier.end(), 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    // Compact the remaining samples.
+
+    int numKept = 0;
+    for (int sampleIndex = 0; sampleIndex < nSamples; ++sampleIndex) {
+        if (!isOutlier[sampleIndex]) {
+            if (numKept != sampleIndex) {
+                d_vecThroughputs[numKept].swap(d_vecThroughputs[sampleIndex]);
+            }
+            ++numKept;
+        }
+    }
+    d_vecThroughputs.resize(numKept);
+
+    return nSamples - numKept;
 }
 
 // ACCESSORS
@@ -227,6 +399,243 @@ void ThroughputBenchmarkResult::getThreadPercentiles(
     }
 }
 
+void ThroughputBenchmarkResult::getMean(double *mean,
+                                        int     threadGroupIndex) const
+{
+    BSLS_ASSERT(0                 <= threadGroupIndex);
+    BSLS_ASSERT(numThreadGroups() >  threadGroupIndex);
+    BSLS_ASSERT(mean);
+
+    int          nSamples = numSamples();
+    DoubleVector sortedThroughputs(nSamples,
+                                   0.0,
+                                   bslma::Default::defaultAllocator());
+    getSortedSumThroughputs(&sortedThroughputs, threadGroupIndex);
+
+    double sum = 0.0;
+    for (int i = 0; i < nSamples; ++i) {
+        sum += sortedThroughputs[i];
+    }
+    *mean = sum / nSamples;
+}
+
+void ThroughputBenchmarkResult::getStandardDeviation(
+                                        double *standardDeviation,
+                                        int     threadGroupIndex) const
+{
+    BSLS_ASSERT(0                 <= threadGroupIndex);
+    BSLS_ASSERT(numThreadGroups() >  threadGroupIndex);
+    BSLS_ASSERT(standardDeviation);
+
+    int nSamples = numSamples();
+    if (nSamples < 2) {
+        *standardDeviation = 0.0;
+        return;                                                       // RETURN
+    }
+
+    DoubleVector sortedThroughputs(nSamples,
+                                   0.0,
+                                   bslma::Default::defaultAllocator());
+    getSortedSumThroughputs(&sortedThroughputs, threadGroupIndex);
+
+    double mean;
+    getMean(&mean, threadGroupIndex);
+
+    double sumOfSquares = 0.0;
+    for (int i = 0; i < nSamples; ++i) {
+        const double deviation = sortedThroughputs[i] - mean;
+        sumOfSquares += deviation * deviation;
+    }
+    *standardDeviation = bsl::sqrt(sumOfSquares / (nSamples - 1));
+}
+
+void ThroughputBenchmarkResult::getConfidenceInterval(
+                                         double *lower,
+                                         double *upper,
+                                         int     threadGroupIndex) const
+{
+    BSLS_ASSERT(0                 <= threadGroupIndex);
+    BSLS_ASSERT(numThreadGroups() >  threadGroupIndex);
+    BSLS_ASSERT(lower);
+    BSLS_ASSERT(upper);
+
+    double mean;
+    getMean(&mean, threadGroupIndex);
+
+    int nSamples = numSamples();
+    if (nSamples < 2) {
+        *lower = mean;
+        *upper = mean;
+        return;                                                       // RETURN
+    }
+
+    double standardDeviation;
+    getStandardDeviation(&standardDeviation, threadGroupIndex);
+
+    const double halfWidth = studentT95(nSamples - 1) * standardDeviation
+                                                           / bsl::sqrt(
+                                               static_cast<double>(nSamples));
+    *lower = mean - halfWidth;
+    *upper = mean + halfWidth;
+}
+
+void ThroughputBenchmarkResult::getLatencyPercentile(
+                                          double *percentile,
+                                          double  percentage,
+                                          int     threadGroupIndex) const
+{
+    BSLS_ASSERT(0                 <= threadGroupIndex);
+    BSLS_ASSERT(numThreadGroups() >  threadGroupIndex);
+    BSLS_ASSERT(0.0               <= percentage);
+    BSLS_ASSERT(1.0               >= percentage);
+    BSLS_ASSERT(0                 <  numLatencies(threadGroupIndex));
+    BSLS_ASSERT(percentile);
+
+    DoubleVector sorted(d_latencies[threadGroupIndex],
+                        bslma::Default::defaultAllocator());
+    bsl::sort(sorted.begin(), sorted.end());
+    *percentile = percentileOfSorted(sorted, percentage);
+}
+
+                                  // Output
+
+bsl::ostream& ThroughputBenchmarkResult::printCsvHeader(bsl::ostream& stream)
+{
+    stream << "label,threadGroup,numThreads,numSamples,median,mean,"
+              "standardDeviation,ci95Lower,ci95Upper,min,max,numLatencies";
+    for (int i = 0; i < k_NUM_LATENCY_PERCENTAGES; ++i) {
+        stream << ",latency_" << k_LATENCY_NAMES[i];
+    }
+    return stream << '\n';
+}
+
+bsl::ostream& ThroughputBenchmarkResult::printCsv(bsl::ostream&  stream,
+                                                  const char    *label) const
+{
+    BSLS_ASSERT(label);
+    BSLS_ASSERT(0 < numSamples());
+
+    for (int tgIdx = 0; tgIdx < numThreadGroups(); ++tgIdx) {
+        double median, mean, stddev, lower, upper, min, max;
+        getMedian(&median, tgIdx);
+        getMean(&mean, tgIdx);
+        getStandardDeviation(&stddev, tgIdx);
+        getConfidenceInterval(&lower, &upper, tgIdx);
+        getPercentile(&min, 0.0, tgIdx);
+        getPercentile(&max, 1.0, tgIdx);
+
+        printCsvString(stream, label);
+        stream << ',' << tgIdx
+               << ',' << numThreads(tgIdx)
+               << ',' << numSamples();
+
+        const double values[] = { median, mean, stddev, lower, upper, min,
+                                  max };
+        for (bsl::size_t i = 0; i < sizeof values / sizeof *values; ++i) {
+            stream << ',';
+            printNumber(stream, values[i]);
+        }
+
+        const int numLat = numLatencies(tgIdx);
+        stream << ',' << numLat;
+
+        DoubleVector sorted(bslma::Default::defaultAllocator());
+        if (numLat) {
+            sorted = d_latencies[tgIdx];
+            bsl::sort(sorted.begin(), sorted.end());
+        }
+        for (int i = 0; i < k_NUM_LATENCY_PERCENTAGES; ++i) {
+            stream << ',';
+            if (numLat) {
+                printNumber(stream,
+                            percentileOfSorted(sorted,
+                                               k_LATENCY_PERCENTAGES[i]));
+            }
+        }
+        stream << '\n';
+    }
+    return stream;
+}
+
+bsl::ostream& ThroughputBenchmarkResult::printJson(bsl::ostream&  stream,
+                                                   const char    *label) const
+{
+    BSLS_ASSERT(label);
+    BSLS_ASSERT(0 < numSamples());
+
+    const int nSamples = numSamples();
+
+    stream << "{\"label\":";
+    printJsonString(stream, label);
+    stream << ",\"numSamples\":" << nSamples
+           << ",\"threadGroups\":[";
+
+    for (int tgIdx = 0; tgIdx < numThreadGroups(); ++tgIdx) {
+        double median, mean, stddev, lower, upper, min, max;
+        getMedian(&median, tgIdx);
+        getMean(&mean, tgIdx);
+        getStandardDeviation(&stddev, tgIdx);
+        getConfidenceInterval(&lower, &upper, tgIdx);
+        getPercentile(&min, 0.0, tgIdx);
+        getPercentile(&max, 1.0, tgIdx);
+
+        const int numThreadsInTG = numThreads(tgIdx);
+
+        stream << (tgIdx ? "," : "")
+               << "{\"index\":" << tgIdx
+               << ",\"numThreads\":" << numThreadsInTG;
+
+        static const char *const k_NAMES[] = {
+            "median", "mean", "standardDeviation", "ci95Lower", "ci95Upper",
+            "min", "max"
+        };
+        const double values[] = { median, mean, stddev, lower, upper, min,
+                                  max };
+        for (bsl::size_t i = 0; i < sizeof values / sizeof *values; ++i) {
+            stream << ",\"" << k_NAMES[i] << "\":";
+            printNumber(stream, values[i]);
+        }
+
+        const int numLat = numLatencies(tgIdx);
+        if (numLat) {
+            DoubleVector sorted(d_latencies[tgIdx],
+                                bslma::Default::defaultAllocator());
+            bsl::sort(sorted.begin(), sorted.end());
+
+            stream << ",\"latency\":{\"count\":" << numLat;
+            for (int i = 0; i < k_NUM_LATENCY_PERCENTAGES; ++i) {
+                stream << ",\"" << k_LATENCY_NAMES[i] << "\":";
+                printNumber(stream,
+                            percentileOfSorted(sorted,
+                                               k_LATENCY_PERCENTAGES[i]));
+            }
+            stream << '}';
+        }
+
+        stream << ",\"samples\":[";
+        for (int sampleIndex = 0; sampleIndex < nSamples; ++sampleIndex) {
+            double sum = 0.0;
+            for (int tIdx = 0; tIdx < numThreadsInTG; ++tIdx) {
+                sum += getValue(tgIdx, tIdx, sampleIndex);
+            }
+            stream << (sampleIndex ? "," : "");
+            printNumber(stream, sum);
+        }
+
+        stream << "],\"threads\":[";
+        for (int tIdx = 0; tIdx < numThreadsInTG; ++tIdx) {
+            stream << (tIdx ? ",[" : "[");
+            for (int sampleIndex = 0; sampleIndex < nSamples; ++sampleIndex) {
+                stream << (sampleIndex ? "," : "");
+                printNumber(stream, getValue(tgIdx, tIdx, sampleIndex));
+            }
+            stream << ']';
+        }
+        stream << "]}";
+    }
+    return stream << "]}";
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -21,6 +21,38 @@ BSLS_IDENT("$Id: $")
 // using 'getMedian', 'getPercentile', 'getPercentiles', and
 // 'getThreadPercentiles'.
 //
+///Summary Statistics
+///------------------
+// The throughput of a thread group in a sample is the sum of the throughputs
+// of its threads in that sample.  In addition to percentiles, the mean
+// ('getMean'), sample standard deviation ('getStandardDeviation'), and a 95%
+// confidence interval for the mean ('getConfidenceInterval', using Student's
+// t-distribution) of the throughputs of a thread group over the samples are
+// provided.  Samples disturbed by external activity (for example, a sample
+// during which the machine was briefly busy with an unrelated task) can be
+// discarded by 'removeOutliers', which removes every sample in which the
+// throughput of any thread group lies outside Tukey's fences
+// '[Q1 - k * IQR, Q3 + k * IQR]', where 'Q1' and 'Q3' are the first and third
+// quartiles of the throughputs of that thread group, 'IQR' is 'Q3 - Q1', and
+// 'k' is a multiplier (1.5 by default).
+//
+///Latency
+///-------
+// A result may also hold the latencies, in nanoseconds, of individual calls to
+// the run functions of each thread group (see 'addLatency'), which are
+// collected by 'bslmt::ThroughputBenchmark' if latency sampling is enabled.
+// Percentiles of the latencies of a thread group are provided by
+// 'getLatencyPercentile'.  Latencies are not associated with samples, and are
+// unaffected by 'removeOutliers'.
+//
+///Machine-Readable Output
+///-----------------------
+// 'printJson' writes the summary statistics, latency percentiles, and raw
+// throughputs of a result as a JSON object, and 'printCsv' writes the summary
+// statistics as CSV records (one per thread group) having the columns written
+// by 'printCsvHeader', so that results can be compared across runs and
+// releases by external tools.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -69,6 +101,42 @@ BSLS_IDENT("$Id: $")
 //                << percentiles[i] << "\n";
 //  }
 //..
+//
+///Example 2: Summarize and Export a Result
+/// - - - - - - - - - - - - - - - - - - - -
+// In this example we discard outlying samples from a result, calculate a
+// confidence interval for the mean throughput, and write the result as CSV.
+//
+// First, we populate a result having one thread group of one thread, where
+// the fourth sample was disturbed:
+//..
+//  bsl::vector<int> sizes(1, 1);
+//  bslmt::ThroughputBenchmarkResult result(8, sizes);
+//
+//  const double THROUGHPUTS[] = { 100, 101, 99, 10, 100, 102, 98, 100 };
+//  for (int sId = 0; sId < 8; ++sId) {
+//      result.setThroughput(0, 0, sId, THROUGHPUTS[sId]);
+//  }
+//..
+// Then, we remove the outlying sample:
+//..
+//  int numRemoved = result.removeOutliers();
+//  assert(1 == numRemoved);
+//  assert(7 == result.numSamples());
+//..
+// Next, we calculate the mean and its 95% confidence interval:
+//..
+//  double mean, lower, upper;
+//  result.getMean(&mean, 0);
+//  result.getConfidenceInterval(&lower, &upper, 0);
+//  assert(100.0 == mean);
+//  assert(lower < mean && mean < upper);
+//..
+// Finally, we write the summary as CSV:
+//..
+//  bslmt::ThroughputBenchmarkResult::printCsvHeader(bsl::cout);
+//  result.printCsv(bsl::cout, "example");
+//..
 
 #include <bslscm_version.h>
 
@@ -81,6 +149,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_keyword.h>
 #include <bsls_types.h>
 
+#include <bsl_iosfwd.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -114,6 +183,11 @@ class ThroughputBenchmarkResult {
         // thread index T1 within G1, we refer to
         // 'd_vecThroughputs[S1][G1][T1]'.
 
+    bsl::vector<DoubleVector>               d_latencies;
+        // Latencies, in nanoseconds, of calls to the run function of each
+        // thread group, indexed by thread group, or empty if no latencies
+        // have been added.
+
     // PRIVATE ACCESSORS
     void getSortedSumThroughputs(bsl::vector<double> *throughputs,
                                  int                  threadGroupIndex) const;
@@ -206,6 +280,23 @@ class ThroughputBenchmarkResult {
         // '0 < threadGroupSizes.size()', and '0 < threadGroupSizes[N]' for all
         // valid N.
 
+    void addLatency(int threadGroupIndex, double nanoseconds);
+        // Add the specified 'nanoseconds' as the latency of a call to the run
+        // function of the specified 'threadGroupIndex'.  The behavior is
+        // undefined unless '0 <= threadGroupIndex < numThreadGroups()' and
+        // '0 <= nanoseconds'.
+
+    int removeOutliers(double iqrMultiplier = 1.5);
+        // Remove every sample in which the throughput of any thread group is
+        // less than 'Q1 - iqrMultiplier * (Q3 - Q1)' or greater than
+        // 'Q3 + iqrMultiplier * (Q3 - Q1)', where 'Q1' and 'Q3' are the first
+        // and third quartiles of the throughputs of that thread group (see
+        // 'getPercentile'), and return the number of samples removed.
+        // Optionally specify 'iqrMultiplier'; if 'iqrMultiplier' is not
+        // specified, 1.5 is used.  If 'numSamples() < 4', or if every sample
+        // would be removed, no samples are removed.  The behavior is
+        // undefined unless '0 <= iqrMultiplier'.
+
     void setThroughput(int    threadGroupIndex,
                        int    threadIndex,
                        int    sampleIndex,
@@ -235,6 +326,11 @@ class ThroughputBenchmarkResult {
     int totalNumThreads() const;
         // Return the total number of threads.
 
+    int numLatencies(int threadGroupIndex) const;
+        // Return the number of latencies added for the specified
+        // 'threadGroupIndex'.  The behavior is undefined unless
+        // '0 <= threadGroupIndex < numThreadGroups()'.
+
                                   // Results
 
     double getValue(int threadGroupIndex,
@@ -289,6 +385,63 @@ class ThroughputBenchmarkResult {
         // 'percentiles[N].size() == numThreads(threadGroupIndex)' for all
         // N.
 
+    void getMean(double *mean, int threadGroupIndex) const;
+        // Load into the specified 'mean' the mean over the samples of the
+        // throughput (count / second) of the work done by all the threads in
+        // the specified 'threadGroupIndex'.  The behavior is undefined unless
+        // '0 <= threadGroupIndex < numThreadGroups'.
+
+    void getStandardDeviation(double *standardDeviation,
+                              int     threadGroupIndex) const;
+        // Load into the specified 'standardDeviation' the sample standard
+        // deviation over the samples of the throughput (count / second) of the
+        // work done by all the threads in the specified 'threadGroupIndex', or
+        // 0 if 'numSamples() < 2'.  The behavior is undefined unless
+        // '0 <= threadGroupIndex < numThreadGroups'.
+
+    void getConfidenceInterval(double *lower,
+                               double *upper,
+                               int     threadGroupIndex) const;
+        // Load into the specified 'lower' and 'upper' the bounds of the 95%
+        // confidence interval, based on Student's t-distribution, for the
+        // mean throughput (count / second) of the work done by all the
+        // threads in the specified 'threadGroupIndex'.  If
+        // 'numSamples() < 2', load the mean into both 'lower' and 'upper'.
+        // The behavior is undefined unless
+        // '0 <= threadGroupIndex < numThreadGroups'.
+
+    void getLatencyPercentile(double *percentile,
+                              double  percentage,
+                              int     threadGroupIndex) const;
+        // Load into the specified 'percentile' the specified 'percentage'
+        // latency, in nanoseconds, of the calls to the run function of the
+        // specified 'threadGroupIndex'.  A 'percentage' of 0.0 is the
+        // minimum, and a 'percentage' of 1.0 is the maximum.  The behavior is
+        // undefined unless '0 <= threadGroupIndex < numThreadGroups',
+        // '0.0 <= percentage <= 1.0', and
+        // '0 < numLatencies(threadGroupIndex)'.
+
+                                  // Output
+
+    static bsl::ostream& printCsvHeader(bsl::ostream& stream);
+        // Write to the specified 'stream' a CSV header record naming the
+        // columns written by 'printCsv', and return a reference to 'stream'.
+
+    bsl::ostream& printCsv(bsl::ostream& stream, const char *label) const;
+        // Write to the specified 'stream' one CSV record for each thread group
+        // of this result, having the columns named by 'printCsvHeader' and the
+        // specified 'label' in the first column, and return a reference to
+        // 'stream'.  Latency columns are empty for thread groups having no
+        // latencies.  The behavior is undefined unless '0 < numSamples()'.
+
+    bsl::ostream& printJson(bsl::ostream& stream, const char *label) const;
+        // Write to the specified 'stream' a JSON object having the specified
+        // 'label', and for each thread group, the summary statistics, the
+        // latency percentiles (if any latencies were added), the throughput
+        // of the thread group in each sample, and the throughput of each
+        // thread in each sample, and return a reference to 'stream'.  The
+        // behavior is undefined unless '0 < numSamples()'.
+
                                   // Aspects
     bslma::Allocator *allocator() const;
         // Return the allocator used by this object.
@@ -349,6 +502,20 @@ void ThroughputBenchmarkResult::setThroughput(int    threadGroupIndex,
     d_vecThroughputs[sampleIndex][threadGroupIndex][threadIndex] = value;
 }
 
+inline
+void ThroughputBenchmarkResult::addLatency(int    threadGroupIndex,
+                                           double nanoseconds)
+{
+    BSLS_ASSERT(0                 <= nanoseconds);
+    BSLS_ASSERT(0                 <= threadGroupIndex);
+    BSLS_ASSERT(numThreadGroups() >  threadGroupIndex);
+
+    if (d_latencies.empty()) {
+        d_latencies.resize(numThreadGroups());
+    }
+    d_latencies[threadGroupIndex].push_back(nanoseconds);
+}
+
 // ACCESSORS
                                 // Object state
 inline
@@ -390,6 +557,17 @@ int ThroughputBenchmarkResult::totalNumThreads() const
     return nThreads;
 }
 
+inline
+int ThroughputBenchmarkResult::numLatencies(int threadGroupIndex) const
+{
+    BSLS_ASSERT(0                 <= threadGroupIndex);
+    BSLS_ASSERT(numThreadGroups() >  threadGroupIndex);
+
+    return d_latencies.empty()
+           ? 0
+           : static_cast<int>(d_latencies[threadGroupIndex].size());
+}
+
                                   // Results
 inline
 double ThroughputBenchmarkResult::getValue(int threadGroupIndex,
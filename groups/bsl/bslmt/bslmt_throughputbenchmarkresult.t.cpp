@@ -18,6 +18,8 @@
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
 #include <math.h>
@@ -86,10 +88,20 @@ using namespace bsl;
 // [10] void getPercentile(*percentile, percentage, tGroupIndex) const;
 // [10] void getPercentiles(*percentiles, threadGroupIndex) const;
 // [10] void getThreadPercentiles(*percentiles, threadGroupIndex) const;
+// [11] void addLatency(int threadGroupIndex, double nanoseconds);
+// [11] int removeOutliers(double iqrMultiplier = 1.5);
+// [11] int numLatencies(int threadGroupIndex) const;
+// [11] void getMean(double *mean, int threadGroupIndex) const;
+// [11] void getStandardDeviation(double *sd, int threadGroupIndex) const;
+// [11] void getConfidenceInterval(*lower, *upper, tgIndex) const;
+// [11] void getLatencyPercentile(*percentile, percentage, tgIndex) const;
+// [11] static ostream& printCsvHeader(ostream& stream);
+// [11] ostream& printCsv(ostream& stream, const char *label) const;
+// [11] ostream& printJson(ostream& stream, const char *label) const;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -205,7 +217,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -276,6 +288,380 @@ int main(int argc, char *argv[])
                   << percentiles[i] << "\n";
     }
 //..
+//
+///Example 2: Summarize and Export a Result
+/// - - - - - - - - - - - - - - - - - - - -
+// In this example we discard outlying samples from a result, calculate a
+// confidence interval for the mean throughput, and write the result as CSV.
+//
+// First, we populate a result having one thread group of one thread, where
+// the fourth sample was disturbed:
+//..
+    bsl::vector<int> sizes(1, 1);
+    bslmt::ThroughputBenchmarkResult result(8, sizes);
+
+    const double THROUGHPUTS[] = { 100, 101, 99, 10, 100, 102, 98, 100 };
+    for (int sId = 0; sId < 8; ++sId) {
+        result.setThroughput(0, 0, sId, THROUGHPUTS[sId]);
+    }
+//..
+// Then, we remove the outlying sample:
+//..
+    int numRemoved = result.removeOutliers();
+    ASSERT(1 == numRemoved);
+    ASSERT(7 == result.numSamples());
+//..
+// Next, we calculate the mean and its 95% confidence interval:
+//..
+    double mean, lower, upper;
+    result.getMean(&mean, 0);
+    result.getConfidenceInterval(&lower, &upper, 0);
+    ASSERT(100.0 == mean);
+    ASSERT(lower < mean && mean < upper);
+//..
+// Finally, we write the summary as CSV:
+//..
+    bslmt::ThroughputBenchmarkResult::printCsvHeader(bsl::cout);
+    result.printCsv(bsl::cout, "example");
+//..
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TEST SUMMARY STATISTICS, OUTLIERS, LATENCY, AND OUTPUT
+        //
+        // Concerns:
+        //: 1 'getMean' and 'getStandardDeviation' return the mean and sample
+        //:   standard deviation of the throughputs of a thread group (the
+        //:   sums over its threads) over the samples.
+        //:
+        //: 2 'getConfidenceInterval' returns the 95% Student's t interval
+        //:   around the mean, and a degenerate interval for one sample.
+        //:
+        //: 3 'removeOutliers' removes exactly the samples in which any thread
+        //:   group is outside its Tukey fences, preserves the order of the
+        //:   remaining samples, removes nothing if there are fewer than four
+        //:   samples, and returns the number removed.
+        //:
+        //: 4 Latencies are added per thread group, are cleared by
+        //:   'initialize', and are unaffected by 'removeOutliers'.
+        //:
+        //: 5 'printCsv' and 'printJson' write the expected records, escaping
+        //:   the label.
+        //:
+        //: 6 No memory is allocated from the default allocator, except
+        //:   temporarily by the accessors.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Populate objects with known throughputs and verify the
+        //:   statistics against values calculated by hand.  (C-1..2)
+        //:
+        //: 2 Using a table of throughput sequences, verify the samples
+        //:   removed by 'removeOutliers'.  (C-3)
+        //:
+        //: 3 Add latencies and verify 'numLatencies' and
+        //:   'getLatencyPercentile'.  (C-4)
+        //:
+        //: 4 Write an object to string streams, and compare with the expected
+        //:   output.  (C-5..6)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   void addLatency(int threadGroupIndex, double nanoseconds);
+        //   int removeOutliers(double iqrMultiplier = 1.5);
+        //   int numLatencies(int threadGroupIndex) const;
+        //   void getMean(double *mean, int threadGroupIndex) const;
+        //   void getStandardDeviation(double *sd, int threadGroupIndex) const;
+        //   void getConfidenceInterval(*lower, *upper, tgIndex) const;
+        //   void getLatencyPercentile(*percentile, percentage, tgIndex) const;
+        //   static ostream& printCsvHeader(ostream& stream);
+        //   ostream& printCsv(ostream& stream, const char *label) const;
+        //   ostream& printJson(ostream& stream, const char *label) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+              << "TEST SUMMARY STATISTICS, OUTLIERS, LATENCY, AND OUTPUT"
+              << endl
+              << "======================================================"
+              << endl;
+
+        bslma::TestAllocator supplied("supplied", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting mean, deviation, and interval."
+                          << endl;
+        {
+            bsl::vector<int> sizes(2, &supplied);
+            sizes[0] = 2;
+            sizes[1] = 1;
+
+            // Group 0 sums to 10, 12, 14, 16; group 1 is constant.
+
+            Obj mX(4, sizes, &supplied); const Obj& X = mX;
+            for (int sId = 0; sId < 4; ++sId) {
+                mX.setThroughput(0, 0, sId, 4.0 + sId);
+                mX.setThroughput(0, 1, sId, 6.0 + sId);
+                mX.setThroughput(1, 0, sId, 3.0);
+            }
+
+            double mean, stddev, lower, upper;
+            X.getMean(&mean, 0);
+            ASSERTV(mean, 13.0 == mean);
+            X.getStandardDeviation(&stddev, 0);
+            const double EXP_SD = sqrt(20.0 / 3.0);
+            ASSERTV(stddev, fabs(EXP_SD - stddev) < 1e-12);
+
+            X.getConfidenceInterval(&lower, &upper, 0);
+            const double HALF = 3.182 * EXP_SD / 2.0;
+            ASSERTV(lower, fabs(13.0 - HALF - lower) < 1e-9);
+            ASSERTV(upper, fabs(13.0 + HALF - upper) < 1e-9);
+
+            X.getMean(&mean, 1);
+            X.getStandardDeviation(&stddev, 1);
+            X.getConfidenceInterval(&lower, &upper, 1);
+            ASSERT(3.0 == mean);
+            ASSERT(0.0 == stddev);
+            ASSERT(3.0 == lower);
+            ASSERT(3.0 == upper);
+
+            // One sample.
+
+            Obj mY(1, sizes, &supplied); const Obj& Y = mY;
+            mY.setThroughput(0, 0, 0, 5.0);
+            mY.setThroughput(0, 1, 0, 2.0);
+            Y.getMean(&mean, 0);
+            Y.getStandardDeviation(&stddev, 0);
+            Y.getConfidenceInterval(&lower, &upper, 0);
+            ASSERT(7.0 == mean);
+            ASSERT(0.0 == stddev);
+            ASSERT(7.0 == lower);
+            ASSERT(7.0 == upper);
+
+            // Many samples use the large-sample approximation, which is close
+            // to the normal critical value.
+
+            sizes.resize(1);
+            sizes[0] = 1;
+            Obj mZ(1000, sizes, &supplied); const Obj& Z = mZ;
+            for (int sId = 0; sId < 1000; ++sId) {
+                mZ.setThroughput(0, 0, sId, sId % 2 ? 1.0 : 3.0);
+            }
+            Z.getStandardDeviation(&stddev, 0);
+            Z.getConfidenceInterval(&lower, &upper, 0);
+            const double T = (upper - lower) / 2.0 / (stddev / sqrt(1000.0));
+            ASSERTV(T, 1.962 < T && T < 1.963);
+        }
+
+        if (verbose) cout << "\nTesting 'removeOutliers'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                int         d_numSamples;
+                double      d_values[10];
+                const char *d_removed;  // 'x' for each removed sample
+            } DATA[] = {
+                //LINE  NS  VALUES                                REMOVED
+                //----  --  ------------------------------------  ----------
+                { L_,    1, { 1 },                                "-"        },
+                { L_,    3, { 1, 100, 1000 },                     "---"      },
+                { L_,    4, { 10, 10, 10, 10 },                   "----"     },
+                { L_,    4, { 10, 11, 12, 1000 },                 "----"     },
+                { L_,    5, { 10, 11, 12, 11, 1000 },             "----x"    },
+                { L_,    8, { 100, 101, 99, 10, 100, 102, 98, 100 },
+                                                                  "---x----" },
+                { L_,    8, { 100, 101, 99, 200, 100, 102, 98, 1 },
+                                                                  "---x---x" },
+                { L_,   10, { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 },
+                                                                 "----------"},
+                { L_,   10, { 5, 5, 5, 5, 5, 5, 5, 5, 5, 6 },
+                                                                 "---------x"},
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE = DATA[ti].d_line;
+                const int   NS   = DATA[ti].d_numSamples;
+                const char *REM  = DATA[ti].d_removed;
+
+                bsl::vector<int> sizes(1, 1, &supplied);
+                Obj mX(NS, sizes, &supplied); const Obj& X = mX;
+                for (int sId = 0; sId < NS; ++sId) {
+                    mX.setThroughput(0, 0, sId, DATA[ti].d_values[sId]);
+                }
+                mX.addLatency(0, 5.0);
+
+                bsl::vector<double> expected(&supplied);
+                for (int sId = 0; sId < NS; ++sId) {
+                    if ('-' == REM[sId]) {
+                        expected.push_back(DATA[ti].d_values[sId]);
+                    }
+                }
+
+                const int numRemoved = mX.removeOutliers();
+                ASSERTV(LINE, numRemoved,
+                        NS - static_cast<int>(expected.size()) == numRemoved);
+                ASSERTV(LINE, static_cast<int>(expected.size()) ==
+                                                             X.numSamples());
+                for (int sId = 0; sId < X.numSamples(); ++sId) {
+                    ASSERTV(LINE, sId, expected[sId] == X.getValue(0, 0, sId));
+                }
+                ASSERTV(LINE, 1 == X.numLatencies(0));
+                ASSERTV(LINE, 0 == defaultAllocator.numBlocksInUse());
+            }
+
+            // A larger multiplier removes fewer samples, and any sample
+            // outlying in any thread group is removed.
+
+            bsl::vector<int> sizes(2, 1, &supplied);
+            Obj mX(8, sizes, &supplied); const Obj& X = mX;
+            const double V0[] = { 100, 101, 99, 100, 100, 100, 130, 100 };
+            const double V1[] = { 50, 52, 5, 50, 51, 49, 50, 50 };
+            for (int sId = 0; sId < 8; ++sId) {
+                mX.setThroughput(0, 0, sId, V0[sId]);
+                mX.setThroughput(1, 0, sId, V1[sId]);
+            }
+            Obj mY(X, &supplied); const Obj& Y = mY;
+
+            ASSERT(2 == mX.removeOutliers());
+            ASSERT(6 == X.numSamples());
+            ASSERT(0 == mY.removeOutliers(100.0));
+            ASSERT(8 == Y.numSamples());
+        }
+
+        if (verbose) cout << "\nTesting latencies." << endl;
+        {
+            bsl::vector<int> sizes(2, 1, &supplied);
+            Obj mX(2, sizes, &supplied); const Obj& X = mX;
+
+            ASSERT(0 == X.numLatencies(0));
+            ASSERT(0 == X.numLatencies(1));
+
+            for (int i = 100; i >= 1; --i) {
+                mX.addLatency(1, static_cast<double>(i));
+            }
+            ASSERT(  0 == X.numLatencies(0));
+            ASSERT(100 == X.numLatencies(1));
+
+            double percentile;
+            X.getLatencyPercentile(&percentile, 0.0, 1);
+            ASSERT(1.0   == percentile);
+            X.getLatencyPercentile(&percentile, 0.5, 1);
+            ASSERT(51.0  == percentile);
+            X.getLatencyPercentile(&percentile, 0.99, 1);
+            ASSERT(100.0 == percentile);
+            X.getLatencyPercentile(&percentile, 1.0, 1);
+            ASSERT(100.0 == percentile);
+
+            Obj mY(X, &supplied); const Obj& Y = mY;
+            ASSERT(100 == Y.numLatencies(1));
+
+            mX.initialize(2, sizes);
+            ASSERT(0 == X.numLatencies(0));
+            ASSERT(0 == X.numLatencies(1));
+        }
+
+        if (verbose) cout << "\nTesting output." << endl;
+        {
+            bsl::vector<int> sizes(2, &supplied);
+            sizes[0] = 2;
+            sizes[1] = 1;
+
+            Obj mX(2, sizes, &supplied); const Obj& X = mX;
+            mX.setThroughput(0, 0, 0, 1.0);
+            mX.setThroughput(0, 1, 0, 2.0);
+            mX.setThroughput(0, 0, 1, 3.0);
+            mX.setThroughput(0, 1, 1, 4.0);
+            mX.setThroughput(1, 0, 0, 0.5);
+            mX.setThroughput(1, 0, 1, 0.5);
+            mX.addLatency(1, 250.0);
+
+            bsl::ostringstream header(&supplied);
+            Obj::printCsvHeader(header);
+            ASSERTV(header.str(), header.str() ==
+                    "label,threadGroup,numThreads,numSamples,median,mean,"
+                    "standardDeviation,ci95Lower,ci95Upper,min,max,"
+                    "numLatencies,latency_p50,latency_p90,latency_p99,"
+                    "latency_p999,latency_max\n");
+
+            bsl::ostringstream csv(&supplied);
+            X.printCsv(csv, "a\"b");
+            ASSERTV(csv.str(), csv.str() ==
+                    "\"a\"\"b\",0,2,2,5,5,2.828427125,-20.412,30.412,3,7,"
+                    "0,,,,,\n"
+                    "\"a\"\"b\",1,1,2,0.5,0.5,0,0.5,0.5,0.5,0.5,1,"
+                    "250,250,250,250,250\n");
+
+            bsl::ostringstream json(&supplied);
+            X.printJson(json, "q\"\\\n");
+            ASSERTV(json.str(), json.str() ==
+                    "{\"label\":\"q\\\"\\\\\\u000a\",\"numSamples\":2,"
+                    "\"threadGroups\":["
+                    "{\"index\":0,\"numThreads\":2,\"median\":5,\"mean\":5,"
+                    "\"standardDeviation\":2.828427125,"
+                    "\"ci95Lower\":-20.412,\"ci95Upper\":30.412,"
+                    "\"min\":3,\"max\":7,\"samples\":[3,7],"
+                    "\"threads\":[[1,3],[2,4]]},"
+                    "{\"index\":1,\"numThreads\":1,\"median\":0.5,"
+                    "\"mean\":0.5,\"standardDeviation\":0,"
+                    "\"ci95Lower\":0.5,\"ci95Upper\":0.5,\"min\":0.5,"
+                    "\"max\":0.5,\"latency\":{\"count\":1,\"p50\":250,"
+                    "\"p90\":250,\"p99\":250,\"p999\":250,\"max\":250},"
+                    "\"samples\":[0.5,0.5],\"threads\":[[0.5,0.5]]}]}");
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<int> sizes(2, 1, &supplied);
+            Obj mX(4, sizes, &supplied); const Obj& X = mX;
+
+            double value, other;
+            bsl::ostringstream out(&supplied);
+
+            ASSERT_FAIL(mX.addLatency(-1, 1.0));
+            ASSERT_FAIL(mX.addLatency( 2, 1.0));
+            ASSERT_FAIL(mX.addLatency( 0, -1.0));
+            ASSERT_PASS(mX.addLatency( 1, 0.0));
+
+            ASSERT_FAIL(mX.removeOutliers(-1.0));
+            ASSERT_PASS(mX.removeOutliers(0.0));
+
+            ASSERT_FAIL(X.numLatencies(-1));
+            ASSERT_FAIL(X.numLatencies( 2));
+            ASSERT_PASS(X.numLatencies( 1));
+
+            ASSERT_FAIL(X.getMean(0, 0));
+            ASSERT_FAIL(X.getMean(&value, 2));
+            ASSERT_PASS(X.getMean(&value, 1));
+
+            ASSERT_FAIL(X.getStandardDeviation(0, 0));
+            ASSERT_FAIL(X.getStandardDeviation(&value, -1));
+            ASSERT_PASS(X.getStandardDeviation(&value, 0));
+
+            ASSERT_FAIL(X.getConfidenceInterval(0, &other, 0));
+            ASSERT_FAIL(X.getConfidenceInterval(&value, 0, 0));
+            ASSERT_FAIL(X.getConfidenceInterval(&value, &other, 2));
+            ASSERT_PASS(X.getConfidenceInterval(&value, &other, 0));
+
+            ASSERT_FAIL(X.getLatencyPercentile(&value, 0.5, 0));
+            ASSERT_FAIL(X.getLatencyPercentile(&value, -0.1, 1));
+            ASSERT_FAIL(X.getLatencyPercentile(&value, 1.1, 1));
+            ASSERT_FAIL(X.getLatencyPercentile(0, 0.5, 1));
+            ASSERT_PASS(X.getLatencyPercentile(&value, 0.5, 1));
+
+            ASSERT_FAIL(X.printCsv(out, 0));
+            ASSERT_PASS(X.printCsv(out, ""));
+            ASSERT_FAIL(X.printJson(out, 0));
+            ASSERT_PASS(X.printJson(out, ""));
+
+            Obj mY(&supplied); const Obj& Y = mY;
+            ASSERT_FAIL(Y.printCsv(out, ""));
+            ASSERT_FAIL(Y.printJson(out, ""));
+        }
       } break;
       case 10: {
         // --------------------------------------------------------------------
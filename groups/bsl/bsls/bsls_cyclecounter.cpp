@@ -0,0 +1,123 @@
+// bsls_cyclecounter.cpp                                              -*-C++-*-
+#include <bsls_cyclecounter.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_atomicoperations.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The calibrated rate is stored as a fixed-point number of nanoseconds per
+// tick, scaled by '2^32', in a single atomic 64-bit integer, so that it can be
+// published and read without a lock.  A value of 0 indicates that the counter
+// has not yet been calibrated.  Each end of the calibration interval is
+// measured by reading the counter between two readings of the monotonic
+// clock, and attributing it to their midpoint, which halves the error
+// contributed by the latency of the clock.
+
+namespace BloombergLP {
+namespace bsls {
+namespace {
+
+const double k_SCALE = 4294967296.0;  // 2^32
+
+AtomicOperations::AtomicTypes::Int64 s_nanosecondsPerTickQ32 = { 0 };
+    // nanoseconds per tick, scaled by 'k_SCALE', or 0 if not yet calibrated
+
+Types::Int64 monotonicNanoseconds()
+    // Return the current time of the monotonic system clock in nanoseconds.
+{
+    return SystemTime::nowMonotonicClock().totalNanoseconds();
+}
+
+void sample(Types::Int64 *nanoseconds, Types::Int64 *ticks)
+    // Load into the specified 'ticks' the current value of the cycle counter,
+    // and into the specified 'nanoseconds' the corresponding time of the
+    // monotonic system clock.
+{
+    const Types::Int64 before = monotonicNanoseconds();
+    *ticks                    = CycleCounter::now();
+    const Types::Int64 after  = monotonicNanoseconds();
+
+    *nanoseconds = before + (after - before) / 2;
+}
+
+Types::Int64 loadScale()
+    // Return the calibrated scale, calibrating the counter if necessary.
+{
+    Types::Int64 scale =
+             AtomicOperations::getInt64Acquire(&s_nanosecondsPerTickQ32);
+    if (0 == scale) {
+        CycleCounter::calibrate();
+        scale = AtomicOperations::getInt64Acquire(&s_nanosecondsPerTickQ32);
+    }
+    return scale;
+}
+
+}  // close unnamed namespace
+
+                             // -------------------
+                             // struct CycleCounter
+                             // -------------------
+
+// CLASS METHODS
+void CycleCounter::calibrate()
+{
+    Types::Int64 scale = static_cast<Types::Int64>(k_SCALE);
+
+    if (isHardwareCounter()) {
+        Types::Int64 startNanoseconds, startTicks;
+        Types::Int64 endNanoseconds,   endTicks;
+
+        sample(&startNanoseconds, &startTicks);
+        do {
+            sample(&endNanoseconds, &endTicks);
+        } while (endNanoseconds - startNanoseconds < k_CALIBRATION_NANOSECONDS
+              || endTicks <= startTicks);
+
+        const double nanosecondsPerTick =
+                     static_cast<double>(endNanoseconds - startNanoseconds) /
+                     static_cast<double>(endTicks - startTicks);
+
+        scale = static_cast<Types::Int64>(nanosecondsPerTick * k_SCALE);
+        if (0 == scale) {
+            scale = 1;  // A counter faster than 2^32 GHz is not plausible.
+        }
+    }
+
+    AtomicOperations::setInt64Release(&s_nanosecondsPerTickQ32, scale);
+}
+
+Types::Int64 CycleCounter::convertToNanoseconds(Types::Int64 ticks)
+{
+    return static_cast<Types::Int64>(static_cast<double>(ticks) *
+                                     static_cast<double>(loadScale()) /
+                                     k_SCALE);
+}
+
+double CycleCounter::nanosecondsPerTick()
+{
+    return static_cast<double>(loadScale()) / k_SCALE;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
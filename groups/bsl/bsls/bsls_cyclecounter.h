@@ -0,0 +1,203 @@
+// bsls_cyclecounter.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLS_CYCLECOUNTER
+#define INCLUDED_BSLS_CYCLECOUNTER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a low-overhead calibrated hardware cycle counter.
+//
+//@CLASSES:
+//  bsls::CycleCounter: namespace for reading and converting cycle counts
+//
+//@SEE_ALSO: bsls_timeutil, bsls_systemtime, bsls_stopwatch
+//
+//@DESCRIPTION: This component provides a 'struct', 'bsls::CycleCounter', that
+// serves as a namespace for functions reading a monotonically increasing,
+// processor-local *tick* counter, and converting tick differences to
+// nanoseconds.  On platforms providing an invariant hardware timestamp counter
+// accessible from user mode (the 'RDTSC' instruction on x86 and x86-64, and
+// the virtual counter register 'CNTVCT_EL0' on 64-bit ARM) built with a
+// supported compiler, 'now' reads that counter directly, which costs a few
+// nanoseconds and does not enter the kernel.  On other platforms, 'now'
+// returns 'bsls::TimeUtil::getTimer()', whose ticks are nanoseconds.
+//
+// The rate of the hardware counter is not known at compile time, so tick
+// differences are converted to nanoseconds using a rate measured *once*, by
+// comparing the counter with 'bsls::SystemTime::nowMonotonicClock' over a
+// short interval ('k_CALIBRATION_NANOSECONDS').  The calibration is performed
+// by 'calibrate', which is called implicitly by the first call to
+// 'convertToNanoseconds' or 'nanosecondsPerTick' (if it has not been called
+// before).  As calibration busy-waits for several milliseconds, applications
+// should call 'calibrate' explicitly during initialization, rather than incur
+// the delay on first use.
+//
+///Accuracy and Precision
+///----------------------
+// Tick values are meaningful only as differences between two values read on
+// the same machine, and are intended for measuring short intervals (such as
+// the latency of a function call) where the overhead of 'bsls::TimeUtil' is
+// significant.  The hardware counters used by this component are synchronized
+// across the cores of modern processors, and run at a constant rate
+// independent of frequency scaling, but this is not guaranteed by all
+// hardware, virtualization environments, or multi-socket systems.  The error
+// of the calibrated rate is typically well under 0.1%.  Applications needing
+// wall-clock time, or intervals longer than a few seconds, should use
+// 'bsls::SystemTime' or 'bsls::TimeUtil' instead.
+//
+///Thread Safety
+///-------------
+// All functions of 'bsls::CycleCounter' are *thread-safe*.  Concurrent first
+// calls to 'convertToNanoseconds' may each perform a calibration, in which
+// case the rate measured last is retained.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Timing a Short Operation
+///- - - - - - - - - - - - - - - - - -
+// Suppose we want to measure the time taken by a short operation, without
+// the overhead of a system call on each measurement.  First, we calibrate the
+// counter during application initialization:
+//..
+//  bsls::CycleCounter::calibrate();
+//  assert(0.0 < bsls::CycleCounter::nanosecondsPerTick());
+//..
+// Then, we read the counter before and after the operation:
+//..
+//  const bsls::Types::Int64 start = bsls::CycleCounter::now();
+//
+//  volatile int sum = 0;
+//  for (int i = 0; i < 1000; ++i) {
+//      sum += i;
+//  }
+//
+//  const bsls::Types::Int64 end = bsls::CycleCounter::now();
+//  assert(start <= end);
+//..
+// Finally, we convert the elapsed ticks to nanoseconds:
+//..
+//  const bsls::Types::Int64 elapsed =
+//                       bsls::CycleCounter::convertToNanoseconds(end - start);
+//  assert(0 <= elapsed);
+//..
+
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)                                           \
+ && (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))
+    #include <intrin.h>
+    #define BSLS_CYCLECOUNTER_HARDWARE_MSVC_X86 1
+#elif (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))    \
+   && (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))
+    #define BSLS_CYCLECOUNTER_HARDWARE_GNU_X86 1
+#elif (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))    \
+   && defined(BSLS_PLATFORM_CPU_ARM) && defined(BSLS_PLATFORM_CPU_64_BIT)
+    #define BSLS_CYCLECOUNTER_HARDWARE_GNU_ARM64 1
+#endif
+
+namespace BloombergLP {
+namespace bsls {
+
+                             // ===================
+                             // struct CycleCounter
+                             // ===================
+
+struct CycleCounter {
+    // This 'struct' provides a namespace for functions reading a calibrated,
+    // low-overhead tick counter (see {Accuracy and Precision}).
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_CALIBRATION_NANOSECONDS = 10 * 1000 * 1000
+                                        // minimum interval over which the
+                                        // rate of the counter is measured
+    };
+
+    // CLASS METHODS
+    static void calibrate();
+        // Measure the rate of the tick counter returned by 'now' against
+        // 'SystemTime::nowMonotonicClock', busy-waiting for at least
+        // 'k_CALIBRATION_NANOSECONDS', and store the rate for use by
+        // 'convertToNanoseconds' and 'nanosecondsPerTick'.  Note that if the
+        // counter is not a hardware counter, no measurement is performed.
+
+    static Types::Int64 convertToNanoseconds(Types::Int64 ticks);
+        // Return the specified 'ticks' (typically the difference of two
+        // values returned by 'now') converted to nanoseconds, calling
+        // 'calibrate' first if the counter has not yet been calibrated.
+
+    static bool isHardwareCounter();
+        // Return 'true' if 'now' reads a hardware timestamp counter, and
+        // 'false' if it returns 'TimeUtil::getTimer()'.
+
+    static double nanosecondsPerTick();
+        // Return the number of nanoseconds per tick of the counter returned
+        // by 'now', calling 'calibrate' first if the counter has not yet been
+        // calibrated.
+
+    static Types::Int64 now();
+        // Return the current value of a monotonically non-decreasing tick
+        // counter.  The rate of the counter is given by 'nanosecondsPerTick'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // -------------------
+                             // struct CycleCounter
+                             // -------------------
+
+// CLASS METHODS
+inline
+bool CycleCounter::isHardwareCounter()
+{
+#if defined(BSLS_CYCLECOUNTER_HARDWARE_MSVC_X86)                              \
+ || defined(BSLS_CYCLECOUNTER_HARDWARE_GNU_X86)                               \
+ || defined(BSLS_CYCLECOUNTER_HARDWARE_GNU_ARM64)
+    return true;
+#else
+    return false;
+#endif
+}
+
+inline
+Types::Int64 CycleCounter::now()
+{
+#if defined(BSLS_CYCLECOUNTER_HARDWARE_MSVC_X86)
+    return static_cast<Types::Int64>(__rdtsc());
+#elif defined(BSLS_CYCLECOUNTER_HARDWARE_GNU_X86)
+    return static_cast<Types::Int64>(__builtin_ia32_rdtsc());
+#elif defined(BSLS_CYCLECOUNTER_HARDWARE_GNU_ARM64)
+    Types::Uint64 value;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+    return static_cast<Types::Int64>(value);
+#else
+    return TimeUtil::getTimer();
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,413 @@
+// bsls_cyclecounter.t.cpp                                            -*-C++-*-
+#include <bsls_cyclecounter.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a tick counter and a conversion from
+// ticks to nanoseconds.  Since the tick counter is not deterministic, we
+// verify that it is monotonic, and that intervals converted to nanoseconds
+// agree with those measured by the monotonic system clock to within a
+// tolerance.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] void calibrate();
+// [ 3] Int64 convertToNanoseconds(Int64 ticks);
+// [ 2] bool isHardwareCounter();
+// [ 3] double nanosecondsPerTick();
+// [ 2] Int64 now();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'now' VERSUS 'TimeUtil::getTimer'
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BSL TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::CycleCounter Obj;
+typedef bsls::Types::Int64 Int64;
+
+// ============================================================================
+//                              HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+Int64 monotonicNanoseconds()
+    // Return the current time of the monotonic system clock in nanoseconds.
+{
+    return bsls::SystemTime::nowMonotonicClock().totalNanoseconds();
+}
+
+void spin(Int64 nanoseconds)
+    // Busy-wait for at least the specified 'nanoseconds'.
+{
+    const Int64 start = monotonicNanoseconds();
+    while (monotonicNanoseconds() - start < nanoseconds) {
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Timing a Short Operation
+///- - - - - - - - - - - - - - - - - -
+// Suppose we want to measure the time taken by a short operation, without
+// the overhead of a system call on each measurement.  First, we calibrate the
+// counter during application initialization:
+//..
+    bsls::CycleCounter::calibrate();
+    ASSERT(0.0 < bsls::CycleCounter::nanosecondsPerTick());
+//..
+// Then, we read the counter before and after the operation:
+//..
+    const bsls::Types::Int64 start = bsls::CycleCounter::now();
+
+    volatile int sum = 0;
+    for (int i = 0; i < 1000; ++i) {
+        sum += i;
+    }
+
+    const bsls::Types::Int64 end = bsls::CycleCounter::now();
+    ASSERT(start <= end);
+//..
+// Finally, we convert the elapsed ticks to nanoseconds:
+//..
+    const bsls::Types::Int64 elapsed =
+                         bsls::CycleCounter::convertToNanoseconds(end - start);
+    ASSERT(0 <= elapsed);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CALIBRATION AND CONVERSION
+        //
+        // Concerns:
+        //: 1 The first call to 'convertToNanoseconds' or 'nanosecondsPerTick'
+        //:   calibrates the counter.
+        //:
+        //: 2 'calibrate' takes at least 'k_CALIBRATION_NANOSECONDS' for a
+        //:   hardware counter.
+        //:
+        //: 3 'convertToNanoseconds' converts tick differences to nanoseconds
+        //:   consistent with the monotonic system clock.
+        //:
+        //: 4 'convertToNanoseconds' is linear, and converts 0 to 0.
+        //:
+        //: 5 If the counter is not a hardware counter, a tick is one
+        //:   nanosecond.
+        //
+        // Plan:
+        //: 1 Call 'nanosecondsPerTick' without calibrating, and verify the
+        //:   result is positive.  (C-1)
+        //:
+        //: 2 Time 'calibrate' using the system clock.  (C-2)
+        //:
+        //: 3 Measure intervals of several durations with both the counter and
+        //:   the monotonic system clock, and verify they agree to within 5%.
+        //:   (C-3)
+        //:
+        //: 4 Verify the conversion of specific tick values.  (C-4..5)
+        //
+        // Testing:
+        //   void calibrate();
+        //   Int64 convertToNanoseconds(Int64 ticks);
+        //   double nanosecondsPerTick();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCALIBRATION AND CONVERSION"
+                            "\n==========================\n");
+
+        const double RATE = Obj::nanosecondsPerTick();
+        if (veryVerbose) { P(RATE) }
+        ASSERTV(RATE, 0.0 < RATE);
+
+        {
+            const Int64 START = monotonicNanoseconds();
+            Obj::calibrate();
+            const Int64 ELAPSED = monotonicNanoseconds() - START;
+            if (veryVerbose) { P(ELAPSED) }
+
+            if (Obj::isHardwareCounter()) {
+                ASSERTV(ELAPSED, Obj::k_CALIBRATION_NANOSECONDS <= ELAPSED);
+            }
+            else {
+                ASSERTV(Obj::nanosecondsPerTick(),
+                        1.0 == Obj::nanosecondsPerTick());
+            }
+        }
+
+        ASSERT(0 == Obj::convertToNanoseconds(0));
+
+        const Int64 T = 1000 * 1000 * 1000;
+        const Int64 N = Obj::convertToNanoseconds(T);
+        const Int64 N2 = Obj::convertToNanoseconds(2 * T);
+        ASSERTV(N, N2, 2 * N - 1 <= N2);
+        ASSERTV(N, N2, 2 * N + 1 >= N2);
+        ASSERTV(N, -N == Obj::convertToNanoseconds(-T));
+
+        static const Int64 DURATIONS[] = {
+            5 * 1000 * 1000, 20 * 1000 * 1000, 50 * 1000 * 1000
+        };
+        const int NUM_DURATIONS = static_cast<int>(sizeof DURATIONS /
+                                                   sizeof *DURATIONS);
+
+        for (int i = 0; i < NUM_DURATIONS; ++i) {
+            const Int64 DURATION = DURATIONS[i];
+
+            const Int64 T0 = monotonicNanoseconds();
+            const Int64 C0 = Obj::now();
+            spin(DURATION);
+            const Int64 C1 = Obj::now();
+            const Int64 T1 = monotonicNanoseconds();
+
+            const Int64 CLOCK   = T1 - T0;
+            const Int64 COUNTER = Obj::convertToNanoseconds(C1 - C0);
+            if (veryVerbose) { P_(DURATION) P_(CLOCK) P(COUNTER) }
+
+            ASSERTV(i, CLOCK, COUNTER, COUNTER <= CLOCK + CLOCK / 20);
+            ASSERTV(i, CLOCK, COUNTER, COUNTER >= CLOCK - CLOCK / 20);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'now' AND 'isHardwareCounter'
+        //
+        // Concerns:
+        //: 1 Successive values returned by 'now' do not decrease.
+        //:
+        //: 2 The counter advances.
+        //:
+        //: 3 'isHardwareCounter' returns 'true' on x86 and x86-64 platforms
+        //:   built with a supported compiler.
+        //
+        // Plan:
+        //: 1 Read the counter repeatedly and verify the sequence is
+        //:   non-decreasing, and that its final value exceeds its first.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify 'isHardwareCounter' on the supported platforms.  (C-3)
+        //
+        // Testing:
+        //   bool isHardwareCounter();
+        //   Int64 now();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'now' AND 'isHardwareCounter'"
+                            "\n=============================\n");
+
+        if (veryVerbose) { P(Obj::isHardwareCounter()) }
+
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)       \
+  || defined(BSLS_PLATFORM_CMP_MSVC))
+        ASSERT(Obj::isHardwareCounter());
+#endif
+
+        const int NUM_READS = 100000;
+
+        const Int64 FIRST    = Obj::now();
+        Int64       previous = FIRST;
+        int         numDecreases = 0;
+        for (int i = 0; i < NUM_READS; ++i) {
+            const Int64 current = Obj::now();
+            if (current < previous) {
+                ++numDecreases;
+            }
+            previous = current;
+        }
+        spin(1000 * 1000);
+
+        ASSERTV(numDecreases, 0 == numDecreases);
+        ASSERTV(FIRST, Obj::now(), FIRST < Obj::now());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Read the counter twice around a short delay and convert the
+        //:   difference to nanoseconds.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj::calibrate();
+
+        const Int64 START = Obj::now();
+        spin(10 * 1000 * 1000);
+        const Int64 END   = Obj::now();
+
+        ASSERT(START < END);
+
+        const Int64 ELAPSED = Obj::convertToNanoseconds(END - START);
+        if (veryVerbose) { P(ELAPSED) }
+
+        ASSERTV(ELAPSED,  5 * 1000 * 1000 < ELAPSED);
+        ASSERTV(ELAPSED, 50 * 1000 * 1000 > ELAPSED);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'now' VERSUS 'TimeUtil::getTimer'
+        //
+        // Concerns:
+        //: 1 'now' is substantially cheaper than 'bsls::TimeUtil::getTimer'.
+        //
+        // Plan:
+        //: 1 Time a large number of calls to each function, and report the
+        //:   average cost of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'now' VERSUS 'TimeUtil::getTimer'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: 'now' VERSUS 'TimeUtil::getTimer'"
+               "\n==============================================\n");
+
+        const int NUM_CALLS = argc > 2 ? atoi(argv[2]) : 10 * 1000 * 1000;
+
+        Int64 sink = 0;
+
+        Int64 start = monotonicNanoseconds();
+        for (int i = 0; i < NUM_CALLS; ++i) {
+            sink += Obj::now();
+        }
+        const Int64 nowElapsed = monotonicNanoseconds() - start;
+
+        start = monotonicNanoseconds();
+        for (int i = 0; i < NUM_CALLS; ++i) {
+            sink += bsls::TimeUtil::getTimer();
+        }
+        const Int64 timerElapsed = monotonicNanoseconds() - start;
+
+        printf("CycleCounter::now:     %6.2f ns/call\n",
+               static_cast<double>(nowElapsed) / NUM_CALLS);
+        printf("TimeUtil::getTimer:    %6.2f ns/call\n",
+               static_cast<double>(timerElapsed) / NUM_CALLS);
+        printf("(ignore: %lld)\n", sink);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -22,6 +22,32 @@ BSLS_IDENT("$Id: $")
 // provides a safe and more performant alternative to 'snprintf' in contexts
 // where complex formatting options or locale are not important.
 //
+// The overloads of 'to_chars' for 'double' and 'float' write the shortest
+// representation of a value that reads back as that value (optionally in the
+// notation of a 'chars_format'), or the value with a precision, as 'printf'
+// does (see 'bslalg_numericformatterutil').  'bsl::chars_format' is an alias
+// of 'std::chars_format' where the native library provides it, and otherwise
+// a 'struct' scoping the enumerators 'scientific', 'fixed', and 'general', so
+// that 'bsl::chars_format::fixed' (for example) is portable.  Note that
+// 'std::chars_format::hex', and the overloads for 'long double', are not
+// provided by this implementation.
+//
+// 'from_chars' parses integral values, in a base, and 'double' and 'float'
+// values, in the notation of a 'chars_format', from a range of characters that
+// need not be null-terminated, without copying it or depending on the locale,
+// and so provides a faster alternative to 'strtol' and 'strtod'.  A 'double'
+// or 'float' value is parsed as the value closest to the decimal number, as
+// 'strtod' does, using an Eisel-Lemire fast path that falls back to exact
+// arithmetic only for numbers that it cannot round (see
+// 'bslalg_numericparserutil').  As for 'std::from_chars', whitespace, a
+// leading '+', and hexadecimal floating point numbers are not accepted, and
+// 'value' is not modified unless 'ec' is 'ErrcEnum()'.
+//
+// The native 'std::to_chars' and 'std::from_chars' are used only if the native
+// library provides the overloads for floating point types (as indicated by the
+// feature test macro '__cpp_lib_to_chars'), so that 'bsl::to_chars' and
+// 'bsl::from_chars' always provide them.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -68,12 +94,76 @@ BSLS_IDENT("$Id: $")
 //      result->sputn(buffer, sts.ptr - buffer);
 //  }
 //..
+//
+///Example 2: Writing a 'double' in the Fewest Characters
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write prices, which are 'double' values, using as few
+// characters as possible, without losing precision.
+//
+// First, we declare a buffer large enough for any 'double' in its shortest
+// representation:
+//..
+//  char buffer[24];
+//..
+// Then, we write the price, which is written as it was input, although its
+// binary value is not exactly '100.12':
+//..
+//  bsl::to_chars_result sts = bsl::to_chars(buffer,
+//                                           buffer + sizeof(buffer),
+//                                           100.12);
+//  assert(bsl::ErrcEnum() == sts.ec);
+//  assert("100.12" == bslstl::StringRef(buffer, sts.ptr));
+//..
+// Finally, we write a large price in fixed notation, and a price with a
+// precision of 2 digits after the point, as 'printf' with "%.2f" would, which
+// rounds the exact binary value of '2.675', slightly less than '2.675':
+//..
+//  sts = bsl::to_chars(buffer,
+//                      buffer + sizeof(buffer),
+//                      2.5e7,
+//                      bsl::chars_format::fixed);
+//  assert("25000000" == bslstl::StringRef(buffer, sts.ptr));
+//
+//  sts = bsl::to_chars(buffer,
+//                      buffer + sizeof(buffer),
+//                      2.675,
+//                      bsl::chars_format::fixed,
+//                      2);
+//  assert("2.67" == bslstl::StringRef(buffer, sts.ptr));
+//..
+//
+///Example 3: Parsing a 'double' from a Field
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to parse a price from the beginning of a field that is not
+// null-terminated, and that is followed by a currency.
+//
+// First, we parse the price, and check that the whole number was parsed:
+//..
+//  const char field[] = "101.25USD";
+//
+//  double                 price;
+//  bsl::from_chars_result rc = bsl::from_chars(field,
+//                                              field + sizeof(field) - 1,
+//                                              price);
+//  assert(bsl::ErrcEnum() == rc.ec);
+//  assert(field + 6       == rc.ptr);
+//  assert(101.25          == price);
+//..
+// Finally, we check that a field that does not begin with a number is
+// rejected, and that 'price' is not modified:
+//..
+//  rc = bsl::from_chars(field + 6, field + sizeof(field) - 1, price);
+//  assert(bsl::errc::invalid_argument == rc.ec);
+//  assert(field + 6                   == rc.ptr);
+//  assert(101.25                      == price);
+//..
 
 #include <bslscm_version.h>
 
 #include <bslstl_errc.h>
 
 #include <bslalg_numericformatterutil.h>
+#include <bslalg_numericparserutil.h>
 #include <bslmf_assert.h>
 #include <bslmf_isintegral.h>
 #include <bslmf_issame.h>
@@ -92,6 +182,23 @@ BSLS_IDENT("$Id: $")
 namespace BloombergLP {
 namespace bslstl {
 
+                              // ==================
+                              // struct chars_format
+                              // ==================
+
+struct chars_format {
+    // This 'struct' provides a namespace for the notations in which 'to_chars'
+    // can write floating point values, in lieu of the scoped enumeration
+    // 'std::chars_format' of C++17.
+
+    // TYPES
+    enum Enum {
+        scientific = bslalg::NumericFormatterUtil::e_SCIENTIFIC,
+        fixed      = bslalg::NumericFormatterUtil::e_FIXED,
+        general    = bslalg::NumericFormatterUtil::e_GENERAL
+    };
+};
+
                             // ========================
                             // struct 'to_chars_result'
                             // ========================
@@ -108,6 +215,24 @@ struct to_chars_result {
     bsl::ErrcEnum  ec;
 };
 
+                           // ==========================
+                           // struct 'from_chars_result'
+                           // ==========================
+
+struct from_chars_result {
+    // This 'struct' represents the result of the 'from_chars' function.  On a
+    // successful call to 'from_chars', 'ptr' is one past the last character
+    // parsed, and 'ec' is a default constructed ErrcEnum.  If no number was
+    // found, 'ptr' is the beginning of the parsed range and 'ec' is
+    // 'errc::invalid_argument'.  If the number parsed is not representable,
+    // 'ptr' is one past its last character and 'ec' is
+    // 'errc::result_out_of_range'.
+
+    // PUBLIC DATA
+    const char    *ptr;
+    bsl::ErrcEnum  ec;
+};
+
 // FREE OPERATORS
 template <class INTEGRAL_TYPE>
 to_chars_result
@@ -126,6 +251,85 @@ to_chars(char *first, char *last, INTEGRAL_TYPE value, int base = 10);
     // only failure mode.  The behavior is undefined unless 'first < last' and
     // 'base' is in the range '[ 2 .. 36 ]'.
 
+to_chars_result to_chars(char *first, char *last, double value);
+to_chars_result to_chars(char *first, char *last, float value);
+    // Write the shortest representation of the specified 'value' that reads
+    // back as 'value' into the character buffer starting at the specified
+    // 'first' and ending at the specified 'last', in fixed or scientific
+    // notation, whichever is shorter (fixed in case of a tie).  Return a
+    // 'to_chars_result' 'struct' whose 'ptr' field points at the end of the
+    // representation, and whose 'ec' field is 0, on success.  If the buffer
+    // specified by '[ first .. last )' is not large enough for the result,
+    // return a 'struct' with 'ptr' set to 'last' and 'ec' set to
+    // 'errc::value_too_large'.  The behavior is undefined unless
+    // 'first <= last'.
+
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         double              value,
+                         chars_format::Enum  format);
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         float               value,
+                         chars_format::Enum  format);
+    // Write the shortest representation of the specified 'value' that reads
+    // back as 'value' into the character buffer starting at the specified
+    // 'first' and ending at the specified 'last', in the notation of the
+    // specified 'format'.  Return a 'to_chars_result' as described above.
+    // The behavior is undefined unless 'first <= last'.
+
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         double              value,
+                         chars_format::Enum  format,
+                         int                 precision);
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         float               value,
+                         chars_format::Enum  format,
+                         int                 precision);
+    // Write the specified 'value' into the character buffer starting at the
+    // specified 'first' and ending at the specified 'last', in the notation of
+    // the specified 'format' with the specified 'precision', as 'printf' does
+    // with the "C" locale and the conversion "%.*e", "%.*f", or "%.*g" for
+    // 'scientific', 'fixed', and 'general', respectively.  If 'precision' is
+    // negative, 6 is used.  Return a 'to_chars_result' as described above.
+    // The behavior is undefined unless 'first <= last'.
+
+template <class INTEGRAL_TYPE>
+from_chars_result from_chars(const char     *first,
+                             const char     *last,
+                             INTEGRAL_TYPE&  value,
+                             int             base = 10);
+    // Parse the longest prefix of the range specified by '[ first .. last )'
+    // that is an integer in the optionally specified 'base', preceded by an
+    // optional '-' if 'INTEGRAL_TYPE' is signed, and, if that integer is
+    // representable by 'INTEGRAL_TYPE', load it into the specified 'value'.
+    // If 'base' is not specified, decimal is used.  Return a
+    // 'from_chars_result' 'struct' as described above.  'value' is not
+    // modified unless the returned 'ec' is 0.  The behavior is undefined
+    // unless 'first <= last' and 'base' is in the range '[ 2 .. 36 ]'.
+
+from_chars_result from_chars(const char         *first,
+                             const char         *last,
+                             double&             value,
+                             chars_format::Enum  format
+                                                      = chars_format::general);
+from_chars_result from_chars(const char         *first,
+                             const char         *last,
+                             float&              value,
+                             chars_format::Enum  format
+                                                      = chars_format::general);
+    // Parse the longest prefix of the range specified by '[ first .. last )'
+    // that is a decimal number in the notation of the optionally specified
+    // 'format' (an exponent being mandatory for 'scientific', and not parsed
+    // for 'fixed'), or an infinity or a NaN, preceded by an optional '-', and,
+    // if the value closest to that number is finite or the number is an
+    // infinity, load that value into the specified 'value'.  If 'format' is
+    // not specified, 'general' is used.  Return a 'from_chars_result'
+    // 'struct' as described above.  'value' is not modified unless the
+    // returned 'ec' is 0.  The behavior is undefined unless 'first <= last'.
+
 // ============================================================================
 //                         INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -158,6 +362,214 @@ to_chars(char *first, char *last, INTEGRAL_TYPE value, int base)
     return ret;
 }
 
+inline
+to_chars_result to_chars(char *first, char *last, double value)
+{
+    char *end = bslalg::NumericFormatterUtil::toChars(first, last, value);
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+to_chars_result to_chars(char *first, char *last, float value)
+{
+    char *end = bslalg::NumericFormatterUtil::toChars(first, last, value);
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         double              value,
+                         chars_format::Enum  format)
+{
+    typedef bslalg::NumericFormatterUtil Util;
+
+    char *end = Util::toChars(first,
+                              last,
+                              value,
+                              static_cast<Util::Format>(format));
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         float               value,
+                         chars_format::Enum  format)
+{
+    typedef bslalg::NumericFormatterUtil Util;
+
+    char *end = Util::toChars(first,
+                              last,
+                              value,
+                              static_cast<Util::Format>(format));
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         double              value,
+                         chars_format::Enum  format,
+                         int                 precision)
+{
+    typedef bslalg::NumericFormatterUtil Util;
+
+    char *end = Util::toChars(first,
+                              last,
+                              value,
+                              static_cast<Util::Format>(format),
+                              precision);
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+to_chars_result to_chars(char               *first,
+                         char               *last,
+                         float               value,
+                         chars_format::Enum  format,
+                         int                 precision)
+{
+    typedef bslalg::NumericFormatterUtil Util;
+
+    char *end = Util::toChars(first,
+                              last,
+                              value,
+                              static_cast<Util::Format>(format),
+                              precision);
+    if (!end) {
+        const to_chars_result ret = { last, bsl::errc::value_too_large };
+        return ret;                                                   // RETURN
+    }
+
+    const to_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+template <class INTEGRAL_TYPE>
+inline
+from_chars_result from_chars(const char     *first,
+                             const char     *last,
+                             INTEGRAL_TYPE&  value,
+                             int             base)
+{
+    BSLS_ASSERT(2 <= base);
+    BSLS_ASSERT(base <= 36);
+    BSLS_ASSERT(first <= last);
+
+    typedef bslalg::NumericParserUtil Util;
+
+    const char         *end;
+    const Util::Status  status = Util::fromChars(&value,
+                                                 &end,
+                                                 first,
+                                                 last,
+                                                 base);
+    if (Util::e_SUCCESS != status) {
+        const from_chars_result ret = {
+            end,
+            Util::e_INVALID == status ? bsl::errc::invalid_argument
+                                      : bsl::errc::result_out_of_range
+        };
+        return ret;                                                   // RETURN
+    }
+
+    const from_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+from_chars_result from_chars(const char         *first,
+                             const char         *last,
+                             double&             value,
+                             chars_format::Enum  format)
+{
+    typedef bslalg::NumericParserUtil Util;
+
+    double              result;
+    const char         *end;
+    const Util::Status  status = Util::fromChars(
+                                            &result,
+                                            &end,
+                                            first,
+                                            last,
+                                            static_cast<Util::Format>(format));
+    if (Util::e_SUCCESS != status) {
+        const from_chars_result ret = {
+            end,
+            Util::e_INVALID == status ? bsl::errc::invalid_argument
+                                      : bsl::errc::result_out_of_range
+        };
+        return ret;                                                   // RETURN
+    }
+
+    value = result;
+
+    const from_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
+inline
+from_chars_result from_chars(const char         *first,
+                             const char         *last,
+                             float&              value,
+                             chars_format::Enum  format)
+{
+    typedef bslalg::NumericParserUtil Util;
+
+    float               result;
+    const char         *end;
+    const Util::Status  status = Util::fromChars(
+                                            &result,
+                                            &end,
+                                            first,
+                                            last,
+                                            static_cast<Util::Format>(format));
+    if (Util::e_SUCCESS != status) {
+        const from_chars_result ret = {
+            end,
+            Util::e_INVALID == status ? bsl::errc::invalid_argument
+                                      : bsl::errc::result_out_of_range
+        };
+        return ret;                                                   // RETURN
+    }
+
+    value = result;
+
+    const from_chars_result ret = { end, bsl::ErrcEnum() };
+    return ret;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -165,15 +577,22 @@ to_chars(char *first, char *last, INTEGRAL_TYPE value, int base)
 
 namespace bsl {
 
-#if defined(BSLS_LIBRARYFEATURES_SUPPORT_CHARCONV)
+#if defined(BSLS_LIBRARYFEATURES_SUPPORT_CHARCONV)                           \
+ && defined(__cpp_lib_to_chars)
 
+using std::chars_format;
 using std::to_chars_result;
 using std::to_chars;
+using std::from_chars_result;
+using std::from_chars;
 
 #else
 
+using BloombergLP::bslstl::chars_format;
 using BloombergLP::bslstl::to_chars_result;
 using BloombergLP::bslstl::to_chars;
+using BloombergLP::bslstl::from_chars_result;
+using BloombergLP::bslstl::from_chars;
 
 #endif
 
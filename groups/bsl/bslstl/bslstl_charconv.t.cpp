@@ -96,7 +96,9 @@ using std::numeric_limits;
 // generator.  The random tests of less than 8 bytes are done by masking the
 // result of 'mmixRand64' down to the appropriate number of bytes.
 // ----------------------------------------------------------------------------
-// [ 8] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
+// [ 9] FROM_CHARS TEST
+// [ 8] FLOATING POINT TEST
 // [ 7] RANDOM 8-BYTE VALUES TEST
 // [ 6] RANDOM 4-BYTE VALUES TEST
 // [ 5] RANDOM 2-BYTE VALUES TEST
@@ -489,6 +491,84 @@ Uint64 mmixRand64(Uint64 seed = 0)
 
 const Uint64 uint64Max = ~0ULL;    // max value a 'Uint64' can represent
 
+enum { k_NONE = -2 };    // no format, or no precision
+
+template <class FLOAT>
+bsl::to_chars_result toCharsWithFormat(char  *first,
+                                       char  *last,
+                                       FLOAT  value,
+                                       int    format,
+                                       int    precision)
+    // Call 'bsl::to_chars' on the specified '[ first, last )' and 'value'
+    // with 'chars_format::scientific', 'chars_format::fixed', or
+    // 'chars_format::general' if the specified 'format' is 0, 1, or 2, and
+    // with the specified 'precision' unless it is 'k_NONE', and return the
+    // result.
+{
+    switch (format) {
+      case 0: {
+        return k_NONE == precision
+               ? bsl::to_chars(first,
+                               last,
+                               value,
+                               bsl::chars_format::scientific)
+               : bsl::to_chars(first,
+                               last,
+                               value,
+                               bsl::chars_format::scientific,
+                               precision);                            // RETURN
+      }
+      case 1: {
+        return k_NONE == precision
+               ? bsl::to_chars(first, last, value, bsl::chars_format::fixed)
+               : bsl::to_chars(first,
+                               last,
+                               value,
+                               bsl::chars_format::fixed,
+                               precision);                            // RETURN
+      }
+    }
+    BSLS_ASSERT(2 == format);
+    return k_NONE == precision
+           ? bsl::to_chars(first, last, value, bsl::chars_format::general)
+           : bsl::to_chars(first,
+                           last,
+                           value,
+                           bsl::chars_format::general,
+                           precision);
+}
+
+template <class FLOAT>
+bsl::from_chars_result fromCharsWithFormat(const char *first,
+                                           const char *last,
+                                           FLOAT&      value,
+                                           int         format)
+    // Call 'bsl::from_chars' on the specified '[ first, last )' and 'value'
+    // with 'chars_format::scientific', 'chars_format::fixed', or
+    // 'chars_format::general' if the specified 'format' is 0, 1, or 2, and
+    // with no format if it is 'k_NONE', and return the result.
+{
+    switch (format) {
+      case k_NONE: {
+        return bsl::from_chars(first, last, value);                   // RETURN
+      }
+      case 0: {
+        return bsl::from_chars(first,
+                               last,
+                               value,
+                               bsl::chars_format::scientific);        // RETURN
+      }
+      case 1: {
+        return bsl::from_chars(first,
+                               last,
+                               value,
+                               bsl::chars_format::fixed);             // RETURN
+      }
+    }
+    BSLS_ASSERT(2 == format);
+    return bsl::from_chars(first, last, value, bsl::chars_format::general);
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -559,7 +639,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 8: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -570,6 +650,10 @@ int main(int argc, char *argv[])
         //: 1 The function 'writeJsonScalar' (above) demonstrates how the
         //:   component could be used to write a number, in ascii, to a
         //:   'streambuf'.
+        //:
+        //: 2 Write 'double' values as in the second example.
+        //:
+        //: 3 Parse a 'double' value as in the third example.
         //
         // Testing:
         //   USAGE EXAMPLE
@@ -596,6 +680,398 @@ int main(int argc, char *argv[])
 
         writeJsonScalar(sb, -1234567890);    // worst case int, max string len
         ASSERT("-1234567890" == oss.str());
+
+///Example 2: Writing a 'double' in the Fewest Characters
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write prices, which are 'double' values, using as few
+// characters as possible, without losing precision.
+//
+// First, we declare a buffer large enough for any 'double' in its shortest
+// representation:
+//..
+        char buffer[24];
+//..
+// Then, we write the price, which is written as it was input, although its
+// binary value is not exactly '100.12':
+//..
+        bsl::to_chars_result sts = bsl::to_chars(buffer,
+                                                 buffer + sizeof(buffer),
+                                                 100.12);
+        ASSERT(bsl::ErrcEnum() == sts.ec);
+        ASSERT("100.12" == bslstl::StringRef(buffer, sts.ptr));
+//..
+// Finally, we write a large price in fixed notation, and a price with a
+// precision of 2 digits after the point, as 'printf' with "%.2f" would, which
+// rounds the exact binary value of '2.675', slightly less than '2.675':
+//..
+        sts = bsl::to_chars(buffer,
+                            buffer + sizeof(buffer),
+                            2.5e7,
+                            bsl::chars_format::fixed);
+        ASSERT("25000000" == bslstl::StringRef(buffer, sts.ptr));
+
+        sts = bsl::to_chars(buffer,
+                            buffer + sizeof(buffer),
+                            2.675,
+                            bsl::chars_format::fixed,
+                            2);
+        ASSERT("2.67" == bslstl::StringRef(buffer, sts.ptr));
+//..
+//
+///Example 3: Parsing a 'double' from a Field
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to parse a price from the beginning of a field that is not
+// null-terminated, and that is followed by a currency.
+//
+// First, we parse the price, and check that the whole number was parsed:
+//..
+        const char field[] = "101.25USD";
+
+        double                 price;
+        bsl::from_chars_result rc = bsl::from_chars(field,
+                                                    field + sizeof(field) - 1,
+                                                    price);
+        ASSERT(bsl::ErrcEnum() == rc.ec);
+        ASSERT(field + 6       == rc.ptr);
+        ASSERT(101.25          == price);
+//..
+// Finally, we check that a field that does not begin with a number is
+// rejected, and that 'price' is not modified:
+//..
+        rc = bsl::from_chars(field + 6, field + sizeof(field) - 1, price);
+        ASSERT(bsl::errc::invalid_argument == rc.ec);
+        ASSERT(field + 6                   == rc.ptr);
+        ASSERT(101.25                      == price);
+//..
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // FROM_CHARS TEST
+        //
+        // Concern:
+        //: 1 That 'from_chars' parses integral values in a base, and 'double'
+        //:   and 'float' values in each 'chars_format', stopping at the first
+        //:   character that cannot continue the number.
+        //:
+        //: 2 That, on success, 'ec' is 'ErrcEnum()' and 'ptr' is one past the
+        //:   last character parsed.
+        //:
+        //: 3 That, if no number is found, 'ec' is 'errc::invalid_argument',
+        //:   'ptr' is 'first', and 'value' is not modified.
+        //:
+        //: 4 That, if the number is not representable, 'ec' is
+        //:   'errc::result_out_of_range', 'ptr' is one past the number, and
+        //:   'value' is not modified.
+        //:
+        //: 5 That the values written by 'to_chars' are read back.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse strings as 'int',
+        //:   'unsigned char', 'double', and 'float', and verify 'ec', 'ptr',
+        //:   and the value.  (C-1..4)
+        //:
+        //: 2 Write random 'double' values in their shortest representation,
+        //:   and read them back with 'from_chars'.  (C-5)
+        //
+        // Testing:
+        //   FROM_CHARS TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FROM_CHARS TEST\n"
+                            "===============\n");
+
+        const bsl::ErrcEnum OK  = bsl::ErrcEnum();
+        const bsl::ErrcEnum BAD = bsl::errc::invalid_argument;
+        const bsl::ErrcEnum OOR = bsl::errc::result_out_of_range;
+
+        if (verbose) printf("Integral values.\n");
+        {
+            static const struct {
+                int            d_line;
+                const char    *d_input;
+                int            d_base;
+                bool           d_isUnsignedChar;
+                bsl::ErrcEnum  d_ec;
+                int            d_length;
+                int            d_value;
+            } DATA[] = {
+                //LINE  INPUT           BASE  UCHAR  EC   LEN  VALUE
+                //----  --------------  ----  -----  ---  ---  -----------
+                { L_,   "",             10,   0,     BAD,   0,           0 },
+                { L_,   "+1",           10,   0,     BAD,   0,           0 },
+                { L_,   " 1",           10,   0,     BAD,   0,           0 },
+                { L_,   "0",            10,   0,      OK,   1,           0 },
+                { L_,   "-42;",         10,   0,      OK,   3,         -42 },
+                { L_,   "7fffffffz",    16,   0,      OK,   8,     INT_MAX },
+                { L_,   "-2147483648",  10,   0,      OK,  11,     INT_MIN },
+                { L_,   "2147483648",   10,   0,     OOR,  10,           0 },
+                { L_,   "255",          10,   1,      OK,   3,         255 },
+                { L_,   "256",          10,   1,     OOR,   3,           0 },
+                { L_,   "-1",           10,   1,     BAD,   0,           0 },
+                { L_,   "11111111",      2,   1,      OK,   8,         255 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int            LINE     = DATA[ti].d_line;
+                const char          *INPUT    = DATA[ti].d_input;
+                const int            BASE     = DATA[ti].d_base;
+                const bool           IS_UCHAR = DATA[ti].d_isUnsignedChar;
+                const bsl::ErrcEnum  EC       = DATA[ti].d_ec;
+                const IntPtr         LEN      = DATA[ti].d_length;
+                const int            VALUE    = DATA[ti].d_value;
+                const char          *LAST     = INPUT + std::strlen(INPUT);
+
+                if (veryVerbose) { T_ P_(LINE) P_(INPUT) P(BASE) }
+
+                bsl::from_chars_result rc;
+                int                    value;
+                if (IS_UCHAR) {
+                    unsigned char uc = 7;
+                    rc    = bsl::from_chars(INPUT, LAST, uc, BASE);
+                    value = uc;
+                }
+                else {
+                    value = 7;
+                    rc    = bsl::from_chars(INPUT, LAST, value, BASE);
+                }
+
+                ASSERTV(LINE, EC == rc.ec);
+                ASSERTV(LINE, rc.ptr - INPUT, INPUT + LEN == rc.ptr);
+                ASSERTV(LINE, value, (OK == EC ? VALUE : 7) == value);
+            }
+        }
+
+        if (verbose) printf("Floating point values.\n");
+        {
+            const int    k_NONE = u::k_NONE;
+            const double INF = std::numeric_limits<double>::infinity();
+
+            static const struct {
+                int            d_line;
+                const char    *d_input;
+                int            d_format;     // 0: sci, 1: fixed, 2: general
+                bsl::ErrcEnum  d_ec;
+                int            d_length;
+                double         d_value;
+            } DATA[] = {
+                //LINE  INPUT              FORMAT  EC   LEN  VALUE
+                //----  -----------------  ------  ---  ---  ------------
+                { L_,   "",                k_NONE, BAD,   0,           0 },
+                { L_,   "+1",              k_NONE, BAD,   0,           0 },
+                { L_,   ".e1",             k_NONE, BAD,   0,           0 },
+                { L_,   "0",               k_NONE,  OK,   1,           0 },
+                { L_,   "-2.5x",           k_NONE,  OK,   4,        -2.5 },
+                { L_,   "0.1",             k_NONE,  OK,   3,         0.1 },
+                { L_,   "1.5e3",           k_NONE,  OK,   5,        1500 },
+                { L_,   "1.5e3",           0,       OK,   5,        1500 },
+                { L_,   "1.5",             0,      BAD,   0,           0 },
+                { L_,   "1.5e3",           1,       OK,   3,         1.5 },
+                { L_,   "1.5e3",           2,       OK,   5,        1500 },
+                { L_,   "1e",              k_NONE,  OK,   1,           1 },
+                { L_,   "-inf",            k_NONE,  OK,   4,        -INF },
+                { L_,   "Infinity",        k_NONE,  OK,   8,         INF },
+                { L_,   "1e400",           k_NONE, OOR,   5,           0 },
+                { L_,   "1e-400",          k_NONE, OOR,   6,           0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int            LINE   = DATA[ti].d_line;
+                const char          *INPUT  = DATA[ti].d_input;
+                const int            FORMAT = DATA[ti].d_format;
+                const bsl::ErrcEnum  EC     = DATA[ti].d_ec;
+                const IntPtr         LEN    = DATA[ti].d_length;
+                const double         VALUE  = DATA[ti].d_value;
+                const char          *LAST   = INPUT + std::strlen(INPUT);
+
+                if (veryVerbose) { T_ P_(LINE) P_(INPUT) P(FORMAT) }
+
+                double d = 7;
+                float  f = 7;
+
+                const bsl::from_chars_result rcD =
+                                u::fromCharsWithFormat(INPUT, LAST, d, FORMAT);
+                const bsl::from_chars_result rcF =
+                                u::fromCharsWithFormat(INPUT, LAST, f, FORMAT);
+
+                ASSERTV(LINE, EC == rcD.ec);
+                ASSERTV(LINE, rcD.ptr - INPUT, INPUT + LEN == rcD.ptr);
+                ASSERTV(LINE, d, (OK == EC ? VALUE : 7) == d);
+
+                ASSERTV(LINE, EC == rcF.ec);
+                ASSERTV(LINE, rcF.ptr - INPUT, INPUT + LEN == rcF.ptr);
+                ASSERTV(LINE, f, (OK == EC ? static_cast<float>(VALUE)
+                                           : 7.0f) == f);
+            }
+        }
+
+        if (verbose) printf("Round trip random values.\n");
+
+        const int iterations = 10000 * multiplier;
+        u::mmixRand64(0x0123456789abcdefULL);
+
+        for (int ii = 0; ii < iterations; ++ii) {
+            const Uint64 bits  = u::mmixRand64();
+            double       value;
+            std::memcpy(&value, &bits, sizeof value);
+            if (value != value || value - value != 0) {
+                continue;    // skip infinities and NaNs
+            }
+
+            char                       buffer[32];
+            const bsl::to_chars_result sts = bsl::to_chars(
+                                                       buffer,
+                                                       buffer + sizeof buffer,
+                                                       value);
+            ASSERTV(bits, bsl::ErrcEnum() == sts.ec);
+
+            double                       parsed;
+            const bsl::from_chars_result rc = bsl::from_chars(buffer,
+                                                              sts.ptr,
+                                                              parsed);
+            ASSERTV(bits, bsl::ErrcEnum() == rc.ec);
+            ASSERTV(bits, sts.ptr == rc.ptr);
+            ASSERTV(bits, value == parsed);
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // FLOATING POINT TEST
+        //
+        // Concern:
+        //: 1 That 'to_chars' writes 'double' and 'float' values, with and
+        //:   without a format and a precision.
+        //:
+        //: 2 That, on success, 'ec' is 'ErrcEnum()' and 'ptr' is one past the
+        //:   last character written.
+        //:
+        //: 3 That, when the buffer is too short, 'ec' is
+        //:   'errc::value_too_large' and 'ptr' is the end of the buffer.
+        //:
+        //: 4 That the shortest representation written reads back as the same
+        //:   value.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, write values with each
+        //:   overload, first to a buffer that is long enough, and then to a
+        //:   buffer that is one character too short.  (C-1..3)
+        //:
+        //: 2 Write random 'double' values in their shortest representation,
+        //:   and read them back with 'strtod'.  (C-4)
+        //
+        // Testing:
+        //   FLOATING POINT TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING POINT TEST\n"
+                            "===================\n");
+
+        const int k_NONE = u::k_NONE;
+
+        static const struct {
+            int         d_line;
+            double      d_value;
+            bool        d_isFloat;
+            int         d_format;      // 0: sci, 1: fixed, 2: general
+            int         d_precision;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  VALUE       FLT  FORMAT  PREC    EXPECTED
+            //----  ----------  ---  ------  ------  ----------------------
+            { L_,   0.0,        0,   k_NONE, k_NONE, "0"                   },
+            { L_,   -2.5,       0,   k_NONE, k_NONE, "-2.5"                },
+            { L_,   0.1,        0,   k_NONE, k_NONE, "0.1"                 },
+            { L_,   0.1,        1,   k_NONE, k_NONE, "0.1"                 },
+            { L_,   1e100,      0,   k_NONE, k_NONE, "1e+100"              },
+            { L_,   1.0 / 3,    0,   k_NONE, k_NONE, "0.3333333333333333"  },
+            { L_,   1.0 / 3,    1,   k_NONE, k_NONE, "0.33333334"          },
+            { L_,   1500.0,     0,   0,      k_NONE, "1.5e+03"             },
+            { L_,   1500.0,     1,   0,      k_NONE, "1.5e+03"             },
+            { L_,   1e10,       0,   1,      k_NONE, "10000000000"         },
+            { L_,   1e10,       1,   1,      k_NONE, "10000000000"         },
+            { L_,   1e10,       0,   2,      k_NONE, "1e+10"               },
+            { L_,   1500.0,     0,   2,      k_NONE, "1500"                },
+            { L_,   1500.0,     0,   0,      1,      "1.5e+03"             },
+            { L_,   0.125,      0,   1,      2,      "0.12"                },
+            { L_,   0.125,      1,   1,      2,      "0.12"                },
+            { L_,   0.1,        0,   2,      17,     "0.10000000000000001" },
+            { L_,   0.1,        1,   2,      9,      "0.100000001"         },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE      = DATA[ti].d_line;
+            const double       VALUE     = DATA[ti].d_value;
+            const bool         IS_FLOAT  = DATA[ti].d_isFloat;
+            const int          FORMAT    = DATA[ti].d_format;
+            const int          PRECISION = DATA[ti].d_precision;
+            const char        *EXPECTED  = DATA[ti].d_expected;
+            const IntPtr       LEN       = std::strlen(EXPECTED);
+            const float        FVALUE    = static_cast<float>(VALUE);
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(VALUE) P_(IS_FLOAT) P_(FORMAT) P(PRECISION)
+            }
+
+            for (IntPtr size = LEN; LEN - 1 <= size; --size) {
+                char                 buffer[32];
+                bsl::to_chars_result sts;
+
+                if (k_NONE == FORMAT) {
+                    sts = IS_FLOAT
+                        ? bsl::to_chars(buffer, buffer + size, FVALUE)
+                        : bsl::to_chars(buffer, buffer + size, VALUE);
+                }
+                else {
+                    sts = IS_FLOAT
+                        ? u::toCharsWithFormat(buffer,
+                                               buffer + size,
+                                               FVALUE,
+                                               FORMAT,
+                                               PRECISION)
+                        : u::toCharsWithFormat(buffer,
+                                               buffer + size,
+                                               VALUE,
+                                               FORMAT,
+                                               PRECISION);
+                }
+
+                if (LEN == size) {
+                    ASSERTV(LINE, bsl::ErrcEnum() == sts.ec);
+                    ASSERTV(LINE, buffer + LEN == sts.ptr);
+                    ASSERTV(LINE, EXPECTED,
+                            EXPECTED == bslstl::StringRef(buffer, sts.ptr));
+                }
+                else {
+                    ASSERTV(LINE, bsl::errc::value_too_large == sts.ec);
+                    ASSERTV(LINE, buffer + size == sts.ptr);
+                }
+            }
+        }
+
+        if (verbose) printf("Round trip random values.\n");
+
+        const int iterations = 10000 * multiplier;
+        u::mmixRand64(0x0123456789abcdefULL);
+
+        for (int ii = 0; ii < iterations; ++ii) {
+            const Uint64 bits  = u::mmixRand64();
+            double       value;
+            std::memcpy(&value, &bits, sizeof value);
+            if (value != value || value - value != 0) {
+                continue;    // skip infinities and NaNs
+            }
+
+            char                       buffer[32];
+            const bsl::to_chars_result sts = bsl::to_chars(
+                                                       buffer,
+                                                       buffer + sizeof buffer,
+                                                       value);
+            ASSERTV(bits, bsl::ErrcEnum() == sts.ec);
+            *sts.ptr = 0;
+            ASSERTV(bits, buffer, value == std::strtod(buffer, 0));
+        }
       } break;
       case 7: {
         // --------------------------------------------------------------------
@@ -0,0 +1,166 @@
+// zoneinfo_compiler.m.cpp                                            -*-C++-*-
+
+//@PURPOSE: Compile a Zoneinfo database into a memory-mappable image file.
+//
+//@SEE_ALSO: baltzo_zoneinfoimageutil, baltzo_imagefileloader
+//
+//@DESCRIPTION: This program compiles the time zones of a Zoneinfo database
+// (by default, the one used by 'baltzo::DefaultZoneinfoCache') into a zoneinfo
+// image file, which processes map into memory to load time zones without
+// reading or parsing Zoneinfo binary files (see 'baltzo_imagefileloader').
+// The image file is replaced atomically, so it may be recompiled while
+// processes are using it.  After writing the image, the program maps it and
+// verifies that every time zone loaded from it has the value of the time zone
+// loaded from its Zoneinfo binary file.
+//..
+//  Usage: zoneinfo_compiler [--root <zoneinfo-root>] [--no-verify] <image>
+//..
+// The processes on a host use the image through the automatically configured
+// default Zoneinfo cache by setting the 'BDE_ZONEINFO_IMAGE_PATH' environment
+// variable to the path of the image file (see 'baltzo_defaultzoneinfocache').
+
+#include <baltzo_datafileloader.h>
+#include <baltzo_defaultzoneinfocache.h>
+#include <baltzo_imagefileloader.h>
+#include <baltzo_zoneinfo.h>
+#include <baltzo_zoneinfoimage.h>
+#include <baltzo_zoneinfoimageutil.h>
+
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+void printUsage(const char *program)
+    // Print the usage of this program, whose name is the specified 'program',
+    // to the standard error stream.
+{
+    bsl::cerr << "Usage: " << program
+              << " [--root <zoneinfo-root>] [--no-verify] <image>\n"
+              << "  --root       root directory of the Zoneinfo database "
+                 "(default: "
+              << baltzo::DefaultZoneinfoCache::defaultZoneinfoDataLocation()
+              << ")\n"
+              << "  --no-verify  do not compare the image with the database\n";
+}
+
+int verifyImage(const char *imagePath, const char *rootPath)
+    // Compare each time zone of the Zoneinfo database having the specified
+    // 'rootPath' with the time zone loaded from the image file at the
+    // specified 'imagePath', printing the time zones that differ.  Return 0
+    // if every time zone is the same, and a non-zero value otherwise.
+{
+    bsl::vector<bsl::string> timeZoneIds;
+    if (0 != baltzo::ZoneinfoImageUtil::loadTimeZoneIds(&timeZoneIds,
+                                                        rootPath)) {
+        bsl::cerr << "Failed to read '" << rootPath << "'\n";
+        return 1;                                                     // RETURN
+    }
+
+    baltzo::ImageFileLoader imageLoader;
+    if (0 != imageLoader.mapImage(imagePath)) {
+        bsl::cerr << "Failed to map '" << imagePath << "'\n";
+        return 1;                                                     // RETURN
+    }
+
+    baltzo::DataFileLoader fileLoader;
+    fileLoader.configureRootPath(rootPath);
+
+    int numErrors = 0;
+    for (bsl::size_t i = 0; i < timeZoneIds.size(); ++i) {
+        const char *id = timeZoneIds[i].c_str();
+
+        baltzo::Zoneinfo fromImage;
+        baltzo::Zoneinfo fromFile;
+
+        if (0 != imageLoader.loadTimeZone(&fromImage, id)
+         || 0 != fileLoader.loadTimeZone(&fromFile, id)
+         || fromImage != fromFile) {
+            bsl::cerr << "Time zone '" << id << "' differs\n";
+            ++numErrors;
+        }
+    }
+
+    if (static_cast<int>(timeZoneIds.size()) !=
+                                          imageLoader.image().numTimeZones()) {
+        bsl::cerr << "The image has " << imageLoader.image().numTimeZones()
+                  << " time zones, and the database has "
+                  << timeZoneIds.size() << '\n';
+        ++numErrors;
+    }
+
+    if (0 == numErrors) {
+        bsl::cout << "Wrote " << imageLoader.image().numTimeZones()
+                  << " time zones (" << imageLoader.image().length()
+                  << " bytes) to '" << imagePath << "'\n";
+    }
+    return numErrors;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const char *rootPath  = 0;
+    const char *imagePath = 0;
+    bool        verify    = true;
+
+    for (int i = 1; i < argc; ++i) {
+        if (0 == bsl::strcmp("--root", argv[i]) && i + 1 < argc) {
+            rootPath = argv[++i];
+        }
+        else if (0 == bsl::strcmp("--no-verify", argv[i])) {
+            verify = false;
+        }
+        else if (0 == bsl::strcmp("--help", argv[i])
+              || '-' == argv[i][0]
+              || 0 != imagePath) {
+            printUsage(argv[0]);
+            return 2;                                                 // RETURN
+        }
+        else {
+            imagePath = argv[i];
+        }
+    }
+
+    if (0 == imagePath) {
+        printUsage(argv[0]);
+        return 2;                                                     // RETURN
+    }
+
+    if (0 == rootPath) {
+        rootPath = baltzo::DefaultZoneinfoCache::defaultZoneinfoDataLocation();
+    }
+
+    if (0 != baltzo::ZoneinfoImageUtil::writeImageFile(imagePath, rootPath)) {
+        bsl::cerr << "Failed to compile '" << rootPath << "' into '"
+                  << imagePath << "'\n";
+        return 1;                                                     // RETURN
+    }
+
+    return verify ? verifyImage(imagePath, rootPath) : 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------